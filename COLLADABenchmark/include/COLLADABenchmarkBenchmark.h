@@ -0,0 +1,162 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADABenchmark.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADABENCHMARK_BENCHMARK_H__
+#define __COLLADABENCHMARK_BENCHMARK_H__
+
+#include "COLLADABenchmarkPrerequisites.h"
+#include "COLLADABenchmarkSceneGenerator.h"
+
+#include <vector>
+#include <iosfwd>
+
+
+namespace COLLADABenchmark
+{
+
+	/** Generates a synthetic document for each requested COLLADA version and measures writing it with
+	COLLADASW::StreamWriter, loading it with COLLADASaxFWL::Loader into a CountingWriter, with and without
+	object data, validating it the way COLLADAValidator does and a round trip of writing and loading it. Additionally the
+	resolution of sid paths is measured on documents with a growing number of animation channels. The results are written as
+	JSON, so they can be compared between runs.*/
+	class Benchmark
+	{
+	public:
+		typedef std::vector<COLLADASW::StreamWriter::COLLADAVersion> VersionList;
+
+		/** The result of one scenario.*/
+		struct Result
+		{
+			Result();
+
+			/** The name of the scenario, i.e. "write", "load", "parseOnly", "validate", "roundTrip" or "sidScaling".*/
+			String name;
+
+			/** The COLLADA version of the document.*/
+			COLLADASW::StreamWriter::COLLADAVersion version;
+
+			/** The fastest of all iterations in seconds.*/
+			double minimumTime;
+
+			/** The mean time of all iterations in seconds.*/
+			double meanTime;
+
+			/** The size of the document in bytes.*/
+			size_t bytes;
+
+			/** The number of objects written or loaded per iteration.*/
+			size_t objects;
+
+			/** The time spent parsing in the fastest iteration, if the loader has been involved.*/
+			double parseTime;
+
+			/** The time spent post processing in the fastest iteration, if the loader has been involved.*/
+			double postProcessingTime;
+
+			/** True, if all iterations succeeded and loaded all generated objects.*/
+			bool succeeded;
+
+			/** True, if the scenario is not available in this build and has not been measured.*/
+			bool skipped;
+		};
+
+		typedef std::vector<Result> ResultList;
+
+	private:
+		/** The parameters of the generated documents, except the version.*/
+		SceneParameters mParameters;
+
+		/** The versions to generate documents for.*/
+		VersionList mVersions;
+
+		/** The number of times each scenario is executed.*/
+		size_t mIterations;
+
+		/** The directory the documents are generated in.*/
+		String mDirectory;
+
+		/** If false, the generated documents are deleted after they have been measured.*/
+		bool mKeepDocuments;
+
+		/** The number of animation channels of the smallest document of the sid scaling scenario.*/
+		size_t mSidScalingChannels;
+
+		/** The results of all scenarios executed by run().*/
+		ResultList mResults;
+
+	public:
+
+        /** Constructor. */
+		Benchmark( const SceneParameters& parameters, const VersionList& versions, size_t iterations, const String& directory );
+
+        /** Destructor. */
+		virtual ~Benchmark();
+
+		/** If false, the generated documents are deleted after they have been measured. Default is false.*/
+		void setKeepDocuments( bool keepDocuments ) { mKeepDocuments = keepDocuments; }
+
+		/** Sets the number of animation channels of the smallest document of the sid scaling scenario. The
+		following documents have twice as many channels as their predecessor. 0 skips the scenario. Default is 2000.*/
+		void setSidScalingChannels( size_t channels ) { mSidScalingChannels = channels; }
+
+		/** Executes all scenarios for all versions.
+		@return True, if all scenarios succeeded.*/
+		bool run();
+
+		/** The results of all scenarios executed by run().*/
+		const ResultList& getResults() const { return mResults; }
+
+		/** Writes the parameters and the results as JSON object to @a stream.*/
+		void writeJson( std::ostream& stream ) const;
+
+	private:
+
+        /** Disable default copy ctor. */
+		Benchmark( const Benchmark& pre );
+
+        /** Disable default assignment operator. */
+		const Benchmark& operator= ( const Benchmark& pre );
+
+		/** Executes all scenarios for @a version. The scenarios that load the document load it in all
+		iterations with one COLLADASaxFWL::LoadSession, so the generated parsers are only created in the
+		first iteration and the minimum time is the one of a loader that is reused for many documents.*/
+		void run( COLLADASW::StreamWriter::COLLADAVersion version );
+
+		/** Measures writing the document to @a fileName.*/
+		Result measureWrite( const SceneParameters& parameters, const String& fileName ) const;
+
+		/** Measures loading the document @a fileName into a CountingWriter, that requires the object data
+		@a requiredObjectData (COLLADAFW::IWriter::ObjectData).*/
+		Result measureLoad( const SceneParameters& parameters, const String& fileName, int requiredObjectData ) const;
+
+		/** Measures validating the document @a fileName with the error handler and writer of COLLADAValidator.
+		Skipped, if the parsers have been compiled without GENERATEDSAXPARSER_VALIDATION, since it would only
+		measure an ordinary load.*/
+		Result measureValidate( const SceneParameters& parameters, const String& fileName ) const;
+
+		/** Measures writing the document to @a fileName and loading it back into a CountingWriter.*/
+		Result measureRoundTrip( const SceneParameters& parameters, const String& fileName ) const;
+
+		/** Measures loading documents of @a version whose animation channels target deep sid paths, with
+		SID_SCALING_STEPS growing channel counts. The largest document fails, if its load time per channel
+		exceeds the one of the smallest document by more than SID_SCALING_TOLERANCE, i.e. if the sid
+		resolution does not scale linearly.*/
+		void measureSidScaling( COLLADASW::StreamWriter::COLLADAVersion version );
+
+		/** Returns the name of @a version, e.g. "1.4.1".*/
+		static const char* getVersionName( COLLADASW::StreamWriter::COLLADAVersion version );
+
+		/** Returns the size of the file @a fileName in bytes.*/
+		static size_t getFileSize( const String& fileName );
+	};
+
+} // namespace COLLADABENCHMARK
+
+#endif // __COLLADABENCHMARK_BENCHMARK_H__
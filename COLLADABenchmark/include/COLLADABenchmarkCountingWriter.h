@@ -0,0 +1,103 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADABenchmark.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADABENCHMARK_COUNTINGWRITER_H__
+#define __COLLADABENCHMARK_COUNTINGWRITER_H__
+
+#include "COLLADABenchmarkPrerequisites.h"
+
+#include "COLLADAFWIWriter.h"
+
+
+namespace COLLADABenchmark
+{
+
+	/** A writer that discards all objects it receives and only counts them, used to measure the loader
+	without the cost of a real writer.*/
+	class CountingWriter : public COLLADAFW::IWriter
+	{
+	private:
+		/** The objects received since the last call of start().*/
+		ObjectCounts mObjectCounts;
+
+		/** True, if cancel() has been called since the last call of start().*/
+		bool mCanceled;
+
+		/** The object data returned by getRequiredObjectData().*/
+		int mRequiredObjectData;
+
+	public:
+
+        /** Constructor.
+		@param requiredObjectData The object data (COLLADAFW::IWriter::ObjectData) the loader should load.*/
+		CountingWriter( int requiredObjectData = ALL_OBJECT_DATA );
+
+        /** Destructor. */
+		virtual ~CountingWriter();
+
+		/** The objects received since the last call of start().*/
+		const ObjectCounts& getObjectCounts() const { return mObjectCounts; }
+
+		/** True, if cancel() has been called since the last call of start().*/
+		bool getCanceled() const { return mCanceled; }
+
+		virtual void cancel( const COLLADAFW::String& errorMessage );
+
+		virtual void start();
+
+		virtual void finish();
+
+		virtual int getRequiredObjectData() const { return mRequiredObjectData; }
+
+		virtual bool writeGlobalAsset( const COLLADAFW::FileInfo* asset );
+
+		virtual bool writeScene( const COLLADAFW::Scene* scene );
+
+		virtual bool writeVisualScene( const COLLADAFW::VisualScene* visualScene );
+
+		virtual bool writeLibraryNodes( const COLLADAFW::LibraryNodes* libraryNodes );
+
+		virtual bool writeGeometry( const COLLADAFW::Geometry* geometry );
+
+		virtual bool writeMaterial( const COLLADAFW::Material* material );
+
+		virtual bool writeEffect( const COLLADAFW::Effect* effect );
+
+		virtual bool writeCamera( const COLLADAFW::Camera* camera );
+
+		virtual bool writeImage( const COLLADAFW::Image* image );
+
+		virtual bool writeLight( const COLLADAFW::Light* light );
+
+		virtual bool writeAnimation( const COLLADAFW::Animation* animation );
+
+		virtual bool writeAnimationList( const COLLADAFW::AnimationList* animationList );
+
+		virtual bool writeSkinControllerData( const COLLADAFW::SkinControllerData* skinControllerData );
+
+		virtual bool writeController( const COLLADAFW::Controller* controller );
+
+		virtual bool writeFormulas( const COLLADAFW::Formulas* formulas );
+
+		virtual bool writeKinematicsScene( const COLLADAFW::KinematicsScene* kinematicsScene );
+
+	private:
+
+        /** Disable default copy ctor. */
+		CountingWriter( const CountingWriter& pre );
+
+        /** Disable default assignment operator. */
+		const CountingWriter& operator= ( const CountingWriter& pre );
+
+	};
+
+} // namespace COLLADABENCHMARK
+
+#endif // __COLLADABENCHMARK_COUNTINGWRITER_H__
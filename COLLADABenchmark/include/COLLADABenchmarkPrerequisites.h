@@ -0,0 +1,50 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADABenchmark.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADABENCHMARK_PREREQUISITES_H__
+#define __COLLADABENCHMARK_PREREQUISITES_H__
+
+#include <string>
+#include <stddef.h>
+
+namespace COLLADABenchmark
+{
+	typedef std::string String;
+
+	/** Number of objects of the kinds generated by SceneGenerator, either written to a document or
+	received by a COLLADAFW::IWriter.*/
+	struct ObjectCounts
+	{
+		ObjectCounts() : geometries(0), nodes(0), animations(0), controllers(0) {}
+
+		/** The number of meshes.*/
+		size_t geometries;
+
+		/** The number of nodes, including joints.*/
+		size_t nodes;
+
+		/** The number of animation curves.*/
+		size_t animations;
+
+		/** The number of skin controllers.*/
+		size_t controllers;
+
+		/** The number of all objects.*/
+		size_t getTotal() const { return geometries + nodes + animations + controllers; }
+
+		bool operator==( const ObjectCounts& other ) const
+		{
+			return geometries == other.geometries && nodes == other.nodes 
+				&& animations == other.animations && controllers == other.controllers;
+		}
+	};
+}
+
+#endif //__COLLADABENCHMARK_PREREQUISITES_H__
@@ -0,0 +1,95 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADABenchmark.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADABENCHMARK_SCENEGENERATOR_H__
+#define __COLLADABENCHMARK_SCENEGENERATOR_H__
+
+#include "COLLADABenchmarkPrerequisites.h"
+
+#include "COLLADASWStreamWriter.h"
+
+
+namespace COLLADABenchmark
+{
+
+	/** Parameters of a synthetic scene written by SceneGenerator.*/
+	struct SceneParameters
+	{
+		SceneParameters();
+
+		/** The COLLADA version of the document.*/
+		COLLADASW::StreamWriter::COLLADAVersion version;
+
+		/** The number of meshes in library_geometries.*/
+		size_t meshCount;
+
+		/** The number of vertices of each mesh. Each mesh has vertexCount - 2 triangles.*/
+		size_t vertexCount;
+
+		/** The number of nodes in the visual scene, each instantiating one of the meshes.*/
+		size_t nodeCount;
+
+		/** The nodes are nested in chains of nodeDepth nodes.*/
+		size_t nodeDepth;
+
+		/** The number of animation channels. Each channel animates the rotation of one of the nodes.*/
+		size_t animationCount;
+
+		/** The number of keys of each animation channel.*/
+		size_t keyCount;
+
+		/** The number of skin controllers, each skinning one of the meshes.*/
+		size_t skinCount;
+
+		/** The number of joints of the skeleton all skin controllers are bound to.*/
+		size_t jointCount;
+
+		/** If true, the nodes have sids and each animation channel targets its node by the sid path from
+		the first node of its chain, e.g. "node0/level1/level2/rotateZ.ANGLE", instead of by its id. Each
+		animation is then written to its own library_animations.*/
+		bool sidPaths;
+
+		/** Returns the number of objects a document generated with these parameters contains.*/
+		ObjectCounts getObjectCounts() const;
+	};
+
+
+	/** Writes synthetic COLLADA documents with COLLADASW::StreamWriter, used to measure the performance of
+	the stream writer and the loader on documents of arbitrary size.*/
+	class SceneGenerator
+	{
+	private:
+		/** The parameters of the generated document.*/
+		SceneParameters mParameters;
+
+	public:
+
+        /** Constructor. */
+		SceneGenerator( const SceneParameters& parameters );
+
+        /** Destructor. */
+		virtual ~SceneGenerator();
+
+		/** Writes the document to @a fileName.*/
+		void generate( const COLLADABU::NativeString& fileName ) const;
+
+	private:
+
+        /** Disable default copy ctor. */
+		SceneGenerator( const SceneGenerator& pre );
+
+        /** Disable default assignment operator. */
+		const SceneGenerator& operator= ( const SceneGenerator& pre );
+
+	};
+
+} // namespace COLLADABENCHMARK
+
+#endif // __COLLADABENCHMARK_SCENEGENERATOR_H__
@@ -0,0 +1,19 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADABenchmark.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADABENCHMARK_STABLE_HEADERS_H__
+#define __COLLADABENCHMARK_STABLE_HEADERS_H__
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+#endif //__COLLADABENCHMARK_STABLE_HEADERS_H__
@@ -0,0 +1,349 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADABenchmark.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADABenchmarkStableHeaders.h"
+#include "COLLADABenchmarkBenchmark.h"
+#include "COLLADABenchmarkCountingWriter.h"
+
+#include "COLLADASaxFWLLoader.h"
+#include "COLLADASaxFWLLoaderStatistics.h"
+#include "COLLADASaxFWLLoadSession.h"
+
+// error handler and writer of COLLADAValidator
+#include "ValidationErrorHandler.h"
+#include "Writer.h"
+
+#include <stdio.h>
+
+
+namespace COLLADABenchmark
+{
+
+	namespace
+	{
+		/** The number of documents of the sid scaling scenario, each with twice as many channels as its predecessor.*/
+		const size_t SID_SCALING_STEPS = 4;
+
+		/** The factor the load time per channel may grow by from the smallest to the largest document of the
+		sid scaling scenario.*/
+		const double SID_SCALING_TOLERANCE = 2.0;
+
+		double getTime()
+		{
+			return COLLADASaxFWL::LoaderStatistics::getTime();
+		}
+
+		/** Adds the @a time of iteration @a iteration of @a iterations to @a result. @a statistics are the
+		statistics of the loader used in this iteration, if any.*/
+		void addIteration( Benchmark::Result& result, size_t iteration, size_t iterations, double time, const COLLADASaxFWL::LoaderStatistics* statistics )
+		{
+			result.meanTime += time / (double)iterations;
+			if ( iteration == 0 || time < result.minimumTime )
+			{
+				result.minimumTime = time;
+				if ( statistics )
+				{
+					result.parseTime = statistics->getParseTime();
+					result.postProcessingTime = statistics->getPostProcessingTime();
+				}
+			}
+		}
+
+		/** Writes @a result as JSON object to @a stream.*/
+		void writeJsonResult( std::ostream& stream, const Benchmark::Result& result, const char* versionName )
+		{
+			const double megabyte = 1024.0 * 1024.0;
+			double megabytesPerSecond = result.minimumTime > 0 ? (double)result.bytes / megabyte / result.minimumTime : 0;
+			double objectsPerSecond = result.minimumTime > 0 ? (double)result.objects / result.minimumTime : 0;
+
+			stream << "    {"
+				<< " \"name\": \"" << result.name << "\","
+				<< " \"version\": \"" << versionName << "\","
+				<< " \"succeeded\": " << (result.succeeded ? "true" : "false") << ","
+				<< " \"skipped\": " << (result.skipped ? "true" : "false") << ","
+				<< " \"minimumTime\": " << result.minimumTime << ","
+				<< " \"meanTime\": " << result.meanTime << ","
+				<< " \"parseTime\": " << result.parseTime << ","
+				<< " \"postProcessingTime\": " << result.postProcessingTime << ","
+				<< " \"bytes\": " << result.bytes << ","
+				<< " \"objects\": " << result.objects << ","
+				<< " \"megabytesPerSecond\": " << megabytesPerSecond << ","
+				<< " \"objectsPerSecond\": " << objectsPerSecond
+				<< " }";
+		}
+	}
+
+
+	//------------------------------
+	Benchmark::Result::Result()
+		: version( COLLADASW::StreamWriter::COLLADA_1_4_1 )
+		, minimumTime( 0 )
+		, meanTime( 0 )
+		, bytes( 0 )
+		, objects( 0 )
+		, parseTime( 0 )
+		, postProcessingTime( 0 )
+		, succeeded( true )
+		, skipped( false )
+	{
+	}
+
+
+	//------------------------------
+	Benchmark::Benchmark( const SceneParameters& parameters, const VersionList& versions, size_t iterations, const String& directory )
+		: mParameters( parameters )
+		, mVersions( versions )
+		, mIterations( iterations > 0 ? iterations : 1 )
+		, mDirectory( directory )
+		, mKeepDocuments( false )
+		, mSidScalingChannels( 2000 )
+	{
+	}
+
+	//------------------------------
+	Benchmark::~Benchmark()
+	{
+	}
+
+	//------------------------------
+	bool Benchmark::run()
+	{
+		mResults.clear();
+		for ( size_t i = 0, count = mVersions.size(); i < count; ++i )
+			run( mVersions[i] );
+
+		bool succeeded = true;
+		for ( size_t i = 0, count = mResults.size(); i < count; ++i )
+			succeeded = succeeded && mResults[i].succeeded;
+		return succeeded;
+	}
+
+	//------------------------------
+	void Benchmark::run( COLLADASW::StreamWriter::COLLADAVersion version )
+	{
+		SceneParameters parameters = mParameters;
+		parameters.version = version;
+
+		String fileName = mDirectory + "/COLLADABenchmark_" + getVersionName( version ) + ".dae";
+
+		mResults.push_back( measureWrite( parameters, fileName ) );
+		mResults.push_back( measureLoad( parameters, fileName, COLLADAFW::IWriter::ALL_OBJECT_DATA ) );
+		mResults.push_back( measureLoad( parameters, fileName, COLLADAFW::IWriter::NO_OBJECT_DATA ) );
+		mResults.push_back( measureValidate( parameters, fileName ) );
+		mResults.push_back( measureRoundTrip( parameters, fileName ) );
+		measureSidScaling( version );
+
+		if ( !mKeepDocuments )
+			remove( fileName.c_str() );
+	}
+
+	//------------------------------
+	Benchmark::Result Benchmark::measureWrite( const SceneParameters& parameters, const String& fileName ) const
+	{
+		Result result;
+		result.name = "write";
+		result.version = parameters.version;
+		result.objects = parameters.getObjectCounts().getTotal();
+
+		SceneGenerator generator( parameters );
+		for ( size_t i = 0; i < mIterations; ++i )
+		{
+			double startTime = getTime();
+			generator.generate( COLLADABU::NativeString( fileName ) );
+			addIteration( result, i, mIterations, getTime() - startTime, 0 );
+		}
+
+		result.bytes = getFileSize( fileName );
+		result.succeeded = result.bytes > 0;
+		return result;
+	}
+
+	//------------------------------
+	Benchmark::Result Benchmark::measureLoad( const SceneParameters& parameters, const String& fileName, int requiredObjectData ) const
+	{
+		Result result;
+		result.name = requiredObjectData == COLLADAFW::IWriter::NO_OBJECT_DATA ? "parseOnly" : "load";
+		result.version = parameters.version;
+		result.bytes = getFileSize( fileName );
+
+		ObjectCounts expectedObjectCounts = parameters.getObjectCounts();
+		COLLADASaxFWL::Loader loader;
+		loader.setCollectStatistics( true );
+		COLLADASaxFWL::LoadSession session( loader );
+		for ( size_t i = 0; i < mIterations; ++i )
+		{
+			CountingWriter writer( requiredObjectData );
+
+			double startTime = getTime();
+			bool succeeded = session.loadDocument( fileName, &writer );
+			addIteration( result, i, mIterations, getTime() - startTime, &loader.getStatistics() );
+
+			result.objects = writer.getObjectCounts().getTotal();
+			result.succeeded = result.succeeded && succeeded && !writer.getCanceled() && writer.getObjectCounts() == expectedObjectCounts;
+		}
+		return result;
+	}
+
+	//------------------------------
+	Benchmark::Result Benchmark::measureValidate( const SceneParameters& parameters, const String& fileName ) const
+	{
+		Result result;
+		result.name = "validate";
+		result.version = parameters.version;
+		result.bytes = getFileSize( fileName );
+		result.objects = parameters.getObjectCounts().getTotal();
+
+#ifdef GENERATEDSAXPARSER_VALIDATION
+		ValidationErrorHandler errorHandler;
+		COLLADASaxFWL::Loader loader( &errorHandler );
+		loader.setCollectStatistics( true );
+		COLLADASaxFWL::LoadSession session( loader );
+		for ( size_t i = 0; i < mIterations; ++i )
+		{
+			errorHandler.reset();
+			Writer writer;
+
+			double startTime = getTime();
+			session.loadDocument( fileName, &writer );
+			addIteration( result, i, mIterations, getTime() - startTime, &loader.getStatistics() );
+
+			result.succeeded = result.succeeded && !errorHandler.hasHandledSaxParserError() && !errorHandler.hasHandledSaxFWLError();
+		}
+#else
+		result.skipped = true;
+#endif
+		return result;
+	}
+
+	//------------------------------
+	Benchmark::Result Benchmark::measureRoundTrip( const SceneParameters& parameters, const String& fileName ) const
+	{
+		Result result;
+		result.name = "roundTrip";
+		result.version = parameters.version;
+
+		SceneGenerator generator( parameters );
+		ObjectCounts expectedObjectCounts = parameters.getObjectCounts();
+		COLLADASaxFWL::Loader loader;
+		loader.setCollectStatistics( true );
+		COLLADASaxFWL::LoadSession session( loader );
+		for ( size_t i = 0; i < mIterations; ++i )
+		{
+			CountingWriter writer;
+
+			double startTime = getTime();
+			generator.generate( COLLADABU::NativeString( fileName ) );
+			bool succeeded = session.loadDocument( fileName, &writer );
+			addIteration( result, i, mIterations, getTime() - startTime, &loader.getStatistics() );
+
+			result.objects = writer.getObjectCounts().getTotal();
+			result.succeeded = result.succeeded && succeeded && !writer.getCanceled() && writer.getObjectCounts() == expectedObjectCounts;
+		}
+
+		result.bytes = getFileSize( fileName );
+		return result;
+	}
+
+	//------------------------------
+	void Benchmark::measureSidScaling( COLLADASW::StreamWriter::COLLADAVersion version )
+	{
+		if ( mSidScalingChannels == 0 )
+			return;
+
+		String fileName = mDirectory + "/COLLADABenchmark_" + getVersionName( version ) + "_sids.dae";
+
+		SceneParameters parameters;
+		parameters.version = version;
+		parameters.meshCount = 0;
+		parameters.skinCount = 0;
+		parameters.jointCount = 0;
+		parameters.keyCount = 2;
+		parameters.nodeDepth = mParameters.nodeDepth;
+		parameters.sidPaths = true;
+
+		size_t firstResult = mResults.size();
+		for ( size_t step = 0; step < SID_SCALING_STEPS; ++step )
+		{
+			parameters.nodeCount = mSidScalingChannels << step;
+			parameters.animationCount = parameters.nodeCount;
+			SceneGenerator( parameters ).generate( COLLADABU::NativeString( fileName ) );
+
+			Result result = measureLoad( parameters, fileName, COLLADAFW::IWriter::ALL_OBJECT_DATA );
+			result.name = "sidScaling";
+			mResults.push_back( result );
+		}
+
+		const Result& smallest = mResults[firstResult];
+		Result& largest = mResults.back();
+		double smallestTimePerObject = smallest.minimumTime / (double)smallest.objects;
+		double largestTimePerObject = largest.minimumTime / (double)largest.objects;
+		if ( largestTimePerObject > SID_SCALING_TOLERANCE * smallestTimePerObject )
+			largest.succeeded = false;
+
+		if ( !mKeepDocuments )
+			remove( fileName.c_str() );
+	}
+
+	//------------------------------
+	void Benchmark::writeJson( std::ostream& stream ) const
+	{
+		stream << "{" << std::endl;
+		stream << "  \"parameters\": {"
+			<< " \"meshes\": " << mParameters.meshCount << ","
+			<< " \"vertices\": " << mParameters.vertexCount << ","
+			<< " \"nodes\": " << mParameters.nodeCount << ","
+			<< " \"depth\": " << mParameters.nodeDepth << ","
+			<< " \"animations\": " << mParameters.animationCount << ","
+			<< " \"keys\": " << mParameters.keyCount << ","
+			<< " \"skins\": " << mParameters.skinCount << ","
+			<< " \"joints\": " << mParameters.jointCount << ","
+			<< " \"iterations\": " << mIterations << ","
+			<< " \"sidScalingChannels\": " << mSidScalingChannels
+			<< " }," << std::endl;
+
+		stream << "  \"results\": [" << std::endl;
+		for ( size_t i = 0, count = mResults.size(); i < count; ++i )
+		{
+			writeJsonResult( stream, mResults[i], getVersionName( mResults[i].version ) );
+			stream << (i + 1 < count ? "," : "") << std::endl;
+		}
+		stream << "  ]," << std::endl;
+
+		stream << "  \"peakMemoryUsage\": " << COLLADASaxFWL::LoaderStatistics::getProcessPeakMemoryUsage() << std::endl;
+		stream << "}" << std::endl;
+	}
+
+	//------------------------------
+	const char* Benchmark::getVersionName( COLLADASW::StreamWriter::COLLADAVersion version )
+	{
+		switch ( version )
+		{
+		case COLLADASW::StreamWriter::COLLADA_1_4_1:
+			return "1.4.1";
+		case COLLADASW::StreamWriter::COLLADA_1_5_0:
+			return "1.5.0";
+		default:
+			return "";
+		}
+	}
+
+	//------------------------------
+	size_t Benchmark::getFileSize( const String& fileName )
+	{
+		FILE* file = fopen( fileName.c_str(), "rb" );
+		if ( !file )
+			return 0;
+		fseek( file, 0, SEEK_END );
+		long size = ftell( file );
+		fclose( file );
+		return size > 0 ? (size_t)size : 0;
+	}
+
+} // namespace COLLADABenchmark
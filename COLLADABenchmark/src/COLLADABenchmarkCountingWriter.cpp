@@ -0,0 +1,167 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADABenchmark.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADABenchmarkStableHeaders.h"
+#include "COLLADABenchmarkCountingWriter.h"
+
+#include "COLLADAFWNode.h"
+#include "COLLADAFWVisualScene.h"
+#include "COLLADAFWLibraryNodes.h"
+#include "COLLADAFWController.h"
+
+
+namespace COLLADABenchmark
+{
+
+	namespace
+	{
+		/** Returns the number of @a nodes, including all their descendants.*/
+		size_t countNodes( const COLLADAFW::NodePointerArray& nodes )
+		{
+			size_t count = nodes.getCount();
+			for ( size_t i = 0, nodeCount = nodes.getCount(); i < nodeCount; ++i )
+				count += countNodes( nodes[i]->getChildNodes() );
+			return count;
+		}
+	}
+
+	//------------------------------
+	CountingWriter::CountingWriter( int requiredObjectData )
+		: mCanceled( false )
+		, mRequiredObjectData( requiredObjectData )
+	{
+	}
+
+	//------------------------------
+	CountingWriter::~CountingWriter()
+	{
+	}
+
+	//------------------------------
+	void CountingWriter::cancel( const COLLADAFW::String& errorMessage )
+	{
+		mCanceled = true;
+	}
+
+	//------------------------------
+	void CountingWriter::start()
+	{
+		mObjectCounts = ObjectCounts();
+		mCanceled = false;
+	}
+
+	//------------------------------
+	void CountingWriter::finish()
+	{
+	}
+
+	//------------------------------
+	bool CountingWriter::writeGlobalAsset( const COLLADAFW::FileInfo* asset )
+	{
+		return true;
+	}
+
+	//------------------------------
+	bool CountingWriter::writeScene( const COLLADAFW::Scene* scene )
+	{
+		return true;
+	}
+
+	//------------------------------
+	bool CountingWriter::writeVisualScene( const COLLADAFW::VisualScene* visualScene )
+	{
+		mObjectCounts.nodes += countNodes( visualScene->getRootNodes() );
+		return true;
+	}
+
+	//------------------------------
+	bool CountingWriter::writeLibraryNodes( const COLLADAFW::LibraryNodes* libraryNodes )
+	{
+		mObjectCounts.nodes += countNodes( libraryNodes->getNodes() );
+		return true;
+	}
+
+	//------------------------------
+	bool CountingWriter::writeGeometry( const COLLADAFW::Geometry* geometry )
+	{
+		mObjectCounts.geometries++;
+		return true;
+	}
+
+	//------------------------------
+	bool CountingWriter::writeMaterial( const COLLADAFW::Material* material )
+	{
+		return true;
+	}
+
+	//------------------------------
+	bool CountingWriter::writeEffect( const COLLADAFW::Effect* effect )
+	{
+		return true;
+	}
+
+	//------------------------------
+	bool CountingWriter::writeCamera( const COLLADAFW::Camera* camera )
+	{
+		return true;
+	}
+
+	//------------------------------
+	bool CountingWriter::writeImage( const COLLADAFW::Image* image )
+	{
+		return true;
+	}
+
+	//------------------------------
+	bool CountingWriter::writeLight( const COLLADAFW::Light* light )
+	{
+		return true;
+	}
+
+	//------------------------------
+	bool CountingWriter::writeAnimation( const COLLADAFW::Animation* animation )
+	{
+		mObjectCounts.animations++;
+		return true;
+	}
+
+	//------------------------------
+	bool CountingWriter::writeAnimationList( const COLLADAFW::AnimationList* animationList )
+	{
+		return true;
+	}
+
+	//------------------------------
+	bool CountingWriter::writeSkinControllerData( const COLLADAFW::SkinControllerData* skinControllerData )
+	{
+		return true;
+	}
+
+	//------------------------------
+	bool CountingWriter::writeController( const COLLADAFW::Controller* controller )
+	{
+		if ( controller->getControllerType() == COLLADAFW::Controller::CONTROLLER_TYPE_SKIN )
+			mObjectCounts.controllers++;
+		return true;
+	}
+
+	//------------------------------
+	bool CountingWriter::writeFormulas( const COLLADAFW::Formulas* formulas )
+	{
+		return true;
+	}
+
+	//------------------------------
+	bool CountingWriter::writeKinematicsScene( const COLLADAFW::KinematicsScene* kinematicsScene )
+	{
+		return true;
+	}
+
+} // namespace COLLADABenchmark
@@ -0,0 +1,532 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADABenchmark.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADABenchmarkStableHeaders.h"
+#include "COLLADABenchmarkSceneGenerator.h"
+
+#include "COLLADASWAsset.h"
+#include "COLLADASWScene.h"
+#include "COLLADASWSource.h"
+#include "COLLADASWBaseInputElement.h"
+#include "COLLADASWPrimitves.h"
+#include "COLLADASWInputList.h"
+#include "COLLADASWNode.h"
+#include "COLLADASWInstanceGeometry.h"
+#include "COLLADASWInstanceController.h"
+#include "COLLADASWLibraryGeometries.h"
+#include "COLLADASWLibraryControllers.h"
+#include "COLLADASWLibraryAnimations.h"
+#include "COLLADASWLibraryVisualScenes.h"
+
+#include "COLLADABUUtils.h"
+
+#include <math.h>
+
+
+namespace COLLADABenchmark
+{
+
+	namespace
+	{
+		/** The number of vertices in each row of the vertex grid of a mesh.*/
+		const size_t GRID_WIDTH = 64;
+
+		const String VISUAL_SCENE_ID = "visual_scene";
+		const String ROTATE_SID = "rotateZ";
+		const String TRANSLATE_SID = "translate";
+
+		String getMeshId( size_t index ) { return "mesh" + COLLADABU::Utils::toString( index ); }
+		String getNodeId( size_t index ) { return "node" + COLLADABU::Utils::toString( index ); }
+		String getJointId( size_t index ) { return "joint" + COLLADABU::Utils::toString( index ); }
+		String getSkinId( size_t index ) { return "skin" + COLLADABU::Utils::toString( index ); }
+		String getSkinnedNodeId( size_t index ) { return "skinned_node" + COLLADABU::Utils::toString( index ); }
+		String getAnimationId( size_t index ) { return "animation" + COLLADABU::Utils::toString( index ); }
+		String getNodeSid( size_t level ) { return "level" + COLLADABU::Utils::toString( level ); }
+
+		/** Sets @a matrix to a translation by @a x along the x axis.*/
+		void setTranslation( double matrix[4][4], double x )
+		{
+			for ( int row = 0; row < 4; ++row )
+				for ( int column = 0; column < 4; ++column )
+					matrix[row][column] = (row == column) ? 1.0 : 0.0;
+			matrix[0][3] = x;
+		}
+
+
+		/** Writes the meshes. Each mesh is a grid of vertices with positions, normals and texture coordinates
+		and a triangle strip like index list.*/
+		class GeometriesGenerator : public COLLADASW::LibraryGeometries
+		{
+		private:
+			const SceneParameters& mParameters;
+
+		public:
+			GeometriesGenerator( COLLADASW::StreamWriter* streamWriter, const SceneParameters& parameters )
+				: COLLADASW::LibraryGeometries( streamWriter )
+				, mParameters( parameters )
+			{}
+
+			void generate()
+			{
+				if ( mParameters.meshCount == 0 )
+					return;
+				for ( size_t i = 0; i < mParameters.meshCount; ++i )
+					generateMesh( getMeshId( i ) );
+				closeLibrary();
+			}
+
+		private:
+			void generateMesh( const String& meshId )
+			{
+				openMesh( meshId, meshId );
+
+				size_t vertexCount = mParameters.vertexCount;
+
+				COLLADASW::FloatSource positions( mSW );
+				positions.setId( meshId + POSITIONS_SOURCE_ID_SUFFIX );
+				positions.setArrayId( meshId + POSITIONS_SOURCE_ID_SUFFIX + ARRAY_ID_SUFFIX );
+				positions.setAccessorStride( 3 );
+				positions.getParameterNameList().push_back( "X" );
+				positions.getParameterNameList().push_back( "Y" );
+				positions.getParameterNameList().push_back( "Z" );
+				positions.setAccessorCount( (unsigned long)vertexCount );
+				positions.prepareToAppendValues();
+				for ( size_t i = 0; i < vertexCount; ++i )
+					positions.appendValues( (double)(i % GRID_WIDTH), (double)(i / GRID_WIDTH), 0.1 * (double)(i % 7) );
+				positions.finish();
+
+				COLLADASW::FloatSource normals( mSW );
+				normals.setId( meshId + NORMALS_SOURCE_ID_SUFFIX );
+				normals.setArrayId( meshId + NORMALS_SOURCE_ID_SUFFIX + ARRAY_ID_SUFFIX );
+				normals.setAccessorStride( 3 );
+				normals.getParameterNameList().push_back( "X" );
+				normals.getParameterNameList().push_back( "Y" );
+				normals.getParameterNameList().push_back( "Z" );
+				normals.setAccessorCount( (unsigned long)vertexCount );
+				normals.prepareToAppendValues();
+				for ( size_t i = 0; i < vertexCount; ++i )
+				{
+					double angle = 0.01 * (double)i;
+					normals.appendValues( sin( angle ) * 0.1, cos( angle ) * 0.1, 0.99 );
+				}
+				normals.finish();
+
+				String texCoordsId = meshId + TEXCOORDS_SOURCE_ID_SUFFIX;
+				COLLADASW::FloatSource texCoords( mSW );
+				texCoords.setId( texCoordsId );
+				texCoords.setArrayId( texCoordsId + ARRAY_ID_SUFFIX );
+				texCoords.setAccessorStride( 2 );
+				texCoords.getParameterNameList().push_back( "S" );
+				texCoords.getParameterNameList().push_back( "T" );
+				texCoords.setAccessorCount( (unsigned long)vertexCount );
+				texCoords.prepareToAppendValues();
+				for ( size_t i = 0; i < vertexCount; ++i )
+					texCoords.appendValues( (double)(i % GRID_WIDTH) / GRID_WIDTH, (double)(i / GRID_WIDTH) / GRID_WIDTH );
+				texCoords.finish();
+
+				COLLADASW::VerticesElement vertices( mSW );
+				vertices.setId( meshId + VERTICES_ID_SUFFIX );
+				vertices.getInputList().push_back( COLLADASW::Input( COLLADASW::InputSemantic::POSITION, "#" + meshId + POSITIONS_SOURCE_ID_SUFFIX ) );
+				vertices.add();
+
+				size_t triangleCount = vertexCount > 2 ? vertexCount - 2 : 0;
+				COLLADASW::Triangles triangles( mSW );
+				triangles.setCount( (unsigned long)triangleCount );
+				triangles.getInputList().push_back( COLLADASW::Input( COLLADASW::InputSemantic::VERTEX, "#" + meshId + VERTICES_ID_SUFFIX, 0 ) );
+				triangles.getInputList().push_back( COLLADASW::Input( COLLADASW::InputSemantic::NORMAL, "#" + meshId + NORMALS_SOURCE_ID_SUFFIX, 0 ) );
+				triangles.getInputList().push_back( COLLADASW::Input( COLLADASW::InputSemantic::TEXCOORD, "#" + texCoordsId, 0, 0 ) );
+				triangles.prepareToAppendValues();
+				for ( size_t i = 0; i < triangleCount; ++i )
+				{
+					// keep the orientation of neighboring triangles of the strip consistent
+					if ( i % 2 == 0 )
+						triangles.appendValues( (unsigned long)i, (unsigned long)i + 1, (unsigned long)i + 2 );
+					else
+						triangles.appendValues( (unsigned long)i + 1, (unsigned long)i, (unsigned long)i + 2 );
+				}
+				triangles.finish();
+
+				closeMesh();
+				closeGeometry();
+			}
+		};
+
+
+		/** Writes the skin controllers. Each vertex is influenced by two neighboring joints.*/
+		class ControllersGenerator : public COLLADASW::LibraryControllers
+		{
+		private:
+			const SceneParameters& mParameters;
+
+		public:
+			ControllersGenerator( COLLADASW::StreamWriter* streamWriter, const SceneParameters& parameters )
+				: COLLADASW::LibraryControllers( streamWriter )
+				, mParameters( parameters )
+			{}
+
+			void generate()
+			{
+				if ( mParameters.skinCount == 0 || mParameters.meshCount == 0 || mParameters.jointCount == 0 )
+					return;
+				for ( size_t i = 0; i < mParameters.skinCount; ++i )
+					generateSkin( getSkinId( i ), getMeshId( i % mParameters.meshCount ) );
+				closeLibrary();
+			}
+
+		private:
+			void generateSkin( const String& controllerId, const String& meshId )
+			{
+				openSkin( controllerId, "#" + meshId );
+
+				double matrix[4][4];
+				setTranslation( matrix, 0 );
+				addBindShapeTransform( matrix );
+
+				size_t jointCount = mParameters.jointCount;
+
+				String jointsId = controllerId + JOINTS_SOURCE_ID_SUFFIX;
+				COLLADASW::NameSource jointSource( mSW );
+				jointSource.setId( jointsId );
+				jointSource.setArrayId( jointsId + ARRAY_ID_SUFFIX );
+				jointSource.setAccessorStride( 1 );
+				jointSource.getParameterNameList().push_back( "JOINT" );
+				jointSource.setAccessorCount( (unsigned long)jointCount );
+				jointSource.prepareToAppendValues();
+				for ( size_t i = 0; i < jointCount; ++i )
+					jointSource.appendValues( getJointId( i ) );
+				jointSource.finish();
+
+				String inverseBindMatrixId = controllerId + BIND_POSES_SOURCE_ID_SUFFIX;
+				COLLADASW::Float4x4Source inverseBindMatrixSource( mSW );
+				inverseBindMatrixSource.setId( inverseBindMatrixId );
+				inverseBindMatrixSource.setArrayId( inverseBindMatrixId + ARRAY_ID_SUFFIX );
+				inverseBindMatrixSource.setAccessorStride( 16 );
+				inverseBindMatrixSource.getParameterNameList().push_back( "TRANSFORM" );
+				inverseBindMatrixSource.setAccessorCount( (unsigned long)jointCount );
+				inverseBindMatrixSource.prepareToAppendValues();
+				for ( size_t i = 0; i < jointCount; ++i )
+				{
+					setTranslation( matrix, -(double)i );
+					inverseBindMatrixSource.appendValues( matrix );
+				}
+				inverseBindMatrixSource.finish();
+
+				// weight 0 is 1.0 for vertices with one influence, weight 1 is 0.5 for vertices with two
+				String weightsId = controllerId + WEIGHTS_SOURCE_ID_SUFFIX;
+				COLLADASW::FloatSource weightsSource( mSW );
+				weightsSource.setId( weightsId );
+				weightsSource.setArrayId( weightsId + ARRAY_ID_SUFFIX );
+				weightsSource.setAccessorStride( 1 );
+				weightsSource.getParameterNameList().push_back( "WEIGHT" );
+				weightsSource.setAccessorCount( 2 );
+				weightsSource.prepareToAppendValues();
+				weightsSource.appendValues( 1.0, 0.5 );
+				weightsSource.finish();
+
+				COLLADASW::JointsElement joints( mSW );
+				joints.getInputList().push_back( COLLADASW::Input( COLLADASW::InputSemantic::JOINT, "#" + jointsId ) );
+				joints.getInputList().push_back( COLLADASW::Input( COLLADASW::InputSemantic::BINDMATRIX, "#" + inverseBindMatrixId ) );
+				joints.add();
+
+				size_t vertexCount = mParameters.vertexCount;
+				unsigned long influenceCount = jointCount > 1 ? 2 : 1;
+
+				COLLADASW::VertexWeightsElement vertexWeights( mSW );
+				vertexWeights.getInputList().push_back( COLLADASW::Input( COLLADASW::InputSemantic::JOINT, "#" + jointsId, 0 ) );
+				vertexWeights.getInputList().push_back( COLLADASW::Input( COLLADASW::InputSemantic::WEIGHT, "#" + weightsId, 1 ) );
+				vertexWeights.setCount( (unsigned long)vertexCount );
+				vertexWeights.prepareToAppendVCountValues();
+				for ( size_t i = 0; i < vertexCount; ++i )
+					vertexWeights.appendValues( influenceCount );
+				vertexWeights.CloseVCountAndOpenVElement();
+				for ( size_t i = 0; i < vertexCount; ++i )
+				{
+					unsigned long joint = (unsigned long)( (i / GRID_WIDTH) % jointCount );
+					if ( influenceCount == 1 )
+					{
+						vertexWeights.appendValues( joint, 0ul );
+					}
+					else
+					{
+						unsigned long nextJoint = (unsigned long)( (joint + 1) % jointCount );
+						vertexWeights.appendValues( joint, 1ul, nextJoint, 1ul );
+					}
+				}
+				vertexWeights.finish();
+
+				closeSkin();
+				closeController();
+			}
+		};
+
+
+		/** Writes the animations. Each animation has one linear curve that rotates a node around the z axis.*/
+		class AnimationsGenerator : public COLLADASW::LibraryAnimations
+		{
+		private:
+			const SceneParameters& mParameters;
+
+		public:
+			AnimationsGenerator( COLLADASW::StreamWriter* streamWriter, const SceneParameters& parameters )
+				: COLLADASW::LibraryAnimations( streamWriter )
+				, mParameters( parameters )
+			{}
+
+			void generate()
+			{
+				if ( mParameters.animationCount == 0 || mParameters.nodeCount == 0 )
+					return;
+				for ( size_t i = 0; i < mParameters.animationCount; ++i )
+				{
+					generateAnimation( getAnimationId( i ), getTarget( i % mParameters.nodeCount ) );
+					// all sources of a library_animations are searched linearly by the loader
+					if ( mParameters.sidPaths )
+						closeLibrary();
+				}
+				closeLibrary();
+			}
+
+		private:
+			/** Returns the path of the rotation of node @a nodeIndex, relative to the node itself or, if
+			sidPaths is set, to the first node of its chain.*/
+			String getTarget( size_t nodeIndex ) const
+			{
+				if ( !mParameters.sidPaths )
+					return getNodeId( nodeIndex );
+
+				size_t nodeDepth = mParameters.nodeDepth > 0 ? mParameters.nodeDepth : 1;
+				size_t chainStart = nodeIndex - nodeIndex % nodeDepth;
+				String target = getNodeId( chainStart );
+				for ( size_t level = 1; level <= nodeIndex - chainStart; ++level )
+					target += "/" + getNodeSid( level );
+				return target;
+			}
+
+			void generateAnimation( const String& baseId, const String& target )
+			{
+				openAnimation( baseId );
+
+				unsigned long keyCount = (unsigned long)mParameters.keyCount;
+
+				COLLADASW::FloatSource input( mSW );
+				input.setId( baseId + INPUT_SOURCE_ID_SUFFIX );
+				input.setArrayId( baseId + INPUT_SOURCE_ID_SUFFIX + ARRAY_ID_SUFFIX );
+				input.setAccessorStride( 1 );
+				input.getParameterNameList().push_back( "TIME" );
+				input.setAccessorCount( keyCount );
+				input.prepareToAppendValues();
+				for ( unsigned long i = 0; i < keyCount; ++i )
+					input.appendValues( (double)i / 30.0 );
+				input.finish();
+
+				COLLADASW::FloatSource output( mSW );
+				output.setId( baseId + OUTPUT_SOURCE_ID_SUFFIX );
+				output.setArrayId( baseId + OUTPUT_SOURCE_ID_SUFFIX + ARRAY_ID_SUFFIX );
+				output.setAccessorStride( 1 );
+				output.getParameterNameList().push_back( "ANGLE" );
+				output.setAccessorCount( keyCount );
+				output.prepareToAppendValues();
+				for ( unsigned long i = 0; i < keyCount; ++i )
+					output.appendValues( (double)(i % 360) );
+				output.finish();
+
+				COLLADASW::NameSource interpolation( mSW );
+				interpolation.setId( baseId + INTERPOLATION_SOURCE_ID_SUFFIX );
+				interpolation.setArrayId( baseId + INTERPOLATION_SOURCE_ID_SUFFIX + ARRAY_ID_SUFFIX );
+				interpolation.setAccessorStride( 1 );
+				interpolation.getParameterNameList().push_back( "INTERPOLATION" );
+				interpolation.setAccessorCount( keyCount );
+				interpolation.prepareToAppendValues();
+				for ( unsigned long i = 0; i < keyCount; ++i )
+					interpolation.appendValues( LINEAR_NAME );
+				interpolation.finish();
+
+				Sampler sampler( mSW, baseId + SAMPLER_ID_SUFFIX );
+				sampler.addInput( COLLADASW::InputSemantic::INPUT, "#" + baseId + INPUT_SOURCE_ID_SUFFIX );
+				sampler.addInput( COLLADASW::InputSemantic::OUTPUT, "#" + baseId + OUTPUT_SOURCE_ID_SUFFIX );
+				sampler.addInput( COLLADASW::InputSemantic::INTERPOLATION, "#" + baseId + INTERPOLATION_SOURCE_ID_SUFFIX );
+				addSampler( sampler );
+
+				addChannel( "#" + baseId + SAMPLER_ID_SUFFIX, target + "/" + ROTATE_SID + ".ANGLE" );
+
+				closeAnimation();
+			}
+		};
+
+
+		/** Writes the visual scene, i.e. the skeleton, the chains of nodes instantiating the meshes and one node
+		for each skin controller.*/
+		class VisualScenesGenerator : public COLLADASW::LibraryVisualScenes
+		{
+		private:
+			const SceneParameters& mParameters;
+
+		public:
+			VisualScenesGenerator( COLLADASW::StreamWriter* streamWriter, const SceneParameters& parameters )
+				: COLLADASW::LibraryVisualScenes( streamWriter )
+				, mParameters( parameters )
+			{}
+
+			void generate()
+			{
+				openVisualScene( VISUAL_SCENE_ID );
+
+				if ( mParameters.jointCount > 0 )
+					generateJoint( 0 );
+
+				size_t nodeDepth = mParameters.nodeDepth > 0 ? mParameters.nodeDepth : 1;
+				for ( size_t i = 0; i < mParameters.nodeCount; i += nodeDepth )
+					generateNode( i, i, std::min( i + nodeDepth, mParameters.nodeCount ) );
+
+				if ( mParameters.meshCount > 0 && mParameters.jointCount > 0 )
+				{
+					for ( size_t i = 0; i < mParameters.skinCount; ++i )
+						generateSkinnedNode( i );
+				}
+
+				closeVisualScene();
+				closeLibrary();
+			}
+
+		private:
+			/** Writes the joint @a index and, nested in it, all following joints.*/
+			void generateJoint( size_t index )
+			{
+				String jointId = getJointId( index );
+				COLLADASW::Node joint( mSW );
+				joint.setType( COLLADASW::Node::JOINT );
+				joint.setNodeId( jointId );
+				joint.setNodeName( jointId );
+				joint.setNodeSid( jointId );
+				joint.start();
+				joint.addTranslate( TRANSLATE_SID, index == 0 ? 0 : 1, 0, 0 );
+
+				if ( index + 1 < mParameters.jointCount )
+					generateJoint( index + 1 );
+
+				joint.end();
+			}
+
+			/** Writes the node @a index and, nested in it, all following nodes of the chain from @a chainStart
+			up to @a chainEnd.*/
+			void generateNode( size_t index, size_t chainStart, size_t chainEnd )
+			{
+				String nodeId = getNodeId( index );
+				COLLADASW::Node node( mSW );
+				node.setType( COLLADASW::Node::NODE );
+				node.setNodeId( nodeId );
+				node.setNodeName( nodeId );
+				if ( mParameters.sidPaths )
+					node.setNodeSid( getNodeSid( index - chainStart ) );
+				node.start();
+				node.addTranslate( TRANSLATE_SID, 0, 0, 1 );
+				node.addRotateZ( ROTATE_SID, 0 );
+
+				if ( mParameters.meshCount > 0 )
+				{
+					COLLADASW::InstanceGeometry instanceGeometry( mSW );
+					instanceGeometry.setUrl( "#" + getMeshId( index % mParameters.meshCount ) );
+					instanceGeometry.add();
+				}
+
+				if ( index + 1 < chainEnd )
+					generateNode( index + 1, chainStart, chainEnd );
+
+				node.end();
+			}
+
+			void generateSkinnedNode( size_t index )
+			{
+				String nodeId = getSkinnedNodeId( index );
+				COLLADASW::Node node( mSW );
+				node.setType( COLLADASW::Node::NODE );
+				node.setNodeId( nodeId );
+				node.setNodeName( nodeId );
+				node.start();
+
+				COLLADASW::InstanceController instanceController( mSW );
+				instanceController.setUrl( "#" + getSkinId( index ) );
+				instanceController.addSkeleton( "#" + getJointId( 0 ) );
+				instanceController.add();
+
+				node.end();
+			}
+		};
+	}
+
+
+	//------------------------------
+	SceneParameters::SceneParameters()
+		: version( COLLADASW::StreamWriter::COLLADA_1_4_1 )
+		, meshCount( 100 )
+		, vertexCount( 1000 )
+		, nodeCount( 100 )
+		, nodeDepth( 10 )
+		, animationCount( 100 )
+		, keyCount( 100 )
+		, skinCount( 10 )
+		, jointCount( 20 )
+		, sidPaths( false )
+	{
+	}
+
+	//------------------------------
+	ObjectCounts SceneParameters::getObjectCounts() const
+	{
+		bool hasSkins = meshCount > 0 && jointCount > 0;
+		ObjectCounts counts;
+		counts.geometries = meshCount;
+		counts.nodes = nodeCount + jointCount + (hasSkins ? skinCount : 0);
+		counts.animations = nodeCount > 0 ? animationCount : 0;
+		counts.controllers = hasSkins ? skinCount : 0;
+		return counts;
+	}
+
+
+	//------------------------------
+	SceneGenerator::SceneGenerator( const SceneParameters& parameters )
+		: mParameters( parameters )
+	{
+	}
+
+	//------------------------------
+	SceneGenerator::~SceneGenerator()
+	{
+	}
+
+	//------------------------------
+	void SceneGenerator::generate( const COLLADABU::NativeString& fileName ) const
+	{
+		COLLADASW::StreamWriter streamWriter( fileName, false, mParameters.version );
+		streamWriter.startDocument();
+
+		COLLADASW::Asset asset( &streamWriter );
+		asset.getContributor().mAuthoringTool = "COLLADABenchmark";
+		asset.add();
+
+		GeometriesGenerator geometriesGenerator( &streamWriter, mParameters );
+		geometriesGenerator.generate();
+
+		ControllersGenerator controllersGenerator( &streamWriter, mParameters );
+		controllersGenerator.generate();
+
+		AnimationsGenerator animationsGenerator( &streamWriter, mParameters );
+		animationsGenerator.generate();
+
+		VisualScenesGenerator visualScenesGenerator( &streamWriter, mParameters );
+		visualScenesGenerator.generate();
+
+		COLLADASW::Scene scene( &streamWriter, COLLADABU::URI( "#" + VISUAL_SCENE_ID ) );
+		scene.add();
+
+		streamWriter.endDocument();
+	}
+
+} // namespace COLLADABenchmark
@@ -0,0 +1,130 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADABenchmark.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADABenchmarkStableHeaders.h"
+#include "COLLADABenchmarkBenchmark.h"
+
+#include <fstream>
+#include <stdlib.h>
+
+
+void printHelpText()
+{
+	std::cout << "Usage: COLLADABenchmark [options]" << std::endl;
+	std::cout << "Generates synthetic COLLADA documents and measures writing, loading and validating them." << std::endl;
+	std::cout << "  -meshes <count>      Number of meshes (default 100)" << std::endl;
+	std::cout << "  -vertices <count>    Number of vertices of each mesh (default 1000)" << std::endl;
+	std::cout << "  -nodes <count>       Number of nodes instantiating the meshes (default 100)" << std::endl;
+	std::cout << "  -depth <count>       Number of nodes nested in each other (default 10)" << std::endl;
+	std::cout << "  -animations <count>  Number of animation channels (default 100)" << std::endl;
+	std::cout << "  -keys <count>        Number of keys of each animation channel (default 100)" << std::endl;
+	std::cout << "  -skins <count>       Number of skin controllers (default 10)" << std::endl;
+	std::cout << "  -joints <count>      Number of joints of the skeleton (default 20)" << std::endl;
+	std::cout << "  -version <version>   1.4, 1.5 or all (default all)" << std::endl;
+	std::cout << "  -iterations <count>  Number of times each scenario is measured (default 3)" << std::endl;
+	std::cout << "  -sidChannels <count> Number of animation channels of the smallest document of the sid" << std::endl;
+	std::cout << "                       scaling scenario, 0 to skip it (default 2000)" << std::endl;
+	std::cout << "  -directory <path>    Directory the documents are generated in (default .)" << std::endl;
+	std::cout << "  -output <file>       Write the JSON results to file instead of stdout" << std::endl;
+	std::cout << "  -keep                Keep the generated documents" << std::endl;
+}
+
+
+int main(int argc, char* argv[])
+{
+	COLLADABenchmark::SceneParameters parameters;
+	COLLADABenchmark::Benchmark::VersionList versions;
+	size_t iterations = 3;
+	size_t sidScalingChannels = 2000;
+	COLLADABenchmark::String directory = ".";
+	COLLADABenchmark::String outputFile;
+	bool keepDocuments = false;
+	bool allVersions = true;
+
+	for ( int i = 1; i < argc; ++i )
+	{
+		COLLADABenchmark::String option = argv[i];
+		if ( option == "-keep" )
+		{
+			keepDocuments = true;
+			continue;
+		}
+
+		if ( i + 1 >= argc )
+		{
+			printHelpText();
+			return -1;
+		}
+
+		COLLADABenchmark::String value = argv[++i];
+		size_t count = (size_t)strtoul( value.c_str(), 0, 10 );
+
+		if ( option == "-meshes" )
+			parameters.meshCount = count;
+		else if ( option == "-vertices" )
+			parameters.vertexCount = count;
+		else if ( option == "-nodes" )
+			parameters.nodeCount = count;
+		else if ( option == "-depth" )
+			parameters.nodeDepth = count;
+		else if ( option == "-animations" )
+			parameters.animationCount = count;
+		else if ( option == "-keys" )
+			parameters.keyCount = count;
+		else if ( option == "-skins" )
+			parameters.skinCount = count;
+		else if ( option == "-joints" )
+			parameters.jointCount = count;
+		else if ( option == "-iterations" )
+			iterations = count;
+		else if ( option == "-sidChannels" )
+			sidScalingChannels = count;
+		else if ( option == "-directory" )
+			directory = value;
+		else if ( option == "-output" )
+			outputFile = value;
+		else if ( option == "-version" && (value == "1.4" || value == "1.5" || value == "all") )
+		{
+			allVersions = false;
+			if ( value != "1.5" )
+				versions.push_back( COLLADASW::StreamWriter::COLLADA_1_4_1 );
+			if ( value != "1.4" )
+				versions.push_back( COLLADASW::StreamWriter::COLLADA_1_5_0 );
+		}
+		else
+		{
+			printHelpText();
+			return -1;
+		}
+	}
+
+	if ( allVersions )
+	{
+		versions.push_back( COLLADASW::StreamWriter::COLLADA_1_4_1 );
+		versions.push_back( COLLADASW::StreamWriter::COLLADA_1_5_0 );
+	}
+
+	COLLADABenchmark::Benchmark benchmark( parameters, versions, iterations, directory );
+	benchmark.setKeepDocuments( keepDocuments );
+	benchmark.setSidScalingChannels( sidScalingChannels );
+	bool succeeded = benchmark.run();
+
+	if ( outputFile.empty() )
+	{
+		benchmark.writeJson( std::cout );
+	}
+	else
+	{
+		std::ofstream stream( outputFile.c_str() );
+		benchmark.writeJson( stream );
+	}
+
+	return succeeded ? 0 : -1;
+}
@@ -16,6 +16,8 @@
 #include "COLLADAFWAnimatableFloat.h"
 #include "COLLADAFWAnimation.h"
 #include "COLLADAFWAnimationCurve.h"
+#include "COLLADAFWAnimationCurveEvaluator.h"
+#include "COLLADAFWAnimationCurveSimplifier.h"
 #include "COLLADAFWAnimationList.h"
 #include "COLLADAFWAnnotate.h"
 #include "COLLADAFWArray.h"
@@ -26,6 +28,7 @@
 #include "COLLADAFWConstants.h"
 #include "COLLADAFWController.h"
 #include "COLLADAFWEdge.h"
+#include "COLLADAFWEdgeIndexTable.h"
 #include "COLLADAFWEffect.h"
 #include "COLLADAFWEffectCommon.h"
 #include "COLLADAFWException.h"
@@ -61,8 +64,10 @@
 #include "COLLADAFWMaterial.h"
 #include "COLLADAFWMatrix.h"
 #include "COLLADAFWMesh.h"
+#include "COLLADAFWMeshOptimizer.h"
 #include "COLLADAFWMeshPrimitive.h"
 #include "COLLADAFWMeshPrimitiveWithFaceVertexCount.h"
+#include "COLLADAFWMeshTriangulator.h"
 #include "COLLADAFWMeshVertexData.h"
 #include "COLLADAFWMorphController.h"
 #include "COLLADAFWMotionProfile.h"
@@ -82,11 +87,13 @@
 #include "COLLADAFWSkew.h"
 #include "COLLADAFWSkinController.h"
 #include "COLLADAFWSkinControllerData.h"
+#include "COLLADAFWSkinInfluenceConverter.h"
 #include "COLLADAFWSpline.h"
 #include "COLLADAFWTargetableValue.h"
 #include "COLLADAFWTechnique.h"
 #include "COLLADAFWTexture.h"
 #include "COLLADAFWTransformation.h"
+#include "COLLADAFWTransformationCache.h"
 #include "COLLADAFWTranslate.h"
 #include "COLLADAFWTriangles.h"
 #include "COLLADAFWTrifans.h"
@@ -95,6 +102,7 @@
 #include "COLLADAFWUniqueId.h"
 #include "COLLADAFWValidate.h"
 #include "COLLADAFWValueType.h"
+#include "COLLADAFWVertexBufferBuilder.h"
 #include "COLLADAFWVisualScene.h"
 
 
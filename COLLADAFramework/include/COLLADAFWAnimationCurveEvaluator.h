@@ -0,0 +1,155 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADAFW_ANIMATIONCURVEEVALUATOR_H__
+#define __COLLADAFW_ANIMATIONCURVEEVALUATOR_H__
+
+#include "COLLADAFWPrerequisites.h"
+#include "COLLADAFWAnimationCurve.h"
+
+#include <vector>
+
+
+namespace COLLADAFW
+{
+
+	/** Evaluates animation curves at arbitrary input values, usually times.
+	When a curve is added, each segment between two keys is converted into a cubic polynomial per output
+	dimension, v(s) = a + b*s + c*s^2 + d*s^3 with s in [0,1]. The four coefficients are stored in separate
+	arrays (structure of arrays), such that all dimensions of a segment are evaluated by one loop the compiler
+	can vectorize. The curves do not need to be kept after they have been added.
+	Supported interpolations:
+	- LINEAR and STEP
+	- BEZIER, where the in and out tangents are the absolute control points (input, output) of each
+	dimension. The input of a segment is a cubic as well, which is inverted numerically, if the control
+	points are not evenly spaced.
+	- HERMITE, where the tangents are (input, output) vectors that are converted into BEZIER control points.
+	- CARDINAL, as Catmull-Rom spline through the keys.
+	- BSPLINE, as uniform cubic B-spline with the keys as control points.
+	- MIXED, with the interpolation of each segment taken from AnimationCurve::getInterpolationTypes().
+	Segments that require tangents but do not have them are evaluated linearly. Before the first key, the
+	start of the first segment is returned, after the last key the end of the last segment.*/
+	class AnimationCurveEvaluator
+	{
+	private:
+		/** The position of a curve in the evaluator's arrays.*/
+		struct CurveInfo
+		{
+			/** The index of the first key in mKeyInputs.*/
+			size_t mFirstKey;
+
+			/** The number of keys.*/
+			size_t mKeyCount;
+
+			/** The dimension of the output.*/
+			size_t mOutDimension;
+
+			/** The index of the first segment in mNonLinearInputs.*/
+			size_t mFirstSegment;
+
+			/** The index of the coefficients of the first dimension of the first segment.*/
+			size_t mFirstCoefficient;
+
+			/** The index of the first value of the curve, as returned by evaluateAll().*/
+			size_t mFirstValue;
+		};
+		typedef std::vector<CurveInfo> CurveInfoList;
+
+		/** All added curves.*/
+		CurveInfoList mCurves;
+
+		/** The inputs of the keys of all curves.*/
+		std::vector<double> mKeyInputs;
+
+		/** Cubic coefficients of the outputs of all segments. For each segment, one value per dimension.*/
+		std::vector<double> mCoefficientsA;
+		std::vector<double> mCoefficientsB;
+		std::vector<double> mCoefficientsC;
+		std::vector<double> mCoefficientsD;
+
+		/** Cubic coefficients of the inputs of BEZIER segments, laid out as the output coefficients.*/
+		std::vector<double> mInputCoefficientsA;
+		std::vector<double> mInputCoefficientsB;
+		std::vector<double> mInputCoefficientsC;
+		std::vector<double> mInputCoefficientsD;
+
+		/** For each segment, true if its input is not linear in s and has to be inverted.*/
+		std::vector<bool> mNonLinearInputs;
+
+		/** The outputs of all curves after their last key.*/
+		std::vector<double> mEndValues;
+
+		/** The sum of the output dimensions of all curves.*/
+		size_t mValueCount;
+
+		/** If true, evaluateAll() evaluates the curves in parallel, if compiled with OpenMP.*/
+		bool mParallel;
+
+	public:
+		/** Constructor.*/
+		AnimationCurveEvaluator();
+
+		virtual ~AnimationCurveEvaluator();
+
+		/** If true, evaluateAll() evaluates the curves in parallel, if compiled with OpenMP.*/
+		bool getParallel() const { return mParallel; }
+
+		/** If true, evaluateAll() evaluates the curves in parallel, if compiled with OpenMP.*/
+		void setParallel( bool parallel ) { mParallel = parallel; }
+
+		/** Precalculates the segments of @a animationCurve. The input values of the curve must be ascending.
+		@return The index of the curve in the evaluator.*/
+		size_t addAnimationCurve( const AnimationCurve& animationCurve );
+
+		/** Removes all curves.*/
+		void clear();
+
+		/** The number of added curves.*/
+		size_t getCurveCount() const { return mCurves.size(); }
+
+		/** The output dimension of curve @a curve.*/
+		size_t getOutDimension( size_t curve ) const { return mCurves[curve].mOutDimension; }
+
+		/** The sum of the output dimensions of all curves.*/
+		size_t getValueCount() const { return mValueCount; }
+
+		/** The sum of the output dimensions of all curves added before @a curve.*/
+		size_t getFirstValue( size_t curve ) const { return mCurves[curve].mFirstValue; }
+
+		/** Evaluates curve @a curve at @a input and writes getOutDimension() values to @a values.*/
+		void evaluate( size_t curve, double input, double* values ) const;
+
+		/** Evaluates curve @a curve at the @a inputCount values in @a inputs and writes getOutDimension()
+		values per input to @a values. Ascending inputs are found by advancing from the previous segment,
+		others by binary search.*/
+		void evaluate( size_t curve, const double* inputs, size_t inputCount, double* values ) const;
+
+		/** Evaluates all curves at the @a inputCount values in @a inputs. @a values must have space for
+		getValueCount() * @a inputCount values. The values of curve c start at getFirstValue(c) * @a inputCount,
+		with getOutDimension(c) values per input.*/
+		void evaluateAll( const double* inputs, size_t inputCount, double* values ) const;
+
+	private:
+        /** Disable default copy ctor. */
+		AnimationCurveEvaluator( const AnimationCurveEvaluator& pre );
+        /** Disable default assignment operator. */
+		const AnimationCurveEvaluator& operator= ( const AnimationCurveEvaluator& pre );
+
+		/** Returns the segment of @a curve that contains @a input, starting the search at @a segment.*/
+		size_t findSegment( const CurveInfo& curve, double input, size_t segment ) const;
+
+		/** Evaluates @a segment of @a curve at @a input.*/
+		void evaluateSegment( const CurveInfo& curve, size_t segment, double input, double* values ) const;
+
+	};
+
+} // namespace COLLADAFW
+
+#endif // __COLLADAFW_ANIMATIONCURVEEVALUATOR_H__
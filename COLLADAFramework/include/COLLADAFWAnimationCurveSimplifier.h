@@ -0,0 +1,135 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADAFW_ANIMATIONCURVESIMPLIFIER_H__
+#define __COLLADAFW_ANIMATIONCURVESIMPLIFIER_H__
+
+#include "COLLADAFWPrerequisites.h"
+#include "COLLADAFWAnimationCurve.h"
+
+#include <vector>
+
+
+namespace COLLADAFW
+{
+
+	/** Removes redundant keys from animation curves, e.g. from curves that have been sampled every frame.
+	The keys are treated as samples of the animation. Two representations are calculated, and the one that
+	requires fewer values is kept:
+	- A LINEAR curve through a subset of the samples, found by recursive subdivision (Douglas-Peucker).
+	- A BEZIER curve through a subset of the samples, with tangents estimated from the neighbouring samples.
+	Each segment is extended over as many samples as possible.
+	Every sample deviates at most the tolerance from the simplified curve, in each output dimension. The
+	first and the last key are always kept.
+	Curves with other interpolations than LINEAR are sampled at their keys and between them with the
+	AnimationCurveEvaluator and are only replaced, if the simplified curve is smaller. STEP curves only lose
+	keys that do not change the output. MIXED curves with STEP segments are not simplified.*/
+	class AnimationCurveSimplifier
+	{
+	public:
+		/** The default maximum deviation of the simplified curve.*/
+		static const double DEFAULT_TOLERANCE;
+
+		/** The keys of a simplified curve.*/
+		struct Keys
+		{
+			/** The interpolation of all segments, either INTERPOLATION_LINEAR or INTERPOLATION_BEZIER.*/
+			AnimationCurve::InterpolationType mInterpolationType;
+
+			/** The input value of each key.*/
+			std::vector<double> mInputs;
+
+			/** The output dimension values of each key.*/
+			std::vector<double> mOutputs;
+
+			/** For INTERPOLATION_BEZIER, the in tangent control point (input, output) of each output dimension
+			of each key. Empty otherwise.*/
+			std::vector<double> mInTangents;
+
+			/** For INTERPOLATION_BEZIER, the out tangent control point (input, output) of each output dimension
+			of each key. Empty otherwise.*/
+			std::vector<double> mOutTangents;
+		};
+
+		typedef std::vector<AnimationCurve*> AnimationCurveList;
+
+	private:
+		/** The maximum deviation of the simplified curve in each output dimension.*/
+		double mTolerance;
+
+		/** If false, only linear curves are created.*/
+		bool mFitBezier;
+
+		/** If true, multiple curves are simplified in parallel, if compiled with OpenMP.*/
+		bool mParallel;
+
+	public:
+		/** Constructor.*/
+		AnimationCurveSimplifier();
+
+		virtual ~AnimationCurveSimplifier();
+
+		/** The maximum deviation of the simplified curve in each output dimension.*/
+		double getTolerance() const { return mTolerance; }
+
+		/** The maximum deviation of the simplified curve in each output dimension.*/
+		void setTolerance( double tolerance ) { mTolerance = tolerance; }
+
+		/** If false, only linear curves are created.*/
+		bool getFitBezier() const { return mFitBezier; }
+
+		/** If false, only linear curves are created.*/
+		void setFitBezier( bool fitBezier ) { mFitBezier = fitBezier; }
+
+		/** If true, multiple curves are simplified in parallel, if compiled with OpenMP.*/
+		bool getParallel() const { return mParallel; }
+
+		/** If true, multiple curves are simplified in parallel, if compiled with OpenMP.*/
+		void setParallel( bool parallel ) { mParallel = parallel; }
+
+		/** Simplifies @a animationCurve in place.
+		@return True, if keys have been removed.*/
+		bool simplify( AnimationCurve& animationCurve ) const;
+
+		/** Simplifies all curves in @a animationCurves.
+		@return The number of curves that have been simplified.*/
+		size_t simplify( const AnimationCurveList& animationCurves ) const;
+
+		/** Simplifies the linear curve with @a keyCount keys in @a inputs and @a outputs, e.g. samples taken by
+		an exporter, before they are written.
+		@param outputs @a outDimension values per key.
+		@param keys Receives the simplified keys.*/
+		void simplify( const double* inputs, const double* outputs, size_t keyCount, size_t outDimension, Keys& keys ) const;
+
+	private:
+        /** Disable default copy ctor. */
+		AnimationCurveSimplifier( const AnimationCurveSimplifier& pre );
+        /** Disable default assignment operator. */
+		const AnimationCurveSimplifier& operator= ( const AnimationCurveSimplifier& pre );
+
+		/** Adds the indices of the keys of the linear simplification to @a keptKeys, in ascending order.*/
+		void findLinearKeys( const double* inputs, const double* outputs, size_t keyCount, size_t outDimension, std::vector<size_t>& keptKeys ) const;
+
+		/** Adds the indices of the keys of the bezier simplification to @a keptKeys, in ascending order.
+		@param slopes The derivative of each output dimension at each key.*/
+		void findBezierKeys( const double* inputs, const double* outputs, const double* slopes, size_t keyCount, size_t outDimension, std::vector<size_t>& keptKeys ) const;
+
+		/** True, if the hermite segment from key @a first to @a last deviates at most the tolerance from all
+		keys between them.*/
+		bool isHermiteFit( const double* inputs, const double* outputs, const double* slopes, size_t outDimension, size_t first, size_t last ) const;
+
+		/** Removes the keys of the STEP curve @a animationCurve that do not change the output.*/
+		bool simplifyStep( AnimationCurve& animationCurve ) const;
+
+	};
+
+} // namespace COLLADAFW
+
+#endif // __COLLADAFW_ANIMATIONCURVESIMPLIFIER_H__
@@ -30,6 +30,9 @@ namespace COLLADAFW
 	class ArrayPrimitiveType
 	{
 	public:
+		/** The type of the elements.*/
+		typedef Type ValueType;
+
 		/** Flags to control the behavior of the array.*/
 		enum Flags
 		{
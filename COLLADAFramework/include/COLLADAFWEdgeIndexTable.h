@@ -0,0 +1,96 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADAFW_EDGEINDEXTABLE_H__
+#define __COLLADAFW_EDGEINDEXTABLE_H__
+
+#include "COLLADAFWPrerequisites.h"
+#include "COLLADAFWEdge.h"
+
+#include <vector>
+
+
+namespace COLLADAFW
+{
+	class Mesh;
+	class MeshPrimitive;
+
+	/** The unique edges of the surface primitives of a mesh, each with its index, as needed by polygon topology
+	based formats. The edges are numbered in the order they first appear in the faces of the mesh: polygon and
+	hole loops, the triangles of triangle fans and the triangles of triangle strips. Lines and points do not
+	have any edges.
+	The edges are looked up in open addressing hash tables of vertex index pairs. The tables are presized from
+	the number of face corners of the mesh. If built in parallel, the edges are distributed by their hash over one
+	table per thread, so the threads never share a table. The edges and their indices do not depend on the
+	number of threads.*/
+	class EdgeIndexTable
+	{
+	private:
+		/** The unique edges, in the order they first appear in the mesh. Each edge keeps the direction of its
+		first appearance.*/
+		std::vector<Edge> mEdges;
+
+		/** The hash tables, one per partition. They contain edge indices or INVALID_INDEX for empty slots. The
+		size of each table is a power of two.*/
+		std::vector< std::vector<unsigned int> > mTables;
+
+		/** If true, the table is built in parallel, if compiled with OpenMP.*/
+		bool mParallel;
+
+	public:
+		/** Constructor. Builds sequentially.*/
+		EdgeIndexTable();
+
+		virtual ~EdgeIndexTable();
+
+		/** If true, the table is built in parallel, if compiled with OpenMP.*/
+		bool getParallel() const { return mParallel; }
+
+		/** If true, the table is built in parallel, if compiled with OpenMP.*/
+		void setParallel( bool parallel ) { mParallel = parallel; }
+
+		/** Replaces the content of the table by the edges of all primitives of @a mesh.*/
+		void build( const Mesh& mesh );
+
+		/** Removes all edges.*/
+		void clear();
+
+		/** The number of unique edges.*/
+		size_t getEdgeCount() const { return mEdges.size(); }
+
+		/** The edge with index @a edgeIndex.*/
+		const Edge& getEdge( size_t edgeIndex ) const { return mEdges[edgeIndex]; }
+
+		/** The unique edges, in the order of their indices.*/
+		const std::vector<Edge>& getEdges() const { return mEdges; }
+
+		/** Looks up the index of @a edge. The direction of @a edge is ignored.
+		@return True, if @a edge is in the table, false otherwise.*/
+		bool findEdgeIndex( const Edge& edge, size_t& edgeIndex ) const;
+
+		/** Returns the number of edges of @a meshPrimitive including duplicates, i.e. the number of edges
+		appendEdges() appends.*/
+		static size_t getEdgeCount( const MeshPrimitive& meshPrimitive );
+
+		/** Writes the edges of @a meshPrimitive including duplicates to @a edges, in the order they appear in the
+		faces. @a edges must be able to hold getEdgeCount( meshPrimitive ) edges.*/
+		static void appendEdges( const MeshPrimitive& meshPrimitive, Edge* edges );
+
+	private:
+        /** Disable default copy ctor. */
+		EdgeIndexTable( const EdgeIndexTable& pre );
+        /** Disable default assignment operator. */
+		const EdgeIndexTable& operator= ( const EdgeIndexTable& pre );
+
+	};
+
+} // namespace COLLADAFW
+
+#endif // __COLLADAFW_EDGEINDEXTABLE_H__
@@ -38,6 +38,22 @@ namespace COLLADAFW
 	IMPORTANT: The write functions are called in arbitrary order.*/
 	class IWriter 	
 	{
+	public:
+		/** Flags for the bulk data of objects, a writer can declare not to need. See getRequiredObjectData().*/
+		enum ObjectData
+		{
+			NO_OBJECT_DATA             = 0,
+			/** Vertex data and primitive indices of meshes. The face counts of the primitives are still set.*/
+			MESH_DATA                  = 1<< 0,
+			/** Key values, output values and tangents of animation curves.*/
+			ANIMATION_CURVE_DATA       = 1<< 1,
+			/** Weights, influences and inverse bind matrices of skin controller data and the weights of
+			morph controllers.*/
+			CONTROLLER_DATA            = 1<< 2,
+
+			ALL_OBJECT_DATA            = (1<<3) - 1
+		};
+
 	private:
 	
 	public:
@@ -60,6 +76,13 @@ namespace COLLADAFW
 		/** This method is called after the last write* method. No other methods will be called after this.*/
 		virtual void finish()=0;
 
+		/** Returns a combination of ObjectData flags of the data the writer needs. The loader neither stores
+		nor copies data that is not contained. The objects passed to the write methods still have their unique
+		ids, names and references to other objects, but the corresponding arrays are empty and the objects
+		are not validated. Writers that only index documents should return NO_OBJECT_DATA.
+		@return ALL_OBJECT_DATA, unless overridden.*/
+		virtual int getRequiredObjectData() const { return ALL_OBJECT_DATA; }
+
         /** When this method is called, the writer must write the global document asset.
         @return The writer should return true, if writing succeeded, false otherwise.*/
         virtual bool writeGlobalAsset ( const FileInfo* asset ) = 0;
@@ -0,0 +1,166 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADAFW_MESHOPTIMIZER_H__
+#define __COLLADAFW_MESHOPTIMIZER_H__
+
+#include "COLLADAFWPrerequisites.h"
+#include "COLLADAFWVertexBufferBuilder.h"
+
+#include <vector>
+
+
+namespace COLLADAFW
+{
+	class Mesh;
+	class MeshPrimitive;
+
+	/** Reorders the triangles and vertices of meshes for rendering.
+	The triangles are reordered for the post transform vertex cache using Tom Forsyth's linear speed vertex
+	cache optimization. The optimized triangle order is split into clusters where the optimizer had to
+	restart with a triangle without any vertex in the cache. These clusters can be reordered without
+	affecting the cache efficiency. To reduce overdraw, clusters that face away from the center of the mesh
+	are drawn first. Finally the vertices are reordered in the order they are first used by the triangles,
+	which gives sequential vertex fetches.*/
+	class MeshOptimizer
+	{
+	public:
+		/** The optimizations that are performed.*/
+		enum Optimizations
+		{
+			/** Converts all surface primitives that are not triangle lists into triangle lists, using the
+			MeshTriangulator. Only triangle lists can be reordered.*/
+			OPTIMIZATION_TRIANGULATE    = 0x01,
+
+			/** Reorders the triangles of each triangle list for the post transform vertex cache.*/
+			OPTIMIZATION_VERTEX_CACHE   = 0x02,
+
+			/** Reorders clusters of triangles to reduce overdraw. Requires OPTIMIZATION_VERTEX_CACHE.*/
+			OPTIMIZATION_OVERDRAW       = 0x04,
+
+			/** Reorders the vertices in the order they are first used by the triangles. For meshes, this
+			reorders positions, normals, tangents and binormals and changes the position indices. Skin
+			controllers and morph targets that refer to the positions of the mesh have to be remapped using
+			the position remap table returned by optimize().*/
+			OPTIMIZATION_VERTEX_FETCH   = 0x08,
+
+			/** The optimizations that do not change the vertices of a mesh.*/
+			OPTIMIZATION_TRIANGLE_ORDER = OPTIMIZATION_TRIANGULATE | OPTIMIZATION_VERTEX_CACHE | OPTIMIZATION_OVERDRAW,
+
+			OPTIMIZATION_ALL            = 0x0F
+		};
+
+		/** The default number of entries of the simulated vertex cache.*/
+		static const size_t DEFAULT_CACHE_SIZE = 32;
+
+	private:
+		/** Combination of Optimizations that are performed.*/
+		int mOptimizations;
+
+		/** The number of entries of the simulated vertex cache.*/
+		size_t mCacheSize;
+
+		/** If true, the primitives are optimized in parallel, if compiled with OpenMP.*/
+		bool mParallel;
+
+	public:
+		/** Constructor. Performs the OPTIMIZATION_TRIANGLE_ORDER optimizations sequentially.*/
+		MeshOptimizer();
+
+		virtual ~MeshOptimizer();
+
+		/** Combination of Optimizations that are performed.*/
+		int getOptimizations() const { return mOptimizations; }
+
+		/** Combination of Optimizations that are performed.*/
+		void setOptimizations( int optimizations ) { mOptimizations = optimizations; }
+
+		/** The number of entries of the simulated vertex cache.*/
+		size_t getCacheSize() const { return mCacheSize; }
+
+		/** The number of entries of the simulated vertex cache. Must be at least 4.*/
+		void setCacheSize( size_t cacheSize ) { mCacheSize = cacheSize < 4 ? 4 : cacheSize; }
+
+		/** If true, the primitives are optimized in parallel, if compiled with OpenMP.*/
+		bool getParallel() const { return mParallel; }
+
+		/** If true, the primitives are optimized in parallel, if compiled with OpenMP.*/
+		void setParallel( bool parallel ) { mParallel = parallel; }
+
+		/** Optimizes all primitives of @a mesh.
+		@param positionRemap If not null and OPTIMIZATION_VERTEX_FETCH is set, receives the new index of each
+		position of the mesh.*/
+		void optimize( Mesh& mesh, std::vector<unsigned int>* positionRemap = 0 ) const;
+
+		/** Creates an optimized copy of @a mesh and leaves @a mesh unchanged, e.g. for meshes passed to a
+		writer. The copy contains the vertex data of @a mesh and its surface primitives as triangle lists, i.e.
+		they are always triangulated. Lines and points are not copied. The copy has to be deleted using
+		FW_DELETE.
+		@param positionRemap See optimize().*/
+		Mesh* createOptimizedMesh( const Mesh& mesh, std::vector<unsigned int>* positionRemap = 0 ) const;
+
+		/** Optimizes the triangles and vertices of @a subMesh, as created by the VertexBufferBuilder.
+		OPTIMIZATION_TRIANGULATE is ignored.*/
+		void optimize( VertexBufferBuilder::SubMesh& subMesh ) const;
+
+		/** Calculates a vertex cache optimized order of the triangles in @a indices.
+		@param indices Three vertex indices per triangle.
+		@param indexCount The number of indices.
+		@param vertexCount One more than the largest vertex index in @a indices.
+		@param cacheSize The number of entries of the simulated vertex cache.
+		@param triangleOrder Receives the triangle indices in the optimized order.
+		@param clusterStarts If not null, receives the positions in @a triangleOrder where the optimization
+		had to restart without any vertex in the cache.*/
+		static void calculateVertexCacheOrder( const unsigned int* indices,
+											   size_t indexCount,
+											   size_t vertexCount,
+											   size_t cacheSize,
+											   std::vector<unsigned int>& triangleOrder,
+											   std::vector<size_t>* clusterStarts = 0 );
+
+		/** Calculates the average number of vertex cache misses per triangle (ACMR) for @a indices, using a
+		FIFO cache with @a cacheSize entries. 0.5 is the optimum for large regular meshes, 3 the worst case.*/
+		static double calculateAverageCacheMissRatio( const unsigned int* indices, size_t indexCount, size_t vertexCount, size_t cacheSize );
+
+	private:
+        /** Disable default copy ctor. */
+		MeshOptimizer( const MeshOptimizer& pre );
+        /** Disable default assignment operator. */
+		const MeshOptimizer& operator= ( const MeshOptimizer& pre );
+
+		/** Calculates the optimized triangle order of the triangles in @a indices. @a positions returns the
+		position of a vertex, with @a positionOffset and @a positionStride in values, or is null.*/
+		template<class ValueType>
+		void calculateTriangleOrder( const unsigned int* indices,
+									 size_t indexCount,
+									 size_t vertexCount,
+									 const ValueType* positions,
+									 size_t positionCount,
+									 size_t positionOffset,
+									 size_t positionStride,
+									 std::vector<unsigned int>& triangleOrder ) const;
+
+		/** Reorders the triangles of the triangle list @a meshPrimitive.*/
+		void optimizeTriangleOrder( const Mesh& mesh, MeshPrimitive& meshPrimitive ) const;
+
+		/** Performs the optimizations, that reorder the triangle lists and the vertices of @a mesh.*/
+		void reorder( Mesh& mesh, std::vector<unsigned int>* positionRemap ) const;
+
+		/** Converts all surface primitives of @a mesh, that are not triangle lists, into triangle lists.*/
+		void triangulate( Mesh& mesh ) const;
+
+		/** Reorders the positions, normals, tangents and binormals of @a mesh.*/
+		void optimizeVertexFetch( Mesh& mesh, std::vector<unsigned int>* positionRemap ) const;
+
+	};
+
+} // namespace COLLADAFW
+
+#endif // __COLLADAFW_MESHOPTIMIZER_H__
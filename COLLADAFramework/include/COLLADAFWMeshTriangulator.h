@@ -0,0 +1,118 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADAFW_MESHTRIANGULATOR_H__
+#define __COLLADAFW_MESHTRIANGULATOR_H__
+
+#include "COLLADAFWPrerequisites.h"
+
+#include <vector>
+
+
+namespace COLLADAFW
+{
+	class Mesh;
+	class MeshPrimitive;
+	class Triangles;
+
+	/** Converts all mesh primitives that describe surfaces into triangles.
+	The triangles are returned as corners, i.e. as positions within the index lists of the primitive, three
+	per triangle. This way all per corner index lists (positions, normals, tangents, binormals, uv coordinates
+	and colors) of the primitive can be used with the triangles without copying them.
+	Triangles are passed through, triangle fans and triangle strips are unrolled keeping the winding of the
+	strips. Convex polygons are fanned. Concave polygons and polygons with holes are triangulated by ear
+	clipping in the plane of the polygon, after the holes have been bridged into the outer loop. The winding
+	of the triangles is the winding of the outer loop of the polygon. Lines and points do not produce any
+	triangles.*/
+	class MeshTriangulator
+	{
+	public:
+		/** How polygons with more than three vertices are triangulated.*/
+		enum PolygonMode
+		{
+			/** Polygons are fanned, if they are convex. Concave polygons and polygons with holes are
+			triangulated by ear clipping.*/
+			POLYGON_MODE_EAR_CLIPPING,
+
+			/** All polygons are fanned without looking at the positions. Holes are ignored. This is the
+			fastest mode, but produces wrong triangles for concave polygons.*/
+			POLYGON_MODE_FAN
+		};
+
+		/** The triangles of one mesh primitive.*/
+		struct TriangulatedPrimitive
+		{
+			/** The primitive the triangles have been created from.*/
+			const MeshPrimitive* mMeshPrimitive;
+
+			/** Positions within the index lists of mMeshPrimitive, three per triangle.*/
+			std::vector<unsigned int> mCorners;
+		};
+		typedef std::vector<TriangulatedPrimitive> TriangulatedPrimitiveList;
+
+	private:
+		/** How polygons with more than three vertices are triangulated.*/
+		PolygonMode mPolygonMode;
+
+		/** If true, the primitives are triangulated in parallel, if compiled with OpenMP.*/
+		bool mParallel;
+
+	public:
+		/** Constructor. Uses POLYGON_MODE_EAR_CLIPPING and triangulates sequentially.*/
+		MeshTriangulator();
+
+		virtual ~MeshTriangulator();
+
+		/** How polygons with more than three vertices are triangulated.*/
+		PolygonMode getPolygonMode() const { return mPolygonMode; }
+
+		/** How polygons with more than three vertices are triangulated.*/
+		void setPolygonMode( PolygonMode polygonMode ) { mPolygonMode = polygonMode; }
+
+		/** If true, the primitives are triangulated in parallel, if compiled with OpenMP.*/
+		bool getParallel() const { return mParallel; }
+
+		/** If true, the primitives are triangulated in parallel, if compiled with OpenMP.*/
+		void setParallel( bool parallel ) { mParallel = parallel; }
+
+		/** Triangulates all primitives of @a mesh. One TriangulatedPrimitive per mesh primitive is appended to
+		@a triangulatedPrimitives, in the order of the primitives in the mesh. Concatenated, they form one
+		triangle list of the entire mesh.*/
+		void triangulate( const Mesh& mesh, TriangulatedPrimitiveList& triangulatedPrimitives ) const;
+
+		/** Appends the triangles of @a meshPrimitive, which must be a primitive of @a mesh, to @a corners.
+		No memory is reserved in @a corners, to keep the geometric growth of the vector when the triangles of
+		several primitives are appended. Use getMaxTriangleCount() to reserve it up front.
+		@return The number of appended corners.*/
+		size_t triangulate( const Mesh& mesh, const MeshPrimitive& meshPrimitive, std::vector<unsigned int>& corners ) const;
+
+		/** Returns the maximum number of triangles triangulate() creates for @a meshPrimitive. Can be used to
+		reserve the memory of all triangles of a mesh at once.*/
+		static size_t getMaxTriangleCount( const MeshPrimitive& meshPrimitive );
+
+		/** Creates a triangles primitive from @a meshPrimitive and the @a cornerCount corners in @a corners,
+		as returned by triangulate(). All index lists of @a meshPrimitive are copied per corner, the
+		material and the material id are taken over. The caller takes ownership of the returned object.*/
+		static Triangles* createTriangles( const MeshPrimitive& meshPrimitive, const unsigned int* corners, size_t cornerCount );
+
+	private:
+        /** Disable default copy ctor. */
+		MeshTriangulator( const MeshTriangulator& pre );
+        /** Disable default assignment operator. */
+		const MeshTriangulator& operator= ( const MeshTriangulator& pre );
+
+		/** Appends the triangles of the polygons of @a meshPrimitive to @a corners.*/
+		void triangulatePolygons( const Mesh& mesh, const MeshPrimitive& meshPrimitive, std::vector<unsigned int>& corners ) const;
+
+	};
+
+} // namespace COLLADAFW
+
+#endif // __COLLADAFW_MESHTRIANGULATOR_H__
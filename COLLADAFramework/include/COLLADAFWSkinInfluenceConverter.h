@@ -0,0 +1,147 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADAFW_SKININFLUENCECONVERTER_H__
+#define __COLLADAFW_SKININFLUENCECONVERTER_H__
+
+#include "COLLADAFWPrerequisites.h"
+
+
+namespace COLLADAFW
+{
+	class SkinControllerData;
+
+	/** Converts the variable number of joint influences per vertex of a SkinControllerData into a fixed
+	number of influences per vertex, as required for skinning on the GPU or with SIMD instructions.
+	For each vertex, the influences with the largest weights are selected and their weights are
+	renormalized to sum up to one. Vertices with fewer influences are padded with joint index 0 and weight 0.
+	Influences with a negative joint index, i.e. bound to the bind shape, are ignored.
+	The weights are written as floats or quantized to 8 or 16 bit unsigned normalized integers, where the
+	rounding error is added to the largest weight, such that the quantized weights of a vertex sum up to
+	exactly 255 or 65535.
+	The conversion reads the arrays of the SkinControllerData directly and writes into memory provided by
+	the caller, in one of two layouts:
+	- LAYOUT_STRUCTURE_OF_ARRAYS: all vertices' first influence, then all vertices' second influence and so
+	on. Index influence * vertexCount + vertex.
+	- LAYOUT_INTERLEAVED: all influences of the first vertex, then all of the second and so on. Index
+	vertex * influenceCount + influence.*/
+	class SkinInfluenceConverter
+	{
+	public:
+		/** The data type of the converted weights.*/
+		enum WeightFormat
+		{
+			WEIGHT_FORMAT_FLOAT,		//!< float
+			WEIGHT_FORMAT_UNORM16,		//!< unsigned short, 65535 is 1
+			WEIGHT_FORMAT_UNORM8		//!< unsigned char, 255 is 1
+		};
+
+		/** The order of the converted joint indices and weights.*/
+		enum Layout
+		{
+			LAYOUT_STRUCTURE_OF_ARRAYS,
+			LAYOUT_INTERLEAVED
+		};
+
+		/** The maximum number of influences per vertex.*/
+		static const size_t MAX_INFLUENCE_COUNT = 8;
+
+		/** The default number of influences per vertex.*/
+		static const size_t DEFAULT_INFLUENCE_COUNT = 4;
+
+	private:
+		/** The number of influences per vertex.*/
+		size_t mInfluenceCount;
+
+		/** The data type of the converted weights.*/
+		WeightFormat mWeightFormat;
+
+		/** The order of the converted joint indices and weights.*/
+		Layout mLayout;
+
+		/** If true, the weights of each vertex are scaled to sum up to one.*/
+		bool mNormalize;
+
+		/** If true, the vertices are converted in parallel, if compiled with OpenMP.*/
+		bool mParallel;
+
+	public:
+		/** Constructor. Converts to DEFAULT_INFLUENCE_COUNT normalized float influences per vertex in
+		LAYOUT_STRUCTURE_OF_ARRAYS.*/
+		SkinInfluenceConverter();
+
+		virtual ~SkinInfluenceConverter();
+
+		/** The number of influences per vertex.*/
+		size_t getInfluenceCount() const { return mInfluenceCount; }
+
+		/** The number of influences per vertex, between 1 and MAX_INFLUENCE_COUNT.*/
+		void setInfluenceCount( size_t influenceCount );
+
+		/** The data type of the converted weights.*/
+		WeightFormat getWeightFormat() const { return mWeightFormat; }
+
+		/** The data type of the converted weights.*/
+		void setWeightFormat( WeightFormat weightFormat ) { mWeightFormat = weightFormat; }
+
+		/** The order of the converted joint indices and weights.*/
+		Layout getLayout() const { return mLayout; }
+
+		/** The order of the converted joint indices and weights.*/
+		void setLayout( Layout layout ) { mLayout = layout; }
+
+		/** If true, the weights of each vertex are scaled to sum up to one. Quantized weights are always
+		normalized.*/
+		bool getNormalize() const { return mNormalize; }
+
+		/** If true, the weights of each vertex are scaled to sum up to one. Quantized weights are always
+		normalized.*/
+		void setNormalize( bool normalize ) { mNormalize = normalize; }
+
+		/** If true, the vertices are converted in parallel, if compiled with OpenMP.*/
+		bool getParallel() const { return mParallel; }
+
+		/** If true, the vertices are converted in parallel, if compiled with OpenMP.*/
+		void setParallel( bool parallel ) { mParallel = parallel; }
+
+		/** The size in bytes of one converted weight.*/
+		size_t getWeightSize() const;
+
+		/** Converts the influences of @a skinControllerData.
+		@param jointIndices Receives getInfluenceCount() joint indices per vertex.
+		@param weights Receives getInfluenceCount() weights per vertex, each getWeightSize() bytes.
+		@return False, if the controller has more joints than can be stored in an unsigned short.*/
+		bool convert( const SkinControllerData& skinControllerData, unsigned short* jointIndices, void* weights ) const;
+
+		/** The largest number of influences of a single vertex of @a skinControllerData.*/
+		static size_t getMaxInfluenceCount( const SkinControllerData& skinControllerData );
+
+	private:
+        /** Disable default copy ctor. */
+		SkinInfluenceConverter( const SkinInfluenceConverter& pre );
+        /** Disable default assignment operator. */
+		const SkinInfluenceConverter& operator= ( const SkinInfluenceConverter& pre );
+
+		/** Converts the vertices from @a firstVertex to @a lastVertex, whose influences start at @a firstPair.*/
+		template<class WeightType>
+		void convertVertices( const SkinControllerData& skinControllerData,
+							  const WeightType* sourceWeights,
+							  size_t sourceWeightCount,
+							  size_t firstVertex,
+							  size_t lastVertex,
+							  size_t firstPair,
+							  unsigned short* jointIndices,
+							  void* weights ) const;
+
+	};
+
+} // namespace COLLADAFW
+
+#endif // __COLLADAFW_SKININFLUENCECONVERTER_H__
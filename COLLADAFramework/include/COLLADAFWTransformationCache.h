@@ -0,0 +1,163 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADAFW_TRANSFORMATIONCACHE_H__
+#define __COLLADAFW_TRANSFORMATIONCACHE_H__
+
+#include "COLLADAFWPrerequisites.h"
+#include "COLLADAFWUniqueId.h"
+#include "COLLADAFWHashFunctions.h"
+#include "COLLADAFWNode.h"
+
+#include "Math/COLLADABUMathMatrix4.h"
+
+#include <vector>
+
+
+namespace COLLADAFW
+{
+	class VisualScene;
+	class LibraryNodes;
+
+	/** Caches the local and world matrices of all nodes of a visual scene.
+	The nodes are flattened into entries in depth first order, such that each parent precedes its children.
+	A node referenced by instance nodes gets one entry for each place it is instantiated. The matrices of all
+	entries are stored contiguously, 16 doubles per matrix, in the row major layout of
+	COLLADABU::Math::Matrix4. They are calculated once in build(), without Quaternion or temporary Matrix4
+	objects, and can be recalculated with update() after transformations have changed, e.g. by animations.
+	The local matrices are independent of each other and the world matrices of all entries with the same
+	depth as well, which allows to calculate them in parallel.*/
+	class TransformationCache
+	{
+	public:
+		/** Entry index returned, if an entry does not exist.*/
+		static const size_t INVALID_ENTRY;
+
+	private:
+		typedef COLLADABU::hash_map<UniqueId, const Node*> UniqueIdNodeMap;
+		typedef COLLADABU::hash_map<UniqueId, size_t> UniqueIdEntryMap;
+
+		/** Node referenced by an entry and the entry's place in the hierarchy.*/
+		struct Entry
+		{
+			/** The node of the entry.*/
+			const Node* mNode;
+
+			/** The entry of the parent node or INVALID_ENTRY for root nodes.*/
+			size_t mParent;
+
+			/** The next entry of the same node or INVALID_ENTRY.*/
+			size_t mNextOccurrence;
+		};
+		typedef std::vector<Entry> EntryList;
+
+		/** Nodes that can be referenced by instance nodes.*/
+		UniqueIdNodeMap mUniqueIdNodeMap;
+
+		/** All entries, in depth first order.*/
+		EntryList mEntries;
+
+		/** The first entry of each node.*/
+		UniqueIdEntryMap mUniqueIdFirstEntryMap;
+
+		/** The last entry of each node, to append further occurrences.*/
+		UniqueIdEntryMap mUniqueIdLastEntryMap;
+
+		/** The entries of each depth, starting with the root nodes.*/
+		std::vector< std::vector<size_t> > mDepthEntries;
+
+		/** Local matrices of the entries, 16 values each.*/
+		std::vector<double> mLocalMatrices;
+
+		/** World matrices of the entries, 16 values each.*/
+		std::vector<double> mWorldMatrices;
+
+		/** If true, the matrices are calculated in parallel, if compiled with OpenMP.*/
+		bool mParallel;
+
+	public:
+		/** Constructor.*/
+		TransformationCache();
+
+		virtual ~TransformationCache();
+
+		/** If true, the matrices are calculated in parallel, if compiled with OpenMP.*/
+		bool getParallel() const { return mParallel; }
+
+		/** If true, the matrices are calculated in parallel, if compiled with OpenMP.*/
+		void setParallel( bool parallel ) { mParallel = parallel; }
+
+		/** Makes the nodes in @a libraryNodes and all their child nodes available to instance nodes. Must be
+		called before build() for all library nodes, the visual scene might reference.*/
+		void addLibraryNodes( const LibraryNodes& libraryNodes );
+
+		/** Creates the entries for all nodes of @a visualScene and calculates their matrices. The nodes must
+		not be deleted as long as the cache is used.*/
+		void build( const VisualScene& visualScene );
+
+		/** Recalculates all matrices from the current transformations of the nodes.*/
+		void update();
+
+		/** Removes all entries and library nodes.*/
+		void clear();
+
+		/** The number of entries.*/
+		size_t getEntryCount() const { return mEntries.size(); }
+
+		/** The node of entry @a entry.*/
+		const Node* getNode( size_t entry ) const { return mEntries[entry].mNode; }
+
+		/** The entry of the parent of entry @a entry or INVALID_ENTRY, if it is a root node.*/
+		size_t getParent( size_t entry ) const { return mEntries[entry].mParent; }
+
+		/** The first entry of the node with @a nodeUniqueId or INVALID_ENTRY, if the node is not in the
+		visual scene.*/
+		size_t findEntry( const UniqueId& nodeUniqueId ) const;
+
+		/** The next entry of the node of entry @a entry or INVALID_ENTRY, if the node is not instantiated
+		another time.*/
+		size_t getNextOccurrence( size_t entry ) const { return mEntries[entry].mNextOccurrence; }
+
+		/** The local matrix of entry @a entry, 16 values in row major order.*/
+		const double* getLocalMatrix( size_t entry ) const { return &mLocalMatrices[16 * entry]; }
+
+		/** The world matrix of entry @a entry, 16 values in row major order.*/
+		const double* getWorldMatrix( size_t entry ) const { return &mWorldMatrices[16 * entry]; }
+
+		/** Copies the local matrix of entry @a entry to @a localMatrix.*/
+		void getLocalMatrix( size_t entry, COLLADABU::Math::Matrix4& localMatrix ) const;
+
+		/** Copies the world matrix of entry @a entry to @a worldMatrix.*/
+		void getWorldMatrix( size_t entry, COLLADABU::Math::Matrix4& worldMatrix ) const;
+
+		/** Calculates the local matrix of @a node from its transformations into @a matrix, 16 values in row
+		major order. Gives the same result as Node::getTransformationMatrix().*/
+		static void calculateLocalMatrix( const Node& node, double* matrix );
+
+	private:
+        /** Disable default copy ctor. */
+		TransformationCache( const TransformationCache& pre );
+        /** Disable default assignment operator. */
+		const TransformationCache& operator= ( const TransformationCache& pre );
+
+		/** Adds @a node and all its child nodes to mUniqueIdNodeMap.*/
+		void addNodes( const NodePointerArray& nodes );
+
+		/** Appends entries for @a node and its descendants.*/
+		void addEntry( const Node* node, size_t parent, size_t depth );
+
+		/** True, if @a node is the node of @a entry or one of its ancestors.*/
+		bool isOnPath( const Node* node, size_t entry ) const;
+
+	};
+
+} // namespace COLLADAFW
+
+#endif // __COLLADAFW_TRANSFORMATIONCACHE_H__
@@ -0,0 +1,155 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADAFW_VERTEXBUFFERBUILDER_H__
+#define __COLLADAFW_VERTEXBUFFERBUILDER_H__
+
+#include "COLLADAFWPrerequisites.h"
+#include "COLLADAFWTypes.h"
+
+#include <vector>
+
+
+namespace COLLADAFW
+{
+	class Mesh;
+	class MeshPrimitive;
+
+	/** Builds interleaved vertex buffers with a single index per vertex from a mesh.
+	COLLADA primitives index positions, normals, uv coordinates and colors independently. All corners of the
+	triangles of a mesh that reference the same combination of indices are welded into one vertex. The index
+	combinations are looked up in an open addressing hash table that is presized from the number of corners,
+	i.e. it never needs to grow.
+	One SubMesh is created for each material id used in the mesh. It contains the triangles of all primitives
+	with that material id. The primitives are converted to triangles by the MeshTriangulator. Lines and
+	points are ignored. The vertices are stored in the order they are first referenced by the triangles, which
+	gives sequential vertex fetches for the index buffer.*/
+	class VertexBufferBuilder
+	{
+	public:
+		/** The vertex attributes that can be written into the vertex buffers.*/
+		enum VertexAttributes
+		{
+			ATTRIBUTE_POSITION = 0x01,
+			ATTRIBUTE_NORMAL   = 0x02,
+			ATTRIBUTE_TANGENT  = 0x04,
+			ATTRIBUTE_BINORMAL = 0x08,
+			ATTRIBUTE_UV       = 0x10,
+			ATTRIBUTE_COLOR    = 0x20,
+			ATTRIBUTE_ALL      = 0x3F
+		};
+
+		/** Offset of an attribute that is not contained in the vertices of a sub mesh.*/
+		static const int NO_OFFSET = -1;
+
+		/** Description of one uv or color set within the vertices of a sub mesh.*/
+		struct SetLayout
+		{
+			/** Offset in floats of the set within one vertex.*/
+			int mOffset;
+
+			/** The number of floats of the set, i.e. the stride of the source.*/
+			size_t mDimension;
+		};
+		typedef std::vector<SetLayout> SetLayoutList;
+
+		/** Interleaved vertices and triangle indices of all primitives of a mesh with the same material id.*/
+		struct SubMesh
+		{
+			/** The material id of the primitives the sub mesh has been built from.*/
+			MaterialId mMaterialId;
+
+			/** Offsets in floats of the attributes within one vertex. NO_OFFSET if the attribute is not contained.*/
+			int mPositionOffset;
+			int mNormalOffset;
+			int mTangentOffset;
+			int mBinormalOffset;
+
+			/** The layout of the uv sets, in the order of the index lists of the primitives.*/
+			SetLayoutList mUVSets;
+
+			/** The layout of the color sets, in the order of the index lists of the primitives.*/
+			SetLayoutList mColorSets;
+
+			/** The number of floats of one vertex.*/
+			size_t mVertexStride;
+
+			/** The number of welded vertices.*/
+			size_t mVertexCount;
+
+			/** The interleaved vertices, mVertexStride floats per vertex. Attributes a corner does not have, are 0.*/
+			std::vector<float> mVertices;
+
+			/** True, if the indices do not fit into 16 bit and are stored in mIndices32.*/
+			bool mHas32BitIndices;
+
+			/** The triangle indices, three per triangle, if mHas32BitIndices is false.*/
+			std::vector<unsigned short> mIndices16;
+
+			/** The triangle indices, three per triangle, if mHas32BitIndices is true.*/
+			std::vector<unsigned int> mIndices32;
+
+			/** The number of indices, i.e. three times the number of triangles.*/
+			size_t getIndexCount() const { return mHas32BitIndices ? mIndices32.size() : mIndices16.size(); }
+		};
+		typedef std::vector<SubMesh> SubMeshList;
+
+	private:
+		/** Combination of VertexAttributes that are written into the vertex buffers.*/
+		int mAttributes;
+
+		/** If true, the sub meshes are built in parallel, if compiled with OpenMP.*/
+		bool mParallel;
+
+		/** If true, 16 bit indices are used for sub meshes with at most 65536 vertices.*/
+		bool mAllow16BitIndices;
+
+	public:
+		/** Constructor. All attributes are written, sub meshes are built sequentially.*/
+		VertexBufferBuilder();
+
+		virtual ~VertexBufferBuilder();
+
+		/** Combination of VertexAttributes that are written into the vertex buffers.*/
+		int getAttributes() const { return mAttributes; }
+
+		/** Combination of VertexAttributes that are written into the vertex buffers.*/
+		void setAttributes( int attributes ) { mAttributes = attributes; }
+
+		/** If true, the sub meshes are built in parallel, if compiled with OpenMP.*/
+		bool getParallel() const { return mParallel; }
+
+		/** If true, the sub meshes are built in parallel, if compiled with OpenMP.*/
+		void setParallel( bool parallel ) { mParallel = parallel; }
+
+		/** If true, 16 bit indices are used for sub meshes with at most 65536 vertices.*/
+		bool getAllow16BitIndices() const { return mAllow16BitIndices; }
+
+		/** If true, 16 bit indices are used for sub meshes with at most 65536 vertices.*/
+		void setAllow16BitIndices( bool allow16BitIndices ) { mAllow16BitIndices = allow16BitIndices; }
+
+		/** Builds one sub mesh per material id of @a mesh and appends them to @a subMeshes, in the order the
+		material ids first appear in the primitives of @a mesh.*/
+		void build( const Mesh& mesh, SubMeshList& subMeshes ) const;
+
+	private:
+        /** Disable default copy ctor. */
+		VertexBufferBuilder( const VertexBufferBuilder& pre );
+        /** Disable default assignment operator. */
+		const VertexBufferBuilder& operator= ( const VertexBufferBuilder& pre );
+
+		/** Builds @a subMesh from all primitives in @a primitives.*/
+		void buildSubMesh( const Mesh& mesh, const std::vector<const MeshPrimitive*>& primitives, SubMesh& subMesh ) const;
+
+	};
+
+} // namespace COLLADAFW
+
+#endif // __COLLADAFW_VERTEXBUFFERBUILDER_H__
@@ -0,0 +1,443 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWAnimationCurveEvaluator.h"
+
+#include <algorithm>
+#include <math.h>
+
+
+namespace COLLADAFW
+{
+
+	namespace
+	{
+		/** Maximum number of segments the search advances linearly, before it uses binary search.*/
+		const size_t MAX_LINEAR_SEARCH_STEPS = 4;
+
+		/** Maximum number of newton iterations to invert the input of a bezier segment.*/
+		const int MAX_NEWTON_ITERATIONS = 8;
+
+		/** Number of bisection steps, if the newton iterations did not converge.*/
+		const int BISECTION_STEPS = 40;
+
+		/** Returns the value with @a index in @a array or 0, if it does not exist.*/
+		double getValue( const FloatOrDoubleArray& array, size_t index )
+		{
+			if ( array.getType() == FloatOrDoubleArray::DATA_TYPE_FLOAT )
+			{
+				const FloatArray* values = array.getFloatValues();
+				return index < values->getCount() ? (*values)[index] : 0;
+			}
+			else if ( array.getType() == FloatOrDoubleArray::DATA_TYPE_DOUBLE )
+			{
+				const DoubleArray* values = array.getDoubleValues();
+				return index < values->getCount() ? (*values)[index] : 0;
+			}
+			return 0;
+		}
+
+		/** The cubic coefficients of a segment in one dimension.*/
+		struct Cubic
+		{
+			double a;
+			double b;
+			double c;
+			double d;
+		};
+
+		/** Coefficients of the bezier curve with end points @a p0, @a p1 and control points @a c0, @a c1.*/
+		Cubic createBezierCubic( double p0, double c0, double c1, double p1 )
+		{
+			Cubic cubic;
+			cubic.a = p0;
+			cubic.b = 3 * (c0 - p0);
+			cubic.c = 3 * (p0 - 2 * c0 + c1);
+			cubic.d = p1 - p0 + 3 * (c0 - c1);
+			return cubic;
+		}
+
+		/** Coefficients of the hermite curve with end points @a p0, @a p1 and tangents @a m0, @a m1.*/
+		Cubic createHermiteCubic( double p0, double m0, double m1, double p1 )
+		{
+			Cubic cubic;
+			cubic.a = p0;
+			cubic.b = m0;
+			cubic.c = 3 * (p1 - p0) - 2 * m0 - m1;
+			cubic.d = 2 * (p0 - p1) + m0 + m1;
+			return cubic;
+		}
+
+		/** Coefficients of the uniform cubic b-spline segment with control points @a q0 to @a q3.*/
+		Cubic createBSplineCubic( double q0, double q1, double q2, double q3 )
+		{
+			Cubic cubic;
+			cubic.a = (q0 + 4 * q1 + q2) / 6;
+			cubic.b = (q2 - q0) / 2;
+			cubic.c = (q0 - 2 * q1 + q2) / 2;
+			cubic.d = (3 * (q1 - q2) + q3 - q0) / 6;
+			return cubic;
+		}
+
+		/** Coefficients of a segment that is linear from @a p0 to @a p1.*/
+		Cubic createLinearCubic( double p0, double p1 )
+		{
+			Cubic cubic;
+			cubic.a = p0;
+			cubic.b = p1 - p0;
+			cubic.c = 0;
+			cubic.d = 0;
+			return cubic;
+		}
+
+		/** Returns the parameter s in [0,1] at which the cubic a + b*s + c*s^2 + d*s^3 is @a input. The cubic
+		must be ascending. @a s is the start value.*/
+		double invertCubic( double a, double b, double c, double d, double input, double s, double tolerance )
+		{
+			for ( int i = 0; i < MAX_NEWTON_ITERATIONS; ++i )
+			{
+				double error = a + s * (b + s * (c + s * d)) - input;
+				if ( fabs( error ) <= tolerance )
+					return s;
+				double derivative = b + s * (2 * c + 3 * s * d);
+				if ( derivative <= 0 )
+					break;
+				s -= error / derivative;
+				if ( s < 0 )
+					s = 0;
+				else if ( s > 1 )
+					s = 1;
+			}
+
+			double low = 0;
+			double high = 1;
+			s = 0.5;
+			for ( int i = 0; i < BISECTION_STEPS; ++i )
+			{
+				double error = a + s * (b + s * (c + s * d)) - input;
+				if ( fabs( error ) <= tolerance )
+					break;
+				if ( error < 0 )
+					low = s;
+				else
+					high = s;
+				s = 0.5 * (low + high);
+			}
+			return s;
+		}
+	}
+
+	//------------------------------
+	AnimationCurveEvaluator::AnimationCurveEvaluator()
+		: mValueCount( 0 )
+		, mParallel( false )
+	{
+	}
+
+	//------------------------------
+	AnimationCurveEvaluator::~AnimationCurveEvaluator()
+	{
+	}
+
+	//------------------------------
+	size_t AnimationCurveEvaluator::addAnimationCurve( const AnimationCurve& animationCurve )
+	{
+		const FloatOrDoubleArray& inputValues = animationCurve.getInputValues();
+		const FloatOrDoubleArray& outputValues = animationCurve.getOutputValues();
+		const FloatOrDoubleArray& inTangentValues = animationCurve.getInTangentValues();
+		const FloatOrDoubleArray& outTangentValues = animationCurve.getOutTangentValues();
+		const AnimationCurve::InterpolationTypeArray& interpolationTypes = animationCurve.getInterpolationTypes();
+
+		size_t keyCount = animationCurve.getKeyCount();
+		size_t outDimension = animationCurve.getOutDimension();
+		size_t segmentCount = keyCount > 1 ? keyCount - 1 : 0;
+		bool hasTangents = ( inTangentValues.getValuesCount() >= 2 * keyCount * outDimension ) &&
+						   ( outTangentValues.getValuesCount() >= 2 * keyCount * outDimension );
+
+		CurveInfo curveInfo;
+		curveInfo.mFirstKey = mKeyInputs.size();
+		curveInfo.mKeyCount = keyCount;
+		curveInfo.mOutDimension = outDimension;
+		curveInfo.mFirstSegment = mNonLinearInputs.size();
+		curveInfo.mFirstCoefficient = mCoefficientsA.size();
+		curveInfo.mFirstValue = mValueCount;
+		mCurves.push_back( curveInfo );
+		mValueCount += outDimension;
+
+		for ( size_t i = 0; i < keyCount; ++i )
+		{
+			mKeyInputs.push_back( getValue( inputValues, i ) );
+		}
+		const double* keyInputs = &mKeyInputs[curveInfo.mFirstKey];
+
+		size_t coefficientCount = curveInfo.mFirstCoefficient + segmentCount * outDimension;
+		mCoefficientsA.resize( coefficientCount );
+		mCoefficientsB.resize( coefficientCount );
+		mCoefficientsC.resize( coefficientCount );
+		mCoefficientsD.resize( coefficientCount );
+		mInputCoefficientsA.resize( coefficientCount );
+		mInputCoefficientsB.resize( coefficientCount );
+		mInputCoefficientsC.resize( coefficientCount );
+		mInputCoefficientsD.resize( coefficientCount );
+
+		AnimationCurve::InterpolationType lastInterpolationType = AnimationCurve::INTERPOLATION_LINEAR;
+		for ( size_t segment = 0; segment < segmentCount; ++segment )
+		{
+			AnimationCurve::InterpolationType interpolationType = animationCurve.getInterpolationType();
+			if ( interpolationType == AnimationCurve::INTERPOLATION_MIXED )
+			{
+				interpolationType = segment < interpolationTypes.getCount() ? interpolationTypes[segment] : AnimationCurve::INTERPOLATION_LINEAR;
+			}
+			if ( !hasTangents && ( (interpolationType == AnimationCurve::INTERPOLATION_BEZIER) || (interpolationType == AnimationCurve::INTERPOLATION_HERMITE) ) )
+			{
+				interpolationType = AnimationCurve::INTERPOLATION_LINEAR;
+			}
+			lastInterpolationType = interpolationType;
+
+			double input0 = keyInputs[segment];
+			double input1 = keyInputs[segment + 1];
+			double duration = input1 - input0;
+			double tolerance = 1e-9 * fabs( duration );
+
+			bool nonLinearInput = false;
+			for ( size_t dimension = 0; dimension < outDimension; ++dimension )
+			{
+				size_t valueIndex = segment * outDimension + dimension;
+				double p0 = getValue( outputValues, valueIndex );
+				double p1 = getValue( outputValues, valueIndex + outDimension );
+
+				Cubic cubic = createLinearCubic( p0, p1 );
+				Cubic inputCubic = createLinearCubic( input0, input1 );
+
+				switch ( interpolationType )
+				{
+				case AnimationCurve::INTERPOLATION_STEP:
+					cubic = createLinearCubic( p0, p0 );
+					break;
+				case AnimationCurve::INTERPOLATION_BEZIER:
+				case AnimationCurve::INTERPOLATION_HERMITE:
+					{
+						size_t outTangentIndex = 2 * valueIndex;
+						size_t inTangentIndex = 2 * (valueIndex + outDimension);
+						double outTangentX = getValue( outTangentValues, outTangentIndex );
+						double outTangentY = getValue( outTangentValues, outTangentIndex + 1 );
+						double inTangentX = getValue( inTangentValues, inTangentIndex );
+						double inTangentY = getValue( inTangentValues, inTangentIndex + 1 );
+
+						if ( interpolationType == AnimationCurve::INTERPOLATION_HERMITE )
+						{
+							// the tangents are directions, the bezier control points lie a third along them
+							outTangentX = input0 + outTangentX / 3;
+							outTangentY = p0 + outTangentY / 3;
+							inTangentX = input1 - inTangentX / 3;
+							inTangentY = p1 - inTangentY / 3;
+						}
+
+						cubic = createBezierCubic( p0, outTangentY, inTangentY, p1 );
+						inputCubic = createBezierCubic( input0, outTangentX, inTangentX, input1 );
+						if ( (fabs( inputCubic.b - duration ) > tolerance) || (fabs( inputCubic.c ) > tolerance) || (fabs( inputCubic.d ) > tolerance) )
+						{
+							nonLinearInput = true;
+						}
+						break;
+					}
+				case AnimationCurve::INTERPOLATION_CARDINAL:
+					{
+						// Catmull-Rom tangents, scaled from the neighbour keys to the duration of this segment
+						size_t previousKey = segment > 0 ? segment - 1 : segment;
+						size_t nextKey = segment + 2 < keyCount ? segment + 2 : segment + 1;
+						double previous = getValue( outputValues, previousKey * outDimension + dimension );
+						double next = getValue( outputValues, nextKey * outDimension + dimension );
+						double duration0 = keyInputs[segment + 1] - keyInputs[previousKey];
+						double duration1 = keyInputs[nextKey] - keyInputs[segment];
+						double m0 = duration0 > 0 ? (p1 - previous) * duration / duration0 : 0;
+						double m1 = duration1 > 0 ? (next - p0) * duration / duration1 : 0;
+						cubic = createHermiteCubic( p0, m0, m1, p1 );
+						break;
+					}
+				case AnimationCurve::INTERPOLATION_BSPLINE:
+					{
+						size_t previousKey = segment > 0 ? segment - 1 : segment;
+						size_t nextKey = segment + 2 < keyCount ? segment + 2 : segment + 1;
+						double previous = getValue( outputValues, previousKey * outDimension + dimension );
+						double next = getValue( outputValues, nextKey * outDimension + dimension );
+						cubic = createBSplineCubic( previous, p0, p1, next );
+						break;
+					}
+				default:
+					break;
+				}
+
+				size_t coefficientIndex = curveInfo.mFirstCoefficient + valueIndex;
+				mCoefficientsA[coefficientIndex] = cubic.a;
+				mCoefficientsB[coefficientIndex] = cubic.b;
+				mCoefficientsC[coefficientIndex] = cubic.c;
+				mCoefficientsD[coefficientIndex] = cubic.d;
+				mInputCoefficientsA[coefficientIndex] = inputCubic.a;
+				mInputCoefficientsB[coefficientIndex] = inputCubic.b;
+				mInputCoefficientsC[coefficientIndex] = inputCubic.c;
+				mInputCoefficientsD[coefficientIndex] = inputCubic.d;
+			}
+			mNonLinearInputs.push_back( nonLinearInput );
+		}
+
+		for ( size_t dimension = 0; dimension < outDimension; ++dimension )
+		{
+			if ( (segmentCount == 0) || (lastInterpolationType == AnimationCurve::INTERPOLATION_STEP) )
+			{
+				size_t lastKey = keyCount > 0 ? keyCount - 1 : 0;
+				mEndValues.push_back( getValue( outputValues, lastKey * outDimension + dimension ) );
+			}
+			else
+			{
+				size_t coefficientIndex = curveInfo.mFirstCoefficient + (segmentCount - 1) * outDimension + dimension;
+				mEndValues.push_back( mCoefficientsA[coefficientIndex] + mCoefficientsB[coefficientIndex] +
+									  mCoefficientsC[coefficientIndex] + mCoefficientsD[coefficientIndex] );
+			}
+		}
+
+		return mCurves.size() - 1;
+	}
+
+	//------------------------------
+	void AnimationCurveEvaluator::clear()
+	{
+		mCurves.clear();
+		mKeyInputs.clear();
+		mCoefficientsA.clear();
+		mCoefficientsB.clear();
+		mCoefficientsC.clear();
+		mCoefficientsD.clear();
+		mInputCoefficientsA.clear();
+		mInputCoefficientsB.clear();
+		mInputCoefficientsC.clear();
+		mInputCoefficientsD.clear();
+		mNonLinearInputs.clear();
+		mEndValues.clear();
+		mValueCount = 0;
+	}
+
+	//------------------------------
+	size_t AnimationCurveEvaluator::findSegment( const CurveInfo& curve, double input, size_t segment ) const
+	{
+		const double* keyInputs = &mKeyInputs[curve.mFirstKey];
+		size_t lastSegment = curve.mKeyCount - 2;
+
+		if ( keyInputs[segment] <= input )
+		{
+			for ( size_t i = 0; i < MAX_LINEAR_SEARCH_STEPS; ++i )
+			{
+				if ( (segment == lastSegment) || (input < keyInputs[segment + 1]) )
+					return segment;
+				++segment;
+			}
+		}
+
+		size_t key = std::upper_bound( keyInputs, keyInputs + curve.mKeyCount, input ) - keyInputs;
+		if ( key == 0 )
+			return 0;
+		return std::min( key - 1, lastSegment );
+	}
+
+	//------------------------------
+	void AnimationCurveEvaluator::evaluateSegment( const CurveInfo& curve, size_t segment, double input, double* values ) const
+	{
+		size_t outDimension = curve.mOutDimension;
+		size_t firstCoefficient = curve.mFirstCoefficient + segment * outDimension;
+		const double* a = &mCoefficientsA[firstCoefficient];
+		const double* b = &mCoefficientsB[firstCoefficient];
+		const double* c = &mCoefficientsC[firstCoefficient];
+		const double* d = &mCoefficientsD[firstCoefficient];
+
+		double input0 = mKeyInputs[curve.mFirstKey + segment];
+		double duration = mKeyInputs[curve.mFirstKey + segment + 1] - input0;
+		double s = duration > 0 ? (input - input0) / duration : 0;
+		if ( s < 0 )
+			s = 0;
+		else if ( s > 1 )
+			s = 1;
+
+		if ( !mNonLinearInputs[curve.mFirstSegment + segment] )
+		{
+			for ( size_t i = 0; i < outDimension; ++i )
+				values[i] = a[i] + s * (b[i] + s * (c[i] + s * d[i]));
+			return;
+		}
+
+		// each dimension of a bezier segment has its own control point inputs
+		const double* inputA = &mInputCoefficientsA[firstCoefficient];
+		const double* inputB = &mInputCoefficientsB[firstCoefficient];
+		const double* inputC = &mInputCoefficientsC[firstCoefficient];
+		const double* inputD = &mInputCoefficientsD[firstCoefficient];
+		double tolerance = 1e-12 * (fabs( duration ) + fabs( input ));
+		for ( size_t i = 0; i < outDimension; ++i )
+		{
+			double t = invertCubic( inputA[i], inputB[i], inputC[i], inputD[i], input, s, tolerance );
+			values[i] = a[i] + t * (b[i] + t * (c[i] + t * d[i]));
+		}
+	}
+
+	//------------------------------
+	void AnimationCurveEvaluator::evaluate( size_t curve, double input, double* values ) const
+	{
+		evaluate( curve, &input, 1, values );
+	}
+
+	//------------------------------
+	void AnimationCurveEvaluator::evaluate( size_t curve, const double* inputs, size_t inputCount, double* values ) const
+	{
+		const CurveInfo& curveInfo = mCurves[curve];
+		size_t outDimension = curveInfo.mOutDimension;
+		const double* endValues = outDimension > 0 ? &mEndValues[curveInfo.mFirstValue] : 0;
+
+		if ( curveInfo.mKeyCount < 2 )
+		{
+			for ( size_t i = 0; i < inputCount; ++i )
+				std::copy( endValues, endValues + outDimension, values + i * outDimension );
+			return;
+		}
+
+		double firstInput = mKeyInputs[curveInfo.mFirstKey];
+		double lastInput = mKeyInputs[curveInfo.mFirstKey + curveInfo.mKeyCount - 1];
+		size_t segment = 0;
+		for ( size_t i = 0; i < inputCount; ++i )
+		{
+			double input = inputs[i];
+			double* inputValues = values + i * outDimension;
+			if ( input >= lastInput )
+			{
+				std::copy( endValues, endValues + outDimension, inputValues );
+			}
+			else if ( input <= firstInput )
+			{
+				segment = 0;
+				evaluateSegment( curveInfo, 0, firstInput, inputValues );
+			}
+			else
+			{
+				segment = findSegment( curveInfo, input, segment );
+				evaluateSegment( curveInfo, segment, input, inputValues );
+			}
+		}
+	}
+
+	//------------------------------
+	void AnimationCurveEvaluator::evaluateAll( const double* inputs, size_t inputCount, double* values ) const
+	{
+		int curveCount = (int)mCurves.size();
+#pragma omp parallel for schedule(dynamic) if(mParallel)
+		for ( int i = 0; i < curveCount; ++i )
+		{
+			evaluate( (size_t)i, inputs, inputCount, values + mCurves[i].mFirstValue * inputCount );
+		}
+	}
+
+} // namespace COLLADAFW
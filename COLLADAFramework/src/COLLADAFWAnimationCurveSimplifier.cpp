@@ -0,0 +1,414 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWAnimationCurveSimplifier.h"
+#include "COLLADAFWAnimationCurveEvaluator.h"
+
+#include <math.h>
+
+
+namespace COLLADAFW
+{
+
+	const double AnimationCurveSimplifier::DEFAULT_TOLERANCE = 1e-4;
+
+	namespace
+	{
+		/** Number of samples per segment taken from curves that are not linear.*/
+		const size_t SAMPLES_PER_SEGMENT = 4;
+
+		/** Copies the values of @a array to @a values.*/
+		void getValues( const FloatOrDoubleArray& array, std::vector<double>& values )
+		{
+			values.clear();
+			if ( array.getType() == FloatOrDoubleArray::DATA_TYPE_FLOAT )
+			{
+				const FloatArray* floatValues = array.getFloatValues();
+				values.assign( floatValues->getData(), floatValues->getData() + floatValues->getCount() );
+			}
+			else if ( array.getType() == FloatOrDoubleArray::DATA_TYPE_DOUBLE )
+			{
+				const DoubleArray* doubleValues = array.getDoubleValues();
+				values.assign( doubleValues->getData(), doubleValues->getData() + doubleValues->getCount() );
+			}
+		}
+
+		/** Replaces the values of @a array by @a values, stored with @a dataType.*/
+		void setValues( FloatOrDoubleArray& array, const std::vector<double>& values, FloatOrDoubleArray::DataType dataType )
+		{
+			array.clear();
+			if ( dataType == FloatOrDoubleArray::DATA_TYPE_UNKNOWN )
+				dataType = FloatOrDoubleArray::DATA_TYPE_DOUBLE;
+			array.setType( dataType );
+			if ( dataType == FloatOrDoubleArray::DATA_TYPE_FLOAT )
+			{
+				FloatArray* floatValues = array.getFloatValues();
+				floatValues->reallocMemory( values.size() );
+				for ( size_t i = 0, count = values.size(); i < count; ++i )
+					floatValues->append( (float)values[i] );
+			}
+			else
+			{
+				DoubleArray* doubleValues = array.getDoubleValues();
+				doubleValues->reallocMemory( values.size() );
+				for ( size_t i = 0, count = values.size(); i < count; ++i )
+					doubleValues->append( values[i] );
+			}
+		}
+
+		/** Calculates the derivative of each output dimension at each key from the neighbouring keys.*/
+		void calculateSlopes( const double* inputs, const double* outputs, size_t keyCount, size_t outDimension, std::vector<double>& slopes )
+		{
+			slopes.assign( keyCount * outDimension, 0 );
+			if ( keyCount < 2 )
+				return;
+
+			for ( size_t key = 0; key < keyCount; ++key )
+			{
+				size_t previousKey = key > 0 ? key - 1 : key;
+				size_t nextKey = key + 1 < keyCount ? key + 1 : key;
+				double duration = inputs[nextKey] - inputs[previousKey];
+				if ( duration <= 0 )
+					continue;
+				for ( size_t i = 0; i < outDimension; ++i )
+				{
+					slopes[key * outDimension + i] = (outputs[nextKey * outDimension + i] - outputs[previousKey * outDimension + i]) / duration;
+				}
+			}
+		}
+	}
+
+	//------------------------------
+	AnimationCurveSimplifier::AnimationCurveSimplifier()
+		: mTolerance( DEFAULT_TOLERANCE )
+		, mFitBezier( true )
+		, mParallel( false )
+	{
+	}
+
+	//------------------------------
+	AnimationCurveSimplifier::~AnimationCurveSimplifier()
+	{
+	}
+
+	//------------------------------
+	void AnimationCurveSimplifier::findLinearKeys( const double* inputs, const double* outputs, size_t keyCount, size_t outDimension, std::vector<size_t>& keptKeys ) const
+	{
+		std::vector<bool> keep( keyCount, false );
+		keep[0] = true;
+		keep[keyCount - 1] = true;
+
+		// ranges between two kept keys, that still have to be checked
+		std::vector< std::pair<size_t, size_t> > ranges;
+		ranges.push_back( std::make_pair( (size_t)0, keyCount - 1 ) );
+		while ( !ranges.empty() )
+		{
+			size_t first = ranges.back().first;
+			size_t last = ranges.back().second;
+			ranges.pop_back();
+			if ( last - first < 2 )
+				continue;
+
+			double duration = inputs[last] - inputs[first];
+			double maxError = 0;
+			size_t maxErrorKey = first;
+			for ( size_t key = first + 1; key < last; ++key )
+			{
+				double s = duration > 0 ? (inputs[key] - inputs[first]) / duration : 0;
+				for ( size_t i = 0; i < outDimension; ++i )
+				{
+					double start = outputs[first * outDimension + i];
+					double end = outputs[last * outDimension + i];
+					double error = fabs( start + s * (end - start) - outputs[key * outDimension + i] );
+					if ( error > maxError )
+					{
+						maxError = error;
+						maxErrorKey = key;
+					}
+				}
+			}
+
+			if ( maxError > mTolerance )
+			{
+				keep[maxErrorKey] = true;
+				ranges.push_back( std::make_pair( first, maxErrorKey ) );
+				ranges.push_back( std::make_pair( maxErrorKey, last ) );
+			}
+		}
+
+		for ( size_t key = 0; key < keyCount; ++key )
+		{
+			if ( keep[key] )
+				keptKeys.push_back( key );
+		}
+	}
+
+	//------------------------------
+	bool AnimationCurveSimplifier::isHermiteFit( const double* inputs, const double* outputs, const double* slopes, size_t outDimension, size_t first, size_t last ) const
+	{
+		double duration = inputs[last] - inputs[first];
+		if ( duration <= 0 )
+			return last - first < 2;
+
+		for ( size_t i = 0; i < outDimension; ++i )
+		{
+			double p0 = outputs[first * outDimension + i];
+			double p1 = outputs[last * outDimension + i];
+			double m0 = slopes[first * outDimension + i] * duration;
+			double m1 = slopes[last * outDimension + i] * duration;
+			double c = 3 * (p1 - p0) - 2 * m0 - m1;
+			double d = 2 * (p0 - p1) + m0 + m1;
+			for ( size_t key = first + 1; key < last; ++key )
+			{
+				double s = (inputs[key] - inputs[first]) / duration;
+				double value = p0 + s * (m0 + s * (c + s * d));
+				if ( fabs( value - outputs[key * outDimension + i] ) > mTolerance )
+					return false;
+			}
+		}
+		return true;
+	}
+
+	//------------------------------
+	void AnimationCurveSimplifier::findBezierKeys( const double* inputs, const double* outputs, const double* slopes, size_t keyCount, size_t outDimension, std::vector<size_t>& keptKeys ) const
+	{
+		size_t first = 0;
+		keptKeys.push_back( first );
+		while ( first < keyCount - 1 )
+		{
+			// double the segment length as long as it fits, then search the longest fitting segment in between
+			size_t fitting = first + 1;
+			size_t failing = keyCount;
+			for ( size_t length = 2; first + length < keyCount; length *= 2 )
+			{
+				if ( !isHermiteFit( inputs, outputs, slopes, outDimension, first, first + length ) )
+				{
+					failing = first + length;
+					break;
+				}
+				fitting = first + length;
+			}
+			if ( failing == keyCount && fitting != keyCount - 1 )
+			{
+				if ( isHermiteFit( inputs, outputs, slopes, outDimension, first, keyCount - 1 ) )
+					fitting = keyCount - 1;
+				else
+					failing = keyCount - 1;
+			}
+			while ( failing - fitting > 1 )
+			{
+				size_t middle = fitting + (failing - fitting) / 2;
+				if ( isHermiteFit( inputs, outputs, slopes, outDimension, first, middle ) )
+					fitting = middle;
+				else
+					failing = middle;
+			}
+
+			keptKeys.push_back( fitting );
+			first = fitting;
+		}
+	}
+
+	//------------------------------
+	void AnimationCurveSimplifier::simplify( const double* inputs, const double* outputs, size_t keyCount, size_t outDimension, Keys& keys ) const
+	{
+		keys.mInterpolationType = AnimationCurve::INTERPOLATION_LINEAR;
+		keys.mInputs.clear();
+		keys.mOutputs.clear();
+		keys.mInTangents.clear();
+		keys.mOutTangents.clear();
+		if ( keyCount == 0 )
+			return;
+
+		std::vector<size_t> keptKeys;
+		if ( keyCount < 3 )
+		{
+			for ( size_t key = 0; key < keyCount; ++key )
+				keptKeys.push_back( key );
+		}
+		else
+		{
+			findLinearKeys( inputs, outputs, keyCount, outDimension, keptKeys );
+		}
+
+		std::vector<double> slopes;
+		if ( mFitBezier && (keptKeys.size() > 2) )
+		{
+			calculateSlopes( inputs, outputs, keyCount, outDimension, slopes );
+			std::vector<size_t> bezierKeys;
+			findBezierKeys( inputs, outputs, &slopes[0], keyCount, outDimension, bezierKeys );
+
+			// a bezier key stores the tangents in addition, i.e. four more values per output dimension
+			size_t linearValueCount = keptKeys.size() * (1 + outDimension);
+			size_t bezierValueCount = bezierKeys.size() * (1 + 5 * outDimension);
+			if ( bezierValueCount < linearValueCount )
+			{
+				keptKeys.swap( bezierKeys );
+				keys.mInterpolationType = AnimationCurve::INTERPOLATION_BEZIER;
+			}
+		}
+
+		size_t keptKeyCount = keptKeys.size();
+		keys.mInputs.reserve( keptKeyCount );
+		keys.mOutputs.reserve( keptKeyCount * outDimension );
+		for ( size_t i = 0; i < keptKeyCount; ++i )
+		{
+			size_t key = keptKeys[i];
+			keys.mInputs.push_back( inputs[key] );
+			keys.mOutputs.insert( keys.mOutputs.end(), outputs + key * outDimension, outputs + (key + 1) * outDimension );
+		}
+
+		if ( keys.mInterpolationType != AnimationCurve::INTERPOLATION_BEZIER )
+			return;
+
+		keys.mInTangents.reserve( 2 * keptKeyCount * outDimension );
+		keys.mOutTangents.reserve( 2 * keptKeyCount * outDimension );
+		for ( size_t i = 0; i < keptKeyCount; ++i )
+		{
+			size_t key = keptKeys[i];
+			double previousDuration = i > 0 ? inputs[key] - inputs[keptKeys[i - 1]] : 0;
+			double nextDuration = i + 1 < keptKeyCount ? inputs[keptKeys[i + 1]] - inputs[key] : previousDuration;
+			if ( i == 0 )
+				previousDuration = nextDuration;
+
+			// the control points lie a third of the segment duration along the tangent
+			for ( size_t dimension = 0; dimension < outDimension; ++dimension )
+			{
+				double output = outputs[key * outDimension + dimension];
+				double slope = slopes[key * outDimension + dimension];
+				keys.mInTangents.push_back( inputs[key] - previousDuration / 3 );
+				keys.mInTangents.push_back( output - slope * previousDuration / 3 );
+				keys.mOutTangents.push_back( inputs[key] + nextDuration / 3 );
+				keys.mOutTangents.push_back( output + slope * nextDuration / 3 );
+			}
+		}
+	}
+
+	//------------------------------
+	bool AnimationCurveSimplifier::simplifyStep( AnimationCurve& animationCurve ) const
+	{
+		size_t keyCount = animationCurve.getKeyCount();
+		size_t outDimension = animationCurve.getOutDimension();
+		std::vector<double> inputs;
+		std::vector<double> outputs;
+		getValues( animationCurve.getInputValues(), inputs );
+		getValues( animationCurve.getOutputValues(), outputs );
+		if ( (keyCount < 3) || (inputs.size() < keyCount) || (outputs.size() < keyCount * outDimension) )
+			return false;
+
+		std::vector<double> keptInputs;
+		std::vector<double> keptOutputs;
+		size_t lastKeptKey = 0;
+		for ( size_t key = 0; key < keyCount; ++key )
+		{
+			bool changes = (key == 0) || (key == keyCount - 1);
+			for ( size_t i = 0; !changes && (i < outDimension); ++i )
+			{
+				changes = fabs( outputs[key * outDimension + i] - outputs[lastKeptKey * outDimension + i] ) > mTolerance;
+			}
+			if ( !changes )
+				continue;
+
+			keptInputs.push_back( inputs[key] );
+			keptOutputs.insert( keptOutputs.end(), outputs.begin() + key * outDimension, outputs.begin() + (key + 1) * outDimension );
+			lastKeptKey = key;
+		}
+
+		if ( keptInputs.size() == keyCount )
+			return false;
+
+		setValues( animationCurve.getInputValues(), keptInputs, animationCurve.getInputValues().getType() );
+		setValues( animationCurve.getOutputValues(), keptOutputs, animationCurve.getOutputValues().getType() );
+		animationCurve.getInTangentValues().clear();
+		animationCurve.getOutTangentValues().clear();
+		return true;
+	}
+
+	//------------------------------
+	bool AnimationCurveSimplifier::simplify( AnimationCurve& animationCurve ) const
+	{
+		AnimationCurve::InterpolationType interpolationType = animationCurve.getInterpolationType();
+		if ( interpolationType == AnimationCurve::INTERPOLATION_STEP )
+			return simplifyStep( animationCurve );
+
+		const AnimationCurve::InterpolationTypeArray& interpolationTypes = animationCurve.getInterpolationTypes();
+		if ( interpolationType == AnimationCurve::INTERPOLATION_MIXED )
+		{
+			for ( size_t i = 0, count = interpolationTypes.getCount(); i < count; ++i )
+			{
+				if ( interpolationTypes[i] == AnimationCurve::INTERPOLATION_STEP )
+					return false;
+			}
+		}
+
+		size_t keyCount = animationCurve.getKeyCount();
+		size_t outDimension = animationCurve.getOutDimension();
+		if ( (keyCount < 3) || (outDimension == 0) || (animationCurve.getOutputValues().getValuesCount() < keyCount * outDimension) )
+			return false;
+
+		std::vector<double> inputs;
+		std::vector<double> outputs;
+		getValues( animationCurve.getInputValues(), inputs );
+		if ( (interpolationType == AnimationCurve::INTERPOLATION_LINEAR) || (interpolationType == AnimationCurve::INTERPOLATION_UNKNOWN) )
+		{
+			getValues( animationCurve.getOutputValues(), outputs );
+		}
+		else
+		{
+			// sample the curve at its keys and in between
+			std::vector<double> keyInputs;
+			keyInputs.swap( inputs );
+			for ( size_t key = 0; key + 1 < keyCount; ++key )
+			{
+				for ( size_t i = 0; i < SAMPLES_PER_SEGMENT; ++i )
+					inputs.push_back( keyInputs[key] + (keyInputs[key + 1] - keyInputs[key]) * i / SAMPLES_PER_SEGMENT );
+			}
+			inputs.push_back( keyInputs[keyCount - 1] );
+
+			AnimationCurveEvaluator evaluator;
+			evaluator.addAnimationCurve( animationCurve );
+			outputs.resize( inputs.size() * outDimension );
+			evaluator.evaluate( 0, &inputs[0], inputs.size(), &outputs[0] );
+		}
+
+		Keys keys;
+		simplify( &inputs[0], &outputs[0], inputs.size(), outDimension, keys );
+
+		size_t valueCount = keyCount * (1 + outDimension) + animationCurve.getInTangentValues().getValuesCount() + animationCurve.getOutTangentValues().getValuesCount();
+		size_t simplifiedValueCount = keys.mInputs.size() + keys.mOutputs.size() + keys.mInTangents.size() + keys.mOutTangents.size();
+		if ( simplifiedValueCount >= valueCount )
+			return false;
+
+		FloatOrDoubleArray::DataType outputDataType = animationCurve.getOutputValues().getType();
+		setValues( animationCurve.getInputValues(), keys.mInputs, animationCurve.getInputValues().getType() );
+		setValues( animationCurve.getOutputValues(), keys.mOutputs, outputDataType );
+		setValues( animationCurve.getInTangentValues(), keys.mInTangents, outputDataType );
+		setValues( animationCurve.getOutTangentValues(), keys.mOutTangents, outputDataType );
+		animationCurve.setInterpolationType( keys.mInterpolationType );
+		animationCurve.getInterpolationTypes().clear();
+		return true;
+	}
+
+	//------------------------------
+	size_t AnimationCurveSimplifier::simplify( const AnimationCurveList& animationCurves ) const
+	{
+		int curveCount = (int)animationCurves.size();
+		int simplifiedCount = 0;
+#pragma omp parallel for schedule(dynamic) reduction(+:simplifiedCount) if(mParallel)
+		for ( int i = 0; i < curveCount; ++i )
+		{
+			if ( simplify( *animationCurves[i] ) )
+				++simplifiedCount;
+		}
+		return (size_t)simplifiedCount;
+	}
+
+} // namespace COLLADAFW
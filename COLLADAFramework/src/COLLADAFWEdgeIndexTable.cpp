@@ -0,0 +1,360 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWEdgeIndexTable.h"
+
+#include "COLLADAFWMesh.h"
+#include "COLLADAFWMeshPrimitive.h"
+#include "COLLADAFWPolygons.h"
+#include "COLLADAFWTrifans.h"
+#include "COLLADAFWTristrips.h"
+
+#ifdef _OPENMP
+#	include <omp.h>
+#endif
+
+
+namespace COLLADAFW
+{
+
+	namespace
+	{
+		/** Marks empty slots in the hash tables.*/
+		const unsigned int INVALID_INDEX = 0xFFFFFFFF;
+
+		/** Hash of the vertex indices of @a edge. The low bits select the slot, the high bits the partition.*/
+		inline unsigned int hashEdge( const Edge& edge )
+		{
+			unsigned int h = edge[0] * 0x9E3779B1u;
+			h ^= edge[1] + 0x7F4A7C15u + (h << 6) + (h >> 2);
+			h ^= h >> 16;
+			h *= 0x85EBCA6Bu;
+			h ^= h >> 13;
+			h *= 0xC2B2AE35u;
+			h ^= h >> 16;
+			return h;
+		}
+
+		/** The partition of @a hash, if the edges are distributed over @a partitionCount tables.*/
+		inline size_t getPartition( unsigned int hash, size_t partitionCount )
+		{
+			return (size_t)(((unsigned long long)hash * partitionCount) >> 32);
+		}
+
+		/** The size of a table for @a count entries, keeping the load factor below 0.5.*/
+		size_t getTableSize( size_t count )
+		{
+			size_t tableSize = 16;
+			while ( tableSize < 2 * count )
+			{
+				tableSize <<= 1;
+			}
+			return tableSize;
+		}
+
+		/** Doubles the size of @a table, which contains positions within the edges with the hashes @a hashes.*/
+		void growTable( std::vector<unsigned int>& table, const std::vector<unsigned int>& hashes )
+		{
+			std::vector<unsigned int> grownTable( 2 * table.size(), INVALID_INDEX );
+			size_t mask = grownTable.size() - 1;
+			for ( size_t i = 0, count = table.size(); i < count; ++i )
+			{
+				unsigned int position = table[i];
+				if ( position == INVALID_INDEX )
+					continue;
+				size_t slot = hashes[position] & mask;
+				while ( grownTable[slot] != INVALID_INDEX )
+				{
+					slot = (slot + 1) & mask;
+				}
+				grownTable[slot] = position;
+			}
+			table.swap( grownTable );
+		}
+
+		/** Inserts all edges of @a edges, that belong to @a partition, into @a table. The table contains the
+		position of the first appearance of each edge afterwards, which is flagged in @a isFirst.*/
+		void fillTable(
+			std::vector<unsigned int>& table,
+			size_t partition,
+			size_t partitionCount,
+			const std::vector<Edge>& edges,
+			const std::vector<unsigned int>& hashes,
+			std::vector<unsigned char>& isFirst )
+		{
+			size_t edgeCount = edges.size();
+			table.assign( getTableSize( edgeCount / partitionCount ), INVALID_INDEX );
+			size_t mask = table.size() - 1;
+			size_t usedCount = 0;
+
+			for ( size_t i = 0; i < edgeCount; ++i )
+			{
+				unsigned int hash = hashes[i];
+				if ( getPartition( hash, partitionCount ) != partition )
+					continue;
+
+				size_t slot = hash & mask;
+				for ( ;; )
+				{
+					unsigned int position = table[slot];
+					if ( position == INVALID_INDEX )
+					{
+						table[slot] = (unsigned int)i;
+						isFirst[i] = 1;
+						++usedCount;
+						break;
+					}
+					if ( edges[position] == edges[i] )
+						break;
+					slot = (slot + 1) & mask;
+				}
+
+				// only possible with more than one partition, if the edges are not evenly distributed
+				if ( 2 * usedCount > table.size() )
+				{
+					growTable( table, hashes );
+					mask = table.size() - 1;
+				}
+			}
+		}
+
+		/** Writes the edges of the triangles of the triangle fans or strips of @a meshPrimitive to @a edges.*/
+		template<class VertexCountArray>
+		void appendTriangleEdges( const MeshPrimitive& meshPrimitive, const VertexCountArray& vertexCounts, bool isFan, Edge* edges )
+		{
+			const UIntValuesArray& positionIndices = meshPrimitive.getPositionIndices();
+			size_t first = 0;
+			for ( size_t i = 0, count = vertexCounts.getCount(); i < count; ++i )
+			{
+				size_t vertexCount = (size_t)vertexCounts[i];
+				for ( size_t j = 0; j + 2 < vertexCount; ++j )
+				{
+					// fans share their first vertex, strips the previous two vertices
+					unsigned int a = positionIndices[isFan ? first : first + j];
+					unsigned int b = positionIndices[first + j + 1];
+					unsigned int c = positionIndices[first + j + 2];
+					(edges++)->setVertexIndices( a, b );
+					(edges++)->setVertexIndices( b, c );
+					(edges++)->setVertexIndices( c, a );
+				}
+				first += vertexCount;
+			}
+		}
+
+		/** The number of edges of the triangles of the triangle fans or strips with @a vertexCounts vertices.*/
+		template<class VertexCountArray>
+		size_t getTriangleEdgeCount( const VertexCountArray& vertexCounts )
+		{
+			size_t edgeCount = 0;
+			for ( size_t i = 0, count = vertexCounts.getCount(); i < count; ++i )
+			{
+				if ( vertexCounts[i] > 2 )
+					edgeCount += 3 * ((size_t)vertexCounts[i] - 2);
+			}
+			return edgeCount;
+		}
+	}
+
+	//------------------------------
+	EdgeIndexTable::EdgeIndexTable()
+		: mParallel( false )
+	{
+	}
+
+	//------------------------------
+	EdgeIndexTable::~EdgeIndexTable()
+	{
+	}
+
+	//------------------------------
+	void EdgeIndexTable::clear()
+	{
+		mEdges.clear();
+		mTables.clear();
+	}
+
+	//------------------------------
+	void EdgeIndexTable::build( const Mesh& mesh )
+	{
+		clear();
+
+		// all edges of all faces including duplicates, the edges of each primitive starting at its offset
+		const MeshPrimitiveArray& meshPrimitives = mesh.getMeshPrimitives();
+		size_t primitiveCount = meshPrimitives.getCount();
+		std::vector<size_t> offsets( primitiveCount + 1, 0 );
+		for ( size_t i = 0; i < primitiveCount; ++i )
+		{
+			offsets[i + 1] = offsets[i] + getEdgeCount( *meshPrimitives[i] );
+		}
+		size_t edgeCount = offsets[primitiveCount];
+		if ( edgeCount == 0 )
+			return;
+		COLLADABU_ASSERT( edgeCount < INVALID_INDEX );
+
+		std::vector<Edge> edges( edgeCount );
+		int count = (int)primitiveCount;
+#pragma omp parallel for schedule(dynamic) if(mParallel)
+		for ( int i = 0; i < count; ++i )
+		{
+			if ( offsets[i + 1] > offsets[i] )
+				appendEdges( *meshPrimitives[i], &edges[offsets[i]] );
+		}
+
+		std::vector<unsigned int> hashes( edgeCount );
+		int hashCount = (int)edgeCount;
+#pragma omp parallel for schedule(static) if(mParallel)
+		for ( int i = 0; i < hashCount; ++i )
+		{
+			hashes[i] = hashEdge( edges[i] );
+		}
+
+		// each partition scans all edges in their order and keeps the first appearance of its edges
+		size_t partitionCount = 1;
+#ifdef _OPENMP
+		if ( mParallel )
+			partitionCount = (size_t)omp_get_max_threads();
+#endif
+		mTables.resize( partitionCount );
+		std::vector<unsigned char> isFirst( edgeCount, 0 );
+		int partitions = (int)partitionCount;
+#pragma omp parallel for schedule(static, 1) if(mParallel)
+		for ( int i = 0; i < partitions; ++i )
+		{
+			fillTable( mTables[i], (size_t)i, partitionCount, edges, hashes, isFirst );
+		}
+
+		// number the first appearances in the order of the faces. The hashes are not needed anymore and store
+		// the edge index of each first appearance.
+		size_t uniqueCount = 0;
+		for ( size_t i = 0; i < edgeCount; ++i )
+		{
+			uniqueCount += isFirst[i];
+		}
+		mEdges.reserve( uniqueCount );
+		for ( size_t i = 0; i < edgeCount; ++i )
+		{
+			if ( isFirst[i] )
+			{
+				hashes[i] = (unsigned int)mEdges.size();
+				mEdges.push_back( edges[i] );
+			}
+		}
+
+#pragma omp parallel for schedule(static, 1) if(mParallel)
+		for ( int i = 0; i < partitions; ++i )
+		{
+			std::vector<unsigned int>& table = mTables[i];
+			for ( size_t slot = 0, tableSize = table.size(); slot < tableSize; ++slot )
+			{
+				if ( table[slot] != INVALID_INDEX )
+					table[slot] = hashes[table[slot]];
+			}
+		}
+	}
+
+	//------------------------------
+	bool EdgeIndexTable::findEdgeIndex( const Edge& edge, size_t& edgeIndex ) const
+	{
+		if ( mTables.empty() )
+			return false;
+
+		unsigned int hash = hashEdge( edge );
+		const std::vector<unsigned int>& table = mTables[getPartition( hash, mTables.size() )];
+		size_t mask = table.size() - 1;
+		for ( size_t slot = hash & mask; ; slot = (slot + 1) & mask )
+		{
+			unsigned int index = table[slot];
+			if ( index == INVALID_INDEX )
+				return false;
+			if ( mEdges[index] == edge )
+			{
+				edgeIndex = index;
+				return true;
+			}
+		}
+	}
+
+	//------------------------------
+	size_t EdgeIndexTable::getEdgeCount( const MeshPrimitive& meshPrimitive )
+	{
+		switch ( meshPrimitive.getPrimitiveType() )
+		{
+		case MeshPrimitive::TRIANGLES:
+			return 3 * meshPrimitive.getFaceCount();
+		case MeshPrimitive::POLYGONS:
+		case MeshPrimitive::POLYLIST:
+			{
+				// holes have negative vertex counts
+				const Polygons::VertexCountArray& vertexCounts = ((const Polygons&)meshPrimitive).getGroupedVerticesVertexCountArray();
+				size_t edgeCount = 0;
+				for ( size_t i = 0, count = vertexCounts.getCount(); i < count; ++i )
+				{
+					int vertexCount = vertexCounts[i];
+					edgeCount += (size_t)(vertexCount < 0 ? -vertexCount : vertexCount);
+				}
+				return edgeCount;
+			}
+		case MeshPrimitive::TRIANGLE_FANS:
+			return getTriangleEdgeCount( ((const Trifans&)meshPrimitive).getGroupedVerticesVertexCountArray() );
+		case MeshPrimitive::TRIANGLE_STRIPS:
+			return getTriangleEdgeCount( ((const Tristrips&)meshPrimitive).getGroupedVerticesVertexCountArray() );
+		default:
+			return 0;
+		}
+	}
+
+	//------------------------------
+	void EdgeIndexTable::appendEdges( const MeshPrimitive& meshPrimitive, Edge* edges )
+	{
+		const UIntValuesArray& positionIndices = meshPrimitive.getPositionIndices();
+		switch ( meshPrimitive.getPrimitiveType() )
+		{
+		case MeshPrimitive::TRIANGLES:
+			{
+				for ( size_t i = 0, count = 3 * meshPrimitive.getFaceCount(); i < count; i += 3 )
+				{
+					(edges++)->setVertexIndices( positionIndices[i], positionIndices[i + 1] );
+					(edges++)->setVertexIndices( positionIndices[i + 1], positionIndices[i + 2] );
+					(edges++)->setVertexIndices( positionIndices[i + 2], positionIndices[i] );
+				}
+			}
+			break;
+		case MeshPrimitive::POLYGONS:
+		case MeshPrimitive::POLYLIST:
+			{
+				// each polygon and each hole is a closed loop
+				const Polygons::VertexCountArray& vertexCounts = ((const Polygons&)meshPrimitive).getGroupedVerticesVertexCountArray();
+				size_t first = 0;
+				for ( size_t i = 0, count = vertexCounts.getCount(); i < count; ++i )
+				{
+					int vertexCount = vertexCounts[i];
+					size_t loopLength = (size_t)(vertexCount < 0 ? -vertexCount : vertexCount);
+					for ( size_t j = 0; j < loopLength; ++j )
+					{
+						size_t next = (j + 1 < loopLength) ? j + 1 : 0;
+						(edges++)->setVertexIndices( positionIndices[first + j], positionIndices[first + next] );
+					}
+					first += loopLength;
+				}
+			}
+			break;
+		case MeshPrimitive::TRIANGLE_FANS:
+			appendTriangleEdges( meshPrimitive, ((const Trifans&)meshPrimitive).getGroupedVerticesVertexCountArray(), true, edges );
+			break;
+		case MeshPrimitive::TRIANGLE_STRIPS:
+			appendTriangleEdges( meshPrimitive, ((const Tristrips&)meshPrimitive).getGroupedVerticesVertexCountArray(), false, edges );
+			break;
+		default:
+			break;
+		}
+	}
+
+} // namespace COLLADAFW
@@ -0,0 +1,728 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWMeshOptimizer.h"
+
+#include "COLLADAFWMesh.h"
+#include "COLLADAFWMeshPrimitive.h"
+#include "COLLADAFWMeshTriangulator.h"
+#include "COLLADAFWTriangles.h"
+
+#include <algorithm>
+#include <math.h>
+
+
+namespace COLLADAFW
+{
+
+	namespace
+	{
+		const unsigned int INVALID_INDEX = 0xFFFFFFFF;
+
+		/** Constants of the vertex scores, as proposed by Tom Forsyth.*/
+		const float CACHE_DECAY_POWER = 1.5f;
+		const float LAST_TRIANGLE_SCORE = 0.75f;
+		const float VALENCE_BOOST_SCALE = 2.0f;
+		const float VALENCE_BOOST_POWER = 0.5f;
+
+		/** The number of valences for which the valence scores are precalculated.*/
+		const size_t VALENCE_SCORE_TABLE_SIZE = 64;
+
+		/** Calculates the score of vertices, depending on their position in the cache and the number of
+		triangles that still use them.*/
+		class VertexScores
+		{
+		private:
+			std::vector<float> mCachePositionScores;
+			std::vector<float> mValenceScores;
+
+		public:
+			VertexScores( size_t cacheSize )
+				: mCachePositionScores( cacheSize )
+				, mValenceScores( VALENCE_SCORE_TABLE_SIZE )
+			{
+				for ( size_t i = 0; i < cacheSize; ++i )
+				{
+					// the vertices of the last triangle get a fixed score, to not favor one of them
+					if ( i < 3 )
+						mCachePositionScores[i] = LAST_TRIANGLE_SCORE;
+					else
+						mCachePositionScores[i] = powf( 1.0f - (float)(i - 3) / (float)(cacheSize - 3), CACHE_DECAY_POWER );
+				}
+				mValenceScores[0] = 0;
+				for ( size_t i = 1; i < VALENCE_SCORE_TABLE_SIZE; ++i )
+					mValenceScores[i] = VALENCE_BOOST_SCALE * powf( (float)i, -VALENCE_BOOST_POWER );
+			}
+
+			float getScore( int cachePosition, unsigned int remainingValence ) const
+			{
+				if ( remainingValence == 0 )
+					return -1.0f;
+				float score = cachePosition < 0 ? 0 : mCachePositionScores[cachePosition];
+				if ( remainingValence < VALENCE_SCORE_TABLE_SIZE )
+					return score + mValenceScores[remainingValence];
+				return score + VALENCE_BOOST_SCALE * powf( (float)remainingValence, -VALENCE_BOOST_POWER );
+			}
+		};
+
+		/** A cluster of triangles in the optimized triangle order, with its overdraw sort key.*/
+		struct Cluster
+		{
+			size_t mFirst;
+			size_t mEnd;
+			double mSortKey;
+			bool operator<( const Cluster& rhs ) const { return mSortKey > rhs.mSortKey; }
+		};
+
+		/** Reorders the clusters of @a triangleOrder, which start at @a clusterStarts, such that clusters
+		facing away from the center of the mesh are drawn first.*/
+		template<class ValueType>
+		void sortClusters( const unsigned int* indices,
+						   const ValueType* positions,
+						   size_t positionCount,
+						   size_t positionOffset,
+						   size_t positionStride,
+						   const std::vector<size_t>& clusterStarts,
+						   std::vector<unsigned int>& triangleOrder )
+		{
+			size_t clusterCount = clusterStarts.size();
+			std::vector<Cluster> clusters( clusterCount );
+			std::vector<double> centroids( 3 * clusterCount, 0.0 );
+			std::vector<double> normals( 3 * clusterCount, 0.0 );
+			double meshCentroid[3] = { 0, 0, 0 };
+			double meshArea = 0;
+
+			for ( size_t c = 0; c < clusterCount; ++c )
+			{
+				Cluster& cluster = clusters[c];
+				cluster.mFirst = clusterStarts[c];
+				cluster.mEnd = c + 1 < clusterCount ? clusterStarts[c + 1] : triangleOrder.size();
+
+				double* centroid = &centroids[3 * c];
+				double* normal = &normals[3 * c];
+				double clusterArea = 0;
+				for ( size_t t = cluster.mFirst; t < cluster.mEnd; ++t )
+				{
+					const unsigned int* triangle = indices + 3 * triangleOrder[t];
+					if ( triangle[0] >= positionCount || triangle[1] >= positionCount || triangle[2] >= positionCount )
+						continue;
+					const ValueType* p0 = positions + triangle[0] * positionStride + positionOffset;
+					const ValueType* p1 = positions + triangle[1] * positionStride + positionOffset;
+					const ValueType* p2 = positions + triangle[2] * positionStride + positionOffset;
+					double e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+					double e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+					double n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+					double area = sqrt( n[0] * n[0] + n[1] * n[1] + n[2] * n[2] );
+					for ( int k = 0; k < 3; ++k )
+					{
+						centroid[k] += area * (p0[k] + p1[k] + p2[k]) / 3.0;
+						normal[k] += n[k];
+					}
+					clusterArea += area;
+				}
+				for ( int k = 0; k < 3; ++k )
+					meshCentroid[k] += centroid[k];
+				meshArea += clusterArea;
+				if ( clusterArea > 0 )
+				{
+					for ( int k = 0; k < 3; ++k )
+						centroid[k] /= clusterArea;
+				}
+			}
+			if ( meshArea <= 0 )
+				return;
+			for ( int k = 0; k < 3; ++k )
+				meshCentroid[k] /= meshArea;
+
+			for ( size_t c = 0; c < clusterCount; ++c )
+			{
+				const double* centroid = &centroids[3 * c];
+				const double* normal = &normals[3 * c];
+				double length = sqrt( normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2] );
+				double dot = (centroid[0] - meshCentroid[0]) * normal[0]
+						   + (centroid[1] - meshCentroid[1]) * normal[1]
+						   + (centroid[2] - meshCentroid[2]) * normal[2];
+				clusters[c].mSortKey = length > 0 ? dot / length : 0;
+			}
+
+			std::stable_sort( clusters.begin(), clusters.end() );
+
+			std::vector<unsigned int> sortedOrder;
+			sortedOrder.reserve( triangleOrder.size() );
+			for ( size_t c = 0; c < clusterCount; ++c )
+				sortedOrder.insert( sortedOrder.end(), triangleOrder.begin() + clusters[c].mFirst, triangleOrder.begin() + clusters[c].mEnd );
+			triangleOrder.swap( sortedOrder );
+		}
+
+		/** Reorders the triangles of @a indices, if it contains three indices for each triangle in
+		@a triangleOrder.*/
+		void reorderTriangles( UIntValuesArray& indices, const std::vector<unsigned int>& triangleOrder )
+		{
+			size_t triangleCount = triangleOrder.size();
+			if ( indices.getCount() < 3 * triangleCount )
+				return;
+
+			unsigned int* data = indices.getData();
+			std::vector<unsigned int> oldIndices( data, data + 3 * triangleCount );
+			for ( size_t t = 0; t < triangleCount; ++t )
+			{
+				const unsigned int* triangle = &oldIndices[3 * triangleOrder[t]];
+				data[3 * t] = triangle[0];
+				data[3 * t + 1] = triangle[1];
+				data[3 * t + 2] = triangle[2];
+			}
+		}
+
+		/** Assigns new indices to the vertices in the order they are first used in @a indices, starting at
+		@a nextIndex. @a remap contains the new index of each vertex or INVALID_INDEX, if it has not been
+		used yet.
+		@return The next unassigned index.*/
+		unsigned int assignFirstUseOrder( const unsigned int* indices, size_t indexCount, std::vector<unsigned int>& remap, unsigned int nextIndex )
+		{
+			for ( size_t i = 0; i < indexCount; ++i )
+			{
+				unsigned int index = indices[i];
+				if ( index < remap.size() && remap[index] == INVALID_INDEX )
+					remap[index] = nextIndex++;
+			}
+			return nextIndex;
+		}
+
+		/** Assigns the remaining indices to the vertices that are not used, in their original order.*/
+		void assignUnused( std::vector<unsigned int>& remap, unsigned int nextIndex )
+		{
+			for ( size_t i = 0, count = remap.size(); i < count; ++i )
+			{
+				if ( remap[i] == INVALID_INDEX )
+					remap[i] = nextIndex++;
+			}
+		}
+
+		/** Replaces the indices in @a indices by their new index in @a remap.*/
+		void remapIndices( unsigned int* indices, size_t indexCount, const std::vector<unsigned int>& remap )
+		{
+			for ( size_t i = 0; i < indexCount; ++i )
+			{
+				if ( indices[i] < remap.size() )
+					indices[i] = remap[indices[i]];
+			}
+		}
+
+		/** Moves the vertices of @a values with @a stride values each to their new position in @a remap.*/
+		template<class ValueType>
+		void remapValues( ValueType* values, size_t stride, const std::vector<unsigned int>& remap )
+		{
+			size_t vertexCount = remap.size();
+			std::vector<ValueType> oldValues( values, values + vertexCount * stride );
+			for ( size_t i = 0; i < vertexCount; ++i )
+			{
+				ValueType* target = values + remap[i] * stride;
+				const ValueType* source = &oldValues[i * stride];
+				for ( size_t k = 0; k < stride; ++k )
+					target[k] = source[k];
+			}
+		}
+
+		/** Returns the indices of a primitive into one of the vertex data arrays of the mesh.*/
+		typedef UIntValuesArray& (MeshPrimitive::*IndicesGetter)();
+
+		/** Reorders the values of @a vertexData, that have three values per vertex and are indexed by the
+		indices returned by @a getIndices, in the order they are first used.*/
+		void optimizeVertexDataFetch( MeshPrimitiveArray& meshPrimitives, MeshVertexData& vertexData, IndicesGetter getIndices, std::vector<unsigned int>& remap )
+		{
+			const size_t stride = 3;
+			size_t valuesCount = vertexData.getValuesCount();
+			remap.clear();
+			if ( valuesCount == 0 || (valuesCount % stride) != 0 || vertexData.getNumInputInfos() > 1 )
+				return;
+
+			remap.assign( valuesCount / stride, INVALID_INDEX );
+			unsigned int nextIndex = 0;
+			size_t primitiveCount = meshPrimitives.getCount();
+			for ( size_t i = 0; i < primitiveCount; ++i )
+			{
+				const UIntValuesArray& indices = (meshPrimitives[i]->*getIndices)();
+				nextIndex = assignFirstUseOrder( indices.getData(), indices.getCount(), remap, nextIndex );
+			}
+			assignUnused( remap, nextIndex );
+
+			for ( size_t i = 0; i < primitiveCount; ++i )
+			{
+				UIntValuesArray& indices = (meshPrimitives[i]->*getIndices)();
+				remapIndices( indices.getData(), indices.getCount(), remap );
+			}
+
+			if ( vertexData.getType() == MeshVertexData::DATA_TYPE_DOUBLE )
+				remapValues( vertexData.getDoubleValues()->getData(), stride, remap );
+			else
+				remapValues( vertexData.getFloatValues()->getData(), stride, remap );
+		}
+
+		/** True, if @a meshPrimitive describes surfaces, but is not a triangle list.*/
+		bool needsTriangulation( const MeshPrimitive* meshPrimitive )
+		{
+			switch ( meshPrimitive->getPrimitiveType() )
+			{
+			case MeshPrimitive::POLYGONS:
+			case MeshPrimitive::POLYLIST:
+			case MeshPrimitive::TRIANGLE_FANS:
+			case MeshPrimitive::TRIANGLE_STRIPS:
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		/** Appends @a values, the values of @a source, to @a target, together with the input infos of
+		@a source.*/
+		template<class ValueType>
+		void copyVertexData( const ArrayPrimitiveType<ValueType>& values, const MeshVertexData& source, MeshVertexData& target )
+		{
+			size_t valuesCount = values.getCount();
+			size_t offset = 0;
+
+			// the segments only refer to the values of the source, they do not release them
+			const MeshVertexData::InputInfosArray& inputInfos = source.getInputInfosArray();
+			for ( size_t i = 0, count = inputInfos.getCount(); i < count; ++i )
+			{
+				const MeshVertexData::InputInfos* inputInfo = inputInfos[i];
+				if ( offset + inputInfo->mLength > valuesCount )
+					break;
+				ArrayPrimitiveType<ValueType> segment;
+				segment.setData( const_cast<ValueType*>( values.getData() ) + offset, inputInfo->mLength );
+				target.appendValues( segment, inputInfo->mName, inputInfo->mStride );
+				offset += inputInfo->mLength;
+			}
+
+			if ( offset < valuesCount )
+			{
+				ArrayPrimitiveType<ValueType> segment;
+				segment.setData( const_cast<ValueType*>( values.getData() ) + offset, valuesCount - offset );
+				target.setType( source.getType() );
+				target.appendValues( segment );
+			}
+		}
+
+		/** Appends the values and input infos of @a source to @a target.*/
+		void copyVertexData( const MeshVertexData& source, MeshVertexData& target )
+		{
+			if ( source.getType() == MeshVertexData::DATA_TYPE_DOUBLE )
+				copyVertexData( *source.getDoubleValues(), source, target );
+			else if ( source.getType() == MeshVertexData::DATA_TYPE_FLOAT )
+				copyVertexData( *source.getFloatValues(), source, target );
+		}
+	}
+
+	//------------------------------
+	MeshOptimizer::MeshOptimizer()
+		: mOptimizations( OPTIMIZATION_TRIANGLE_ORDER )
+		, mCacheSize( DEFAULT_CACHE_SIZE )
+		, mParallel( false )
+	{
+	}
+
+	//------------------------------
+	MeshOptimizer::~MeshOptimizer()
+	{
+	}
+
+	//------------------------------
+	void MeshOptimizer::optimize( Mesh& mesh, std::vector<unsigned int>* positionRemap ) const
+	{
+		if ( mOptimizations & OPTIMIZATION_TRIANGULATE )
+			triangulate( mesh );
+
+		reorder( mesh, positionRemap );
+	}
+
+	//------------------------------
+	Mesh* MeshOptimizer::createOptimizedMesh( const Mesh& mesh, std::vector<unsigned int>* positionRemap ) const
+	{
+		Mesh* optimizedMesh = FW_NEW Mesh( mesh.getUniqueId() );
+		optimizedMesh->setName( mesh.getName() );
+		optimizedMesh->setOriginalId( mesh.getOriginalId() );
+
+		copyVertexData( mesh.getPositions(), optimizedMesh->getPositions() );
+		copyVertexData( mesh.getNormals(), optimizedMesh->getNormals() );
+		copyVertexData( mesh.getColors(), optimizedMesh->getColors() );
+		copyVertexData( mesh.getUVCoords(), optimizedMesh->getUVCoords() );
+		copyVertexData( mesh.getTangents(), optimizedMesh->getTangents() );
+		copyVertexData( mesh.getBinormals(), optimizedMesh->getBinormals() );
+
+		// the surface primitives are triangulated straight into the copy, lines and points are dropped
+		MeshTriangulator triangulator;
+		const MeshPrimitiveArray& meshPrimitives = mesh.getMeshPrimitives();
+		size_t primitiveCount = meshPrimitives.getCount();
+		std::vector<MeshPrimitive*> triangleLists( primitiveCount, (MeshPrimitive*)0 );
+#pragma omp parallel for schedule(dynamic) if(mParallel)
+		for ( int i = 0; i < (int)primitiveCount; ++i )
+		{
+			const MeshPrimitive* meshPrimitive = meshPrimitives[i];
+			if ( meshPrimitive->getPrimitiveType() != MeshPrimitive::TRIANGLES && !needsTriangulation( meshPrimitive ) )
+				continue;
+
+			std::vector<unsigned int> corners;
+			corners.reserve( 3 * MeshTriangulator::getMaxTriangleCount( *meshPrimitive ) );
+			triangulator.triangulate( mesh, *meshPrimitive, corners );
+			triangleLists[i] = MeshTriangulator::createTriangles( *meshPrimitive, corners.empty() ? 0 : &corners[0], corners.size() );
+		}
+
+		MeshPrimitiveArray& optimizedPrimitives = optimizedMesh->getMeshPrimitives();
+		for ( size_t i = 0; i < primitiveCount; ++i )
+		{
+			if ( triangleLists[i] )
+				optimizedPrimitives.append( triangleLists[i] );
+		}
+
+		reorder( *optimizedMesh, positionRemap );
+		return optimizedMesh;
+	}
+
+	//------------------------------
+	void MeshOptimizer::reorder( Mesh& mesh, std::vector<unsigned int>* positionRemap ) const
+	{
+		if ( mOptimizations & OPTIMIZATION_VERTEX_CACHE )
+		{
+			// the primitives do not share any data, the mesh is only read
+			MeshPrimitiveArray& meshPrimitives = mesh.getMeshPrimitives();
+			int primitiveCount = (int)meshPrimitives.getCount();
+#pragma omp parallel for schedule(dynamic) if(mParallel)
+			for ( int i = 0; i < primitiveCount; ++i )
+			{
+				MeshPrimitive* meshPrimitive = meshPrimitives[i];
+				if ( meshPrimitive->getPrimitiveType() == MeshPrimitive::TRIANGLES )
+					optimizeTriangleOrder( mesh, *meshPrimitive );
+			}
+		}
+
+		if ( mOptimizations & OPTIMIZATION_VERTEX_FETCH )
+			optimizeVertexFetch( mesh, positionRemap );
+	}
+
+	//------------------------------
+	void MeshOptimizer::optimize( VertexBufferBuilder::SubMesh& subMesh ) const
+	{
+		size_t indexCount = subMesh.getIndexCount();
+		if ( indexCount < 3 )
+			return;
+
+		std::vector<unsigned int> indices;
+		if ( subMesh.mHas32BitIndices )
+			indices.swap( subMesh.mIndices32 );
+		else
+			indices.assign( subMesh.mIndices16.begin(), subMesh.mIndices16.end() );
+
+		if ( mOptimizations & OPTIMIZATION_VERTEX_CACHE )
+		{
+			std::vector<unsigned int> triangleOrder;
+			if ( subMesh.mPositionOffset != VertexBufferBuilder::NO_OFFSET )
+			{
+				calculateTriangleOrder( &indices[0], indexCount, subMesh.mVertexCount, &subMesh.mVertices[0],
+					subMesh.mVertexCount, subMesh.mPositionOffset, subMesh.mVertexStride, triangleOrder );
+			}
+			else
+			{
+				calculateTriangleOrder<float>( &indices[0], indexCount, subMesh.mVertexCount, 0, 0, 0, 0, triangleOrder );
+			}
+
+			UIntValuesArray indicesArray;
+			indicesArray.setData( &indices[0], indexCount );
+			reorderTriangles( indicesArray, triangleOrder );
+		}
+
+		if ( (mOptimizations & OPTIMIZATION_VERTEX_FETCH) && subMesh.mVertexCount > 0 )
+		{
+			std::vector<unsigned int> remap( subMesh.mVertexCount, INVALID_INDEX );
+			unsigned int nextIndex = assignFirstUseOrder( &indices[0], indexCount, remap, 0 );
+			assignUnused( remap, nextIndex );
+			remapIndices( &indices[0], indexCount, remap );
+			if ( subMesh.mVertexStride > 0 )
+				remapValues( &subMesh.mVertices[0], subMesh.mVertexStride, remap );
+		}
+
+		if ( subMesh.mHas32BitIndices )
+			subMesh.mIndices32.swap( indices );
+		else
+			subMesh.mIndices16.assign( indices.begin(), indices.end() );
+	}
+
+	//------------------------------
+	void MeshOptimizer::calculateVertexCacheOrder( const unsigned int* indices,
+												   size_t indexCount,
+												   size_t vertexCount,
+												   size_t cacheSize,
+												   std::vector<unsigned int>& triangleOrder,
+												   std::vector<size_t>* clusterStarts )
+	{
+		size_t triangleCount = indexCount / 3;
+		indexCount = 3 * triangleCount;
+		triangleOrder.clear();
+		triangleOrder.reserve( triangleCount );
+		if ( clusterStarts )
+			clusterStarts->clear();
+		if ( triangleCount == 0 )
+			return;
+
+		for ( size_t i = 0; i < indexCount; ++i )
+		{
+			if ( indices[i] >= vertexCount )
+				vertexCount = indices[i] + 1;
+		}
+		if ( cacheSize < 4 )
+			cacheSize = 4;
+
+		// triangles adjacent to each vertex, the first mRemainingValence of them are not emitted yet
+		std::vector<unsigned int> remainingValence( vertexCount, 0 );
+		for ( size_t i = 0; i < indexCount; ++i )
+			++remainingValence[indices[i]];
+		std::vector<unsigned int> adjacencyOffsets( vertexCount + 1 );
+		adjacencyOffsets[0] = 0;
+		for ( size_t v = 0; v < vertexCount; ++v )
+			adjacencyOffsets[v + 1] = adjacencyOffsets[v] + remainingValence[v];
+		std::vector<unsigned int> adjacentTriangles( indexCount );
+		{
+			std::vector<unsigned int> fill( adjacencyOffsets.begin(), adjacencyOffsets.end() - 1 );
+			for ( size_t i = 0; i < indexCount; ++i )
+				adjacentTriangles[fill[indices[i]]++] = (unsigned int)(i / 3);
+		}
+
+		VertexScores vertexScores( cacheSize );
+		std::vector<int> cachePositions( vertexCount, -1 );
+		std::vector<float> scores( vertexCount );
+		for ( size_t v = 0; v < vertexCount; ++v )
+			scores[v] = vertexScores.getScore( -1, remainingValence[v] );
+
+		std::vector<bool> emitted( triangleCount, false );
+		unsigned int bestTriangle = INVALID_INDEX;
+		float bestScore = -1.0f;
+		for ( size_t t = 0; t < triangleCount; ++t )
+		{
+			const unsigned int* triangle = indices + 3 * t;
+			float score = scores[triangle[0]] + scores[triangle[1]] + scores[triangle[2]];
+			if ( score > bestScore )
+			{
+				bestScore = score;
+				bestTriangle = (unsigned int)t;
+			}
+		}
+
+		// LRU cache, with room for the three vertices pushed in by the emitted triangle
+		std::vector<unsigned int> cache;
+		std::vector<unsigned int> newCache;
+		cache.reserve( cacheSize + 3 );
+		newCache.reserve( cacheSize + 3 );
+
+		size_t nextUnemitted = 0;
+		while ( triangleOrder.size() < triangleCount )
+		{
+			if ( bestTriangle == INVALID_INDEX )
+			{
+				// no triangle uses a vertex in the cache, restart with the first triangle not emitted yet
+				while ( emitted[nextUnemitted] )
+					++nextUnemitted;
+				bestTriangle = (unsigned int)nextUnemitted;
+			}
+			if ( clusterStarts && (triangleOrder.empty() || cache.empty()) )
+				clusterStarts->push_back( triangleOrder.size() );
+
+			triangleOrder.push_back( bestTriangle );
+			emitted[bestTriangle] = true;
+
+			const unsigned int* triangle = indices + 3 * bestTriangle;
+			newCache.clear();
+			for ( int k = 0; k < 3; ++k )
+			{
+				unsigned int v = triangle[k];
+				newCache.push_back( v );
+
+				// remove the triangle from the remaining triangles of the vertex
+				unsigned int* first = &adjacentTriangles[adjacencyOffsets[v]];
+				unsigned int* last = first + remainingValence[v] - 1;
+				for ( unsigned int* it = first; it <= last; ++it )
+				{
+					if ( *it == bestTriangle )
+					{
+						*it = *last;
+						*last = bestTriangle;
+						break;
+					}
+				}
+				--remainingValence[v];
+			}
+			for ( size_t i = 0, count = cache.size(); i < count; ++i )
+			{
+				unsigned int v = cache[i];
+				if ( v != triangle[0] && v != triangle[1] && v != triangle[2] )
+					newCache.push_back( v );
+			}
+
+			// update the scores of all vertices in the cache and of their remaining triangles
+			for ( size_t i = 0, count = newCache.size(); i < count; ++i )
+			{
+				unsigned int v = newCache[i];
+				cachePositions[v] = i < cacheSize ? (int)i : -1;
+				scores[v] = vertexScores.getScore( cachePositions[v], remainingValence[v] );
+			}
+
+			bestTriangle = INVALID_INDEX;
+			bestScore = -1.0f;
+			for ( size_t i = 0, count = newCache.size(); i < count; ++i )
+			{
+				unsigned int v = newCache[i];
+				const unsigned int* adjacent = &adjacentTriangles[adjacencyOffsets[v]];
+				for ( unsigned int j = 0; j < remainingValence[v]; ++j )
+				{
+					unsigned int t = adjacent[j];
+					const unsigned int* adjacentTriangle = indices + 3 * t;
+					float score = scores[adjacentTriangle[0]] + scores[adjacentTriangle[1]] + scores[adjacentTriangle[2]];
+					if ( score > bestScore )
+					{
+						bestScore = score;
+						bestTriangle = t;
+					}
+				}
+			}
+
+			if ( newCache.size() > cacheSize )
+				newCache.resize( cacheSize );
+			cache.swap( newCache );
+
+			// the cache only contains vertices without remaining triangles, i.e. the next triangle starts a
+			// new cluster
+			if ( bestTriangle == INVALID_INDEX )
+				cache.clear();
+		}
+	}
+
+	//------------------------------
+	double MeshOptimizer::calculateAverageCacheMissRatio( const unsigned int* indices, size_t indexCount, size_t vertexCount, size_t cacheSize )
+	{
+		size_t triangleCount = indexCount / 3;
+		if ( triangleCount == 0 )
+			return 0;
+		indexCount = 3 * triangleCount;
+
+		for ( size_t i = 0; i < indexCount; ++i )
+		{
+			if ( indices[i] >= vertexCount )
+				vertexCount = indices[i] + 1;
+		}
+
+		// FIFO cache: a vertex is in the cache, if it has been loaded within the last cacheSize misses
+		std::vector<size_t> loadTimes( vertexCount, 0 );
+		size_t missCount = 0;
+		for ( size_t i = 0; i < indexCount; ++i )
+		{
+			size_t& loadTime = loadTimes[indices[i]];
+			if ( loadTime == 0 || missCount + 1 - loadTime > cacheSize )
+			{
+				++missCount;
+				loadTime = missCount;
+			}
+		}
+		return (double)missCount / (double)triangleCount;
+	}
+
+	//------------------------------
+	template<class ValueType>
+	void MeshOptimizer::calculateTriangleOrder( const unsigned int* indices,
+												size_t indexCount,
+												size_t vertexCount,
+												const ValueType* positions,
+												size_t positionCount,
+												size_t positionOffset,
+												size_t positionStride,
+												std::vector<unsigned int>& triangleOrder ) const
+	{
+		bool optimizeOverdraw = (mOptimizations & OPTIMIZATION_OVERDRAW) && positions;
+		std::vector<size_t> clusterStarts;
+		calculateVertexCacheOrder( indices, indexCount, vertexCount, mCacheSize, triangleOrder, optimizeOverdraw ? &clusterStarts : 0 );
+		if ( optimizeOverdraw && clusterStarts.size() > 1 )
+			sortClusters( indices, positions, positionCount, positionOffset, positionStride, clusterStarts, triangleOrder );
+	}
+
+	//------------------------------
+	void MeshOptimizer::optimizeTriangleOrder( const Mesh& mesh, MeshPrimitive& meshPrimitive ) const
+	{
+		UIntValuesArray& positionIndices = meshPrimitive.getPositionIndices();
+		size_t indexCount = positionIndices.getCount();
+		if ( indexCount < 6 )
+			return;
+
+		const MeshVertexData& positions = mesh.getPositions();
+		size_t positionCount = positions.getValuesCount() / 3;
+		std::vector<unsigned int> triangleOrder;
+		if ( positions.getType() == MeshVertexData::DATA_TYPE_DOUBLE && positionCount > 0 )
+		{
+			calculateTriangleOrder( positionIndices.getData(), indexCount, positionCount,
+				positions.getDoubleValues()->getData(), positionCount, 0, 3, triangleOrder );
+		}
+		else if ( positions.getType() == MeshVertexData::DATA_TYPE_FLOAT && positionCount > 0 )
+		{
+			calculateTriangleOrder( positionIndices.getData(), indexCount, positionCount,
+				positions.getFloatValues()->getData(), positionCount, 0, 3, triangleOrder );
+		}
+		else
+		{
+			calculateTriangleOrder<float>( positionIndices.getData(), indexCount, positionCount, 0, 0, 0, 0, triangleOrder );
+		}
+
+		// all index lists are reordered the same way, to keep the corners together
+		reorderTriangles( positionIndices, triangleOrder );
+		reorderTriangles( meshPrimitive.getNormalIndices(), triangleOrder );
+		reorderTriangles( meshPrimitive.getTangentIndices(), triangleOrder );
+		reorderTriangles( meshPrimitive.getBinormalIndices(), triangleOrder );
+		IndexListArray& uvIndexLists = meshPrimitive.getUVCoordIndicesArray();
+		for ( size_t i = 0, count = uvIndexLists.getCount(); i < count; ++i )
+			reorderTriangles( uvIndexLists[i]->getIndices(), triangleOrder );
+		IndexListArray& colorIndexLists = meshPrimitive.getColorIndicesArray();
+		for ( size_t i = 0, count = colorIndexLists.getCount(); i < count; ++i )
+			reorderTriangles( colorIndexLists[i]->getIndices(), triangleOrder );
+	}
+
+	//------------------------------
+	void MeshOptimizer::triangulate( Mesh& mesh ) const
+	{
+		MeshTriangulator triangulator;
+
+		MeshPrimitiveArray& meshPrimitives = mesh.getMeshPrimitives();
+		int primitiveCount = (int)meshPrimitives.getCount();
+#pragma omp parallel for schedule(dynamic) if(mParallel)
+		for ( int i = 0; i < primitiveCount; ++i )
+		{
+			MeshPrimitive* meshPrimitive = meshPrimitives[i];
+			if ( !needsTriangulation( meshPrimitive ) )
+				continue;
+
+			std::vector<unsigned int> corners;
+			corners.reserve( 3 * MeshTriangulator::getMaxTriangleCount( *meshPrimitive ) );
+			triangulator.triangulate( mesh, *meshPrimitive, corners );
+			meshPrimitives[i] = MeshTriangulator::createTriangles( *meshPrimitive, corners.empty() ? 0 : &corners[0], corners.size() );
+			FW_DELETE meshPrimitive;
+		}
+	}
+
+	//------------------------------
+	void MeshOptimizer::optimizeVertexFetch( Mesh& mesh, std::vector<unsigned int>* positionRemap ) const
+	{
+		MeshPrimitiveArray& meshPrimitives = mesh.getMeshPrimitives();
+		std::vector<unsigned int> remap;
+
+		optimizeVertexDataFetch( meshPrimitives, mesh.getNormals(), &MeshPrimitive::getNormalIndices, remap );
+		optimizeVertexDataFetch( meshPrimitives, mesh.getTangents(), &MeshPrimitive::getTangentIndices, remap );
+		optimizeVertexDataFetch( meshPrimitives, mesh.getBinormals(), &MeshPrimitive::getBinormalIndices, remap );
+		optimizeVertexDataFetch( meshPrimitives, mesh.getPositions(), &MeshPrimitive::getPositionIndices, remap );
+
+		if ( positionRemap )
+			positionRemap->swap( remap );
+	}
+
+} // namespace COLLADAFW
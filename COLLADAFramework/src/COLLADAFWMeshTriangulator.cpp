@@ -0,0 +1,741 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWMeshTriangulator.h"
+
+#include "COLLADAFWMesh.h"
+#include "COLLADAFWMeshPrimitive.h"
+#include "COLLADAFWPolygons.h"
+#include "COLLADAFWTriangles.h"
+#include "COLLADAFWTrifans.h"
+#include "COLLADAFWTristrips.h"
+
+#include <algorithm>
+#include <math.h>
+
+
+namespace COLLADAFW
+{
+
+	namespace
+	{
+		/** A position projected into the plane of a polygon.*/
+		struct Point2D
+		{
+			double u;
+			double v;
+		};
+
+		/** Twice the signed area of the triangle @a a, @a b, @a c. Positive, if the triangle is counter
+		clockwise.*/
+		inline double cross( const Point2D& a, const Point2D& b, const Point2D& c )
+		{
+			return (b.u - a.u) * (c.v - a.v) - (b.v - a.v) * (c.u - a.u);
+		}
+
+		inline bool equals( const Point2D& a, const Point2D& b )
+		{
+			return a.u == b.u && a.v == b.v;
+		}
+
+		/** True, if @a p lies inside or on the border of the counter clockwise triangle @a a, @a b, @a c.*/
+		inline bool isInTriangle( const Point2D& p, const Point2D& a, const Point2D& b, const Point2D& c )
+		{
+			return cross( a, b, p ) >= 0 && cross( b, c, p ) >= 0 && cross( c, a, p ) >= 0;
+		}
+
+		/** True, if the segments @a p1 - @a p2 and @a q1 - @a q2 cross each other in a point that is not an end
+		point of both segments.*/
+		inline bool intersects( const Point2D& p1, const Point2D& p2, const Point2D& q1, const Point2D& q2 )
+		{
+			double d1 = cross( p1, p2, q1 );
+			double d2 = cross( p1, p2, q2 );
+			double d3 = cross( q1, q2, p1 );
+			double d4 = cross( q1, q2, p2 );
+			return ((d1 > 0 && d2 < 0) || (d1 < 0 && d2 > 0)) && ((d3 > 0 && d4 < 0) || (d3 < 0 && d4 > 0));
+		}
+
+		/** Scratch memory reused for all polygons of a primitive.*/
+		struct PolygonScratch
+		{
+			/** The corners of the loop that is clipped, i.e. the outer loop with all holes bridged in.*/
+			std::vector<unsigned int> mLoopCorners;
+
+			/** The projected positions of mLoopCorners.*/
+			std::vector<Point2D> mLoopPoints;
+
+			/** The corners of all holes of the polygon, one after the other.*/
+			std::vector<unsigned int> mHoleCorners;
+
+			/** The projected positions of mHoleCorners.*/
+			std::vector<Point2D> mHolePoints;
+
+			/** Index of the first corner of each hole in mHoleCorners, followed by the number of corners.*/
+			std::vector<size_t> mHoleStarts;
+
+			/** Indices of the holes in the order they are bridged into the outer loop.*/
+			std::vector<size_t> mHoleOrder;
+
+			/** The largest projected u coordinate of each hole.*/
+			std::vector<double> mHoleMaxU;
+
+			/** The corners of the hole that is loaded.*/
+			std::vector<unsigned int> mCurrentHoleCorners;
+
+			/** Indices of the loop corners ordered by their distance to the hole vertex to bridge.*/
+			std::vector<size_t> mBridgeCandidates;
+
+			/** Doubly linked list of the loop corners that have not been clipped yet.*/
+			std::vector<size_t> mPrevious;
+			std::vector<size_t> mNext;
+		};
+
+		/** Orders hole indices by the largest u coordinate of their vertices, descending.*/
+		class HoleOrder
+		{
+		private:
+			const std::vector<double>& mMaxU;
+		public:
+			HoleOrder( const std::vector<double>& maxU ) : mMaxU( maxU ) {}
+			bool operator()( size_t a, size_t b ) const { return mMaxU[a] > mMaxU[b]; }
+		};
+
+		/** Orders loop indices by the distance of their points to a point.*/
+		class DistanceOrder
+		{
+		private:
+			const std::vector<Point2D>& mPoints;
+			Point2D mPoint;
+		public:
+			DistanceOrder( const std::vector<Point2D>& points, const Point2D& point ) : mPoints( points ), mPoint( point ) {}
+			bool operator()( size_t a, size_t b ) const { return distance( mPoints[a] ) < distance( mPoints[b] ); }
+		private:
+			double distance( const Point2D& p ) const
+			{
+				double du = p.u - mPoint.u;
+				double dv = p.v - mPoint.v;
+				return du * du + dv * dv;
+			}
+		};
+
+		/** Reads the position with index @a positionIndex. Returns false, if it is not available.*/
+		bool getPosition( const MeshVertexData& positions, unsigned int positionIndex, double* position )
+		{
+			size_t first = (size_t)positionIndex * 3;
+			if ( first + 3 > positions.getValuesCount() )
+				return false;
+
+			if ( positions.getType() == MeshVertexData::DATA_TYPE_DOUBLE )
+			{
+				const double* values = positions.getDoubleValues()->getData() + first;
+				position[0] = values[0];
+				position[1] = values[1];
+				position[2] = values[2];
+			}
+			else
+			{
+				const float* values = positions.getFloatValues()->getData() + first;
+				position[0] = values[0];
+				position[1] = values[1];
+				position[2] = values[2];
+			}
+			return true;
+		}
+
+		/** Projects polygon loops into the plane with the normal of the outer loop, such that the outer loop
+		is counter clockwise.*/
+		class PlaneProjection
+		{
+		private:
+			/** The two axes kept by the projection.*/
+			int mUAxis;
+			int mVAxis;
+
+			/** -1, if the u axis has to be flipped to make the outer loop counter clockwise, 1 otherwise.*/
+			double mUSign;
+
+		public:
+			/** Sets up the projection from the Newell normal @a normal of the outer loop.
+			@return False, if the normal is degenerated.*/
+			bool setNormal( const double* normal )
+			{
+				double x = fabs( normal[0] );
+				double y = fabs( normal[1] );
+				double z = fabs( normal[2] );
+				int dropAxis = (x > y) ? (x > z ? 0 : 2) : (y > z ? 1 : 2);
+				if ( normal[dropAxis] == 0 )
+					return false;
+				mUAxis = (dropAxis + 1) % 3;
+				mVAxis = (dropAxis + 2) % 3;
+				mUSign = normal[dropAxis] > 0 ? 1 : -1;
+				return true;
+			}
+
+			void project( const double* position, Point2D& point ) const
+			{
+				point.u = mUSign * position[mUAxis];
+				point.v = position[mVAxis];
+			}
+		};
+
+		/** Appends the triangle fan of the polygon with @a vertexCount corners starting at @a first.*/
+		inline void appendFan( unsigned int first, unsigned int vertexCount, std::vector<unsigned int>& corners )
+		{
+			for ( unsigned int j = 2; j < vertexCount; ++j )
+			{
+				corners.push_back( first );
+				corners.push_back( first + j - 1 );
+				corners.push_back( first + j );
+			}
+		}
+
+		/** Loads the corners from @a first to @a first + @a vertexCount into @a loopCorners and their
+		positions into @a loopPositions.
+		@return False, if a position is not available.*/
+		bool loadLoop( const MeshVertexData& positions,
+					   const UIntValuesArray& positionIndices,
+					   unsigned int first,
+					   unsigned int vertexCount,
+					   std::vector<unsigned int>& loopCorners,
+					   std::vector<double>& loopPositions )
+		{
+			loopCorners.resize( vertexCount );
+			loopPositions.resize( 3 * vertexCount );
+			for ( unsigned int i = 0; i < vertexCount; ++i )
+			{
+				loopCorners[i] = first + i;
+				if ( !getPosition( positions, positionIndices[first + i], &loopPositions[3 * i] ) )
+					return false;
+			}
+			return true;
+		}
+
+		/** True, if the diagonal from loop point @a a to @a b starts into the interior of the counter
+		clockwise loop.*/
+		bool isLocallyInside( const std::vector<Point2D>& points, size_t a, const Point2D& b )
+		{
+			size_t count = points.size();
+			const Point2D& previous = points[(a + count - 1) % count];
+			const Point2D& next = points[(a + 1) % count];
+			const Point2D& point = points[a];
+			if ( cross( previous, point, next ) >= 0 )
+				return cross( point, next, b ) >= 0 && cross( previous, point, b ) >= 0;
+			else
+				return cross( point, next, b ) >= 0 || cross( previous, point, b ) >= 0;
+		}
+
+		/** True, if the segment from loop point @a a to @a b does not cross any edge of the loop or of the
+		holes that have not been bridged yet.*/
+		bool isVisible( const PolygonScratch& scratch, size_t a, const Point2D& b, size_t bridgedHoleCount )
+		{
+			const std::vector<Point2D>& points = scratch.mLoopPoints;
+			const Point2D& point = points[a];
+			for ( size_t i = 0, count = points.size(); i < count; ++i )
+			{
+				if ( intersects( point, b, points[i], points[(i + 1) % count] ) )
+					return false;
+			}
+			for ( size_t h = bridgedHoleCount, holeCount = scratch.mHoleOrder.size(); h < holeCount; ++h )
+			{
+				size_t hole = scratch.mHoleOrder[h];
+				size_t holeFirst = scratch.mHoleStarts[2 * hole];
+				size_t holeCornerCount = scratch.mHoleStarts[2 * hole + 1];
+				for ( size_t i = 0; i < holeCornerCount; ++i )
+				{
+					const Point2D& p1 = scratch.mHolePoints[holeFirst + i];
+					const Point2D& p2 = scratch.mHolePoints[holeFirst + (i + 1) % holeCornerCount];
+					if ( intersects( point, b, p1, p2 ) )
+						return false;
+				}
+			}
+			return true;
+		}
+
+		/** Bridges the holes in @a scratch into the outer loop in @a scratch. The holes must be clockwise.*/
+		void bridgeHoles( PolygonScratch& scratch )
+		{
+			for ( size_t h = 0, holeCount = scratch.mHoleOrder.size(); h < holeCount; ++h )
+			{
+				size_t hole = scratch.mHoleOrder[h];
+				size_t holeFirst = scratch.mHoleStarts[2 * hole];
+				size_t holeCornerCount = scratch.mHoleStarts[2 * hole + 1];
+
+				// the hole vertex with the largest u coordinate is connected to the closest visible loop vertex
+				size_t holeVertex = 0;
+				for ( size_t i = 1; i < holeCornerCount; ++i )
+				{
+					if ( scratch.mHolePoints[holeFirst + i].u > scratch.mHolePoints[holeFirst + holeVertex].u )
+						holeVertex = i;
+				}
+				const Point2D holePoint = scratch.mHolePoints[holeFirst + holeVertex];
+
+				size_t loopCount = scratch.mLoopPoints.size();
+				scratch.mBridgeCandidates.resize( loopCount );
+				for ( size_t i = 0; i < loopCount; ++i )
+					scratch.mBridgeCandidates[i] = i;
+				std::sort( scratch.mBridgeCandidates.begin(), scratch.mBridgeCandidates.end(), DistanceOrder( scratch.mLoopPoints, holePoint ) );
+
+				size_t loopVertex = scratch.mBridgeCandidates.front();
+				for ( size_t i = 0; i < loopCount; ++i )
+				{
+					size_t candidate = scratch.mBridgeCandidates[i];
+					if ( isLocallyInside( scratch.mLoopPoints, candidate, holePoint ) && isVisible( scratch, candidate, holePoint, h ) )
+					{
+						loopVertex = candidate;
+						break;
+					}
+				}
+
+				// insert hole vertex, the rest of the hole, the hole vertex again and the loop vertex again
+				// after the loop vertex
+				size_t insertCount = holeCornerCount + 2;
+				scratch.mLoopCorners.insert( scratch.mLoopCorners.begin() + loopVertex + 1, insertCount, 0 );
+				scratch.mLoopPoints.insert( scratch.mLoopPoints.begin() + loopVertex + 1, insertCount, holePoint );
+				for ( size_t i = 0; i <= holeCornerCount; ++i )
+				{
+					size_t holeIndex = holeFirst + (holeVertex + i) % holeCornerCount;
+					scratch.mLoopCorners[loopVertex + 1 + i] = scratch.mHoleCorners[holeIndex];
+					scratch.mLoopPoints[loopVertex + 1 + i] = scratch.mHolePoints[holeIndex];
+				}
+				scratch.mLoopCorners[loopVertex + insertCount] = scratch.mLoopCorners[loopVertex];
+				scratch.mLoopPoints[loopVertex + insertCount] = scratch.mLoopPoints[loopVertex];
+			}
+		}
+
+		/** True, if the corner @a current of the loop in @a scratch is an ear, i.e. it is convex and no other
+		remaining loop point lies in the triangle.*/
+		bool isEar( const PolygonScratch& scratch, size_t previous, size_t current, size_t next )
+		{
+			const std::vector<Point2D>& points = scratch.mLoopPoints;
+			const Point2D& a = points[previous];
+			const Point2D& b = points[current];
+			const Point2D& c = points[next];
+			if ( cross( a, b, c ) <= 0 )
+				return false;
+
+			for ( size_t i = scratch.mNext[next]; i != previous; i = scratch.mNext[i] )
+			{
+				const Point2D& p = points[i];
+				// the bridges duplicate points, which must not block the ears they belong to
+				if ( equals( p, a ) || equals( p, b ) || equals( p, c ) )
+					continue;
+				if ( isInTriangle( p, a, b, c ) )
+					return false;
+			}
+			return true;
+		}
+
+		/** Triangulates the loop in @a scratch by ear clipping and appends the triangles to @a corners.*/
+		void clipEars( PolygonScratch& scratch, std::vector<unsigned int>& corners )
+		{
+			size_t count = scratch.mLoopCorners.size();
+			scratch.mPrevious.resize( count );
+			scratch.mNext.resize( count );
+			for ( size_t i = 0; i < count; ++i )
+			{
+				scratch.mPrevious[i] = (i + count - 1) % count;
+				scratch.mNext[i] = (i + 1) % count;
+			}
+
+			size_t remaining = count;
+			size_t current = 0;
+			size_t failedCount = 0;
+			while ( remaining > 3 )
+			{
+				size_t previous = scratch.mPrevious[current];
+				size_t next = scratch.mNext[current];
+
+				// degenerated polygons might not have any ear left. Clip anyway, to terminate
+				if ( isEar( scratch, previous, current, next ) || failedCount >= remaining )
+				{
+					corners.push_back( scratch.mLoopCorners[previous] );
+					corners.push_back( scratch.mLoopCorners[current] );
+					corners.push_back( scratch.mLoopCorners[next] );
+					scratch.mNext[previous] = next;
+					scratch.mPrevious[next] = previous;
+					--remaining;
+					failedCount = 0;
+				}
+				else
+				{
+					++failedCount;
+				}
+				current = next;
+			}
+
+			corners.push_back( scratch.mLoopCorners[scratch.mPrevious[current]] );
+			corners.push_back( scratch.mLoopCorners[current] );
+			corners.push_back( scratch.mLoopCorners[scratch.mNext[current]] );
+		}
+
+		/** Triangulates the polygon with the outer loop of @a vertexCount corners starting at @a first and the
+		holes with @a holeVertexCounts corners that follow the outer loop.
+		@return False, if the polygon could not be projected. Nothing has been appended to @a corners then.*/
+		bool triangulatePolygon( const MeshVertexData& positions,
+								 const UIntValuesArray& positionIndices,
+								 unsigned int first,
+								 unsigned int vertexCount,
+								 const int* holeVertexCounts,
+								 size_t holeCount,
+								 PolygonScratch& scratch,
+								 std::vector<double>& loopPositions,
+								 std::vector<unsigned int>& corners )
+		{
+			if ( !loadLoop( positions, positionIndices, first, vertexCount, scratch.mLoopCorners, loopPositions ) )
+				return false;
+
+			// Newell normal of the outer loop
+			double normal[3] = { 0, 0, 0 };
+			for ( unsigned int i = 0; i < vertexCount; ++i )
+			{
+				const double* p = &loopPositions[3 * i];
+				const double* q = &loopPositions[3 * ((i + 1) % vertexCount)];
+				normal[0] += (p[1] - q[1]) * (p[2] + q[2]);
+				normal[1] += (p[2] - q[2]) * (p[0] + q[0]);
+				normal[2] += (p[0] - q[0]) * (p[1] + q[1]);
+			}
+			PlaneProjection projection;
+			if ( !projection.setNormal( normal ) )
+				return false;
+
+			scratch.mLoopPoints.resize( vertexCount );
+			for ( unsigned int i = 0; i < vertexCount; ++i )
+				projection.project( &loopPositions[3 * i], scratch.mLoopPoints[i] );
+
+			if ( holeCount == 0 )
+			{
+				// convex polygons are fanned, which gives the same triangles as the ear clipping
+				bool isConvex = true;
+				for ( unsigned int i = 0; i < vertexCount && isConvex; ++i )
+				{
+					const Point2D& a = scratch.mLoopPoints[i];
+					const Point2D& b = scratch.mLoopPoints[(i + 1) % vertexCount];
+					const Point2D& c = scratch.mLoopPoints[(i + 2) % vertexCount];
+					isConvex = cross( a, b, c ) >= 0;
+				}
+				if ( isConvex )
+				{
+					appendFan( first, vertexCount, corners );
+					return true;
+				}
+			}
+			else
+			{
+				scratch.mHoleCorners.clear();
+				scratch.mHolePoints.clear();
+				scratch.mHoleStarts.clear();
+				scratch.mHoleOrder.clear();
+				scratch.mHoleMaxU.clear();
+				unsigned int holeStart = first + vertexCount;
+				for ( size_t h = 0; h < holeCount; ++h )
+				{
+					unsigned int holeVertexCount = (unsigned int)(-holeVertexCounts[h]);
+					size_t holeFirst = scratch.mHoleCorners.size();
+					if ( holeVertexCount >= 3 )
+					{
+						std::vector<unsigned int>& holeCorners = scratch.mCurrentHoleCorners;
+						if ( !loadLoop( positions, positionIndices, holeStart, holeVertexCount, holeCorners, loopPositions ) )
+							return false;
+
+						double area = 0;
+						double holeMaxU = 0;
+						scratch.mHolePoints.resize( holeFirst + holeVertexCount );
+						for ( unsigned int i = 0; i < holeVertexCount; ++i )
+						{
+							Point2D& point = scratch.mHolePoints[holeFirst + i];
+							projection.project( &loopPositions[3 * i], point );
+							if ( i == 0 || point.u > holeMaxU )
+								holeMaxU = point.u;
+						}
+						for ( unsigned int i = 0; i < holeVertexCount; ++i )
+						{
+							const Point2D& p = scratch.mHolePoints[holeFirst + i];
+							const Point2D& q = scratch.mHolePoints[holeFirst + (i + 1) % holeVertexCount];
+							area += p.u * q.v - q.u * p.v;
+						}
+
+						// holes have to be clockwise to be bridged into the counter clockwise outer loop
+						if ( area > 0 )
+						{
+							std::reverse( holeCorners.begin(), holeCorners.end() );
+							std::reverse( scratch.mHolePoints.begin() + holeFirst, scratch.mHolePoints.end() );
+						}
+						scratch.mHoleCorners.insert( scratch.mHoleCorners.end(), holeCorners.begin(), holeCorners.end() );
+						scratch.mHoleStarts.push_back( holeFirst );
+						scratch.mHoleStarts.push_back( holeVertexCount );
+						scratch.mHoleOrder.push_back( scratch.mHoleMaxU.size() );
+						scratch.mHoleMaxU.push_back( holeMaxU );
+					}
+					holeStart += holeVertexCount;
+				}
+
+				std::sort( scratch.mHoleOrder.begin(), scratch.mHoleOrder.end(), HoleOrder( scratch.mHoleMaxU ) );
+				bridgeHoles( scratch );
+			}
+
+			clipEars( scratch, corners );
+			return true;
+		}
+
+		/** Copies the indices of @a source at the @a cornerCount corners in @a corners to @a target.*/
+		void gatherIndices( const UIntValuesArray& source, const unsigned int* corners, size_t cornerCount, UIntValuesArray& target )
+		{
+			target.allocMemory( cornerCount );
+			target.setCount( cornerCount );
+			const unsigned int* sourceData = source.getData();
+			size_t sourceCount = source.getCount();
+			unsigned int* targetData = target.getData();
+			for ( size_t i = 0; i < cornerCount; ++i )
+			{
+				unsigned int corner = corners[i];
+				targetData[i] = corner < sourceCount ? sourceData[corner] : 0;
+			}
+		}
+
+		/** Appends copies of the index lists in @a source to @a target, with the indices at the @a cornerCount
+		corners in @a corners.*/
+		void gatherIndexLists( const IndexListArray& source, const unsigned int* corners, size_t cornerCount, IndexListArray& target )
+		{
+			for ( size_t i = 0, count = source.getCount(); i < count; ++i )
+			{
+				const IndexList* sourceIndexList = source[i];
+				IndexList* indexList = FW_NEW IndexList();
+				indexList->setName( sourceIndexList->getName() );
+				indexList->setStride( sourceIndexList->getStride() );
+				indexList->setSetIndex( sourceIndexList->getSetIndex() );
+				indexList->setInitialIndex( sourceIndexList->getInitialIndex() );
+				gatherIndices( sourceIndexList->getIndices(), corners, cornerCount, indexList->getIndices() );
+				target.append( indexList );
+			}
+		}
+	}
+
+	//------------------------------
+	MeshTriangulator::MeshTriangulator()
+		: mPolygonMode( POLYGON_MODE_EAR_CLIPPING )
+		, mParallel( false )
+	{
+	}
+
+	//------------------------------
+	MeshTriangulator::~MeshTriangulator()
+	{
+	}
+
+	//------------------------------
+	void MeshTriangulator::triangulate( const Mesh& mesh, TriangulatedPrimitiveList& triangulatedPrimitives ) const
+	{
+		const MeshPrimitiveArray& meshPrimitives = mesh.getMeshPrimitives();
+		size_t firstTriangulatedPrimitive = triangulatedPrimitives.size();
+		triangulatedPrimitives.resize( firstTriangulatedPrimitive + meshPrimitives.getCount() );
+
+		// the primitives do not share any data but the read only mesh
+		int primitiveCount = (int)meshPrimitives.getCount();
+#pragma omp parallel for schedule(dynamic) if(mParallel)
+		for ( int i = 0; i < primitiveCount; ++i )
+		{
+			TriangulatedPrimitive& triangulatedPrimitive = triangulatedPrimitives[firstTriangulatedPrimitive + i];
+			triangulatedPrimitive.mMeshPrimitive = meshPrimitives[i];
+			triangulatedPrimitive.mCorners.clear();
+			triangulatedPrimitive.mCorners.reserve( 3 * getMaxTriangleCount( *meshPrimitives[i] ) );
+			triangulate( mesh, *meshPrimitives[i], triangulatedPrimitive.mCorners );
+		}
+	}
+
+	//------------------------------
+	size_t MeshTriangulator::triangulate( const Mesh& mesh, const MeshPrimitive& meshPrimitive, std::vector<unsigned int>& corners ) const
+	{
+		size_t oldCornerCount = corners.size();
+		size_t indexCount = meshPrimitive.getPositionIndices().getCount();
+
+		switch ( meshPrimitive.getPrimitiveType() )
+		{
+		case MeshPrimitive::TRIANGLES:
+			{
+				for ( unsigned int i = 0; i + 2 < indexCount; i += 3 )
+				{
+					corners.push_back( i );
+					corners.push_back( i + 1 );
+					corners.push_back( i + 2 );
+				}
+				break;
+			}
+		case MeshPrimitive::TRIANGLE_FANS:
+			{
+				const Trifans::VertexCountArray& vertexCounts = ((const Trifans&)meshPrimitive).getGroupedVerticesVertexCountArray();
+				unsigned int first = 0;
+				for ( size_t i = 0, count = vertexCounts.getCount(); i < count; ++i )
+				{
+					unsigned int vertexCount = vertexCounts[i];
+					if ( first + vertexCount > indexCount )
+						break;
+					appendFan( first, vertexCount, corners );
+					first += vertexCount;
+				}
+				break;
+			}
+		case MeshPrimitive::TRIANGLE_STRIPS:
+			{
+				const Tristrips::VertexCountArray& vertexCounts = ((const Tristrips&)meshPrimitive).getGroupedVerticesVertexCountArray();
+				unsigned int first = 0;
+				for ( size_t i = 0, count = vertexCounts.getCount(); i < count; ++i )
+				{
+					unsigned int vertexCount = vertexCounts[i];
+					if ( first + vertexCount > indexCount )
+						break;
+					for ( unsigned int j = 2; j < vertexCount; ++j )
+					{
+						// every second triangle has to be flipped to keep the winding
+						if ( (j & 1) == 0 )
+						{
+							corners.push_back( first + j - 2 );
+							corners.push_back( first + j - 1 );
+						}
+						else
+						{
+							corners.push_back( first + j - 1 );
+							corners.push_back( first + j - 2 );
+						}
+						corners.push_back( first + j );
+					}
+					first += vertexCount;
+				}
+				break;
+			}
+		case MeshPrimitive::POLYGONS:
+		case MeshPrimitive::POLYLIST:
+			{
+				triangulatePolygons( mesh, meshPrimitive, corners );
+				break;
+			}
+		default:
+			break;
+		}
+
+		return corners.size() - oldCornerCount;
+	}
+
+	//------------------------------
+	void MeshTriangulator::triangulatePolygons( const Mesh& mesh, const MeshPrimitive& meshPrimitive, std::vector<unsigned int>& corners ) const
+	{
+		const Polygons::VertexCountArray& vertexCounts = ((const Polygons&)meshPrimitive).getGroupedVerticesVertexCountArray();
+		const UIntValuesArray& positionIndices = meshPrimitive.getPositionIndices();
+		const MeshVertexData& positions = mesh.getPositions();
+		size_t indexCount = positionIndices.getCount();
+
+		PolygonScratch scratch;
+		std::vector<double> loopPositions;
+
+		unsigned int first = 0;
+		size_t i = 0;
+		size_t count = vertexCounts.getCount();
+		while ( i < count )
+		{
+			int vertexCount = vertexCounts[i++];
+			if ( vertexCount <= 0 )
+			{
+				// hole without polygon
+				first += (unsigned int)(-vertexCount);
+				continue;
+			}
+
+			// the holes of the polygon follow the polygon
+			size_t firstHole = i;
+			unsigned int polygonIndexCount = (unsigned int)vertexCount;
+			while ( i < count && vertexCounts[i] < 0 )
+			{
+				polygonIndexCount += (unsigned int)(-vertexCounts[i]);
+				++i;
+			}
+			size_t holeCount = i - firstHole;
+
+			if ( first + polygonIndexCount > indexCount )
+				break;
+
+			bool triangulated = false;
+			if ( vertexCount > 3 && mPolygonMode == POLYGON_MODE_EAR_CLIPPING )
+			{
+				triangulated = triangulatePolygon( positions, positionIndices, first, (unsigned int)vertexCount,
+					holeCount > 0 ? &vertexCounts[firstHole] : 0, holeCount, scratch, loopPositions, corners );
+			}
+			if ( !triangulated )
+			{
+				appendFan( first, (unsigned int)vertexCount, corners );
+			}
+
+			first += polygonIndexCount;
+		}
+	}
+
+	//------------------------------
+	size_t MeshTriangulator::getMaxTriangleCount( const MeshPrimitive& meshPrimitive )
+	{
+		switch ( meshPrimitive.getPrimitiveType() )
+		{
+		case MeshPrimitive::TRIANGLES:
+			return meshPrimitive.getPositionIndices().getCount() / 3;
+		case MeshPrimitive::TRIANGLE_FANS:
+		case MeshPrimitive::TRIANGLE_STRIPS:
+			{
+				const Trifans::VertexCountArray& vertexCounts = meshPrimitive.getPrimitiveType() == MeshPrimitive::TRIANGLE_FANS
+					? ((const Trifans&)meshPrimitive).getGroupedVerticesVertexCountArray()
+					: ((const Tristrips&)meshPrimitive).getGroupedVerticesVertexCountArray();
+				size_t triangleCount = 0;
+				for ( size_t i = 0, count = vertexCounts.getCount(); i < count; ++i )
+				{
+					if ( vertexCounts[i] > 2 )
+						triangleCount += vertexCounts[i] - 2;
+				}
+				return triangleCount;
+			}
+		case MeshPrimitive::POLYGONS:
+		case MeshPrimitive::POLYLIST:
+			{
+				// each hole adds two bridge edges, i.e. its vertex count plus two triangles
+				const Polygons::VertexCountArray& vertexCounts = ((const Polygons&)meshPrimitive).getGroupedVerticesVertexCountArray();
+				size_t triangleCount = 0;
+				for ( size_t i = 0, count = vertexCounts.getCount(); i < count; ++i )
+				{
+					int vertexCount = vertexCounts[i];
+					if ( vertexCount > 2 )
+						triangleCount += vertexCount - 2;
+					else if ( vertexCount < 0 )
+						triangleCount += 2 - vertexCount;
+				}
+				return triangleCount;
+			}
+		default:
+			return 0;
+		}
+	}
+
+	//------------------------------
+	Triangles* MeshTriangulator::createTriangles( const MeshPrimitive& meshPrimitive, const unsigned int* corners, size_t cornerCount )
+	{
+		Triangles* triangles = FW_NEW Triangles( meshPrimitive.getUniqueId() );
+		triangles->setMaterial( meshPrimitive.getMaterial() );
+		triangles->setMaterialId( meshPrimitive.getMaterialId() );
+		triangles->setFaceCount( cornerCount / 3 );
+
+		gatherIndices( meshPrimitive.getPositionIndices(), corners, cornerCount, triangles->getPositionIndices() );
+		if ( meshPrimitive.hasNormalIndices() )
+			gatherIndices( meshPrimitive.getNormalIndices(), corners, cornerCount, triangles->getNormalIndices() );
+		if ( meshPrimitive.hasTangentIndices() )
+			gatherIndices( meshPrimitive.getTangentIndices(), corners, cornerCount, triangles->getTangentIndices() );
+		if ( meshPrimitive.hasBinormalIndices() )
+			gatherIndices( meshPrimitive.getBinormalIndices(), corners, cornerCount, triangles->getBinormalIndices() );
+		gatherIndexLists( meshPrimitive.getUVCoordIndicesArray(), corners, cornerCount, triangles->getUVCoordIndicesArray() );
+		gatherIndexLists( meshPrimitive.getColorIndicesArray(), corners, cornerCount, triangles->getColorIndicesArray() );
+
+		return triangles;
+	}
+
+} // namespace COLLADAFW
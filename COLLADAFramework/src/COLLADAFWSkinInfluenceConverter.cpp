@@ -0,0 +1,251 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWSkinInfluenceConverter.h"
+#include "COLLADAFWSkinControllerData.h"
+
+#include <algorithm>
+#include <vector>
+
+
+namespace COLLADAFW
+{
+
+	const size_t SkinInfluenceConverter::MAX_INFLUENCE_COUNT;
+	const size_t SkinInfluenceConverter::DEFAULT_INFLUENCE_COUNT;
+
+	namespace
+	{
+		/** The number of vertices converted by one task.*/
+		const size_t VERTICES_PER_BLOCK = 4096;
+
+		/** The largest joint index that can be stored.*/
+		const size_t MAX_JOINT_INDEX = 0xFFFF;
+
+		/** Quantizes the @a count normalized @a weights, sorted descending, to integers that sum up to
+		@a maxValue and writes them to @a quantizedWeights.*/
+		template<class QuantizedType>
+		void quantize( const double* weights, size_t count, unsigned int maxValue, QuantizedType* quantizedWeights, size_t stride )
+		{
+			unsigned int values[SkinInfluenceConverter::MAX_INFLUENCE_COUNT];
+			unsigned int sum = 0;
+			for ( size_t i = 0; i < count; ++i )
+			{
+				values[i] = (unsigned int)(weights[i] * maxValue + 0.5);
+				sum += values[i];
+			}
+
+			// the rounding error goes to the largest weight, which is large enough to absorb it
+			if ( sum > 0 )
+				values[0] += maxValue - sum;
+
+			for ( size_t i = 0; i < count; ++i )
+				quantizedWeights[i * stride] = (QuantizedType)values[i];
+		}
+	}
+
+	//------------------------------
+	SkinInfluenceConverter::SkinInfluenceConverter()
+		: mInfluenceCount( DEFAULT_INFLUENCE_COUNT )
+		, mWeightFormat( WEIGHT_FORMAT_FLOAT )
+		, mLayout( LAYOUT_STRUCTURE_OF_ARRAYS )
+		, mNormalize( true )
+		, mParallel( false )
+	{
+	}
+
+	//------------------------------
+	SkinInfluenceConverter::~SkinInfluenceConverter()
+	{
+	}
+
+	//------------------------------
+	void SkinInfluenceConverter::setInfluenceCount( size_t influenceCount )
+	{
+		if ( influenceCount < 1 )
+			influenceCount = 1;
+		else if ( influenceCount > MAX_INFLUENCE_COUNT )
+			influenceCount = MAX_INFLUENCE_COUNT;
+		mInfluenceCount = influenceCount;
+	}
+
+	//------------------------------
+	size_t SkinInfluenceConverter::getWeightSize() const
+	{
+		switch ( mWeightFormat )
+		{
+		case WEIGHT_FORMAT_UNORM16:
+			return sizeof(unsigned short);
+		case WEIGHT_FORMAT_UNORM8:
+			return sizeof(unsigned char);
+		default:
+			return sizeof(float);
+		}
+	}
+
+	//------------------------------
+	size_t SkinInfluenceConverter::getMaxInfluenceCount( const SkinControllerData& skinControllerData )
+	{
+		const UIntValuesArray& jointsPerVertex = skinControllerData.getJointsPerVertex();
+		size_t maxInfluenceCount = 0;
+		for ( size_t i = 0, count = jointsPerVertex.getCount(); i < count; ++i )
+		{
+			if ( jointsPerVertex[i] > maxInfluenceCount )
+				maxInfluenceCount = jointsPerVertex[i];
+		}
+		return maxInfluenceCount;
+	}
+
+	//------------------------------
+	template<class WeightType>
+	void SkinInfluenceConverter::convertVertices( const SkinControllerData& skinControllerData,
+												  const WeightType* sourceWeights,
+												  size_t sourceWeightCount,
+												  size_t firstVertex,
+												  size_t lastVertex,
+												  size_t firstPair,
+												  unsigned short* jointIndices,
+												  void* weights ) const
+	{
+		const UIntValuesArray& jointsPerVertex = skinControllerData.getJointsPerVertex();
+		const UIntValuesArray& weightIndices = skinControllerData.getWeightIndices();
+		const IntValuesArray& sourceJointIndices = skinControllerData.getJointIndices();
+		size_t pairCount = std::min( weightIndices.getCount(), sourceJointIndices.getCount() );
+		size_t vertexCount = jointsPerVertex.getCount();
+		size_t influenceCount = mInfluenceCount;
+		size_t stride = mLayout == LAYOUT_STRUCTURE_OF_ARRAYS ? vertexCount : 1;
+
+		double selectedWeights[MAX_INFLUENCE_COUNT];
+		unsigned short selectedJoints[MAX_INFLUENCE_COUNT];
+
+		size_t pair = firstPair;
+		for ( size_t vertex = firstVertex; vertex < lastVertex; ++vertex )
+		{
+			// keep the influenceCount largest weights, sorted descending
+			size_t selectedCount = 0;
+			for ( size_t lastPair = pair + jointsPerVertex[vertex]; pair < lastPair; ++pair )
+			{
+				if ( pair >= pairCount )
+					continue;
+				int joint = sourceJointIndices[pair];
+				unsigned int weightIndex = weightIndices[pair];
+				if ( (joint < 0) || ((size_t)joint > MAX_JOINT_INDEX) || (weightIndex >= sourceWeightCount) )
+					continue;
+				double weight = sourceWeights[weightIndex];
+				if ( weight <= 0 )
+					continue;
+				if ( selectedCount == influenceCount )
+				{
+					if ( weight <= selectedWeights[influenceCount - 1] )
+						continue;
+					--selectedCount;
+				}
+
+				size_t position = selectedCount;
+				for ( ; (position > 0) && (selectedWeights[position - 1] < weight); --position )
+				{
+					selectedWeights[position] = selectedWeights[position - 1];
+					selectedJoints[position] = selectedJoints[position - 1];
+				}
+				selectedWeights[position] = weight;
+				selectedJoints[position] = (unsigned short)joint;
+				++selectedCount;
+			}
+
+			for ( size_t i = selectedCount; i < influenceCount; ++i )
+			{
+				selectedWeights[i] = 0;
+				selectedJoints[i] = 0;
+			}
+
+			if ( mNormalize || (mWeightFormat != WEIGHT_FORMAT_FLOAT) )
+			{
+				double sum = 0;
+				for ( size_t i = 0; i < influenceCount; ++i )
+					sum += selectedWeights[i];
+				if ( sum > 0 )
+				{
+					double scale = 1 / sum;
+					for ( size_t i = 0; i < influenceCount; ++i )
+						selectedWeights[i] *= scale;
+				}
+			}
+
+			size_t first = mLayout == LAYOUT_STRUCTURE_OF_ARRAYS ? vertex : vertex * influenceCount;
+			for ( size_t i = 0; i < influenceCount; ++i )
+				jointIndices[first + i * stride] = selectedJoints[i];
+
+			switch ( mWeightFormat )
+			{
+			case WEIGHT_FORMAT_UNORM16:
+				quantize( selectedWeights, influenceCount, 0xFFFF, (unsigned short*)weights + first, stride );
+				break;
+			case WEIGHT_FORMAT_UNORM8:
+				quantize( selectedWeights, influenceCount, 0xFF, (unsigned char*)weights + first, stride );
+				break;
+			default:
+				{
+					float* floatWeights = (float*)weights + first;
+					for ( size_t i = 0; i < influenceCount; ++i )
+						floatWeights[i * stride] = (float)selectedWeights[i];
+					break;
+				}
+			}
+		}
+	}
+
+	//------------------------------
+	bool SkinInfluenceConverter::convert( const SkinControllerData& skinControllerData, unsigned short* jointIndices, void* weights ) const
+	{
+		if ( skinControllerData.getJointsCount() > MAX_JOINT_INDEX + 1 )
+			return false;
+
+		const UIntValuesArray& jointsPerVertex = skinControllerData.getJointsPerVertex();
+		size_t vertexCount = jointsPerVertex.getCount();
+		if ( vertexCount == 0 )
+			return true;
+
+		// the influences of each block start after those of all previous blocks
+		size_t blockCount = (vertexCount + VERTICES_PER_BLOCK - 1) / VERTICES_PER_BLOCK;
+		std::vector<size_t> blockFirstPairs( blockCount );
+		size_t pair = 0;
+		for ( size_t vertex = 0; vertex < vertexCount; ++vertex )
+		{
+			if ( vertex % VERTICES_PER_BLOCK == 0 )
+				blockFirstPairs[vertex / VERTICES_PER_BLOCK] = pair;
+			pair += jointsPerVertex[vertex];
+		}
+
+		const FloatOrDoubleArray& sourceWeights = skinControllerData.getWeights();
+		const FloatArray* floatWeights = sourceWeights.getType() == FloatOrDoubleArray::DATA_TYPE_FLOAT ? sourceWeights.getFloatValues() : 0;
+		const DoubleArray* doubleWeights = sourceWeights.getType() == FloatOrDoubleArray::DATA_TYPE_DOUBLE ? sourceWeights.getDoubleValues() : 0;
+
+		int blocks = (int)blockCount;
+#pragma omp parallel for schedule(dynamic) if(mParallel)
+		for ( int block = 0; block < blocks; ++block )
+		{
+			size_t firstVertex = block * VERTICES_PER_BLOCK;
+			size_t lastVertex = std::min( firstVertex + VERTICES_PER_BLOCK, vertexCount );
+			if ( doubleWeights )
+			{
+				convertVertices( skinControllerData, doubleWeights->getData(), doubleWeights->getCount(), firstVertex, lastVertex, blockFirstPairs[block], jointIndices, weights );
+			}
+			else
+			{
+				const float* floatData = floatWeights ? floatWeights->getData() : 0;
+				size_t floatCount = floatWeights ? floatWeights->getCount() : 0;
+				convertVertices( skinControllerData, floatData, floatCount, firstVertex, lastVertex, blockFirstPairs[block], jointIndices, weights );
+			}
+		}
+		return true;
+	}
+
+} // namespace COLLADAFW
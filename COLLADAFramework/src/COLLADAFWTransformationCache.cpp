@@ -0,0 +1,334 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWTransformationCache.h"
+
+#include "COLLADAFWVisualScene.h"
+#include "COLLADAFWLibraryNodes.h"
+#include "COLLADAFWInstanceNode.h"
+#include "COLLADAFWRotate.h"
+#include "COLLADAFWTranslate.h"
+#include "COLLADAFWScale.h"
+#include "COLLADAFWMatrix.h"
+
+#include "Math/COLLADABUMathUtils.h"
+
+#include <math.h>
+#include <string.h>
+
+
+namespace COLLADAFW
+{
+
+	const size_t TransformationCache::INVALID_ENTRY = (size_t)-1;
+
+	namespace
+	{
+		const double IDENTITY[16] = { 1, 0, 0, 0,
+									  0, 1, 0, 0,
+									  0, 0, 1, 0,
+									  0, 0, 0, 1 };
+
+		/** Number of entries of one depth, from which on their matrices are calculated in parallel.*/
+		const int MIN_PARALLEL_ENTRY_COUNT = 256;
+
+		/** @a result = @a a * @a b, row major. @a result must not be @a a or @a b. Each row of the result
+		is a linear combination of the rows of @a b, which the compiler can vectorize.*/
+		inline void multiplyMatrices( const double* a, const double* b, double* result )
+		{
+			for ( int i = 0; i < 4; ++i )
+			{
+				const double a0 = a[4 * i];
+				const double a1 = a[4 * i + 1];
+				const double a2 = a[4 * i + 2];
+				const double a3 = a[4 * i + 3];
+				double* row = result + 4 * i;
+				for ( int j = 0; j < 4; ++j )
+					row[j] = a0 * b[j] + a1 * b[4 + j] + a2 * b[8 + j] + a3 * b[12 + j];
+			}
+		}
+
+		/** @a matrix = @a matrix * translation matrix of @a translation.*/
+		inline void translate( double* matrix, const COLLADABU::Math::Vector3& translation )
+		{
+			for ( int i = 0; i < 4; ++i )
+			{
+				double* row = matrix + 4 * i;
+				row[3] += row[0] * translation.x + row[1] * translation.y + row[2] * translation.z;
+			}
+		}
+
+		/** @a matrix = @a matrix * scale matrix of @a scale.*/
+		inline void scale( double* matrix, const COLLADABU::Math::Vector3& scale )
+		{
+			for ( int i = 0; i < 4; ++i )
+			{
+				double* row = matrix + 4 * i;
+				row[0] *= scale.x;
+				row[1] *= scale.y;
+				row[2] *= scale.z;
+			}
+		}
+
+		/** @a matrix = @a matrix * rotation matrix of @a angle degrees around @a axis.*/
+		inline void rotate( double* matrix, const COLLADABU::Math::Vector3& axis, double angle )
+		{
+			COLLADABU::Math::Vector3 normalizedAxis = axis;
+			normalizedAxis.normalise();
+			double radians = COLLADABU::Math::Utils::degToRad( angle );
+			double c = cos( radians );
+			double s = sin( radians );
+			double t = 1 - c;
+			double x = normalizedAxis.x;
+			double y = normalizedAxis.y;
+			double z = normalizedAxis.z;
+
+			const double rotation[9] = { t * x * x + c,     t * x * y - s * z, t * x * z + s * y,
+										 t * x * y + s * z, t * y * y + c,     t * y * z - s * x,
+										 t * x * z - s * y, t * y * z + s * x, t * z * z + c };
+
+			for ( int i = 0; i < 4; ++i )
+			{
+				double* row = matrix + 4 * i;
+				const double r0 = row[0];
+				const double r1 = row[1];
+				const double r2 = row[2];
+				for ( int j = 0; j < 3; ++j )
+					row[j] = r0 * rotation[j] + r1 * rotation[3 + j] + r2 * rotation[6 + j];
+			}
+		}
+
+		/** @a matrix = @a matrix * @a other.*/
+		inline void multiply( double* matrix, const COLLADABU::Math::Matrix4& other )
+		{
+			double otherValues[16];
+			for ( int i = 0; i < 4; ++i )
+				for ( int j = 0; j < 4; ++j )
+					otherValues[4 * i + j] = other[i][j];
+
+			double result[16];
+			multiplyMatrices( matrix, otherValues, result );
+			memcpy( matrix, result, sizeof(result) );
+		}
+
+		/** Copies the 16 values in @a values to @a matrix.*/
+		void toMatrix4( const double* values, COLLADABU::Math::Matrix4& matrix )
+		{
+			matrix.setAllElements( values[0],  values[1],  values[2],  values[3],
+								   values[4],  values[5],  values[6],  values[7],
+								   values[8],  values[9],  values[10], values[11],
+								   values[12], values[13], values[14], values[15] );
+		}
+	}
+
+	//------------------------------
+	TransformationCache::TransformationCache()
+		: mParallel( false )
+	{
+	}
+
+	//------------------------------
+	TransformationCache::~TransformationCache()
+	{
+	}
+
+	//------------------------------
+	void TransformationCache::addLibraryNodes( const LibraryNodes& libraryNodes )
+	{
+		addNodes( libraryNodes.getNodes() );
+	}
+
+	//------------------------------
+	void TransformationCache::addNodes( const NodePointerArray& nodes )
+	{
+		for ( size_t i = 0, count = nodes.getCount(); i < count; ++i )
+		{
+			const Node* node = nodes[i];
+			mUniqueIdNodeMap[node->getUniqueId()] = node;
+			addNodes( node->getChildNodes() );
+		}
+	}
+
+	//------------------------------
+	void TransformationCache::build( const VisualScene& visualScene )
+	{
+		mEntries.clear();
+		mUniqueIdFirstEntryMap.clear();
+		mUniqueIdLastEntryMap.clear();
+		mDepthEntries.clear();
+
+		const NodePointerArray& rootNodes = visualScene.getRootNodes();
+		addNodes( rootNodes );
+		for ( size_t i = 0, count = rootNodes.getCount(); i < count; ++i )
+		{
+			addEntry( rootNodes[i], INVALID_ENTRY, 0 );
+		}
+
+		mLocalMatrices.resize( 16 * mEntries.size() );
+		mWorldMatrices.resize( 16 * mEntries.size() );
+		update();
+	}
+
+	//------------------------------
+	void TransformationCache::addEntry( const Node* node, size_t parent, size_t depth )
+	{
+		size_t entryIndex = mEntries.size();
+		Entry entry;
+		entry.mNode = node;
+		entry.mParent = parent;
+		entry.mNextOccurrence = INVALID_ENTRY;
+		mEntries.push_back( entry );
+
+		const UniqueId& uniqueId = node->getUniqueId();
+		UniqueIdEntryMap::iterator lastIt = mUniqueIdLastEntryMap.find( uniqueId );
+		if ( lastIt == mUniqueIdLastEntryMap.end() )
+		{
+			mUniqueIdFirstEntryMap[uniqueId] = entryIndex;
+			mUniqueIdLastEntryMap[uniqueId] = entryIndex;
+		}
+		else
+		{
+			mEntries[lastIt->second].mNextOccurrence = entryIndex;
+			lastIt->second = entryIndex;
+		}
+
+		if ( mDepthEntries.size() <= depth )
+			mDepthEntries.resize( depth + 1 );
+		mDepthEntries[depth].push_back( entryIndex );
+
+		const NodePointerArray& childNodes = node->getChildNodes();
+		for ( size_t i = 0, count = childNodes.getCount(); i < count; ++i )
+		{
+			addEntry( childNodes[i], entryIndex, depth + 1 );
+		}
+
+		const InstanceNodePointerArray& instanceNodes = node->getInstanceNodes();
+		for ( size_t i = 0, count = instanceNodes.getCount(); i < count; ++i )
+		{
+			UniqueIdNodeMap::const_iterator it = mUniqueIdNodeMap.find( instanceNodes[i]->getInstanciatedObjectId() );
+			if ( it == mUniqueIdNodeMap.end() )
+				continue;
+
+			// a node that instantiates itself or one of its ancestors would never end
+			const Node* instantiatedNode = it->second;
+			if ( isOnPath( instantiatedNode, entryIndex ) )
+				continue;
+
+			addEntry( instantiatedNode, entryIndex, depth + 1 );
+		}
+	}
+
+	//------------------------------
+	bool TransformationCache::isOnPath( const Node* node, size_t entry ) const
+	{
+		for ( ; entry != INVALID_ENTRY; entry = mEntries[entry].mParent )
+		{
+			if ( mEntries[entry].mNode == node )
+				return true;
+		}
+		return false;
+	}
+
+	//------------------------------
+	void TransformationCache::update()
+	{
+		int entryCount = (int)mEntries.size();
+#pragma omp parallel for if(mParallel && entryCount >= MIN_PARALLEL_ENTRY_COUNT)
+		for ( int i = 0; i < entryCount; ++i )
+		{
+			calculateLocalMatrix( *mEntries[i].mNode, &mLocalMatrices[16 * i] );
+		}
+
+		// the parents of all entries of one depth have been calculated with the previous depth
+		for ( size_t depth = 0, depthCount = mDepthEntries.size(); depth < depthCount; ++depth )
+		{
+			const std::vector<size_t>& depthEntries = mDepthEntries[depth];
+			int depthEntryCount = (int)depthEntries.size();
+#pragma omp parallel for if(mParallel && depthEntryCount >= MIN_PARALLEL_ENTRY_COUNT)
+			for ( int i = 0; i < depthEntryCount; ++i )
+			{
+				size_t entry = depthEntries[i];
+				size_t parent = mEntries[entry].mParent;
+				if ( parent == INVALID_ENTRY )
+					memcpy( &mWorldMatrices[16 * entry], &mLocalMatrices[16 * entry], 16 * sizeof(double) );
+				else
+					multiplyMatrices( &mWorldMatrices[16 * parent], &mLocalMatrices[16 * entry], &mWorldMatrices[16 * entry] );
+			}
+		}
+	}
+
+	//------------------------------
+	void TransformationCache::clear()
+	{
+		mUniqueIdNodeMap.clear();
+		mEntries.clear();
+		mUniqueIdFirstEntryMap.clear();
+		mUniqueIdLastEntryMap.clear();
+		mDepthEntries.clear();
+		mLocalMatrices.clear();
+		mWorldMatrices.clear();
+	}
+
+	//------------------------------
+	size_t TransformationCache::findEntry( const UniqueId& nodeUniqueId ) const
+	{
+		UniqueIdEntryMap::const_iterator it = mUniqueIdFirstEntryMap.find( nodeUniqueId );
+		if ( it == mUniqueIdFirstEntryMap.end() )
+			return INVALID_ENTRY;
+		return it->second;
+	}
+
+	//------------------------------
+	void TransformationCache::getLocalMatrix( size_t entry, COLLADABU::Math::Matrix4& localMatrix ) const
+	{
+		toMatrix4( getLocalMatrix( entry ), localMatrix );
+	}
+
+	//------------------------------
+	void TransformationCache::getWorldMatrix( size_t entry, COLLADABU::Math::Matrix4& worldMatrix ) const
+	{
+		toMatrix4( getWorldMatrix( entry ), worldMatrix );
+	}
+
+	//------------------------------
+	void TransformationCache::calculateLocalMatrix( const Node& node, double* matrix )
+	{
+		memcpy( matrix, IDENTITY, sizeof(IDENTITY) );
+
+		const TransformationPointerArray& transformations = node.getTransformations();
+		for ( size_t i = 0, count = transformations.getCount(); i < count; ++i )
+		{
+			const Transformation* transformation = transformations[i];
+			switch ( transformation->getTransformationType() )
+			{
+			case Transformation::ROTATE:
+				{
+					const Rotate* rotation = (const Rotate*)transformation;
+					rotate( matrix, rotation->getRotationAxis(), rotation->getRotationAngle() );
+					break;
+				}
+			case Transformation::TRANSLATE:
+				translate( matrix, ((const Translate*)transformation)->getTranslation() );
+				break;
+			case Transformation::SCALE:
+				scale( matrix, ((const Scale*)transformation)->getScale() );
+				break;
+			case Transformation::MATRIX:
+				multiply( matrix, ((const Matrix*)transformation)->getMatrix() );
+				break;
+			case Transformation::LOOKAT:
+			case Transformation::SKEW:
+				break;
+			}
+		}
+	}
+
+} // namespace COLLADAFW
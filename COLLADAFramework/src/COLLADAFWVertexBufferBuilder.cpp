@@ -0,0 +1,368 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWVertexBufferBuilder.h"
+
+#include "COLLADAFWMesh.h"
+#include "COLLADAFWMeshPrimitive.h"
+#include "COLLADAFWMeshTriangulator.h"
+
+#include <map>
+#include <string.h>
+
+
+namespace COLLADAFW
+{
+
+	namespace
+	{
+		/** Index used in the index tuples for attributes a corner does not have.*/
+		const unsigned int INVALID_INDEX = 0xFFFFFFFF;
+
+		/** Welds index tuples of fixed size into vertices. Each distinct tuple gets the next vertex index.*/
+		class IndexTupleWelder
+		{
+		private:
+			/** The number of indices per tuple.*/
+			size_t mTupleSize;
+
+			/** All distinct tuples, mTupleSize indices each, in the order they have been added.*/
+			std::vector<unsigned int> mTuples;
+
+			/** Open addressing hash table, containing vertex indices or INVALID_INDEX for empty slots.*/
+			std::vector<unsigned int> mTable;
+
+			/** The size of mTable minus one. The size is always a power of two.*/
+			size_t mMask;
+
+		public:
+			/** Creates a welder for at most @a maxTupleCount tuples, @a tupleSize indices each.*/
+			IndexTupleWelder( size_t tupleSize, size_t maxTupleCount )
+				: mTupleSize( tupleSize )
+			{
+				// keep the load factor below 0.5
+				size_t tableSize = 16;
+				while ( tableSize < 2 * maxTupleCount )
+				{
+					tableSize <<= 1;
+				}
+				mTable.assign( tableSize, INVALID_INDEX );
+				mMask = tableSize - 1;
+				mTuples.reserve( tupleSize * maxTupleCount );
+			}
+
+			/** The number of distinct tuples welded so far.*/
+			size_t getTupleCount() const { return mTuples.size() / mTupleSize; }
+
+			/** Returns the vertex index of @a tuple. @a isNew is set to true, if @a tuple has not been welded before.*/
+			unsigned int weld( const unsigned int* tuple, bool& isNew )
+			{
+				size_t slot = hash( tuple ) & mMask;
+				for ( ;; )
+				{
+					unsigned int vertexIndex = mTable[slot];
+					if ( vertexIndex == INVALID_INDEX )
+					{
+						vertexIndex = (unsigned int)(mTuples.size() / mTupleSize);
+						mTuples.insert( mTuples.end(), tuple, tuple + mTupleSize );
+						mTable[slot] = vertexIndex;
+						isNew = true;
+						return vertexIndex;
+					}
+					if ( memcmp( &mTuples[vertexIndex * mTupleSize], tuple, mTupleSize * sizeof(unsigned int) ) == 0 )
+					{
+						isNew = false;
+						return vertexIndex;
+					}
+					slot = (slot + 1) & mMask;
+				}
+			}
+
+		private:
+			size_t hash( const unsigned int* tuple ) const
+			{
+				unsigned int h = 2166136261u;
+				for ( size_t i = 0; i < mTupleSize; ++i )
+				{
+					h ^= tuple[i];
+					h *= 0x85EBCA6Bu;
+					h ^= h >> 13;
+				}
+				return h;
+			}
+		};
+
+		/** Copies the @a dimension values starting at value @a index * @a dimension of @a data to @a target.
+		Values not available in @a data are set to 0.*/
+		void copyValues( const MeshVertexData& data, unsigned int index, size_t dimension, float* target )
+		{
+			size_t first = (size_t)index * dimension;
+			if ( index == INVALID_INDEX || first + dimension > data.getValuesCount() )
+			{
+				for ( size_t i = 0; i < dimension; ++i )
+					target[i] = 0;
+				return;
+			}
+
+			if ( data.getType() == MeshVertexData::DATA_TYPE_DOUBLE )
+			{
+				const double* values = data.getDoubleValues()->getData() + first;
+				for ( size_t i = 0; i < dimension; ++i )
+					target[i] = (float)values[i];
+			}
+			else
+			{
+				const float* values = data.getFloatValues()->getData() + first;
+				for ( size_t i = 0; i < dimension; ++i )
+					target[i] = values[i];
+			}
+		}
+
+		/** Appends the layouts of the index lists in @a indexLists to @a setLayouts, that are not already in there.*/
+		void mergeSetLayouts( const IndexListArray& indexLists, VertexBufferBuilder::SetLayoutList& setLayouts )
+		{
+			for ( size_t i = setLayouts.size(), count = indexLists.getCount(); i < count; ++i )
+			{
+				VertexBufferBuilder::SetLayout setLayout;
+				setLayout.mOffset = VertexBufferBuilder::NO_OFFSET;
+				setLayout.mDimension = indexLists[i]->getStride();
+				if ( setLayout.mDimension == 0 )
+				{
+					setLayout.mDimension = 2;
+				}
+				setLayouts.push_back( setLayout );
+			}
+		}
+
+		/** Assigns offsets to the set layouts in @a setLayouts, starting at @a vertexStride.*/
+		void assignSetOffsets( VertexBufferBuilder::SetLayoutList& setLayouts, size_t& vertexStride )
+		{
+			for ( size_t i = 0, count = setLayouts.size(); i < count; ++i )
+			{
+				setLayouts[i].mOffset = (int)vertexStride;
+				vertexStride += setLayouts[i].mDimension;
+			}
+		}
+
+		/** Assigns the offset of an attribute with @a dimension floats, if @a hasAttribute is true.*/
+		int assignOffset( bool hasAttribute, size_t dimension, size_t& vertexStride )
+		{
+			if ( !hasAttribute )
+				return VertexBufferBuilder::NO_OFFSET;
+			int offset = (int)vertexStride;
+			vertexStride += dimension;
+			return offset;
+		}
+	}
+
+	//------------------------------
+	VertexBufferBuilder::VertexBufferBuilder()
+		: mAttributes( ATTRIBUTE_ALL )
+		, mParallel( false )
+		, mAllow16BitIndices( true )
+	{
+	}
+
+	//------------------------------
+	VertexBufferBuilder::~VertexBufferBuilder()
+	{
+	}
+
+	//------------------------------
+	void VertexBufferBuilder::build( const Mesh& mesh, SubMeshList& subMeshes ) const
+	{
+		typedef std::map<MaterialId, size_t> MaterialIdGroupIndexMap;
+		typedef std::vector<const MeshPrimitive*> MeshPrimitiveList;
+
+		// group the primitives by material id, in the order the material ids first appear
+		MaterialIdGroupIndexMap groupIndices;
+		std::vector<MeshPrimitiveList> groups;
+		const MeshPrimitiveArray& meshPrimitives = mesh.getMeshPrimitives();
+		for ( size_t i = 0, count = meshPrimitives.getCount(); i < count; ++i )
+		{
+			const MeshPrimitive* meshPrimitive = meshPrimitives[i];
+			MaterialId materialId = meshPrimitive->getMaterialId();
+			MaterialIdGroupIndexMap::const_iterator it = groupIndices.find( materialId );
+			if ( it == groupIndices.end() )
+			{
+				groupIndices.insert( std::make_pair( materialId, groups.size() ) );
+				groups.push_back( MeshPrimitiveList( 1, meshPrimitive ) );
+			}
+			else
+			{
+				groups[it->second].push_back( meshPrimitive );
+			}
+		}
+
+		size_t firstSubMesh = subMeshes.size();
+		subMeshes.resize( firstSubMesh + groups.size() );
+
+		// the groups do not share any data but the read only mesh
+		int groupCount = (int)groups.size();
+#pragma omp parallel for schedule(dynamic) if(mParallel)
+		for ( int i = 0; i < groupCount; ++i )
+		{
+			buildSubMesh( mesh, groups[i], subMeshes[firstSubMesh + i] );
+		}
+	}
+
+	//------------------------------
+	void VertexBufferBuilder::buildSubMesh( const Mesh& mesh, const std::vector<const MeshPrimitive*>& primitives, SubMesh& subMesh ) const
+	{
+		subMesh.mMaterialId = primitives.front()->getMaterialId();
+
+		// determine the layout as the union of the attributes of all primitives
+		bool hasNormals = false;
+		bool hasTangents = false;
+		bool hasBinormals = false;
+		subMesh.mUVSets.clear();
+		subMesh.mColorSets.clear();
+		for ( size_t i = 0, count = primitives.size(); i < count; ++i )
+		{
+			const MeshPrimitive* primitive = primitives[i];
+			hasNormals |= primitive->hasNormalIndices();
+			hasTangents |= primitive->hasTangentIndices();
+			hasBinormals |= primitive->hasBinormalIndices();
+			if ( mAttributes & ATTRIBUTE_UV )
+				mergeSetLayouts( primitive->getUVCoordIndicesArray(), subMesh.mUVSets );
+			if ( mAttributes & ATTRIBUTE_COLOR )
+				mergeSetLayouts( primitive->getColorIndicesArray(), subMesh.mColorSets );
+		}
+		hasNormals &= (mAttributes & ATTRIBUTE_NORMAL) != 0;
+		hasTangents &= (mAttributes & ATTRIBUTE_TANGENT) != 0;
+		hasBinormals &= (mAttributes & ATTRIBUTE_BINORMAL) != 0;
+
+		size_t vertexStride = 0;
+		subMesh.mPositionOffset = assignOffset( (mAttributes & ATTRIBUTE_POSITION) != 0, 3, vertexStride );
+		subMesh.mNormalOffset = assignOffset( hasNormals, 3, vertexStride );
+		subMesh.mTangentOffset = assignOffset( hasTangents, 3, vertexStride );
+		subMesh.mBinormalOffset = assignOffset( hasBinormals, 3, vertexStride );
+		assignSetOffsets( subMesh.mUVSets, vertexStride );
+		assignSetOffsets( subMesh.mColorSets, vertexStride );
+		subMesh.mVertexStride = vertexStride;
+
+		// the position index is always part of the tuple, to keep distinct vertices apart
+		const size_t uvSetCount = subMesh.mUVSets.size();
+		const size_t colorSetCount = subMesh.mColorSets.size();
+		const size_t tupleSize = 1 + (hasNormals ? 1 : 0) + (hasTangents ? 1 : 0) + (hasBinormals ? 1 : 0) + uvSetCount + colorSetCount;
+
+		// collect the triangle corners of all primitives
+		MeshTriangulator triangulator;
+		std::vector<unsigned int> corners;
+		std::vector<size_t> primitiveCornerCounts( primitives.size() );
+		size_t maxTriangleCount = 0;
+		for ( size_t i = 0, count = primitives.size(); i < count; ++i )
+		{
+			maxTriangleCount += MeshTriangulator::getMaxTriangleCount( *primitives[i] );
+		}
+		corners.reserve( 3 * maxTriangleCount );
+		for ( size_t i = 0, count = primitives.size(); i < count; ++i )
+		{
+			primitiveCornerCounts[i] = triangulator.triangulate( mesh, *primitives[i], corners );
+		}
+
+		IndexTupleWelder welder( tupleSize, corners.size() );
+		std::vector<unsigned int> indices;
+		indices.reserve( corners.size() );
+		subMesh.mVertices.clear();
+		subMesh.mVertices.reserve( corners.size() * vertexStride );
+
+		const MeshVertexData& positions = mesh.getPositions();
+		const MeshVertexData& normals = mesh.getNormals();
+		const MeshVertexData& tangents = mesh.getTangents();
+		const MeshVertexData& binormals = mesh.getBinormals();
+		const MeshVertexData& uvCoords = mesh.getUVCoords();
+		const MeshVertexData& colors = mesh.getColors();
+
+		std::vector<unsigned int> tuple( tupleSize );
+		size_t cornerIndex = 0;
+		for ( size_t i = 0, count = primitives.size(); i < count; ++i )
+		{
+			const MeshPrimitive* primitive = primitives[i];
+			const UIntValuesArray& positionIndices = primitive->getPositionIndices();
+			const UIntValuesArray* normalIndices = hasNormals && primitive->hasNormalIndices() ? &primitive->getNormalIndices() : 0;
+			const UIntValuesArray* tangentIndices = hasTangents && primitive->hasTangentIndices() ? &primitive->getTangentIndices() : 0;
+			const UIntValuesArray* binormalIndices = hasBinormals && primitive->hasBinormalIndices() ? &primitive->getBinormalIndices() : 0;
+			const IndexListArray& uvIndexLists = primitive->getUVCoordIndicesArray();
+			const IndexListArray& colorIndexLists = primitive->getColorIndicesArray();
+
+			for ( size_t cornerEnd = cornerIndex + primitiveCornerCounts[i]; cornerIndex < cornerEnd; ++cornerIndex )
+			{
+				unsigned int corner = corners[cornerIndex];
+
+				size_t slot = 0;
+				tuple[slot++] = positionIndices[corner];
+				if ( hasNormals )
+					tuple[slot++] = (normalIndices && corner < normalIndices->getCount()) ? (*normalIndices)[corner] : INVALID_INDEX;
+				if ( hasTangents )
+					tuple[slot++] = (tangentIndices && corner < tangentIndices->getCount()) ? (*tangentIndices)[corner] : INVALID_INDEX;
+				if ( hasBinormals )
+					tuple[slot++] = (binormalIndices && corner < binormalIndices->getCount()) ? (*binormalIndices)[corner] : INVALID_INDEX;
+				for ( size_t j = 0; j < uvSetCount; ++j )
+				{
+					const IndexList* indexList = j < uvIndexLists.getCount() ? uvIndexLists[j] : 0;
+					tuple[slot++] = (indexList && corner < indexList->getIndicesCount()) ? indexList->getIndex( corner ) : INVALID_INDEX;
+				}
+				for ( size_t j = 0; j < colorSetCount; ++j )
+				{
+					const IndexList* indexList = j < colorIndexLists.getCount() ? colorIndexLists[j] : 0;
+					tuple[slot++] = (indexList && corner < indexList->getIndicesCount()) ? indexList->getIndex( corner ) : INVALID_INDEX;
+				}
+
+				bool isNew = false;
+				unsigned int vertexIndex = welder.weld( &tuple[0], isNew );
+				indices.push_back( vertexIndex );
+
+				if ( !isNew )
+					continue;
+
+				size_t vertexStart = subMesh.mVertices.size();
+				subMesh.mVertices.resize( vertexStart + vertexStride );
+				float* vertex = &subMesh.mVertices[vertexStart];
+
+				slot = 1;
+				if ( subMesh.mPositionOffset != NO_OFFSET )
+					copyValues( positions, tuple[0], 3, vertex + subMesh.mPositionOffset );
+				if ( hasNormals )
+					copyValues( normals, tuple[slot++], 3, vertex + subMesh.mNormalOffset );
+				if ( hasTangents )
+					copyValues( tangents, tuple[slot++], 3, vertex + subMesh.mTangentOffset );
+				if ( hasBinormals )
+					copyValues( binormals, tuple[slot++], 3, vertex + subMesh.mBinormalOffset );
+				for ( size_t j = 0; j < uvSetCount; ++j )
+				{
+					const SetLayout& setLayout = subMesh.mUVSets[j];
+					copyValues( uvCoords, tuple[slot++], setLayout.mDimension, vertex + setLayout.mOffset );
+				}
+				for ( size_t j = 0; j < colorSetCount; ++j )
+				{
+					const SetLayout& setLayout = subMesh.mColorSets[j];
+					copyValues( colors, tuple[slot++], setLayout.mDimension, vertex + setLayout.mOffset );
+				}
+			}
+		}
+
+		subMesh.mVertexCount = welder.getTupleCount();
+
+		subMesh.mIndices16.clear();
+		subMesh.mIndices32.clear();
+		subMesh.mHas32BitIndices = !mAllow16BitIndices || (subMesh.mVertexCount > 0x10000);
+		if ( subMesh.mHas32BitIndices )
+		{
+			subMesh.mIndices32.swap( indices );
+		}
+		else
+		{
+			subMesh.mIndices16.assign( indices.begin(), indices.end() );
+		}
+	}
+
+} // namespace COLLADAFW
@@ -0,0 +1,244 @@
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWAnimationCurveEvaluator.h"
+#include "COLLADAFWAnimationCurve.h"
+
+#include <iostream>
+#include <cmath>
+
+
+// Evaluates curves of all interpolation types and compares the results with values calculated by hand.
+
+namespace
+{
+    int failures = 0;
+
+    void check( bool condition, const char* description )
+    {
+        if ( !condition )
+        {
+            std::cerr << "FAILED: " << description << std::endl;
+            ++failures;
+        }
+    }
+
+    bool equals( double value, double expected )
+    {
+        return std::fabs( value - expected ) < 1e-9;
+    }
+
+    void setValues( COLLADAFW::FloatOrDoubleArray& array, const double* values, size_t count )
+    {
+        array.setType( COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE );
+        array.getDoubleValues()->appendValues( values, count );
+    }
+
+    /** Sets the keys of @a curve to the @a keyCount inputs in @a inputs and the outputs in @a outputs.*/
+    void setKeys( COLLADAFW::AnimationCurve& curve, COLLADAFW::AnimationCurve::InterpolationType interpolationType,
+                  const double* inputs, const double* outputs, size_t keyCount, size_t outDimension )
+    {
+        curve.setInterpolationType( interpolationType );
+        curve.setOutDimension( outDimension );
+        setValues( curve.getInputValues(), inputs, keyCount );
+        setValues( curve.getOutputValues(), outputs, keyCount * outDimension );
+    }
+
+    /** Sets the tangents of @a curve, two values per key and dimension.*/
+    void setTangents( COLLADAFW::AnimationCurve& curve, const double* inTangents, const double* outTangents, size_t count )
+    {
+        setValues( curve.getInTangentValues(), inTangents, count );
+        setValues( curve.getOutTangentValues(), outTangents, count );
+    }
+
+    double evaluate( const COLLADAFW::AnimationCurveEvaluator& evaluator, size_t curve, double input )
+    {
+        double value = 0;
+        evaluator.evaluate( curve, input, &value );
+        return value;
+    }
+
+    void testLinear()
+    {
+        const double inputs[] = { 0, 2, 4 };
+        const double outputs[] = { 0, 10,  4, 20,  0, 10 };
+        COLLADAFW::AnimationCurve curve( COLLADAFW::UniqueId::INVALID );
+        setKeys( curve, COLLADAFW::AnimationCurve::INTERPOLATION_LINEAR, inputs, outputs, 3, 2 );
+
+        COLLADAFW::AnimationCurveEvaluator evaluator;
+        size_t index = evaluator.addAnimationCurve( curve );
+        check( index == 0 && evaluator.getCurveCount() == 1 && evaluator.getOutDimension( 0 ) == 2, "the curve is added" );
+
+        double values[2];
+        evaluator.evaluate( 0, 1, values );
+        check( equals( values[0], 2 ) && equals( values[1], 15 ), "LINEAR in the first segment" );
+        evaluator.evaluate( 0, 3.5, values );
+        check( equals( values[0], 1 ) && equals( values[1], 12.5 ), "LINEAR in the second segment" );
+        evaluator.evaluate( 0, -1, values );
+        check( equals( values[0], 0 ) && equals( values[1], 10 ), "LINEAR before the first key" );
+        evaluator.evaluate( 0, 5, values );
+        check( equals( values[0], 0 ) && equals( values[1], 10 ), "LINEAR after the last key" );
+    }
+
+    void testStep()
+    {
+        const double inputs[] = { 0, 1, 2 };
+        const double outputs[] = { 1, 5, 3 };
+        COLLADAFW::AnimationCurve curve( COLLADAFW::UniqueId::INVALID );
+        setKeys( curve, COLLADAFW::AnimationCurve::INTERPOLATION_STEP, inputs, outputs, 3, 1 );
+
+        COLLADAFW::AnimationCurveEvaluator evaluator;
+        evaluator.addAnimationCurve( curve );
+        check( equals( evaluate( evaluator, 0, 0.99 ), 1 ), "STEP keeps the value of the first key" );
+        check( equals( evaluate( evaluator, 0, 1 ), 5 ), "STEP changes at the key" );
+        check( equals( evaluate( evaluator, 0, 1.5 ), 5 ), "STEP keeps the value of the second key" );
+        check( equals( evaluate( evaluator, 0, 2 ), 3 ) && equals( evaluate( evaluator, 0, 7 ), 3 ), "STEP at and after the last key" );
+    }
+
+    void testBezier()
+    {
+        // control points (1,0) and (2,3) are evenly spaced in the input, i.e. the input is linear
+        const double inputs[] = { 0, 3 };
+        const double outputs[] = { 0, 3 };
+        const double outTangents[] = { 1, 0,  0, 0 };
+        const double inTangents[] = { 0, 0,  2, 3 };
+        COLLADAFW::AnimationCurve curve( COLLADAFW::UniqueId::INVALID );
+        setKeys( curve, COLLADAFW::AnimationCurve::INTERPOLATION_BEZIER, inputs, outputs, 2, 1 );
+        setTangents( curve, inTangents, outTangents, 4 );
+
+        // control points (2,0) and (2,3), the input has to be inverted
+        const double nonLinearOutTangents[] = { 2, 0,  0, 0 };
+        const double nonLinearInTangents[] = { 0, 0,  2, 3 };
+        COLLADAFW::AnimationCurve nonLinearCurve( COLLADAFW::UniqueId::INVALID );
+        setKeys( nonLinearCurve, COLLADAFW::AnimationCurve::INTERPOLATION_BEZIER, inputs, outputs, 2, 1 );
+        setTangents( nonLinearCurve, nonLinearInTangents, nonLinearOutTangents, 4 );
+
+        // bezier without tangents is linear
+        COLLADAFW::AnimationCurve curveWithoutTangents( COLLADAFW::UniqueId::INVALID );
+        setKeys( curveWithoutTangents, COLLADAFW::AnimationCurve::INTERPOLATION_BEZIER, inputs, outputs, 2, 1 );
+
+        COLLADAFW::AnimationCurveEvaluator evaluator;
+        evaluator.addAnimationCurve( curve );
+        evaluator.addAnimationCurve( nonLinearCurve );
+        evaluator.addAnimationCurve( curveWithoutTangents );
+
+        // v(s) = 9s^2 - 6s^3
+        check( equals( evaluate( evaluator, 0, 1.5 ), 1.5 ), "BEZIER in the middle" );
+        check( equals( evaluate( evaluator, 0, 1 ), 7.0 / 9.0 ), "BEZIER at a third" );
+        check( equals( evaluate( evaluator, 0, 3 ), 3 ), "BEZIER at the last key" );
+
+        // at t = 0.5 the input is 1.875 and the output 1.5
+        check( std::fabs( evaluate( evaluator, 1, 1.875 ) - 1.5 ) < 1e-6, "BEZIER with a non linear input" );
+
+        check( equals( evaluate( evaluator, 2, 1 ), 1 ), "BEZIER without tangents is evaluated linearly" );
+    }
+
+    void testHermite()
+    {
+        // slope 3 at the first key, 0 at the second one
+        const double inputs[] = { 0, 1 };
+        const double outputs[] = { 0, 1 };
+        const double outTangents[] = { 1, 3,  0, 0 };
+        const double inTangents[] = { 0, 0,  1, 0 };
+        COLLADAFW::AnimationCurve curve( COLLADAFW::UniqueId::INVALID );
+        setKeys( curve, COLLADAFW::AnimationCurve::INTERPOLATION_HERMITE, inputs, outputs, 2, 1 );
+        setTangents( curve, inTangents, outTangents, 4 );
+
+        COLLADAFW::AnimationCurveEvaluator evaluator;
+        evaluator.addAnimationCurve( curve );
+
+        // h(s) = h10(s) * 3 + h01(s)
+        check( equals( evaluate( evaluator, 0, 0.5 ), 0.875 ), "HERMITE in the middle" );
+        check( equals( evaluate( evaluator, 0, 0.25 ), 0.421875 + 0.15625 ), "HERMITE at a quarter" );
+    }
+
+    void testBSpline()
+    {
+        const double inputs[] = { 0, 1, 2, 3 };
+        const double outputs[] = { 0, 6, 0, 6 };
+        COLLADAFW::AnimationCurve curve( COLLADAFW::UniqueId::INVALID );
+        setKeys( curve, COLLADAFW::AnimationCurve::INTERPOLATION_BSPLINE, inputs, outputs, 4, 1 );
+
+        COLLADAFW::AnimationCurveEvaluator evaluator;
+        evaluator.addAnimationCurve( curve );
+
+        // uniform cubic b-spline with the control points 0, 6, 0, 6: (q0 + 4 q1 + q2) / 6 at the start of a
+        // segment and (q0 + 23 q1 + 23 q2 + q3) / 48 in the middle
+        check( equals( evaluate( evaluator, 0, 1 ), 4 ), "BSPLINE at the start of the second segment" );
+        check( equals( evaluate( evaluator, 0, 1.5 ), 3 ), "BSPLINE in the middle of the second segment" );
+
+        // the first key is repeated as control point before the first segment, the last one after the last segment
+        check( equals( evaluate( evaluator, 0, 0 ), 1 ), "BSPLINE at the first key" );
+        check( equals( evaluate( evaluator, 0, 0.5 ), 2.875 ), "BSPLINE in the middle of the first segment" );
+        check( equals( evaluate( evaluator, 0, 3 ), 5 ) && equals( evaluate( evaluator, 0, 4 ), 5 ), "BSPLINE at and after the last key" );
+    }
+
+    void testMixed()
+    {
+        const double inputs[] = { 0, 1, 2 };
+        const double outputs[] = { 0, 2, 6 };
+        COLLADAFW::AnimationCurve curve( COLLADAFW::UniqueId::INVALID );
+        setKeys( curve, COLLADAFW::AnimationCurve::INTERPOLATION_MIXED, inputs, outputs, 3, 1 );
+        curve.getInterpolationTypes().append( COLLADAFW::AnimationCurve::INTERPOLATION_STEP );
+        curve.getInterpolationTypes().append( COLLADAFW::AnimationCurve::INTERPOLATION_LINEAR );
+
+        COLLADAFW::AnimationCurveEvaluator evaluator;
+        evaluator.addAnimationCurve( curve );
+        check( equals( evaluate( evaluator, 0, 0.5 ), 0 ), "MIXED with a STEP segment" );
+        check( equals( evaluate( evaluator, 0, 1.5 ), 4 ), "MIXED with a LINEAR segment" );
+    }
+
+    void testEvaluateAll()
+    {
+        const double inputs[] = { 0, 1, 2, 3 };
+        const double firstOutputs[] = { 0, 1, 4, 9 };
+        const double secondOutputs[] = { 0, 0,  1, -1,  2, -2,  3, -3 };
+        COLLADAFW::AnimationCurve firstCurve( COLLADAFW::UniqueId::INVALID );
+        setKeys( firstCurve, COLLADAFW::AnimationCurve::INTERPOLATION_BSPLINE, inputs, firstOutputs, 4, 1 );
+        COLLADAFW::AnimationCurve secondCurve( COLLADAFW::UniqueId::INVALID );
+        setKeys( secondCurve, COLLADAFW::AnimationCurve::INTERPOLATION_LINEAR, inputs, secondOutputs, 4, 2 );
+
+        COLLADAFW::AnimationCurveEvaluator evaluator;
+        evaluator.addAnimationCurve( firstCurve );
+        evaluator.addAnimationCurve( secondCurve );
+        check( evaluator.getValueCount() == 3 && evaluator.getFirstValue( 1 ) == 1, "the values of all curves" );
+
+        // ascending and jumping back, to use both the linear and the binary segment search
+        const double times[] = { -1, 0.25, 0.5, 2.75, 2.9, 0.1, 3, 1.5 };
+        const size_t timeCount = sizeof(times) / sizeof(times[0]);
+        std::vector<double> values( evaluator.getValueCount() * timeCount );
+        evaluator.setParallel( true );
+        evaluator.evaluateAll( times, timeCount, &values[0] );
+
+        bool matches = true;
+        for ( size_t i = 0; i < timeCount; ++i )
+        {
+            double firstValue = evaluate( evaluator, 0, times[i] );
+            double secondValues[2];
+            evaluator.evaluate( 1, times[i], secondValues );
+            matches &= equals( values[i], firstValue );
+            matches &= equals( values[timeCount + 2 * i], secondValues[0] ) && equals( values[timeCount + 2 * i + 1], secondValues[1] );
+        }
+        check( matches, "evaluateAll gives the values of the single evaluations" );
+        check( equals( values[timeCount + 2 * 3], 2.75 ) && equals( values[timeCount + 2 * 3 + 1], -2.75 ), "the values of the second curve" );
+
+        evaluator.clear();
+        check( evaluator.getCurveCount() == 0 && evaluator.getValueCount() == 0, "clear removes all curves" );
+    }
+}
+
+
+int main()
+{
+    testLinear();
+    testStep();
+    testBezier();
+    testHermite();
+    testBSpline();
+    testMixed();
+    testEvaluateAll();
+
+    if ( failures > 0 )
+        return -1;
+
+    std::cout << "All AnimationCurveEvaluator tests passed" << std::endl;
+    return 0;
+}
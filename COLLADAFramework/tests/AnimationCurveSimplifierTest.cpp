@@ -0,0 +1,231 @@
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWAnimationCurveSimplifier.h"
+#include "COLLADAFWAnimationCurveEvaluator.h"
+#include "COLLADAFWAnimationCurve.h"
+
+#include <iostream>
+#include <cmath>
+
+
+// Simplifies sampled curves and checks, that keys have been removed and that the simplified curves still
+// reproduce all samples within the tolerance.
+
+namespace
+{
+    int failures = 0;
+
+    void check( bool condition, const char* description )
+    {
+        if ( !condition )
+        {
+            std::cerr << "FAILED: " << description << std::endl;
+            ++failures;
+        }
+    }
+
+    typedef double (*SampleFunction)( double input, size_t dimension );
+
+    /** Rises to 5 until input 2, falls to -1 until input 5 and stays there.*/
+    double polyline( double input, size_t dimension )
+    {
+        double value = input < 2 ? 2.5 * input : ( input < 5 ? 5 - 2 * (input - 2) : -1 );
+        return dimension == 0 ? value : 3 - value;
+    }
+
+    double smooth( double input, size_t dimension )
+    {
+        return dimension == 0 ? std::sin( input ) : 0.5 * std::cos( 2 * input );
+    }
+
+    /** Samples @a function every @a step from 0 to @a end.*/
+    void sample( COLLADAFW::AnimationCurve& curve, SampleFunction function, double end, double step, size_t outDimension,
+                 COLLADAFW::FloatOrDoubleArray::DataType dataType )
+    {
+        curve.setInterpolationType( COLLADAFW::AnimationCurve::INTERPOLATION_LINEAR );
+        curve.setOutDimension( outDimension );
+        curve.getInputValues().setType( dataType );
+        curve.getOutputValues().setType( dataType );
+        size_t keyCount = (size_t)(end / step + 0.5) + 1;
+        for ( size_t key = 0; key < keyCount; ++key )
+        {
+            double input = key * step;
+            if ( dataType == COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE )
+                curve.getInputValues().getDoubleValues()->append( input );
+            else
+                curve.getInputValues().getFloatValues()->append( (float)input );
+            for ( size_t dimension = 0; dimension < outDimension; ++dimension )
+            {
+                double output = function( input, dimension );
+                if ( dataType == COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE )
+                    curve.getOutputValues().getDoubleValues()->append( output );
+                else
+                    curve.getOutputValues().getFloatValues()->append( (float)output );
+            }
+        }
+    }
+
+    double getValue( const COLLADAFW::FloatOrDoubleArray& array, size_t index )
+    {
+        if ( array.getType() == COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE )
+            return (*array.getDoubleValues())[index];
+        return (*array.getFloatValues())[index];
+    }
+
+    /** The largest deviation of @a simplifiedCurve from the keys of @a originalCurve.*/
+    double calculateMaxDeviation( const COLLADAFW::AnimationCurve& originalCurve, const COLLADAFW::AnimationCurve& simplifiedCurve )
+    {
+        COLLADAFW::AnimationCurveEvaluator evaluator;
+        evaluator.addAnimationCurve( simplifiedCurve );
+        size_t outDimension = originalCurve.getOutDimension();
+        std::vector<double> values( outDimension );
+        double maxDeviation = 0;
+        for ( size_t key = 0, keyCount = originalCurve.getKeyCount(); key < keyCount; ++key )
+        {
+            evaluator.evaluate( 0, getValue( originalCurve.getInputValues(), key ), &values[0] );
+            for ( size_t dimension = 0; dimension < outDimension; ++dimension )
+            {
+                double deviation = std::fabs( values[dimension] - getValue( originalCurve.getOutputValues(), key * outDimension + dimension ) );
+                maxDeviation = std::max( maxDeviation, deviation );
+            }
+        }
+        return maxDeviation;
+    }
+
+    void testPolyline()
+    {
+        COLLADAFW::AnimationCurve original( COLLADAFW::UniqueId::INVALID );
+        COLLADAFW::AnimationCurve curve( COLLADAFW::UniqueId::INVALID );
+        sample( original, polyline, 8, 0.05, 2, COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE );
+        sample( curve, polyline, 8, 0.05, 2, COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE );
+
+        COLLADAFW::AnimationCurveSimplifier simplifier;
+        simplifier.setFitBezier( false );
+        check( simplifier.simplify( curve ), "a sampled polyline is simplified" );
+        check( curve.getInterpolationType() == COLLADAFW::AnimationCurve::INTERPOLATION_LINEAR, "only linear curves are fitted without bezier" );
+        check( curve.getKeyCount() == 4, "the simplified polyline keeps its corners" );
+        check( getValue( curve.getInputValues(), 0 ) == 0 && getValue( curve.getInputValues(), curve.getKeyCount() - 1 ) == 8,
+            "the first and the last key are kept" );
+        check( calculateMaxDeviation( original, curve ) <= simplifier.getTolerance(), "the simplified polyline reproduces all samples" );
+    }
+
+    void testSmoothCurve( COLLADAFW::FloatOrDoubleArray::DataType dataType, bool fitBezier )
+    {
+        COLLADAFW::AnimationCurve original( COLLADAFW::UniqueId::INVALID );
+        COLLADAFW::AnimationCurve curve( COLLADAFW::UniqueId::INVALID );
+        sample( original, smooth, 10, 1.0 / 120, 2, dataType );
+        sample( curve, smooth, 10, 1.0 / 120, 2, dataType );
+
+        // the samples of float curves are only accurate to about 1e-7
+        COLLADAFW::AnimationCurveSimplifier simplifier;
+        simplifier.setTolerance( 1e-3 );
+        simplifier.setFitBezier( fitBezier );
+        check( simplifier.simplify( curve ), "a sampled smooth curve is simplified" );
+        check( curve.getKeyCount() < original.getKeyCount() / 2, "most samples of a smooth curve are removed" );
+        check( curve.getInputValues().getType() == dataType && curve.getOutputValues().getType() == dataType, "the simplified curve keeps the data type" );
+        check( calculateMaxDeviation( original, curve ) <= simplifier.getTolerance() * (1 + 1e-6), "the simplified smooth curve reproduces all samples within the tolerance" );
+        if ( !fitBezier )
+            check( curve.getInterpolationType() == COLLADAFW::AnimationCurve::INTERPOLATION_LINEAR, "only linear curves are fitted without bezier" );
+
+        // simplifying a simplified curve again never adds keys
+        size_t keyCount = curve.getKeyCount();
+        check( !simplifier.simplify( curve ) || curve.getKeyCount() <= keyCount, "simplifying again does not add keys" );
+    }
+
+    void testStep()
+    {
+        const double inputs[] = { 0, 1, 2, 3, 4, 5 };
+        const double outputs[] = { 1, 1, 1, 5, 5, 3 };
+        COLLADAFW::AnimationCurve curve( COLLADAFW::UniqueId::INVALID );
+        curve.setInterpolationType( COLLADAFW::AnimationCurve::INTERPOLATION_STEP );
+        curve.setOutDimension( 1 );
+        curve.getInputValues().setType( COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE );
+        curve.getInputValues().getDoubleValues()->appendValues( inputs, 6 );
+        curve.getOutputValues().setType( COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE );
+        curve.getOutputValues().getDoubleValues()->appendValues( outputs, 6 );
+
+        COLLADAFW::AnimationCurveEvaluator originalEvaluator;
+        originalEvaluator.addAnimationCurve( curve );
+
+        COLLADAFW::AnimationCurveSimplifier simplifier;
+        check( simplifier.simplify( curve ), "a step curve with repeated outputs is simplified" );
+        check( curve.getInterpolationType() == COLLADAFW::AnimationCurve::INTERPOLATION_STEP, "a step curve stays a step curve" );
+        check( curve.getKeyCount() < 6, "keys that do not change the output are removed" );
+
+        COLLADAFW::AnimationCurveEvaluator evaluator;
+        evaluator.addAnimationCurve( curve );
+        bool matches = true;
+        for ( double input = -0.5; input < 6; input += 0.25 )
+        {
+            double expected = 0;
+            double value = 0;
+            originalEvaluator.evaluate( 0, input, &expected );
+            evaluator.evaluate( 0, input, &value );
+            matches &= value == expected;
+        }
+        check( matches, "the simplified step curve has the values of the original one" );
+    }
+
+    void testNotSimplified()
+    {
+        // straight line with three keys becomes two keys
+        const double inputs[] = { 0, 1, 2 };
+        const double outputs[] = { 0, 1, 2 };
+        COLLADAFW::AnimationCurveSimplifier simplifier;
+        COLLADAFW::AnimationCurveSimplifier::Keys keys;
+        simplifier.simplify( inputs, outputs, 3, 1, keys );
+        check( keys.mInputs.size() == 2 && keys.mInputs[0] == 0 && keys.mInputs[1] == 2, "a straight line keeps its end points" );
+        check( keys.mInTangents.empty() && keys.mOutTangents.empty(), "linear keys have no tangents" );
+
+        // mixed curves with step segments are not simplified
+        const double mixedOutputs[] = { 0, 0, 0 };
+        COLLADAFW::AnimationCurve mixedCurve( COLLADAFW::UniqueId::INVALID );
+        mixedCurve.setInterpolationType( COLLADAFW::AnimationCurve::INTERPOLATION_MIXED );
+        mixedCurve.getInterpolationTypes().append( COLLADAFW::AnimationCurve::INTERPOLATION_LINEAR );
+        mixedCurve.getInterpolationTypes().append( COLLADAFW::AnimationCurve::INTERPOLATION_STEP );
+        mixedCurve.setOutDimension( 1 );
+        mixedCurve.getInputValues().setType( COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE );
+        mixedCurve.getInputValues().getDoubleValues()->appendValues( inputs, 3 );
+        mixedCurve.getOutputValues().setType( COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE );
+        mixedCurve.getOutputValues().getDoubleValues()->appendValues( mixedOutputs, 3 );
+        check( !simplifier.simplify( mixedCurve ) && mixedCurve.getKeyCount() == 3, "mixed curves with step segments are not simplified" );
+    }
+
+    void testCurveList()
+    {
+        COLLADAFW::AnimationCurve firstCurve( COLLADAFW::UniqueId::INVALID );
+        COLLADAFW::AnimationCurve secondCurve( COLLADAFW::UniqueId::INVALID );
+        COLLADAFW::AnimationCurve shortCurve( COLLADAFW::UniqueId::INVALID );
+        sample( firstCurve, polyline, 8, 0.1, 1, COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE );
+        sample( secondCurve, smooth, 8, 0.1, 2, COLLADAFW::FloatOrDoubleArray::DATA_TYPE_FLOAT );
+        sample( shortCurve, smooth, 1, 1, 1, COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE );
+
+        COLLADAFW::AnimationCurveSimplifier::AnimationCurveList curves;
+        curves.push_back( &firstCurve );
+        curves.push_back( &secondCurve );
+        curves.push_back( &shortCurve );
+
+        COLLADAFW::AnimationCurveSimplifier simplifier;
+        simplifier.setTolerance( 1e-3 );
+        simplifier.setParallel( true );
+        check( simplifier.simplify( curves ) == 2, "all curves but the one with two keys are simplified" );
+        check( shortCurve.getKeyCount() == 2, "curves with two keys are kept" );
+    }
+}
+
+
+int main()
+{
+    testPolyline();
+    testSmoothCurve( COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE, true );
+    testSmoothCurve( COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE, false );
+    testSmoothCurve( COLLADAFW::FloatOrDoubleArray::DATA_TYPE_FLOAT, true );
+    testStep();
+    testNotSimplified();
+    testCurveList();
+
+    if ( failures > 0 )
+        return -1;
+
+    std::cout << "All AnimationCurveSimplifier tests passed" << std::endl;
+    return 0;
+}
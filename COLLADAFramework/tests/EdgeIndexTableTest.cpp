@@ -0,0 +1,229 @@
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWEdgeIndexTable.h"
+#include "COLLADAFWMesh.h"
+#include "COLLADAFWTriangles.h"
+#include "COLLADAFWTrifans.h"
+#include "COLLADAFWTristrips.h"
+#include "COLLADAFWPolygons.h"
+
+#include <iostream>
+#include <map>
+
+#ifdef _OPENMP
+#	include <omp.h>
+#endif
+
+
+// Builds the edge index tables of a small mesh with known edges and of a large generated mesh with polylists
+// with holes, triangle fans and triangle strips. The tables built with one and with several partitions must
+// contain the same edges with the same indices as a numbering of the edges in the order of the faces.
+
+namespace
+{
+    int failures = 0;
+
+    void check( bool condition, const char* description )
+    {
+        if ( !condition )
+        {
+            std::cerr << "FAILED: " << description << std::endl;
+            ++failures;
+        }
+    }
+
+    typedef std::map<COLLADAFW::Edge, size_t> EdgeIndices;
+
+    /** Appends a primitive of @a primitiveType with the @a groupCount vertex counts @a vertexCounts and the
+    position indices @a indices to @a mesh.*/
+    template<class PrimitiveType>
+    void appendPrimitive( COLLADAFW::Mesh& mesh, const int* vertexCounts, size_t groupCount, const unsigned int* indices, size_t indexCount )
+    {
+        PrimitiveType* primitive = new PrimitiveType( COLLADAFW::UniqueId::INVALID );
+        for ( size_t i = 0; i < groupCount; ++i )
+            primitive->getGroupedVerticesVertexCountArray().append( vertexCounts[i] );
+        primitive->getPositionIndices().appendValues( indices, indexCount );
+        mesh.appendPrimitive( primitive );
+    }
+
+    /** Numbers the edges of all primitives of @a mesh in the order they first appear in the faces.*/
+    void numberEdges( const COLLADAFW::Mesh& mesh, std::vector<COLLADAFW::Edge>& uniqueEdges, EdgeIndices& edgeIndices )
+    {
+        const COLLADAFW::MeshPrimitiveArray& meshPrimitives = mesh.getMeshPrimitives();
+        for ( size_t i = 0; i < meshPrimitives.getCount(); ++i )
+        {
+            std::vector<COLLADAFW::Edge> edges( COLLADAFW::EdgeIndexTable::getEdgeCount( *meshPrimitives[i] ) );
+            if ( edges.empty() )
+                continue;
+            COLLADAFW::EdgeIndexTable::appendEdges( *meshPrimitives[i], &edges[0] );
+            for ( size_t j = 0; j < edges.size(); ++j )
+            {
+                if ( edgeIndices.insert( std::make_pair( edges[j], uniqueEdges.size() ) ).second )
+                    uniqueEdges.push_back( edges[j] );
+            }
+        }
+    }
+
+    /** Checks, that @a table contains the edges of @a mesh numbered in the order of the faces.*/
+    bool matchesNumbering( const COLLADAFW::EdgeIndexTable& table, const COLLADAFW::Mesh& mesh )
+    {
+        std::vector<COLLADAFW::Edge> uniqueEdges;
+        EdgeIndices edgeIndices;
+        numberEdges( mesh, uniqueEdges, edgeIndices );
+        if ( table.getEdgeCount() != uniqueEdges.size() )
+            return false;
+
+        bool matches = true;
+        for ( size_t i = 0; i < uniqueEdges.size(); ++i )
+        {
+            const COLLADAFW::Edge& edge = table.getEdge( i );
+            matches &= edge == uniqueEdges[i] && edge.isReverse() == uniqueEdges[i].isReverse();
+        }
+        for ( EdgeIndices::const_iterator it = edgeIndices.begin(); it != edgeIndices.end(); ++it )
+        {
+            size_t edgeIndex = 0;
+            matches &= table.findEdgeIndex( it->first, edgeIndex ) && edgeIndex == it->second;
+        }
+        return matches;
+    }
+
+    /** Builds the table of @a mesh in parallel with @a threadCount threads, which results in one partition
+    per thread, if compiled with OpenMP.*/
+    void buildParallel( COLLADAFW::EdgeIndexTable& table, const COLLADAFW::Mesh& mesh, int threadCount )
+    {
+#ifdef _OPENMP
+        int maxThreads = omp_get_max_threads();
+        omp_set_num_threads( threadCount );
+#endif
+        table.setParallel( true );
+        table.build( mesh );
+#ifdef _OPENMP
+        omp_set_num_threads( maxThreads );
+#endif
+    }
+
+    void testSmallMesh()
+    {
+        COLLADAFW::Mesh mesh( COLLADAFW::UniqueId::INVALID );
+
+        // a quad with a triangular hole
+        const int polylistCounts[] = { 4, -3 };
+        const unsigned int polylistIndices[] = { 0, 1, 2, 3,  4, 5, 6 };
+        appendPrimitive<COLLADAFW::Polygons>( mesh, polylistCounts, 2, polylistIndices, 7 );
+        mesh.getMeshPrimitives()[0]->setPrimitiveType( COLLADAFW::MeshPrimitive::POLYLIST );
+
+        // the fan adds the diagonal 2 0 of the quad
+        const int trifansCounts[] = { 4 };
+        const unsigned int trifansIndices[] = { 0, 1, 2, 3 };
+        appendPrimitive<COLLADAFW::Trifans>( mesh, trifansCounts, 1, trifansIndices, 4 );
+
+        // the strip adds 2 7, 7 1, 7 8 and 8 2
+        const int tristripsCounts[] = { 4 };
+        const unsigned int tristripsIndices[] = { 1, 2, 7, 8 };
+        appendPrimitive<COLLADAFW::Tristrips>( mesh, tristripsCounts, 1, tristripsIndices, 4 );
+
+        // the triangle adds 8 9 and 9 2
+        COLLADAFW::Triangles* triangles = new COLLADAFW::Triangles( COLLADAFW::UniqueId::INVALID );
+        const unsigned int trianglesIndices[] = { 8, 9, 2 };
+        triangles->getPositionIndices().appendValues( trianglesIndices, 3 );
+        triangles->setFaceCount( 1 );
+        mesh.appendPrimitive( triangles );
+
+        COLLADAFW::EdgeIndexTable table;
+        table.build( mesh );
+        const unsigned int expectedEdges[] = { 0,1, 1,2, 2,3, 0,3, 4,5, 5,6, 4,6, 0,2, 2,7, 1,7, 7,8, 2,8, 8,9, 2,9 };
+        bool edgesMatch = table.getEdgeCount() == 14;
+        for ( size_t i = 0; edgesMatch && i < 14; ++i )
+            edgesMatch = table.getEdge( i )[0] == expectedEdges[2 * i] && table.getEdge( i )[1] == expectedEdges[2 * i + 1];
+        check( edgesMatch, "the edges of a small mesh in the order of their first appearance" );
+        check( table.getEdge( 3 ).isReverse() && !table.getEdge( 0 ).isReverse(), "the edges keep the direction of their first appearance" );
+
+        size_t edgeIndex = 0;
+        check( table.findEdgeIndex( COLLADAFW::Edge( 6, 4 ), edgeIndex ) && edgeIndex == 6, "the edges of holes are found in either direction" );
+        check( !table.findEdgeIndex( COLLADAFW::Edge( 1, 3 ), edgeIndex ), "edges not in the mesh are not found" );
+
+        COLLADAFW::EdgeIndexTable parallelTable;
+        buildParallel( parallelTable, mesh, 3 );
+        check( matchesNumbering( parallelTable, mesh ), "the small mesh built with several partitions" );
+    }
+
+    /** Appends polylists with holes, fans and strips with pseudo random indices into @a vertexCount vertices, so
+    that many edges are shared between the faces and the primitives.*/
+    void createLargeMesh( COLLADAFW::Mesh& mesh, unsigned int vertexCount )
+    {
+        unsigned int random = 12345;
+        for ( size_t primitive = 0; primitive < 12; ++primitive )
+        {
+            std::vector<int> vertexCounts;
+            std::vector<unsigned int> indices;
+            for ( size_t group = 0; group < 2000; ++group )
+            {
+                random = random * 1103515245u + 12345u;
+                int groupSize = 3 + (int)((random >> 16) % 5);
+                // every fourth polygon is followed by a hole
+                if ( primitive % 3 == 0 && group % 4 == 1 )
+                    groupSize = -groupSize;
+                vertexCounts.push_back( groupSize );
+                unsigned int first = (random >> 8) % vertexCount;
+                for ( int i = 0; i < (groupSize < 0 ? -groupSize : groupSize); ++i )
+                {
+                    random = random * 1103515245u + 12345u;
+                    // mostly neighbouring vertices, so edges repeat
+                    indices.push_back( (first + i + (random >> 28) % 2) % vertexCount );
+                }
+            }
+
+            switch ( primitive % 3 )
+            {
+            case 0:
+                appendPrimitive<COLLADAFW::Polygons>( mesh, &vertexCounts[0], vertexCounts.size(), &indices[0], indices.size() );
+                mesh.getMeshPrimitives()[primitive]->setPrimitiveType( COLLADAFW::MeshPrimitive::POLYLIST );
+                break;
+            case 1:
+                appendPrimitive<COLLADAFW::Trifans>( mesh, &vertexCounts[0], vertexCounts.size(), &indices[0], indices.size() );
+                break;
+            default:
+                appendPrimitive<COLLADAFW::Tristrips>( mesh, &vertexCounts[0], vertexCounts.size(), &indices[0], indices.size() );
+                break;
+            }
+        }
+    }
+
+    void testLargeMesh()
+    {
+        COLLADAFW::Mesh mesh( COLLADAFW::UniqueId::INVALID );
+        createLargeMesh( mesh, 5000 );
+
+        COLLADAFW::EdgeIndexTable sequentialTable;
+        sequentialTable.build( mesh );
+        check( matchesNumbering( sequentialTable, mesh ), "the large mesh built sequentially" );
+
+        const int threadCounts[] = { 1, 2, 4, 7 };
+        for ( size_t i = 0; i < 4; ++i )
+        {
+            COLLADAFW::EdgeIndexTable parallelTable;
+            buildParallel( parallelTable, mesh, threadCounts[i] );
+            bool sameEdges = parallelTable.getEdgeCount() == sequentialTable.getEdgeCount();
+            for ( size_t edge = 0; sameEdges && edge < sequentialTable.getEdgeCount(); ++edge )
+                sameEdges = parallelTable.getEdge( edge ) == sequentialTable.getEdge( edge );
+            check( sameEdges, "one and several partitions give the same edges" );
+            check( matchesNumbering( parallelTable, mesh ), "the large mesh built with several partitions" );
+        }
+
+        // a rebuild replaces the content
+        sequentialTable.build( mesh );
+        check( matchesNumbering( sequentialTable, mesh ), "the large mesh built again" );
+    }
+}
+
+
+int main()
+{
+    testSmallMesh();
+    testLargeMesh();
+
+    if ( failures > 0 )
+        return -1;
+
+    std::cout << "All EdgeIndexTable tests passed" << std::endl;
+    return 0;
+}
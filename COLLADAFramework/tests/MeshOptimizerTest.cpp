@@ -0,0 +1,229 @@
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWMeshOptimizer.h"
+#include "COLLADAFWMesh.h"
+#include "COLLADAFWTriangles.h"
+
+#include <iostream>
+
+
+// Optimizes a scrambled grid and checks, that the triangles are only reordered and that the average cache
+// miss ratio improves.
+
+namespace
+{
+    int failures = 0;
+
+    void check( bool condition, const char* description )
+    {
+        if ( !condition )
+        {
+            std::cerr << "FAILED: " << description << std::endl;
+            ++failures;
+        }
+    }
+
+    /** The number of vertices per row and column of the grid.*/
+    const unsigned int GRID_SIZE = 40;
+
+    const size_t CACHE_SIZE = COLLADAFW::MeshOptimizer::DEFAULT_CACHE_SIZE;
+
+    /** One triangle, given by the positions of its corners.*/
+    struct Triangle
+    {
+        float mValues[9];
+
+        bool operator<( const Triangle& other ) const
+        {
+            return std::lexicographical_compare( mValues, mValues + 9, other.mValues, other.mValues + 9 );
+        }
+
+        bool operator==( const Triangle& other ) const
+        {
+            return std::equal( mValues, mValues + 9, other.mValues );
+        }
+    };
+    typedef std::vector<Triangle> TriangleList;
+
+    /** Two triangles per grid cell, in a scrambled order to give a bad cache miss ratio.*/
+    void createGridIndices( std::vector<unsigned int>& indices )
+    {
+        std::vector<unsigned int> cells;
+        for ( unsigned int y = 0; y + 1 < GRID_SIZE; ++y )
+            for ( unsigned int x = 0; x + 1 < GRID_SIZE; ++x )
+                cells.push_back( y * GRID_SIZE + x );
+
+        // deterministic shuffle
+        unsigned int random = 12345;
+        for ( size_t i = cells.size() - 1; i > 0; --i )
+        {
+            random = random * 1103515245u + 12345u;
+            std::swap( cells[i], cells[(random >> 8) % (i + 1)] );
+        }
+
+        for ( size_t i = 0; i < cells.size(); ++i )
+        {
+            unsigned int v = cells[i];
+            const unsigned int cellIndices[] = { v, v + 1, v + GRID_SIZE + 1,  v, v + GRID_SIZE + 1, v + GRID_SIZE };
+            indices.insert( indices.end(), cellIndices, cellIndices + 6 );
+        }
+    }
+
+    void createGridMesh( COLLADAFW::Mesh& mesh )
+    {
+        COLLADAFW::FloatArray positions;
+        for ( unsigned int y = 0; y < GRID_SIZE; ++y )
+        {
+            for ( unsigned int x = 0; x < GRID_SIZE; ++x )
+            {
+                positions.append( (float)x );
+                positions.append( (float)y );
+                positions.append( (float)((x * y) % 3) );
+            }
+        }
+        mesh.getPositions().appendValues( positions, "", 3 );
+
+        std::vector<unsigned int> indices;
+        createGridIndices( indices );
+        COLLADAFW::Triangles* triangles = new COLLADAFW::Triangles( COLLADAFW::UniqueId::INVALID );
+        triangles->getPositionIndices().appendValues( &indices[0], indices.size() );
+        mesh.appendPrimitive( triangles );
+    }
+
+    /** The triangles of the first primitive of @a mesh, sorted.*/
+    void getSortedTriangles( const COLLADAFW::Mesh& mesh, TriangleList& triangles )
+    {
+        const COLLADAFW::UIntValuesArray& indices = mesh.getMeshPrimitives()[0]->getPositionIndices();
+        const float* positions = mesh.getPositions().getFloatValues()->getData();
+        triangles.resize( indices.getCount() / 3 );
+        for ( size_t i = 0; i < triangles.size(); ++i )
+            for ( size_t corner = 0; corner < 3; ++corner )
+                for ( size_t j = 0; j < 3; ++j )
+                    triangles[i].mValues[3 * corner + j] = positions[3 * indices[3 * i + corner] + j];
+        std::sort( triangles.begin(), triangles.end() );
+    }
+
+    double calculateAverageCacheMissRatio( const COLLADAFW::Mesh& mesh )
+    {
+        const COLLADAFW::UIntValuesArray& indices = mesh.getMeshPrimitives()[0]->getPositionIndices();
+        return COLLADAFW::MeshOptimizer::calculateAverageCacheMissRatio( indices.getData(), indices.getCount(), GRID_SIZE * GRID_SIZE, CACHE_SIZE );
+    }
+
+    void testVertexCacheOrder()
+    {
+        std::vector<unsigned int> indices;
+        createGridIndices( indices );
+        size_t triangleCount = indices.size() / 3;
+
+        std::vector<unsigned int> triangleOrder;
+        std::vector<size_t> clusterStarts;
+        COLLADAFW::MeshOptimizer::calculateVertexCacheOrder( &indices[0], indices.size(), GRID_SIZE * GRID_SIZE, CACHE_SIZE, triangleOrder, &clusterStarts );
+
+        std::vector<unsigned int> sortedOrder( triangleOrder );
+        std::sort( sortedOrder.begin(), sortedOrder.end() );
+        bool isPermutation = sortedOrder.size() == triangleCount;
+        for ( size_t i = 0; isPermutation && i < triangleCount; ++i )
+            isPermutation = sortedOrder[i] == i;
+        check( isPermutation, "the triangle order is a permutation of the triangles" );
+        check( !clusterStarts.empty() && clusterStarts.front() == 0, "the first cluster starts with the first triangle" );
+        if ( !isPermutation )
+            return;
+
+        std::vector<unsigned int> optimizedIndices;
+        for ( size_t i = 0; i < triangleCount; ++i )
+            optimizedIndices.insert( optimizedIndices.end(), &indices[3 * triangleOrder[i]], &indices[3 * triangleOrder[i]] + 3 );
+
+        double acmrBefore = COLLADAFW::MeshOptimizer::calculateAverageCacheMissRatio( &indices[0], indices.size(), GRID_SIZE * GRID_SIZE, CACHE_SIZE );
+        double acmrAfter = COLLADAFW::MeshOptimizer::calculateAverageCacheMissRatio( &optimizedIndices[0], optimizedIndices.size(), GRID_SIZE * GRID_SIZE, CACHE_SIZE );
+        check( acmrBefore > 1.5, "the scrambled grid has a bad cache miss ratio" );
+        check( acmrAfter < 0.8, "the optimized order has a cache miss ratio close to the optimum of a grid" );
+    }
+
+    void testOptimizeMesh( int optimizations )
+    {
+        COLLADAFW::Mesh mesh( COLLADAFW::UniqueId::INVALID );
+        createGridMesh( mesh );
+        TriangleList trianglesBefore;
+        getSortedTriangles( mesh, trianglesBefore );
+        double acmrBefore = calculateAverageCacheMissRatio( mesh );
+
+        COLLADAFW::MeshOptimizer optimizer;
+        optimizer.setOptimizations( optimizations );
+        std::vector<unsigned int> positionRemap;
+        optimizer.optimize( mesh, &positionRemap );
+
+        TriangleList trianglesAfter;
+        getSortedTriangles( mesh, trianglesAfter );
+        check( trianglesAfter == trianglesBefore, "the optimized mesh contains the same triangles with the same winding" );
+        check( calculateAverageCacheMissRatio( mesh ) < acmrBefore / 2, "the optimization improves the cache miss ratio of the mesh" );
+
+        if ( optimizations & COLLADAFW::MeshOptimizer::OPTIMIZATION_VERTEX_FETCH )
+        {
+            std::vector<unsigned int> sortedRemap( positionRemap );
+            std::sort( sortedRemap.begin(), sortedRemap.end() );
+            bool isPermutation = sortedRemap.size() == GRID_SIZE * GRID_SIZE;
+            for ( size_t i = 0; isPermutation && i < sortedRemap.size(); ++i )
+                isPermutation = sortedRemap[i] == i;
+            check( isPermutation, "the position remap table is a permutation of the positions" );
+
+            const COLLADAFW::UIntValuesArray& indices = mesh.getMeshPrimitives()[0]->getPositionIndices();
+            check( indices[0] == 0 && indices[1] <= 1 && indices[2] <= 2, "the positions are in the order of their first use" );
+        }
+    }
+
+    void testOptimizeSubMesh()
+    {
+        COLLADAFW::Mesh mesh( COLLADAFW::UniqueId::INVALID );
+        createGridMesh( mesh );
+
+        COLLADAFW::VertexBufferBuilder builder;
+        COLLADAFW::VertexBufferBuilder::SubMeshList subMeshes;
+        builder.build( mesh, subMeshes );
+        COLLADAFW::VertexBufferBuilder::SubMesh& subMesh = subMeshes[0];
+        std::vector<unsigned int> indicesBefore( subMesh.mIndices16.begin(), subMesh.mIndices16.end() );
+        double acmrBefore = COLLADAFW::MeshOptimizer::calculateAverageCacheMissRatio( &indicesBefore[0], indicesBefore.size(), subMesh.mVertexCount, CACHE_SIZE );
+        std::vector<float> verticesBefore( subMesh.mVertices );
+
+        COLLADAFW::MeshOptimizer optimizer;
+        optimizer.setOptimizations( COLLADAFW::MeshOptimizer::OPTIMIZATION_ALL );
+        optimizer.optimize( subMesh );
+
+        check( !subMesh.mHas32BitIndices && subMesh.mIndices16.size() == indicesBefore.size(), "the sub mesh keeps its 16 bit indices" );
+        std::vector<unsigned int> indicesAfter( subMesh.mIndices16.begin(), subMesh.mIndices16.end() );
+
+        // the vertex builder already orders the vertices by first use, compare the triangles by their positions
+        TriangleList trianglesBefore( indicesBefore.size() / 3 );
+        TriangleList trianglesAfter( indicesAfter.size() / 3 );
+        for ( size_t i = 0; i < trianglesBefore.size(); ++i )
+        {
+            for ( size_t corner = 0; corner < 3; ++corner )
+            {
+                for ( size_t j = 0; j < 3; ++j )
+                {
+                    trianglesBefore[i].mValues[3 * corner + j] = verticesBefore[subMesh.mVertexStride * indicesBefore[3 * i + corner] + j];
+                    trianglesAfter[i].mValues[3 * corner + j] = subMesh.mVertices[subMesh.mVertexStride * indicesAfter[3 * i + corner] + j];
+                }
+            }
+        }
+        std::sort( trianglesBefore.begin(), trianglesBefore.end() );
+        std::sort( trianglesAfter.begin(), trianglesAfter.end() );
+        check( trianglesAfter == trianglesBefore, "the optimized sub mesh contains the same triangles" );
+
+        double acmrAfter = COLLADAFW::MeshOptimizer::calculateAverageCacheMissRatio( &indicesAfter[0], indicesAfter.size(), subMesh.mVertexCount, CACHE_SIZE );
+        check( acmrAfter < acmrBefore / 2, "the optimization improves the cache miss ratio of the sub mesh" );
+    }
+}
+
+
+int main()
+{
+    testVertexCacheOrder();
+    testOptimizeMesh( COLLADAFW::MeshOptimizer::OPTIMIZATION_TRIANGLE_ORDER );
+    testOptimizeMesh( COLLADAFW::MeshOptimizer::OPTIMIZATION_ALL );
+    testOptimizeSubMesh();
+
+    if ( failures > 0 )
+        return -1;
+
+    std::cout << "All MeshOptimizer tests passed" << std::endl;
+    return 0;
+}
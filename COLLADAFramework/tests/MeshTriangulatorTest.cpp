@@ -0,0 +1,252 @@
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWMeshTriangulator.h"
+#include "COLLADAFWMesh.h"
+#include "COLLADAFWTriangles.h"
+#include "COLLADAFWTrifans.h"
+#include "COLLADAFWTristrips.h"
+#include "COLLADAFWPolygons.h"
+
+#include <iostream>
+#include <cmath>
+
+
+// Triangulates fans, strips, concave polygons and polygons with holes and checks the resulting corners.
+
+namespace
+{
+    int failures = 0;
+
+    void check( bool condition, const char* description )
+    {
+        if ( !condition )
+        {
+            std::cerr << "FAILED: " << description << std::endl;
+            ++failures;
+        }
+    }
+
+    typedef std::vector<unsigned int> Corners;
+
+    bool equals( const Corners& corners, const unsigned int* expected, size_t count )
+    {
+        if ( corners.size() != count )
+            return false;
+        for ( size_t i = 0; i < count; ++i )
+        {
+            if ( corners[i] != expected[i] )
+                return false;
+        }
+        return true;
+    }
+
+    /** Sets the positions of @a mesh to the @a count points in the xy plane in @a points.*/
+    void setPositions( COLLADAFW::Mesh& mesh, const float* points, size_t count )
+    {
+        COLLADAFW::FloatArray positions;
+        for ( size_t i = 0; i < count; ++i )
+        {
+            positions.append( points[2 * i] );
+            positions.append( points[2 * i + 1] );
+            positions.append( 0 );
+        }
+        mesh.getPositions().appendValues( positions, "", 3 );
+    }
+
+    /** Sets the position indices of @a meshPrimitive to 0 .. @a count - 1.*/
+    void setSequentialIndices( COLLADAFW::MeshPrimitive& meshPrimitive, unsigned int count )
+    {
+        for ( unsigned int i = 0; i < count; ++i )
+            meshPrimitive.getPositionIndices().append( i );
+    }
+
+    /** The signed area of the triangle with the corners @a a, @a b and @a c of the primitive with sequential
+    indices into @a points.*/
+    double signedArea( const float* points, unsigned int a, unsigned int b, unsigned int c )
+    {
+        double ux = points[2 * b] - points[2 * a];
+        double uy = points[2 * b + 1] - points[2 * a + 1];
+        double vx = points[2 * c] - points[2 * a];
+        double vy = points[2 * c + 1] - points[2 * a + 1];
+        return 0.5 * (ux * vy - uy * vx);
+    }
+
+    /** Checks, that all triangles in @a corners are counter clockwise and cover @a expectedArea.*/
+    void checkArea( const float* points, const Corners& corners, double expectedArea, const char* description )
+    {
+        bool counterClockwise = true;
+        double area = 0;
+        for ( size_t i = 0; i + 2 < corners.size(); i += 3 )
+        {
+            double triangleArea = signedArea( points, corners[i], corners[i + 1], corners[i + 2] );
+            counterClockwise &= triangleArea > -1e-9;
+            area += triangleArea;
+        }
+        check( counterClockwise, description );
+        check( std::fabs( area - expectedArea ) < 1e-6, description );
+    }
+
+    void testTriangles()
+    {
+        COLLADAFW::Mesh mesh( COLLADAFW::UniqueId::INVALID );
+        COLLADAFW::Triangles* triangles = new COLLADAFW::Triangles( COLLADAFW::UniqueId::INVALID );
+        setSequentialIndices( *triangles, 7 );
+        mesh.appendPrimitive( triangles );
+
+        COLLADAFW::MeshTriangulator triangulator;
+        Corners corners( 1, 42 );
+        size_t cornerCount = triangulator.triangulate( mesh, *triangles, corners );
+
+        const unsigned int expected[] = { 42,  0, 1, 2,  3, 4, 5 };
+        check( cornerCount == 6 && equals( corners, expected, 7 ), "triangles are passed through and appended, incomplete triangles are ignored" );
+        check( COLLADAFW::MeshTriangulator::getMaxTriangleCount( *triangles ) == 2, "the maximum triangle count of triangles" );
+    }
+
+    void testTrifans()
+    {
+        COLLADAFW::Mesh mesh( COLLADAFW::UniqueId::INVALID );
+        COLLADAFW::Trifans* trifans = new COLLADAFW::Trifans( COLLADAFW::UniqueId::INVALID );
+        setSequentialIndices( *trifans, 8 );
+        trifans->getGroupedVerticesVertexCountArray().append( 5 );
+        trifans->getGroupedVerticesVertexCountArray().append( 3 );
+        mesh.appendPrimitive( trifans );
+
+        COLLADAFW::MeshTriangulator triangulator;
+        Corners corners;
+        triangulator.triangulate( mesh, *trifans, corners );
+
+        const unsigned int expected[] = { 0, 1, 2,  0, 2, 3,  0, 3, 4,  5, 6, 7 };
+        check( equals( corners, expected, 12 ), "trifans are unrolled around the first vertex of each fan" );
+        check( COLLADAFW::MeshTriangulator::getMaxTriangleCount( *trifans ) == 4, "the maximum triangle count of trifans" );
+    }
+
+    void testTristrips()
+    {
+        COLLADAFW::Mesh mesh( COLLADAFW::UniqueId::INVALID );
+        COLLADAFW::Tristrips* tristrips = new COLLADAFW::Tristrips( COLLADAFW::UniqueId::INVALID );
+        setSequentialIndices( *tristrips, 9 );
+        tristrips->getGroupedVerticesVertexCountArray().append( 5 );
+        tristrips->getGroupedVerticesVertexCountArray().append( 4 );
+        mesh.appendPrimitive( tristrips );
+
+        COLLADAFW::MeshTriangulator triangulator;
+        Corners corners;
+        triangulator.triangulate( mesh, *tristrips, corners );
+
+        // every second triangle is flipped to keep the winding of the strip
+        const unsigned int expected[] = { 0, 1, 2,  2, 1, 3,  2, 3, 4,  5, 6, 7,  7, 6, 8 };
+        check( equals( corners, expected, 15 ), "tristrips are unrolled keeping the winding" );
+        check( COLLADAFW::MeshTriangulator::getMaxTriangleCount( *tristrips ) == 5, "the maximum triangle count of tristrips" );
+    }
+
+    void testConcavePolygon()
+    {
+        // L shaped hexagon, counter clockwise. Fanning from vertex 0 would create a triangle outside
+        const float points[] = { 0,0,  2,0,  2,1,  1,1,  1,2,  0,2 };
+        COLLADAFW::Mesh mesh( COLLADAFW::UniqueId::INVALID );
+        setPositions( mesh, points, 6 );
+        COLLADAFW::Polygons* polygons = new COLLADAFW::Polygons( COLLADAFW::UniqueId::INVALID );
+        setSequentialIndices( *polygons, 6 );
+        polygons->getGroupedVerticesVertexCountArray().append( 6 );
+        mesh.appendPrimitive( polygons );
+
+        COLLADAFW::MeshTriangulator triangulator;
+        Corners corners;
+        triangulator.triangulate( mesh, *polygons, corners );
+
+        check( corners.size() == 3 * 4, "a concave hexagon gives four triangles" );
+        checkArea( points, corners, 3, "the triangles of a concave polygon cover it with its winding" );
+    }
+
+    void testPolygonWithHoles()
+    {
+        // square with two square holes, the holes are given in both windings
+        const float points[] = { 0,0,  6,0,  6,4,  0,4,
+                                 1,1,  1,3,  2,3,  2,1,
+                                 4,1,  5,1,  5,3,  4,3 };
+        COLLADAFW::Mesh mesh( COLLADAFW::UniqueId::INVALID );
+        setPositions( mesh, points, 12 );
+        COLLADAFW::Polygons* polygons = new COLLADAFW::Polygons( COLLADAFW::UniqueId::INVALID );
+        setSequentialIndices( *polygons, 12 );
+        polygons->getGroupedVerticesVertexCountArray().append( 4 );
+        polygons->getGroupedVerticesVertexCountArray().append( -4 );
+        polygons->getGroupedVerticesVertexCountArray().append( -4 );
+        mesh.appendPrimitive( polygons );
+
+        COLLADAFW::MeshTriangulator triangulator;
+        Corners corners;
+        size_t cornerCount = triangulator.triangulate( mesh, *polygons, corners );
+
+        size_t maxTriangleCount = COLLADAFW::MeshTriangulator::getMaxTriangleCount( *polygons );
+        check( maxTriangleCount == 2 + 6 + 6, "each hole adds its vertex count plus two triangles" );
+        check( cornerCount == 3 * maxTriangleCount, "the bridged polygon gives the maximum number of triangles" );
+        checkArea( points, corners, 24 - 2 - 2, "the triangles of a polygon with holes cover it without the holes" );
+
+        bool usesAllCorners = true;
+        for ( unsigned int corner = 0; corner < 12; ++corner )
+            usesAllCorners &= std::find( corners.begin(), corners.end(), corner ) != corners.end();
+        check( usesAllCorners, "all corners of the polygon and the holes are used" );
+
+        // in fan mode the holes are ignored
+        triangulator.setPolygonMode( COLLADAFW::MeshTriangulator::POLYGON_MODE_FAN );
+        corners.clear();
+        triangulator.triangulate( mesh, *polygons, corners );
+        const unsigned int expected[] = { 0, 1, 2,  0, 2, 3 };
+        check( equals( corners, expected, 6 ), "in fan mode only the outer loop is fanned" );
+    }
+
+    void testTriangulatedPrimitives()
+    {
+        const float points[] = { 0,0,  1,0,  1,1,  0,1 };
+        COLLADAFW::Mesh mesh( COLLADAFW::UniqueId::INVALID );
+        setPositions( mesh, points, 4 );
+
+        COLLADAFW::Polygons* polygons = new COLLADAFW::Polygons( COLLADAFW::UniqueId::INVALID );
+        setSequentialIndices( *polygons, 4 );
+        polygons->getGroupedVerticesVertexCountArray().append( 4 );
+        polygons->setMaterialId( 5 );
+        mesh.appendPrimitive( polygons );
+
+        COLLADAFW::Trifans* trifans = new COLLADAFW::Trifans( COLLADAFW::UniqueId::INVALID );
+        setSequentialIndices( *trifans, 4 );
+        trifans->getGroupedVerticesVertexCountArray().append( 4 );
+        mesh.appendPrimitive( trifans );
+
+        COLLADAFW::MeshTriangulator triangulator;
+        COLLADAFW::MeshTriangulator::TriangulatedPrimitiveList triangulatedPrimitives;
+        triangulator.triangulate( mesh, triangulatedPrimitives );
+
+        check( triangulatedPrimitives.size() == 2, "one triangulated primitive per mesh primitive" );
+        if ( triangulatedPrimitives.size() != 2 )
+            return;
+        check( triangulatedPrimitives[0].mMeshPrimitive == polygons && triangulatedPrimitives[1].mMeshPrimitive == trifans,
+            "the triangulated primitives are in the order of the mesh primitives" );
+        check( triangulatedPrimitives[0].mCorners == triangulatedPrimitives[1].mCorners, "a convex quad is fanned like a trifan" );
+
+        const Corners& corners = triangulatedPrimitives[0].mCorners;
+        COLLADAFW::Triangles* triangles = COLLADAFW::MeshTriangulator::createTriangles( *polygons, &corners[0], corners.size() );
+        const COLLADAFW::UIntValuesArray& positionIndices = triangles->getPositionIndices();
+        bool indicesMatch = positionIndices.getCount() == corners.size();
+        for ( size_t i = 0; indicesMatch && i < corners.size(); ++i )
+            indicesMatch = positionIndices[i] == polygons->getPositionIndices()[corners[i]];
+        check( indicesMatch, "the created triangles have the indices of the corners" );
+        check( triangles->getMaterialId() == 5, "the created triangles take over the material id" );
+        delete triangles;
+    }
+}
+
+
+int main()
+{
+    testTriangles();
+    testTrifans();
+    testTristrips();
+    testConcavePolygon();
+    testPolygonWithHoles();
+    testTriangulatedPrimitives();
+
+    if ( failures > 0 )
+        return -1;
+
+    std::cout << "All MeshTriangulator tests passed" << std::endl;
+    return 0;
+}
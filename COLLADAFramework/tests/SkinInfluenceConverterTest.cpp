@@ -0,0 +1,218 @@
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWSkinInfluenceConverter.h"
+#include "COLLADAFWSkinControllerData.h"
+
+#include <iostream>
+#include <cmath>
+
+
+// Converts the influences of a small skin controller with known results and of a large generated one and
+// checks the selected joints, the normalized weights and the sums of the quantized weights.
+
+namespace
+{
+    int failures = 0;
+
+    void check( bool condition, const char* description )
+    {
+        if ( !condition )
+        {
+            std::cerr << "FAILED: " << description << std::endl;
+            ++failures;
+        }
+    }
+
+    typedef std::vector<unsigned short> JointIndices;
+
+    /** Appends a vertex with the @a count influences of @a joints with @a weights to @a skinControllerData.
+    Each weight gets its own entry in the weights array.*/
+    void appendVertex( COLLADAFW::SkinControllerData& skinControllerData, const int* joints, const double* weights, unsigned int count )
+    {
+        COLLADAFW::DoubleArray& weightValues = *skinControllerData.getWeights().getDoubleValues();
+        skinControllerData.getJointsPerVertex().append( count );
+        for ( unsigned int i = 0; i < count; ++i )
+        {
+            skinControllerData.getJointIndices().append( joints[i] );
+            skinControllerData.getWeightIndices().append( (unsigned int)weightValues.getCount() );
+            weightValues.append( weights[i] );
+        }
+    }
+
+    /** Four vertices:
+    0: six influences, the four largest are joints 1, 3, 4 and 0
+    1: one influence bound to the bind shape and one to joint 2
+    2: one influence of joint 7
+    3: five equal influences, whose quantized weights do not sum up to the maximum without correction*/
+    void createSkinControllerData( COLLADAFW::SkinControllerData& skinControllerData )
+    {
+        skinControllerData.setJointsCount( 8 );
+        skinControllerData.getWeights().setType( COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE );
+
+        const int joints0[] = { 0, 1, 2, 3, 4, 5 };
+        const double weights0[] = { 0.1, 0.3, 0.05, 0.25, 0.2, 0.1 };
+        appendVertex( skinControllerData, joints0, weights0, 6 );
+
+        const int joints1[] = { -1, 2 };
+        const double weights1[] = { 0.5, 0.5 };
+        appendVertex( skinControllerData, joints1, weights1, 2 );
+
+        const int joints2[] = { 7 };
+        const double weights2[] = { 1 };
+        appendVertex( skinControllerData, joints2, weights2, 1 );
+
+        const int joints3[] = { 2, 3, 4, 5, 6 };
+        const double weights3[] = { 0.2, 0.2, 0.2, 0.2, 0.2 };
+        appendVertex( skinControllerData, joints3, weights3, 5 );
+    }
+
+    void testSelection()
+    {
+        COLLADAFW::SkinControllerData skinControllerData( COLLADAFW::UniqueId::INVALID );
+        createSkinControllerData( skinControllerData );
+        check( COLLADAFW::SkinInfluenceConverter::getMaxInfluenceCount( skinControllerData ) == 6, "the largest number of influences of a vertex" );
+
+        COLLADAFW::SkinInfluenceConverter converter;
+        converter.setLayout( COLLADAFW::SkinInfluenceConverter::LAYOUT_INTERLEAVED );
+        JointIndices jointIndices( 4 * 4 );
+        std::vector<float> weights( 4 * 4 );
+        check( converter.convert( skinControllerData, &jointIndices[0], &weights[0] ), "the influences are converted" );
+
+        const unsigned short expectedJoints[] = { 1, 3, 4, 0,  2, 0, 0, 0,  7, 0, 0, 0 };
+        check( std::equal( expectedJoints, expectedJoints + 12, jointIndices.begin() ),
+            "the largest influences are selected sorted by weight and padded with joint 0" );
+
+        // 0.85 is the sum of the selected weights of vertex 0
+        const double expectedWeights[] = { 0.3 / 0.85, 0.25 / 0.85, 0.2 / 0.85, 0.1 / 0.85,  1, 0, 0, 0,  1, 0, 0, 0,  0.25, 0.25, 0.25, 0.25 };
+        bool weightsMatch = true;
+        for ( size_t i = 0; i < 16; ++i )
+            weightsMatch &= std::fabs( weights[i] - expectedWeights[i] ) < 1e-6;
+        check( weightsMatch, "the selected weights are renormalized to sum up to one" );
+
+        // without normalization the weights of the selected influences are kept
+        converter.setNormalize( false );
+        converter.convert( skinControllerData, &jointIndices[0], &weights[0] );
+        check( std::fabs( weights[0] - 0.3 ) < 1e-6 && std::fabs( weights[4] - 0.5 ) < 1e-6, "unnormalized weights are kept" );
+
+        // fewer influences
+        converter.setNormalize( true );
+        converter.setInfluenceCount( 2 );
+        converter.convert( skinControllerData, &jointIndices[0], &weights[0] );
+        check( jointIndices[0] == 1 && jointIndices[1] == 3 && std::fabs( weights[0] - 0.3 / 0.55 ) < 1e-6, "the two largest influences" );
+
+        converter.setInfluenceCount( 100 );
+        check( converter.getInfluenceCount() == COLLADAFW::SkinInfluenceConverter::MAX_INFLUENCE_COUNT, "the influence count is clamped" );
+
+        skinControllerData.setJointsCount( 0x10000 + 1 );
+        check( !converter.convert( skinControllerData, &jointIndices[0], &weights[0] ), "joint indices must fit into an unsigned short" );
+    }
+
+    template<class QuantizedType>
+    void testQuantization( COLLADAFW::SkinInfluenceConverter::WeightFormat weightFormat, unsigned int maxValue )
+    {
+        COLLADAFW::SkinControllerData skinControllerData( COLLADAFW::UniqueId::INVALID );
+        createSkinControllerData( skinControllerData );
+
+        COLLADAFW::SkinInfluenceConverter converter;
+        converter.setWeightFormat( weightFormat );
+        check( converter.getWeightSize() == sizeof(QuantizedType), "the size of a quantized weight" );
+        JointIndices jointIndices( 4 * 4 );
+        std::vector<QuantizedType> weights( 4 * 4 );
+        converter.convert( skinControllerData, &jointIndices[0], &weights[0] );
+
+        // structure of arrays, influence * vertexCount + vertex
+        bool sumsMatch = true;
+        for ( size_t vertex = 0; vertex < 4; ++vertex )
+        {
+            unsigned int sum = 0;
+            for ( size_t influence = 0; influence < 4; ++influence )
+                sum += weights[influence * 4 + vertex];
+            sumsMatch &= sum == maxValue;
+        }
+        check( sumsMatch, "the quantized weights of each vertex sum up to exactly the maximum" );
+
+        // a quarter rounds up, the error is taken from the largest weight
+        unsigned int quarter = (unsigned int)(maxValue / 4.0 + 0.5);
+        check( weights[3] == maxValue - 3 * quarter && weights[4 + 3] == quarter && weights[12 + 3] == quarter, "the rounding error goes to the largest weight" );
+        check( weights[1] == maxValue && weights[4 + 1] == 0, "a single influence gets the maximum weight" );
+        check( jointIndices[0] == 1 && jointIndices[4] == 3 && jointIndices[8] == 4 && jointIndices[12] == 0, "the joints of the first vertex in structure of arrays layout" );
+    }
+
+    /** Compares the conversion of many generated vertices in both layouts, sequential and parallel.*/
+    void testLargeController()
+    {
+        const size_t vertexCount = 10000;
+        COLLADAFW::SkinControllerData skinControllerData( COLLADAFW::UniqueId::INVALID );
+        skinControllerData.setJointsCount( 50 );
+        skinControllerData.getWeights().setType( COLLADAFW::FloatOrDoubleArray::DATA_TYPE_FLOAT );
+        COLLADAFW::FloatArray& weightValues = *skinControllerData.getWeights().getFloatValues();
+        for ( unsigned int i = 0; i < 100; ++i )
+            weightValues.append( (float)(i + 1) / 100 );
+
+        unsigned int random = 12345;
+        for ( size_t vertex = 0; vertex < vertexCount; ++vertex )
+        {
+            unsigned int count = (unsigned int)(vertex % 7);
+            skinControllerData.getJointsPerVertex().append( count );
+            for ( unsigned int i = 0; i < count; ++i )
+            {
+                random = random * 1103515245u + 12345u;
+                skinControllerData.getJointIndices().append( (int)((random >> 8) % 50) );
+                skinControllerData.getWeightIndices().append( (random >> 16) % 100 );
+            }
+        }
+
+        COLLADAFW::SkinInfluenceConverter converter;
+        converter.setWeightFormat( COLLADAFW::SkinInfluenceConverter::WEIGHT_FORMAT_UNORM8 );
+        JointIndices jointIndices( 4 * vertexCount );
+        std::vector<unsigned char> weights( 4 * vertexCount );
+        converter.convert( skinControllerData, &jointIndices[0], &weights[0] );
+
+        bool sumsMatch = true;
+        bool sorted = true;
+        for ( size_t vertex = 0; vertex < vertexCount; ++vertex )
+        {
+            unsigned int sum = 0;
+            for ( size_t influence = 0; influence < 4; ++influence )
+            {
+                sum += weights[influence * vertexCount + vertex];
+                if ( influence > 0 )
+                    sorted &= weights[(influence - 1) * vertexCount + vertex] + 1 >= weights[influence * vertexCount + vertex];
+            }
+            sumsMatch &= sum == (vertex % 7 == 0 ? 0u : 255u);
+        }
+        check( sumsMatch, "the quantized weights of every vertex with influences sum up to 255" );
+        check( sorted, "the weights are sorted descending" );
+
+        JointIndices interleavedJointIndices( 4 * vertexCount );
+        std::vector<unsigned char> interleavedWeights( 4 * vertexCount );
+        converter.setLayout( COLLADAFW::SkinInfluenceConverter::LAYOUT_INTERLEAVED );
+        converter.setParallel( true );
+        converter.convert( skinControllerData, &interleavedJointIndices[0], &interleavedWeights[0] );
+
+        bool layoutsMatch = true;
+        for ( size_t vertex = 0; vertex < vertexCount; ++vertex )
+        {
+            for ( size_t influence = 0; influence < 4; ++influence )
+            {
+                layoutsMatch &= interleavedJointIndices[vertex * 4 + influence] == jointIndices[influence * vertexCount + vertex];
+                layoutsMatch &= interleavedWeights[vertex * 4 + influence] == weights[influence * vertexCount + vertex];
+            }
+        }
+        check( layoutsMatch, "the parallel interleaved conversion is the transposed sequential one" );
+    }
+}
+
+
+int main()
+{
+    testSelection();
+    testQuantization<unsigned char>( COLLADAFW::SkinInfluenceConverter::WEIGHT_FORMAT_UNORM8, 0xFF );
+    testQuantization<unsigned short>( COLLADAFW::SkinInfluenceConverter::WEIGHT_FORMAT_UNORM16, 0xFFFF );
+    testLargeController();
+
+    if ( failures > 0 )
+        return -1;
+
+    std::cout << "All SkinInfluenceConverter tests passed" << std::endl;
+    return 0;
+}
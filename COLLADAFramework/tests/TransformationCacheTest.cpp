@@ -0,0 +1,212 @@
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWTransformationCache.h"
+#include "COLLADAFWVisualScene.h"
+#include "COLLADAFWLibraryNodes.h"
+#include "COLLADAFWNode.h"
+#include "COLLADAFWInstanceNode.h"
+#include "COLLADAFWTranslate.h"
+#include "COLLADAFWRotate.h"
+#include "COLLADAFWScale.h"
+
+#include <iostream>
+#include <cmath>
+
+
+// Builds the matrices of nested nodes and of nodes instantiated from library nodes and checks them against
+// the expected world positions and against the matrices of the nodes.
+
+namespace
+{
+    int failures = 0;
+
+    void check( bool condition, const char* description )
+    {
+        if ( !condition )
+        {
+            std::cerr << "FAILED: " << description << std::endl;
+            ++failures;
+        }
+    }
+
+    COLLADAFW::UniqueId createNodeId( COLLADAFW::ObjectId objectId )
+    {
+        return COLLADAFW::UniqueId( COLLADAFW::COLLADA_TYPE::NODE, objectId, 0 );
+    }
+
+    COLLADAFW::Node* createNode( COLLADAFW::ObjectId objectId, COLLADAFW::Transformation* transformation )
+    {
+        COLLADAFW::Node* node = new COLLADAFW::Node( createNodeId( objectId ) );
+        if ( transformation )
+            node->getTransformations().append( transformation );
+        return node;
+    }
+
+    void instantiate( COLLADAFW::Node* node, const COLLADAFW::Node* instantiatedNode )
+    {
+        COLLADAFW::UniqueId instanceId( COLLADAFW::COLLADA_TYPE::INSTANCE_NODE, node->getInstanceNodes().getCount(), 0 );
+        node->getInstanceNodes().append( new COLLADAFW::InstanceNode( instanceId, instantiatedNode->getUniqueId() ) );
+    }
+
+    /** True, if the translation of the row major @a matrix is ( @a x, @a y, @a z ).*/
+    bool hasTranslation( const double* matrix, double x, double y, double z )
+    {
+        return std::fabs( matrix[3] - x ) < 1e-9 && std::fabs( matrix[7] - y ) < 1e-9 && std::fabs( matrix[11] - z ) < 1e-9;
+    }
+
+    bool equals( const double* matrix, const COLLADABU::Math::Matrix4& expected )
+    {
+        for ( int i = 0; i < 16; ++i )
+        {
+            if ( std::fabs( matrix[i] - expected.getElement( i / 4, i % 4 ) ) > 1e-9 )
+                return false;
+        }
+        return true;
+    }
+
+    /** Multiplies the local matrices of the nodes from @a entry up to the root.*/
+    COLLADABU::Math::Matrix4 calculateWorldMatrix( const COLLADAFW::TransformationCache& cache, size_t entry )
+    {
+        COLLADABU::Math::Matrix4 worldMatrix = cache.getNode( entry )->getTransformationMatrix();
+        for ( size_t parent = cache.getParent( entry ); parent != COLLADAFW::TransformationCache::INVALID_ENTRY; parent = cache.getParent( parent ) )
+            worldMatrix = cache.getNode( parent )->getTransformationMatrix() * worldMatrix;
+        return worldMatrix;
+    }
+
+    void testNestedNodes()
+    {
+        // root translated, child rotated by 90 degrees around z and scaled, grand child translated along x
+        COLLADAFW::VisualScene visualScene( COLLADAFW::UniqueId::INVALID );
+        COLLADAFW::Node* root = createNode( 1, new COLLADAFW::Translate( 1, 2, 3 ) );
+        COLLADAFW::Node* child = createNode( 2, new COLLADAFW::Rotate( 0, 0, 1, 90 ) );
+        child->getTransformations().append( new COLLADAFW::Scale( 2, 2, 2 ) );
+        COLLADAFW::Node* grandChild = createNode( 3, new COLLADAFW::Translate( 1, 0, 0 ) );
+        child->getChildNodes().append( grandChild );
+        root->getChildNodes().append( child );
+        visualScene.getRootNodes().append( root );
+        COLLADAFW::Node* secondRoot = createNode( 4, 0 );
+        visualScene.getRootNodes().append( secondRoot );
+
+        COLLADAFW::TransformationCache cache;
+        cache.build( visualScene );
+
+        check( cache.getEntryCount() == 4, "one entry per node" );
+        size_t rootEntry = cache.findEntry( root->getUniqueId() );
+        size_t childEntry = cache.findEntry( child->getUniqueId() );
+        size_t grandChildEntry = cache.findEntry( grandChild->getUniqueId() );
+        size_t secondRootEntry = cache.findEntry( secondRoot->getUniqueId() );
+        check( rootEntry == 0 && childEntry == 1 && grandChildEntry == 2 && secondRootEntry == 3, "the entries are in depth first order" );
+        check( cache.findEntry( createNodeId( 99 ) ) == COLLADAFW::TransformationCache::INVALID_ENTRY, "unknown nodes have no entry" );
+        if ( cache.getEntryCount() != 4 || grandChildEntry != 2 )
+            return;
+
+        check( cache.getParent( rootEntry ) == COLLADAFW::TransformationCache::INVALID_ENTRY
+            && cache.getParent( grandChildEntry ) == childEntry, "the parents of the entries" );
+        check( cache.getNextOccurrence( grandChildEntry ) == COLLADAFW::TransformationCache::INVALID_ENTRY, "nodes that are not instantiated occur once" );
+
+        // (1,0,0) scaled to (2,0,0), rotated to (0,2,0), translated to (1,4,3)
+        check( hasTranslation( cache.getWorldMatrix( grandChildEntry ), 1, 4, 3 ), "the world position of the grand child" );
+        check( hasTranslation( cache.getLocalMatrix( grandChildEntry ), 1, 0, 0 ), "the local matrix of the grand child" );
+        check( hasTranslation( cache.getWorldMatrix( secondRootEntry ), 0, 0, 0 ), "a root node without transformations" );
+
+        bool matchesNodes = true;
+        for ( size_t entry = 0; entry < cache.getEntryCount(); ++entry )
+        {
+            matchesNodes &= equals( cache.getLocalMatrix( entry ), cache.getNode( entry )->getTransformationMatrix() );
+            matchesNodes &= equals( cache.getWorldMatrix( entry ), calculateWorldMatrix( cache, entry ) );
+        }
+        check( matchesNodes, "the matrices are the products of the transformation matrices of the nodes" );
+
+        COLLADABU::Math::Matrix4 worldMatrix;
+        cache.getWorldMatrix( grandChildEntry, worldMatrix );
+        check( equals( cache.getWorldMatrix( grandChildEntry ), worldMatrix ), "the world matrix as Matrix4" );
+
+        // animations change the transformations, update recalculates all matrices
+        ((COLLADAFW::Translate*)root->getTransformations()[0])->setTranslation( 0, 0, 0 );
+        cache.update();
+        check( hasTranslation( cache.getWorldMatrix( grandChildEntry ), 0, 2, 0 ), "update recalculates the world matrices" );
+    }
+
+    void testInstanceNodes()
+    {
+        // library node with a child, instantiated by two nodes of the visual scene
+        COLLADAFW::LibraryNodes libraryNodes;
+        COLLADAFW::Node* libraryNode = createNode( 10, new COLLADAFW::Translate( 0, 0, 5 ) );
+        COLLADAFW::Node* libraryChild = createNode( 11, new COLLADAFW::Translate( 0, 1, 0 ) );
+        libraryNode->getChildNodes().append( libraryChild );
+        libraryNodes.getNodes().append( libraryNode );
+
+        COLLADAFW::VisualScene visualScene( COLLADAFW::UniqueId::INVALID );
+        COLLADAFW::Node* first = createNode( 1, new COLLADAFW::Translate( 1, 0, 0 ) );
+        COLLADAFW::Node* second = createNode( 2, new COLLADAFW::Scale( 2, 2, 2 ) );
+        COLLADAFW::Node* shared = createNode( 3, new COLLADAFW::Translate( 0, 0, 1 ) );
+        instantiate( first, libraryNode );
+        instantiate( second, libraryNode );
+        // a node of the visual scene instantiated by its sibling and a node instantiating itself
+        instantiate( second, shared );
+        instantiate( shared, shared );
+        visualScene.getRootNodes().append( first );
+        visualScene.getRootNodes().append( second );
+        visualScene.getRootNodes().append( shared );
+
+        COLLADAFW::TransformationCache cache;
+        cache.addLibraryNodes( libraryNodes );
+        cache.build( visualScene );
+
+        // first, library node, library child, second, library node, library child, shared, shared
+        check( cache.getEntryCount() == 8, "instantiated nodes get one entry per instance, self instances are ignored" );
+        if ( cache.getEntryCount() != 8 )
+            return;
+
+        size_t firstLibraryNodeEntry = cache.findEntry( libraryNode->getUniqueId() );
+        size_t secondLibraryNodeEntry = cache.getNextOccurrence( firstLibraryNodeEntry );
+        check( firstLibraryNodeEntry == 1 && secondLibraryNodeEntry == 4, "the occurrences of an instantiated node" );
+        check( cache.getNextOccurrence( secondLibraryNodeEntry ) == COLLADAFW::TransformationCache::INVALID_ENTRY, "the last occurrence" );
+        if ( firstLibraryNodeEntry != 1 || secondLibraryNodeEntry != 4 )
+            return;
+
+        check( cache.getParent( firstLibraryNodeEntry ) == 0 && cache.getParent( secondLibraryNodeEntry ) == 3, "instantiated nodes are children of the instantiating nodes" );
+        check( hasTranslation( cache.getWorldMatrix( firstLibraryNodeEntry ), 1, 0, 5 ), "the library node instantiated by the first node" );
+        check( hasTranslation( cache.getWorldMatrix( firstLibraryNodeEntry + 1 ), 1, 1, 5 ), "the child of the library node instantiated by the first node" );
+        check( hasTranslation( cache.getWorldMatrix( secondLibraryNodeEntry ), 0, 0, 10 ), "the library node instantiated by the scaled node" );
+        check( hasTranslation( cache.getWorldMatrix( secondLibraryNodeEntry + 1 ), 0, 2, 10 ), "the child of the library node instantiated by the scaled node" );
+
+        size_t sharedEntry = cache.findEntry( shared->getUniqueId() );
+        size_t rootSharedEntry = cache.getNextOccurrence( sharedEntry );
+        check( sharedEntry == 6 && cache.getParent( sharedEntry ) == 3, "a node of the visual scene instantiated by another node" );
+        check( hasTranslation( cache.getWorldMatrix( sharedEntry ), 0, 0, 2 ), "the world matrix of the instantiated scene node" );
+        check( rootSharedEntry == 7 && cache.getParent( rootSharedEntry ) == COLLADAFW::TransformationCache::INVALID_ENTRY,
+            "the root occurrence of the instantiated scene node" );
+
+        bool matchesNodes = true;
+        for ( size_t entry = 0; entry < cache.getEntryCount(); ++entry )
+            matchesNodes &= equals( cache.getWorldMatrix( entry ), calculateWorldMatrix( cache, entry ) );
+        check( matchesNodes, "the world matrices are the products of the transformation matrices along the instance path" );
+
+        // parallel calculation gives the same matrices
+        std::vector<double> worldMatrices;
+        for ( size_t entry = 0; entry < cache.getEntryCount(); ++entry )
+            worldMatrices.insert( worldMatrices.end(), cache.getWorldMatrix( entry ), cache.getWorldMatrix( entry ) + 16 );
+        cache.setParallel( true );
+        cache.update();
+        bool sameMatrices = true;
+        for ( size_t entry = 0; entry < cache.getEntryCount(); ++entry )
+            sameMatrices &= std::equal( cache.getWorldMatrix( entry ), cache.getWorldMatrix( entry ) + 16, &worldMatrices[16 * entry] );
+        check( sameMatrices, "the parallel update gives the same matrices" );
+
+        cache.clear();
+        check( cache.getEntryCount() == 0 && cache.findEntry( libraryNode->getUniqueId() ) == COLLADAFW::TransformationCache::INVALID_ENTRY, "clear removes all entries" );
+    }
+}
+
+
+int main()
+{
+    testNestedNodes();
+    testInstanceNodes();
+
+    if ( failures > 0 )
+        return -1;
+
+    std::cout << "All TransformationCache tests passed" << std::endl;
+    return 0;
+}
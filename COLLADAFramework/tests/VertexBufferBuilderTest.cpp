@@ -0,0 +1,210 @@
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWVertexBufferBuilder.h"
+#include "COLLADAFWMesh.h"
+#include "COLLADAFWTriangles.h"
+#include "COLLADAFWPolygons.h"
+#include "COLLADAFWIndexList.h"
+
+#include <iostream>
+#include <cmath>
+
+
+// Builds vertex buffers of small meshes and checks the welded vertices, the indices and the sub meshes.
+
+namespace
+{
+    int failures = 0;
+
+    void check( bool condition, const char* description )
+    {
+        if ( !condition )
+        {
+            std::cerr << "FAILED: " << description << std::endl;
+            ++failures;
+        }
+    }
+
+    typedef COLLADAFW::VertexBufferBuilder::SubMesh SubMesh;
+    typedef COLLADAFW::VertexBufferBuilder::SubMeshList SubMeshList;
+
+    void appendValues( COLLADAFW::MeshVertexData& data, const float* values, size_t count, size_t stride )
+    {
+        COLLADAFW::FloatArray valuesArray;
+        valuesArray.appendValues( values, count );
+        data.appendValues( valuesArray, "", stride );
+    }
+
+    void appendIndices( COLLADAFW::UIntValuesArray& indices, const unsigned int* values, size_t count )
+    {
+        indices.appendValues( values, count );
+    }
+
+    /** A unit quad in the xy plane, two normals and one uv coordinate per position.*/
+    void fillQuadVertexData( COLLADAFW::Mesh& mesh )
+    {
+        const float positions[] = { 0,0,0,  1,0,0,  1,1,0,  0,1,0 };
+        const float normals[] = { 0,0,1,  0,0,-1 };
+        const float uvCoords[] = { 0,0,  1,0,  1,1,  0,1 };
+        appendValues( mesh.getPositions(), positions, 12, 3 );
+        appendValues( mesh.getNormals(), normals, 6, 3 );
+        appendValues( mesh.getUVCoords(), uvCoords, 8, 2 );
+    }
+
+    /** Appends triangles with the position and uv indices @a indices and the normal index @a normalIndex
+    for all corners.*/
+    COLLADAFW::Triangles* appendTriangles( COLLADAFW::Mesh& mesh, const unsigned int* indices, size_t count, unsigned int normalIndex, COLLADAFW::MaterialId materialId )
+    {
+        COLLADAFW::Triangles* triangles = new COLLADAFW::Triangles( COLLADAFW::UniqueId::INVALID );
+        appendIndices( triangles->getPositionIndices(), indices, count );
+        for ( size_t i = 0; i < count; ++i )
+            triangles->getNormalIndices().append( normalIndex );
+        COLLADAFW::IndexList* uvIndices = new COLLADAFW::IndexList();
+        appendIndices( uvIndices->getIndices(), indices, count );
+        uvIndices->setStride( 2 );
+        triangles->appendUVCoordIndices( uvIndices );
+        triangles->setMaterialId( materialId );
+        mesh.appendPrimitive( triangles );
+        return triangles;
+    }
+
+    bool equals( const float* values, float x, float y, float z )
+    {
+        return std::fabs( values[0] - x ) < 1e-6f && std::fabs( values[1] - y ) < 1e-6f && std::fabs( values[2] - z ) < 1e-6f;
+    }
+
+    void testWeldedQuad()
+    {
+        COLLADAFW::Mesh mesh( COLLADAFW::UniqueId::INVALID );
+        fillQuadVertexData( mesh );
+        const unsigned int indices[] = { 0, 1, 2,  0, 2, 3 };
+        appendTriangles( mesh, indices, 6, 0, 1 );
+
+        COLLADAFW::VertexBufferBuilder builder;
+        SubMeshList subMeshes;
+        builder.build( mesh, subMeshes );
+
+        check( subMeshes.size() == 1, "one sub mesh per material id" );
+        if ( subMeshes.size() != 1 )
+            return;
+        const SubMesh& subMesh = subMeshes[0];
+
+        check( subMesh.mMaterialId == 1, "the sub mesh has the material id of the primitive" );
+        check( subMesh.mPositionOffset == 0 && subMesh.mNormalOffset == 3, "positions and normals are interleaved first" );
+        check( subMesh.mTangentOffset == COLLADAFW::VertexBufferBuilder::NO_OFFSET
+            && subMesh.mBinormalOffset == COLLADAFW::VertexBufferBuilder::NO_OFFSET, "missing attributes have no offset" );
+        check( subMesh.mUVSets.size() == 1 && subMesh.mUVSets[0].mOffset == 6 && subMesh.mUVSets[0].mDimension == 2,
+            "the uv set follows the normal with the stride of its index list" );
+        check( subMesh.mColorSets.empty(), "no color sets" );
+        check( subMesh.mVertexStride == 8, "the vertex stride is the sum of all attributes" );
+
+        // the six corners share four vertices
+        check( subMesh.mVertexCount == 4, "corners with the same indices are welded" );
+        check( subMesh.mVertices.size() == 4 * 8, "the vertex buffer contains the welded vertices only" );
+        check( !subMesh.mHas32BitIndices && subMesh.getIndexCount() == 6, "small sub meshes use 16 bit indices" );
+        if ( subMesh.mVertexCount != 4 || subMesh.getIndexCount() != 6 || subMesh.mHas32BitIndices )
+            return;
+
+        const unsigned short expectedIndices[] = { 0, 1, 2,  0, 2, 3 };
+        bool indicesMatch = true;
+        for ( size_t i = 0; i < 6; ++i )
+            indicesMatch &= subMesh.mIndices16[i] == expectedIndices[i];
+        check( indicesMatch, "the vertices are numbered in the order they are first referenced" );
+
+        const float* vertex = &subMesh.mVertices[2 * 8];
+        check( equals( vertex, 1, 1, 0 ), "the position of the third vertex" );
+        check( equals( vertex + 3, 0, 0, 1 ), "the normal of the third vertex" );
+        check( vertex[6] == 1 && vertex[7] == 1, "the uv coordinate of the third vertex" );
+    }
+
+    void testNoWeldingOfDifferentNormals()
+    {
+        COLLADAFW::Mesh mesh( COLLADAFW::UniqueId::INVALID );
+        fillQuadVertexData( mesh );
+        const unsigned int indices[] = { 0, 1, 2 };
+        appendTriangles( mesh, indices, 3, 0, 1 );
+        appendTriangles( mesh, indices, 3, 1, 1 );
+
+        COLLADAFW::VertexBufferBuilder builder;
+        builder.setAllow16BitIndices( false );
+        SubMeshList subMeshes;
+        builder.build( mesh, subMeshes );
+
+        check( subMeshes.size() == 1, "primitives with the same material id share a sub mesh" );
+        if ( subMeshes.size() != 1 )
+            return;
+        const SubMesh& subMesh = subMeshes[0];
+
+        check( subMesh.mVertexCount == 6, "corners with the same position but different normals are not welded" );
+        check( subMesh.mHas32BitIndices && subMesh.mIndices32.size() == 6 && subMesh.mIndices16.empty(), "32 bit indices, if 16 bit indices are not allowed" );
+        if ( subMesh.mVertexCount != 6 || subMesh.mIndices32.size() != 6 )
+            return;
+
+        check( subMesh.mIndices32[3] == 3 && subMesh.mIndices32[5] == 5, "the second triangle gets new vertices" );
+        check( equals( &subMesh.mVertices[3 * 8], 0, 0, 0 ) && equals( &subMesh.mVertices[3 * 8 + 3], 0, 0, -1 ),
+            "the vertex of the second triangle has the position of the first one and its own normal" );
+    }
+
+    void testSubMeshesPerMaterial()
+    {
+        COLLADAFW::Mesh mesh( COLLADAFW::UniqueId::INVALID );
+        fillQuadVertexData( mesh );
+        const unsigned int firstTriangle[] = { 0, 1, 2 };
+        const unsigned int secondTriangle[] = { 0, 2, 3 };
+        appendTriangles( mesh, firstTriangle, 3, 0, 7 );
+        appendTriangles( mesh, secondTriangle, 3, 0, 3 );
+        appendTriangles( mesh, secondTriangle, 3, 0, 7 );
+
+        // only positions
+        COLLADAFW::VertexBufferBuilder builder;
+        builder.setAttributes( COLLADAFW::VertexBufferBuilder::ATTRIBUTE_POSITION );
+        SubMeshList subMeshes;
+        builder.build( mesh, subMeshes );
+
+        check( subMeshes.size() == 2, "one sub mesh per distinct material id" );
+        if ( subMeshes.size() != 2 )
+            return;
+
+        check( subMeshes[0].mMaterialId == 7 && subMeshes[1].mMaterialId == 3, "the sub meshes are in the order the material ids first appear" );
+        check( subMeshes[0].mVertexStride == 3 && subMeshes[0].mNormalOffset == COLLADAFW::VertexBufferBuilder::NO_OFFSET
+            && subMeshes[0].mUVSets.empty(), "only the selected attributes are written" );
+        check( subMeshes[0].mVertexCount == 4 && subMeshes[0].getIndexCount() == 6, "the primitives of a material are merged and welded" );
+        check( subMeshes[1].mVertexCount == 3 && subMeshes[1].getIndexCount() == 3, "the vertices of a sub mesh are independent of the other sub meshes" );
+        if ( subMeshes[1].mVertexCount == 3 )
+            check( equals( &subMeshes[1].mVertices[2 * 3], 0, 1, 0 ), "the last vertex of the second sub mesh" );
+    }
+
+    void testPolygon()
+    {
+        COLLADAFW::Mesh mesh( COLLADAFW::UniqueId::INVALID );
+        fillQuadVertexData( mesh );
+
+        COLLADAFW::Polygons* polygons = new COLLADAFW::Polygons( COLLADAFW::UniqueId::INVALID );
+        const unsigned int indices[] = { 0, 1, 2, 3 };
+        appendIndices( polygons->getPositionIndices(), indices, 4 );
+        polygons->getGroupedVerticesVertexCountArray().append( 4 );
+        mesh.appendPrimitive( polygons );
+
+        COLLADAFW::VertexBufferBuilder builder;
+        SubMeshList subMeshes;
+        builder.build( mesh, subMeshes );
+
+        check( subMeshes.size() == 1 && subMeshes[0].mVertexCount == 4 && subMeshes[0].getIndexCount() == 6,
+            "a quad is triangulated into two triangles sharing four vertices" );
+        check( subMeshes.size() == 1 && subMeshes[0].mVertexStride == 3, "primitives without normals and uv coordinates only have positions" );
+    }
+}
+
+
+int main()
+{
+    testWeldedQuad();
+    testNoWeldingOfDifferentNormals();
+    testSubMeshesPerMaterial();
+    testPolygon();
+
+    if ( failures > 0 )
+        return -1;
+
+    std::cout << "All VertexBufferBuilder tests passed" << std::endl;
+    return 0;
+}
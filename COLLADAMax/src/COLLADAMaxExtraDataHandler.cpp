@@ -45,7 +45,7 @@ namespace COLLADAMax
 		, mExtraTagType(EXTRA_TAG_TYPE_UNKNOWN)
 		, mCurrentElementUniqueId()
 	{
-
+		addProfile("OpenCOLLADA3dsMax");
 	}
 
 	//------------------------------
@@ -62,6 +62,10 @@ namespace COLLADASaxFWL
 		/** Maps the id of a collada element to the corresponding sit tree node.*/
 		Loader::IdStringSidTreeNodeMap& mIdStringSidTreeNodeMap;
 
+		/** Caches the sid tree nodes sid addresses have already been resolved to. Cleared whenever the sid tree 
+		changes.*/
+		Loader::SidPathSidTreeNodeMap& mResolvedSidPaths;
+
 		/** List of all visual scenes in the file. They are send to the writer and deleted, when the file has 
 		completely been parsed.*/
 		Loader::VisualSceneList& mVisualScenes;
@@ -122,6 +126,9 @@ namespace COLLADASaxFWL
 		/** Error handler to be used. */
 		SaxParserErrorHandler* mSaxParserErrorHandler;
 
+		/** The statistics to collect or null, if statistics are not collected.*/
+		LoaderStatistics* mStatistics;
+
 	public:
 		/** Constructor.
 		@param colladaLoader The collada loader this file loader is being used by. Used to retrieve document 
@@ -146,6 +153,9 @@ namespace COLLADASaxFWL
 		/** Returns error handler for xml parser. */
 		SaxParserErrorHandler* getErrorHandler() {return mSaxParserErrorHandler;}
 
+		/** The statistics to collect or null, if statistics are not collected.*/
+		LoaderStatistics* getStatistics() { return mStatistics; }
+
         /** The handler to handle the extra data elements. */
         ExtraDataElementHandler& getExtraDataElementHandler () { return mExtraDataElementHandler; }
 
@@ -247,6 +257,9 @@ namespace COLLADASaxFWL
 		/** Tries to resolve the a sidaddress. If resolving failed, null is returned.*/
 		const SidTreeNode* resolveSid( const COLLADABU::URI& id, const String& sid);
 
+		/** Resolves the sids of @a sidAddress, without using the cache of resolved sid paths.*/
+		const SidTreeNode* resolveSidUncached( const SidAddress& sidAddress);
+
 		/** Resolves an sid in the element referenced by @a instancingElement. It uses the sids ins @a sidAddress, 
 		starting with sid with index @a firstSidIndex. */
 		const SidTreeNode* resolveSidInInstance( const SidTreeNode* instancingElement, const SidAddress& sidAddress,  size_t firstSidIndex);
@@ -317,6 +330,12 @@ namespace COLLADASaxFWL
 		/** Returns a const pointer to the COLLADA document. */
 		const Loader* getColladaLoader() const { return mColladaLoader; }
 
+		/** Prepares the document processor for the next file of its collada loader, that might have replaced 
+		its sid tree or changed the statistics to collect since the previous file.
+		@param saxParserErrorHandler The error handler all sax parser errors should be passed to.
+		@param objectFlags Flags (Loader::ObjectFlags) of objects that should be parsed.*/
+		void resetDocumentProcessor( SaxParserErrorHandler* saxParserErrorHandler, int objectFlags );
+
 	private:
 		friend class VersionParser;
 
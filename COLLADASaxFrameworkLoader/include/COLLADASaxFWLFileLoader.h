@@ -85,11 +85,22 @@ namespace COLLADASaxFWL
         /** Destructor. */
         virtual ~FileLoader();
 
+		/** Prepares the file loader to load another file. The parameters are the same as those of the 
+		constructor.*/
+		void reset( const COLLADABU::URI& fileURI, 
+					SaxParserErrorHandler* saxParserErrorHandler, 
+					int objectFlags,
+					const ExtraDataCallbackHandlerList& extraDataCallbackHandlerList );
+
 		/** Sets the parser to @a parserToBeSet.*/
         void setParser( COLLADASaxFWL14::ColladaParserAutoGen14* parserToBeSet );
         /** Sets the parser to @a parserToBeSet.*/
         void setParser( COLLADASaxFWL15::ColladaParserAutoGen15* parserToBeSet );
 
+		/** Starts the timing of @a partLoader, if statistics are collected. The timing is stopped, when the
+		next parser is set, i.e. when the part loader has finished.*/
+		void startPartLoaderTiming( LoaderStatistics::PartLoader partLoader );
+
 	        /** Loads the data into the frame work data model.*/
 		bool load();
 		bool load( const char* buffer, int length );
@@ -113,6 +124,10 @@ namespace COLLADASaxFWL
 		If level is invalid or it is called, while no version parser is aktive, 0 is returned.*/
 		StringHash getElementHash( size_t level = 0 ) const ;
 
+		/** Skips the content of the element, whose begin function is currently called. Its child elements
+		are not passed to any handler. Does nothing, if no version parser is active.*/
+		void skipElementContent();
+
 	protected:
         void setSaxParser( GeneratedSaxParser::SaxParser* parserToBeSet ) { mXmlSaxParser = parserToBeSet; }
         /** Sets the private parser to @a parserToBeSet.*/
@@ -126,6 +141,9 @@ namespace COLLADASaxFWL
     private:
 		friend class VersionParser;
 
+		/** Deletes the root parser and the part loader of the loaded file.*/
+		void releaseParsers();
+
         /** Disable default copy ctor. */
 		FileLoader( const FileLoader& pre );
 
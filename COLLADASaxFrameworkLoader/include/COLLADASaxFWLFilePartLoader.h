@@ -51,6 +51,16 @@ namespace COLLADASaxFWL
 		parse process.*/
 		int getObjectFlags() const;
 
+		/** Returns true, if the writer requires the object data @a objectData (COLLADAFW::IWriter::ObjectData).
+		Loaders should neither store nor copy data, that is not required.*/
+		bool isObjectDataRequired( int objectData );
+
+		/** Lets the parser skip the content of the element, whose begin function is currently called, if
+		the writer does not require its data. The content is still parsed, if the parser has been compiled with
+		GENERATEDSAXPARSER_VALIDATION.
+		@return True, if the content will be skipped.*/
+		bool skipNotRequiredElementContent();
+
 
         /** Sets the parser to @a parserToBeSet.*/
         virtual void setParser( COLLADASaxFWL14::ColladaParserAutoGen14* parserToBeSet );
@@ -46,6 +46,9 @@ namespace COLLADASaxFWL
 		new material is returned. 
 		If the symbol is empty, always 0 is returned.*/
 		COLLADAFW::MaterialId getMaterialId( const String& symbol);
+
+		/** Removes all symbols. The next material id is 1 again.*/
+		void clear();
 	};
 
 } // namespace COLLADASAXFWL
@@ -14,6 +14,8 @@
 #include "COLLADASaxFWLPrerequisites.h"
 #include "COLLADASaxFWLXmlTypes.h"
 
+#include <vector>
+
 
 namespace COLLADASaxFWL
 {
@@ -21,6 +23,14 @@ namespace COLLADASaxFWL
     /** The callback handler to handle the reading of extra data. */
 	class IExtraDataCallbackHandler 	
     {
+    public:
+        typedef std::vector<String> ProfileList;
+
+	private:
+
+        /** The technique profiles the handler wants to read. If empty, all profiles are passed to 
+        parseElement(). */
+        ProfileList mProfiles;
 	
 	public:
 
@@ -41,6 +51,18 @@ namespace COLLADASaxFWL
             const StringHash& elementHash, 
             const COLLADAFW::UniqueId& uniqueId ) = 0;
 
+        /** Declares, that the handler wants to read the techniques with profile @a profileName. Techniques
+        with other profiles are not passed to parseElement(). If no handler wants to read a technique, the 
+        parser skips its content without any callbacks. If no profile is declared, the handler is asked 
+        for the techniques of all profiles. */
+        void addProfile ( const String& profileName );
+
+        /** The technique profiles declared with addProfile(). */
+        const ProfileList& getProfiles () const { return mProfiles; }
+
+        /** Returns true, if techniques with profile @a profileName are passed to parseElement(). */
+        bool handlesProfile ( const ParserChar* profileName ) const;
+
 	private:
 
         /** Disable default copy constructor. */
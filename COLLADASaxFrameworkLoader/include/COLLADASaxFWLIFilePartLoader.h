@@ -305,6 +305,9 @@ namespace COLLADASaxFWL
 		when creating a new FilePartLoader and switching to it.*/
 		void deleteFilePartLoader();
 
+		/** Deletes the parser implementation mParserImpl.*/
+		void deleteParserImpl();
+
 	private:
 
         /** Disable default copy ctor. */
@@ -826,6 +826,9 @@ namespace COLLADASaxFWL
         /** Destructor. */
 		virtual ~KinematicsIntermediateData();
 
+		/** Deletes the data, as the destructor does, and empties all lists.*/
+		void clear();
+
 	private:
 
         /** Disable default copy ctor. */
@@ -116,7 +116,7 @@ namespace COLLADASaxFWL
         virtual const COLLADAFW::UniqueId& getUniqueId();
 
 		/** Write the indices of the v element into the framework.*/
-		bool writeVIndices ( const sint64* data, size_t length );
+		bool writeVIndices ( const sint32* data, size_t length );
 
 		/** Sets the String list, the values of an id_ref or name_array should be stored in.
 		@param isIdArray If true, values are stored in idMap otherwise in in sid map*/
@@ -160,12 +160,12 @@ namespace COLLADASaxFWL
 
 		virtual bool begin__vcount();
 		virtual bool end__vcount();
-		virtual bool data__vcount( const unsigned long long*, size_t length );
+		virtual bool data__vcount( const uint32* data, size_t length );
 
 
 		virtual bool begin__v();
 		virtual bool end__v();
-		virtual bool data__v( const sint64* data, size_t length );
+		virtual bool data__v( const sint32* data, size_t length );
 
 
 		virtual bool begin__Name_array( const Name_array__AttributeData& attributeData );
@@ -0,0 +1,78 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADASAXFWL_LOADSESSION_H__
+#define __COLLADASAXFWL_LOADSESSION_H__
+
+#include "COLLADASaxFWLPrerequisites.h"
+
+#include "COLLADAFWIWriter.h"
+
+
+namespace COLLADASaxFWL
+{
+	class Loader;
+
+	/** Loads many independent documents with one Loader. Before each document but the first, the data the 
+	loader collected for the previous one is removed. The generated parsers, their memory and the capacity of
+	the containers of the loader are kept, which makes loading many small documents considerably faster than
+	creating a new Loader for each of them. The object ids keep counting, so the unique ids of the objects of
+	different documents never collide.
+	The settings of the loader, e.g. the object flags and the extra data callback handlers, apply to all
+	documents of the session.*/
+	class LoadSession 
+	{
+	private:
+		/** The loader used for all documents.*/
+		Loader& mLoader;
+
+		/** The number of documents loaded so far.*/
+		size_t mDocumentCount;
+
+	public:
+
+        /** Constructor. */
+		LoadSession( Loader& loader );
+
+        /** Destructor. */
+		virtual ~LoadSession();
+
+		/** Loads the document @a fileName and all documents referenced by it, independently of the 
+		documents loaded before, and passes its objects to @a writer.
+		@return True, if loading succeeded, false otherwise.*/
+		bool loadDocument( const String& fileName, COLLADAFW::IWriter* writer );
+
+		/** Loads the document with uri @a uri from the @a length bytes in @a buffer and all documents 
+		referenced by it, independently of the documents loaded before, and passes its objects to @a writer.
+		@return True, if loading succeeded, false otherwise.*/
+		bool loadDocument( const String& uri, const char* buffer, int length, COLLADAFW::IWriter* writer );
+
+		/** The number of documents loaded so far.*/
+		size_t getDocumentCount() const { return mDocumentCount; }
+
+		/** The loader used for all documents.*/
+		Loader& getLoader() { return mLoader; }
+
+	private:
+
+		/** Removes the data of the previous document from the loader, if there is one.*/
+		void prepareDocument();
+
+        /** Disable default copy ctor. */
+		LoadSession( const LoadSession& pre );
+
+        /** Disable default assignment operator. */
+		const LoadSession& operator= ( const LoadSession& pre );
+
+	};
+
+} // namespace COLLADASAXFWL
+
+#endif // __COLLADASAXFWL_LOADSESSION_H__
@@ -16,6 +16,7 @@
 #include "COLLADASaxFWLSidTreeNode.h"
 #include "COLLADASaxFWLKinematicsIntermediateData.h"
 #include "COLLADASaxFWLTypes.h"
+#include "COLLADASaxFWLLoaderStatistics.h"
 
 #include "COLLADAFWILoader.h"
 #include "COLLADAFWLoaderUtils.h"
@@ -43,6 +44,23 @@ namespace COLLADAFW
 	class MorphController;
 }
 
+namespace GeneratedSaxParser
+{
+	class IErrorHandler;
+}
+
+namespace COLLADASaxFWL14
+{
+	class ColladaParserAutoGen14;
+	class ColladaParserAutoGen14Private;
+}
+
+namespace COLLADASaxFWL15
+{
+	class ColladaParserAutoGen15;
+	class ColladaParserAutoGen15Private;
+}
+
 
 namespace COLLADASaxFWL
 {
@@ -51,6 +69,8 @@ namespace COLLADASaxFWL
 	class DocumentProcessor;
 	class PostProcessor;
     class FileLoader;
+	class SaxParserErrorHandler;
+	struct FilteredFunctionMaps;
 
 
 	typedef std::list<String> StringList;
@@ -103,6 +123,9 @@ namespace COLLADASaxFWL
 		/** Maps the id of a collada element to the corresponding sit tree node.*/
 		typedef std::map<String /*id*/, SidTreeNode*> IdStringSidTreeNodeMap;
 
+		/** Maps the id and sids of a sid address, separated by '/', to the sid tree node it has been resolved to.*/
+		typedef COLLADABU::hash_map<String /*sid path*/, const SidTreeNode*> SidPathSidTreeNodeMap;
+
 		/** Maps unique ids of animation list to the corresponding animation list.*/
 		typedef std::map< COLLADAFW::UniqueId , COLLADAFW::AnimationList* > UniqueIdAnimationListMap;
 
@@ -240,6 +263,10 @@ namespace COLLADASaxFWL
 		/** Maps the id of a collada element to the corresponding sit tree node.*/
 		IdStringSidTreeNodeMap mIdStringSidTreeNodeMap;
 
+		/** Caches the sid tree nodes sid addresses have already been resolved to. Cleared whenever the sid tree 
+		changes.*/
+		SidPathSidTreeNodeMap mResolvedSidPaths;
+
 		/** List of all visual scenes in the file. They are send to the writer and deleted, when the file has 
 		completely been parsed.*/
 		VisualSceneList mVisualScenes;
@@ -298,6 +325,28 @@ namespace COLLADASaxFWL
 		/** The call back function used to decide which filed should be leaded.*/
 		ExternalReferenceDeciderCallbackFunction mExternalReferenceDeciderCallbackFunction;
 
+		/** If true, mStatistics are collected by loadDocument().*/
+		bool mCollectStatistics;
+
+		/** The statistics collected by the last call of loadDocument() with mCollectStatistics set.*/
+		LoaderStatistics mStatistics;
+
+		/** The generated parser for COLLADA 1.4 files. Created when the first 1.4 file is parsed and reused
+		for all following files, so that its function and name maps are built only once.*/
+		COLLADASaxFWL14::ColladaParserAutoGen14Private* mPrivateParser14;
+
+		/** The generated parser for COLLADA 1.5 files. Created when the first 1.5 file is parsed and reused
+		for all following files.*/
+		COLLADASaxFWL15::ColladaParserAutoGen15Private* mPrivateParser15;
+
+		/** The function maps of the generated parsers, that contain only the elements required for the object
+		flags. Each is created, when it is needed the first time, and reused for all following files.*/
+		FilteredFunctionMaps* mFilteredFunctionMaps;
+
+		/** The file loader used to load the files. Created when the first file is loaded and reset for all
+		following files. mFileLoader points to it, while a file is loaded.*/
+		FileLoader* mReusableFileLoader;
+
 	public:
 
         /** Constructor. */
@@ -352,11 +401,53 @@ namespace COLLADASaxFWL
 		assigned to any Uri, an invalid uri is returned.*/
 		const COLLADABU::URI& getFileUri( COLLADAFW::FileId fileId )const;
 
+		/** If set to true, loadDocument() collects statistics about the loaded document, that can be 
+		retrieved using getStatistics(). Disabled by default, since measuring the time spent in the writer
+		methods adds a small overhead to each of them.*/
+		void setCollectStatistics( bool collectStatistics ) { mCollectStatistics = collectStatistics; }
+
+		/** If true, loadDocument() collects statistics about the loaded document.*/
+		bool getCollectStatistics() const { return mCollectStatistics; }
+
+		/** The statistics collected by the last call of loadDocument() with statistics enabled.*/
+		const LoaderStatistics& getStatistics() const { return mStatistics; }
+
 	private:
 		friend class IFilePartLoader;
 		friend class FileLoader;
 		friend class PostProcessor;
 		friend class DocumentProcessor;
+		friend class VersionParser;
+		friend class LoadSession;
+
+		/** Loads the document @a rootFileUri and all documents referenced by it. If @a buffer is not null,
+		the root document is parsed from the @a length bytes in @a buffer instead of being read from file.*/
+		bool load( const COLLADABU::URI& rootFileUri, const char* buffer, int length, COLLADAFW::IWriter* writer );
+
+		/** Removes all data collected while loading the previous documents, so that the next document is 
+		loaded independently of them. The objects are deleted and the containers are emptied. The object 
+		ids and the generated parsers are kept. Must not be called while a document is loaded.*/
+		void resetDocumentData();
+
+		/** Deletes the objects the loader owns, i.e. those that are sent to the writer after the document 
+		has been parsed.*/
+		void deleteDocumentObjects();
+
+		/** Returns the generated parser for COLLADA 1.4 files, prepared to parse a new file with @a impl and
+		@a errorHandler. The parser is owned by the loader.*/
+		COLLADASaxFWL14::ColladaParserAutoGen14Private* getPrivateParser14( COLLADASaxFWL14::ColladaParserAutoGen14* impl, GeneratedSaxParser::IErrorHandler* errorHandler );
+
+		/** Returns the generated parser for COLLADA 1.5 files, prepared to parse a new file with @a impl and
+		@a errorHandler. The parser is owned by the loader.*/
+		COLLADASaxFWL15::ColladaParserAutoGen15Private* getPrivateParser15( COLLADASaxFWL15::ColladaParserAutoGen15* impl, GeneratedSaxParser::IErrorHandler* errorHandler );
+
+		/** Returns the function maps of the generated parsers, that contain only the elements required for 
+		the object flags. They are owned by the loader.*/
+		FilteredFunctionMaps& getFilteredFunctionMaps();
+
+		/** Returns the file loader, prepared to load the file with uri @a fileUri with the current object
+		flags and extra data callback handlers. The file loader is owned by the loader.*/
+		FileLoader* getReusableFileLoader( const COLLADABU::URI& fileUri, SaxParserErrorHandler* saxParserErrorHandler );
 
 		/** The version of the collada document.*/
 		void setCOLLADAVersion(COLLADAVersion cOLLADAVersion) { mCOLLADAVersion = cOLLADAVersion; }
@@ -364,6 +455,9 @@ namespace COLLADASaxFWL
 		/** The error handler to pass the errors to.*/
 		IErrorHandler* getErrorHandler() {return mErrorHandler;}
 
+		/** The statistics to collect during loading or null, if statistics are not collected.*/
+		LoaderStatistics* getStatisticsToCollect() { return mCollectStatistics ? &mStatistics : 0; }
+
 		/** Returns the COLLADAFW::UniqueId of the element with uri @a uri. If the uri has been 
 		passed to this method before, the same 	COLLADAFW::UniqueId will be returned, if not, a 
 		new one is created.
@@ -407,6 +501,9 @@ namespace COLLADASaxFWL
 		/** Maps the id of a collada element to the corresponding sit tree node.*/
 		IdStringSidTreeNodeMap& getIdStringSidTreeNodeMap() { return mIdStringSidTreeNodeMap; }
 
+		/** Caches the sid tree nodes sid addresses have already been resolved to.*/
+		SidPathSidTreeNodeMap& getResolvedSidPaths() { return mResolvedSidPaths; }
+
 		/** List of all visual scenes in the file. They are send to the writer and deleted, when the file has 
 		completely been parsed.*/
 		VisualSceneList& getVisualScenes() { return mVisualScenes; }
@@ -0,0 +1,247 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADASAXFWL_LOADERSTATISTICS_H__
+#define __COLLADASAXFWL_LOADERSTATISTICS_H__
+
+#include "COLLADASaxFWLPrerequisites.h"
+
+#include "GeneratedSaxParserParserTemplateBase.h"
+
+
+namespace COLLADASaxFWL
+{
+
+	/** Counters and timings collected by the Loader while loading a document, including all documents
+	referenced by it. Collecting them is disabled by default, see Loader::setCollectStatistics().
+	All times are wall clock times in seconds. The time of a part loader or post processing phase includes
+	the time spent in the writer methods called by it.*/
+	class LoaderStatistics
+	{
+	public:
+		typedef GeneratedSaxParser::ParserTemplateBase::ValueType ValueType;
+
+		/** The part loaders started for the root elements of a COLLADA document.*/
+		enum PartLoader
+		{
+			PART_LOADER_ASSET,
+			PART_LOADER_SCENE,
+			PART_LOADER_VISUAL_SCENE,
+			PART_LOADER_GEOMETRY,
+			PART_LOADER_LIBRARY_NODES,
+			PART_LOADER_LIBRARY_MATERIALS,
+			PART_LOADER_LIBRARY_EFFECTS,
+			PART_LOADER_LIBRARY_CAMERAS,
+			PART_LOADER_LIBRARY_LIGHTS,
+			PART_LOADER_LIBRARY_IMAGES,
+			PART_LOADER_LIBRARY_ANIMATIONS,
+			PART_LOADER_LIBRARY_CONTROLLERS,
+			PART_LOADER_LIBRARY_FORMULAS,
+			PART_LOADER_LIBRARY_JOINTS,
+			PART_LOADER_LIBRARY_KINEMATICS_MODELS,
+			PART_LOADER_LIBRARY_ARTICULATED_SYSTEMS,
+			PART_LOADER_LIBRARY_KINEMATICS_SCENES,
+			PART_LOADER_COUNT
+		};
+
+		/** The phases of the PostProcessor, in the order they are executed.*/
+		enum PostProcessingPhase
+		{
+			PHASE_CREATE_MISSING_ANIMATION_LISTS,
+			PHASE_WRITE_EFFECTS,
+			PHASE_WRITE_LIGHTS,
+			PHASE_WRITE_CAMERAS,
+			PHASE_CREATE_AND_WRITE_SKIN_CONTROLLERS,
+			PHASE_WRITE_MORPH_CONTROLLERS,
+			PHASE_WRITE_VISUAL_SCENES,
+			PHASE_WRITE_LIBRARY_NODES,
+			PHASE_WRITE_ANIMATION_LISTS,
+			PHASE_LINK_AND_WRITE_FORMULAS,
+			PHASE_CREATE_AND_WRITE_KINEMATICS_SCENE,
+			PHASE_COUNT
+		};
+
+		/** The methods of COLLADAFW::IWriter.*/
+		enum WriterMethod
+		{
+			WRITER_CANCEL,
+			WRITER_START,
+			WRITER_FINISH,
+			WRITER_GLOBAL_ASSET,
+			WRITER_SCENE,
+			WRITER_VISUAL_SCENE,
+			WRITER_LIBRARY_NODES,
+			WRITER_GEOMETRY,
+			WRITER_MATERIAL,
+			WRITER_EFFECT,
+			WRITER_CAMERA,
+			WRITER_IMAGE,
+			WRITER_LIGHT,
+			WRITER_ANIMATION,
+			WRITER_ANIMATION_LIST,
+			WRITER_SKIN_CONTROLLER_DATA,
+			WRITER_CONTROLLER,
+			WRITER_FORMULAS,
+			WRITER_KINEMATICS_SCENE,
+			WRITER_METHOD_COUNT
+		};
+
+		/** The number of times something has been executed and the total time it took.*/
+		struct Timing
+		{
+			/** Number of executions.*/
+			size_t count;
+
+			/** Total time in seconds.*/
+			double time;
+		};
+
+	private:
+		/** The number of files parsed.*/
+		size_t mFileCount;
+
+		/** The number of bytes read from all files.*/
+		size_t mBytesRead;
+
+		/** The number of elements in all files.*/
+		size_t mElementCount;
+
+		/** The number of values converted from character data and attributes, per ValueType.*/
+		size_t mConvertedValueCounts[GeneratedSaxParser::ParserTemplateBase::VALUE_TYPE_COUNT];
+
+		/** The time spent parsing the files, including all part loaders.*/
+		double mParseTime;
+
+		/** The time spent in the PostProcessor.*/
+		double mPostProcessingTime;
+
+		/** The time spent in Loader::loadDocument().*/
+		double mTotalTime;
+
+		/** The peak memory usage of the process after loading the document.*/
+		size_t mPeakMemoryUsage;
+
+		/** Timings of the part loaders.*/
+		Timing mPartLoaderTimings[PART_LOADER_COUNT];
+
+		/** Timings of the post processing phases.*/
+		Timing mPostProcessingTimings[PHASE_COUNT];
+
+		/** Timings of the writer methods.*/
+		Timing mWriterTimings[WRITER_METHOD_COUNT];
+
+		/** The part loader currently running or PART_LOADER_COUNT, if none is running.*/
+		PartLoader mRunningPartLoader;
+
+		/** The time the running part loader has been started at.*/
+		double mRunningPartLoaderStartTime;
+
+	public:
+
+        /** Constructor. */
+		LoaderStatistics();
+
+        /** Destructor. */
+		virtual ~LoaderStatistics();
+
+		/** Sets all counters and timings to zero.*/
+		void reset();
+
+		/** The number of files parsed.*/
+		size_t getFileCount() const { return mFileCount; }
+
+		/** The number of bytes read from all files.*/
+		size_t getBytesRead() const { return mBytesRead; }
+
+		/** The number of elements in all files.*/
+		size_t getElementCount() const { return mElementCount; }
+
+		/** The number of values of type @a valueType converted from character data and attributes.*/
+		size_t getConvertedValueCount( ValueType valueType ) const { return mConvertedValueCounts[valueType]; }
+
+		/** The time spent parsing the files, including all part loaders.*/
+		double getParseTime() const { return mParseTime; }
+
+		/** The time spent in the PostProcessor.*/
+		double getPostProcessingTime() const { return mPostProcessingTime; }
+
+		/** The time spent in Loader::loadDocument().*/
+		double getTotalTime() const { return mTotalTime; }
+
+		/** The peak memory usage of the process in bytes, measured after the document has been loaded.
+		Zero, if it is not available on this platform.*/
+		size_t getPeakMemoryUsage() const { return mPeakMemoryUsage; }
+
+		/** Timing of @a partLoader.*/
+		const Timing& getPartLoaderTiming( PartLoader partLoader ) const { return mPartLoaderTimings[partLoader]; }
+
+		/** Timing of @a phase.*/
+		const Timing& getPostProcessingTiming( PostProcessingPhase phase ) const { return mPostProcessingTimings[phase]; }
+
+		/** Timing of @a writerMethod.*/
+		const Timing& getWriterTiming( WriterMethod writerMethod ) const { return mWriterTimings[writerMethod]; }
+
+		/** The name of @a valueType, e.g. "float".*/
+		static const char* getValueTypeName( ValueType valueType );
+
+		/** The name of the element @a partLoader is started for, e.g. "library_effects".*/
+		static const char* getPartLoaderName( PartLoader partLoader );
+
+		/** The name of the PostProcessor member executing @a phase, e.g. "linkAndWriteFormulas".*/
+		static const char* getPostProcessingPhaseName( PostProcessingPhase phase );
+
+		/** The name of the IWriter member @a writerMethod, e.g. "writeGeometry".*/
+		static const char* getWriterMethodName( WriterMethod writerMethod );
+
+		/** Returns the current time in seconds, measured by a monotonic high resolution clock. Only the
+		differences of the returned values are meaningful.*/
+		static double getTime();
+
+		/** Returns the peak memory usage of the process in bytes or zero, if it is not available.*/
+		static size_t getProcessPeakMemoryUsage();
+
+	private:
+		friend class Loader;
+		friend class FileLoader;
+		friend class VersionParser;
+		friend class PostProcessor;
+		friend class StatisticsWriter;
+
+        /** Disable default copy ctor. */
+		LoaderStatistics( const LoaderStatistics& pre );
+
+        /** Disable default assignment operator. */
+		const LoaderStatistics& operator= ( const LoaderStatistics& pre );
+
+		/** Adds the counters of a parsed file.*/
+		void addFile( size_t bytesRead, size_t elementCount, double parseTime );
+
+		/** Adds @a count converted values of type @a valueType.*/
+		void addConvertedValues( ValueType valueType, size_t count ) { mConvertedValueCounts[valueType] += count; }
+
+		/** Starts the timing of @a partLoader. A part loader still running is stopped.*/
+		void startPartLoader( PartLoader partLoader );
+
+		/** Stops the timing of the running part loader, if any.*/
+		void stopPartLoader();
+
+		/** Adds @a time to the timing of @a phase.*/
+		void addPostProcessingTime( PostProcessingPhase phase, double time );
+
+		/** Adds @a time to the timing of @a writerMethod.*/
+		void addWriterTime( WriterMethod writerMethod, double time );
+
+		/** Sets the total time and the peak memory usage, after the document has been loaded.*/
+		void finish( double totalTime );
+	};
+
+} // namespace COLLADASAXFWL
+
+#endif // __COLLADASAXFWL_LOADERSTATISTICS_H__
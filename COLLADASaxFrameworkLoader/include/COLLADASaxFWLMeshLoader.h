@@ -229,7 +229,7 @@ namespace COLLADASaxFWL
 		virtual bool end__p();
 
 		/** Sax callback function for the data of a p within a triangles element element.*/
-		virtual bool data__p( const unsigned long long* data, size_t length );
+		virtual bool data__p( const uint32* data, size_t length );
 
 
 		/** Sax callback function for the beginning of a polylist element.*/
@@ -260,7 +260,7 @@ namespace COLLADASaxFWL
 		virtual bool end__vcount();
 
 		/** Sax callback function for the data of a polylist vcount element.*/
-		virtual bool data__vcount( const unsigned long long*, size_t length );
+		virtual bool data__vcount( const uint32* data, size_t length );
 
 
 		/** Sax callback function for the beginning of a polygons element.*/
@@ -284,7 +284,7 @@ namespace COLLADASaxFWL
 		virtual bool end__h();
 
 		/** Sax callback function for the data of a polygons h element inside a ph element.*/
-		virtual bool data__h( const uint64* data, size_t length );
+		virtual bool data__h( const uint32* data, size_t length );
 
 
 		/** Sax callback function for the beginning of a polygons element.*/
@@ -372,7 +372,7 @@ namespace COLLADASaxFWL
         void initializePositionsOffset ();
 
 		/** Writes all the indices in data into the indices array of the current mesh primitive.*/
-		bool writePrimitiveIndices ( const unsigned long long* data, size_t length );
+		bool writePrimitiveIndices ( const uint32* data, size_t length );
 
         /**
          * Get the number of all indices in all p elements in the current primitive element.
@@ -59,6 +59,10 @@ namespace COLLADASaxFWL
 
 	private:
 
+		/** Executes @a phase and adds the time it took to the statistics, if statistics are collected.*/
+		template<class ProcessorType, class ReturnType>
+		void executePhase( ReturnType (ProcessorType::*phase)(), LoaderStatistics::PostProcessingPhase statisticsPhase );
+
 		/** Writes all the visual scenes.*/
 		void writeVisualScenes();
 
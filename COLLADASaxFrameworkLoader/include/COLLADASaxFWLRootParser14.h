@@ -14,6 +14,7 @@
 #include "COLLADASaxFWLPrerequisites.h"
 #include "COLLADASaxFWLIParserImpl14.h"
 #include "COLLADASaxFWLExtraDataLoader.h"
+#include "COLLADASaxFWLLoaderStatistics.h"
 
 
 namespace COLLADASaxFWL
@@ -86,13 +87,13 @@ namespace COLLADASaxFWL
         const RootParser14& operator=( const RootParser14& );
 
 		template<class Loader, class Loader14>
-		Loader* beginCommon();
+		Loader* beginCommon( LoaderStatistics::PartLoader partLoader );
 
 		template<class Loader, class Loader14>
-		Loader* beginCommonWithId( const char * id);
+		Loader* beginCommonWithId( LoaderStatistics::PartLoader partLoader, const char * id);
 
 		template<class Loader, class Loader14>
-		Loader* beginCommonCTorWithId(  const char * id );
+		Loader* beginCommonCTorWithId( LoaderStatistics::PartLoader partLoader, const char * id );
 
 
     };
@@ -14,6 +14,7 @@
 #include "COLLADASaxFWLPrerequisites.h"
 #include "COLLADASaxFWLIParserImpl15.h"
 #include "COLLADASaxFWLExtraDataLoader.h"
+#include "COLLADASaxFWLLoaderStatistics.h"
 
 
 namespace COLLADASaxFWL
@@ -101,13 +102,13 @@ namespace COLLADASaxFWL
         const RootParser15& operator=( const RootParser15& );
 
 		template<class Loader, class Loader15>
-		Loader* beginCommon( );
+		Loader* beginCommon( LoaderStatistics::PartLoader partLoader );
 
 		template<class Loader, class Loader15>
-		Loader* beginCommonWithId( const char * id);
+		Loader* beginCommonWithId( LoaderStatistics::PartLoader partLoader, const char * id);
 
 		template<class Loader, class Loader15>
-		Loader* beginCommonCTorWithId(  const char * id );
+		Loader* beginCommonCTorWithId( LoaderStatistics::PartLoader partLoader, const char * id );
 
     };
 }
@@ -15,7 +15,8 @@
 #include "COLLADAFWAnimatable.h"
 #include "COLLADAFWObject.h"
 
-#include <map>
+#include "COLLADABUhash_map.h"
+
 #include <vector>
 
 namespace COLLADASaxFWL
@@ -31,21 +32,22 @@ namespace COLLADASaxFWL
 	class SidTreeNode 	
 	{
 	public:
-		struct SidIdentifier
+		/** A node in the sub hierarchy of another node.*/
+		struct Descendant
 		{
-			SidIdentifier( const String& _sid, size_t _hierarchyLevel)
-				: sid(_sid), hierarchyLevel(_hierarchyLevel){}
+			Descendant() : node(0), hierarchyLevel(0){}
+			Descendant( SidTreeNode* _node, size_t _hierarchyLevel)
+				: node(_node), hierarchyLevel(_hierarchyLevel){}
 
-			const String& sid;
+			SidTreeNode* node;
 
 			/** Defines how deep in the hierarchy the node is placed. For the determination of the hierarchy level
 			only elements with an sid are considered.*/
 			size_t hierarchyLevel;
-
-			bool operator<(const SidIdentifier& rhs)const;
 		};
 
-		typedef std::map< SidIdentifier, SidTreeNode*> SidIdentifierSidTreeNodeMap;
+		/** Maps sids to the descendant with the lowest hierarchy level that has this sid.*/
+		typedef COLLADABU::hash_map< String /*sid*/, Descendant> SidDescendantMap;
 
 		typedef std::vector< SidTreeNode*> SidTreeNodeList;
 
@@ -69,9 +71,10 @@ namespace COLLADASaxFWL
 		/** The parent node.*/
 		SidTreeNode *mParent;
 
-		/** Maps sids to the children. One sid can appear more than once, since COLLADA allows sids to appear more than once
-		in different technique elements of the same parent.*/
-		SidIdentifierSidTreeNodeMap mChildren;
+		/** Maps sids to the children in the entire sub hierarchy. One sid can appear more than once, since COLLADA
+		allows sids to appear more than once in different technique elements of the same parent. Only the one with
+		the lowest hierarchy level is stored, and of those the one added first.*/
+		SidDescendantMap mChildren;
 
 		/** List of all direct children. Is used to delete all of them.*/
 		SidTreeNodeList mDirectChildren;
@@ -138,8 +141,15 @@ namespace COLLADASaxFWL
         /** Disable default assignment operator. */
 		const SidTreeNode& operator= ( const SidTreeNode& pre );
 
-		/** Adds @a sidTreeNode to the children map of all the parent nodes. For each level in the hierarchy */
-		void addChildToParents( SidTreeNode *sidTreeNode, const SidIdentifier& sidIdentifier);
+		/** Adds @a descendant to the children map of this node, if it does not already contain a node with the same
+		sid on the same or a lower hierarchy level.
+		@return True, if the children map has been changed.*/
+		bool addDescendant( const Descendant& descendant );
+
+		/** Adds @a descendant to the children map of all the parent nodes. For each level in the hierarchy. Stops at 
+		the first parent that already contains a better node with the same sid, since all of its parents contain it
+		as well.*/
+		void addChildToParents( const Descendant& descendant );
 
 	};
 
@@ -48,6 +48,10 @@ namespace COLLADASaxFWL
 		/** The id of the array being parsed.*/
 		String mCurrentArrayId;
 
+		/** If false, the values of float arrays are neither allocated nor stored. Derived classes set this, if
+		the writer does not require the data of the objects they load. Default is true.*/
+		bool mLoadArrayValues;
+
 	public:
 		/** Takes a null terminated string, that represents an uriFragment of URIFragmentType defined in the 
 		COLLADA XSD and returns the id it points to.*/
@@ -170,7 +174,8 @@ namespace COLLADASaxFWL
 	SourceType* SourceArrayLoader::beginArray( uint64 count,  const ParserChar* id )
 	{
 		SourceType* newSource = new SourceType();
-		newSource->getArrayElement().getValues().allocMemory((size_t)count);
+		if ( mLoadArrayValues )
+			newSource->getArrayElement().getValues().allocMemory((size_t)count);
 		newSource->setId(mCurrentSourceId);
 		mCurrentSoure = newSource;
 		if ( id )
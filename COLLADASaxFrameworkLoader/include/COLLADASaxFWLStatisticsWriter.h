@@ -0,0 +1,95 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADASAXFWL_STATISTICSWRITER_H__
+#define __COLLADASAXFWL_STATISTICSWRITER_H__
+
+#include "COLLADASaxFWLPrerequisites.h"
+#include "COLLADASaxFWLLoaderStatistics.h"
+
+#include "COLLADAFWIWriter.h"
+
+
+namespace COLLADASaxFWL
+{
+
+	/** Writer that passes all calls to another writer and adds the time spent in each of its methods to 
+	a LoaderStatistics. Used by the Loader, if statistics are collected.*/
+	class StatisticsWriter : public COLLADAFW::IWriter
+	{
+	private:
+		/** The writer all calls are passed to.*/
+		COLLADAFW::IWriter* mWriter;
+
+		/** The statistics the times are added to.*/
+		LoaderStatistics& mStatistics;
+
+	public:
+
+        /** Constructor. */
+		StatisticsWriter( COLLADAFW::IWriter* writer, LoaderStatistics& statistics );
+
+        /** Destructor. */
+		virtual ~StatisticsWriter();
+
+		virtual void cancel( const String& errorMessage );
+
+		virtual void start();
+
+		virtual void finish();
+
+		virtual bool writeGlobalAsset( const COLLADAFW::FileInfo* asset );
+
+		virtual bool writeScene( const COLLADAFW::Scene* scene );
+
+		virtual bool writeVisualScene( const COLLADAFW::VisualScene* visualScene );
+
+		virtual bool writeLibraryNodes( const COLLADAFW::LibraryNodes* libraryNodes );
+
+		virtual bool writeGeometry( const COLLADAFW::Geometry* geometry );
+
+		virtual bool writeMaterial( const COLLADAFW::Material* material );
+
+		virtual bool writeEffect( const COLLADAFW::Effect* effect );
+
+		virtual bool writeCamera( const COLLADAFW::Camera* camera );
+
+		virtual bool writeImage( const COLLADAFW::Image* image );
+
+		virtual bool writeLight( const COLLADAFW::Light* light );
+
+		virtual bool writeAnimation( const COLLADAFW::Animation* animation );
+
+		virtual bool writeAnimationList( const COLLADAFW::AnimationList* animationList );
+
+		virtual bool writeSkinControllerData( const COLLADAFW::SkinControllerData* skinControllerData );
+
+		virtual bool writeController( const COLLADAFW::Controller* controller );
+
+		virtual bool writeFormulas( const COLLADAFW::Formulas* formulas );
+
+		virtual bool writeKinematicsScene( const COLLADAFW::KinematicsScene* kinematicsScene );
+
+	private:
+
+        /** Disable default copy ctor. */
+		StatisticsWriter( const StatisticsWriter& pre );
+
+        /** Disable default assignment operator. */
+		const StatisticsWriter& operator= ( const StatisticsWriter& pre );
+
+		/** Calls @a write of mWriter with @a object and adds the time it took to @a writerMethod.*/
+		template<class ObjectType>
+		bool timedWrite( bool (COLLADAFW::IWriter::*write)( const ObjectType* ), const ObjectType* object, LoaderStatistics::WriterMethod writerMethod );
+	};
+
+} // namespace COLLADASAXFWL
+
+#endif // __COLLADASAXFWL_STATISTICSWRITER_H__
@@ -31,6 +31,18 @@ namespace COLLADASaxFWL
 {
     class FileLoader;
 
+    /** Function maps of the generated parsers, that contain only the elements required to parse the objects of
+    certain object flags. They are keyed by the COLLADA libraries they contain, which the VersionParser 
+    determines from the object flags. Owned by the Loader, so that each is built once for all files it loads.*/
+    struct FilteredFunctionMaps
+    {
+        typedef std::map< int, COLLADASaxFWL14::ColladaParserAutoGen14Private::ElementFunctionMap > FunctionMaps14;
+        typedef std::map< int, COLLADASaxFWL15::ColladaParserAutoGen15Private::ElementFunctionMap > FunctionMaps15;
+
+        FunctionMaps14 functionMaps14;
+        FunctionMaps15 functionMaps15;
+    };
+
     /**
      * Starts parsing a file to find out which COLLADA version it uses.
      * Creates appropriate parser and continues with that.
@@ -38,11 +50,6 @@ namespace COLLADASaxFWL
     class VersionParser : public GeneratedSaxParser::Parser
     {
     private:
-        /** The function map we use to parse the COLLADA file. It contains only those elements that are required 
-        to parse all the objects listed in given flags.*/
-        COLLADASaxFWL14::ColladaParserAutoGen14Private::ElementFunctionMap mFunctionMap14;
-        COLLADASaxFWL15::ColladaParserAutoGen15Private::ElementFunctionMap mFunctionMap15;
-
         /** Private Parser for COLLADA 1.4 */
         COLLADASaxFWL14::ColladaParserAutoGen14Private* mPrivateParser14;
         /** Private Parser for COLLADA 1.5 */
@@ -72,6 +79,10 @@ namespace COLLADASaxFWL
 		If level is invalid, 0 is returned.*/
 		StringHash getElementHash( size_t level = 0 )const;
 
+		/** Skips the content of the element, whose begin function is currently called. See
+		GeneratedSaxParser::ParserTemplate::skipElementContent().*/
+		void skipElementContent();
+
         /**
         * Creates generated parser objects and starts parsing the input file. 
         * Will determine COLLADA version of input file and use appropriate parser.
@@ -80,10 +91,17 @@ namespace COLLADASaxFWL
         bool createAndLaunchParser(const char* buffer, int length);
 
     protected:
-        void createFunctionMap14();
-        void createFunctionMap15();
+        /** Returns the function map we use to parse the COLLADA file. It contains only those elements that are 
+        required to parse all the objects listed in given flags. Null is returned, if all elements are required.*/
+        const COLLADASaxFWL14::ColladaParserAutoGen14Private::ElementFunctionMap* createFunctionMap14();
+        /** See createFunctionMap14().*/
+        const COLLADASaxFWL15::ColladaParserAutoGen15Private::ElementFunctionMap* createFunctionMap15();
         bool parse14( const ParserChar* elementName, const ParserAttributes& attributes );
         bool parse15( const ParserChar* elementName, const ParserAttributes& attributes );
+
+        /** Adds the counters of @a saxParser and the private parser to the statistics of the file loader,
+        if statistics are collected.*/
+        void addToStatistics( const GeneratedSaxParser::SaxParser& saxParser, double parseTime );
     };
 }
 
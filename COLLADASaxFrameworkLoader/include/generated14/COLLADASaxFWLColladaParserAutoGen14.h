@@ -224,11 +224,11 @@ virtual bool end__input____InputLocalOffset(){return true;}
 
 virtual bool begin__vcount(){return true;}
 virtual bool end__vcount(){return true;}
-virtual bool data__vcount( const uint64* value, size_t length ){return true;}
+virtual bool data__vcount( const uint32* value, size_t length ){return true;}
 
 virtual bool begin__v(){return true;}
 virtual bool end__v(){return true;}
-virtual bool data__v( const sint64* value, size_t length ){return true;}
+virtual bool data__v( const sint32* value, size_t length ){return true;}
 
 virtual bool begin__morph( const morph__AttributeData& attributeData ){return true;}
 virtual bool end__morph(){return true;}
@@ -253,7 +253,7 @@ virtual bool end__lines(){return true;}
 
 virtual bool begin__p(){return true;}
 virtual bool end__p(){return true;}
-virtual bool data__p( const uint64* value, size_t length ){return true;}
+virtual bool data__p( const uint32* value, size_t length ){return true;}
 
 virtual bool begin__linestrips( const linestrips__AttributeData& attributeData ){return true;}
 virtual bool end__linestrips(){return true;}
@@ -266,7 +266,7 @@ virtual bool end__ph(){return true;}
 
 virtual bool begin__h(){return true;}
 virtual bool end__h(){return true;}
-virtual bool data__h( const uint64* value, size_t length ){return true;}
+virtual bool data__h( const uint32* value, size_t length ){return true;}
 
 virtual bool begin__polylist( const polylist__AttributeData& attributeData ){return true;}
 virtual bool end__polylist(){return true;}
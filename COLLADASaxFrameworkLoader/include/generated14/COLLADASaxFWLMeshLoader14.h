@@ -63,19 +63,19 @@ virtual bool begin__p();
 
 virtual bool end__p();
 
-virtual bool data__p( const uint64* data, size_t length );
+virtual bool data__p( const uint32* data, size_t length );
 
 virtual bool begin__vcount();
 
 virtual bool end__vcount();
 
-virtual bool data__vcount( const uint64* data, size_t length );
+virtual bool data__vcount( const uint32* data, size_t length );
 
 virtual bool begin__h();
 
 virtual bool end__h();
 
-virtual bool data__h( const uint64* data, size_t length );
+virtual bool data__h( const uint32* data, size_t length );
 
 virtual bool begin__triangles( const COLLADASaxFWL14::triangles__AttributeData& attributeData );
 
@@ -75,13 +75,13 @@ virtual bool begin__vcount();
 
 virtual bool end__vcount();
 
-virtual bool data__vcount( const uint64* data, size_t length );
+virtual bool data__vcount( const uint32* data, size_t length );
 
 virtual bool begin__v();
 
 virtual bool end__v();
 
-virtual bool data__v( const sint64* data, size_t length );
+virtual bool data__v( const sint32* data, size_t length );
 
 virtual bool begin__Name_array( const COLLADASaxFWL15::Name_array__AttributeData& attributeData );
 
@@ -26,6 +26,7 @@ namespace COLLADASaxFWL
 		: mColladaLoader( colladaLoader )
 		, mCurrentSidTreeNode( colladaLoader->getSidTreeRoot() )
 		, mIdStringSidTreeNodeMap( colladaLoader->getIdStringSidTreeNodeMap() )
+		, mResolvedSidPaths( colladaLoader->getResolvedSidPaths() )
 		, mVisualScenes( colladaLoader->getVisualScenes() )
 		, mLibraryNodes( colladaLoader->getLibraryNodes() )
 		, mEffects( colladaLoader->getEffects() )
@@ -42,9 +43,19 @@ namespace COLLADASaxFWL
 		, mSkinDataSkinSourceMap( colladaLoader->getSkinDataSkinSourceMap() )
 		, mSkinControllerSet( colladaLoader->getSkinControllerSet() )
 		, mSaxParserErrorHandler( saxParserErrorHandler )
+		, mStatistics( colladaLoader->getStatisticsToCollect() )
 	{
 
 	}	
+
+	//-----------------------------
+	void DocumentProcessor::resetDocumentProcessor( SaxParserErrorHandler* saxParserErrorHandler, int objectFlags )
+	{
+		mCurrentSidTreeNode = mColladaLoader->getSidTreeRoot();
+		mObjectFlags = objectFlags;
+		mSaxParserErrorHandler = saxParserErrorHandler;
+		mStatistics = mColladaLoader->getStatisticsToCollect();
+	}
     //------------------------------
 	DocumentProcessor::~DocumentProcessor()
 	{
@@ -55,6 +66,12 @@ namespace COLLADASaxFWL
 	{
 		mCurrentSidTreeNode = mCurrentSidTreeNode->createAndAddChild( colladaSid ? colladaSid : "");
 
+		// the new node might change the result of sid addresses already resolved
+		if ( !mResolvedSidPaths.empty() )
+		{
+			mResolvedSidPaths.clear();
+		}
+
 		if ( colladaId && *colladaId )
 		{
 			mIdStringSidTreeNodeMap[colladaId] = mCurrentSidTreeNode;
@@ -81,6 +98,29 @@ namespace COLLADASaxFWL
 		if ( !sidAddress.isValid() )
 			return 0;
 
+		// member selection and indices do not influence the sid tree node
+		String sidPath = sidAddress.getId();
+		const SidAddress::SidList& sids = sidAddress.getSids();
+		for ( size_t i = 0, count = sids.size(); i < count; ++i)
+		{
+			sidPath += '/';
+			sidPath += sids[i];
+		}
+
+		Loader::SidPathSidTreeNodeMap::const_iterator it = mResolvedSidPaths.find( sidPath );
+		if ( it != mResolvedSidPaths.end() )
+		{
+			return it->second;
+		}
+
+		const SidTreeNode* sidTreeNode = resolveSidUncached( sidAddress );
+		mResolvedSidPaths.insert( std::make_pair( sidPath, sidTreeNode ) );
+		return sidTreeNode;
+	}
+
+	//---------------------------------
+	const SidTreeNode* DocumentProcessor::resolveSidUncached( const SidAddress& sidAddress )
+	{
 		SidTreeNode* startingPoint = 0;
 		const String& id = sidAddress.getId();
 		if ( !id.empty() )
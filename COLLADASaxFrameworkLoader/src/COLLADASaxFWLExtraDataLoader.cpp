@@ -40,23 +40,33 @@ namespace COLLADASaxFWL
         // (profile name, element name ("optics"), id (cameraId)) 
         const ExtraDataCallbackHandlerList& extraDataCallbackHandlerList = extraDataElementHandler.getExtraDataCallbackHandlerList ();
         size_t numHandlers = extraDataCallbackHandlerList.size ();
+
+        // Get the hash value of the current element.
+        size_t level = 1;
+        StringHash elementHash = getFileLoader ()->getElementHash ( level );
+
+        // Get the profile name.
+        const ParserChar* profileName = attributeData.profile;
+
+        bool parseTechnique = false;
         for ( size_t i=0; i<numHandlers; ++i )
         {
             IExtraDataCallbackHandler* extraDataCallbackHandler = extraDataCallbackHandlerList[i];
 
-            // Get the hash value of the current element.
-            size_t level = 1;
-            StringHash elementHash = getFileLoader ()->getElementHash ( level );
-
-            // Get the profile name.
-            const ParserChar* profileName = attributeData.profile;
-
             // Ask, if the current handler should parse the extra tags of the current element.
-            bool parseElement = extraDataCallbackHandler->parseElement ( profileName, elementHash, uniqueId );
+            // Handlers, that have not declared the profile, are not asked at all.
+            bool parseElement = extraDataCallbackHandler->handlesProfile ( profileName ) 
+                && extraDataCallbackHandler->parseElement ( profileName, elementHash, uniqueId );
 
             // Store the flag in the list.
             extraDataElementHandler.setExtraDataCallbackHandlerCalling ( i, parseElement );
+            parseTechnique = parseTechnique || parseElement;
         }
+
+        // If no handler wants the data, the content of the technique is skipped by the parser.
+        if ( !parseTechnique )
+            getFileLoader ()->skipElementContent ();
+
         return true;
     }
 
@@ -14,6 +14,8 @@
 #include "COLLADASaxFWLSaxParserErrorHandler.h"
 #include "COLLADASaxFWLSidAddress.h"
 #include "COLLADASaxFWLVersionParser.h"
+#include "COLLADASaxFWLIParserImpl14.h"
+#include "COLLADASaxFWLIParserImpl15.h"
 #include "COLLADASaxFWLKinematicsSceneCreator.h"
 #include "COLLADASaxFWLFormulasLinker.h"
 
@@ -70,6 +72,19 @@ namespace COLLADASaxFWL
 	{
 	}
 
+	//-----------------------------
+	void FileLoader::reset( const COLLADABU::URI& fileURI, 
+							SaxParserErrorHandler* saxParserErrorHandler, 
+							int objectFlags,
+							const ExtraDataCallbackHandlerList& extraDataCallbackHandlerList )
+	{
+		resetDocumentProcessor( saxParserErrorHandler, objectFlags );
+		mFileURI = fileURI;
+		mParsingStatus = PARSING_NOT_STARTED;
+		mSaxParserErrorHandler = saxParserErrorHandler;
+		getExtraDataElementHandler ().setExtraDataCallbackHandlerList ( extraDataCallbackHandlerList );
+	}
+
 	//-----------------------------
 	bool FileLoader::load()
 	{
@@ -79,6 +94,7 @@ namespace COLLADASaxFWL
         bool success = parser.createAndLaunchParser();
         mParsingStatus = PARSING_FINISHED;
 		mVersionParser = 0;
+		releaseParsers();
         return success;
 	}
 
@@ -91,9 +107,18 @@ namespace COLLADASaxFWL
         bool success = parser.createAndLaunchParser( buffer, length );
         mParsingStatus = PARSING_FINISHED;
 		mVersionParser = 0;
+		releaseParsers();
         return success;
 	}    
 
+	//-----------------------------
+	void FileLoader::releaseParsers()
+	{
+		// the file loader is reused for the next file, which gets its own root parser
+		deleteFilePartLoader();
+		deleteParserImpl();
+	}
+
 	//-----------------------------
 	const COLLADABU::URI& FileLoader::getFileUri()
 	{
@@ -103,6 +128,10 @@ namespace COLLADASaxFWL
 	//-----------------------------
     void FileLoader::setParser( COLLADASaxFWL14::ColladaParserAutoGen14* parserToBeSet )
 	{
+		// part loaders set their own nested loaders, e.g. the mesh loader, as parser. The part
+		// loader is finished, when the root parser is set again.
+		if ( mStatistics && getParserImpl() && parserToBeSet == ((IParserImpl14*)getParserImpl())->getGeneratedParser() )
+			mStatistics->stopPartLoader();
 		COLLADABU_ASSERT(mPrivateParser14);
         mPrivateParser14->setCallbackObject(parserToBeSet);
 	}
@@ -110,10 +139,20 @@ namespace COLLADASaxFWL
     //-----------------------------
     void FileLoader::setParser( COLLADASaxFWL15::ColladaParserAutoGen15* parserToBeSet )
     {
+		// see setParser( COLLADASaxFWL14::ColladaParserAutoGen14* )
+		if ( mStatistics && getParserImpl() && parserToBeSet == ((IParserImpl15*)getParserImpl())->getGeneratedParser() )
+			mStatistics->stopPartLoader();
 		COLLADABU_ASSERT(mPrivateParser15);
         mPrivateParser15->setCallbackObject(parserToBeSet);
     }
 
+	//-----------------------------
+	void FileLoader::startPartLoaderTiming( LoaderStatistics::PartLoader partLoader )
+	{
+		if ( mStatistics )
+			mStatistics->startPartLoader( partLoader );
+	}
+
 	//-----------------------------
 	COLLADASaxFWL14::StringHash FileLoader::getElementHash( size_t level /*= 0 */ ) const 
 	{
@@ -123,4 +162,13 @@ namespace COLLADASaxFWL
 		}
 		return 0;
 	}
+
+	//------------------------------
+	void FileLoader::skipElementContent()
+	{
+		if ( mVersionParser )
+		{
+			mVersionParser->skipElementContent();
+		}
+	}
 } // namespace COLLADASaxFWL
@@ -13,6 +13,8 @@
 #include "COLLADASaxFWLFileLoader.h"
 #include "COLLADASaxFWLIParserImpl.h"
 
+#include "COLLADAFWIWriter.h"
+
 #include <cassert>
 
 
@@ -61,6 +63,24 @@ namespace COLLADASaxFWL
 		return getFileLoader()->getObjectFlags();
 	}
 
+	//------------------------------
+	bool FilePartLoader::isObjectDataRequired( int objectData )
+	{
+		return (writer()->getRequiredObjectData() & objectData) != 0;
+	}
+
+	//------------------------------
+	bool FilePartLoader::skipNotRequiredElementContent()
+	{
+#ifdef GENERATEDSAXPARSER_VALIDATION
+		// the validation needs the content
+		return false;
+#else
+		getFileLoader()->skipElementContent();
+		return true;
+#endif
+	}
+
 	//------------------------------
 	Loader* FilePartLoader::getColladaLoader()
 	{
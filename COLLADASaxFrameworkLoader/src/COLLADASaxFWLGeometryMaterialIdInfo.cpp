@@ -42,4 +42,11 @@ namespace COLLADASaxFWL
 
 	}
 
+	//---------------------------------
+	void GeometryMaterialIdInfo::clear()
+	{
+		mHighestMaterialId = 0;
+		mColladaSymbolMaterialIdMap.clear();
+	}
+
 } // namespace COLLADASaxFWL
@@ -25,4 +25,26 @@ namespace COLLADASaxFWL
     {
     }
 
+    //------------------------------
+    void IExtraDataCallbackHandler::addProfile ( const String& profileName )
+    {
+        mProfiles.push_back ( profileName );
+    }
+
+    //------------------------------
+    bool IExtraDataCallbackHandler::handlesProfile ( const ParserChar* profileName ) const
+    {
+        if ( mProfiles.empty () ) 
+            return true;
+        if ( !profileName ) 
+            return false;
+
+        for ( size_t i=0; i<mProfiles.size (); ++i )
+        {
+            if ( mProfiles[i] == profileName )
+                return true;
+        }
+        return false;
+    }
+
 } // namespace COLLADASaxFWL
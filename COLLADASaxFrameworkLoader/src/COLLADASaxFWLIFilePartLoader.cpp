@@ -33,11 +33,7 @@ namespace COLLADASaxFWL
 	IFilePartLoader::~IFilePartLoader()
 	{
 		deleteFilePartLoader();
-        if ( mParserImpl )
-        {
-            delete mParserImpl;
-            mParserImpl = 0;
-        }
+		deleteParserImpl();
 	}
 
 	//-----------------------------
@@ -158,6 +154,16 @@ namespace COLLADASaxFWL
 		}
 	}
 
+	//-----------------------------
+	void IFilePartLoader::deleteParserImpl()
+	{
+		if ( mParserImpl )
+		{
+			delete mParserImpl;
+			mParserImpl = 0;
+		}
+	}
+
 	//------------------------------
 	void IFilePartLoader::setMeAsParser()
 	{
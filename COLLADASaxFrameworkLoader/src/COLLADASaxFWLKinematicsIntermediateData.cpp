@@ -92,6 +92,27 @@ namespace COLLADASaxFWL
 		deleteVector(mInstanceKinematicsScenes);
 	}
 
+	//------------------------------
+	void KinematicsIntermediateData::clear()
+	{
+		deleteVectorFW(mJoints);
+		mJoints.clear();
+
+		deleteVectorFW(mInstanceJoints);
+		mInstanceJoints.clear();
+
+		deleteMap(mKinematicsModels);
+		mKinematicsModels.clear();
+
+		deleteMap(mKinematicsControllers);
+		mKinematicsControllers.clear();
+
+		mKinematicsScenes.clear();
+
+		deleteVector(mInstanceKinematicsScenes);
+		mInstanceKinematicsScenes.clear();
+	}
+
 	//------------------------------
 	KinematicsScene::~KinematicsScene()
 	{
@@ -283,7 +283,9 @@ namespace COLLADASaxFWL
 		, mCurrentlyParsingInterpolationArray(false)
 		, mCurrentAnimationInfo( 0 )
 		, mCurrentAnimationCurveRequiresTangents(true)
-	{}
+	{
+		mLoadArrayValues = isObjectDataRequired( COLLADAFW::IWriter::ANIMATION_CURVE_DATA );
+	}
 
     //------------------------------
 	LibraryAnimationsLoader::~LibraryAnimationsLoader()
@@ -391,7 +393,8 @@ namespace COLLADASaxFWL
 				mCurrentAnimationCurve->setInterpolationType(COLLADAFW::AnimationCurve::INTERPOLATION_LINEAR );
 			}
 
-			if ( COLLADAFW::validate( mCurrentAnimationCurve ) )
+			// curves without values, because the writer does not require them, cannot be validated
+			if ( !mLoadArrayValues || COLLADAFW::validate( mCurrentAnimationCurve ) )
 			{
 				success = writer()->writeAnimation(mCurrentAnimationCurve);
 				FW_DELETE mCurrentAnimationCurve;
@@ -89,7 +89,9 @@ namespace COLLADASaxFWL
 		, mCurrentOffset(0)
 		, mCurrentBindShapeMatrix( COLLADABU::Math::Matrix4::IDENTITY)
 		, mCurrentMatrixIndex(0)
-	{}
+	{
+		mLoadArrayValues = isObjectDataRequired( COLLADAFW::IWriter::CONTROLLER_DATA );
+	}
 
     //------------------------------
 	LibraryControllersLoader::~LibraryControllersLoader()
@@ -97,10 +99,10 @@ namespace COLLADASaxFWL
 	}
 
 	//------------------------------
-	bool LibraryControllersLoader::writeVIndices ( const sint64* data, size_t length )
+	bool LibraryControllersLoader::writeVIndices ( const sint32* data, size_t length )
 	{
 		// check, if we are parsing an unsupported primitive type
-		if ( !mCurrentSkinControllerData )
+		if ( !mCurrentSkinControllerData || !mLoadArrayValues )
 			return true;
 
 		// Write the index values in the index lists.
@@ -226,7 +228,8 @@ namespace COLLADASaxFWL
 	bool LibraryControllersLoader::end__skin()
 	{
 		bool success = true;
-		if ( validate( mCurrentSkinControllerData ) )
+		// skin controller data without values, because the writer does not require them, cannot be validated
+		if ( !mLoadArrayValues || validate( mCurrentSkinControllerData ) )
 		{
 			success = writer()->writeSkinControllerData( mCurrentSkinControllerData );
 		}
@@ -578,6 +581,8 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool LibraryControllersLoader::begin__vcount()
 	{
+		if ( !mLoadArrayValues )
+			skipNotRequiredElementContent();
 		return true;
 	}
 
@@ -588,18 +593,15 @@ namespace COLLADASaxFWL
 	}
 
 	//------------------------------
-	bool LibraryControllersLoader::data__vcount( const unsigned long long* data, size_t length )
+	bool LibraryControllersLoader::data__vcount( const uint32* data, size_t length )
 	{
-		if ( !mCurrentSkinControllerData )
+		if ( !mCurrentSkinControllerData || !mLoadArrayValues )
 			return true;
 		COLLADAFW::UIntValuesArray& jointsPerVertex = mCurrentSkinControllerData->getJointsPerVertex();
-		size_t count = jointsPerVertex.getCount();
-		jointsPerVertex.reallocMemory( count + length);
+		jointsPerVertex.appendValues( data, length );
 		for ( size_t i = 0; i < length; ++i)
 		{
-			unsigned long long vcount = data[i];
-			jointsPerVertex.append((unsigned int)vcount);
-			mCurrentJointsVertexPairCount += (size_t)vcount;
+			mCurrentJointsVertexPairCount += data[i];
 		}
 		return true;
 	}
@@ -607,6 +609,8 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool LibraryControllersLoader::begin__v()
 	{
+		if ( !mLoadArrayValues )
+			skipNotRequiredElementContent();
 		return true;
 	}
 
@@ -617,7 +621,7 @@ namespace COLLADASaxFWL
 	}
 
 	//------------------------------
-	bool LibraryControllersLoader::data__v( const sint64* data, size_t length )
+	bool LibraryControllersLoader::data__v( const sint32* data, size_t length )
 	{
 		writeVIndices(data, length);
 		return true;
@@ -0,0 +1,59 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADASaxFWLStableHeaders.h"
+#include "COLLADASaxFWLLoadSession.h"
+#include "COLLADASaxFWLLoader.h"
+
+
+namespace COLLADASaxFWL
+{
+
+	//------------------------------
+	LoadSession::LoadSession( Loader& loader )
+		: mLoader( loader )
+		, mDocumentCount( 0 )
+	{
+	}
+
+	//------------------------------
+	LoadSession::~LoadSession()
+	{
+	}
+
+	//------------------------------
+	void LoadSession::prepareDocument()
+	{
+		if ( mDocumentCount > 0 )
+		{
+			mLoader.resetDocumentData();
+		}
+		mDocumentCount++;
+	}
+
+	//------------------------------
+	bool LoadSession::loadDocument( const String& fileName, COLLADAFW::IWriter* writer )
+	{
+		if ( !writer )
+			return false;
+		prepareDocument();
+		return mLoader.loadDocument( fileName, writer );
+	}
+
+	//------------------------------
+	bool LoadSession::loadDocument( const String& uri, const char* buffer, int length, COLLADAFW::IWriter* writer )
+	{
+		if ( !writer )
+			return false;
+		prepareDocument();
+		return mLoader.loadDocument( uri, buffer, length, writer );
+	}
+
+} // namespace COLLADASaxFWL
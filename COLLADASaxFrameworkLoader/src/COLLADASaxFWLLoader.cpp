@@ -11,8 +11,10 @@ http://www.opensource.org/licenses/mit-license.php
 #include "COLLADASaxFWLStableHeaders.h"
 #include "COLLADASaxFWLLoader.h"
 #include "COLLADASaxFWLFileLoader.h"
+#include "COLLADASaxFWLVersionParser.h"
 #include "COLLADASaxFWLPostProcessor.h"
 #include "COLLADASaxFWLSaxParserErrorHandler.h"
+#include "COLLADASaxFWLStatisticsWriter.h"
 #include "COLLADASaxFWLUtils.h"
 
 #include "COLLADABUURI.h"
@@ -39,7 +41,8 @@ namespace COLLADASaxFWL
 
 
 	Loader::Loader( IErrorHandler* errorHandler )
-		: mFileLoader(0)
+		: mCOLLADAVersion(COLLADA_UNKNOWN)
+		, mFileLoader(0)
 		, mNextFileId(0)
 		, mCurrentFileId(0)
 		, mErrorHandler(errorHandler)
@@ -49,6 +52,11 @@ namespace COLLADASaxFWL
 		, mSidTreeRoot( new SidTreeNode("", 0) )
 		, mSkinControllerSet( compare )
 		, mExternalReferenceDeciderCallbackFunction()
+		, mCollectStatistics( false )
+		, mPrivateParser14(0)
+		, mPrivateParser15(0)
+		, mFilteredFunctionMaps(0)
+		, mReusableFileLoader(0)
 
 	{
 	}
@@ -59,6 +67,17 @@ namespace COLLADASaxFWL
 	{
 		delete mSidTreeRoot;
 
+		deleteDocumentObjects();
+
+		delete mReusableFileLoader;
+		delete mPrivateParser14;
+		delete mPrivateParser15;
+		delete mFilteredFunctionMaps;
+	}
+
+	//---------------------------------
+	void Loader::deleteDocumentObjects()
+	{
 		// delete visual scenes
 		deleteVectorFW(mVisualScenes);
 
@@ -74,6 +93,9 @@ namespace COLLADASaxFWL
 		// delete cameras
 		deleteVectorFW(mCameras);
 
+		// delete morph controllers
+		deleteVectorFW(mMorphControllerList);
+
 		// We do not delete formulas here. They are deleted by the Formulas class
 
 		// delete animation lists
@@ -85,6 +107,104 @@ namespace COLLADASaxFWL
 		}
 	}
 
+	//---------------------------------
+	void Loader::resetDocumentData()
+	{
+		deleteDocumentObjects();
+
+		// the vectors keep their capacity
+		mVisualScenes.clear();
+		mLibraryNodes.clear();
+		mEffects.clear();
+		mLights.clear();
+		mCameras.clear();
+		mMorphControllerList.clear();
+		mUniqueIdAnimationListMap.clear();
+		mFormulasMap.clear();
+		mAnimationSidAddressBindings.clear();
+
+		delete mSidTreeRoot;
+		mSidTreeRoot = new SidTreeNode("", 0);
+		mIdStringSidTreeNodeMap.clear();
+		mResolvedSidPaths.clear();
+
+		// the file ids start at 0 again. mLoaderUtil is not reset, so the object ids and with them the unique 
+		// ids of different documents differ
+		mURIUniqueIdMap.clear();
+		mURIFileIdMap.clear();
+		mFileIdURIMap.clear();
+		mNextFileId = 0;
+		mCurrentFileId = 0;
+
+		mGeometryMaterialIdInfo.clear();
+		mNextTextureMapId = 0;
+		mTextureMapSemanticTextureMapIdMap.clear();
+
+		mSkinDataJointSidsMap.clear();
+		mInstanceControllerDataListMap.clear();
+		mSkinDataSkinSourceMap.clear();
+		mSkinControllerSet.clear();
+		mKinematicsIntermediateData.clear();
+
+		mCOLLADAVersion = COLLADA_UNKNOWN;
+		mParsedObjectFlags = Loader::NO_FLAG;
+	}
+
+	//---------------------------------
+	COLLADASaxFWL14::ColladaParserAutoGen14Private* Loader::getPrivateParser14( COLLADASaxFWL14::ColladaParserAutoGen14* impl, GeneratedSaxParser::IErrorHandler* errorHandler )
+	{
+		if ( !mPrivateParser14 )
+		{
+			mPrivateParser14 = new COLLADASaxFWL14::ColladaParserAutoGen14Private( impl, errorHandler );
+			return mPrivateParser14;
+		}
+		mPrivateParser14->reset();
+		mPrivateParser14->setCallbackObject( impl );
+		mPrivateParser14->setErrorHandler( errorHandler );
+		return mPrivateParser14;
+	}
+
+	//---------------------------------
+	COLLADASaxFWL15::ColladaParserAutoGen15Private* Loader::getPrivateParser15( COLLADASaxFWL15::ColladaParserAutoGen15* impl, GeneratedSaxParser::IErrorHandler* errorHandler )
+	{
+		if ( !mPrivateParser15 )
+		{
+			mPrivateParser15 = new COLLADASaxFWL15::ColladaParserAutoGen15Private( impl, errorHandler );
+			return mPrivateParser15;
+		}
+		mPrivateParser15->reset();
+		mPrivateParser15->setCallbackObject( impl );
+		mPrivateParser15->setErrorHandler( errorHandler );
+		return mPrivateParser15;
+	}
+
+	//---------------------------------
+	FilteredFunctionMaps& Loader::getFilteredFunctionMaps()
+	{
+		if ( !mFilteredFunctionMaps )
+		{
+			mFilteredFunctionMaps = new FilteredFunctionMaps();
+		}
+		return *mFilteredFunctionMaps;
+	}
+
+	//---------------------------------
+	FileLoader* Loader::getReusableFileLoader( const COLLADABU::URI& fileUri, SaxParserErrorHandler* saxParserErrorHandler )
+	{
+		if ( !mReusableFileLoader )
+		{
+			mReusableFileLoader = new FileLoader( this, 
+				fileUri,
+				saxParserErrorHandler, 
+				mObjectFlags,
+				mParsedObjectFlags, 
+				mExtraDataCallbackHandlerList );
+			return mReusableFileLoader;
+		}
+		mReusableFileLoader->reset( fileUri, saxParserErrorHandler, mObjectFlags, mExtraDataCallbackHandlerList );
+		return mReusableFileLoader;
+	}
+
     //---------------------------------
 	const COLLADAFW::UniqueId& Loader::getUniqueId( const COLLADABU::URI& uri, COLLADAFW::ClassId classId )
 	{
@@ -188,17 +308,35 @@ namespace COLLADASaxFWL
 
 	//---------------------------------
 	bool Loader::loadDocument( const String& fileName, COLLADAFW::IWriter* writer )
+	{
+		return load( COLLADABU::URI(COLLADABU::URI::nativePathToUri(fileName)), 0, 0, writer );
+	}
+
+	//---------------------------------
+	bool Loader::loadDocument( const String& uri, const char* buffer, int length, COLLADAFW::IWriter* writer )
+	{
+		return load( COLLADABU::URI(uri), buffer, length, writer );
+	}
+
+	//---------------------------------
+	bool Loader::load( const COLLADABU::URI& rootFileUri, const char* buffer, int length, COLLADAFW::IWriter* writer )
 	{
 		if ( !writer )
 			return false;
-		mWriter = writer;
+
+		double startTime = 0;
+		if ( mCollectStatistics )
+		{
+			mStatistics.reset();
+			startTime = LoaderStatistics::getTime();
+		}
+		StatisticsWriter statisticsWriter( writer, mStatistics );
+		mWriter = mCollectStatistics ? &statisticsWriter : writer;
 
 		mWriter->start();
 
 		SaxParserErrorHandler saxParserErrorHandler(mErrorHandler);
 
-		COLLADABU::URI rootFileUri(COLLADABU::URI::nativePathToUri(fileName));
-		
 		// the root file has always file id 0
 		addFileIdUriPair( mNextFileId++, rootFileUri );
 
@@ -212,14 +350,10 @@ namespace COLLADASaxFWL
 				|| !mExternalReferenceDeciderCallbackFunction 
 				|| mExternalReferenceDeciderCallbackFunction(fileUri, mCurrentFileId) )
 			{
-				mFileLoader = new FileLoader(this, 
-					fileUri,
-					&saxParserErrorHandler, 
-					mObjectFlags,
-					mParsedObjectFlags, 
-					mExtraDataCallbackHandlerList );
-				bool success = mFileLoader->load();
-				delete mFileLoader;
+				mFileLoader = getReusableFileLoader( fileUri, &saxParserErrorHandler );
+				// only the root file is passed as buffer, referenced files are read from disk
+				bool success = (buffer && mCurrentFileId == 0) ? mFileLoader->load( buffer, length ) : mFileLoader->load();
+				mFileLoader = 0;
 				abortLoading = !success;
 			}
 
@@ -240,66 +374,15 @@ namespace COLLADASaxFWL
 		}
 
 		mWriter->finish();
-
-		mParsedObjectFlags |= mObjectFlags;
-
-		return !abortLoading;
-	}
-
-	//---------------------------------
-	bool Loader::loadDocument( const String& uri, const char* buffer, int length, COLLADAFW::IWriter* writer )
-	{
-		if ( !writer )
-			return false;
 		mWriter = writer;
-        
-		SaxParserErrorHandler saxParserErrorHandler(mErrorHandler);
-        
-		COLLADABU::URI rootUri(uri);
-		
-		// the root file has always file id 0
-		addFileIdUriPair( mNextFileId++, rootUri );
-        
-		bool abortLoading = false;
 
-		while ( (mCurrentFileId < mNextFileId) && !abortLoading )
+		if ( mCollectStatistics )
 		{
-			const COLLADABU::URI& fileUri = getFileUri( mCurrentFileId );
-
-			if ( (mCurrentFileId == 0) 
-				|| !mExternalReferenceDeciderCallbackFunction 
-				|| mExternalReferenceDeciderCallbackFunction(fileUri, mCurrentFileId) )
-			{
-				FileLoader fileLoader(this, 
-					getFileUri( mCurrentFileId ),
-					&saxParserErrorHandler, 
-					mObjectFlags,
-					mParsedObjectFlags, 
-					mExtraDataCallbackHandlerList );
-				bool success = fileLoader.load();
-				abortLoading = !success;
-			}
-            
-			mCurrentFileId++;
-		}
-        
-		if ( !abortLoading )
-		{
-			PostProcessor postProcessor(this, 
-				&saxParserErrorHandler, 
-				mObjectFlags,
-				mParsedObjectFlags);
-			postProcessor.postProcess();
+			mStatistics.finish( LoaderStatistics::getTime() - startTime );
 		}
-		else
-		{
-			mWriter->cancel("Generic error");
-		}
-        
-		mWriter->finish();
 
 		mParsedObjectFlags |= mObjectFlags;
-        
+
 		return !abortLoading;
 	}
 
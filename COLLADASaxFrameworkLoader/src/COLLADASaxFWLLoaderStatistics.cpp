@@ -0,0 +1,287 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADASaxFWLStableHeaders.h"
+#include "COLLADASaxFWLLoaderStatistics.h"
+
+#include "COLLADABUPlatform.h"
+
+#ifdef COLLADABU_OS_WIN
+#	include <windows.h>
+#	include <psapi.h>
+#	ifdef _MSC_VER
+#		pragma comment(lib, "psapi.lib")
+#	endif
+#else
+#	include <sys/time.h>
+#	include <sys/resource.h>
+#	include <time.h>
+#endif
+
+#include <string.h>
+
+
+namespace COLLADASaxFWL
+{
+
+	//------------------------------
+	LoaderStatistics::LoaderStatistics()
+	{
+		reset();
+	}
+
+	//------------------------------
+	LoaderStatistics::~LoaderStatistics()
+	{
+	}
+
+	//------------------------------
+	void LoaderStatistics::reset()
+	{
+		mFileCount = 0;
+		mBytesRead = 0;
+		mElementCount = 0;
+		memset( mConvertedValueCounts, 0, sizeof(mConvertedValueCounts) );
+		mParseTime = 0;
+		mPostProcessingTime = 0;
+		mTotalTime = 0;
+		mPeakMemoryUsage = 0;
+		memset( mPartLoaderTimings, 0, sizeof(mPartLoaderTimings) );
+		memset( mPostProcessingTimings, 0, sizeof(mPostProcessingTimings) );
+		memset( mWriterTimings, 0, sizeof(mWriterTimings) );
+		mRunningPartLoader = PART_LOADER_COUNT;
+		mRunningPartLoaderStartTime = 0;
+	}
+
+	//------------------------------
+	void LoaderStatistics::addFile( size_t bytesRead, size_t elementCount, double parseTime )
+	{
+		mFileCount++;
+		mBytesRead += bytesRead;
+		mElementCount += elementCount;
+		mParseTime += parseTime;
+	}
+
+	//------------------------------
+	void LoaderStatistics::startPartLoader( PartLoader partLoader )
+	{
+		stopPartLoader();
+		mRunningPartLoader = partLoader;
+		mRunningPartLoaderStartTime = getTime();
+	}
+
+	//------------------------------
+	void LoaderStatistics::stopPartLoader()
+	{
+		if ( mRunningPartLoader == PART_LOADER_COUNT )
+			return;
+		Timing& timing = mPartLoaderTimings[mRunningPartLoader];
+		timing.count++;
+		timing.time += getTime() - mRunningPartLoaderStartTime;
+		mRunningPartLoader = PART_LOADER_COUNT;
+	}
+
+	//------------------------------
+	void LoaderStatistics::addPostProcessingTime( PostProcessingPhase phase, double time )
+	{
+		Timing& timing = mPostProcessingTimings[phase];
+		timing.count++;
+		timing.time += time;
+		mPostProcessingTime += time;
+	}
+
+	//------------------------------
+	void LoaderStatistics::addWriterTime( WriterMethod writerMethod, double time )
+	{
+		Timing& timing = mWriterTimings[writerMethod];
+		timing.count++;
+		timing.time += time;
+	}
+
+	//------------------------------
+	void LoaderStatistics::finish( double totalTime )
+	{
+		mTotalTime = totalTime;
+		mPeakMemoryUsage = getProcessPeakMemoryUsage();
+	}
+
+	//------------------------------
+	const char* LoaderStatistics::getValueTypeName( ValueType valueType )
+	{
+		return GeneratedSaxParser::ParserTemplateBase::getValueTypeName( valueType );
+	}
+
+	//------------------------------
+	const char* LoaderStatistics::getPartLoaderName( PartLoader partLoader )
+	{
+		switch ( partLoader )
+		{
+		case PART_LOADER_ASSET:
+			return "asset";
+		case PART_LOADER_SCENE:
+			return "scene";
+		case PART_LOADER_VISUAL_SCENE:
+			return "visual_scene";
+		case PART_LOADER_GEOMETRY:
+			return "geometry";
+		case PART_LOADER_LIBRARY_NODES:
+			return "library_nodes";
+		case PART_LOADER_LIBRARY_MATERIALS:
+			return "library_materials";
+		case PART_LOADER_LIBRARY_EFFECTS:
+			return "library_effects";
+		case PART_LOADER_LIBRARY_CAMERAS:
+			return "library_cameras";
+		case PART_LOADER_LIBRARY_LIGHTS:
+			return "library_lights";
+		case PART_LOADER_LIBRARY_IMAGES:
+			return "library_images";
+		case PART_LOADER_LIBRARY_ANIMATIONS:
+			return "library_animations";
+		case PART_LOADER_LIBRARY_CONTROLLERS:
+			return "library_controllers";
+		case PART_LOADER_LIBRARY_FORMULAS:
+			return "library_formulas";
+		case PART_LOADER_LIBRARY_JOINTS:
+			return "library_joints";
+		case PART_LOADER_LIBRARY_KINEMATICS_MODELS:
+			return "library_kinematics_models";
+		case PART_LOADER_LIBRARY_ARTICULATED_SYSTEMS:
+			return "library_articulated_systems";
+		case PART_LOADER_LIBRARY_KINEMATICS_SCENES:
+			return "library_kinematics_scenes";
+		default:
+			return "";
+		}
+	}
+
+	//------------------------------
+	const char* LoaderStatistics::getPostProcessingPhaseName( PostProcessingPhase phase )
+	{
+		switch ( phase )
+		{
+		case PHASE_CREATE_MISSING_ANIMATION_LISTS:
+			return "createMissingAnimationLists";
+		case PHASE_WRITE_EFFECTS:
+			return "writeEffects";
+		case PHASE_WRITE_LIGHTS:
+			return "writeLights";
+		case PHASE_WRITE_CAMERAS:
+			return "writeCameras";
+		case PHASE_CREATE_AND_WRITE_SKIN_CONTROLLERS:
+			return "createAndWriteSkinControllers";
+		case PHASE_WRITE_MORPH_CONTROLLERS:
+			return "writeMorphControllers";
+		case PHASE_WRITE_VISUAL_SCENES:
+			return "writeVisualScenes";
+		case PHASE_WRITE_LIBRARY_NODES:
+			return "writeLibraryNodes";
+		case PHASE_WRITE_ANIMATION_LISTS:
+			return "writeAnimationLists";
+		case PHASE_LINK_AND_WRITE_FORMULAS:
+			return "linkAndWriteFormulas";
+		case PHASE_CREATE_AND_WRITE_KINEMATICS_SCENE:
+			return "createAndWriteKinematicsScene";
+		default:
+			return "";
+		}
+	}
+
+	//------------------------------
+	const char* LoaderStatistics::getWriterMethodName( WriterMethod writerMethod )
+	{
+		switch ( writerMethod )
+		{
+		case WRITER_CANCEL:
+			return "cancel";
+		case WRITER_START:
+			return "start";
+		case WRITER_FINISH:
+			return "finish";
+		case WRITER_GLOBAL_ASSET:
+			return "writeGlobalAsset";
+		case WRITER_SCENE:
+			return "writeScene";
+		case WRITER_VISUAL_SCENE:
+			return "writeVisualScene";
+		case WRITER_LIBRARY_NODES:
+			return "writeLibraryNodes";
+		case WRITER_GEOMETRY:
+			return "writeGeometry";
+		case WRITER_MATERIAL:
+			return "writeMaterial";
+		case WRITER_EFFECT:
+			return "writeEffect";
+		case WRITER_CAMERA:
+			return "writeCamera";
+		case WRITER_IMAGE:
+			return "writeImage";
+		case WRITER_LIGHT:
+			return "writeLight";
+		case WRITER_ANIMATION:
+			return "writeAnimation";
+		case WRITER_ANIMATION_LIST:
+			return "writeAnimationList";
+		case WRITER_SKIN_CONTROLLER_DATA:
+			return "writeSkinControllerData";
+		case WRITER_CONTROLLER:
+			return "writeController";
+		case WRITER_FORMULAS:
+			return "writeFormulas";
+		case WRITER_KINEMATICS_SCENE:
+			return "writeKinematicsScene";
+		default:
+			return "";
+		}
+	}
+
+	//------------------------------
+	double LoaderStatistics::getTime()
+	{
+#ifdef COLLADABU_OS_WIN
+		LARGE_INTEGER frequency;
+		LARGE_INTEGER counter;
+		QueryPerformanceFrequency( &frequency );
+		QueryPerformanceCounter( &counter );
+		return (double)counter.QuadPart / (double)frequency.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+		timespec time;
+		clock_gettime( CLOCK_MONOTONIC, &time );
+		return (double)time.tv_sec + (double)time.tv_nsec * 1e-9;
+#else
+		timeval time;
+		gettimeofday( &time, 0 );
+		return (double)time.tv_sec + (double)time.tv_usec * 1e-6;
+#endif
+	}
+
+	//------------------------------
+	size_t LoaderStatistics::getProcessPeakMemoryUsage()
+	{
+#ifdef COLLADABU_OS_WIN
+		PROCESS_MEMORY_COUNTERS memoryCounters;
+		if ( GetProcessMemoryInfo( GetCurrentProcess(), &memoryCounters, sizeof(memoryCounters) ) )
+			return (size_t)memoryCounters.PeakWorkingSetSize;
+		return 0;
+#else
+		rusage usage;
+		if ( getrusage( RUSAGE_SELF, &usage ) != 0 )
+			return 0;
+#	ifdef __APPLE__
+		// bytes on Mac OS X
+		return (size_t)usage.ru_maxrss;
+#	else
+		// kilobytes on Linux and BSD
+		return (size_t)usage.ru_maxrss * 1024;
+#	endif
+#endif
+	}
+
+} // namespace COLLADASaxFWL
@@ -66,6 +66,8 @@ namespace COLLADASaxFWL
 
         if ( !geometryId.empty() )
             mMesh->setOriginalId ( geometryId );
+
+		mLoadArrayValues = isObjectDataRequired( COLLADAFW::IWriter::MESH_DATA );
 	}
 
     //------------------------------
@@ -582,17 +584,27 @@ namespace COLLADASaxFWL
     }
 
     //------------------------------
-	bool MeshLoader::writePrimitiveIndices ( const unsigned long long* data, size_t length )
+	bool MeshLoader::writePrimitiveIndices ( const uint32* data, size_t length )
 	{
 		// check, if we are parsing an unsupported primitive type
 		if ( !mCurrentMeshPrimitive )
 			return true;
 
+		// the writer does not require the indices. Only count the vertices, to determine the face counts
+		if ( !mLoadArrayValues )
+		{
+			size_t indexCount = mCurrentOffset + length;
+			size_t stride = mCurrentMaxOffset + 1;
+			mCurrentVertexCount += indexCount / stride;
+			mCurrentOffset = indexCount % stride;
+			return true;
+		}
+
 		// Write the index values in the index lists.
 		for ( size_t i=0; i<length; ++i )
 		{
 			// Get the current index value.
-			unsigned int index = (unsigned int)data [i];
+			unsigned int index = data [i];
 
 			// Write the indices
 			if ( mUsePositions && (mCurrentOffset == mPositionsOffset) )
@@ -1028,8 +1040,9 @@ namespace COLLADASaxFWL
 	bool MeshLoader::begin__triangles( const triangles__AttributeData& attributeData )
 	{
 		mCurrentPrimitiveType = TRIANGLES;
+		mCurrentCOLLADAPrimitiveCount = (size_t)attributeData.count;
 		mCurrentMeshPrimitive = new COLLADAFW::Triangles(createUniqueId(COLLADAFW::Triangles::ID()));
-		if ( (size_t)attributeData.count > 0)
+		if ( ((size_t)attributeData.count > 0) && mLoadArrayValues )
 		{
 			mCurrentMeshPrimitive->getPositionIndices().reallocMemory((size_t)attributeData.count);
 			if ( mUseNormals )
@@ -1210,7 +1223,7 @@ namespace COLLADASaxFWL
 	}
 
 	//------------------------------
-	bool MeshLoader::data__vcount( const unsigned long long* data, size_t length )
+	bool MeshLoader::data__vcount( const uint32* data, size_t length )
 	{
 		COLLADAFW::Polygons* polygons = (COLLADAFW::Polygons*) mCurrentMeshPrimitive;
 		COLLADAFW::Polygons::VertexCountArray& vertexCountArray = polygons->getGroupedVerticesVertexCountArray();
@@ -1218,9 +1231,9 @@ namespace COLLADASaxFWL
 		vertexCountArray.reallocMemory( count + length);
 		for ( size_t i = 0; i < length; ++i)
 		{
-			unsigned long long vcount = data[i];
-			vertexCountArray.append((unsigned int)vcount);
-			mCurrentExpectedVertexCount += (size_t)vcount;
+			uint32 vcount = data[i];
+			vertexCountArray.append((COLLADAFW::Polygons::VertexCountArray::ValueType)vcount);
+			mCurrentExpectedVertexCount += vcount;
 		}
 		return true;
 	}
@@ -1297,7 +1310,7 @@ namespace COLLADASaxFWL
 	}
 
 	//------------------------------
-	bool MeshLoader::data__h( const uint64* data, size_t length )
+	bool MeshLoader::data__h( const uint32* data, size_t length )
 	{
 		// If the p element of the parent ph is empty, we don't need to read the h element
 		if ( mCurrentPhHasEmptyP )
@@ -1392,7 +1405,7 @@ namespace COLLADASaxFWL
                 loadSourceElements(mMeshPrimitiveInputs);
                 initializeOffsets();
                 mCurrentMeshPrimitive = new COLLADAFW::Lines(createUniqueId(COLLADAFW::Lines::ID()));
-                if ( mCurrentCOLLADAPrimitiveCount > 0)
+                if ( (mCurrentCOLLADAPrimitiveCount > 0) && mLoadArrayValues )
                 {
                     mCurrentMeshPrimitive->getPositionIndices().reallocMemory(mCurrentCOLLADAPrimitiveCount);
                     if ( mUseNormals )
@@ -1454,6 +1467,30 @@ namespace COLLADASaxFWL
 			}
 			break;
 		}
+
+		// the writer does not require the indices. If the vertex count is known from the count attribute
+		// or the vcount element, the indices are skipped. Otherwise they are still needed to count the
+		// vertices of each polygon or strip, see writePrimitiveIndices().
+		if ( !mLoadArrayValues )
+		{
+			switch ( mCurrentPrimitiveType )
+			{
+			case TRIANGLES:
+				if ( skipNotRequiredElementContent() )
+					mCurrentVertexCount = 3 * mCurrentCOLLADAPrimitiveCount;
+				break;
+			case LINES:
+				if ( skipNotRequiredElementContent() )
+					mCurrentVertexCount = 2 * mCurrentCOLLADAPrimitiveCount;
+				break;
+			case POLYLIST:
+				if ( skipNotRequiredElementContent() )
+					mCurrentVertexCount = mCurrentExpectedVertexCount;
+				break;
+			default:
+				break;
+			}
+		}
 		return true;
 	}
 
@@ -1615,7 +1652,7 @@ namespace COLLADASaxFWL
 	}
 
 	//------------------------------
-	bool MeshLoader::data__p( const unsigned long long* data, size_t length )
+	bool MeshLoader::data__p( const uint32* data, size_t length )
 	{
 		return writePrimitiveIndices(data, length);
 	}
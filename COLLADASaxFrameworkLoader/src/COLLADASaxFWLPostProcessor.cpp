@@ -34,57 +34,71 @@ namespace COLLADASaxFWL
 	}
 
 	//---------------------------------
+	template<class ProcessorType, class ReturnType>
+	void PostProcessor::executePhase( ReturnType (ProcessorType::*phase)(), LoaderStatistics::PostProcessingPhase statisticsPhase )
+	{
+		if ( !mStatistics )
+		{
+			(this->*phase)();
+			return;
+		}
+		double startTime = LoaderStatistics::getTime();
+		(this->*phase)();
+		mStatistics->addPostProcessingTime( statisticsPhase, LoaderStatistics::getTime() - startTime );
+	}
+
+	//-----------------------------
 	void PostProcessor::postProcess()
 	{
 		if ( (getObjectFlags() & Loader::ANIMATION_LIST_FLAG) != 0 )
 		{
-			createMissingAnimationLists();
+			executePhase( &PostProcessor::createMissingAnimationLists, LoaderStatistics::PHASE_CREATE_MISSING_ANIMATION_LISTS );
 		}
 
 		if ( (getObjectFlags() & Loader::EFFECT_FLAG) != 0 )
 		{
-			writeEffects();
+			executePhase( &PostProcessor::writeEffects, LoaderStatistics::PHASE_WRITE_EFFECTS );
 		}
 
 		if ( (getObjectFlags() & Loader::LIGHT_FLAG) != 0 )
 		{
-			writeLights();
+			executePhase( &PostProcessor::writeLights, LoaderStatistics::PHASE_WRITE_LIGHTS );
 		}
 
 		if ( (getObjectFlags() & Loader::CAMERA_FLAG) != 0 )
 		{
-			writeCameras();
+			executePhase( &PostProcessor::writeCameras, LoaderStatistics::PHASE_WRITE_CAMERAS );
 		}
 
 		if ( (getObjectFlags() & Loader::CONTROLLER_FLAG) != 0 )
 		{
-			createAndWriteSkinControllers();
-			writeMorphControllers();
+			executePhase( &PostProcessor::createAndWriteSkinControllers, LoaderStatistics::PHASE_CREATE_AND_WRITE_SKIN_CONTROLLERS );
+			executePhase( &PostProcessor::writeMorphControllers, LoaderStatistics::PHASE_WRITE_MORPH_CONTROLLERS );
 		}
 
 		if ( (getObjectFlags() & Loader::VISUAL_SCENES_FLAG) != 0 )
 		{
-			writeVisualScenes();
+			executePhase( &PostProcessor::writeVisualScenes, LoaderStatistics::PHASE_WRITE_VISUAL_SCENES );
 		}
 
 		if ( (getObjectFlags() & Loader::LIBRARY_NODES_FLAG) != 0 )
 		{
-			writeLibraryNodes();
+			executePhase( &PostProcessor::writeLibraryNodes, LoaderStatistics::PHASE_WRITE_LIBRARY_NODES );
 		}
 
 		if ( (getObjectFlags() & Loader::ANIMATION_LIST_FLAG) != 0 )
 		{
-			writeAnimationLists();
+			executePhase( &PostProcessor::writeAnimationLists, LoaderStatistics::PHASE_WRITE_ANIMATION_LISTS );
 		}
 
 		if ( (getObjectFlags() & Loader::FORMULA_FLAG) != 0 )
 		{
-			linkAndWriteFormulas();
+			executePhase( &PostProcessor::linkAndWriteFormulas, LoaderStatistics::PHASE_LINK_AND_WRITE_FORMULAS );
 		}
 
 		if ( (getObjectFlags() & Loader::KINEMATICS_FLAG) != 0 )
 		{
-			createAndWriteKinematicsScene();
+			executePhase( &PostProcessor::createAndWriteKinematicsScene, LoaderStatistics::PHASE_CREATE_AND_WRITE_KINEMATICS_SCENE );
 		}
 	}
 
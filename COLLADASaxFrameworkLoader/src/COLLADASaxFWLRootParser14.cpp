@@ -31,7 +31,7 @@ namespace COLLADASaxFWL
 {
 
 	template<class Loader, class Loader14>
-	Loader* RootParser14::beginCommon()
+	Loader* RootParser14::beginCommon( LoaderStatistics::PartLoader partLoader )
 	{
 		mFileLoader->deleteFilePartLoader();
 		Loader* loader = new Loader(mFileLoader);
@@ -39,11 +39,12 @@ namespace COLLADASaxFWL
 		loader->setParserImpl( loader14 );
 		mFileLoader->setPartLoader(loader);
 		mFileLoader->setParser(loader14);
+		mFileLoader->startPartLoaderTiming( partLoader );
 		return loader;
 	}
 
 	template<class Loader, class Loader14>
-	Loader* RootParser14::beginCommonWithId( const char * id)
+	Loader* RootParser14::beginCommonWithId( LoaderStatistics::PartLoader partLoader, const char * id)
 	{
 		mFileLoader->deleteFilePartLoader();
 		Loader* loader = new Loader(mFileLoader);
@@ -51,13 +52,14 @@ namespace COLLADASaxFWL
 		loader->setParserImpl( loader14 );
 		mFileLoader->setPartLoader(loader);
 		mFileLoader->setParser(loader14);
+		mFileLoader->startPartLoaderTiming( partLoader );
 		mFileLoader->addToSidTree( id, 0);
 		return loader;
 	}
 
 
 	template<class Loader, class Loader14>
-	Loader* RootParser14::beginCommonCTorWithId(  const char * id )
+	Loader* RootParser14::beginCommonCTorWithId( LoaderStatistics::PartLoader partLoader, const char * id )
 	{
 		mFileLoader->deleteFilePartLoader();
 		Loader* loader = new Loader(mFileLoader, id);
@@ -65,6 +67,7 @@ namespace COLLADASaxFWL
 		loader->setParserImpl( loader14 );
 		mFileLoader->setPartLoader(loader);
 		mFileLoader->setParser(loader14);
+		mFileLoader->startPartLoaderTiming( partLoader );
 		mFileLoader->addToSidTree( id, 0);
 		return loader;
 	}
@@ -79,7 +82,7 @@ namespace COLLADASaxFWL
     bool RootParser14::begin__asset()
     {
         SaxVirtualFunctionTest14(begin__asset());
-		beginCommon<AssetLoader, AssetLoader14>();
+		beginCommon<AssetLoader, AssetLoader14>( LoaderStatistics::PART_LOADER_ASSET );
         return true;
     }
 
@@ -87,7 +90,7 @@ namespace COLLADASaxFWL
     bool RootParser14::begin__scene()
     {
         SaxVirtualFunctionTest14(begin__scene()); 
-		beginCommon<SceneLoader, SceneLoader14>();
+		beginCommon<SceneLoader, SceneLoader14>( LoaderStatistics::PART_LOADER_SCENE );
         return true;
     }
 
@@ -95,7 +98,7 @@ namespace COLLADASaxFWL
     bool RootParser14::begin__visual_scene( const COLLADASaxFWL14::visual_scene__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest14(begin__visual_scene(attributeData));
-		beginCommonCTorWithId<VisualSceneLoader, VisualSceneLoader14>(attributeData.id);
+		beginCommonCTorWithId<VisualSceneLoader, VisualSceneLoader14>(LoaderStatistics::PART_LOADER_VISUAL_SCENE, attributeData.id);
         return true;
     }
 
@@ -103,7 +106,7 @@ namespace COLLADASaxFWL
     bool RootParser14::begin__geometry( const COLLADASaxFWL14::geometry__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest14(begin__geometry(attributeData));
-		GeometryLoader* geometryLoader = beginCommonWithId<GeometryLoader, GeometryLoader14>(attributeData.id);
+		GeometryLoader* geometryLoader = beginCommonWithId<GeometryLoader, GeometryLoader14>(LoaderStatistics::PART_LOADER_GEOMETRY, attributeData.id);
         if ( attributeData.name )
             geometryLoader->setGeometryName (attributeData.name);
         if ( attributeData.id )
@@ -115,7 +118,7 @@ namespace COLLADASaxFWL
     bool RootParser14::begin__library_nodes( const COLLADASaxFWL14::library_nodes__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest14(begin__library_nodes(attributeData));
-		beginCommonWithId<LibraryNodesLoader, LibraryNodesLoader14>(attributeData.id);
+		beginCommonWithId<LibraryNodesLoader, LibraryNodesLoader14>(LoaderStatistics::PART_LOADER_LIBRARY_NODES, attributeData.id);
         return true;
     }
 
@@ -123,7 +126,7 @@ namespace COLLADASaxFWL
     bool RootParser14::begin__library_materials( const COLLADASaxFWL14::library_materials__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest14(begin__library_materials(attributeData));
-		beginCommonWithId<LibraryMaterialsLoader, LibraryMaterialsLoader14>(attributeData.id);
+		beginCommonWithId<LibraryMaterialsLoader, LibraryMaterialsLoader14>(LoaderStatistics::PART_LOADER_LIBRARY_MATERIALS, attributeData.id);
         return true;
     }
 
@@ -131,7 +134,7 @@ namespace COLLADASaxFWL
     bool RootParser14::begin__library_effects( const COLLADASaxFWL14::library_effects__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest14(begin__library_effects(attributeData));
-		beginCommonWithId<LibraryEffectsLoader, LibraryEffectsLoader14>(attributeData.id);
+		beginCommonWithId<LibraryEffectsLoader, LibraryEffectsLoader14>(LoaderStatistics::PART_LOADER_LIBRARY_EFFECTS, attributeData.id);
         return true;
     }
 
@@ -139,7 +142,7 @@ namespace COLLADASaxFWL
     bool RootParser14::begin__library_cameras( const COLLADASaxFWL14::library_cameras__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest14(begin__library_cameras(attributeData));
-		beginCommonWithId<LibraryCamerasLoader, LibraryCamerasLoader14>(attributeData.id);
+		beginCommonWithId<LibraryCamerasLoader, LibraryCamerasLoader14>(LoaderStatistics::PART_LOADER_LIBRARY_CAMERAS, attributeData.id);
         return true;
     }
 
@@ -147,7 +150,7 @@ namespace COLLADASaxFWL
     bool RootParser14::begin__library_lights( const COLLADASaxFWL14::library_lights__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest14(begin__library_lights(attributeData));
-		beginCommonWithId<LibraryLightsLoader, LibraryLightsLoader14>(attributeData.id);
+		beginCommonWithId<LibraryLightsLoader, LibraryLightsLoader14>(LoaderStatistics::PART_LOADER_LIBRARY_LIGHTS, attributeData.id);
         return true;
     }
 
@@ -155,7 +158,7 @@ namespace COLLADASaxFWL
     bool RootParser14::begin__library_images( const COLLADASaxFWL14::library_images__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest14(begin__library_images(attributeData));
-		beginCommonWithId<LibraryImagesLoader, LibraryImagesLoader14>(attributeData.id);
+		beginCommonWithId<LibraryImagesLoader, LibraryImagesLoader14>(LoaderStatistics::PART_LOADER_LIBRARY_IMAGES, attributeData.id);
         return true;
     }
 
@@ -163,7 +166,7 @@ namespace COLLADASaxFWL
     bool RootParser14::begin__library_animations( const COLLADASaxFWL14::library_animations__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest14(begin__library_animations(attributeData));
-		beginCommonWithId<LibraryAnimationsLoader, LibraryAnimationsLoader14>(attributeData.id);
+		beginCommonWithId<LibraryAnimationsLoader, LibraryAnimationsLoader14>(LoaderStatistics::PART_LOADER_LIBRARY_ANIMATIONS, attributeData.id);
         return true;
     }
 
@@ -171,7 +174,7 @@ namespace COLLADASaxFWL
     bool RootParser14::begin__library_controllers( const COLLADASaxFWL14::library_controllers__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest14(begin__library_controllers(attributeData));
-		beginCommonWithId<LibraryControllersLoader, LibraryControllersLoader14>(attributeData.id);
+		beginCommonWithId<LibraryControllersLoader, LibraryControllersLoader14>(LoaderStatistics::PART_LOADER_LIBRARY_CONTROLLERS, attributeData.id);
 		return true;
     }
 
@@ -36,7 +36,7 @@ namespace COLLADASaxFWL
 {
 
 	template<class Loader, class Loader15>
-	Loader* RootParser15::beginCommon( )
+	Loader* RootParser15::beginCommon( LoaderStatistics::PartLoader partLoader )
 	{
 		mFileLoader->deleteFilePartLoader();
 		Loader* loader = new Loader(mFileLoader);
@@ -44,11 +44,12 @@ namespace COLLADASaxFWL
 		loader->setParserImpl( loader15 );
 		mFileLoader->setPartLoader(loader);
 		mFileLoader->setParser(loader15);
+		mFileLoader->startPartLoaderTiming( partLoader );
 		return loader;
 	}
 
 	template<class Loader, class Loader15>
-	Loader* RootParser15::beginCommonWithId( const char * id)
+	Loader* RootParser15::beginCommonWithId( LoaderStatistics::PartLoader partLoader, const char * id)
 	{
 		mFileLoader->deleteFilePartLoader();
 		Loader* loader = new Loader(mFileLoader);
@@ -56,12 +57,13 @@ namespace COLLADASaxFWL
 		loader->setParserImpl( loader15 );
 		mFileLoader->setPartLoader(loader);
 		mFileLoader->setParser(loader15);
+		mFileLoader->startPartLoaderTiming( partLoader );
 		mFileLoader->addToSidTree( id, 0);
 		return loader;
 	}
 
 	template<class Loader, class Loader15>
-	Loader* RootParser15::beginCommonCTorWithId(  const char * id )
+	Loader* RootParser15::beginCommonCTorWithId( LoaderStatistics::PartLoader partLoader, const char * id )
 	{
 		mFileLoader->deleteFilePartLoader();
 		Loader* loader = new Loader(mFileLoader, id);
@@ -69,6 +71,7 @@ namespace COLLADASaxFWL
 		loader->setParserImpl( loader15 );
 		mFileLoader->setPartLoader(loader);
 		mFileLoader->setParser(loader15);
+		mFileLoader->startPartLoaderTiming( partLoader );
 		mFileLoader->addToSidTree( id, 0);
 		return loader;
 	}
@@ -85,7 +88,7 @@ namespace COLLADASaxFWL
     bool RootParser15::begin__asset()
     {
         SaxVirtualFunctionTest15(begin__asset());
-		beginCommon<AssetLoader, AssetLoader15>();
+		beginCommon<AssetLoader, AssetLoader15>( LoaderStatistics::PART_LOADER_ASSET );
         return true;
     }
 
@@ -93,7 +96,7 @@ namespace COLLADASaxFWL
     bool RootParser15::begin__scene()
     {
         SaxVirtualFunctionTest15(begin__scene()); 
-		beginCommon<SceneLoader, SceneLoader15>();
+		beginCommon<SceneLoader, SceneLoader15>( LoaderStatistics::PART_LOADER_SCENE );
         return true;
     }
 
@@ -101,7 +104,7 @@ namespace COLLADASaxFWL
     bool RootParser15::begin__visual_scene( const COLLADASaxFWL15::visual_scene__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest15(begin__visual_scene(attributeData));
-		beginCommonCTorWithId<VisualSceneLoader, VisualSceneLoader15>(attributeData.id);
+		beginCommonCTorWithId<VisualSceneLoader, VisualSceneLoader15>(LoaderStatistics::PART_LOADER_VISUAL_SCENE, attributeData.id);
         return true;
     }
 
@@ -109,7 +112,7 @@ namespace COLLADASaxFWL
     bool RootParser15::begin__geometry( const COLLADASaxFWL15::geometry__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest15(begin__geometry(attributeData));
-		GeometryLoader* geometryLoader = beginCommonWithId<GeometryLoader, GeometryLoader15>(attributeData.id);
+		GeometryLoader* geometryLoader = beginCommonWithId<GeometryLoader, GeometryLoader15>(LoaderStatistics::PART_LOADER_GEOMETRY, attributeData.id);
 		if ( attributeData.name )
 			geometryLoader->setGeometryName (attributeData.name);
 		if ( attributeData.id )
@@ -121,7 +124,7 @@ namespace COLLADASaxFWL
     bool RootParser15::begin__library_nodes( const COLLADASaxFWL15::library_nodes__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest15(begin__library_nodes(attributeData));
-		beginCommonWithId<LibraryNodesLoader, LibraryNodesLoader15>(attributeData.id);
+		beginCommonWithId<LibraryNodesLoader, LibraryNodesLoader15>(LoaderStatistics::PART_LOADER_LIBRARY_NODES, attributeData.id);
         return true;
     }
 
@@ -129,7 +132,7 @@ namespace COLLADASaxFWL
     bool RootParser15::begin__library_materials( const COLLADASaxFWL15::library_materials__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest15(begin__library_materials(attributeData));
-		beginCommonWithId<LibraryMaterialsLoader, LibraryMaterialsLoader15>(attributeData.id);
+		beginCommonWithId<LibraryMaterialsLoader, LibraryMaterialsLoader15>(LoaderStatistics::PART_LOADER_LIBRARY_MATERIALS, attributeData.id);
         return true;
     }
 
@@ -137,7 +140,7 @@ namespace COLLADASaxFWL
     bool RootParser15::begin__library_effects( const COLLADASaxFWL15::library_effects__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest15(begin__library_effects(attributeData));
-		beginCommonWithId<LibraryEffectsLoader, LibraryEffectsLoader15>(attributeData.id);
+		beginCommonWithId<LibraryEffectsLoader, LibraryEffectsLoader15>(LoaderStatistics::PART_LOADER_LIBRARY_EFFECTS, attributeData.id);
         return true;
     }
 
@@ -145,7 +148,7 @@ namespace COLLADASaxFWL
     bool RootParser15::begin__library_cameras( const COLLADASaxFWL15::library_cameras__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest15(begin__library_cameras(attributeData));
-		beginCommonWithId<LibraryCamerasLoader, LibraryCamerasLoader15>(attributeData.id);
+		beginCommonWithId<LibraryCamerasLoader, LibraryCamerasLoader15>(LoaderStatistics::PART_LOADER_LIBRARY_CAMERAS, attributeData.id);
         return true;
     }
 
@@ -153,7 +156,7 @@ namespace COLLADASaxFWL
     bool RootParser15::begin__library_lights( const COLLADASaxFWL15::library_lights__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest15(begin__library_lights(attributeData));
-		beginCommonWithId<LibraryLightsLoader, LibraryLightsLoader15>(attributeData.id);
+		beginCommonWithId<LibraryLightsLoader, LibraryLightsLoader15>(LoaderStatistics::PART_LOADER_LIBRARY_LIGHTS, attributeData.id);
         return true;
     }
 
@@ -161,7 +164,7 @@ namespace COLLADASaxFWL
     bool RootParser15::begin__library_images( const COLLADASaxFWL15::library_images__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest15(begin__library_images(attributeData));
-		beginCommonWithId<LibraryImagesLoader, LibraryImagesLoader15>(attributeData.id);
+		beginCommonWithId<LibraryImagesLoader, LibraryImagesLoader15>(LoaderStatistics::PART_LOADER_LIBRARY_IMAGES, attributeData.id);
         return true;
     }
 
@@ -169,7 +172,7 @@ namespace COLLADASaxFWL
     bool RootParser15::begin__library_animations( const COLLADASaxFWL15::library_animations__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest15(begin__library_animations(attributeData));
-		beginCommonWithId<LibraryAnimationsLoader, LibraryAnimationsLoader15>(attributeData.id);
+		beginCommonWithId<LibraryAnimationsLoader, LibraryAnimationsLoader15>(LoaderStatistics::PART_LOADER_LIBRARY_ANIMATIONS, attributeData.id);
         return true;
     }
 
@@ -177,7 +180,7 @@ namespace COLLADASaxFWL
     bool RootParser15::begin__library_controllers( const COLLADASaxFWL15::library_controllers__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest15(begin__library_controllers(attributeData));
-		beginCommonWithId<LibraryControllersLoader, LibraryControllersLoader15>(attributeData.id);
+		beginCommonWithId<LibraryControllersLoader, LibraryControllersLoader15>(LoaderStatistics::PART_LOADER_LIBRARY_CONTROLLERS, attributeData.id);
         return true;
     }
 
@@ -185,7 +188,7 @@ namespace COLLADASaxFWL
     bool RootParser15::begin__library_formulas( const COLLADASaxFWL15::library_formulas__AttributeData& attributeData )
     {
         SaxVirtualFunctionTest15(begin__library_formulas(attributeData));
-        beginCommonWithId<LibraryFormulasLoader, LibraryFormulasLoader15>(attributeData.id);
+        beginCommonWithId<LibraryFormulasLoader, LibraryFormulasLoader15>(LoaderStatistics::PART_LOADER_LIBRARY_FORMULAS, attributeData.id);
         return true;
     }
 
@@ -193,7 +196,7 @@ namespace COLLADASaxFWL
 	bool RootParser15::begin__library_joints( const COLLADASaxFWL15::library_joints__AttributeData& attributeData )
 	{
 		SaxVirtualFunctionTest15(begin__library_joints(attributeData));
-		beginCommonWithId<LibraryJointsLoader, LibraryJointsLoader15>(attributeData.id);
+		beginCommonWithId<LibraryJointsLoader, LibraryJointsLoader15>(LoaderStatistics::PART_LOADER_LIBRARY_JOINTS, attributeData.id);
 		return true;
 	}
 
@@ -201,7 +204,7 @@ namespace COLLADASaxFWL
 	bool RootParser15::begin__library_kinematics_models( const COLLADASaxFWL15::library_kinematics_models__AttributeData& attributeData )
 	{
 		SaxVirtualFunctionTest15(begin__library_kinematics_models(attributeData));
-		beginCommonWithId<LibraryKinematicsModelsLoader, LibraryKinematicsModelsLoader15>(attributeData.id);
+		beginCommonWithId<LibraryKinematicsModelsLoader, LibraryKinematicsModelsLoader15>(LoaderStatistics::PART_LOADER_LIBRARY_KINEMATICS_MODELS, attributeData.id);
 		return true;
 	}
 
@@ -209,7 +212,7 @@ namespace COLLADASaxFWL
 	bool RootParser15::begin__library_articulated_systems( const COLLADASaxFWL15::library_articulated_systems__AttributeData& attributeData )
 	{
 		SaxVirtualFunctionTest15(begin__library_articulated_systems(attributeData));
-		beginCommonWithId<LibraryArticulatedSystemsLoader, LibraryArticulatedSystemsLoader15>(attributeData.id);
+		beginCommonWithId<LibraryArticulatedSystemsLoader, LibraryArticulatedSystemsLoader15>(LoaderStatistics::PART_LOADER_LIBRARY_ARTICULATED_SYSTEMS, attributeData.id);
 		return true;
 	}
 
@@ -217,7 +220,7 @@ namespace COLLADASaxFWL
 	bool RootParser15::begin__library_kinematics_scenes( const COLLADASaxFWL15::library_kinematics_scenes__AttributeData& attributeData )
 	{
 		SaxVirtualFunctionTest15(begin__library_kinematics_scenes(attributeData));
-		beginCommonWithId<LibraryKinematicsScenesLoader, LibraryKinematicsScenesLoader15>(attributeData.id);
+		beginCommonWithId<LibraryKinematicsScenesLoader, LibraryKinematicsScenesLoader15>(LoaderStatistics::PART_LOADER_LIBRARY_KINEMATICS_SCENES, attributeData.id);
 		return true;
 	}
 
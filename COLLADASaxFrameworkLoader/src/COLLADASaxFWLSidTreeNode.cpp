@@ -17,24 +17,6 @@ namespace COLLADASaxFWL
 {
 
 
-	//------------------------------
-	bool SidTreeNode::SidIdentifier::operator<( const SidIdentifier& rhs ) const
-	{
-		if ( sid < rhs.sid)
-			return true;
-
-		if ( sid > rhs.sid)
-			return false;
-
-		if ( hierarchyLevel < rhs.hierarchyLevel)
-			return true;
-
-		if ( hierarchyLevel > rhs.hierarchyLevel)
-			return false;
-
-		return false;
-	}
-
 	//------------------------------
 	SidTreeNode::SidTreeNode(const String& sid, SidTreeNode *parent)
 		: mParent(parent)
@@ -61,29 +43,45 @@ namespace COLLADASaxFWL
 		mDirectChildren.push_back(newChild);
 		if ( !sid.empty() )
 		{
-			SidIdentifier newIdentifier(newChild->getSid(), 0);
-			mChildren.insert(std::make_pair(newIdentifier, newChild));
-			addChildToParents( newChild, newIdentifier );
+			Descendant newDescendant(newChild, 0);
+			if ( addDescendant( newDescendant ) )
+			{
+				addChildToParents( newDescendant );
+			}
 		}
 		return newChild;
 	}
 
 	//------------------------------
-	void SidTreeNode::addChildToParents( SidTreeNode *sidTreeNode, const SidIdentifier& sidIdentifier )
+	bool SidTreeNode::addDescendant( const Descendant& descendant )
+	{
+		std::pair<SidDescendantMap::iterator, bool> inserted = mChildren.insert(std::make_pair(descendant.node->getSid(), descendant));
+		if ( inserted.second )
+			return true;
+
+		if ( descendant.hierarchyLevel < inserted.first->second.hierarchyLevel )
+		{
+			inserted.first->second = descendant;
+			return true;
+		}
+		return false;
+	}
+
+	//------------------------------
+	void SidTreeNode::addChildToParents( const Descendant& descendant )
 	{
-		if ( sidTreeNode )
+		SidTreeNode *parent = getParent();
+		if ( parent )
 		{
-			SidTreeNode *parent = getParent();
-			if ( parent )
+			Descendant parentDescendant = descendant;
+			// if the parent has no sid, i.e. it has an id, we don't increase the hierarchy level.*/
+			if ( !parent->getSid().empty() )
+			{
+				parentDescendant.hierarchyLevel++;
+			}
+			if ( parent->addDescendant( parentDescendant ) )
 			{
-				SidIdentifier parentSidIdentifier = sidIdentifier;
-				// if the parent has no sid, i.e. it has an id, we don't increase the hierarchy level.*/
-				if ( !parent->getSid().empty() )
-				{
-					parentSidIdentifier.hierarchyLevel++;
-				}
-				parent->mChildren.insert(std::make_pair(parentSidIdentifier, sidTreeNode));
-				parent->addChildToParents( sidTreeNode, parentSidIdentifier );
+				parent->addChildToParents( parentDescendant );
 			}
 		}
 	}
@@ -91,21 +89,10 @@ namespace COLLADASaxFWL
 	//------------------------------
 	SidTreeNode* SidTreeNode::findChildBySid( const String& sid )
 	{
-		SidIdentifier lowerBound( sid, 0);
-		SidIdentifierSidTreeNodeMap::iterator it = mChildren.lower_bound( lowerBound );
-
+		SidDescendantMap::const_iterator it = mChildren.find( sid );
 		if ( it == mChildren.end() )
 			return 0;
-
-		SidIdentifier canidate = it->first;
-		if ( canidate.sid == sid )
-		{
-			return it->second;
-		}
-		else
-		{
-			return 0;
-		}
+		return it->second.node;
 	}
 
 } // namespace COLLADASaxFWL
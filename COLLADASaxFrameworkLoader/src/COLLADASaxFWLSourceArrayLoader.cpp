@@ -26,7 +26,8 @@ namespace COLLADASaxFWL
 	SourceArrayLoader::SourceArrayLoader(IFilePartLoader* callingFilePartLoader)
 		:FilePartLoader(callingFilePartLoader),
 		 mSourceArray( SourceArray::OWNER ),
-		 mCurrentSoure(0)
+		 mCurrentSoure(0),
+		 mLoadArrayValues(true)
 	{
 	}
 
@@ -172,6 +173,8 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool SourceArrayLoader::begin__float_array( const float_array__AttributeData& attributeData )
 	{
+		if ( !mLoadArrayValues )
+			skipNotRequiredElementContent();
 		return beginArray<FloatSource>( attributeData.count, attributeData.id ) != 0;
 	}
 
@@ -185,6 +188,9 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool SourceArrayLoader::data__float_array( const float* data, size_t length )
 	{
+		if ( !mLoadArrayValues )
+			return true;
+
 		FloatSource* source = (FloatSource*)mCurrentSoure;
 		COLLADAFW::FloatArray& array  = source->getArrayElement().getValues();
 		array.appendValues(data, length);
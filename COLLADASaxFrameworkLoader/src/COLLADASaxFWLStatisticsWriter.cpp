@@ -0,0 +1,160 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADASaxFWLStableHeaders.h"
+#include "COLLADASaxFWLStatisticsWriter.h"
+
+
+namespace COLLADASaxFWL
+{
+
+	//------------------------------
+	StatisticsWriter::StatisticsWriter( COLLADAFW::IWriter* writer, LoaderStatistics& statistics )
+		: mWriter( writer )
+		, mStatistics( statistics )
+	{
+	}
+
+	//------------------------------
+	StatisticsWriter::~StatisticsWriter()
+	{
+	}
+
+	//------------------------------
+	template<class ObjectType>
+	bool StatisticsWriter::timedWrite( bool (COLLADAFW::IWriter::*write)( const ObjectType* ), const ObjectType* object, LoaderStatistics::WriterMethod writerMethod )
+	{
+		double startTime = LoaderStatistics::getTime();
+		bool success = (mWriter->*write)( object );
+		mStatistics.addWriterTime( writerMethod, LoaderStatistics::getTime() - startTime );
+		return success;
+	}
+
+	//------------------------------
+	void StatisticsWriter::cancel( const String& errorMessage )
+	{
+		double startTime = LoaderStatistics::getTime();
+		mWriter->cancel( errorMessage );
+		mStatistics.addWriterTime( LoaderStatistics::WRITER_CANCEL, LoaderStatistics::getTime() - startTime );
+	}
+
+	//------------------------------
+	void StatisticsWriter::start()
+	{
+		double startTime = LoaderStatistics::getTime();
+		mWriter->start();
+		mStatistics.addWriterTime( LoaderStatistics::WRITER_START, LoaderStatistics::getTime() - startTime );
+	}
+
+	//------------------------------
+	void StatisticsWriter::finish()
+	{
+		double startTime = LoaderStatistics::getTime();
+		mWriter->finish();
+		mStatistics.addWriterTime( LoaderStatistics::WRITER_FINISH, LoaderStatistics::getTime() - startTime );
+	}
+
+	//------------------------------
+	bool StatisticsWriter::writeGlobalAsset( const COLLADAFW::FileInfo* asset )
+	{
+		return timedWrite( &COLLADAFW::IWriter::writeGlobalAsset, asset, LoaderStatistics::WRITER_GLOBAL_ASSET );
+	}
+
+	//------------------------------
+	bool StatisticsWriter::writeScene( const COLLADAFW::Scene* scene )
+	{
+		return timedWrite( &COLLADAFW::IWriter::writeScene, scene, LoaderStatistics::WRITER_SCENE );
+	}
+
+	//------------------------------
+	bool StatisticsWriter::writeVisualScene( const COLLADAFW::VisualScene* visualScene )
+	{
+		return timedWrite( &COLLADAFW::IWriter::writeVisualScene, visualScene, LoaderStatistics::WRITER_VISUAL_SCENE );
+	}
+
+	//------------------------------
+	bool StatisticsWriter::writeLibraryNodes( const COLLADAFW::LibraryNodes* libraryNodes )
+	{
+		return timedWrite( &COLLADAFW::IWriter::writeLibraryNodes, libraryNodes, LoaderStatistics::WRITER_LIBRARY_NODES );
+	}
+
+	//------------------------------
+	bool StatisticsWriter::writeGeometry( const COLLADAFW::Geometry* geometry )
+	{
+		return timedWrite( &COLLADAFW::IWriter::writeGeometry, geometry, LoaderStatistics::WRITER_GEOMETRY );
+	}
+
+	//------------------------------
+	bool StatisticsWriter::writeMaterial( const COLLADAFW::Material* material )
+	{
+		return timedWrite( &COLLADAFW::IWriter::writeMaterial, material, LoaderStatistics::WRITER_MATERIAL );
+	}
+
+	//------------------------------
+	bool StatisticsWriter::writeEffect( const COLLADAFW::Effect* effect )
+	{
+		return timedWrite( &COLLADAFW::IWriter::writeEffect, effect, LoaderStatistics::WRITER_EFFECT );
+	}
+
+	//------------------------------
+	bool StatisticsWriter::writeCamera( const COLLADAFW::Camera* camera )
+	{
+		return timedWrite( &COLLADAFW::IWriter::writeCamera, camera, LoaderStatistics::WRITER_CAMERA );
+	}
+
+	//------------------------------
+	bool StatisticsWriter::writeImage( const COLLADAFW::Image* image )
+	{
+		return timedWrite( &COLLADAFW::IWriter::writeImage, image, LoaderStatistics::WRITER_IMAGE );
+	}
+
+	//------------------------------
+	bool StatisticsWriter::writeLight( const COLLADAFW::Light* light )
+	{
+		return timedWrite( &COLLADAFW::IWriter::writeLight, light, LoaderStatistics::WRITER_LIGHT );
+	}
+
+	//------------------------------
+	bool StatisticsWriter::writeAnimation( const COLLADAFW::Animation* animation )
+	{
+		return timedWrite( &COLLADAFW::IWriter::writeAnimation, animation, LoaderStatistics::WRITER_ANIMATION );
+	}
+
+	//------------------------------
+	bool StatisticsWriter::writeAnimationList( const COLLADAFW::AnimationList* animationList )
+	{
+		return timedWrite( &COLLADAFW::IWriter::writeAnimationList, animationList, LoaderStatistics::WRITER_ANIMATION_LIST );
+	}
+
+	//------------------------------
+	bool StatisticsWriter::writeSkinControllerData( const COLLADAFW::SkinControllerData* skinControllerData )
+	{
+		return timedWrite( &COLLADAFW::IWriter::writeSkinControllerData, skinControllerData, LoaderStatistics::WRITER_SKIN_CONTROLLER_DATA );
+	}
+
+	//------------------------------
+	bool StatisticsWriter::writeController( const COLLADAFW::Controller* controller )
+	{
+		return timedWrite( &COLLADAFW::IWriter::writeController, controller, LoaderStatistics::WRITER_CONTROLLER );
+	}
+
+	//------------------------------
+	bool StatisticsWriter::writeFormulas( const COLLADAFW::Formulas* formulas )
+	{
+		return timedWrite( &COLLADAFW::IWriter::writeFormulas, formulas, LoaderStatistics::WRITER_FORMULAS );
+	}
+
+	//------------------------------
+	bool StatisticsWriter::writeKinematicsScene( const COLLADAFW::KinematicsScene* kinematicsScene )
+	{
+		return timedWrite( &COLLADAFW::IWriter::writeKinematicsScene, kinematicsScene, LoaderStatistics::WRITER_KINEMATICS_SCENE );
+	}
+
+} // namespace COLLADASaxFWL
@@ -161,9 +161,12 @@ namespace COLLADASaxFWL
     }
 
     //------------------------------
-    template<class FlagsMapPair, class ElementFunctionMap>
-    void createFunctionMap( int flags, int& parsedFlags, ElementFunctionMap& functionMap, FlagsMapPair* flagsMapMap, size_t flagsMapMapSize )
+    /** Returns the COLLADA libraries (LibraryFlags) required to parse the objects in @a flags, or COLLADA_NO_FLAGS
+    if all are required, and sets @a parsedFlags to the objects parsed after the file has been loaded.*/
+    int getRequiredFunctionMaps( int flags, int& parsedFlags )
     {
+        int requiredFunctionMaps = COLLADA_NO_FLAGS;
+
         // A combination of ObjectFlags, indicating which objects will have been parsed, after load() 
         // has been called. These will be contained for sure.
         // We need this to ensure that objects that are store by the Loader ( visual scene, library nodes, 
@@ -174,7 +177,6 @@ namespace COLLADASaxFWL
         {
             // we need to set a customized function map, since we don't need all COLLADA libraries 
             //determine which COLLADA elements we need to parse to get all date needed to parse objects in mObjectFlags
-            int requiredFunctionMaps = 0;
 
             if ( (flags & Loader::ASSET_FLAG) != 0 )
             {
@@ -269,29 +271,47 @@ namespace COLLADASaxFWL
             }
 
 
-            // Fills function map
-            for ( size_t i = 0; i < flagsMapMapSize; ++i )
+            parsedFlags = afterLoadParsedObjectFlags;
+        }
+        return requiredFunctionMaps;
+    }
+
+    //------------------------------
+    template<class FlagsMapPair, class ElementFunctionMap>
+    const ElementFunctionMap* createFunctionMap( int flags, int& parsedFlags, std::map<int, ElementFunctionMap>& functionMaps, FlagsMapPair* flagsMapMap, size_t flagsMapMapSize )
+    {
+        int requiredFunctionMaps = getRequiredFunctionMaps( flags, parsedFlags );
+        if ( requiredFunctionMaps == COLLADA_NO_FLAGS )
+            return 0;
+
+        // the function map of the required libraries is filled, when it is used the first time
+        typename std::map<int, ElementFunctionMap>::iterator it = functionMaps.find( requiredFunctionMaps );
+        if ( it != functionMaps.end() )
+            return &it->second;
+
+        ElementFunctionMap& functionMap = functionMaps[requiredFunctionMaps];
+        for ( size_t i = 0; i < flagsMapMapSize; ++i )
+        {
+            const FlagsMapPair& libraryFlagsFunctionMapPair = flagsMapMap[i];
+            if ( (requiredFunctionMaps & libraryFlagsFunctionMapPair.flag) != 0 )
             {
-                const FlagsMapPair& libraryFlagsFunctionMapPair = flagsMapMap[i];
-                if ( (requiredFunctionMaps & libraryFlagsFunctionMapPair.flag) != 0 )
-                {
-                    functionMap.insert(libraryFlagsFunctionMapPair.functionMap.begin(), libraryFlagsFunctionMapPair.functionMap.end());
-                }
+                functionMap.insert(libraryFlagsFunctionMapPair.functionMap.begin(), libraryFlagsFunctionMapPair.functionMap.end());
             }
-
-            parsedFlags = afterLoadParsedObjectFlags;
         }
+        return &functionMap;
     }
 
     //------------------------------
-    void VersionParser::createFunctionMap14()
+    const COLLADASaxFWL14::ColladaParserAutoGen14Private::ElementFunctionMap* VersionParser::createFunctionMap14()
     {
-        createFunctionMap<LibraryFlagsFunctionMapPair14, COLLADASaxFWL14::ColladaParserAutoGen14Private::ElementFunctionMap>( mFlags, mParsedFlags, mFunctionMap14, libraryFlagsFunctionMapMap14, libraryFlagsFunctionMapMapSize14 );
+        FilteredFunctionMaps& filteredFunctionMaps = mFileLoader->getColladaLoader()->getFilteredFunctionMaps();
+        return createFunctionMap( mFlags, mParsedFlags, filteredFunctionMaps.functionMaps14, libraryFlagsFunctionMapMap14, libraryFlagsFunctionMapMapSize14 );
     }
     //------------------------------
-    void VersionParser::createFunctionMap15()
+    const COLLADASaxFWL15::ColladaParserAutoGen15Private::ElementFunctionMap* VersionParser::createFunctionMap15()
     {
-        createFunctionMap<LibraryFlagsFunctionMapPair15, COLLADASaxFWL15::ColladaParserAutoGen15Private::ElementFunctionMap>( mFlags, mParsedFlags, mFunctionMap15, libraryFlagsFunctionMapMap15, libraryFlagsFunctionMapMapSize15 );
+        FilteredFunctionMaps& filteredFunctionMaps = mFileLoader->getColladaLoader()->getFilteredFunctionMaps();
+        return createFunctionMap( mFlags, mParsedFlags, filteredFunctionMaps.functionMaps15, libraryFlagsFunctionMapMap15, libraryFlagsFunctionMapMapSize15 );
     }
 
     //------------------------------
@@ -326,13 +346,14 @@ namespace COLLADASaxFWL
 #elif defined(GENERATEDSAXPARSER_XMLPARSER_EXPAT)
         GeneratedSaxParser::ExpatSaxParser versionSaxParser( this, XMLPARSER_BUFFERSIZE );
 #endif
+        versionSaxParser.setCollectStatistics( mFileLoader->getStatistics() != 0 );
+        double startTime = mFileLoader->getStatistics() ? LoaderStatistics::getTime() : 0;
         bool success = versionSaxParser.parseFile( fileName );
+        if ( mFileLoader->getStatistics() )
+            addToStatistics( versionSaxParser, LoaderStatistics::getTime() - startTime );
 
  //       mFileLoader->postProcess();
 
-        delete mPrivateParser14;
-        delete mPrivateParser15;
-
         mFileLoader->setPrivateParser( (COLLADASaxFWL14::ColladaParserAutoGen14Private*)0 );
         mFileLoader->setPrivateParser( (COLLADASaxFWL15::ColladaParserAutoGen15Private*)0 );
 
@@ -350,19 +371,39 @@ namespace COLLADASaxFWL
 #elif defined(GENERATEDSAXPARSER_XMLPARSER_EXPAT)
         GeneratedSaxParser::ExpatSaxParser versionSaxParser( this, XMLPARSER_BUFFERSIZE );
 #endif
+        versionSaxParser.setCollectStatistics( mFileLoader->getStatistics() != 0 );
+        double startTime = mFileLoader->getStatistics() ? LoaderStatistics::getTime() : 0;
         bool success = versionSaxParser.parseBuffer( uriString, buffer, length );
+        if ( mFileLoader->getStatistics() )
+            addToStatistics( versionSaxParser, LoaderStatistics::getTime() - startTime );
         
         //       mFileLoader->postProcess();
         
-        delete mPrivateParser14;
-        delete mPrivateParser15;
-        
         mFileLoader->setPrivateParser( (COLLADASaxFWL14::ColladaParserAutoGen14Private*)0 );
         mFileLoader->setPrivateParser( (COLLADASaxFWL15::ColladaParserAutoGen15Private*)0 );
         
         return success;
     }
     
+    //------------------------------
+    void VersionParser::addToStatistics( const GeneratedSaxParser::SaxParser& saxParser, double parseTime )
+    {
+        LoaderStatistics* statistics = mFileLoader->getStatistics();
+        statistics->stopPartLoader();
+        statistics->addFile( saxParser.getBytesRead(), saxParser.getElementCount(), parseTime );
+
+        const GeneratedSaxParser::ParserTemplateBase* privateParser = mPrivateParser14;
+        if ( !privateParser )
+            privateParser = mPrivateParser15;
+        if ( !privateParser )
+            return;
+        for ( int i = 0; i < GeneratedSaxParser::ParserTemplateBase::VALUE_TYPE_COUNT; ++i )
+        {
+            LoaderStatistics::ValueType valueType = (LoaderStatistics::ValueType)i;
+            statistics->addConvertedValues( valueType, privateParser->getConvertedValueCount( valueType ) );
+        }
+    }
+
     //------------------------------
     bool VersionParser::elementBegin( const ParserChar* elementName, const ParserAttributes& attributes )
     {
@@ -425,20 +466,26 @@ namespace COLLADASaxFWL
     //------------------------------
     bool VersionParser::parse14( const ParserChar* elementName, const ParserAttributes& attributes )
     {
-        createFunctionMap14();
+        const COLLADASaxFWL14::ColladaParserAutoGen14Private::ElementFunctionMap* functionMap = createFunctionMap14();
 
         // note: rootParser is created with new because it is deleted in IFilePartLoader::~IFilePartLoader()
         RootParser14* rootParser = new RootParser14( mFileLoader );
         mFileLoader->setParserImpl( rootParser );
-        mPrivateParser14 = new COLLADASaxFWL14::ColladaParserAutoGen14Private( rootParser, (GeneratedSaxParser::IErrorHandler*)mFileLoader->getErrorHandler() );
+        // the private parser is owned by the loader and reused for all files it loads
+        mPrivateParser14 = mFileLoader->getColladaLoader()->getPrivateParser14( rootParser, (GeneratedSaxParser::IErrorHandler*)mFileLoader->getErrorHandler() );
         mFileLoader->setPrivateParser( mPrivateParser14 );
+        mPrivateParser14->setCollectStatistics( mFileLoader->getStatistics() != 0 );
 
         //privateParser.setCallbackObject( &rootParser );
 		mPrivateParser14->registerUnknownElementHandler( &mFileLoader->mExtraDataElementHandler );
 
-        if ( !mFunctionMap14.empty() )
+        if ( functionMap )
         {
-            mPrivateParser14->setElementFunctionMap( &mFunctionMap14 );
+            mPrivateParser14->setElementFunctionMap( functionMap );
+        }
+        else
+        {
+            mPrivateParser14->setElementFunctionMap( &mPrivateParser14->getCompleteElementFunctionMap() );
         }
 
         getSaxParser()->setParser( mPrivateParser14 );
@@ -448,20 +495,26 @@ namespace COLLADASaxFWL
     //------------------------------
     bool VersionParser::parse15( const ParserChar* elementName, const ParserAttributes& attributes )
     {
-        createFunctionMap15();
+        const COLLADASaxFWL15::ColladaParserAutoGen15Private::ElementFunctionMap* functionMap = createFunctionMap15();
 
         // note: rootParser is created with new because it is deleted in IFilePartLoader::~IFilePartLoader()
         RootParser15* rootParser = new RootParser15( mFileLoader );
         mFileLoader->setParserImpl( rootParser );
-        mPrivateParser15 = new COLLADASaxFWL15::ColladaParserAutoGen15Private( rootParser, (GeneratedSaxParser::IErrorHandler*)mFileLoader->getErrorHandler() );
+        // the private parser is owned by the loader and reused for all files it loads
+        mPrivateParser15 = mFileLoader->getColladaLoader()->getPrivateParser15( rootParser, (GeneratedSaxParser::IErrorHandler*)mFileLoader->getErrorHandler() );
         mFileLoader->setPrivateParser( mPrivateParser15 );
+        mPrivateParser15->setCollectStatistics( mFileLoader->getStatistics() != 0 );
 
         //privateParser.setCallbackObject( &rootParser );
 		mPrivateParser15->registerUnknownElementHandler( &mFileLoader->mExtraDataElementHandler );
 
-        if ( !mFunctionMap15.empty() )
+        if ( functionMap )
         {
-            mPrivateParser15->setElementFunctionMap( &mFunctionMap15 );
+            mPrivateParser15->setElementFunctionMap( functionMap );
+        }
+        else
+        {
+            mPrivateParser15->setElementFunctionMap( &mPrivateParser15->getCompleteElementFunctionMap() );
         }
 
         getSaxParser()->setParser( mPrivateParser15 );
@@ -482,4 +535,17 @@ namespace COLLADASaxFWL
 		}
 		return 0;
 	}
+
+	//------------------------------
+	void VersionParser::skipElementContent()
+	{
+		if ( mPrivateParser14 )
+		{
+			mPrivateParser14->skipElementContent();
+		}
+		if ( mPrivateParser15 )
+		{
+			mPrivateParser15->skipElementContent();
+		}
+	}
 }
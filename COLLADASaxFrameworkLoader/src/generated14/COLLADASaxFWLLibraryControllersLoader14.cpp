@@ -195,7 +195,7 @@ return mLoader->end__vcount();
 }
 
 
-bool LibraryControllersLoader14::data__vcount( const uint64* data, size_t length )
+bool LibraryControllersLoader14::data__vcount( const uint32* data, size_t length )
 {
 SaxVirtualFunctionTest14(data__vcount(data, length));
 return mLoader->data__vcount(data, length);
@@ -216,7 +216,7 @@ return mLoader->end__v();
 }
 
 
-bool LibraryControllersLoader14::data__v( const sint64* data, size_t length )
+bool LibraryControllersLoader14::data__v( const sint32* data, size_t length )
 {
 SaxVirtualFunctionTest14(data__v(data, length));
 return mLoader->data__v(data, length);
@@ -8370,15 +8370,15 @@ bool ColladaParserAutoGen15Private::_data__vcount( const ParserChar* text, size_
 #ifdef GENERATEDSAXPARSER_VALIDATION
     if ( mValidate )
     {
-return characterData2Uint64Data(text, textLength, &ColladaParserAutoGen15::data__vcount, 0, 0, 0);
+return characterData2Uint32Data(text, textLength, &ColladaParserAutoGen15::data__vcount, 0, 0, 0);
     }
     else
     {
-return characterData2Uint64Data(text, textLength, &ColladaParserAutoGen15::data__vcount);
+return characterData2Uint32Data(text, textLength, &ColladaParserAutoGen15::data__vcount);
     }
 #else
     {
-return characterData2Uint64Data(text, textLength, &ColladaParserAutoGen15::data__vcount);
+return characterData2Uint32Data(text, textLength, &ColladaParserAutoGen15::data__vcount);
     } // validation
 #endif
 
@@ -8416,16 +8416,16 @@ bool ColladaParserAutoGen15Private::_preEnd__vcount()
 #ifdef GENERATEDSAXPARSER_VALIDATION
     if ( mValidate )
     {
-bool returnValue = uint64DataEnd( &ColladaParserAutoGen15::data__vcount, 0, 0, 0 );
+bool returnValue = uint32DataEnd( &ColladaParserAutoGen15::data__vcount, 0, 0, 0 );
         return returnValue;
     }
     else
     {
-return uint64DataEnd( &ColladaParserAutoGen15::data__vcount );
+return uint32DataEnd( &ColladaParserAutoGen15::data__vcount );
     }
 #else
     {
-return uint64DataEnd( &ColladaParserAutoGen15::data__vcount );
+return uint32DataEnd( &ColladaParserAutoGen15::data__vcount );
     } // validation
 #endif
 
@@ -8443,15 +8443,15 @@ bool ColladaParserAutoGen15Private::_data__v( const ParserChar* text, size_t tex
 #ifdef GENERATEDSAXPARSER_VALIDATION
     if ( mValidate )
     {
-return characterData2Sint64Data(text, textLength, &ColladaParserAutoGen15::data__v, 0, 0, 0);
+return characterData2Sint32Data(text, textLength, &ColladaParserAutoGen15::data__v, 0, 0, 0);
     }
     else
     {
-return characterData2Sint64Data(text, textLength, &ColladaParserAutoGen15::data__v);
+return characterData2Sint32Data(text, textLength, &ColladaParserAutoGen15::data__v);
     }
 #else
     {
-return characterData2Sint64Data(text, textLength, &ColladaParserAutoGen15::data__v);
+return characterData2Sint32Data(text, textLength, &ColladaParserAutoGen15::data__v);
     } // validation
 #endif
 
@@ -8489,16 +8489,16 @@ bool ColladaParserAutoGen15Private::_preEnd__v()
 #ifdef GENERATEDSAXPARSER_VALIDATION
     if ( mValidate )
     {
-bool returnValue = sint64DataEnd( &ColladaParserAutoGen15::data__v, 0, 0, 0 );
+bool returnValue = sint32DataEnd( &ColladaParserAutoGen15::data__v, 0, 0, 0 );
         return returnValue;
     }
     else
     {
-return sint64DataEnd( &ColladaParserAutoGen15::data__v );
+return sint32DataEnd( &ColladaParserAutoGen15::data__v );
     }
 #else
     {
-return sint64DataEnd( &ColladaParserAutoGen15::data__v );
+return sint32DataEnd( &ColladaParserAutoGen15::data__v );
     } // validation
 #endif
 
@@ -9244,15 +9244,15 @@ bool ColladaParserAutoGen15Private::_data__p( const ParserChar* text, size_t tex
 #ifdef GENERATEDSAXPARSER_VALIDATION
     if ( mValidate )
     {
-return characterData2Uint64Data(text, textLength, &ColladaParserAutoGen15::data__p, 0, 0, 0);
+return characterData2Uint32Data(text, textLength, &ColladaParserAutoGen15::data__p, 0, 0, 0);
     }
     else
     {
-return characterData2Uint64Data(text, textLength, &ColladaParserAutoGen15::data__p);
+return characterData2Uint32Data(text, textLength, &ColladaParserAutoGen15::data__p);
     }
 #else
     {
-return characterData2Uint64Data(text, textLength, &ColladaParserAutoGen15::data__p);
+return characterData2Uint32Data(text, textLength, &ColladaParserAutoGen15::data__p);
     } // validation
 #endif
 
@@ -9290,16 +9290,16 @@ bool ColladaParserAutoGen15Private::_preEnd__p()
 #ifdef GENERATEDSAXPARSER_VALIDATION
     if ( mValidate )
     {
-bool returnValue = uint64DataEnd( &ColladaParserAutoGen15::data__p, 0, 0, 0 );
+bool returnValue = uint32DataEnd( &ColladaParserAutoGen15::data__p, 0, 0, 0 );
         return returnValue;
     }
     else
     {
-return uint64DataEnd( &ColladaParserAutoGen15::data__p );
+return uint32DataEnd( &ColladaParserAutoGen15::data__p );
     }
 #else
     {
-return uint64DataEnd( &ColladaParserAutoGen15::data__p );
+return uint32DataEnd( &ColladaParserAutoGen15::data__p );
     } // validation
 #endif
 
@@ -9629,15 +9629,15 @@ bool ColladaParserAutoGen15Private::_data__h( const ParserChar* text, size_t tex
 #ifdef GENERATEDSAXPARSER_VALIDATION
     if ( mValidate )
     {
-return characterData2Uint64Data(text, textLength, &ColladaParserAutoGen15::data__h, 0, 0, 0);
+return characterData2Uint32Data(text, textLength, &ColladaParserAutoGen15::data__h, 0, 0, 0);
     }
     else
     {
-return characterData2Uint64Data(text, textLength, &ColladaParserAutoGen15::data__h);
+return characterData2Uint32Data(text, textLength, &ColladaParserAutoGen15::data__h);
     }
 #else
     {
-return characterData2Uint64Data(text, textLength, &ColladaParserAutoGen15::data__h);
+return characterData2Uint32Data(text, textLength, &ColladaParserAutoGen15::data__h);
     } // validation
 #endif
 
@@ -9675,16 +9675,16 @@ bool ColladaParserAutoGen15Private::_preEnd__h()
 #ifdef GENERATEDSAXPARSER_VALIDATION
     if ( mValidate )
     {
-bool returnValue = uint64DataEnd( &ColladaParserAutoGen15::data__h, 0, 0, 0 );
+bool returnValue = uint32DataEnd( &ColladaParserAutoGen15::data__h, 0, 0, 0 );
         return returnValue;
     }
     else
     {
-return uint64DataEnd( &ColladaParserAutoGen15::data__h );
+return uint32DataEnd( &ColladaParserAutoGen15::data__h );
     }
 #else
     {
-return uint64DataEnd( &ColladaParserAutoGen15::data__h );
+return uint32DataEnd( &ColladaParserAutoGen15::data__h );
     } // validation
 #endif
 
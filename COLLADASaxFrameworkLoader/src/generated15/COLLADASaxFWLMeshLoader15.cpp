@@ -129,7 +129,7 @@ return mLoader->end__p();
 }
 
 
-bool MeshLoader15::data__p( const uint64* data, size_t length )
+bool MeshLoader15::data__p( const uint32* data, size_t length )
 {
 SaxVirtualFunctionTest15(data__p(data, length));
 return mLoader->data__p(data, length);
@@ -150,7 +150,7 @@ return mLoader->end__vcount();
 }
 
 
-bool MeshLoader15::data__vcount( const uint64* data, size_t length )
+bool MeshLoader15::data__vcount( const uint32* data, size_t length )
 {
 SaxVirtualFunctionTest15(data__vcount(data, length));
 return mLoader->data__vcount(data, length);
@@ -171,7 +171,7 @@ return mLoader->end__h();
 }
 
 
-bool MeshLoader15::data__h( const uint64* data, size_t length )
+bool MeshLoader15::data__h( const uint32* data, size_t length )
 {
 SaxVirtualFunctionTest15(data__h(data, length));
 return mLoader->data__h(data, length);
@@ -0,0 +1,201 @@
+#include "COLLADASaxFWLLoader.h"
+#include "COLLADASaxFWLLoadSession.h"
+#include "COLLADASaxFWLIErrorHandler.h"
+#include "COLLADASaxFWLIError.h"
+
+#include "COLLADAFWIWriter.h"
+#include "COLLADAFWGeometry.h"
+#include "COLLADAFWVisualScene.h"
+#include "COLLADAFWNode.h"
+#include "COLLADAFWEffect.h"
+#include "COLLADAFWMaterial.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+
+
+// Loads two documents through one LoadSession and checks, that they are loaded independently of each other.
+
+namespace
+{
+    int failures = 0;
+
+    void check( bool condition, const char* description )
+    {
+        if ( !condition )
+        {
+            std::cerr << "FAILED: " << description << std::endl;
+            ++failures;
+        }
+    }
+
+    const char* FIRST_DOCUMENT =
+        "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+        "<COLLADA xmlns=\"http://www.collada.org/2005/11/COLLADASchema\" version=\"1.4.1\">"
+        "<asset><created>2009-01-01T00:00:00</created><modified>2009-01-01T00:00:00</modified></asset>"
+        "<library_effects><effect id=\"effect\"><profile_COMMON><technique sid=\"common\">"
+        "<constant><emission><color>1 0 0 1</color></emission></constant>"
+        "</technique></profile_COMMON></effect></library_effects>"
+        "<library_materials><material id=\"material\"><instance_effect url=\"#effect\"/></material></library_materials>"
+        "<library_geometries><geometry id=\"geometry\"><mesh>"
+        "<source id=\"positions\"><float_array id=\"positions-array\" count=\"9\">0 0 0 1 0 0 0 1 0</float_array>"
+        "<technique_common><accessor source=\"#positions-array\" count=\"3\" stride=\"3\">"
+        "<param name=\"X\" type=\"float\"/><param name=\"Y\" type=\"float\"/><param name=\"Z\" type=\"float\"/>"
+        "</accessor></technique_common></source>"
+        "<vertices id=\"vertices\"><input semantic=\"POSITION\" source=\"#positions\"/></vertices>"
+        "<triangles count=\"1\"><input semantic=\"VERTEX\" source=\"#vertices\" offset=\"0\"/><p>0 1 2</p></triangles>"
+        "</mesh></geometry></library_geometries>"
+        "<library_visual_scenes><visual_scene id=\"scene\">"
+        "<node id=\"first\"><instance_geometry url=\"#geometry\"/></node>"
+        "</visual_scene></library_visual_scenes>"
+        "<scene><instance_visual_scene url=\"#scene\"/></scene>"
+        "</COLLADA>";
+
+    // uses the same ids as the first document, but has no effects and materials
+    const char* SECOND_DOCUMENT =
+        "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+        "<COLLADA xmlns=\"http://www.collada.org/2005/11/COLLADASchema\" version=\"1.4.1\">"
+        "<asset><created>2009-01-01T00:00:00</created><modified>2009-01-01T00:00:00</modified></asset>"
+        "<library_geometries><geometry id=\"geometry\"><mesh>"
+        "<source id=\"positions\"><float_array id=\"positions-array\" count=\"9\">0 0 0 2 0 0 0 2 0</float_array>"
+        "<technique_common><accessor source=\"#positions-array\" count=\"3\" stride=\"3\">"
+        "<param name=\"X\" type=\"float\"/><param name=\"Y\" type=\"float\"/><param name=\"Z\" type=\"float\"/>"
+        "</accessor></technique_common></source>"
+        "<vertices id=\"vertices\"><input semantic=\"POSITION\" source=\"#positions\"/></vertices>"
+        "<triangles count=\"1\"><input semantic=\"VERTEX\" source=\"#vertices\" offset=\"0\"/><p>0 1 2</p></triangles>"
+        "</mesh></geometry></library_geometries>"
+        "<library_visual_scenes><visual_scene id=\"scene\">"
+        "<node id=\"second\"><instance_geometry url=\"#geometry\"/></node>"
+        "</visual_scene></library_visual_scenes>"
+        "<scene><instance_visual_scene url=\"#scene\"/></scene>"
+        "</COLLADA>";
+
+    /** Counts the errors reported by the loader.*/
+    class ErrorCounter : public COLLADASaxFWL::IErrorHandler
+    {
+    public:
+        int errorCount;
+
+        ErrorCounter() : errorCount( 0 ) {}
+
+        virtual bool handleError( const COLLADASaxFWL::IError* error )
+        {
+            std::cerr << error->getFullErrorMessage() << std::endl;
+            ++errorCount;
+            return false;
+        }
+    };
+
+    /** Records the unique ids of all objects and the ids of the nodes of one document.*/
+    class RecordingWriter : public COLLADAFW::IWriter
+    {
+    public:
+        std::vector< COLLADAFW::UniqueId > uniqueIds;
+        std::vector< std::string > nodeIds;
+        size_t geometryCount;
+        size_t effectCount;
+        size_t materialCount;
+
+        RecordingWriter() : geometryCount( 0 ), effectCount( 0 ), materialCount( 0 ) {}
+
+        virtual void cancel( const COLLADAFW::String& errorMessage ) {}
+        virtual void start() {}
+        virtual void finish() {}
+        virtual bool writeGlobalAsset( const COLLADAFW::FileInfo* asset ) { return true; }
+        virtual bool writeScene( const COLLADAFW::Scene* scene ) { return true; }
+
+        virtual bool writeVisualScene( const COLLADAFW::VisualScene* visualScene )
+        {
+            uniqueIds.push_back( visualScene->getUniqueId() );
+            const COLLADAFW::NodePointerArray& rootNodes = visualScene->getRootNodes();
+            for ( size_t i = 0; i < rootNodes.getCount(); ++i )
+            {
+                uniqueIds.push_back( rootNodes[i]->getUniqueId() );
+                nodeIds.push_back( rootNodes[i]->getOriginalId() );
+            }
+            return true;
+        }
+
+        virtual bool writeLibraryNodes( const COLLADAFW::LibraryNodes* libraryNodes ) { return true; }
+
+        virtual bool writeGeometry( const COLLADAFW::Geometry* geometry )
+        {
+            uniqueIds.push_back( geometry->getUniqueId() );
+            ++geometryCount;
+            return true;
+        }
+
+        virtual bool writeMaterial( const COLLADAFW::Material* material )
+        {
+            uniqueIds.push_back( material->getUniqueId() );
+            ++materialCount;
+            return true;
+        }
+
+        virtual bool writeEffect( const COLLADAFW::Effect* effect )
+        {
+            uniqueIds.push_back( effect->getUniqueId() );
+            ++effectCount;
+            return true;
+        }
+
+        virtual bool writeCamera( const COLLADAFW::Camera* camera ) { return true; }
+        virtual bool writeImage( const COLLADAFW::Image* image ) { return true; }
+        virtual bool writeLight( const COLLADAFW::Light* light ) { return true; }
+        virtual bool writeAnimation( const COLLADAFW::Animation* animation ) { return true; }
+        virtual bool writeAnimationList( const COLLADAFW::AnimationList* animationList ) { return true; }
+        virtual bool writeSkinControllerData( const COLLADAFW::SkinControllerData* skinControllerData ) { return true; }
+        virtual bool writeController( const COLLADAFW::Controller* controller ) { return true; }
+        virtual bool writeFormulas( const COLLADAFW::Formulas* formulas ) { return true; }
+        virtual bool writeKinematicsScene( const COLLADAFW::KinematicsScene* kinematicsScene ) { return true; }
+    };
+
+    /** Returns true, if @a first and @a second have no unique id in common.*/
+    bool areDisjoint( const std::vector< COLLADAFW::UniqueId >& first, const std::vector< COLLADAFW::UniqueId >& second )
+    {
+        for ( size_t i = 0; i < second.size(); ++i )
+        {
+            if ( std::find( first.begin(), first.end(), second[i] ) != first.end() )
+                return false;
+        }
+        return true;
+    }
+}
+
+
+int main()
+{
+    ErrorCounter errorCounter;
+    COLLADASaxFWL::Loader loader( &errorCounter );
+    COLLADASaxFWL::LoadSession session( loader );
+
+    RecordingWriter firstWriter;
+    bool firstLoaded = session.loadDocument( "file:///first.dae", FIRST_DOCUMENT, (int)strlen( FIRST_DOCUMENT ), &firstWriter );
+    check( firstLoaded, "the first document is loaded" );
+
+    RecordingWriter secondWriter;
+    bool secondLoaded = session.loadDocument( "file:///second.dae", SECOND_DOCUMENT, (int)strlen( SECOND_DOCUMENT ), &secondWriter );
+    check( secondLoaded, "the second document is loaded" );
+
+    check( errorCounter.errorCount == 0, "no errors are reported" );
+    check( session.getDocumentCount() == 2, "the session counts both documents" );
+
+    check( firstWriter.geometryCount == 1 && firstWriter.effectCount == 1 && firstWriter.materialCount == 1, "the objects of the first document are written" );
+    check( firstWriter.nodeIds.size() == 1 && firstWriter.nodeIds[0] == "first", "the first document has its own node" );
+
+    check( secondWriter.geometryCount == 1, "the geometry of the second document is written" );
+    check( secondWriter.effectCount == 0 && secondWriter.materialCount == 0, "no effects and materials of the first document are written for the second" );
+    check( secondWriter.nodeIds.size() == 1 && secondWriter.nodeIds[0] == "second", "no nodes of the first document are written for the second" );
+
+    check( !firstWriter.uniqueIds.empty() && !secondWriter.uniqueIds.empty(), "unique ids are recorded" );
+    check( areDisjoint( firstWriter.uniqueIds, secondWriter.uniqueIds ), "the unique ids of the documents differ, although their ids are the same" );
+
+    if ( failures > 0 )
+        return -1;
+
+    std::cout << "All LoadSession tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,205 @@
+#include "COLLADASaxFWLLoader.h"
+#include "COLLADASaxFWLIErrorHandler.h"
+#include "COLLADASaxFWLIError.h"
+
+#include "COLLADAFWIWriter.h"
+#include "COLLADAFWRoot.h"
+#include "COLLADAFWGeometry.h"
+#include "COLLADAFWMesh.h"
+#include "COLLADAFWAnimationCurve.h"
+#include "COLLADAFWSkinControllerData.h"
+
+#include <iostream>
+#include <vector>
+#include <cstring>
+
+
+// Loads a document into a writer that requires all object data and into one that requires none. Without
+// object data the values and indices are skipped, but the same objects with the same face counts are written.
+
+namespace
+{
+    int failures = 0;
+
+    void check( bool condition, const char* description )
+    {
+        if ( !condition )
+        {
+            std::cerr << "FAILED: " << description << std::endl;
+            ++failures;
+        }
+    }
+
+    const char* DOCUMENT =
+        "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+        "<COLLADA xmlns=\"http://www.collada.org/2005/11/COLLADASchema\" version=\"1.4.1\">"
+        "<asset><created>2009-01-01T00:00:00</created><modified>2009-01-01T00:00:00</modified></asset>"
+        "<library_animations><animation id=\"animation\">"
+        "<source id=\"input\"><float_array id=\"input-array\" count=\"3\">0 1 2</float_array>"
+        "<technique_common><accessor source=\"#input-array\" count=\"3\"><param name=\"TIME\" type=\"float\"/></accessor></technique_common></source>"
+        "<source id=\"output\"><float_array id=\"output-array\" count=\"3\">0 5 10</float_array>"
+        "<technique_common><accessor source=\"#output-array\" count=\"3\"><param name=\"X\" type=\"float\"/></accessor></technique_common></source>"
+        "<source id=\"interpolation\"><Name_array id=\"interpolation-array\" count=\"3\">LINEAR LINEAR LINEAR</Name_array>"
+        "<technique_common><accessor source=\"#interpolation-array\" count=\"3\"><param name=\"INTERPOLATION\" type=\"name\"/></accessor></technique_common></source>"
+        "<sampler id=\"sampler\"><input semantic=\"INPUT\" source=\"#input\"/><input semantic=\"OUTPUT\" source=\"#output\"/>"
+        "<input semantic=\"INTERPOLATION\" source=\"#interpolation\"/></sampler>"
+        "<channel source=\"#sampler\" target=\"node/translate.X\"/>"
+        "</animation></library_animations>"
+        "<library_controllers><controller id=\"controller\"><skin source=\"#geometry\">"
+        "<source id=\"joints\"><Name_array id=\"joints-array\" count=\"2\">root tip</Name_array>"
+        "<technique_common><accessor source=\"#joints-array\" count=\"2\"><param name=\"JOINT\" type=\"name\"/></accessor></technique_common></source>"
+        "<source id=\"matrices\"><float_array id=\"matrices-array\" count=\"32\">1 0 0 0 0 1 0 0 0 0 1 0 0 0 0 1 1 0 0 0 0 1 0 0 0 0 1 -1 0 0 0 1</float_array>"
+        "<technique_common><accessor source=\"#matrices-array\" count=\"2\" stride=\"16\"><param name=\"TRANSFORM\" type=\"float4x4\"/></accessor></technique_common></source>"
+        "<source id=\"weights\"><float_array id=\"weights-array\" count=\"2\">1 0.5</float_array>"
+        "<technique_common><accessor source=\"#weights-array\" count=\"2\"><param name=\"WEIGHT\" type=\"float\"/></accessor></technique_common></source>"
+        "<joints><input semantic=\"JOINT\" source=\"#joints\"/><input semantic=\"INV_BIND_MATRIX\" source=\"#matrices\"/></joints>"
+        "<vertex_weights count=\"4\"><input semantic=\"JOINT\" source=\"#joints\" offset=\"0\"/><input semantic=\"WEIGHT\" source=\"#weights\" offset=\"1\"/>"
+        "<vcount>1 1 2 1</vcount><v>0 0 1 0 0 1 1 1 1 0</v></vertex_weights>"
+        "</skin></controller></library_controllers>"
+        "<library_geometries><geometry id=\"geometry\"><mesh>"
+        "<source id=\"positions\"><float_array id=\"positions-array\" count=\"12\">0 0 0 1 0 0 1 1 0 0 1 0</float_array>"
+        "<technique_common><accessor source=\"#positions-array\" count=\"4\" stride=\"3\">"
+        "<param name=\"X\" type=\"float\"/><param name=\"Y\" type=\"float\"/><param name=\"Z\" type=\"float\"/>"
+        "</accessor></technique_common></source>"
+        "<vertices id=\"vertices\"><input semantic=\"POSITION\" source=\"#positions\"/></vertices>"
+        "<lines count=\"2\"><input semantic=\"VERTEX\" source=\"#vertices\" offset=\"0\"/><p>0 1 2 3</p></lines>"
+        "<triangles count=\"2\"><input semantic=\"VERTEX\" source=\"#vertices\" offset=\"0\"/><p>0 1 2 0 2 3</p></triangles>"
+        "<polylist count=\"2\"><input semantic=\"VERTEX\" source=\"#vertices\" offset=\"0\"/><vcount>3 4</vcount><p>0 1 2 0 1 2 3</p></polylist>"
+        "<polygons count=\"2\"><input semantic=\"VERTEX\" source=\"#vertices\" offset=\"0\"/><p>0 1 2</p><p>0 1 2 3</p></polygons>"
+        "<tristrips count=\"1\"><input semantic=\"VERTEX\" source=\"#vertices\" offset=\"0\"/><p>0 1 3 2</p></tristrips>"
+        "</mesh></geometry></library_geometries>"
+        "<library_visual_scenes><visual_scene id=\"scene\">"
+        "<node id=\"node\"><translate sid=\"translate\">0 0 0</translate><instance_geometry url=\"#geometry\"/></node>"
+        "</visual_scene></library_visual_scenes>"
+        "<scene><instance_visual_scene url=\"#scene\"/></scene>"
+        "</COLLADA>";
+
+    /** Counts the errors reported by the loader.*/
+    class ErrorCounter : public COLLADASaxFWL::IErrorHandler
+    {
+    public:
+        int errorCount;
+
+        ErrorCounter() : errorCount( 0 ) {}
+
+        virtual bool handleError( const COLLADASaxFWL::IError* error )
+        {
+            std::cerr << error->getFullErrorMessage() << std::endl;
+            ++errorCount;
+            return false;
+        }
+    };
+
+    /** Requires @a requiredObjectData and records the face counts of the mesh primitives, the values of the
+    meshes, the animation curves and the skin controller data.*/
+    class RecordingWriter : public COLLADAFW::IWriter
+    {
+    public:
+        int requiredObjectData;
+        std::vector< size_t > faceCounts;
+        size_t positionCount;
+        size_t curveCount;
+        size_t keyCount;
+        size_t skinCount;
+        size_t jointsCount;
+        size_t skinVertexCount;
+
+        RecordingWriter( int _requiredObjectData )
+            : requiredObjectData( _requiredObjectData )
+            , positionCount( 0 )
+            , curveCount( 0 )
+            , keyCount( 0 )
+            , skinCount( 0 )
+            , jointsCount( 0 )
+            , skinVertexCount( 0 )
+        {}
+
+        virtual int getRequiredObjectData() const { return requiredObjectData; }
+
+        virtual void cancel( const COLLADAFW::String& errorMessage ) {}
+        virtual void start() {}
+        virtual void finish() {}
+        virtual bool writeGlobalAsset( const COLLADAFW::FileInfo* asset ) { return true; }
+        virtual bool writeScene( const COLLADAFW::Scene* scene ) { return true; }
+        virtual bool writeVisualScene( const COLLADAFW::VisualScene* visualScene ) { return true; }
+        virtual bool writeLibraryNodes( const COLLADAFW::LibraryNodes* libraryNodes ) { return true; }
+
+        virtual bool writeGeometry( const COLLADAFW::Geometry* geometry )
+        {
+            if ( geometry->getType() != COLLADAFW::Geometry::GEO_TYPE_MESH )
+                return true;
+            const COLLADAFW::Mesh* mesh = (const COLLADAFW::Mesh*)geometry;
+            positionCount += mesh->getPositions().getValuesCount();
+            const COLLADAFW::MeshPrimitiveArray& meshPrimitives = mesh->getMeshPrimitives();
+            for ( size_t i = 0; i < meshPrimitives.getCount(); ++i )
+                faceCounts.push_back( meshPrimitives[i]->getFaceCount() );
+            return true;
+        }
+
+        virtual bool writeMaterial( const COLLADAFW::Material* material ) { return true; }
+        virtual bool writeEffect( const COLLADAFW::Effect* effect ) { return true; }
+        virtual bool writeCamera( const COLLADAFW::Camera* camera ) { return true; }
+        virtual bool writeImage( const COLLADAFW::Image* image ) { return true; }
+        virtual bool writeLight( const COLLADAFW::Light* light ) { return true; }
+
+        virtual bool writeAnimation( const COLLADAFW::Animation* animation )
+        {
+            if ( animation->getAnimationType() != COLLADAFW::Animation::ANIMATION_CURVE )
+                return true;
+            ++curveCount;
+            keyCount += ((const COLLADAFW::AnimationCurve*)animation)->getKeyCount();
+            return true;
+        }
+
+        virtual bool writeAnimationList( const COLLADAFW::AnimationList* animationList ) { return true; }
+
+        virtual bool writeSkinControllerData( const COLLADAFW::SkinControllerData* skinControllerData )
+        {
+            ++skinCount;
+            jointsCount += skinControllerData->getJointsCount();
+            skinVertexCount += skinControllerData->getVertexCount();
+            return true;
+        }
+
+        virtual bool writeController( const COLLADAFW::Controller* controller ) { return true; }
+        virtual bool writeFormulas( const COLLADAFW::Formulas* formulas ) { return true; }
+        virtual bool writeKinematicsScene( const COLLADAFW::KinematicsScene* kinematicsScene ) { return true; }
+    };
+
+    bool load( RecordingWriter& writer )
+    {
+        ErrorCounter errorCounter;
+        COLLADASaxFWL::Loader loader( &errorCounter );
+        bool loaded = loader.loadDocument( "file:///document.dae", DOCUMENT, (int)strlen( DOCUMENT ), &writer );
+        return loaded && errorCounter.errorCount == 0;
+    }
+}
+
+
+int main()
+{
+    RecordingWriter allDataWriter( COLLADAFW::IWriter::ALL_OBJECT_DATA );
+    check( load( allDataWriter ), "the document is loaded with all object data" );
+
+    // lines, triangles, polylist, polygons and tristrips
+    const size_t expectedFaceCounts[] = { 2, 2, 2, 2, 2 };
+    check( allDataWriter.faceCounts.size() == 5 && std::equal( expectedFaceCounts, expectedFaceCounts + 5, allDataWriter.faceCounts.begin() ),
+        "the face counts of all primitives" );
+    check( allDataWriter.positionCount == 12, "the positions are loaded" );
+    check( allDataWriter.curveCount == 1 && allDataWriter.keyCount == 3, "the keys of the animation curve are loaded" );
+    check( allDataWriter.skinCount == 1 && allDataWriter.jointsCount == 2 && allDataWriter.skinVertexCount == 4, "the skin controller data is loaded" );
+
+    RecordingWriter noDataWriter( 0 );
+    check( load( noDataWriter ), "the document is loaded without object data" );
+    check( noDataWriter.faceCounts == allDataWriter.faceCounts, "the primitives keep their face counts without indices" );
+    check( noDataWriter.positionCount == 0, "the positions are skipped" );
+    check( noDataWriter.curveCount == 1 && noDataWriter.keyCount == 0, "the animation curve is written without keys" );
+    check( noDataWriter.skinCount == 1 && noDataWriter.jointsCount == 2 && noDataWriter.skinVertexCount == 0,
+        "the skin controller data is written with its joints, but without influences" );
+
+    if ( failures > 0 )
+        return -1;
+
+    std::cout << "All RequiredObjectData tests passed" << std::endl;
+    return 0;
+}
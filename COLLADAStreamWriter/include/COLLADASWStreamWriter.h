@@ -33,7 +33,8 @@ namespace COLLADABU
 
 namespace Common
 {
-	class FWriteBufferFlusher;
+	class IBufferFlusher;
+	class MemoryBufferFlusher;
 	class CharacterBuffer;
 }
 
@@ -99,7 +100,11 @@ namespace COLLADASW
 		typedef std::deque<OpenTag> OpenTagStack;
 
     private:
-		Common::FWriteBufferFlusher* mBufferFlusher;
+		Common::IBufferFlusher* mBufferFlusher;
+
+		/** The flusher of a detached stream writer, i.e. the same object as mBufferFlusher.
+		Null, if the stream writer writes to a file.*/
+		Common::MemoryBufferFlusher* mMemoryBufferFlusher;
 
 		Common::CharacterBuffer* mCharacterBuffer;
 
@@ -110,12 +115,17 @@ namespace COLLADASW
 
         size_t mLevel;
 
+        /** The level the stream writer started with. Always 0, except for detached stream writers.*/
+        size_t mBaseLevel;
+
         size_t mIndent;
 
 		static const int FWRITEBUFFERSIZE;
 
 		static const int CHARACTERBUFFERSIZE;
 
+		static const int DETACHEDCHARACTERBUFFERSIZE;
+
         static const String mWhiteSpaceString;
 
         friend class TagCloser;
@@ -133,6 +143,24 @@ namespace COLLADASW
         /** Closes all open tags and closes the stream*/
         ~StreamWriter();
 
+		/** Creates a stream writer that does not write to the file of this stream writer but into memory.
+		A detached stream writer uses its own buffers only. Therefore several detached stream writers can
+		be filled concurrently by different threads, e.g. one for each library, while this stream writer is not used.
+		The level of the elements written to the detached stream writer starts at the current level of this stream 
+		writer. Its contents are written to this stream writer by appendDetachedWriter(). 
+		The caller takes the ownership of the returned stream writer.*/
+		StreamWriter* createDetachedWriter() const;
+
+		/** Closes all open tags of @a detachedWriter and writes its contents at the current position into this stream 
+		writer. The contents of @a detachedWriter are discarded afterwards, i.e. it can be reused.
+		@a detachedWriter must have been created by createDetachedWriter() of this stream writer and the current level 
+		of this stream writer must be the same as it was when @a detachedWriter was created.
+		Call this method for all detached stream writers in the order their contents should appear in the document.*/
+		void appendDetachedWriter( StreamWriter& detachedWriter );
+
+		/** Returns true, if this stream writer has been created by createDetachedWriter().*/
+		bool isDetached() const { return mMemoryBufferFlusher != 0; }
+
         /** Writes the document start, including the opening @a \<COLLADASW\> element.
         This member must be called, before any other member function can be called.*/
         void startDocument();
@@ -318,6 +346,13 @@ namespace COLLADASW
 		COLLADAVersion getCOLLADAVersion() const { return mCOLLADAVersion; } 
 
     private:
+		/** Creates a detached stream writer with the settings of @a parentWriter.*/
+		StreamWriter ( const StreamWriter& parentWriter, Common::MemoryBufferFlusher* memoryBufferFlusher );
+
+        /** Disable default copy ctor. */
+		StreamWriter( const StreamWriter& pre );
+        /** Disable default assignment operator. */
+		const StreamWriter& operator= ( const StreamWriter& pre );
 
 		/** Closes all elements opened since the element with index @a elementIndex has been open, 
 		including the element itself. */
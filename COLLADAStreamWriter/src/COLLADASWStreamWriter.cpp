@@ -17,6 +17,7 @@
 
 #include "CommonCharacterBuffer.h"
 #include "CommonFWriteBufferFlusher.h"
+#include "CommonMemoryBufferFlusher.h"
 
 #include <string>
 #include <fstream>
@@ -62,13 +63,16 @@ namespace COLLADASW
 
 	const int StreamWriter::FWRITEBUFFERSIZE = 1024*64;
 	const int StreamWriter::CHARACTERBUFFERSIZE = 1024*64*64;
+	const int StreamWriter::DETACHEDCHARACTERBUFFERSIZE = 1024*64;
 
 
     //---------------------------------------------------------------
     StreamWriter::StreamWriter ( const NativeString & fileName, bool doublePrecision /*= false*/, COLLADAVersion cOLLADAVersion /*= COLLADA_1_4_1*/ )
             : mBufferFlusher( new Common::FWriteBufferFlusher(fileName.c_str(), FWRITEBUFFERSIZE))
+			, mMemoryBufferFlusher( 0 )
 			, mCharacterBuffer( new Common::CharacterBuffer(CHARACTERBUFFERSIZE, mBufferFlusher) )
 			, mLevel ( 0 )
+			, mBaseLevel ( 0 )
             , mIndent ( 2 )
             , mDoublePrecision (doublePrecision)
 			, mCOLLADAVersion(cOLLADAVersion)
@@ -89,6 +93,50 @@ namespace COLLADASW
 		delete mBufferFlusher;
     }
 
+    //---------------------------------------------------------------
+    StreamWriter::StreamWriter ( const StreamWriter& parentWriter, Common::MemoryBufferFlusher* memoryBufferFlusher )
+            : mBufferFlusher( memoryBufferFlusher )
+			, mMemoryBufferFlusher( memoryBufferFlusher )
+			, mCharacterBuffer( new Common::CharacterBuffer(DETACHEDCHARACTERBUFFERSIZE, mBufferFlusher) )
+			, mLevel ( parentWriter.mLevel )
+			, mBaseLevel ( parentWriter.mLevel )
+            , mIndent ( parentWriter.mIndent )
+            , mDoublePrecision ( parentWriter.mDoublePrecision )
+			, mCOLLADAVersion( parentWriter.mCOLLADAVersion )
+			, mNextElementIndex(0)
+    {
+    }
+
+    //---------------------------------------------------------------
+    StreamWriter* StreamWriter::createDetachedWriter() const
+    {
+		return new StreamWriter( *this, new Common::MemoryBufferFlusher() );
+    }
+
+    //---------------------------------------------------------------
+    void StreamWriter::appendDetachedWriter( StreamWriter& detachedWriter )
+    {
+		COLLADABU_ASSERT ( detachedWriter.isDetached() );
+		COLLADABU_ASSERT ( &detachedWriter != this );
+		COLLADABU_ASSERT ( detachedWriter.mBaseLevel == mLevel );
+
+		detachedWriter.endDocument();
+		detachedWriter.mCharacterBuffer->flushBuffer();
+
+		Common::MemoryBufferFlusher* detachedFlusher = detachedWriter.mMemoryBufferFlusher;
+		if ( detachedFlusher->getDataSize() == 0 )
+		{
+			return;
+		}
+
+		// the detached contents are elements of the current element
+		prepareToAddContents();
+		mCharacterBuffer->copyToBuffer( detachedFlusher->getData(), detachedFlusher->getDataSize() );
+
+		detachedFlusher->clear();
+		detachedWriter.mNextElementIndex = 0;
+    }
+
     //---------------------------------------------------------------
     void StreamWriter::startDocument()
     {
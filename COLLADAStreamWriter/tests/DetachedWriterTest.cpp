@@ -0,0 +1,132 @@
+#include "COLLADASWStreamWriter.h"
+#include "COLLADABUNativeString.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstdio>
+
+
+// Fills two detached stream writers in reverse order, splices them into a document and checks, that the
+// document is byte by byte the same as the one written directly.
+
+namespace
+{
+    int failures = 0;
+
+    void check( bool condition, const char* description )
+    {
+        if ( !condition )
+        {
+            std::cerr << "FAILED: " << description << std::endl;
+            ++failures;
+        }
+    }
+
+    // the stream writer keeps pointers to the names of the open elements
+    const COLLADASW::String LIBRARY_GEOMETRIES = "library_geometries";
+    const COLLADASW::String GEOMETRY = "geometry";
+    const COLLADASW::String FLOAT_ARRAY = "float_array";
+    const COLLADASW::String EXTRA = "extra";
+
+    /** Writes a geometry element with id @a id and some values. Leaves the geometry element open, as
+    appendDetachedWriter() closes it.*/
+    void writeGeometry( COLLADASW::StreamWriter& streamWriter, const COLLADASW::String& id, int first )
+    {
+        streamWriter.openElement( GEOMETRY );
+        streamWriter.appendAttribute( "id", id );
+        streamWriter.openElement( FLOAT_ARRAY );
+        streamWriter.appendAttribute( "count", 3 );
+        streamWriter.appendValues( first, first + 1 );
+        streamWriter.appendValues( first + 2 );
+        streamWriter.closeElement();
+        streamWriter.openElement( EXTRA );
+    }
+
+    std::string readFile( const char* fileName )
+    {
+        std::ifstream file( fileName, std::ios::binary );
+        std::ostringstream contents;
+        contents << file.rdbuf();
+        return contents.str();
+    }
+
+    void writeDirect( const char* fileName )
+    {
+        COLLADASW::NativeString nativeFileName( fileName );
+        COLLADASW::StreamWriter streamWriter( nativeFileName );
+        streamWriter.startDocument();
+        streamWriter.openElement( LIBRARY_GEOMETRIES );
+        writeGeometry( streamWriter, "first", 1 );
+        streamWriter.closeElement();
+        streamWriter.closeElement();
+        writeGeometry( streamWriter, "second", 4 );
+        streamWriter.closeElement();
+        streamWriter.closeElement();
+        streamWriter.closeElement();
+        streamWriter.endDocument();
+    }
+
+    void writeSpliced( const char* fileName )
+    {
+        COLLADASW::NativeString nativeFileName( fileName );
+        COLLADASW::StreamWriter streamWriter( nativeFileName );
+        streamWriter.startDocument();
+        streamWriter.openElement( LIBRARY_GEOMETRIES );
+
+        COLLADASW::StreamWriter* firstWriter = streamWriter.createDetachedWriter();
+        COLLADASW::StreamWriter* secondWriter = streamWriter.createDetachedWriter();
+        check( firstWriter->isDetached() && secondWriter->isDetached(), "the created stream writers are detached" );
+        check( !streamWriter.isDetached(), "the stream writer of the file is not detached" );
+
+        // the order the detached writers are filled in must not matter
+        writeGeometry( *secondWriter, "second", 4 );
+        writeGeometry( *firstWriter, "first", 1 );
+
+        streamWriter.appendDetachedWriter( *firstWriter );
+        streamWriter.appendDetachedWriter( *secondWriter );
+
+        // appending an emptied detached writer again does not write anything
+        streamWriter.appendDetachedWriter( *firstWriter );
+
+        delete firstWriter;
+        delete secondWriter;
+
+        streamWriter.closeElement();
+        streamWriter.endDocument();
+    }
+}
+
+
+int main()
+{
+    const char* directFileName = "DetachedWriterTestDirect.dae";
+    const char* splicedFileName = "DetachedWriterTestSpliced.dae";
+
+    writeDirect( directFileName );
+    writeSpliced( splicedFileName );
+
+    std::string direct = readFile( directFileName );
+    std::string spliced = readFile( splicedFileName );
+
+    check( !direct.empty(), "the document is written" );
+    check( spliced == direct, "the spliced document is the same as the directly written one" );
+
+    std::string::size_type firstPosition = spliced.find( "\"first\"" );
+    std::string::size_type secondPosition = spliced.find( "\"second\"" );
+    check( firstPosition != std::string::npos && secondPosition != std::string::npos && firstPosition < secondPosition,
+        "the detached writers are spliced in the order they are appended" );
+
+    if ( failures > 0 )
+    {
+        std::cerr << "direct:" << std::endl << direct << std::endl << "spliced:" << std::endl << spliced << std::endl;
+        return -1;
+    }
+
+    std::remove( directFileName );
+    std::remove( splicedFileName );
+
+    std::cout << "All DetachedWriter tests passed" << std::endl;
+    return 0;
+}
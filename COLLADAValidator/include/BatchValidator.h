@@ -0,0 +1,107 @@
+#ifndef ___BATCHVALIDATOR_H__
+#define ___BATCHVALIDATOR_H__
+
+#include "COLLADASaxFWLPrerequisites.h"
+
+#include <string>
+#include <vector>
+#include <iosfwd>
+
+namespace COLLADASaxFWL
+{
+	class LoadSession;
+}
+
+class ValidationErrorHandler;
+class Writer;
+
+/** Validates many documents, in parallel if compiled with OpenMP. Each thread validates its documents one
+after the other with its own load session, error handler and writer. The loader of the session is reused
+for all documents of the thread.*/
+class BatchValidator
+{
+public:
+	enum Status
+	{
+		STATUS_NOT_VALIDATED,
+		STATUS_VALID,
+		STATUS_INVALID,
+		STATUS_FILE_NOT_FOUND
+	};
+
+	/** The result of the validation of one document.*/
+	struct Result
+	{
+		Result() : status(STATUS_NOT_VALIDATED), version(COLLADASaxFWL::COLLADA_UNKNOWN), time(0) {}
+
+		std::string fileName;
+		Status status;
+		COLLADASaxFWL::COLLADAVersion version;
+		/** The time spent validating the document in seconds.*/
+		double time;
+	};
+
+	typedef std::vector<Result> ResultList;
+
+private:
+	/** The documents to validate, in the order they have been added.*/
+	ResultList mResults;
+
+	/** The number of threads used by validate(). 0 means the OpenMP default.*/
+	int mThreadCount;
+
+	/** The time validate() took in seconds.*/
+	double mTime;
+
+public:
+	BatchValidator();
+	virtual ~BatchValidator();
+
+	/** Adds @a fileName to the documents to validate.*/
+	void addFile( const std::string& fileName );
+
+	/** Adds all files with the extension .dae in @a directory and its sub directories.
+	@return False, if @a directory could not be opened.*/
+	bool addDirectory( const std::string& directory );
+
+	/** Adds the files listed in @a listFileName, one per line. Empty lines are ignored.
+	@return False, if @a listFileName could not be opened.*/
+	bool addFileList( const std::string& listFileName );
+
+	/** Returns true, if @a path is a directory.*/
+	static bool isDirectory( const std::string& path );
+
+	/** Sets the number of threads used by validate(). 0 means the OpenMP default.*/
+	void setThreadCount( int threadCount ) { mThreadCount = threadCount; }
+
+	/** Validates all added documents. The status, the time and the errors of each document are printed
+	to @a stream as soon as it has been validated. The documents are printed in the order they have been
+	validated, which is not the order they have been added, if validated in parallel.*/
+	void validate( std::ostream& stream );
+
+	/** Prints the number of valid, invalid and missing documents to @a stream.*/
+	void printSummary( std::ostream& stream ) const;
+
+	/** Returns the exit code of the validator: -1 if a document is invalid, -2 if a document could not
+	be found and 0 otherwise.*/
+	int getExitCode() const;
+
+	/** The results of all added documents, in the order they have been added.*/
+	const ResultList& getResults() const { return mResults; }
+
+private:
+	/** Disable default copy ctor. */
+	BatchValidator( const BatchValidator& pre );
+	/** Disable default assignment operator. */
+	const BatchValidator& operator= ( const BatchValidator& pre );
+
+	/** Validates the document of @a result with @a session. The errors are handled by @a errorHandler,
+	the error handler of the loader of @a session.*/
+	static void validate( Result& result, COLLADASaxFWL::LoadSession& session, ValidationErrorHandler& errorHandler, Writer& writer );
+
+	/** Returns the number of results with @a status.*/
+	size_t getCount( Status status ) const;
+
+};
+
+#endif // ___BATCHVALIDATOR_H__
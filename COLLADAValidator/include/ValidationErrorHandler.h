@@ -3,6 +3,8 @@
 
 #include "COLLADASaxFWLIErrorHandler.h"
 
+#include <iostream>
+
 class ValidationErrorHandler : public	COLLADASaxFWL::IErrorHandler
 {
 private:
@@ -10,8 +12,11 @@ private:
 	bool mHasHandledSaxFWLError;
 	bool mFileNotFound;
 
+	/** The stream the errors are printed to.*/
+	std::ostream& mStream;
+
 public:
-	ValidationErrorHandler();
+	ValidationErrorHandler( std::ostream& stream = std::cout );
 	virtual ~ValidationErrorHandler();
 
 	bool virtual handleError(const COLLADASaxFWL::IError* error);
@@ -22,6 +27,9 @@ public:
 
 	bool getFileNotFound()const {return mFileNotFound; }
 
+	/** Forgets the errors handled so far, to validate the next document.*/
+	void reset();
+
 private:
 	/** Disable default copy ctor. */
 	ValidationErrorHandler( const ValidationErrorHandler& pre );
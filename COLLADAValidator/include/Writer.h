@@ -32,6 +32,11 @@ public:
 	/** This method is called after the last write* method. No other methods will be called after this.*/
 	virtual void finish(){}
 
+	/** The validator needs the animation curves and skin controller data only, that are checked by
+	COLLADAFW::validate() while they are loaded. The loader does not store the mesh data. This does
+	not influence the schema validation.*/
+	virtual int getRequiredObjectData() const { return ANIMATION_CURVE_DATA | CONTROLLER_DATA; }
+
 	/** When this method is called, the writer must write the global document asset.
 	@return The writer should return true, if writing succeeded, false otherwise.*/
 	virtual bool writeGlobalAsset ( const COLLADAFW::FileInfo* asset )
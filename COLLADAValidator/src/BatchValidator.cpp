@@ -0,0 +1,281 @@
+#include "BatchValidator.h"
+#include "ValidationErrorHandler.h"
+#include "Writer.h"
+
+#include "COLLADASaxFWLLoader.h"
+#include "COLLADASaxFWLLoadSession.h"
+#include "COLLADASaxFWLLoaderStatistics.h"
+
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+#ifdef WIN32
+#	include <windows.h>
+#else
+#	include <dirent.h>
+#	include <sys/stat.h>
+#endif
+
+#ifdef _OPENMP
+#	include <omp.h>
+#endif
+
+#if defined(XMLPARSER_LIBXML)
+#	include "GeneratedSaxParserLibxmlSaxParser.h"
+#endif
+
+
+namespace
+{
+	const char* getVersionName( COLLADASaxFWL::COLLADAVersion version )
+	{
+		switch ( version )
+		{
+		case COLLADASaxFWL::COLLADA_14:
+			return "1.4.1";
+		case COLLADASaxFWL::COLLADA_15:
+			return "1.5.0";
+		default:
+			return "unknown";
+		}
+	}
+
+	const char* getStatusName( BatchValidator::Status status )
+	{
+		switch ( status )
+		{
+		case BatchValidator::STATUS_VALID:
+			return "valid";
+		case BatchValidator::STATUS_INVALID:
+			return "invalid";
+		case BatchValidator::STATUS_FILE_NOT_FOUND:
+			return "not found";
+		default:
+			return "not validated";
+		}
+	}
+
+	/** Returns true, if @a fileName ends with ".dae", ignoring the case.*/
+	bool hasDaeExtension( const std::string& fileName )
+	{
+		const char extension[] = ".dae";
+		const size_t extensionLength = sizeof(extension) - 1;
+		if ( fileName.length() < extensionLength )
+			return false;
+		for ( size_t i = 0; i < extensionLength; ++i )
+		{
+			char c = fileName[fileName.length() - extensionLength + i];
+			if ( c >= 'A' && c <= 'Z' )
+				c = c - 'A' + 'a';
+			if ( c != extension[i] )
+				return false;
+		}
+		return true;
+	}
+}
+
+//--------------------------------------------------------------------
+BatchValidator::BatchValidator()
+	: mThreadCount(0)
+	, mTime(0)
+{
+}
+
+//--------------------------------------------------------------------
+BatchValidator::~BatchValidator()
+{
+}
+
+//--------------------------------------------------------------------
+void BatchValidator::addFile( const std::string& fileName )
+{
+	Result result;
+	result.fileName = fileName;
+	mResults.push_back(result);
+}
+
+//--------------------------------------------------------------------
+bool BatchValidator::addDirectory( const std::string& directory )
+{
+	std::vector<std::string> subDirectories;
+	std::vector<std::string> fileNames;
+
+#ifdef WIN32
+	WIN32_FIND_DATAA findData;
+	HANDLE findHandle = FindFirstFileA( (directory + "\\*").c_str(), &findData );
+	if ( findHandle == INVALID_HANDLE_VALUE )
+		return false;
+	do
+	{
+		std::string name = findData.cFileName;
+		if ( name == "." || name == ".." )
+			continue;
+		if ( (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0 )
+			subDirectories.push_back( directory + "\\" + name );
+		else if ( hasDaeExtension( name ) )
+			fileNames.push_back( directory + "\\" + name );
+	}
+	while ( FindNextFileA( findHandle, &findData ) );
+	FindClose( findHandle );
+#else
+	DIR* dir = opendir( directory.c_str() );
+	if ( !dir )
+		return false;
+	struct dirent* entry = 0;
+	while ( (entry = readdir( dir )) != 0 )
+	{
+		std::string name = entry->d_name;
+		if ( name == "." || name == ".." )
+			continue;
+		std::string path = directory + "/" + name;
+		if ( isDirectory( path ) )
+			subDirectories.push_back( path );
+		else if ( hasDaeExtension( name ) )
+			fileNames.push_back( path );
+	}
+	closedir( dir );
+#endif
+
+	// sort the entries, to get the same order on each run and each platform
+	std::sort( fileNames.begin(), fileNames.end() );
+	std::sort( subDirectories.begin(), subDirectories.end() );
+
+	for ( size_t i = 0, count = fileNames.size(); i < count; ++i )
+		addFile( fileNames[i] );
+
+	bool success = true;
+	for ( size_t i = 0, count = subDirectories.size(); i < count; ++i )
+		success = addDirectory( subDirectories[i] ) && success;
+	return success;
+}
+
+//--------------------------------------------------------------------
+bool BatchValidator::addFileList( const std::string& listFileName )
+{
+	std::ifstream listFile( listFileName.c_str() );
+	if ( !listFile )
+		return false;
+
+	std::string line;
+	while ( std::getline( listFile, line ) )
+	{
+		// remove carriage returns of lists written on windows
+		if ( !line.empty() && line[line.length() - 1] == '\r' )
+			line.erase( line.length() - 1 );
+		if ( !line.empty() )
+			addFile( line );
+	}
+	return true;
+}
+
+//--------------------------------------------------------------------
+bool BatchValidator::isDirectory( const std::string& path )
+{
+#ifdef WIN32
+	DWORD attributes = GetFileAttributesA( path.c_str() );
+	return (attributes != INVALID_FILE_ATTRIBUTES) && ((attributes & FILE_ATTRIBUTE_DIRECTORY) != 0);
+#else
+	struct stat status;
+	return (stat( path.c_str(), &status ) == 0) && S_ISDIR( status.st_mode );
+#endif
+}
+
+//--------------------------------------------------------------------
+void BatchValidator::validate( std::ostream& stream )
+{
+	double startTime = COLLADASaxFWL::LoaderStatistics::getTime();
+
+	// each thread validates its documents with one load session. The results are written by one thread
+	// at a time.
+	int fileCount = (int)mResults.size();
+#ifdef _OPENMP
+	int threadCount = mThreadCount > 0 ? mThreadCount : omp_get_max_threads();
+#endif
+#if defined(XMLPARSER_LIBXML)
+	// libxml initializes its global state lazily, which is not thread safe. It must not be released by the
+	// parsers of one thread, while the others still parse. main() releases it.
+	xmlInitParser();
+	GeneratedSaxParser::LibxmlSaxParser::setCleanupParserOnDestruction( false );
+#endif
+#pragma omp parallel num_threads(threadCount)
+	{
+		std::ostringstream messages;
+		ValidationErrorHandler errorHandler( messages );
+		COLLADASaxFWL::Loader loader( &errorHandler );
+		COLLADASaxFWL::LoadSession session( loader );
+		Writer writer;
+
+#pragma omp for schedule(dynamic)
+		for ( int i = 0; i < fileCount; ++i )
+		{
+			Result& result = mResults[i];
+			messages.str( "" );
+			errorHandler.reset();
+			validate( result, session, errorHandler, writer );
+
+#pragma omp critical
+			{
+				stream << messages.str();
+				stream << std::left << std::setw(10) << getStatusName( result.status )
+					   << std::right << std::fixed << std::setprecision(3) << std::setw(9) << result.time << " s  "
+					   << std::left << std::setw(8) << getVersionName( result.version )
+					   << "\"" << result.fileName << "\"" << std::endl;
+			}
+		}
+	}
+
+	mTime = COLLADASaxFWL::LoaderStatistics::getTime() - startTime;
+}
+
+//--------------------------------------------------------------------
+void BatchValidator::validate( Result& result, COLLADASaxFWL::LoadSession& session, ValidationErrorHandler& errorHandler, Writer& writer )
+{
+	double startTime = COLLADASaxFWL::LoaderStatistics::getTime();
+
+	session.loadDocument( result.fileName, &writer );
+
+	result.time = COLLADASaxFWL::LoaderStatistics::getTime() - startTime;
+	if ( errorHandler.getFileNotFound() )
+	{
+		result.status = STATUS_FILE_NOT_FOUND;
+		return;
+	}
+
+	result.version = session.getLoader().getCOLLADAVersion();
+	result.status = errorHandler.hasHandledSaxParserError() ? STATUS_INVALID : STATUS_VALID;
+}
+
+//--------------------------------------------------------------------
+void BatchValidator::printSummary( std::ostream& stream ) const
+{
+	stream << "Validated " << mResults.size() << " documents in "
+		   << std::fixed << std::setprecision(3) << mTime << " s: "
+		   << getCount( STATUS_VALID ) << " valid, "
+		   << getCount( STATUS_INVALID ) << " invalid, "
+		   << getCount( STATUS_FILE_NOT_FOUND ) << " not found." << std::endl;
+}
+
+//--------------------------------------------------------------------
+int BatchValidator::getExitCode() const
+{
+	if ( getCount( STATUS_INVALID ) > 0 )
+		return -1;
+	if ( getCount( STATUS_FILE_NOT_FOUND ) > 0 )
+		return -2;
+	return 0;
+}
+
+//--------------------------------------------------------------------
+size_t BatchValidator::getCount( Status status ) const
+{
+	size_t count = 0;
+	for ( size_t i = 0, resultCount = mResults.size(); i < resultCount; ++i )
+	{
+		if ( mResults[i].status == status )
+			count++;
+	}
+	return count;
+}
@@ -10,10 +10,11 @@
 #include <string.h>
 
 //--------------------------------------------------------------------
-ValidationErrorHandler::ValidationErrorHandler()
+ValidationErrorHandler::ValidationErrorHandler( std::ostream& stream )
 	: mHasHandledSaxParserError(false)
 	, mHasHandledSaxFWLError(false)
 	, mFileNotFound(false)
+	, mStream(stream)
 {
 }
 
@@ -22,6 +23,14 @@ ValidationErrorHandler::~ValidationErrorHandler()
 {
 }
 
+//--------------------------------------------------------------------
+void ValidationErrorHandler::reset()
+{
+	mHasHandledSaxParserError = false;
+	mHasHandledSaxFWLError = false;
+	mFileNotFound = false;
+}
+
 //--------------------------------------------------------------------
 bool ValidationErrorHandler::handleError( const COLLADASaxFWL::IError* error )
 {
@@ -53,13 +62,13 @@ bool ValidationErrorHandler::handleError( const COLLADASaxFWL::IError* error )
 			mFileNotFound = true;
 		}
 
-		std::cout << "Schema validation error: " << parserError.getErrorMessage() << std::endl;
+		mStream << "Schema validation error: " << parserError.getErrorMessage() << std::endl;
 		mHasHandledSaxParserError = true;
 	}
 	else if ( error->getErrorClass() == COLLADASaxFWL::IError::ERROR_SAXFWL )
 	{
 		COLLADASaxFWL::SaxFWLError* saxFWLError = (COLLADASaxFWL::SaxFWLError*) error;
-		std::cout << "Sax FWL Error: " << saxFWLError->getErrorMessage() << std::endl;
+		mStream << "Sax FWL Error: " << saxFWLError->getErrorMessage() << std::endl;
 		mHasHandledSaxFWLError = true;
 	}
 	return false;
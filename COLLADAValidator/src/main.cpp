@@ -2,8 +2,10 @@
 
 #include <iostream>
 #include <string>
+#include <stdlib.h>
 
 #include "ValidationErrorHandler.h"
+#include "BatchValidator.h"
 
 #include "COLLADASaxFWLLoader.h"
 
@@ -11,6 +13,10 @@
 
 #include "COLLADAFWRoot.h"
 
+#if defined(XMLPARSER_LIBXML)
+#	include <libxml/parser.h>
+#endif
+
 #ifdef WIN32
 #   if defined(XMLPARSER_LIBXML)
         const char* programName = "COLLADAValidator_LibXML.exe";
@@ -42,47 +48,108 @@ void printHelpText()
 {
 	std::cout << "Version 1.1.3" << std::endl;
 	std::cout << "Usage: " << programName << " <filename>." << std::endl;
+	std::cout << "       " << programName << " [-threads <count>] [-list <listfile>] <filename|directory>..." << std::endl;
+	std::cout << "Validates all files, all .dae files in the directories and all files listed in the list" << std::endl;
+	std::cout << "files, one per line, in parallel and prints the status and the time of each file." << std::endl;
 }
 
-
-int main(int argc, char* argv[]) 
+/** Validates all files, directories and list files passed in @a argv, in parallel.*/
+int validateBatch(int argc, char* argv[])
 {
-	if ( argc > 1 ) 
+	BatchValidator batchValidator;
+	for ( int i = 1; i < argc; ++i )
 	{
-		ValidationErrorHandler errorHandler;
-
-		parse( argv[1], errorHandler);
-
-		if ( errorHandler.getFileNotFound() )
+		std::string argument = argv[i];
+		if ( argument == "-threads" || argument == "-list" )
 		{
-			printHelpText();
-			return -2;
-		} 
-		
-		if ( errorHandler.hasHandledSaxParserError() )
+			if ( i + 1 >= argc )
+			{
+				std::cout << "Missing value of option \"" << argument << "\"." << std::endl;
+				printHelpText();
+				return -1;
+			}
+			if ( argument == "-threads" )
+			{
+				batchValidator.setThreadCount( atoi(argv[++i]) );
+			}
+			else if ( !batchValidator.addFileList( argv[++i] ) )
+			{
+				std::cout << "Could not open list file \"" << argv[i] << "\"." << std::endl;
+				return -2;
+			}
+		}
+		else if ( BatchValidator::isDirectory( argument ) )
 		{
-			return -1;
+			if ( !batchValidator.addDirectory( argument ) )
+				std::cout << "Could not read all of directory \"" << argument << "\"." << std::endl;
 		}
 		else
 		{
-			std::cout << "\"" << argv[1]<< "\" is valid against the COLLADA ";
-			switch ( version )
-			{
-			case COLLADASaxFWL::COLLADA_14:
-				std::cout << "1.4.1";
-				break;
-			case COLLADASaxFWL::COLLADA_15:
-				std::cout << "1.5.0";
-				break;
-			}
-			std::cout << " schema." << std::endl;
-			return 0;
+			batchValidator.addFile( argument );
 		}
 	}
-	else
+
+	batchValidator.validate( std::cout );
+	batchValidator.printSummary( std::cout );
+	return batchValidator.getExitCode();
+}
+
+/** Validates the single file @a fileName.*/
+int validateFile(char* fileName)
+{
+	ValidationErrorHandler errorHandler;
+
+	parse( fileName, errorHandler);
+
+	if ( errorHandler.getFileNotFound() )
 	{
 		printHelpText();
+		return -2;
+	} 
+	
+	if ( errorHandler.hasHandledSaxParserError() )
+	{
+		return -1;
+	}
+	else
+	{
+		std::cout << "\"" << fileName<< "\" is valid against the COLLADA ";
+		switch ( version )
+		{
+		case COLLADASaxFWL::COLLADA_14:
+			std::cout << "1.4.1";
+			break;
+		case COLLADASaxFWL::COLLADA_15:
+			std::cout << "1.5.0";
+			break;
+		}
+		std::cout << " schema." << std::endl;
 		return 0;
 	}
+}
+
+
+int main(int argc, char* argv[]) 
+{
+	int exitCode = 0;
+
+	// a single file is validated as always, everything else in batch mode
+	if ( argc > 2 || ( argc == 2 && (argv[1][0] == '-' || BatchValidator::isDirectory( argv[1] )) ) )
+	{
+		exitCode = validateBatch( argc, argv );
+	}
+	else if ( argc > 1 ) 
+	{
+		exitCode = validateFile( argv[1] );
+	}
+	else
+	{
+		printHelpText();
+	}
 
-}
\ No newline at end of file
+#if defined(XMLPARSER_LIBXML)
+	// frees the global state of libxml, once all documents are validated
+	xmlCleanupParser();
+#endif
+	return exitCode;
+}
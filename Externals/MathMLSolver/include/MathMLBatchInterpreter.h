@@ -0,0 +1,143 @@
+/******************************************************************************
+Copyright (c) 2007 netAllied GmbH, Tettnang
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+******************************************************************************/
+
+#ifndef __MATHML_BATCH_INTERPRETER_H__
+#define __MATHML_BATCH_INTERPRETER_H__
+
+#include "MathMLSolverPrerequisites.h"
+
+#include "MathMLASTConstantExpression.h"
+#include "MathMLSymbolTable.h"
+#include "MathMLProgram.h"
+
+#include <vector>
+
+
+namespace MathML
+{
+    /** Forward Declaration. */
+    class ErrorHandler;
+
+    /** Evaluates a Program compiled by the Compiler for many samples of variable values at once,
+    e.g. to sweep a formula over a range of joint values.
+    Variables either have one value for all samples or an array with one value per sample, all
+    of the same type. The samples are evaluated in blocks of BLOCK_SIZE. Each instruction is applied
+    to all samples of a block in one loop over contiguous arrays, which the compiler vectorizes.
+    If enabled and compiled with OpenMP, the blocks are evaluated in parallel.
+    The result of each sample is identical to the one of the Interpreter. Blocks, in which the
+    samples do not share a common type, e.g. due to an integer division by zero, are evaluated
+    sample by sample with the Interpreter. The errors of the functions called for such a block are
+    only reported by the Interpreter, i.e. once per sample like for all other blocks.
+    The program must not be changed while used by an interpreter.
+    */
+    class _MATHML_SOLVER_EXPORT BatchInterpreter
+    {
+    public:
+        /** The number of samples evaluated together. */
+        static const size_t BLOCK_SIZE = 256;
+
+    private:
+        /** The value of a variable slot. */
+        struct Variable
+        {
+            /** The type, and the value used for all samples, if values is 0. */
+            Program::Value value;
+            /** The value of each sample or 0. */
+            const double* values;
+        };
+
+        /** List of variables. */
+        typedef std::vector< Variable > VariableList;
+
+        /** Evaluates the blocks of samples. Defined in the implementation. */
+        class BlockEvaluator;
+
+        /** The program to evaluate. */
+        const Program& mProgram;
+
+        /** Error handler passed to the functions. */
+        ErrorHandler* mErrorHandler;
+
+        /** The value of each variable slot. */
+        VariableList mVariables;
+
+        /** If true, the blocks are evaluated in parallel, if compiled with OpenMP. */
+        bool mParallel;
+
+    public:
+        /** Creates an interpreter for @a program. All variables are initialized to the double
+        value 0 for all samples.
+        */
+        BatchInterpreter( const Program& program, ErrorHandler* errorHandler );
+
+        /** D-tor. */
+        virtual ~BatchInterpreter();
+
+        /** Sets the variable in @a slot to a double value for all samples. */
+        void setVariable( size_t slot, double value );
+
+        /** Sets the variable in @a slot to a long value for all samples. */
+        void setVariable( size_t slot, long value );
+
+        /** Sets the variable in @a slot to a bool value for all samples. */
+        void setVariable( size_t slot, bool value );
+
+        /** Sets the variable in @a slot to one value of @a type per sample. The array must hold
+        the values of all samples passed to evaluate() and stay valid until then. Long and bool
+        values are passed like Program::Value::value.
+        */
+        void setVariableValues( size_t slot, const double* values, AST::ConstantExpression::Type type = AST::ConstantExpression::SCALAR_DOUBLE );
+
+        /** Sets all variables to the values of the variables with the same name in @a symbolTable,
+        like Interpreter::setVariables().
+        */
+        void setVariables( const SymbolTable& symbolTable );
+
+        /** If true, the blocks are evaluated in parallel, if compiled with OpenMP. */
+        bool getParallel() const { return mParallel; }
+
+        /** If true, the blocks are evaluated in parallel, if compiled with OpenMP. The functions
+        called by the program must then be thread safe.
+        */
+        void setParallel( bool parallel ) { mParallel = parallel; }
+
+        /** Evaluates the program for @a sampleCount samples.
+        @param values Receives the value of each sample, as Program::Value::value.
+        @param types If not 0, receives the type of each sample.
+        */
+        void evaluate( size_t sampleCount, double* values, AST::ConstantExpression::Type* types = 0 ) const;
+
+    private:
+        /** Disable default copy ctor. */
+        BatchInterpreter( const BatchInterpreter& pre );
+
+        /** Disable default assignment operator. */
+        const BatchInterpreter& operator=( const BatchInterpreter& pre );
+
+    };
+
+} //namespace MathML
+
+#endif //__MATHML_BATCH_INTERPRETER_H__
@@ -0,0 +1,157 @@
+/******************************************************************************
+Copyright (c) 2007 netAllied GmbH, Tettnang
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+******************************************************************************/
+
+#ifndef __MATHML_COMPILER_H__
+#define __MATHML_COMPILER_H__
+
+#include "MathMLSolverPrerequisites.h"
+
+#include "MathMLASTNode.h"
+#include "MathMLASTArithmeticExpression.h"
+#include "MathMLASTLogicExpression.h"
+#include "MathMLASTBinaryComparisionExpression.h"
+#include "MathMLASTConstantExpression.h"
+#include "MathMLASTUnaryArithmeticExpression.h"
+#include "MathMLASTFragmentExpression.h"
+#include "MathMLASTVariableExpression.h"
+#include "MathMLASTFunctionExpression.h"
+#include "MathMLASTVisitor.h"
+#include "MathMLSymbolTable.h"
+#include "MathMLProgram.h"
+#include "MathMLError.h"
+
+#include <map>
+
+
+namespace MathML
+{
+    /** Forward Declaration. */
+    class ErrorHandler;
+
+    /** Expression node visitor for compiling an expression into a Program, that can be
+    evaluated repeatedly by an Interpreter without walking the tree.
+    The instructions evaluate the operands in the same order and with the same operations as the
+    EvaluatorVisitor, such that the result is identical, except for the cases listed at Interpreter.
+    Errors the EvaluatorVisitor reports on each evaluation, e.g. undeclared fragments, are reported
+    once by the compiler, with the same error code.
+    Functions are looked up in the SymbolTable at compile time. Variables that are not parameters
+    of an enclosing fragment become variable slots of the program, whose values are set on the
+    Interpreter. Fragment parameters are compiled inline at each use.
+    */
+    class _MATHML_SOLVER_EXPORT Compiler : public AST::IVisitor
+    {
+
+    private:
+        /** Maps fragment parameter names to their expressions. */
+        typedef std::map< String, const AST::INode* > ParameterMap;
+
+        /** Maximum nesting of fragment parameters compiled inline. Exceeded by recursive parameters. */
+        static const size_t MAX_PARAMETER_DEPTH;
+
+        /** Symbol table holding the functions. */
+        const SymbolTable& mSymbolTable;
+
+        /** Error handler. */
+        ErrorHandler* mErrorHandler;
+
+        /** The program being compiled. */
+        Program* mProgram;
+
+        /** The parameters of the enclosing fragments. */
+        ParameterMap mParameters;
+
+        /** The number of values currently on the stack. */
+        size_t mStackDepth;
+
+        /** The number of fragment parameters currently compiled inline. */
+        size_t mParameterDepth;
+
+        /** False, if an error occurred during compilation. */
+        bool mSucceeded;
+
+    public:
+        /** Creates a new compiler that resolves functions in @a symbolTable. */
+        Compiler( const SymbolTable& symbolTable, ErrorHandler* errorHandler );
+
+        /** D-tor. */
+        virtual ~Compiler();
+
+        /** Compiles @a node and appends the instructions to @a program, which should be empty
+        or contain predefined variables only.
+        @return False, if the expression could not be compiled.
+        */
+        bool compile( const AST::INode* node, Program& program );
+
+        // see IVisitor::visit(const ArithmeticExpression&)
+        virtual void visit( const AST::ArithmeticExpression* const node );
+
+        // see IVisitor::visit(const BinaryComparisionExpression&)
+        virtual void visit( const AST::BinaryComparisonExpression* const node );
+
+        // see IVisitor::visit(const FragmentExpression&)
+        virtual void visit( const AST::FragmentExpression* const node );
+
+        // see IVisitor::visit(const LogicExpression&)
+        virtual void visit( const AST::LogicExpression* const node );
+
+        // see IVisitor::visit(const ConstantExpression&)
+        virtual void visit( const AST::ConstantExpression* const node );
+
+        // see IVisitor::visit(const FunctionExpression&)
+        virtual void visit( const AST::FunctionExpression* const node );
+
+        // see IVisitor::visit(const UnaryArithmeticExpression&)
+        virtual void visit( const AST::UnaryExpression* const node );
+
+        // see IVisitor::visit(const VariableExpression&)
+        virtual void visit( const AST::VariableExpression* const node );
+
+    private:
+        /** Disable default copy ctor. */
+        Compiler( const Compiler& pre );
+
+        /** Disable default assignment operator. */
+        const Compiler& operator=( const Compiler& pre );
+
+        /** Compiles the operands of an arithmetic or logic expression, combining them with @a opCode. */
+        void compileOperands( const AST::NodeList& operands, Program::OpCode opCode );
+
+        /** Appends a PUSH instruction. */
+        void push();
+
+        /** Appends @a opCode, which pops one value. */
+        void pop( Program::OpCode opCode );
+
+        /** Appends an instruction loading a constant with @a type and @a value. */
+        void loadConstant( AST::ConstantExpression::Type type, double value );
+
+        /** Passes an error with @a errorCode to the error handler. */
+        void handleError( const String& message, Error::ErrorCode errorCode = Error::ERR_INVALIDPARAMS );
+
+    };
+
+} //namespace MathML
+
+#endif //__MATHML_COMPILER_H__
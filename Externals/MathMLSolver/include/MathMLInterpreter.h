@@ -0,0 +1,138 @@
+/******************************************************************************
+Copyright (c) 2007 netAllied GmbH, Tettnang
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+******************************************************************************/
+
+#ifndef __MATHML_INTERPRETER_H__
+#define __MATHML_INTERPRETER_H__
+
+#include "MathMLSolverPrerequisites.h"
+
+#include "MathMLASTConstantExpression.h"
+#include "MathMLSymbolTable.h"
+#include "MathMLProgram.h"
+
+#include <vector>
+
+
+namespace MathML
+{
+    /** Forward Declaration. */
+    class ErrorHandler;
+
+    /** Evaluates a Program compiled by the Compiler.
+    All memory required for the evaluation is allocated on construction, such that evaluate()
+    does not allocate, unless a called function does. The result is identical to the one of the
+    EvaluatorVisitor for the compiled expression and the same variable values, except for:
+    - An integer division by zero results in the double value 0, like a division of two
+    ConstantExpressions with an error handler. The EvaluatorVisitor, whose values have no error
+    handler, divides anyway and raises SIGFPE. No error is reported.
+    - A parameter defined recursively fails to compile, where the EvaluatorVisitor recurses until
+    the stack overflows.
+    The program must not be changed while used by an interpreter. To evaluate the same program
+    in multiple threads, use one interpreter per thread.
+    */
+    class _MATHML_SOLVER_EXPORT Interpreter
+    {
+
+    private:
+        /** The program to evaluate. */
+        const Program& mProgram;
+
+        /** Error handler passed to the functions. */
+        ErrorHandler* mErrorHandler;
+
+        /** The value of each variable slot. */
+        Program::ValueList mVariables;
+
+        /** The stack of saved branch values. */
+        Program::ValueList mStack;
+
+        /** The arguments of each function call. */
+        std::vector< ScalarList > mArguments;
+
+        /** Points to the argument with each argument number. */
+        std::vector< AST::ConstantExpression* > mArgumentPointers;
+
+        /** Receives the result of the called functions. */
+        AST::ConstantExpression mFunctionResult;
+
+        /** The value of the last evaluation. */
+        Program::Value mValue;
+
+    public:
+        /** Creates an interpreter for @a program. All variables are initialized to the double
+        value 0, which is the value of variables the EvaluatorVisitor could not find.
+        */
+        Interpreter( const Program& program, ErrorHandler* errorHandler );
+
+        /** D-tor. */
+        virtual ~Interpreter();
+
+        /** Sets the variable in @a slot to a double value. */
+        void setVariable( size_t slot, double value );
+
+        /** Sets the variable in @a slot to a long value. */
+        void setVariable( size_t slot, long value );
+
+        /** Sets the variable in @a slot to a bool value. */
+        void setVariable( size_t slot, bool value );
+
+        /** Sets the variable in @a slot to @a value. */
+        void setVariable( size_t slot, const Program::Value& value ) { mVariables[ slot ] = value; }
+
+        /** Sets all variables to the values of the variables with the same name in @a symbolTable.
+        Variables that are not constants are evaluated with the EvaluatorVisitor. Variables that
+        are not found are set to 0 and reported to the error handler, like by the EvaluatorVisitor.
+        */
+        void setVariables( const SymbolTable& symbolTable );
+
+        /** Returns the value of the variable in @a slot. */
+        const Program::Value& getVariable( size_t slot ) const { return mVariables[ slot ]; }
+
+        /** Evaluates the program.
+        @return The value of the expression.
+        */
+        const Program::Value& evaluate();
+
+        /** Returns the value of the last evaluation. */
+        const Program::Value& getValue() const { return mValue; }
+
+        /** Copies the value of the last evaluation to @a result. */
+        void getValue( AST::ConstantExpression& result ) const;
+
+        /** Copies @a value to @a constant. */
+        static void setConstant( AST::ConstantExpression& constant, const Program::Value& value );
+
+    private:
+        /** Disable default copy ctor. */
+        Interpreter( const Interpreter& pre );
+
+        /** Disable default assignment operator. */
+        const Interpreter& operator=( const Interpreter& pre );
+
+    };
+
+} //namespace MathML
+
+#endif //__MATHML_INTERPRETER_H__
@@ -0,0 +1,200 @@
+/******************************************************************************
+Copyright (c) 2007 netAllied GmbH, Tettnang
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+******************************************************************************/
+
+#ifndef __MATHML_PROGRAM_H__
+#define __MATHML_PROGRAM_H__
+
+#include "MathMLSolverPrerequisites.h"
+
+#include "MathMLASTConstantExpression.h"
+#include "MathMLSymbolTable.h"
+
+#include <map>
+#include <vector>
+
+
+namespace MathML
+{
+    /** A MathML expression compiled to a flat list of instructions by the Compiler and evaluated
+    by the Interpreter.
+    The instructions operate on one accumulator, which holds the value of the last evaluated
+    sub expression, exactly like the branch value of the EvaluatorVisitor, and on a stack of
+    saved accumulator values. Binary operations combine the top of the stack with the accumulator.
+    Variables are resolved to slots, functions to function pointers at compile time.
+    */
+    class _MATHML_SOLVER_EXPORT Program
+    {
+    public:
+        /** The operations of the instructions. */
+        enum OpCode
+        {
+            LOAD_CONSTANT,      //!< Assigns constant number operand to the accumulator.
+            LOAD_VARIABLE,      //!< Assigns variable slot operand to the accumulator.
+            PUSH,               //!< Pushes the accumulator on the stack.
+            ADD,                //!< Pops the left operand and combines it with the accumulator.
+            SUB,
+            MUL,
+            DIV,
+            EQ,
+            NEQ,
+            LTE,
+            GTE,
+            LT,
+            GT,
+            AND,
+            OR,
+            XOR,
+            NEGATE,             //!< Negates the accumulator.
+            NOT,                //!< Logically inverts the accumulator.
+            STORE_ARGUMENT,     //!< Stores the accumulator as function argument number operand.
+            CALL,               //!< Calls function call number operand with its stored arguments.
+            END_FRAGMENT        //!< Pops the accumulator value from before a fragment and assigns the fragment value.
+        };
+
+        /** One instruction. */
+        struct Instruction
+        {
+            /** The operation. */
+            OpCode opCode;
+            /** The constant, variable slot, argument or function call the operation refers to. */
+            size_t operand;
+        };
+
+        /** A scalar value with the type and value semantics of AST::ConstantExpression. */
+        struct Value
+        {
+            /** The type of the value. */
+            AST::ConstantExpression::Type type;
+            /** The value, as returned by AST::ConstantExpression::getDoubleValue(). */
+            double value;
+        };
+
+        /** A call of a function of the SymbolTable. */
+        struct FunctionCall
+        {
+            /** The function to call. */
+            SymbolTable::FunctionPtr function;
+            /** The number of the first argument of the call. */
+            size_t firstArgument;
+            /** The number of arguments passed to the function. */
+            size_t argumentCount;
+        };
+
+        /** List of instructions. */
+        typedef std::vector< Instruction > InstructionList;
+
+        /** List of values. */
+        typedef std::vector< Value > ValueList;
+
+        /** List of function calls. */
+        typedef std::vector< FunctionCall > FunctionCallList;
+
+        /** List of variable names. */
+        typedef std::vector< String > VariableNameList;
+
+        /** Returned by findVariable(), if the program has no variable with the given name. */
+        static const size_t INVALID_VARIABLE;
+
+    private:
+        /** Maps variable names to their slots. */
+        typedef std::map< String, size_t > VariableSlotMap;
+
+        /** The instructions in execution order. */
+        InstructionList mInstructions;
+
+        /** The constants referenced by LOAD_CONSTANT. */
+        ValueList mConstants;
+
+        /** The name of the variable of each slot. */
+        VariableNameList mVariableNames;
+
+        /** Maps variable names to their slots. */
+        VariableSlotMap mVariableSlots;
+
+        /** The function calls referenced by CALL. */
+        FunctionCallList mFunctionCalls;
+
+        /** The number of arguments of all function calls. */
+        size_t mArgumentCount;
+
+        /** The maximum number of values on the stack. */
+        size_t mStackSize;
+
+    public:
+        /** C-tor. */
+        Program();
+
+        /** D-tor. */
+        virtual ~Program();
+
+        /** Removes all instructions, constants, variables and function calls. */
+        void clear();
+
+        /** Returns the slot of the variable with @a name. Adds a new slot, if the variable
+        does not exist yet. Variables can be added before compilation to define the slot order.
+        */
+        size_t addVariable( const String& name );
+
+        /** Returns the slot of the variable with @a name or INVALID_VARIABLE. */
+        size_t findVariable( const String& name ) const;
+
+        /** Returns the number of variable slots. */
+        size_t getVariableCount() const { return mVariableNames.size(); }
+
+        /** Returns the name of the variable in @a slot. */
+        const String& getVariableName( size_t slot ) const { return mVariableNames[ slot ]; }
+
+        /** Appends an instruction. */
+        void addInstruction( OpCode opCode, size_t operand = 0 );
+
+        /** Adds a constant and returns its number. */
+        size_t addConstant( const Value& constant );
+
+        /** Adds a function call with @a argumentCount arguments and returns its number. */
+        size_t addFunctionCall( SymbolTable::FunctionPtr function, size_t argumentCount );
+
+        /** Returns the instructions. */
+        const InstructionList& getInstructions() const { return mInstructions; }
+
+        /** Returns the constants. */
+        const ValueList& getConstants() const { return mConstants; }
+
+        /** Returns the function calls. */
+        const FunctionCallList& getFunctionCalls() const { return mFunctionCalls; }
+
+        /** Returns the number of arguments of all function calls. */
+        size_t getArgumentCount() const { return mArgumentCount; }
+
+        /** Returns the maximum number of values on the stack. */
+        size_t getStackSize() const { return mStackSize; }
+
+        /** Sets the maximum number of values on the stack. */
+        void setStackSize( size_t stackSize ) { mStackSize = stackSize; }
+
+    };
+
+} //namespace MathML
+
+#endif //__MATHML_PROGRAM_H__
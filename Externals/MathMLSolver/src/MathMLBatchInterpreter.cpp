@@ -0,0 +1,653 @@
+#include "MathMLSolverStableHeaders.h"
+#include "MathMLBatchInterpreter.h"
+#include "MathMLInterpreter.h"
+#include "MathMLError.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace MathML
+{
+    namespace
+    {
+        /** Shortcuts for the scalar types. */
+        const AST::ConstantExpression::Type SCALAR_INVALID = AST::ConstantExpression::SCALAR_INVALID;
+        const AST::ConstantExpression::Type SCALAR_BOOL = AST::ConstantExpression::SCALAR_BOOL;
+        const AST::ConstantExpression::Type SCALAR_LONG = AST::ConstantExpression::SCALAR_LONG;
+        const AST::ConstantExpression::Type SCALAR_DOUBLE = AST::ConstantExpression::SCALAR_DOUBLE;
+
+        /** The operations applied to the samples, with the semantics of the Interpreter. */
+        struct Add { double operator()( double lhs, double rhs ) const { return lhs + rhs; } };
+        struct Sub { double operator()( double lhs, double rhs ) const { return lhs - rhs; } };
+        struct Mul { double operator()( double lhs, double rhs ) const { return lhs * rhs; } };
+        struct Div { double operator()( double lhs, double rhs ) const { return lhs / rhs; } };
+
+        struct LongAdd { double operator()( double lhs, double rhs ) const { return static_cast<double>( static_cast<long>( lhs ) + static_cast<long>( rhs ) ); } };
+        struct LongSub { double operator()( double lhs, double rhs ) const { return static_cast<double>( static_cast<long>( lhs ) - static_cast<long>( rhs ) ); } };
+        struct LongMul { double operator()( double lhs, double rhs ) const { return static_cast<double>( static_cast<long>( lhs ) * static_cast<long>( rhs ) ); } };
+        struct LongDiv { double operator()( double lhs, double rhs ) const { return static_cast<double>( static_cast<long>( lhs ) / static_cast<long>( rhs ) ); } };
+
+        struct Equal { double operator()( double lhs, double rhs ) const { return lhs == rhs ? 1. : 0.; } };
+        struct NotEqual { double operator()( double lhs, double rhs ) const { return lhs != rhs ? 1. : 0.; } };
+        struct Less { double operator()( double lhs, double rhs ) const { return lhs < rhs ? 1. : 0.; } };
+        struct LessEqual { double operator()( double lhs, double rhs ) const { return lhs <= rhs ? 1. : 0.; } };
+        struct Greater { double operator()( double lhs, double rhs ) const { return lhs > rhs ? 1. : 0.; } };
+        struct GreaterEqual { double operator()( double lhs, double rhs ) const { return lhs >= rhs ? 1. : 0.; } };
+
+        struct LongEqual { double operator()( double lhs, double rhs ) const { return static_cast<long>( lhs ) == static_cast<long>( rhs ) ? 1. : 0.; } };
+        struct LongNotEqual { double operator()( double lhs, double rhs ) const { return static_cast<long>( lhs ) != static_cast<long>( rhs ) ? 1. : 0.; } };
+
+        struct And { double operator()( double lhs, double rhs ) const { return ( lhs != 0. ) && ( rhs != 0. ) ? 1. : 0.; } };
+        struct Or { double operator()( double lhs, double rhs ) const { return ( lhs != 0. ) || ( rhs != 0. ) ? 1. : 0.; } };
+        struct Xor { double operator()( double lhs, double rhs ) const { return ( lhs != 0. ) != ( rhs != 0. ) ? 1. : 0.; } };
+
+        /** Combines the @a count values of @a lhs with those of @a result. A loop without
+        branches over contiguous arrays, which the compiler vectorizes. */
+        template < class Operation >
+        inline void apply( const double* lhs, double* result, size_t count, Operation operation )
+        {
+            for ( size_t i = 0; i < count; ++i )
+            {
+                result[ i ] = operation( lhs[ i ], result[ i ] );
+            }
+        }
+
+        /** Sets the @a count values of @a result to @a value. */
+        inline void fill( double* result, size_t count, double value )
+        {
+            std::fill( result, result + count, value );
+        }
+
+        /** Assigns @a source or @a sourceValues, if not 0, to @a type and @a result like the
+        Interpreter, which keeps the values of @a result if @a source is invalid. */
+        inline void assign( const Program::Value& source, const double* sourceValues, AST::ConstantExpression::Type& type, double* result, size_t count )
+        {
+            type = source.type;
+
+            if ( source.type == SCALAR_INVALID )
+                return;
+
+            if ( sourceValues )
+                memcpy( result, sourceValues, count * sizeof( double ) );
+            else
+                fill( result, count, source.value );
+        }
+
+        /** Applies the arithmetic @a opCode to @a lhs and @a result.
+        @return False, if an integer division by zero changes the type of some samples. */
+        inline bool arithmeticOperation( AST::ConstantExpression::Type lhsType, const double* lhs, AST::ConstantExpression::Type& type, double* result, size_t count, Program::OpCode opCode )
+        {
+            if ( lhsType == SCALAR_INVALID || type == SCALAR_INVALID )
+            {
+                type = SCALAR_DOUBLE;
+                fill( result, count, 0. );
+            }
+            else if ( ( lhsType == SCALAR_LONG && type != SCALAR_DOUBLE ) || ( lhsType == SCALAR_BOOL && type == SCALAR_LONG ) )
+            {
+                type = SCALAR_LONG;
+
+                switch ( opCode )
+                {
+
+                case Program::ADD:
+                    apply( lhs, result, count, LongAdd() );
+                    break;
+
+                case Program::SUB:
+                    apply( lhs, result, count, LongSub() );
+                    break;
+
+                case Program::MUL:
+                    apply( lhs, result, count, LongMul() );
+                    break;
+
+                default:
+                    for ( size_t i = 0; i < count; ++i )
+                    {
+                        if ( static_cast<long>( result[ i ] ) == 0 )
+                            return false;
+                    }
+
+                    apply( lhs, result, count, LongDiv() );
+                    break;
+                }
+            }
+            else
+            {
+                type = SCALAR_DOUBLE;
+
+                switch ( opCode )
+                {
+
+                case Program::ADD:
+                    apply( lhs, result, count, Add() );
+                    break;
+
+                case Program::SUB:
+                    apply( lhs, result, count, Sub() );
+                    break;
+
+                case Program::MUL:
+                    apply( lhs, result, count, Mul() );
+                    break;
+
+                default:
+                    apply( lhs, result, count, Div() );
+                    break;
+                }
+            }
+
+            return true;
+        }
+
+        /** Applies the comparison @a opCode to @a lhs and @a result. */
+        inline void relationalOperation( AST::ConstantExpression::Type lhsType, const double* lhs, AST::ConstantExpression::Type& type, double* result, size_t count, Program::OpCode opCode )
+        {
+            if ( lhsType == SCALAR_INVALID || type == SCALAR_INVALID )
+            {
+                type = SCALAR_DOUBLE;
+                fill( result, count, 0. );
+            }
+            else if ( lhsType == SCALAR_BOOL || type == SCALAR_BOOL )
+            {
+                // only == and != of two bools are valid
+                if ( lhsType != type || ( opCode != Program::EQ && opCode != Program::NEQ ) )
+                {
+                    type = SCALAR_DOUBLE;
+                    fill( result, count, 0. );
+                }
+                else if ( opCode == Program::EQ )
+                {
+                    apply( lhs, result, count, LongEqual() );
+                }
+                else
+                {
+                    apply( lhs, result, count, LongNotEqual() );
+                }
+            }
+            else
+            {
+                type = SCALAR_BOOL;
+
+                switch ( opCode )
+                {
+
+                case Program::EQ:
+                    apply( lhs, result, count, Equal() );
+                    break;
+
+                case Program::NEQ:
+                    apply( lhs, result, count, NotEqual() );
+                    break;
+
+                case Program::LT:
+                    apply( lhs, result, count, Less() );
+                    break;
+
+                case Program::LTE:
+                    apply( lhs, result, count, LessEqual() );
+                    break;
+
+                case Program::GT:
+                    apply( lhs, result, count, Greater() );
+                    break;
+
+                default:
+                    apply( lhs, result, count, GreaterEqual() );
+                    break;
+                }
+            }
+        }
+
+        /** Applies the logic @a opCode to @a lhs and @a result. */
+        inline void logicalOperation( const double* lhs, AST::ConstantExpression::Type& type, double* result, size_t count, Program::OpCode opCode )
+        {
+            type = SCALAR_BOOL;
+
+            switch ( opCode )
+            {
+
+            case Program::AND:
+                apply( lhs, result, count, And() );
+                break;
+
+            case Program::OR:
+                apply( lhs, result, count, Or() );
+                break;
+
+            default:
+                apply( lhs, result, count, Xor() );
+                break;
+            }
+        }
+
+        /** Negates @a result. */
+        inline void negate( AST::ConstantExpression::Type& type, double* result, size_t count )
+        {
+            if ( type == SCALAR_LONG )
+            {
+                for ( size_t i = 0; i < count; ++i )
+                    result[ i ] = static_cast<double>( -static_cast<long>( result[ i ] ) );
+            }
+            else if ( type == SCALAR_DOUBLE )
+            {
+                for ( size_t i = 0; i < count; ++i )
+                    result[ i ] = -result[ i ];
+            }
+            else
+            {
+                type = SCALAR_DOUBLE;
+                fill( result, count, 0. );
+            }
+        }
+
+        /** Collects the errors reported by the functions called for a block, which are only passed on
+        if the block is not evaluated again sample by sample. */
+        class DeferredErrorHandler : public ErrorHandler
+        {
+        private:
+            /** The errors reported since the last clear(). */
+            std::vector< Error > mErrors;
+
+        public:
+            virtual bool handleError( const Error* error )
+            {
+                mErrors.push_back( *error );
+                return true;
+            }
+
+            /** Passes the collected errors to @a errorHandler in the order they were reported. */
+            void forward( ErrorHandler* errorHandler ) const
+            {
+                for ( size_t i = 0; i < mErrors.size(); ++i )
+                    errorHandler->handleError( &mErrors[ i ] );
+            }
+
+            /** Removes the collected errors. */
+            void clear() { mErrors.clear(); }
+        };
+
+        /** Logically inverts @a result. */
+        inline void invert( AST::ConstantExpression::Type& type, double* result, size_t count )
+        {
+            if ( type == SCALAR_INVALID )
+            {
+                type = SCALAR_DOUBLE;
+                fill( result, count, 0. );
+            }
+            else if ( type == SCALAR_LONG )
+            {
+                for ( size_t i = 0; i < count; ++i )
+                    result[ i ] = static_cast<long>( result[ i ] ) == 0 ? 1. : 0.;
+            }
+            else
+            {
+                for ( size_t i = 0; i < count; ++i )
+                    result[ i ] = result[ i ] == 0. ? 1. : 0.;
+            }
+        }
+    }
+
+    /** Holds the memory to evaluate blocks of samples. Each thread uses its own evaluator. */
+    class BatchInterpreter::BlockEvaluator
+    {
+
+    private:
+        /** The interpreter this evaluator belongs to. */
+        const BatchInterpreter& mBatchInterpreter;
+
+        /** The program to evaluate. */
+        const Program& mProgram;
+
+        /** The values of the samples of the accumulator. */
+        std::vector< double > mValues;
+
+        /** The values of the samples of each stack entry, BLOCK_SIZE per entry. */
+        std::vector< double > mStackValues;
+
+        /** The type of each stack entry. */
+        std::vector< AST::ConstantExpression::Type > mStackTypes;
+
+        /** The values of the samples of each function argument, BLOCK_SIZE per argument. */
+        std::vector< double > mArgumentValues;
+
+        /** The type of each function argument. */
+        std::vector< AST::ConstantExpression::Type > mArgumentTypes;
+
+        /** The arguments passed to each function call. */
+        std::vector< ScalarList > mArguments;
+
+        /** Receives the result of the called functions. */
+        AST::ConstantExpression mFunctionResult;
+
+        /** Evaluates blocks whose samples do not share a common type. */
+        Interpreter mInterpreter;
+
+        /** Holds back the errors of the functions until the block evaluation succeeded. */
+        DeferredErrorHandler mDeferredErrors;
+
+    public:
+        /** Allocates the memory to evaluate the program of @a batchInterpreter. */
+        BlockEvaluator( const BatchInterpreter& batchInterpreter );
+
+        /** Evaluates @a sampleCount samples, at most BLOCK_SIZE, from @a firstSample on. */
+        void evaluate( size_t firstSample, size_t sampleCount, double* values, AST::ConstantExpression::Type* types );
+
+    private:
+        /** Disable default copy ctor. */
+        BlockEvaluator( const BlockEvaluator& pre );
+
+        /** Disable default assignment operator. */
+        const BlockEvaluator& operator=( const BlockEvaluator& pre );
+
+        /** Evaluates all samples together into mValues.
+        @param type Receives the type of all samples.
+        @return False, if the samples do not share a common type.
+        */
+        bool evaluateBlock( size_t firstSample, size_t sampleCount, AST::ConstantExpression::Type& type );
+
+        /** Evaluates the samples one by one with the Interpreter. */
+        void evaluateSamples( size_t firstSample, size_t sampleCount, double* values, AST::ConstantExpression::Type* types );
+
+        /** Calls function @a callNumber for each sample with the current accumulator @a type and @a result.
+        @return False, if the function results do not share a common type.
+        */
+        bool call( size_t callNumber, AST::ConstantExpression::Type& type, double* result, size_t sampleCount );
+
+    };
+
+    //----------------------------------------------------------------------------
+    BatchInterpreter::BlockEvaluator::BlockEvaluator( const BatchInterpreter& batchInterpreter )
+            : mBatchInterpreter( batchInterpreter )
+            , mProgram( batchInterpreter.mProgram )
+            , mValues( BLOCK_SIZE )
+            , mStackValues( batchInterpreter.mProgram.getStackSize() * BLOCK_SIZE )
+            , mStackTypes( batchInterpreter.mProgram.getStackSize() )
+            , mArgumentValues( batchInterpreter.mProgram.getArgumentCount() * BLOCK_SIZE )
+            , mArgumentTypes( batchInterpreter.mProgram.getArgumentCount() )
+            , mArguments( batchInterpreter.mProgram.getFunctionCalls().size() )
+            , mFunctionResult( 0.0 )
+            , mInterpreter( batchInterpreter.mProgram, batchInterpreter.mErrorHandler )
+    {
+        const Program::FunctionCallList& functionCalls = mProgram.getFunctionCalls();
+
+        for ( size_t i = 0; i < functionCalls.size(); ++i )
+        {
+            mArguments[ i ].resize( functionCalls[ i ].argumentCount );
+        }
+
+        const VariableList& variables = mBatchInterpreter.mVariables;
+
+        for ( size_t slot = 0; slot < variables.size(); ++slot )
+        {
+            mInterpreter.setVariable( slot, variables[ slot ].value );
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    void BatchInterpreter::BlockEvaluator::evaluate( size_t firstSample, size_t sampleCount, double* values, AST::ConstantExpression::Type* types )
+    {
+        AST::ConstantExpression::Type type;
+        mDeferredErrors.clear();
+
+        if ( !evaluateBlock( firstSample, sampleCount, type ) )
+        {
+            // the Interpreter calls the functions again and reports their errors
+            evaluateSamples( firstSample, sampleCount, values, types );
+            return;
+        }
+
+        if ( mBatchInterpreter.mErrorHandler )
+            mDeferredErrors.forward( mBatchInterpreter.mErrorHandler );
+
+        memcpy( values + firstSample, &mValues[ 0 ], sampleCount * sizeof( double ) );
+
+        if ( types )
+        {
+            std::fill( types + firstSample, types + firstSample + sampleCount, type );
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    bool BatchInterpreter::BlockEvaluator::evaluateBlock( size_t firstSample, size_t sampleCount, AST::ConstantExpression::Type& type )
+    {
+        const Program::InstructionList& instructions = mProgram.getInstructions();
+        const Program::ValueList& constants = mProgram.getConstants();
+        const VariableList& variables = mBatchInterpreter.mVariables;
+        double* value = &mValues[ 0 ];
+        size_t stackSize = 0;
+
+        // the initial branch value of the EvaluatorVisitor
+        type = SCALAR_DOUBLE;
+        fill( value, sampleCount, 0. );
+
+        for ( size_t i = 0, count = instructions.size(); i < count; ++i )
+        {
+            const Program::Instruction& instruction = instructions[ i ];
+
+            switch ( instruction.opCode )
+            {
+
+            case Program::LOAD_CONSTANT:
+                assign( constants[ instruction.operand ], 0, type, value, sampleCount );
+                break;
+
+            case Program::LOAD_VARIABLE:
+                {
+                    const Variable& variable = variables[ instruction.operand ];
+                    assign( variable.value, variable.values ? variable.values + firstSample : 0, type, value, sampleCount );
+                    break;
+                }
+
+            case Program::PUSH:
+                memcpy( &mStackValues[ stackSize * BLOCK_SIZE ], value, sampleCount * sizeof( double ) );
+                mStackTypes[ stackSize++ ] = type;
+                break;
+
+            case Program::ADD:
+            case Program::SUB:
+            case Program::MUL:
+            case Program::DIV:
+                --stackSize;
+                if ( !arithmeticOperation( mStackTypes[ stackSize ], &mStackValues[ stackSize * BLOCK_SIZE ], type, value, sampleCount, instruction.opCode ) )
+                    return false;
+                break;
+
+            case Program::EQ:
+            case Program::NEQ:
+            case Program::LTE:
+            case Program::GTE:
+            case Program::LT:
+            case Program::GT:
+                --stackSize;
+                relationalOperation( mStackTypes[ stackSize ], &mStackValues[ stackSize * BLOCK_SIZE ], type, value, sampleCount, instruction.opCode );
+                break;
+
+            case Program::AND:
+            case Program::OR:
+            case Program::XOR:
+                --stackSize;
+                logicalOperation( &mStackValues[ stackSize * BLOCK_SIZE ], type, value, sampleCount, instruction.opCode );
+                break;
+
+            case Program::NEGATE:
+                negate( type, value, sampleCount );
+                break;
+
+            case Program::NOT:
+                invert( type, value, sampleCount );
+                break;
+
+            case Program::STORE_ARGUMENT:
+                memcpy( &mArgumentValues[ instruction.operand * BLOCK_SIZE ], value, sampleCount * sizeof( double ) );
+                mArgumentTypes[ instruction.operand ] = type;
+                break;
+
+            case Program::CALL:
+                if ( !call( instruction.operand, type, value, sampleCount ) )
+                    return false;
+                break;
+
+            case Program::END_FRAGMENT:
+                --stackSize;
+                // an invalid fragment value keeps the values from before the fragment
+                if ( type == SCALAR_INVALID )
+                    memcpy( value, &mStackValues[ stackSize * BLOCK_SIZE ], sampleCount * sizeof( double ) );
+                break;
+            }
+        }
+
+        return true;
+    }
+
+    //----------------------------------------------------------------------------
+    bool BatchInterpreter::BlockEvaluator::call( size_t callNumber, AST::ConstantExpression::Type& type, double* result, size_t sampleCount )
+    {
+        const Program::FunctionCall& functionCall = mProgram.getFunctionCalls()[ callNumber ];
+        ScalarList& arguments = mArguments[ callNumber ];
+        AST::ConstantExpression::Type resultType = type;
+        Program::Value sampleValue;
+
+        for ( size_t sample = 0; sample < sampleCount; ++sample )
+        {
+            for ( size_t i = 0; i < functionCall.argumentCount; ++i )
+            {
+                size_t argument = functionCall.firstArgument + i;
+                sampleValue.type = mArgumentTypes[ argument ];
+                sampleValue.value = mArgumentValues[ argument * BLOCK_SIZE + sample ];
+                Interpreter::setConstant( arguments[ i ], sampleValue );
+            }
+
+            // the function receives the current branch value as result, like in the EvaluatorVisitor
+            sampleValue.type = type;
+            sampleValue.value = result[ sample ];
+            Interpreter::setConstant( mFunctionResult, sampleValue );
+            functionCall.function( mFunctionResult, arguments, mBatchInterpreter.mErrorHandler ? &mDeferredErrors : 0 );
+
+            if ( sample == 0 )
+                resultType = mFunctionResult.getType();
+            else if ( mFunctionResult.getType() != resultType )
+                return false;
+
+            result[ sample ] = mFunctionResult.getDoubleValue();
+        }
+
+        type = resultType;
+        return true;
+    }
+
+    //----------------------------------------------------------------------------
+    void BatchInterpreter::BlockEvaluator::evaluateSamples( size_t firstSample, size_t sampleCount, double* values, AST::ConstantExpression::Type* types )
+    {
+        const VariableList& variables = mBatchInterpreter.mVariables;
+
+        for ( size_t sample = firstSample; sample < firstSample + sampleCount; ++sample )
+        {
+            for ( size_t slot = 0; slot < variables.size(); ++slot )
+            {
+                const Variable& variable = variables[ slot ];
+
+                if ( variable.values )
+                {
+                    Program::Value sampleValue = variable.value;
+                    sampleValue.value = variable.values[ sample ];
+                    mInterpreter.setVariable( slot, sampleValue );
+                }
+            }
+
+            const Program::Value& value = mInterpreter.evaluate();
+            values[ sample ] = value.value;
+
+            if ( types )
+                types[ sample ] = value.type;
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    const size_t BatchInterpreter::BLOCK_SIZE;
+
+    //----------------------------------------------------------------------------
+    BatchInterpreter::BatchInterpreter( const Program& program, ErrorHandler* errorHandler )
+            : mProgram( program )
+            , mErrorHandler( errorHandler )
+            , mParallel( false )
+    {
+        Variable variable;
+        variable.value.type = SCALAR_DOUBLE;
+        variable.value.value = 0.;
+        variable.values = 0;
+        mVariables.resize( program.getVariableCount(), variable );
+    }
+
+    //----------------------------------------------------------------------------
+    BatchInterpreter::~BatchInterpreter()
+    {}
+
+    //----------------------------------------------------------------------------
+    void BatchInterpreter::setVariable( size_t slot, double value )
+    {
+        Variable& variable = mVariables[ slot ];
+        variable.value.type = SCALAR_DOUBLE;
+        variable.value.value = value;
+        variable.values = 0;
+    }
+
+    //----------------------------------------------------------------------------
+    void BatchInterpreter::setVariable( size_t slot, long value )
+    {
+        Variable& variable = mVariables[ slot ];
+        variable.value.type = SCALAR_LONG;
+        variable.value.value = static_cast<double>( value );
+        variable.values = 0;
+    }
+
+    //----------------------------------------------------------------------------
+    void BatchInterpreter::setVariable( size_t slot, bool value )
+    {
+        Variable& variable = mVariables[ slot ];
+        variable.value.type = SCALAR_BOOL;
+        variable.value.value = value ? 1. : 0.;
+        variable.values = 0;
+    }
+
+    //----------------------------------------------------------------------------
+    void BatchInterpreter::setVariableValues( size_t slot, const double* values, AST::ConstantExpression::Type type )
+    {
+        Variable& variable = mVariables[ slot ];
+        variable.value.type = type;
+        variable.value.value = 0.;
+        variable.values = values;
+    }
+
+    //----------------------------------------------------------------------------
+    void BatchInterpreter::setVariables( const SymbolTable& symbolTable )
+    {
+        Interpreter interpreter( mProgram, mErrorHandler );
+        interpreter.setVariables( symbolTable );
+
+        for ( size_t slot = 0; slot < mVariables.size(); ++slot )
+        {
+            mVariables[ slot ].value = interpreter.getVariable( slot );
+            mVariables[ slot ].values = 0;
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    void BatchInterpreter::evaluate( size_t sampleCount, double* values, AST::ConstantExpression::Type* types ) const
+    {
+        int blockCount = static_cast<int>( ( sampleCount + BLOCK_SIZE - 1 ) / BLOCK_SIZE );
+
+#pragma omp parallel if(mParallel && blockCount > 1)
+        {
+            BlockEvaluator blockEvaluator( *this );
+
+#pragma omp for schedule(dynamic)
+            for ( int block = 0; block < blockCount; ++block )
+            {
+                size_t firstSample = block * BLOCK_SIZE;
+                blockEvaluator.evaluate( firstSample, std::min( BLOCK_SIZE, sampleCount - firstSample ), values, types );
+            }
+        }
+    }
+
+} //namespace MathML
@@ -0,0 +1,320 @@
+#include "MathMLSolverStableHeaders.h"
+#include "MathMLCompiler.h"
+#include "MathMLError.h"
+
+namespace MathML
+{
+    const size_t Compiler::MAX_PARAMETER_DEPTH = 256;
+
+    //----------------------------------------------------------------------------
+    Compiler::Compiler( const SymbolTable& symbolTable, ErrorHandler* errorHandler )
+            : mSymbolTable( symbolTable )
+            , mErrorHandler( errorHandler )
+            , mProgram( 0 )
+            , mStackDepth( 0 )
+            , mParameterDepth( 0 )
+            , mSucceeded( true )
+    {}
+
+    //----------------------------------------------------------------------------
+    Compiler::~Compiler()
+    {}
+
+    //----------------------------------------------------------------------------
+    bool Compiler::compile( const AST::INode* node, Program& program )
+    {
+        mProgram = &program;
+        mParameters.clear();
+        mStackDepth = 0;
+        mParameterDepth = 0;
+        mSucceeded = true;
+
+        if ( node )
+        {
+            node->accept( this );
+        }
+
+        mProgram = 0;
+        return mSucceeded;
+    }
+
+    //----------------------------------------------------------------------------
+    void Compiler::push()
+    {
+        mProgram->addInstruction( Program::PUSH );
+        ++mStackDepth;
+
+        if ( mStackDepth > mProgram->getStackSize() )
+        {
+            mProgram->setStackSize( mStackDepth );
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    void Compiler::pop( Program::OpCode opCode )
+    {
+        mProgram->addInstruction( opCode );
+        --mStackDepth;
+    }
+
+    //----------------------------------------------------------------------------
+    void Compiler::loadConstant( AST::ConstantExpression::Type type, double value )
+    {
+        Program::Value constant;
+        constant.type = type;
+        constant.value = value;
+        mProgram->addInstruction( Program::LOAD_CONSTANT, mProgram->addConstant( constant ) );
+    }
+
+    //----------------------------------------------------------------------------
+    void Compiler::handleError( const String& message, Error::ErrorCode errorCode )
+    {
+        if ( mErrorHandler )
+        {
+            Error err( errorCode, message );
+            mErrorHandler->handleError( &err );
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    void Compiler::compileOperands( const AST::NodeList& operands, Program::OpCode opCode )
+    {
+        AST::NodeList::const_iterator it = operands.begin();
+
+        // the first operand is the temporary branch value
+        if ( it != operands.end() )
+        {
+            ( *it ) ->accept( this );
+            ++it;
+        }
+
+        // the other operands are combined with the previous branch value
+        for ( ; it != operands.end(); ++it )
+        {
+            push();
+            ( *it ) ->accept( this );
+            pop( opCode );
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    void Compiler::visit( const AST::ArithmeticExpression* const node )
+    {
+        switch ( node->getOperator() )
+        {
+
+        case AST::ArithmeticExpression::ADD:
+            compileOperands( node->getOperands(), Program::ADD );
+            break;
+
+        case AST::ArithmeticExpression::SUB:
+            compileOperands( node->getOperands(), Program::SUB );
+            break;
+
+        case AST::ArithmeticExpression::MUL:
+            compileOperands( node->getOperands(), Program::MUL );
+            break;
+
+        case AST::ArithmeticExpression::DIV:
+            compileOperands( node->getOperands(), Program::DIV );
+            break;
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    void Compiler::visit( const AST::BinaryComparisonExpression* const node )
+    {
+        Program::OpCode opCode = Program::EQ;
+
+        switch ( node->getOperator() )
+        {
+
+        case AST::BinaryComparisonExpression::EQ:
+            opCode = Program::EQ;
+            break;
+
+        case AST::BinaryComparisonExpression::NEQ:
+            opCode = Program::NEQ;
+            break;
+
+        case AST::BinaryComparisonExpression::LTE:
+            opCode = Program::LTE;
+            break;
+
+        case AST::BinaryComparisonExpression::GTE:
+            opCode = Program::GTE;
+            break;
+
+        case AST::BinaryComparisonExpression::LT:
+            opCode = Program::LT;
+            break;
+
+        case AST::BinaryComparisonExpression::GT:
+            opCode = Program::GT;
+            break;
+        }
+
+        node->getLeftOperand() ->accept( this );
+        push();
+        node->getRightOperand() ->accept( this );
+        pop( opCode );
+    }
+
+    //----------------------------------------------------------------------------
+    void Compiler::visit( const AST::FragmentExpression* const node )
+    {
+        AST::INode* fragment = node->getFragment();
+
+        if ( fragment == 0 )
+        {
+            handleError( "Symbol " + node->getName() + " not declared!", Error::ERR_ITEM_NOT_FOUND );
+            return ;
+        }
+
+        // the parameters are visible in the fragment only
+        ParameterMap enclosingParameters = mParameters;
+
+        const AST::FragmentExpression::ParameterMap& params = node->getParameterMap();
+        AST::FragmentExpression::ParameterMap::const_iterator it;
+
+        for ( it = params.begin(); it != params.end(); ++it )
+        {
+            mParameters[ it->first ] = it->second;
+        }
+
+        // the fragment is evaluated with a new branch value, that is assigned to the enclosing one
+        push();
+        loadConstant( AST::ConstantExpression::SCALAR_DOUBLE, 0.0 );
+        fragment->accept( this );
+        pop( Program::END_FRAGMENT );
+
+        mParameters.swap( enclosingParameters );
+    }
+
+    //----------------------------------------------------------------------------
+    void Compiler::visit( const AST::LogicExpression* const node )
+    {
+        switch ( node->getOperator() )
+        {
+
+        case AST::LogicExpression::AND:
+            compileOperands( node->getOperands(), Program::AND );
+            break;
+
+        case AST::LogicExpression::OR:
+            compileOperands( node->getOperands(), Program::OR );
+            break;
+
+        case AST::LogicExpression::XOR:
+            compileOperands( node->getOperands(), Program::XOR );
+            break;
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    void Compiler::visit( const AST::ConstantExpression* const node )
+    {
+        loadConstant( node->getType(), node->getDoubleValue() );
+    }
+
+    //----------------------------------------------------------------------------
+    void Compiler::visit( const AST::FunctionExpression* const node )
+    {
+        const AST::NodeList& params = node->getParameterList();
+        size_t paramCount = params.size();
+
+        // note: getFunction() calls the error handler of the symbol table
+        const SymbolTable::FunctionInfo* functionInfo = mSymbolTable.getFunction( node->getName() );
+
+        // functions with an invalid argument count are not called, like unknown functions
+        if ( functionInfo && functionInfo->argc < -1 )
+        {
+            handleError( "Unknown function " + node->getName() + "()" );
+            functionInfo = 0;
+        }
+
+        if ( functionInfo && ( functionInfo->argc >= 0 ) && ( static_cast<size_t>( functionInfo->argc ) != paramCount ) )
+        {
+            std::ostringstream oss;
+            oss << "Function " << node->getName() << "() takes exactly " << functionInfo->argc << " parameters.";
+            handleError( oss.str() );
+        }
+
+        size_t functionCall = functionInfo ? mProgram->addFunctionCall( functionInfo->func, paramCount ) : 0;
+        size_t firstArgument = functionInfo ? mProgram->getFunctionCalls()[ functionCall ].firstArgument : 0;
+
+        // the arguments are evaluated even if the function is unknown
+        for ( size_t i = 0; i < paramCount; ++i )
+        {
+            params[ i ] ->accept( this );
+
+            if ( functionInfo )
+            {
+                mProgram->addInstruction( Program::STORE_ARGUMENT, firstArgument + i );
+            }
+        }
+
+        if ( functionInfo )
+        {
+            mProgram->addInstruction( Program::CALL, functionCall );
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    void Compiler::visit( const AST::UnaryExpression* const node )
+    {
+        node->getOperand() ->accept( this );
+
+        switch ( node->getOperator() )
+        {
+
+        case AST::UnaryExpression::ADD:
+            //do nothing
+            break;
+
+        case AST::UnaryExpression::SUB:
+            mProgram->addInstruction( Program::NEGATE );
+            break;
+
+        case AST::UnaryExpression::NOT:
+            mProgram->addInstruction( Program::NOT );
+            break;
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    void Compiler::visit( const AST::VariableExpression* const node )
+    {
+        const String& name = node->getName();
+        ParameterMap::const_iterator it = mParameters.find( name );
+
+        if ( it == mParameters.end() )
+        {
+            // not a fragment parameter, the value is set on the interpreter
+            mProgram->addInstruction( Program::LOAD_VARIABLE, mProgram->addVariable( name ) );
+            return ;
+        }
+
+        const AST::INode* parameterNode = it->second;
+
+        if ( parameterNode == 0 )
+        {
+            // like a variable that could not be found
+            handleError( "variable '" + name + "' could not be found!" );
+            loadConstant( AST::ConstantExpression::SCALAR_DOUBLE, 0.0 );
+            return ;
+        }
+
+        if ( mParameterDepth >= MAX_PARAMETER_DEPTH )
+        {
+            handleError( "parameter '" + name + "' is defined recursively!" );
+            mSucceeded = false;
+            return ;
+        }
+
+        ++mParameterDepth;
+        parameterNode->accept( this );
+        --mParameterDepth;
+    }
+
+} //namespace MathML
@@ -0,0 +1,411 @@
+#include "MathMLSolverStableHeaders.h"
+#include "MathMLInterpreter.h"
+#include "MathMLEvaluatorVisitor.h"
+#include "MathMLError.h"
+
+namespace MathML
+{
+    namespace
+    {
+        /** Shortcuts for the scalar types. */
+        const AST::ConstantExpression::Type SCALAR_INVALID = AST::ConstantExpression::SCALAR_INVALID;
+        const AST::ConstantExpression::Type SCALAR_BOOL = AST::ConstantExpression::SCALAR_BOOL;
+        const AST::ConstantExpression::Type SCALAR_LONG = AST::ConstantExpression::SCALAR_LONG;
+        const AST::ConstantExpression::Type SCALAR_DOUBLE = AST::ConstantExpression::SCALAR_DOUBLE;
+
+        /** Sets @a result to @a type and @a value. */
+        inline void setValue( Program::Value& result, AST::ConstantExpression::Type type, double value )
+        {
+            result.type = type;
+            result.value = value;
+        }
+
+        /** Assigns @a value to @a result like ConstantExpression::operator=, which keeps the value
+        of @a result if @a value is invalid. */
+        inline void assign( Program::Value& result, const Program::Value& value )
+        {
+            result.type = value.type;
+
+            if ( value.type != SCALAR_INVALID )
+            {
+                result.value = value.value;
+            }
+        }
+
+        /** Applies the arithmetic @a opCode to @a lhs and @a result like ConstantExpression::arithmeticalBinaryOperation. */
+        inline void arithmeticOperation( const Program::Value& lhs, Program::Value& result, Program::OpCode opCode )
+        {
+            if ( lhs.type == SCALAR_INVALID || result.type == SCALAR_INVALID )
+            {
+                setValue( result, SCALAR_DOUBLE, 0. );
+            }
+            else if ( ( lhs.type == SCALAR_LONG && result.type != SCALAR_DOUBLE ) || ( lhs.type == SCALAR_BOOL && result.type == SCALAR_LONG ) )
+            {
+                long val1 = static_cast<long>( lhs.value );
+                long val2 = static_cast<long>( result.value );
+
+                switch ( opCode )
+                {
+
+                case Program::ADD:
+                    setValue( result, SCALAR_LONG, static_cast<double>( val1 + val2 ) );
+                    break;
+
+                case Program::SUB:
+                    setValue( result, SCALAR_LONG, static_cast<double>( val1 - val2 ) );
+                    break;
+
+                case Program::MUL:
+                    setValue( result, SCALAR_LONG, static_cast<double>( val1 * val2 ) );
+                    break;
+
+                default:
+                    // an integer division by zero results in 0, like with an error handler, see Interpreter
+                    if ( val2 == 0 )
+                        setValue( result, SCALAR_DOUBLE, 0. );
+                    else
+                        setValue( result, SCALAR_LONG, static_cast<double>( val1 / val2 ) );
+                    break;
+                }
+            }
+            else
+            {
+                double val1 = lhs.value;
+                double val2 = result.value;
+
+                switch ( opCode )
+                {
+
+                case Program::ADD:
+                    setValue( result, SCALAR_DOUBLE, val1 + val2 );
+                    break;
+
+                case Program::SUB:
+                    setValue( result, SCALAR_DOUBLE, val1 - val2 );
+                    break;
+
+                case Program::MUL:
+                    setValue( result, SCALAR_DOUBLE, val1 * val2 );
+                    break;
+
+                default:
+                    setValue( result, SCALAR_DOUBLE, val1 / val2 );
+                    break;
+                }
+            }
+        }
+
+        /** Applies the comparison @a opCode to @a lhs and @a result like ConstantExpression::relationalBinaryOperation. */
+        inline void relationalOperation( const Program::Value& lhs, Program::Value& result, Program::OpCode opCode )
+        {
+            if ( lhs.type == SCALAR_INVALID || result.type == SCALAR_INVALID )
+            {
+                setValue( result, SCALAR_DOUBLE, 0. );
+            }
+            else if ( lhs.type == SCALAR_BOOL || result.type == SCALAR_BOOL )
+            {
+                // only == and != of two bools are valid
+                if ( lhs.type != result.type )
+                    setValue( result, SCALAR_DOUBLE, 0. );
+                else if ( opCode == Program::EQ )
+                    setValue( result, SCALAR_BOOL, static_cast<long>( lhs.value ) == static_cast<long>( result.value ) ? 1. : 0. );
+                else if ( opCode == Program::NEQ )
+                    setValue( result, SCALAR_BOOL, static_cast<long>( lhs.value ) != static_cast<long>( result.value ) ? 1. : 0. );
+                else
+                    setValue( result, SCALAR_DOUBLE, 0. );
+            }
+            else
+            {
+                double val1 = lhs.value;
+                double val2 = result.value;
+                bool value = false;
+
+                switch ( opCode )
+                {
+
+                case Program::EQ:
+                    value = val1 == val2;
+                    break;
+
+                case Program::NEQ:
+                    value = val1 != val2;
+                    break;
+
+                case Program::LT:
+                    value = val1 < val2;
+                    break;
+
+                case Program::LTE:
+                    value = val1 <= val2;
+                    break;
+
+                case Program::GT:
+                    value = val1 > val2;
+                    break;
+
+                default:
+                    value = val1 >= val2;
+                    break;
+                }
+
+                setValue( result, SCALAR_BOOL, value ? 1. : 0. );
+            }
+        }
+
+        /** Applies the logic @a opCode to @a lhs and @a result like ConstantExpression::logicalBinaryOperation. */
+        inline void logicalOperation( const Program::Value& lhs, Program::Value& result, Program::OpCode opCode )
+        {
+            bool val1 = lhs.value != 0.;
+            bool val2 = result.value != 0.;
+            bool value = false;
+
+            switch ( opCode )
+            {
+
+            case Program::AND:
+                value = val1 && val2;
+                break;
+
+            case Program::OR:
+                value = val1 || val2;
+                break;
+
+            default:
+                value = val1 ^ val2;
+                break;
+            }
+
+            setValue( result, SCALAR_BOOL, value ? 1. : 0. );
+        }
+
+        /** Negates @a result like ConstantExpression::unaryOperation. */
+        inline void negate( Program::Value& result )
+        {
+            if ( result.type == SCALAR_LONG )
+                setValue( result, SCALAR_LONG, static_cast<double>( -static_cast<long>( result.value ) ) );
+            else if ( result.type == SCALAR_DOUBLE )
+                setValue( result, SCALAR_DOUBLE, -result.value );
+            else
+                setValue( result, SCALAR_DOUBLE, 0. );
+        }
+
+        /** Logically inverts @a result like ConstantExpression::unaryOperation. */
+        inline void invert( Program::Value& result )
+        {
+            if ( result.type == SCALAR_INVALID )
+                setValue( result, SCALAR_DOUBLE, 0. );
+            else if ( result.type == SCALAR_LONG )
+                setValue( result, SCALAR_LONG, static_cast<long>( result.value ) == 0 ? 1. : 0. );
+            else
+                setValue( result, result.type, result.value == 0. ? 1. : 0. );
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    Interpreter::Interpreter( const Program& program, ErrorHandler* errorHandler )
+            : mProgram( program )
+            , mErrorHandler( errorHandler )
+            , mStack( program.getStackSize() )
+            , mArguments( program.getFunctionCalls().size() )
+            , mFunctionResult( 0.0 )
+    {
+        setValue( mValue, SCALAR_DOUBLE, 0. );
+        mVariables.resize( program.getVariableCount(), mValue );
+
+        const Program::FunctionCallList& functionCalls = program.getFunctionCalls();
+        mArgumentPointers.resize( program.getArgumentCount() );
+
+        for ( size_t i = 0; i < functionCalls.size(); ++i )
+        {
+            const Program::FunctionCall& functionCall = functionCalls[ i ];
+            ScalarList& arguments = mArguments[ i ];
+            arguments.resize( functionCall.argumentCount );
+
+            for ( size_t j = 0; j < functionCall.argumentCount; ++j )
+            {
+                mArgumentPointers[ functionCall.firstArgument + j ] = &arguments[ j ];
+            }
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    Interpreter::~Interpreter()
+    {}
+
+    //----------------------------------------------------------------------------
+    void Interpreter::setVariable( size_t slot, double value )
+    {
+        setValue( mVariables[ slot ], SCALAR_DOUBLE, value );
+    }
+
+    //----------------------------------------------------------------------------
+    void Interpreter::setVariable( size_t slot, long value )
+    {
+        setValue( mVariables[ slot ], SCALAR_LONG, static_cast<double>( value ) );
+    }
+
+    //----------------------------------------------------------------------------
+    void Interpreter::setVariable( size_t slot, bool value )
+    {
+        setValue( mVariables[ slot ], SCALAR_BOOL, value ? 1. : 0. );
+    }
+
+    //----------------------------------------------------------------------------
+    void Interpreter::setVariables( const SymbolTable& symbolTable )
+    {
+        for ( size_t slot = 0; slot < mVariables.size(); ++slot )
+        {
+            Program::Value& variable = mVariables[ slot ];
+            AST::INode* variableNode = symbolTable.getVariable( mProgram.getVariableName( slot ) );
+
+            if ( variableNode == 0 )
+            {
+                // like the EvaluatorVisitor
+                if ( mErrorHandler )
+                {
+                    Error err( Error::ERR_INVALIDPARAMS, "variable '" + mProgram.getVariableName( slot ) + "' could not be found!" );
+                    mErrorHandler->handleError( &err );
+                }
+                setValue( variable, SCALAR_DOUBLE, 0. );
+            }
+            else if ( variableNode->getNodeType() == AST::INode::CONSTANT )
+            {
+                const AST::ConstantExpression* constant = static_cast<const AST::ConstantExpression*>( variableNode );
+                setValue( variable, constant->getType(), constant->getDoubleValue() );
+            }
+            else
+            {
+                SymbolTable scopeTable = symbolTable;
+                EvaluatorVisitor evaluator( scopeTable, mErrorHandler );
+                variableNode->accept( &evaluator );
+                const AST::ConstantExpression& value = evaluator.getValue();
+                setValue( variable, value.getType(), value.getDoubleValue() );
+            }
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    void Interpreter::setConstant( AST::ConstantExpression& constant, const Program::Value& value )
+    {
+        static const AST::ConstantExpression INVALID_CONSTANT;
+
+        switch ( value.type )
+        {
+
+        case SCALAR_BOOL:
+            constant.setValue( value.value != 0. );
+            break;
+
+        case SCALAR_LONG:
+            constant.setValue( static_cast<long>( value.value ) );
+            break;
+
+        case SCALAR_DOUBLE:
+            constant.setValue( value.value );
+            break;
+
+        default:
+            // the assignment keeps the value
+            constant.setValue( value.value );
+            constant = INVALID_CONSTANT;
+            break;
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    void Interpreter::getValue( AST::ConstantExpression& result ) const
+    {
+        setConstant( result, mValue );
+    }
+
+    //----------------------------------------------------------------------------
+    const Program::Value& Interpreter::evaluate()
+    {
+        const Program::InstructionList& instructions = mProgram.getInstructions();
+        const Program::Value* constants = mProgram.getConstants().empty() ? 0 : &mProgram.getConstants()[ 0 ];
+        const Program::Value* variables = mVariables.empty() ? 0 : &mVariables[ 0 ];
+        Program::Value* stack = mStack.empty() ? 0 : &mStack[ 0 ];
+        size_t stackSize = 0;
+
+        // the initial branch value of the EvaluatorVisitor
+        Program::Value value;
+        setValue( value, SCALAR_DOUBLE, 0. );
+
+        for ( size_t i = 0, count = instructions.size(); i < count; ++i )
+        {
+            const Program::Instruction& instruction = instructions[ i ];
+
+            switch ( instruction.opCode )
+            {
+
+            case Program::LOAD_CONSTANT:
+                assign( value, constants[ instruction.operand ] );
+                break;
+
+            case Program::LOAD_VARIABLE:
+                assign( value, variables[ instruction.operand ] );
+                break;
+
+            case Program::PUSH:
+                stack[ stackSize++ ] = value;
+                break;
+
+            case Program::ADD:
+            case Program::SUB:
+            case Program::MUL:
+            case Program::DIV:
+                arithmeticOperation( stack[ --stackSize ], value, instruction.opCode );
+                break;
+
+            case Program::EQ:
+            case Program::NEQ:
+            case Program::LTE:
+            case Program::GTE:
+            case Program::LT:
+            case Program::GT:
+                relationalOperation( stack[ --stackSize ], value, instruction.opCode );
+                break;
+
+            case Program::AND:
+            case Program::OR:
+            case Program::XOR:
+                logicalOperation( stack[ --stackSize ], value, instruction.opCode );
+                break;
+
+            case Program::NEGATE:
+                negate( value );
+                break;
+
+            case Program::NOT:
+                invert( value );
+                break;
+
+            case Program::STORE_ARGUMENT:
+                setConstant( *mArgumentPointers[ instruction.operand ], value );
+                break;
+
+            case Program::CALL:
+                {
+                    const Program::FunctionCall& functionCall = mProgram.getFunctionCalls()[ instruction.operand ];
+                    // the function receives the current branch value as result, like in the EvaluatorVisitor
+                    setConstant( mFunctionResult, value );
+                    functionCall.function( mFunctionResult, mArguments[ instruction.operand ], mErrorHandler );
+                    setValue( value, mFunctionResult.getType(), mFunctionResult.getDoubleValue() );
+                    break;
+                }
+
+            case Program::END_FRAGMENT:
+                {
+                    Program::Value fragmentValue = value;
+                    value = stack[ --stackSize ];
+                    assign( value, fragmentValue );
+                    break;
+                }
+            }
+        }
+
+        mValue = value;
+        return mValue;
+    }
+
+} //namespace MathML
@@ -0,0 +1,87 @@
+#include "MathMLSolverStableHeaders.h"
+#include "MathMLProgram.h"
+
+namespace MathML
+{
+    const size_t Program::INVALID_VARIABLE = ~( size_t ) 0;
+
+    //----------------------------------------------------------------------------
+    Program::Program()
+            : mArgumentCount( 0 )
+            , mStackSize( 0 )
+    {}
+
+    //----------------------------------------------------------------------------
+    Program::~Program()
+    {}
+
+    //----------------------------------------------------------------------------
+    void Program::clear()
+    {
+        mInstructions.clear();
+        mConstants.clear();
+        mVariableNames.clear();
+        mVariableSlots.clear();
+        mFunctionCalls.clear();
+        mArgumentCount = 0;
+        mStackSize = 0;
+    }
+
+    //----------------------------------------------------------------------------
+    size_t Program::addVariable( const String& name )
+    {
+        VariableSlotMap::const_iterator it = mVariableSlots.find( name );
+
+        if ( it != mVariableSlots.end() )
+        {
+            return it->second;
+        }
+
+        size_t slot = mVariableNames.size();
+        mVariableNames.push_back( name );
+        mVariableSlots[ name ] = slot;
+        return slot;
+    }
+
+    //----------------------------------------------------------------------------
+    size_t Program::findVariable( const String& name ) const
+    {
+        VariableSlotMap::const_iterator it = mVariableSlots.find( name );
+
+        if ( it != mVariableSlots.end() )
+        {
+            return it->second;
+        }
+
+        return INVALID_VARIABLE;
+    }
+
+    //----------------------------------------------------------------------------
+    void Program::addInstruction( OpCode opCode, size_t operand )
+    {
+        Instruction instruction;
+        instruction.opCode = opCode;
+        instruction.operand = operand;
+        mInstructions.push_back( instruction );
+    }
+
+    //----------------------------------------------------------------------------
+    size_t Program::addConstant( const Value& constant )
+    {
+        mConstants.push_back( constant );
+        return mConstants.size() - 1;
+    }
+
+    //----------------------------------------------------------------------------
+    size_t Program::addFunctionCall( SymbolTable::FunctionPtr function, size_t argumentCount )
+    {
+        FunctionCall functionCall;
+        functionCall.function = function;
+        functionCall.firstArgument = mArgumentCount;
+        functionCall.argumentCount = argumentCount;
+        mFunctionCalls.push_back( functionCall );
+        mArgumentCount += argumentCount;
+        return mFunctionCalls.size() - 1;
+    }
+
+} //namespace MathML
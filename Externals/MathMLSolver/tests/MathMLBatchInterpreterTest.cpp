@@ -0,0 +1,209 @@
+#include "MathMLSolverStableHeaders.h"
+#include "MathMLCompiler.h"
+#include "MathMLInterpreter.h"
+#include "MathMLBatchInterpreter.h"
+#include "MathMLError.h"
+#include "MathMLSolverFunctionExtensions.h"
+#include "MathMLParserConstants.h"
+#include "MathMLASTArithmeticExpression.h"
+#include "MathMLASTBinaryComparisionExpression.h"
+#include "MathMLASTFunctionExpression.h"
+#include "MathMLASTVariableExpression.h"
+
+#include <iostream>
+#include <vector>
+
+
+// Checks, that the BatchInterpreter gives the results of the Interpreter for each sample, including the
+// blocks evaluated sample by sample, and that it reports the errors of the functions once per sample.
+
+namespace
+{
+    int failures = 0;
+
+    void check( bool condition, const char* description )
+    {
+        if ( !condition )
+        {
+            std::cerr << "FAILED: " << description << std::endl;
+            ++failures;
+        }
+    }
+
+    /** Counts the handled errors. */
+    class ErrorCounter : public MathML::ErrorHandler
+    {
+    public:
+        size_t errorCount;
+
+        ErrorCounter() : errorCount( 0 ) {}
+
+        virtual bool handleError( const MathML::Error* )
+        {
+#pragma omp atomic
+            ++errorCount;
+            return true;
+        }
+    };
+
+    /** The number of samples, more than three blocks. */
+    const size_t SAMPLE_COUNT = 3 * MathML::BatchInterpreter::BLOCK_SIZE + 17;
+
+    MathML::AST::ArithmeticExpression* createArithmetic( MathML::AST::ArithmeticExpression::Operator op, MathML::AST::INode* lhs, MathML::AST::INode* rhs )
+    {
+        MathML::AST::ArithmeticExpression* arithmetic = new MathML::AST::ArithmeticExpression();
+        arithmetic->setOperator( op );
+        arithmetic->addOperand( lhs );
+        arithmetic->addOperand( rhs );
+        return arithmetic;
+    }
+
+    MathML::AST::FunctionExpression* createFunction( const MathML::String& name, MathML::AST::INode* argument )
+    {
+        MathML::AST::FunctionExpression* function = new MathML::AST::FunctionExpression( name );
+        function->addParameter( argument );
+        return function;
+    }
+
+    /** Evaluates @a node for the @a samples of the variable "x" of @a type with the BatchInterpreter and
+    sample by sample with the Interpreter. The variable "y" is the long 5 for all samples.
+    @return True, if all values, types and error counts match. */
+    bool matchesInterpreter( const MathML::AST::INode* node, const std::vector< double >& samples, MathML::AST::ConstantExpression::Type type, bool parallel, size_t& errorCount )
+    {
+        ErrorCounter compilerErrors;
+        MathML::SymbolTable symbolTable( &compilerErrors );
+        MathML::SolverFunctionExtentions::addAllExtensionFunctions( symbolTable );
+        MathML::Program program;
+        MathML::Compiler compiler( symbolTable, &compilerErrors );
+        if ( !compiler.compile( node, program ) )
+            return false;
+        size_t xSlot = program.findVariable( "x" );
+        size_t ySlot = program.findVariable( "y" );
+
+        ErrorCounter batchErrors;
+        MathML::BatchInterpreter batchInterpreter( program, &batchErrors );
+        batchInterpreter.setParallel( parallel );
+        if ( xSlot != MathML::Program::INVALID_VARIABLE )
+            batchInterpreter.setVariableValues( xSlot, &samples[ 0 ], type );
+        if ( ySlot != MathML::Program::INVALID_VARIABLE )
+            batchInterpreter.setVariable( ySlot, 5l );
+        std::vector< double > values( samples.size() );
+        std::vector< MathML::AST::ConstantExpression::Type > types( samples.size() );
+        batchInterpreter.evaluate( samples.size(), &values[ 0 ], &types[ 0 ] );
+
+        ErrorCounter interpreterErrors;
+        MathML::Interpreter interpreter( program, &interpreterErrors );
+        if ( ySlot != MathML::Program::INVALID_VARIABLE )
+            interpreter.setVariable( ySlot, 5l );
+        bool matches = true;
+        for ( size_t sample = 0; sample < samples.size(); ++sample )
+        {
+            if ( xSlot != MathML::Program::INVALID_VARIABLE )
+            {
+                MathML::Program::Value sampleValue;
+                sampleValue.type = type;
+                sampleValue.value = samples[ sample ];
+                interpreter.setVariable( xSlot, sampleValue );
+            }
+            const MathML::Program::Value& expected = interpreter.evaluate();
+            matches &= values[ sample ] == expected.value && types[ sample ] == expected.type;
+        }
+
+        errorCount = batchErrors.errorCount;
+        return matches && batchErrors.errorCount == interpreterErrors.errorCount;
+    }
+
+    /** Samples from -@a range to @a range. */
+    void createSamples( std::vector< double >& samples, double range )
+    {
+        samples.resize( SAMPLE_COUNT );
+        for ( size_t sample = 0; sample < SAMPLE_COUNT; ++sample )
+            samples[ sample ] = -range + 2. * range * sample / SAMPLE_COUNT;
+    }
+
+    /** Repeats the integers from -@a range to @a range without 0, except for the sample in the second block. */
+    void createIntegerSamples( std::vector< double >& samples, long range )
+    {
+        samples.resize( SAMPLE_COUNT );
+        for ( size_t sample = 0; sample < SAMPLE_COUNT; ++sample )
+        {
+            long value = static_cast< long >( sample % ( 2 * range ) ) - range;
+            samples[ sample ] = static_cast< double >( value < 0 ? value : value + 1 );
+        }
+        samples[ MathML::BatchInterpreter::BLOCK_SIZE + 10 ] = 0.;
+    }
+
+    void testDoubleSamples()
+    {
+        // sin( x ) * y + x / ( x - y )
+        MathML::AST::INode* node = createArithmetic( MathML::AST::ArithmeticExpression::ADD,
+            createArithmetic( MathML::AST::ArithmeticExpression::MUL, createFunction( MathML::FUNCTION_SIN, new MathML::AST::VariableExpression( "x" ) ), new MathML::AST::VariableExpression( "y" ) ),
+            createArithmetic( MathML::AST::ArithmeticExpression::DIV, new MathML::AST::VariableExpression( "x" ),
+                createArithmetic( MathML::AST::ArithmeticExpression::SUB, new MathML::AST::VariableExpression( "x" ), new MathML::AST::VariableExpression( "y" ) ) ) );
+
+        std::vector< double > samples;
+        createSamples( samples, 10. );
+        size_t errorCount = 0;
+        check( matchesInterpreter( node, samples, MathML::AST::ConstantExpression::SCALAR_DOUBLE, false, errorCount ), "double samples match the Interpreter" );
+        check( matchesInterpreter( node, samples, MathML::AST::ConstantExpression::SCALAR_DOUBLE, true, errorCount ), "double samples evaluated in parallel match the Interpreter" );
+        delete node;
+
+        MathML::AST::BinaryComparisonExpression comparison;
+        comparison.setOperator( MathML::AST::BinaryComparisonExpression::LT );
+        comparison.setLeftOperand( new MathML::AST::VariableExpression( "x" ) );
+        comparison.setRightOperand( new MathML::AST::VariableExpression( "y" ) );
+        check( matchesInterpreter( &comparison, samples, MathML::AST::ConstantExpression::SCALAR_DOUBLE, false, errorCount ), "comparisons of double samples match the Interpreter" );
+    }
+
+    void testIntegerDivisionByZero()
+    {
+        // y / x for integer samples, only the block containing x = 0 falls back to the Interpreter
+        // and results in the double 0 for that sample
+        MathML::AST::INode* node = createArithmetic( MathML::AST::ArithmeticExpression::DIV, new MathML::AST::VariableExpression( "y" ), new MathML::AST::VariableExpression( "x" ) );
+        std::vector< double > samples;
+        createIntegerSamples( samples, 1000 );
+        size_t errorCount = 0;
+        check( matchesInterpreter( node, samples, MathML::AST::ConstantExpression::SCALAR_LONG, false, errorCount ), "the integer division matches the Interpreter in all blocks" );
+        check( matchesInterpreter( node, samples, MathML::AST::ConstantExpression::SCALAR_LONG, true, errorCount ), "the parallel integer division matches the Interpreter in all blocks" );
+        delete node;
+    }
+
+    void testFunctionErrors()
+    {
+        // factorial( x ) + y / x reports an error for each negative sample. The block with x = 0 is
+        // evaluated again sample by sample after the factorial has been called for all its samples.
+        MathML::AST::INode* node = createArithmetic( MathML::AST::ArithmeticExpression::ADD,
+            createFunction( MathML::FUNCTION_FACTORIAL, new MathML::AST::VariableExpression( "x" ) ),
+            createArithmetic( MathML::AST::ArithmeticExpression::DIV, new MathML::AST::VariableExpression( "y" ), new MathML::AST::VariableExpression( "x" ) ) );
+
+        std::vector< double > samples;
+        createIntegerSamples( samples, 8 );
+        size_t negativeCount = 0;
+        for ( size_t sample = 0; sample < samples.size(); ++sample )
+        {
+            if ( samples[ sample ] < 0 )
+                ++negativeCount;
+        }
+
+        size_t errorCount = 0;
+        check( matchesInterpreter( node, samples, MathML::AST::ConstantExpression::SCALAR_LONG, false, errorCount ), "function results match the Interpreter" );
+        check( errorCount == negativeCount, "the errors of a function are reported once per sample" );
+        check( matchesInterpreter( node, samples, MathML::AST::ConstantExpression::SCALAR_LONG, true, errorCount ), "parallel function results match the Interpreter" );
+        check( errorCount == negativeCount, "the errors of a function are reported once per sample in parallel" );
+        delete node;
+    }
+}
+
+
+int main()
+{
+    testDoubleSamples();
+    testIntegerDivisionByZero();
+    testFunctionErrors();
+
+    if ( failures > 0 )
+        return -1;
+
+    std::cout << "All MathMLBatchInterpreter tests passed" << std::endl;
+    return 0;
+}
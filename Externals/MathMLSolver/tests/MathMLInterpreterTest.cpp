@@ -0,0 +1,289 @@
+#include "MathMLSolverStableHeaders.h"
+#include "MathMLCompiler.h"
+#include "MathMLInterpreter.h"
+#include "MathMLEvaluatorVisitor.h"
+#include "MathMLError.h"
+#include "MathMLASTArithmeticExpression.h"
+#include "MathMLASTFragmentExpression.h"
+#include "MathMLASTVariableExpression.h"
+#include "MathMLASTUnaryArithmeticExpression.h"
+#include "MathMLASTBinaryComparisionExpression.h"
+#include "MathMLASTLogicExpression.h"
+#include "MathMLASTFunctionExpression.h"
+#include "MathMLSolverFunctionExtensions.h"
+#include "MathMLParserConstants.h"
+
+#include <iostream>
+#include <vector>
+
+
+// Checks, that the Interpreter gives the results of the EvaluatorVisitor for all operators and
+// operand types, and the cases, in which it differs or reports errors at another time, as documented
+// at Interpreter and Compiler.
+
+namespace
+{
+    int failures = 0;
+
+    void check( bool condition, const char* description )
+    {
+        if ( !condition )
+        {
+            std::cerr << "FAILED: " << description << std::endl;
+            ++failures;
+        }
+    }
+
+    /** Collects the codes of all handled errors. */
+    class ErrorCollector : public MathML::ErrorHandler
+    {
+    public:
+        std::vector< MathML::Error::ErrorCode > errorCodes;
+
+        virtual bool handleError( const MathML::Error* error )
+        {
+            errorCodes.push_back( error->getErrorCode() );
+            return true;
+        }
+    };
+
+    /** Returns @a lhs / @a rhs. */
+    MathML::AST::ArithmeticExpression* createDivision( MathML::AST::INode* lhs, MathML::AST::INode* rhs )
+    {
+        MathML::AST::ArithmeticExpression* division = new MathML::AST::ArithmeticExpression();
+        division->setOperator( MathML::AST::ArithmeticExpression::DIV );
+        division->addOperand( lhs );
+        division->addOperand( rhs );
+        return division;
+    }
+
+    /** Compiles @a node and evaluates it with the interpreter. */
+    MathML::Program::Value interpret( const MathML::AST::INode* node, MathML::SymbolTable& symbolTable, ErrorCollector& errors, bool& compiled )
+    {
+        MathML::Program program;
+        MathML::Compiler compiler( symbolTable, &errors );
+        compiled = compiler.compile( node, program );
+
+        MathML::Interpreter interpreter( program, &errors );
+        interpreter.setVariables( symbolTable );
+        return interpreter.evaluate();
+    }
+
+    /** Evaluates @a node with the EvaluatorVisitor. */
+    MathML::AST::ConstantExpression evaluate( const MathML::AST::INode* node, MathML::SymbolTable& symbolTable, ErrorCollector& errors )
+    {
+        MathML::EvaluatorVisitor evaluator( symbolTable, &errors );
+        node->accept( &evaluator );
+        return evaluator.getValue();
+    }
+
+    /** The names of the variables set by setOperandVariables(), one per operand type and sign. */
+    const char* const OPERAND_NAMES[] = { "l", "m", "d", "e", "t", "f" };
+    const size_t OPERAND_COUNT = sizeof( OPERAND_NAMES ) / sizeof( OPERAND_NAMES[ 0 ] );
+
+    void setOperandVariables( MathML::SymbolTable& symbolTable )
+    {
+        symbolTable.setVariable( "l", 7l );
+        symbolTable.setVariable( "m", -3l );
+        symbolTable.setVariable( "d", 2.5 );
+        symbolTable.setVariable( "e", -0.75 );
+        symbolTable.setVariable( "t", true );
+        symbolTable.setVariable( "f", false );
+    }
+
+    /** Compiles @a node, evaluates it with the interpreter and the EvaluatorVisitor and compares the
+    results and the reported errors. Deletes @a node. */
+    bool matchesEvaluator( MathML::AST::INode* node, MathML::SymbolTable& symbolTable )
+    {
+        ErrorCollector interpreterErrors;
+        bool compiled = false;
+        MathML::Program::Value value = interpret( node, symbolTable, interpreterErrors, compiled );
+
+        ErrorCollector evaluatorErrors;
+        MathML::AST::ConstantExpression expected = evaluate( node, symbolTable, evaluatorErrors );
+        delete node;
+
+        // e.g. power() of a negative base gives NaN in both
+        double expectedValue = expected.getDoubleValue();
+        bool sameValue = value.value == expectedValue || ( value.value != value.value && expectedValue != expectedValue );
+        return compiled && value.type == expected.getType() && sameValue && interpreterErrors.errorCodes == evaluatorErrors.errorCodes;
+    }
+
+    void testOperators()
+    {
+        ErrorCollector errors;
+        MathML::SymbolTable symbolTable( &errors );
+        MathML::SolverFunctionExtentions::addAllExtensionFunctions( symbolTable );
+        setOperandVariables( symbolTable );
+
+        bool arithmeticMatches = true;
+        bool comparisonMatches = true;
+        bool logicMatches = true;
+        bool unaryMatches = true;
+        for ( size_t lhs = 0; lhs < OPERAND_COUNT; ++lhs )
+        {
+            for ( int op = MathML::AST::UnaryExpression::ADD; op <= MathML::AST::UnaryExpression::NOT; ++op )
+            {
+                MathML::AST::UnaryExpression* unary = new MathML::AST::UnaryExpression();
+                unary->setOperator( (MathML::AST::UnaryExpression::Operator)op );
+                unary->setOperand( new MathML::AST::VariableExpression( OPERAND_NAMES[ lhs ] ) );
+                unaryMatches &= matchesEvaluator( unary, symbolTable );
+            }
+
+            for ( size_t rhs = 0; rhs < OPERAND_COUNT; ++rhs )
+            {
+                for ( int op = MathML::AST::ArithmeticExpression::ADD; op <= MathML::AST::ArithmeticExpression::DIV; ++op )
+                {
+                    // the integer division by zero differs, see testIntegerDivisionByZero()
+                    if ( op == MathML::AST::ArithmeticExpression::DIV && OPERAND_NAMES[ rhs ][ 0 ] == 'f' )
+                        continue;
+                    MathML::AST::ArithmeticExpression* arithmetic = new MathML::AST::ArithmeticExpression();
+                    arithmetic->setOperator( (MathML::AST::ArithmeticExpression::Operator)op );
+                    arithmetic->addOperand( new MathML::AST::VariableExpression( OPERAND_NAMES[ lhs ] ) );
+                    arithmetic->addOperand( new MathML::AST::VariableExpression( OPERAND_NAMES[ rhs ] ) );
+                    arithmetic->addOperand( new MathML::AST::ConstantExpression( 2l ) );
+                    arithmeticMatches &= matchesEvaluator( arithmetic, symbolTable );
+                }
+
+                for ( int op = MathML::AST::BinaryComparisonExpression::EQ; op <= MathML::AST::BinaryComparisonExpression::GT; ++op )
+                {
+                    MathML::AST::BinaryComparisonExpression* comparison = new MathML::AST::BinaryComparisonExpression();
+                    comparison->setOperator( (MathML::AST::BinaryComparisonExpression::Operator)op );
+                    comparison->setLeftOperand( new MathML::AST::VariableExpression( OPERAND_NAMES[ lhs ] ) );
+                    comparison->setRightOperand( new MathML::AST::VariableExpression( OPERAND_NAMES[ rhs ] ) );
+                    comparisonMatches &= matchesEvaluator( comparison, symbolTable );
+                }
+
+                for ( int op = MathML::AST::LogicExpression::AND; op <= MathML::AST::LogicExpression::XOR; ++op )
+                {
+                    MathML::AST::LogicExpression* logic = new MathML::AST::LogicExpression();
+                    logic->setOperator( (MathML::AST::LogicExpression::Operator)op );
+                    logic->addOperand( new MathML::AST::VariableExpression( OPERAND_NAMES[ lhs ] ) );
+                    logic->addOperand( new MathML::AST::VariableExpression( OPERAND_NAMES[ rhs ] ) );
+                    logic->addOperand( new MathML::AST::ConstantExpression( true ) );
+                    logicMatches &= matchesEvaluator( logic, symbolTable );
+                }
+            }
+        }
+        check( arithmeticMatches, "the arithmetic operators match the EvaluatorVisitor" );
+        check( comparisonMatches, "the comparison operators match the EvaluatorVisitor" );
+        check( logicMatches, "the logic operators match the EvaluatorVisitor" );
+        check( unaryMatches, "the unary operators match the EvaluatorVisitor" );
+
+        // functions with a fixed and a variable number of arguments, nested in an expression. The arguments
+        // are the nonzero integers and 2.5, rem() of an argument truncated to 0 raises SIGFPE in both
+        const MathML::String functions[] = { MathML::FUNCTION_SIN, MathML::FUNCTION_POW, MathML::FUNCTION_MIN, MathML::FUNCTION_FLOOR, MathML::FUNCTION_REM, MathML::FUNCTION_ABS };
+        const size_t argumentCounts[] = { 1, 2, 3, 1, 2, 1 };
+        bool functionsMatch = true;
+        for ( size_t i = 0; i < sizeof( argumentCounts ) / sizeof( argumentCounts[ 0 ] ); ++i )
+        {
+            for ( size_t first = 0; first < OPERAND_COUNT; ++first )
+            {
+                MathML::AST::FunctionExpression* function = new MathML::AST::FunctionExpression( functions[ i ] );
+                for ( size_t argument = 0; argument < argumentCounts[ i ]; ++argument )
+                    function->addParameter( new MathML::AST::VariableExpression( OPERAND_NAMES[ (first + argument) % 3 ] ) );
+                MathML::AST::ArithmeticExpression* sum = new MathML::AST::ArithmeticExpression();
+                sum->setOperator( MathML::AST::ArithmeticExpression::ADD );
+                sum->addOperand( new MathML::AST::VariableExpression( OPERAND_NAMES[ first ] ) );
+                sum->addOperand( function );
+                functionsMatch &= matchesEvaluator( sum, symbolTable );
+            }
+        }
+        check( functionsMatch, "the functions match the EvaluatorVisitor" );
+    }
+
+    void testIntegerDivisionByZero()
+    {
+        // the EvaluatorVisitor raises SIGFPE, the interpreter results in the double 0
+        ErrorCollector errors;
+        MathML::SymbolTable symbolTable( &errors );
+        MathML::AST::ArithmeticExpression* division = createDivision( new MathML::AST::ConstantExpression( 7l ), new MathML::AST::ConstantExpression( 0l ) );
+
+        bool compiled = false;
+        MathML::Program::Value value = interpret( division, symbolTable, errors, compiled );
+        check( compiled, "integer division by zero compiles" );
+        check( value.type == MathML::AST::ConstantExpression::SCALAR_DOUBLE && value.value == 0., "integer division by zero results in the double 0" );
+        check( errors.errorCodes.empty(), "integer division by zero reports no error" );
+
+        delete division;
+    }
+
+    void testIntegerDivision()
+    {
+        ErrorCollector errors;
+        MathML::SymbolTable symbolTable( &errors );
+        MathML::AST::ArithmeticExpression* division = createDivision( new MathML::AST::ConstantExpression( 7l ), new MathML::AST::ConstantExpression( 2l ) );
+
+        bool compiled = false;
+        MathML::Program::Value value = interpret( division, symbolTable, errors, compiled );
+        MathML::AST::ConstantExpression expected = evaluate( division, symbolTable, errors );
+        check( value.type == expected.getType() && value.value == expected.getDoubleValue(), "integer division matches the EvaluatorVisitor" );
+
+        delete division;
+    }
+
+    void testMissingFragment()
+    {
+        // both report ERR_ITEM_NOT_FOUND, the compiler once, the EvaluatorVisitor on each evaluation
+        ErrorCollector compilerErrors;
+        MathML::SymbolTable symbolTable( &compilerErrors );
+        MathML::AST::FragmentExpression fragment( "missing" );
+
+        bool compiled = false;
+        interpret( &fragment, symbolTable, compilerErrors, compiled );
+        check( compilerErrors.errorCodes.size() == 1 && compilerErrors.errorCodes[ 0 ] == MathML::Error::ERR_ITEM_NOT_FOUND, "the compiler reports a missing fragment as ERR_ITEM_NOT_FOUND" );
+
+        ErrorCollector evaluatorErrors;
+        evaluate( &fragment, symbolTable, evaluatorErrors );
+        check( evaluatorErrors.errorCodes == compilerErrors.errorCodes, "the compiler reports a missing fragment like the EvaluatorVisitor" );
+    }
+
+    void testMissingVariable()
+    {
+        ErrorCollector interpreterErrors;
+        MathML::SymbolTable symbolTable( &interpreterErrors );
+        MathML::AST::VariableExpression variable( "missing" );
+
+        bool compiled = false;
+        MathML::Program::Value value = interpret( &variable, symbolTable, interpreterErrors, compiled );
+
+        ErrorCollector evaluatorErrors;
+        MathML::AST::ConstantExpression expected = evaluate( &variable, symbolTable, evaluatorErrors );
+        check( value.type == expected.getType() && value.value == expected.getDoubleValue(), "a missing variable has the value of the EvaluatorVisitor" );
+        check( interpreterErrors.errorCodes == evaluatorErrors.errorCodes, "a missing variable is reported like by the EvaluatorVisitor" );
+    }
+
+    void testRecursiveParameter()
+    {
+        // the EvaluatorVisitor recurses until the stack overflows, the compiler fails
+        ErrorCollector errors;
+        MathML::SymbolTable symbolTable( &errors );
+        MathML::AST::VariableExpression body( "x" );
+        MathML::AST::VariableExpression parameter( "x" );
+        MathML::AST::FragmentExpression fragment( "recursive" );
+        fragment.setFragment( &body );
+        fragment.addParameter( "x", &parameter );
+
+        MathML::Program program;
+        MathML::Compiler compiler( symbolTable, &errors );
+        check( !compiler.compile( &fragment, program ), "a recursive parameter fails to compile" );
+        check( !errors.errorCodes.empty(), "a recursive parameter is reported" );
+    }
+}
+
+
+int main()
+{
+    testOperators();
+    testIntegerDivisionByZero();
+    testIntegerDivision();
+    testMissingFragment();
+    testMissingVariable();
+    testRecursiveParameter();
+
+    if ( failures > 0 )
+        return -1;
+
+    std::cout << "All MathMLInterpreter tests passed" << std::endl;
+    return 0;
+}
@@ -19,12 +19,12 @@ class AbstractBaseCreate : public DependNode
 public:
 
 	AbstractBaseCreate():DependNode(){}
-	AbstractBaseCreate(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AbstractBaseCreate(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "abstractBaseCreate", shared, create){}
 	virtual ~AbstractBaseCreate(){}
 
 protected:
-	AbstractBaseCreate(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AbstractBaseCreate(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -19,12 +19,12 @@ class AbstractBaseNurbsConversion : public AbstractBaseCreate
 public:
 
 	AbstractBaseNurbsConversion():AbstractBaseCreate(){}
-	AbstractBaseNurbsConversion(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AbstractBaseNurbsConversion(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "abstractBaseNurbsConversion", shared, create){}
 	virtual ~AbstractBaseNurbsConversion(){}
 
 protected:
-	AbstractBaseNurbsConversion(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AbstractBaseNurbsConversion(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	AddDoubleLinear():DependNode(){}
-	AddDoubleLinear(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AddDoubleLinear(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "addDoubleLinear", shared, create){}
 	virtual ~AddDoubleLinear(){}
 
@@ -47,7 +47,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	AddDoubleLinear(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AddDoubleLinear(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	AddMatrix():DependNode(){}
-	AddMatrix(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AddMatrix(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "addMatrix", shared, create){}
 	virtual ~AddMatrix(){}
 
@@ -70,7 +70,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	AddMatrix(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AddMatrix(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -23,7 +23,7 @@ public:
 		double3 targetRotateTranslate;
 		matrix targetParentMatrix;
 		double targetWeight;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			targetTranslate.write(file);
 			fprintf(file, " ");
@@ -39,7 +39,7 @@ public:
 public:
 
 	AimConstraint():Constraint(){}
-	AimConstraint(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AimConstraint(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Constraint(file, name, parent, "aimConstraint", shared, create){}
 	virtual ~AimConstraint(){}
 
@@ -702,7 +702,7 @@ public:
 		fprintf(mFile,"\"%s.uooc\"",mName.c_str());
 	}
 protected:
-	AimConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AimConstraint(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Constraint(file, name, parent, nodeType, shared, create) {}
 
 };
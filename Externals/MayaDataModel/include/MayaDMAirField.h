@@ -21,7 +21,7 @@ public:
 		double directionX;
 		double directionY;
 		double directionZ;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", directionX);
 			fprintf(file,"%f ", directionY);
@@ -31,7 +31,7 @@ public:
 public:
 
 	AirField():Field(){}
-	AirField(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AirField(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Field(file, name, parent, "airField", shared, create){}
 	virtual ~AirField(){}
 
@@ -127,7 +127,7 @@ public:
 		fprintf(mFile,"\"%s.ir\"",mName.c_str());
 	}
 protected:
-	AirField(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AirField(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Field(file, name, parent, nodeType, shared, create) {}
 
 };
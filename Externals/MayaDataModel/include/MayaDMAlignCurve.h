@@ -20,7 +20,7 @@ public:
 public:
 
 	AlignCurve():AbstractBaseCreate(){}
-	AlignCurve(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AlignCurve(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "alignCurve", shared, create){}
 	virtual ~AlignCurve(){}
 
@@ -167,7 +167,7 @@ public:
 		fprintf(mFile,"\"%s.cc\"",mName.c_str());
 	}
 protected:
-	AlignCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AlignCurve(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
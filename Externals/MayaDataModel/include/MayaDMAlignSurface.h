@@ -20,7 +20,7 @@ public:
 public:
 
 	AlignSurface():AbstractBaseCreate(){}
-	AlignSurface(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AlignSurface(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "alignSurface", shared, create){}
 	virtual ~AlignSurface(){}
 
@@ -203,7 +203,7 @@ public:
 		fprintf(mFile,"\"%s.du\"",mName.c_str());
 	}
 protected:
-	AlignSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AlignSurface(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	AmbientLight():RenderLight(){}
-	AmbientLight(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AmbientLight(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:RenderLight(file, name, parent, "ambientLight", shared, create){}
 	virtual ~AmbientLight(){}
 
@@ -86,7 +86,7 @@ public:
 		fprintf(mFile,"\"%s.gs\"",mName.c_str());
 	}
 protected:
-	AmbientLight(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AmbientLight(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:RenderLight(file, name, parent, nodeType, shared, create) {}
 
 };
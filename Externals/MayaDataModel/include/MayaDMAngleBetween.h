@@ -18,14 +18,14 @@ class AngleBetween : public DependNode
 {
 public:
 	struct AxisAngle{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	AngleBetween():DependNode(){}
-	AngleBetween(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AngleBetween(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "angleBetween", shared, create){}
 	virtual ~AngleBetween(){}
 
@@ -144,7 +144,7 @@ public:
 		fprintf(mFile,"\"%s.axa.a\"",mName.c_str());
 	}
 protected:
-	AngleBetween(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AngleBetween(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
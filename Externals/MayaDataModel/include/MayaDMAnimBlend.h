@@ -20,7 +20,7 @@ public:
 public:
 
 	AnimBlend():DependNode(){}
-	AnimBlend(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AnimBlend(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "animBlend", shared, create){}
 	virtual ~AnimBlend(){}
 
@@ -38,7 +38,7 @@ public:
 		fprintf(mFile,"\"%s.w\"",mName.c_str());
 	}
 protected:
-	AnimBlend(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AnimBlend(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	AnimBlendInOut():AnimBlend(){}
-	AnimBlendInOut(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AnimBlendInOut(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AnimBlend(file, name, parent, "animBlendInOut", shared, create){}
 	virtual ~AnimBlendInOut(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.rb\"",mName.c_str());
 	}
 protected:
-	AnimBlendInOut(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AnimBlendInOut(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AnimBlend(file, name, parent, nodeType, shared, create) {}
 
 };
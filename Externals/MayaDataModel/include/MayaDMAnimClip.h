@@ -20,7 +20,7 @@ public:
 public:
 
 	AnimClip():DependNode(){}
-	AnimClip(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AnimClip(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "animClip", shared, create){}
 	virtual ~AnimClip(){}
 
@@ -66,11 +66,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".co[%i:%i]\" ", co_start,co_end);
 		size_t size = (co_end-co_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",co[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(co,size);
 		fprintf(mFile,";\n");
 	}
 	void startChannelOffset(size_t co_start,size_t co_end)const
@@ -262,7 +258,7 @@ public:
 		fprintf(mFile,"\"%s.sp\"",mName.c_str());
 	}
 protected:
-	AnimClip(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AnimClip(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
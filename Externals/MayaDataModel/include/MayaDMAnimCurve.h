@@ -20,7 +20,7 @@ public:
 public:
 
 	AnimCurve():DependNode(){}
-	AnimCurve(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AnimCurve(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "animCurve", shared, create){}
 	virtual ~AnimCurve(){}
 
@@ -99,11 +99,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".kix[%i:%i]\" ", kix_start,kix_end);
 		size_t size = (kix_end-kix_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",kix[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(kix,size);
 		fprintf(mFile,";\n");
 	}
 	void startKeyTanInX(size_t kix_start,size_t kix_end)const
@@ -127,11 +123,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".kiy[%i:%i]\" ", kiy_start,kiy_end);
 		size_t size = (kiy_end-kiy_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",kiy[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(kiy,size);
 		fprintf(mFile,";\n");
 	}
 	void startKeyTanInY(size_t kiy_start,size_t kiy_end)const
@@ -155,11 +147,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".kox[%i:%i]\" ", kox_start,kox_end);
 		size_t size = (kox_end-kox_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",kox[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(kox,size);
 		fprintf(mFile,";\n");
 	}
 	void startKeyTanOutX(size_t kox_start,size_t kox_end)const
@@ -183,11 +171,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".koy[%i:%i]\" ", koy_start,koy_end);
 		size_t size = (koy_end-koy_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",koy[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(koy,size);
 		fprintf(mFile,";\n");
 	}
 	void startKeyTanOutY(size_t koy_start,size_t koy_end)const
@@ -429,7 +413,7 @@ public:
 		fprintf(mFile,"\"%s.cc.ccb\"",mName.c_str());
 	}
 protected:
-	AnimCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AnimCurve(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 	struct KeyTimeValue{
 		double keyTime;
 		double keyValue;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", keyTime);
 			fprintf(file,"%f", keyValue);
@@ -29,7 +29,7 @@ public:
 public:
 
 	AnimCurveTT():AnimCurve(){}
-	AnimCurveTT(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AnimCurveTT(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AnimCurve(file, name, parent, "animCurveTT", shared, create){}
 	virtual ~AnimCurveTT(){}
 
@@ -83,7 +83,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	AnimCurveTT(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AnimCurveTT(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AnimCurve(file, name, parent, nodeType, shared, create) {}
 
 };
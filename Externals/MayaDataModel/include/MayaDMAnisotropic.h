@@ -20,7 +20,7 @@ public:
 public:
 
 	Anisotropic():Reflect(){}
-	Anisotropic(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Anisotropic(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Reflect(file, name, parent, "anisotropic", shared, create){}
 	virtual ~Anisotropic(){}
 
@@ -202,7 +202,7 @@ public:
 		fprintf(mFile,"\"%s.mirf\"",mName.c_str());
 	}
 protected:
-	Anisotropic(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Anisotropic(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Reflect(file, name, parent, nodeType, shared, create) {}
 
 };
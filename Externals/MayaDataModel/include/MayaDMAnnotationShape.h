@@ -20,7 +20,7 @@ public:
 public:
 
 	AnnotationShape():DimensionShape(){}
-	AnnotationShape(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AnnotationShape(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DimensionShape(file, name, parent, "annotationShape", shared, create){}
 	virtual ~AnnotationShape(){}
 
@@ -102,7 +102,7 @@ public:
 		fprintf(mFile,"\"%s.daro\"",mName.c_str());
 	}
 protected:
-	AnnotationShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AnnotationShape(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DimensionShape(file, name, parent, nodeType, shared, create) {}
 
 };
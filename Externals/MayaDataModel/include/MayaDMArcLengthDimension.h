@@ -20,7 +20,7 @@ public:
 public:
 
 	ArcLengthDimension():NurbsDimShape(){}
-	ArcLengthDimension(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ArcLengthDimension(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:NurbsDimShape(file, name, parent, "arcLengthDimension", shared, create){}
 	virtual ~ArcLengthDimension(){}
 
@@ -33,7 +33,7 @@ public:
 		fprintf(mFile,"\"%s.alv\"",mName.c_str());
 	}
 protected:
-	ArcLengthDimension(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ArcLengthDimension(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:NurbsDimShape(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -45,7 +45,7 @@ public:
 			short smapWindowYMin;
 			short smapWindowXMax;
 			short smapWindowYMax;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				fprintf(file,"%i ", smapWindowXMin);
 				fprintf(file,"%i ", smapWindowYMin);
@@ -62,7 +62,7 @@ public:
 		short areaHiSampleLimit;
 		short areaLoSamples;
 		bool areaVisible;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", miExportMrLight);
 			fprintf(file,"%i ", emitPhotons);
@@ -104,7 +104,7 @@ public:
 public:
 
 	AreaLight():NonExtendedLightShapeNode(){}
-	AreaLight(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AreaLight(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:NonExtendedLightShapeNode(file, name, parent, "areaLight", shared, create){}
 	virtual ~AreaLight(){}
 
@@ -557,7 +557,7 @@ public:
 		fprintf(mFile,"\"%s.mrc.aobj\"",mName.c_str());
 	}
 protected:
-	AreaLight(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AreaLight(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:NonExtendedLightShapeNode(file, name, parent, nodeType, shared, create) {}
 
 };
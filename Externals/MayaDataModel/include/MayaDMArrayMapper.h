@@ -20,7 +20,7 @@ public:
 public:
 
 	ArrayMapper():DependNode(){}
-	ArrayMapper(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ArrayMapper(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "arrayMapper", shared, create){}
 	virtual ~ArrayMapper(){}
 
@@ -83,7 +83,7 @@ public:
 		fprintf(mFile,"\"%s.ovpp\"",mName.c_str());
 	}
 protected:
-	ArrayMapper(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ArrayMapper(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	AttachCurve():AbstractBaseCreate(){}
-	AttachCurve(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AttachCurve(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "attachCurve", shared, create){}
 	virtual ~AttachCurve(){}
 
@@ -109,7 +109,7 @@ public:
 		fprintf(mFile,"\"%s.p\"",mName.c_str());
 	}
 protected:
-	AttachCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AttachCurve(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	AttachSurface():AbstractBaseCreate(){}
-	AttachSurface(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AttachSurface(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "attachSurface", shared, create){}
 	virtual ~AttachSurface(){}
 
@@ -136,7 +136,7 @@ public:
 		fprintf(mFile,"\"%s.kmk\"",mName.c_str());
 	}
 protected:
-	AttachSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AttachSurface(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
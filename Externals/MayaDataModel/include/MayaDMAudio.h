@@ -20,7 +20,7 @@ public:
 public:
 
 	Audio():DependNode(){}
-	Audio(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Audio(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "audio", shared, create){}
 	virtual ~Audio(){}
 
@@ -54,7 +54,7 @@ public:
 		fprintf(mFile,"\"%s.r\"",mName.c_str());
 	}
 protected:
-	Audio(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Audio(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
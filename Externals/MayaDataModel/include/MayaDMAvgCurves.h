@@ -20,7 +20,7 @@ public:
 public:
 
 	AvgCurves():AbstractBaseCreate(){}
-	AvgCurves(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AvgCurves(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "avgCurves", shared, create){}
 	virtual ~AvgCurves(){}
 
@@ -73,7 +73,7 @@ public:
 		fprintf(mFile,"\"%s.oc\"",mName.c_str());
 	}
 protected:
-	AvgCurves(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AvgCurves(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
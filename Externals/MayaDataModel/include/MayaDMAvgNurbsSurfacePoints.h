@@ -24,7 +24,7 @@ public:
 		double parameterV;
 		int cvIthIndex;
 		int cvJthIndex;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			inputSurface.write(file);
 			fprintf(file, " ");
@@ -36,14 +36,14 @@ public:
 		}
 	};
 	struct Result{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	AvgNurbsSurfacePoints():AbstractBaseCreate(){}
-	AvgNurbsSurfacePoints(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AvgNurbsSurfacePoints(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "avgNurbsSurfacePoints", shared, create){}
 	virtual ~AvgNurbsSurfacePoints(){}
 
@@ -200,7 +200,7 @@ public:
 		fprintf(mFile,"\"%s.r.n.nz\"",mName.c_str());
 	}
 protected:
-	AvgNurbsSurfacePoints(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AvgNurbsSurfacePoints(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
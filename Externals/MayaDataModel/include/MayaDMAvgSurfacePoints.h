@@ -18,14 +18,14 @@ class AvgSurfacePoints : public AbstractBaseCreate
 {
 public:
 	struct Result{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	AvgSurfacePoints():AbstractBaseCreate(){}
-	AvgSurfacePoints(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	AvgSurfacePoints(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "avgSurfacePoints", shared, create){}
 	virtual ~AvgSurfacePoints(){}
 
@@ -38,11 +38,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".wt[%i:%i]\" ", wt_start,wt_end);
 		size_t size = (wt_end-wt_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",wt[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(wt,size);
 		fprintf(mFile,";\n");
 	}
 	void startWeight(size_t wt_start,size_t wt_end)const
@@ -66,11 +62,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".u[%i:%i]\" ", u_start,u_end);
 		size_t size = (u_end-u_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",u[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(u,size);
 		fprintf(mFile,";\n");
 	}
 	void startParameterU(size_t u_start,size_t u_end)const
@@ -94,11 +86,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".v[%i:%i]\" ", v_start,v_end);
 		size_t size = (v_end-v_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",v[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(v,size);
 		fprintf(mFile,";\n");
 	}
 	void startParameterV(size_t v_start,size_t v_end)const
@@ -195,7 +183,7 @@ public:
 		fprintf(mFile,"\"%s.r.n.nz\"",mName.c_str());
 	}
 protected:
-	AvgSurfacePoints(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	AvgSurfacePoints(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	BakeSet():ObjectSet(){}
-	BakeSet(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	BakeSet(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:ObjectSet(file, name, parent, "bakeSet", shared, create){}
 	virtual ~BakeSet(){}
 
@@ -92,7 +92,7 @@ public:
 		fprintf(mFile,"\"%s.csh\"",mName.c_str());
 	}
 protected:
-	BakeSet(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	BakeSet(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:ObjectSet(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	BaseGeometryVarGroup():Transform(){}
-	BaseGeometryVarGroup(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	BaseGeometryVarGroup(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Transform(file, name, parent, "baseGeometryVarGroup", shared, create){}
 	virtual ~BaseGeometryVarGroup(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.mc\"",mName.c_str());
 	}
 protected:
-	BaseGeometryVarGroup(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	BaseGeometryVarGroup(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Transform(file, name, parent, nodeType, shared, create) {}
 
 };
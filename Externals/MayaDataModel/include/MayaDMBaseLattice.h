@@ -19,12 +19,12 @@ class BaseLattice : public Shape
 public:
 
 	BaseLattice():Shape(){}
-	BaseLattice(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	BaseLattice(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Shape(file, name, parent, "baseLattice", shared, create){}
 	virtual ~BaseLattice(){}
 
 protected:
-	BaseLattice(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	BaseLattice(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Shape(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	BaseShadingSwitch():DependNode(){}
-	BaseShadingSwitch(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	BaseShadingSwitch(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "baseShadingSwitch", shared, create){}
 	virtual ~BaseShadingSwitch(){}
 
@@ -29,7 +29,7 @@ public:
 		fprintf(mFile,"\"%s.id\"",mName.c_str());
 	}
 protected:
-	BaseShadingSwitch(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	BaseShadingSwitch(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
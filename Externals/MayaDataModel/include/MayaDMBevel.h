@@ -20,7 +20,7 @@ public:
 public:
 
 	Bevel():AbstractBaseCreate(){}
-	Bevel(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Bevel(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "bevel", shared, create){}
 	virtual ~Bevel(){}
 
@@ -117,7 +117,7 @@ public:
 		fprintf(mFile,"\"%s.js\"",mName.c_str());
 	}
 protected:
-	Bevel(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Bevel(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
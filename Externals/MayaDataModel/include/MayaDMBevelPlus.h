@@ -20,7 +20,7 @@ public:
 public:
 
 	BevelPlus():AbstractBaseCreate(){}
-	BevelPlus(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	BevelPlus(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "bevelPlus", shared, create){}
 	virtual ~BevelPlus(){}
 
@@ -279,7 +279,7 @@ public:
 		fprintf(mFile,"\"%s.chr\"",mName.c_str());
 	}
 protected:
-	BevelPlus(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	BevelPlus(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
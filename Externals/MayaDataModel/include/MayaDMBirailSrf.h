@@ -20,7 +20,7 @@ public:
 public:
 
 	BirailSrf():AbstractBaseCreate(){}
-	BirailSrf(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	BirailSrf(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "birailSrf", shared, create){}
 	virtual ~BirailSrf(){}
 
@@ -50,7 +50,7 @@ public:
 		fprintf(mFile,"\"%s.os\"",mName.c_str());
 	}
 protected:
-	BirailSrf(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	BirailSrf(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Blend():DependNode(){}
-	Blend(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Blend(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "blend", shared, create){}
 	virtual ~Blend(){}
 
@@ -33,11 +33,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".i[%i:%i]\" ", i_start,i_end);
 		size_t size = (i_end-i_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",i_[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(i_,size);
 		fprintf(mFile,";\n");
 	}
 	void startInput(size_t i_start,size_t i_end)const
@@ -71,7 +67,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	Blend(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Blend(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
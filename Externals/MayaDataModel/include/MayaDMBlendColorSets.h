@@ -20,7 +20,7 @@ public:
 public:
 
 	BlendColorSets():PolyModifier(){}
-	BlendColorSets(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	BlendColorSets(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "blendColorSets", shared, create){}
 	virtual ~BlendColorSets(){}
 
@@ -103,7 +103,7 @@ public:
 		fprintf(mFile,"\"%s.bwd\"",mName.c_str());
 	}
 protected:
-	BlendColorSets(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	BlendColorSets(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	BlendColors():DependNode(){}
-	BlendColors(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	BlendColors(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "blendColors", shared, create){}
 	virtual ~BlendColors(){}
 
@@ -126,7 +126,7 @@ public:
 		fprintf(mFile,"\"%s.op.opb\"",mName.c_str());
 	}
 protected:
-	BlendColors(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	BlendColors(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	BlendDevice():Blend(){}
-	BlendDevice(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	BlendDevice(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Blend(file, name, parent, "blendDevice", shared, create){}
 	virtual ~BlendDevice(){}
 
@@ -33,11 +33,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ia[%i:%i]\" ", ia_start,ia_end);
 		size_t size = (ia_end-ia_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",ia[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(ia,size);
 		fprintf(mFile,";\n");
 	}
 	void startInputAngle(size_t ia_start,size_t ia_end)const
@@ -61,11 +57,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".il[%i:%i]\" ", il_start,il_end);
 		size_t size = (il_end-il_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",il[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(il,size);
 		fprintf(mFile,";\n");
 	}
 	void startInputLinear(size_t il_start,size_t il_end)const
@@ -147,7 +139,7 @@ public:
 		fprintf(mFile,"\"%s.off\"",mName.c_str());
 	}
 protected:
-	BlendDevice(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	BlendDevice(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Blend(file, name, parent, nodeType, shared, create) {}
 
 };
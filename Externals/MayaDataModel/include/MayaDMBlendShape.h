@@ -22,7 +22,7 @@ public:
 			struct InputTargetItem{
 				pointArray inputPointsTarget;
 				componentList inputComponentsTarget;
-				void write(FILE* file) const
+				void write(Writer* file) const
 				{
 					inputPointsTarget.write(file);
 					fprintf(file, " ");
@@ -30,7 +30,7 @@ public:
 				}
 			}* inputTargetItem;
 			float* targetWeights;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				size_t size = sizeof(inputTargetItem)/sizeof(InputTargetItem);
 				for(size_t i=0; i<size; ++i)
@@ -47,7 +47,7 @@ public:
 				}
 			}
 		}* inputTargetGroup;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(inputTargetGroup)/sizeof(InputTargetGroup);
 			for(size_t i=0; i<size; ++i)
@@ -60,7 +60,7 @@ public:
 public:
 
 	BlendShape():GeometryFilter(){}
-	BlendShape(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	BlendShape(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, "blendShape", shared, create){}
 	virtual ~BlendShape(){}
 
@@ -78,11 +78,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".w[%i:%i]\" ", w_start,w_end);
 		size_t size = (w_end-w_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",w[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(w,size);
 		fprintf(mFile,";\n");
 	}
 	void startWeight(size_t w_start,size_t w_end)const
@@ -243,11 +239,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".it[%i].itg[%i].tw[%i:%i]\" ", it_i,itg_i,tw_start,tw_end);
 		size_t size = (tw_end-tw_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",tw[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(tw,size);
 		fprintf(mFile,";\n");
 	}
 	void startTargetWeights(size_t it_i,size_t itg_i,size_t tw_start,size_t tw_end)const
@@ -436,7 +428,7 @@ public:
 		fprintf(mFile,"\"%s.to.tz\"",mName.c_str());
 	}
 protected:
-	BlendShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	BlendShape(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	BlendTwoAttr():Blend(){}
-	BlendTwoAttr(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	BlendTwoAttr(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Blend(file, name, parent, "blendTwoAttr", shared, create){}
 	virtual ~BlendTwoAttr(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.ab\"",mName.c_str());
 	}
 protected:
-	BlendTwoAttr(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	BlendTwoAttr(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Blend(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	BlendWeighted():Blend(){}
-	BlendWeighted(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	BlendWeighted(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Blend(file, name, parent, "blendWeighted", shared, create){}
 	virtual ~BlendWeighted(){}
 
@@ -33,11 +33,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".w[%i:%i]\" ", w_start,w_end);
 		size_t size = (w_end-w_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",w[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(w,size);
 		fprintf(mFile,";\n");
 	}
 	void startWeight(size_t w_start,size_t w_end)const
@@ -62,7 +58,7 @@ public:
 		fprintf(mFile,"\"%s.w\"",mName.c_str());
 	}
 protected:
-	BlendWeighted(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	BlendWeighted(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Blend(file, name, parent, nodeType, shared, create) {}
 
 };
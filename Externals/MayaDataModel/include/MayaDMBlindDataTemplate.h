@@ -22,14 +22,14 @@ public:
 		struct BdPresetElements{
 			string bdPresetAttr;
 			string bdPresetValue;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				bdPresetAttr.write(file);
 				fprintf(file, " ");
 				bdPresetValue.write(file);
 			}
 		}* bdPresetElements;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			bdPresetName.write(file);
 			fprintf(file, " ");
@@ -44,7 +44,7 @@ public:
 	struct BdUserInfo{
 		string bdUserInfoName;
 		string bdUserInfoValue;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			bdUserInfoName.write(file);
 			fprintf(file, " ");
@@ -54,7 +54,7 @@ public:
 public:
 
 	BlindDataTemplate():DependNode(){}
-	BlindDataTemplate(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	BlindDataTemplate(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "blindDataTemplate", shared, create){}
 	virtual ~BlindDataTemplate(){}
 
@@ -192,7 +192,7 @@ public:
 		fprintf(mFile,";\n");
 	}
 protected:
-	BlindDataTemplate(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	BlindDataTemplate(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Blinn():Reflect(){}
-	Blinn(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Blinn(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Reflect(file, name, parent, "blinn", shared, create){}
 	virtual ~Blinn(){}
 
@@ -125,7 +125,7 @@ public:
 		fprintf(mFile,"\"%s.mirf\"",mName.c_str());
 	}
 protected:
-	Blinn(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Blinn(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Reflect(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	BoneLattice():GeometryFilter(){}
-	BoneLattice(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	BoneLattice(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, "boneLattice", shared, create){}
 	virtual ~BoneLattice(){}
 
@@ -173,7 +173,7 @@ public:
 		fprintf(mFile,"\"%s.bm\"",mName.c_str());
 	}
 protected:
-	BoneLattice(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	BoneLattice(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Boolean():AbstractBaseCreate(){}
-	Boolean(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Boolean(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "boolean", shared, create){}
 	virtual ~Boolean(){}
 
@@ -55,7 +55,7 @@ public:
 		fprintf(mFile,"\"%s.osh\"",mName.c_str());
 	}
 protected:
-	Boolean(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Boolean(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
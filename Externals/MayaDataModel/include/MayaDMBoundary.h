@@ -20,7 +20,7 @@ public:
 public:
 
 	Boundary():BoundaryBase(){}
-	Boundary(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Boundary(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:BoundaryBase(file, name, parent, "boundary", shared, create){}
 	virtual ~Boundary(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.ep\"",mName.c_str());
 	}
 protected:
-	Boundary(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Boundary(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:BoundaryBase(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	BoundaryBase():AbstractBaseCreate(){}
-	BoundaryBase(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	BoundaryBase(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "boundaryBase", shared, create){}
 	virtual ~BoundaryBase(){}
 
@@ -54,7 +54,7 @@ public:
 		fprintf(mFile,"\"%s.os\"",mName.c_str());
 	}
 protected:
-	BoundaryBase(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	BoundaryBase(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Brownian():Texture3d(){}
-	Brownian(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Brownian(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, "brownian", shared, create){}
 	virtual ~Brownian(){}
 
@@ -147,7 +147,7 @@ public:
 		fprintf(mFile,"\"%s.w3.w3z\"",mName.c_str());
 	}
 protected:
-	Brownian(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Brownian(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -21,7 +21,7 @@ public:
 		float leafCurl_Position;
 		float leafCurl_FloatValue;
 		unsigned int leafCurl_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", leafCurl_Position);
 			fprintf(file,"%f ", leafCurl_FloatValue);
@@ -32,7 +32,7 @@ public:
 		float petalCurl_Position;
 		float petalCurl_FloatValue;
 		unsigned int petalCurl_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", petalCurl_Position);
 			fprintf(file,"%f ", petalCurl_FloatValue);
@@ -43,7 +43,7 @@ public:
 		float widthScale_Position;
 		float widthScale_FloatValue;
 		unsigned int widthScale_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", widthScale_Position);
 			fprintf(file,"%f ", widthScale_FloatValue);
@@ -54,7 +54,7 @@ public:
 		float leafWidthScale_Position;
 		float leafWidthScale_FloatValue;
 		unsigned int leafWidthScale_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", leafWidthScale_Position);
 			fprintf(file,"%f ", leafWidthScale_FloatValue);
@@ -65,7 +65,7 @@ public:
 		float petalWidthScale_Position;
 		float petalWidthScale_FloatValue;
 		unsigned int petalWidthScale_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", petalWidthScale_Position);
 			fprintf(file,"%f ", petalWidthScale_FloatValue);
@@ -76,7 +76,7 @@ public:
 		float twigLengthScale_Position;
 		float twigLengthScale_FloatValue;
 		unsigned int twigLengthScale_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", twigLengthScale_Position);
 			fprintf(file,"%f ", twigLengthScale_FloatValue);
@@ -87,7 +87,7 @@ public:
 		float environment_Position;
 		float3 environment_Color;
 		unsigned int environment_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", environment_Position);
 			environment_Color.write(file);
@@ -99,7 +99,7 @@ public:
 		float reflectionRolloff_Position;
 		float reflectionRolloff_FloatValue;
 		unsigned int reflectionRolloff_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", reflectionRolloff_Position);
 			fprintf(file,"%f ", reflectionRolloff_FloatValue);
@@ -109,7 +109,7 @@ public:
 public:
 
 	Brush():DependNode(){}
-	Brush(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Brush(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "brush", shared, create){}
 	virtual ~Brush(){}
 
@@ -3862,7 +3862,7 @@ public:
 		fprintf(mFile,"\"%s.hde\"",mName.c_str());
 	}
 protected:
-	Brush(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Brush(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Bulge():Texture2d(){}
-	Bulge(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Bulge(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, "bulge", shared, create){}
 	virtual ~Bulge(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.vw\"",mName.c_str());
 	}
 protected:
-	Bulge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Bulge(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, nodeType, shared, create) {}
 
 };
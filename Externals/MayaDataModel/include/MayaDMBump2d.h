@@ -20,7 +20,7 @@ public:
 public:
 
 	Bump2d():DependNode(){}
-	Bump2d(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Bump2d(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "bump2d", shared, create){}
 	virtual ~Bump2d(){}
 
@@ -399,7 +399,7 @@ public:
 		fprintf(mFile,"\"%s.vc2.c2z\"",mName.c_str());
 	}
 protected:
-	Bump2d(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Bump2d(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
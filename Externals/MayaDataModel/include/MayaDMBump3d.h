@@ -20,7 +20,7 @@ public:
 public:
 
 	Bump3d():DependNode(){}
-	Bump3d(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Bump3d(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "bump3d", shared, create){}
 	virtual ~Bump3d(){}
 
@@ -218,7 +218,7 @@ public:
 		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
 	}
 protected:
-	Bump3d(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Bump3d(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	CacheBase():DependNode(){}
-	CacheBase(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CacheBase(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "cacheBase", shared, create){}
 	virtual ~CacheBase(){}
 
@@ -38,7 +38,7 @@ public:
 		fprintf(mFile,"\"%s.ir\"",mName.c_str());
 	}
 protected:
-	CacheBase(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CacheBase(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
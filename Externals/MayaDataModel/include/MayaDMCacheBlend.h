@@ -19,7 +19,7 @@ class CacheBlend : public CacheBase
 public:
 	struct InCache{
 		doubleArray* perPtWeights;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(perPtWeights)/sizeof(doubleArray);
 			for(size_t i=0; i<size; ++i)
@@ -34,7 +34,7 @@ public:
 		double end;
 		bool range;
 		double weight;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", start);
 			fprintf(file,"%f ", end);
@@ -45,7 +45,7 @@ public:
 public:
 
 	CacheBlend():CacheBase(){}
-	CacheBlend(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CacheBlend(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:CacheBase(file, name, parent, "cacheBlend", shared, create){}
 	virtual ~CacheBlend(){}
 
@@ -245,7 +245,7 @@ public:
 		fprintf(mFile,"\"%s.cd.w\"",mName.c_str());
 	}
 protected:
-	CacheBlend(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CacheBlend(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:CacheBase(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	CacheFile():CacheBase(){}
-	CacheFile(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CacheFile(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:CacheBase(file, name, parent, "cacheFile", shared, create){}
 	virtual ~CacheFile(){}
 
@@ -285,7 +285,7 @@ public:
 		fprintf(mFile,"\"%s.dp\"",mName.c_str());
 	}
 protected:
-	CacheFile(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CacheFile(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:CacheBase(file, name, parent, nodeType, shared, create) {}
 
 };
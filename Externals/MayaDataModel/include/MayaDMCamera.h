@@ -24,7 +24,7 @@ public:
 			double2 filmRollPivot;
 			double filmRollValue;
 			unsigned int filmRollOrder;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				filmRollPivot.write(file);
 				fprintf(file, " ");
@@ -33,7 +33,7 @@ public:
 			}
 		} filmRollControl;
 		double postScale;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", preScale);
 			filmTranslate.write(file);
@@ -54,7 +54,7 @@ public:
 		bool miFbComputeCoverage;
 		bool miFbComputeTag;
 		bool miFbComputeContour;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", miFbComputeColor);
 			fprintf(file,"%i ", miFbBitsizeColor);
@@ -71,7 +71,7 @@ public:
 public:
 
 	Camera():Shape(){}
-	Camera(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Camera(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Shape(file, name, parent, "camera", shared, create){}
 	virtual ~Camera(){}
 
@@ -929,7 +929,7 @@ public:
 		fprintf(mFile,"\"%s.mrc.mirp[%i]\"",mName.c_str(),mirp_i);
 	}
 protected:
-	Camera(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Camera(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Shape(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	CameraView():DependNode(){}
-	CameraView(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CameraView(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "cameraView", shared, create){}
 	virtual ~CameraView(){}
 
@@ -233,7 +233,7 @@ public:
 		fprintf(mFile,"\"%s.d\"",mName.c_str());
 	}
 protected:
-	CameraView(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CameraView(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -21,7 +21,7 @@ public:
 		struct ClipEvaluate_Inmap{
 			short clipEvaluate_InmapTo;
 			short clipEvaluate_InmapFrom;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				fprintf(file,"%i ", clipEvaluate_InmapTo);
 				fprintf(file,"%i", clipEvaluate_InmapFrom);
@@ -30,13 +30,13 @@ public:
 		struct ClipEvaluate_Outmap{
 			short clipEvaluate_OutmapTo;
 			short clipEvaluate_OutmapFrom;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				fprintf(file,"%i ", clipEvaluate_OutmapTo);
 				fprintf(file,"%i", clipEvaluate_OutmapFrom);
 			}
 		}* clipEvaluate_Outmap;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(clipEvaluate_Inmap)/sizeof(ClipEvaluate_Inmap);
 			for(size_t i=0; i<size; ++i)
@@ -56,7 +56,7 @@ public:
 public:
 
 	Character():ObjectSet(){}
-	Character(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Character(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:ObjectSet(file, name, parent, "character", shared, create){}
 	virtual ~Character(){}
 
@@ -157,11 +157,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".uv[%i:%i]\" ", uv_start,uv_end);
 		size_t size = (uv_end-uv_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",uv[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(uv,size);
 		fprintf(mFile,";\n");
 	}
 	void startUnitlessValues(size_t uv_start,size_t uv_end)const
@@ -185,11 +181,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".lv[%i:%i]\" ", lv_start,lv_end);
 		size_t size = (lv_end-lv_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",lv[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(lv,size);
 		fprintf(mFile,";\n");
 	}
 	void startLinearValues(size_t lv_start,size_t lv_end)const
@@ -213,11 +205,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".av[%i:%i]\" ", av_start,av_end);
 		size_t size = (av_end-av_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",av[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(av,size);
 		fprintf(mFile,";\n");
 	}
 	void startAngularValues(size_t av_start,size_t av_end)const
@@ -241,11 +229,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".tv[%i:%i]\" ", tv_start,tv_end);
 		size_t size = (tv_end-tv_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",tv[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(tv,size);
 		fprintf(mFile,";\n");
 	}
 	void startTimeValues(size_t tv_start,size_t tv_end)const
@@ -363,7 +347,7 @@ public:
 		fprintf(mFile,"\"%s.ofn\"",mName.c_str());
 	}
 protected:
-	Character(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Character(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:ObjectSet(file, name, parent, nodeType, shared, create) {}
 
 };
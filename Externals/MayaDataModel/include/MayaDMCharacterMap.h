@@ -20,7 +20,7 @@ public:
 public:
 
 	CharacterMap():DependNode(){}
-	CharacterMap(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CharacterMap(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "characterMap", shared, create){}
 	virtual ~CharacterMap(){}
 
@@ -66,7 +66,7 @@ public:
 		fprintf(mFile,"\"%s.m\"",mName.c_str());
 	}
 protected:
-	CharacterMap(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CharacterMap(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
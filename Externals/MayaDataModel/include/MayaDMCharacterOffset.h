@@ -20,7 +20,7 @@ public:
 public:
 
 	CharacterOffset():DependNode(){}
-	CharacterOffset(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CharacterOffset(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "characterOffset", shared, create){}
 	virtual ~CharacterOffset(){}
 
@@ -422,7 +422,7 @@ public:
 		fprintf(mFile,"\"%s.rro.rroz\"",mName.c_str());
 	}
 protected:
-	CharacterOffset(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CharacterOffset(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Checker():Texture2d(){}
-	Checker(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Checker(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, "checker", shared, create){}
 	virtual ~Checker(){}
 
@@ -110,7 +110,7 @@ public:
 		fprintf(mFile,"\"%s.ct\"",mName.c_str());
 	}
 protected:
-	Checker(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Checker(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Choice():DependNode(){}
-	Choice(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Choice(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "choice", shared, create){}
 	virtual ~Choice(){}
 
@@ -47,7 +47,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	Choice(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Choice(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
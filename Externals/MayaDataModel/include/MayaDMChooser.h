@@ -20,7 +20,7 @@ public:
 public:
 
 	Chooser():DependNode(){}
-	Chooser(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Chooser(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "chooser", shared, create){}
 	virtual ~Chooser(){}
 
@@ -108,7 +108,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	Chooser(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Chooser(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
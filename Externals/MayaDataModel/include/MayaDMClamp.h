@@ -20,7 +20,7 @@ public:
 public:
 
 	Clamp():DependNode(){}
-	Clamp(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Clamp(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "clamp", shared, create){}
 	virtual ~Clamp(){}
 
@@ -155,7 +155,7 @@ public:
 		fprintf(mFile,"\"%s.op.opb\"",mName.c_str());
 	}
 protected:
-	Clamp(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Clamp(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
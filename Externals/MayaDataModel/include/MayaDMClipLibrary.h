@@ -22,7 +22,7 @@ public:
 			struct ClipEval_Inmap{
 				short clipEval_InmapTo;
 				short clipEval_InmapFrom;
-				void write(FILE* file) const
+				void write(Writer* file) const
 				{
 					fprintf(file,"%i ", clipEval_InmapTo);
 					fprintf(file,"%i", clipEval_InmapFrom);
@@ -31,13 +31,13 @@ public:
 			struct ClipEval_Outmap{
 				short clipEval_OutmapTo;
 				short clipEval_OutmapFrom;
-				void write(FILE* file) const
+				void write(Writer* file) const
 				{
 					fprintf(file,"%i ", clipEval_OutmapTo);
 					fprintf(file,"%i", clipEval_OutmapFrom);
 				}
 			}* clipEval_Outmap;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				size_t size = sizeof(clipEval_Inmap)/sizeof(ClipEval_Inmap);
 				for(size_t i=0; i<size; ++i)
@@ -54,7 +54,7 @@ public:
 				}
 			}
 		}* clipEval;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(clipEval)/sizeof(ClipEval);
 			for(size_t i=0; i<size; ++i)
@@ -66,7 +66,7 @@ public:
 	};
 	struct Characterdata{
 		intArray clipIndexMapping;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			clipIndexMapping.write(file);
 		}
@@ -74,7 +74,7 @@ public:
 public:
 
 	ClipLibrary():DependNode(){}
-	ClipLibrary(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ClipLibrary(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "clipLibrary", shared, create){}
 	virtual ~ClipLibrary(){}
 
@@ -423,7 +423,7 @@ public:
 		fprintf(mFile,"\"%s.cl\"",mName.c_str());
 	}
 protected:
-	ClipLibrary(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ClipLibrary(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -21,7 +21,7 @@ public:
 		struct BlendList_Inmap{
 			short blendList_InmapTo;
 			short blendList_InmapFrom;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				fprintf(file,"%i ", blendList_InmapTo);
 				fprintf(file,"%i", blendList_InmapFrom);
@@ -30,13 +30,13 @@ public:
 		struct BlendList_Outmap{
 			short blendList_OutmapTo;
 			short blendList_OutmapFrom;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				fprintf(file,"%i ", blendList_OutmapTo);
 				fprintf(file,"%i", blendList_OutmapFrom);
 			}
 		}* blendList_Outmap;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(blendList_Inmap)/sizeof(BlendList_Inmap);
 			for(size_t i=0; i<size; ++i)
@@ -56,7 +56,7 @@ public:
 	struct BlendClips{
 		int firstClip;
 		int secondClip;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", firstClip);
 			fprintf(file,"%i", secondClip);
@@ -66,7 +66,7 @@ public:
 		struct ClipFunction_Inmap{
 			short clipFunction_InmapTo;
 			short clipFunction_InmapFrom;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				fprintf(file,"%i ", clipFunction_InmapTo);
 				fprintf(file,"%i", clipFunction_InmapFrom);
@@ -75,13 +75,13 @@ public:
 		struct ClipFunction_Outmap{
 			short clipFunction_OutmapTo;
 			short clipFunction_OutmapFrom;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				fprintf(file,"%i ", clipFunction_OutmapTo);
 				fprintf(file,"%i", clipFunction_OutmapFrom);
 			}
 		}* clipFunction_Outmap;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(clipFunction_Inmap)/sizeof(ClipFunction_Inmap);
 			for(size_t i=0; i<size; ++i)
@@ -101,7 +101,7 @@ public:
 public:
 
 	ClipScheduler():DependNode(){}
-	ClipScheduler(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ClipScheduler(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "clipScheduler", shared, create){}
 	virtual ~ClipScheduler(){}
 
@@ -350,11 +350,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".st[%i:%i]\" ", st_start,st_end);
 		size_t size = (st_end-st_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",st[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(st,size);
 		fprintf(mFile,";\n");
 	}
 	void startStart(size_t st_start,size_t st_end)const
@@ -378,11 +374,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ss[%i:%i]\" ", ss_start,ss_end);
 		size_t size = (ss_end-ss_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",ss[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(ss,size);
 		fprintf(mFile,";\n");
 	}
 	void startSourceStart(size_t ss_start,size_t ss_end)const
@@ -406,11 +398,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".se[%i:%i]\" ", se_start,se_end);
 		size_t size = (se_end-se_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",se[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(se,size);
 		fprintf(mFile,";\n");
 	}
 	void startSourceEnd(size_t se_start,size_t se_end)const
@@ -434,11 +422,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".sc[%i:%i]\" ", sc_start,sc_end);
 		size_t size = (sc_end-sc_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",sc[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(sc,size);
 		fprintf(mFile,";\n");
 	}
 	void startScale(size_t sc_start,size_t sc_end)const
@@ -462,11 +446,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".h[%i:%i]\" ", h_start,h_end);
 		size_t size = (h_end-h_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",h[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(h,size);
 		fprintf(mFile,";\n");
 	}
 	void startHold(size_t h_start,size_t h_end)const
@@ -490,11 +470,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".w[%i:%i]\" ", w_start,w_end);
 		size_t size = (w_end-w_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",w[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(w,size);
 		fprintf(mFile,";\n");
 	}
 	void startWeight(size_t w_start,size_t w_end)const
@@ -546,11 +522,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".cb[%i:%i]\" ", cb_start,cb_end);
 		size_t size = (cb_end-cb_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",cb[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(cb,size);
 		fprintf(mFile,";\n");
 	}
 	void startPreCycle(size_t cb_start,size_t cb_end)const
@@ -574,11 +546,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ca[%i:%i]\" ", ca_start,ca_end);
 		size_t size = (ca_end-ca_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",ca[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(ca,size);
 		fprintf(mFile,";\n");
 	}
 	void startPostCycle(size_t ca_start,size_t ca_end)const
@@ -691,11 +659,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".cy[%i:%i]\" ", cy_start,cy_end);
 		size_t size = (cy_end-cy_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",cy[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(cy,size);
 		fprintf(mFile,";\n");
 	}
 	void startCycle(size_t cy_start,size_t cy_end)const
@@ -954,7 +918,7 @@ public:
 		fprintf(mFile,"\"%s.ar\"",mName.c_str());
 	}
 protected:
-	ClipScheduler(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ClipScheduler(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
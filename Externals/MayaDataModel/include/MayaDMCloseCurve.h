@@ -20,7 +20,7 @@ public:
 public:
 
 	CloseCurve():AbstractBaseCreate(){}
-	CloseCurve(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CloseCurve(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "closeCurve", shared, create){}
 	virtual ~CloseCurve(){}
 
@@ -69,7 +69,7 @@ public:
 		fprintf(mFile,"\"%s.oc\"",mName.c_str());
 	}
 protected:
-	CloseCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CloseCurve(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
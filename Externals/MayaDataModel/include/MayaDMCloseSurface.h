@@ -20,7 +20,7 @@ public:
 public:
 
 	CloseSurface():AbstractBaseCreate(){}
-	CloseSurface(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CloseSurface(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "closeSurface", shared, create){}
 	virtual ~CloseSurface(){}
 
@@ -78,7 +78,7 @@ public:
 		fprintf(mFile,"\"%s.os\"",mName.c_str());
 	}
 protected:
-	CloseSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CloseSurface(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -18,14 +18,14 @@ class ClosestPointOnMesh : public DependNode
 {
 public:
 	struct Result{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	ClosestPointOnMesh():DependNode(){}
-	ClosestPointOnMesh(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ClosestPointOnMesh(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "closestPointOnMesh", shared, create){}
 	virtual ~ClosestPointOnMesh(){}
 
@@ -124,7 +124,7 @@ public:
 		fprintf(mFile,"\"%s.r.vt\"",mName.c_str());
 	}
 protected:
-	ClosestPointOnMesh(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ClosestPointOnMesh(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
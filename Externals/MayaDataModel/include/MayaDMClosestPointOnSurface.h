@@ -18,14 +18,14 @@ class ClosestPointOnSurface : public AbstractBaseCreate
 {
 public:
 	struct Result{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	ClosestPointOnSurface():AbstractBaseCreate(){}
-	ClosestPointOnSurface(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ClosestPointOnSurface(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "closestPointOnSurface", shared, create){}
 	virtual ~ClosestPointOnSurface(){}
 
@@ -100,7 +100,7 @@ public:
 		fprintf(mFile,"\"%s.r.v\"",mName.c_str());
 	}
 protected:
-	ClosestPointOnSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ClosestPointOnSurface(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
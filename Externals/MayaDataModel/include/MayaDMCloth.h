@@ -20,7 +20,7 @@ public:
 public:
 
 	Cloth():Texture2d(){}
-	Cloth(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Cloth(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, "cloth", shared, create){}
 	virtual ~Cloth(){}
 
@@ -202,7 +202,7 @@ public:
 		fprintf(mFile,"\"%s.bs\"",mName.c_str());
 	}
 protected:
-	Cloth(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Cloth(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, nodeType, shared, create) {}
 
 };
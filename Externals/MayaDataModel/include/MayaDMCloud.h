@@ -20,7 +20,7 @@ public:
 public:
 
 	Cloud():Texture3d(){}
-	Cloud(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Cloud(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, "cloud", shared, create){}
 	virtual ~Cloud(){}
 
@@ -292,7 +292,7 @@ public:
 		fprintf(mFile,"\"%s.ra\"",mName.c_str());
 	}
 protected:
-	Cloud(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Cloud(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, nodeType, shared, create) {}
 
 };
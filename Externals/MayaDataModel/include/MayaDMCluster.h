@@ -18,14 +18,14 @@ class Cluster : public WeightGeometryFilter
 {
 public:
 	struct ClusterXforms{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	Cluster():WeightGeometryFilter(){}
-	Cluster(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Cluster(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:WeightGeometryFilter(file, name, parent, "cluster", shared, create){}
 	virtual ~Cluster(){}
 
@@ -164,7 +164,7 @@ public:
 		fprintf(mFile,"\"%s.ait\"",mName.c_str());
 	}
 protected:
-	Cluster(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Cluster(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:WeightGeometryFilter(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -18,14 +18,14 @@ class ClusterHandle : public Shape
 {
 public:
 	struct ClusterTransforms{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	ClusterHandle():Shape(){}
-	ClusterHandle(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ClusterHandle(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Shape(file, name, parent, "clusterHandle", shared, create){}
 	virtual ~ClusterHandle(){}
 
@@ -107,7 +107,7 @@ public:
 		fprintf(mFile,"\"%s.wn\"",mName.c_str());
 	}
 protected:
-	ClusterHandle(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ClusterHandle(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Shape(file, name, parent, nodeType, shared, create) {}
 
 };
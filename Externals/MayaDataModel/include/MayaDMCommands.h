@@ -10,6 +10,8 @@
 #ifndef __MayaDM_COMMANDS_H__
 #define __MayaDM_COMMANDS_H__
 
+#include "MayaDMWriter.h"
+
 namespace MayaDM
 {
 	/** This command parents (moves) objects under a new group, removes
@@ -18,7 +20,7 @@ namespace MayaDM
 	allows a shape that is specified to be directly parented under the
 	given transform. This is used to instance a shape node.
 	*/
-	static void parent ( FILE* file, const std::string& childName, const std::string& parentName = "", 
+	static void parent ( Writer* file, const std::string& childName, const std::string& parentName = "", 
 		bool absolute = false, bool addObject = false, bool noConnections = false, 
 		bool relative = false, bool removeObject = false, bool shape = false, 
 		bool world = false ) 
@@ -44,7 +46,7 @@ namespace MayaDM
 	/** This command parents (moves) shapes under a new group, removes
 	shapes from an existing group, or adds/removes parents.
 	*/
-	static void parentShape ( FILE* file, const std::string& childName, const std::string& parentName = "", 
+	static void parentShape ( Writer* file, const std::string& childName, const std::string& parentName = "", 
 		bool absolute = false, bool addObject = false, bool noConnections = false, 
 		bool relative = false, bool removeObject = false, bool world = false ) 
 	{
@@ -81,7 +83,7 @@ namespace MayaDM
     * Method to add an attribute to a maya node.
     */
     static void addAttr ( 
-        FILE* file, 
+        Writer* file, 
         const std::string& nodeName, 
         const std::string& attributeName, 
         const std::string& flagName,
@@ -97,7 +99,7 @@ namespace MayaDM
      * Method to add an attribute to a maya node.
      */
     static bool addAttr ( 
-        FILE* file, 
+        Writer* file, 
         const std::string& nodeName, 
         const std::string& attributeName, 
         const AttributeFlag& attributeFlag )
@@ -124,7 +126,7 @@ namespace MayaDM
     * Method to add an attribute with one flag to the currently selected maya node.
     */
     static bool addAttr ( 
-        FILE* file, 
+        Writer* file, 
         const std::string& attributeName, 
         const std::string& flagName,
         const std::string& flagValue )
@@ -145,7 +147,7 @@ namespace MayaDM
     * Method to add an attribute to the currently selected maya node.
     */
     static bool addAttr ( 
-        FILE* file, 
+        Writer* file, 
         const std::string& attributeName, 
         const AttributeFlag& attributeFlag )
     {
@@ -170,7 +172,7 @@ namespace MayaDM
     * Method to add an attribute with multiple flags to the currently selected maya node.
     */
     static bool addAttr ( 
-        FILE* file, 
+        Writer* file, 
         const std::string& attributeName, 
         const std::vector<AttributeFlag>& attributeFlags )
     {
@@ -196,7 +198,7 @@ namespace MayaDM
     * Method to set an attribute's value of an maya node.
     */
     static void setAttr ( 
-        FILE* file, 
+        Writer* file, 
         const std::string& nodeName, 
         const std::string& attributeName, 
         const std::string& flagName,
@@ -214,7 +216,7 @@ namespace MayaDM
     * Method to set an attribute's value of the currently selected maya node.
     */
     static void setAttr ( 
-        FILE* file, 
+        Writer* file, 
         const std::string& attributeName, 
         const std::string& flagName,
         const std::string& flagValue, 
@@ -231,7 +233,7 @@ namespace MayaDM
     * Method to set an attribute's value of the currently selected maya node.
     */
     static void setAttr ( 
-        FILE* file, 
+        Writer* file, 
         const std::string& attributeName, 
         const std::vector<AttributeFlag>& attributeFlags, 
         const std::string& attributeValue )
@@ -250,7 +252,7 @@ namespace MayaDM
     }
 
     static void setAttr ( 
-        FILE* file, 
+        Writer* file, 
         const std::string& attributeName, 
         const std::string& flagName,
         const bool flagValue, 
@@ -263,14 +265,14 @@ namespace MayaDM
         fprintf ( file, ";\n" );
     }
 
-    static void startSetAttr ( FILE* file, std::string attributeName, std::string nodeName )
+    static void startSetAttr ( Writer* file, std::string attributeName, std::string nodeName )
     {
         if ( strcmp ( nodeName.c_str(), "" ) == 0 )
             fprintf ( file, "\tsetAttr .%s", attributeName.c_str() );
         else
             fprintf ( file, "setAttr %s.%s", nodeName.c_str(), attributeName.c_str() );
     }
-    static void endSetAttr ( FILE* file )
+    static void endSetAttr ( Writer* file )
     {
         fprintf ( file, ";\n" );
     }
@@ -295,7 +297,7 @@ namespace MayaDM
     * arguments. When using the "-all", "adn/allDependencyNodes" or "-ado/allDagObjects" flags, 
     * only the deletable objects are selected. The non deletable object can still be selected by 
     * explicitly specifying their name as in "select time1;". 
-     * @param FILE* file
+     * @param Writer* file
      * @param const std::string& obj
      * @param bool noExpand Indicates that any set which is among the specified items should not be 
      *          expanded to its list of members. This allows sets to be selected as opposed to the 
@@ -313,11 +315,11 @@ namespace MayaDM
 
     /**
     * Edit the aspect ratio of the camera element.
-    * @param FILE* file The file to write the edit value.
+    * @param Writer* file The file to write the edit value.
     * @param const std::string& name The name of the camera to edit.
     * @param const double aspectRatio The value to set.
     */
-    static void editCameraAspectRatio(FILE* file, const std::string& name, const double aspectRatio)
+    static void editCameraAspectRatio(Writer* file, const std::string& name, const double aspectRatio)
     {                                           
         fprintf(file,"camera -e");
         fprintf(file, " -ar %f", aspectRatio);
@@ -327,11 +329,11 @@ namespace MayaDM
 
     /**
     * Edit the horizontalFieldOfView of the camera element.
-    * @param FILE* file The file to write the edit value.
+    * @param Writer* file The file to write the edit value.
     * @param const std::string& name The name of the camera to edit.
     * @param const double horizontalFieldOfView The value to set.
     */
-    static void editCameraHorizontalFieldOfView(FILE* file, const std::string& name, 
+    static void editCameraHorizontalFieldOfView(Writer* file, const std::string& name, 
         const double horizontalFieldOfView)
     {                                           
         fprintf(file,"camera -e");
@@ -342,11 +344,11 @@ namespace MayaDM
 
     /**
     * Edit the verticalFieldOfView of the camera element.
-    * @param FILE* file The file to write the edit value.
+    * @param Writer* file The file to write the edit value.
     * @param const std::string& name The name of the camera to edit.
     * @param const double verticalFieldOfView The value to set.
     */
-    static void editCameraVerticalFieldOfView(FILE* file, const std::string& name, 
+    static void editCameraVerticalFieldOfView(Writer* file, const std::string& name, 
         const double verticalFieldOfView)
     {                                           
         fprintf(file,"camera -e");
@@ -357,11 +359,11 @@ namespace MayaDM
 
     /**
     * Edit the orthographicWidth of the camera element.
-    * @param FILE* file The file to write the edit value.
+    * @param Writer* file The file to write the edit value.
     * @param const std::string& name The name of the camera to edit.
     * @param const double orthographicWidth The value to set.
     */
-    static void editCameraOrthographicWidth(FILE* file, const std::string& name, 
+    static void editCameraOrthographicWidth(Writer* file, const std::string& name, 
         const double orthographicWidth)
     {                                           
         fprintf(file,"camera -e");
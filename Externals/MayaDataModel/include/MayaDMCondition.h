@@ -20,7 +20,7 @@ public:
 public:
 
 	Condition():DependNode(){}
-	Condition(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Condition(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "condition", shared, create){}
 	virtual ~Condition(){}
 
@@ -144,7 +144,7 @@ public:
 		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
 	}
 protected:
-	Condition(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Condition(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Constraint():Transform(){}
-	Constraint(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Constraint(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Transform(file, name, parent, "constraint", shared, create){}
 	virtual ~Constraint(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.lo\"",mName.c_str());
 	}
 protected:
-	Constraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Constraint(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Transform(file, name, parent, nodeType, shared, create) {}
 
 };
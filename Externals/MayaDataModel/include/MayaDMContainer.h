@@ -20,7 +20,7 @@ public:
 public:
 
 	Container():DependNode(){}
-	Container(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Container(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "container", shared, create){}
 	virtual ~Container(){}
 
@@ -38,7 +38,7 @@ public:
 		fprintf(mFile,"\"%s.isc\"",mName.c_str());
 	}
 protected:
-	Container(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Container(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Contrast():DependNode(){}
-	Contrast(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Contrast(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "contrast", shared, create){}
 	virtual ~Contrast(){}
 
@@ -155,7 +155,7 @@ public:
 		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
 	}
 protected:
-	Contrast(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Contrast(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 	struct UvSet{
 		string uvSetName;
 		float2* uvSetPoints;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			uvSetName.write(file);
 			fprintf(file, " ");
@@ -42,7 +42,7 @@ public:
 			float colorSetPointsG;
 			float colorSetPointsB;
 			float colorSetPointsA;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				fprintf(file,"%f ", colorSetPointsR);
 				fprintf(file,"%f ", colorSetPointsG);
@@ -50,7 +50,7 @@ public:
 				fprintf(file,"%f", colorSetPointsA);
 			}
 		}* colorSetPoints;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			colorName.write(file);
 			fprintf(file, " ");
@@ -67,7 +67,7 @@ public:
 public:
 
 	ControlPoint():DeformableShape(){}
-	ControlPoint(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ControlPoint(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DeformableShape(file, name, parent, "controlPoint", shared, create){}
 	virtual ~ControlPoint(){}
 
@@ -91,11 +91,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".cp[%i:%i]\" ", cp_start,cp_end);
 		size_t size = (cp_end-cp_start)*3+3;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",cp[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(cp,size);
 		fprintf(mFile,";\n");
 	}
 	void startControlPoints(size_t cp_start,size_t cp_end)const
@@ -173,11 +169,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".uvst[%i].uvsp[%i:%i]\" ", uvst_i,uvsp_start,uvsp_end);
 		size_t size = (uvsp_end-uvsp_start)*2+2;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",uvsp[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(uvsp,size);
 		fprintf(mFile,";\n");
 	}
 	void startUvSetPoints(size_t uvst_i,size_t uvsp_start,size_t uvsp_end)const
@@ -188,6 +180,12 @@ public:
 	{
 		fprintf(mFile," %f",uvsp);
 	}
+	void appendUvSetPoints(const float* uvsp,size_t count)const
+	{
+		if(count == 0) return;
+		fprintf(mFile," ");
+		mFile->writeFloatArray(uvsp,count);
+	}
 	void endUvSetPoints()const
 	{
 		fprintf(mFile,";\n");
@@ -558,7 +556,7 @@ public:
 		fprintf(mFile,"\"%s.clst.clsp[%i].clpa\"",mName.c_str(),clsp_i);
 	}
 protected:
-	ControlPoint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ControlPoint(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DeformableShape(file, name, parent, nodeType, shared, create) {}
 
 };
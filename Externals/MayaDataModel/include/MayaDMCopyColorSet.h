@@ -20,7 +20,7 @@ public:
 public:
 
 	CopyColorSet():DependNode(){}
-	CopyColorSet(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CopyColorSet(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "copyColorSet", shared, create){}
 	virtual ~CopyColorSet(){}
 
@@ -55,7 +55,7 @@ public:
 		fprintf(mFile,"\"%s.dst\"",mName.c_str());
 	}
 protected:
-	CopyColorSet(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CopyColorSet(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
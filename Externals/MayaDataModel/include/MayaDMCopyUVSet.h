@@ -20,7 +20,7 @@ public:
 public:
 
 	CopyUVSet():DependNode(){}
-	CopyUVSet(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CopyUVSet(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "copyUVSet", shared, create){}
 	virtual ~CopyUVSet(){}
 
@@ -55,7 +55,7 @@ public:
 		fprintf(mFile,"\"%s.uv2\"",mName.c_str());
 	}
 protected:
-	CopyUVSet(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CopyUVSet(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Crater():Texture3d(){}
-	Crater(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Crater(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, "crater", shared, create){}
 	virtual ~Crater(){}
 
@@ -275,7 +275,7 @@ public:
 		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
 	}
 protected:
-	Crater(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Crater(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, nodeType, shared, create) {}
 
 };
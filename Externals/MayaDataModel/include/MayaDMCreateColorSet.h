@@ -20,7 +20,7 @@ public:
 public:
 
 	CreateColorSet():DependNode(){}
-	CreateColorSet(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CreateColorSet(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "createColorSet", shared, create){}
 	virtual ~CreateColorSet(){}
 
@@ -62,7 +62,7 @@ public:
 		fprintf(mFile,"\"%s.rprt\"",mName.c_str());
 	}
 protected:
-	CreateColorSet(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CreateColorSet(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	CreateUVSet():DependNode(){}
-	CreateUVSet(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CreateUVSet(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "createUVSet", shared, create){}
 	virtual ~CreateUVSet(){}
 
@@ -44,7 +44,7 @@ public:
 		fprintf(mFile,"\"%s.uvs\"",mName.c_str());
 	}
 protected:
-	CreateUVSet(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CreateUVSet(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
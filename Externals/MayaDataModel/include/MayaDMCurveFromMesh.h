@@ -20,7 +20,7 @@ public:
 public:
 
 	CurveFromMesh():DependNode(){}
-	CurveFromMesh(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CurveFromMesh(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "curveFromMesh", shared, create){}
 	virtual ~CurveFromMesh(){}
 
@@ -33,7 +33,7 @@ public:
 		fprintf(mFile,"\"%s.oc\"",mName.c_str());
 	}
 protected:
-	CurveFromMesh(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CurveFromMesh(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
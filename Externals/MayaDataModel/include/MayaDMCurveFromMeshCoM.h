@@ -20,7 +20,7 @@ public:
 public:
 
 	CurveFromMeshCoM():CurveFromMesh(){}
-	CurveFromMeshCoM(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CurveFromMeshCoM(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:CurveFromMesh(file, name, parent, "curveFromMeshCoM", shared, create){}
 	virtual ~CurveFromMeshCoM(){}
 
@@ -29,7 +29,7 @@ public:
 		fprintf(mFile,"\"%s.com\"",mName.c_str());
 	}
 protected:
-	CurveFromMeshCoM(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CurveFromMeshCoM(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:CurveFromMesh(file, name, parent, nodeType, shared, create) {}
 
 };
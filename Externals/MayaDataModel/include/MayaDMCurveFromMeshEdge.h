@@ -20,7 +20,7 @@ public:
 public:
 
 	CurveFromMeshEdge():CurveFromMesh(){}
-	CurveFromMeshEdge(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CurveFromMeshEdge(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:CurveFromMesh(file, name, parent, "curveFromMeshEdge", shared, create){}
 	virtual ~CurveFromMeshEdge(){}
 
@@ -33,11 +33,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ei[%i:%i]\" ", ei_start,ei_end);
 		size_t size = (ei_end-ei_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",ei[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(ei,size);
 		fprintf(mFile,";\n");
 	}
 	void startEdgeIndex(size_t ei_start,size_t ei_end)const
@@ -62,7 +58,7 @@ public:
 		fprintf(mFile,"\"%s.ei\"",mName.c_str());
 	}
 protected:
-	CurveFromMeshEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CurveFromMeshEdge(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:CurveFromMesh(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	CurveFromSubdiv():CurveRange(){}
-	CurveFromSubdiv(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CurveFromSubdiv(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:CurveRange(file, name, parent, "curveFromSubdiv", shared, create){}
 	virtual ~CurveFromSubdiv(){}
 
@@ -60,7 +60,7 @@ public:
 		fprintf(mFile,"\"%s.oc\"",mName.c_str());
 	}
 protected:
-	CurveFromSubdiv(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CurveFromSubdiv(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:CurveRange(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	CurveFromSubdivEdge():CurveFromSubdiv(){}
-	CurveFromSubdivEdge(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CurveFromSubdivEdge(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:CurveFromSubdiv(file, name, parent, "curveFromSubdivEdge", shared, create){}
 	virtual ~CurveFromSubdivEdge(){}
 
@@ -33,11 +33,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".eil[%i:%i]\" ", eil_start,eil_end);
 		size_t size = (eil_end-eil_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",eil[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(eil,size);
 		fprintf(mFile,";\n");
 	}
 	void startEdgeIndexL(size_t eil_start,size_t eil_end)const
@@ -61,11 +57,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".eir[%i:%i]\" ", eir_start,eir_end);
 		size_t size = (eir_end-eir_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",eir[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(eir,size);
 		fprintf(mFile,";\n");
 	}
 	void startEdgeIndexR(size_t eir_start,size_t eir_end)const
@@ -99,7 +91,7 @@ public:
 		fprintf(mFile,"\"%s.eir\"",mName.c_str());
 	}
 protected:
-	CurveFromSubdivEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CurveFromSubdivEdge(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:CurveFromSubdiv(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	CurveFromSubdivFace():CurveFromSubdiv(){}
-	CurveFromSubdivFace(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CurveFromSubdivFace(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:CurveFromSubdiv(file, name, parent, "curveFromSubdivFace", shared, create){}
 	virtual ~CurveFromSubdivFace(){}
 
@@ -33,11 +33,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".fil[%i:%i]\" ", fil_start,fil_end);
 		size_t size = (fil_end-fil_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",fil[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(fil,size);
 		fprintf(mFile,";\n");
 	}
 	void startFaceIndexL(size_t fil_start,size_t fil_end)const
@@ -61,11 +57,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".fir[%i:%i]\" ", fir_start,fir_end);
 		size_t size = (fir_end-fir_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",fir[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(fir,size);
 		fprintf(mFile,";\n");
 	}
 	void startFaceIndexR(size_t fir_start,size_t fir_end)const
@@ -99,7 +91,7 @@ public:
 		fprintf(mFile,"\"%s.fir\"",mName.c_str());
 	}
 protected:
-	CurveFromSubdivFace(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CurveFromSubdivFace(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:CurveFromSubdiv(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	CurveFromSurface():CurveRange(){}
-	CurveFromSurface(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CurveFromSurface(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:CurveRange(file, name, parent, "curveFromSurface", shared, create){}
 	virtual ~CurveFromSurface(){}
 
@@ -60,7 +60,7 @@ public:
 		fprintf(mFile,"\"%s.oc\"",mName.c_str());
 	}
 protected:
-	CurveFromSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CurveFromSurface(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:CurveRange(file, name, parent, nodeType, shared, create) {}
 
 };
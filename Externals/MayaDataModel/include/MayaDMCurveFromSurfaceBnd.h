@@ -20,7 +20,7 @@ public:
 public:
 
 	CurveFromSurfaceBnd():CurveFromSurface(){}
-	CurveFromSurfaceBnd(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CurveFromSurfaceBnd(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:CurveFromSurface(file, name, parent, "curveFromSurfaceBnd", shared, create){}
 	virtual ~CurveFromSurfaceBnd(){}
 
@@ -52,7 +52,7 @@ public:
 		fprintf(mFile,"\"%s.e\"",mName.c_str());
 	}
 protected:
-	CurveFromSurfaceBnd(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CurveFromSurfaceBnd(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:CurveFromSurface(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	CurveFromSurfaceCoS():CurveFromSurface(){}
-	CurveFromSurfaceCoS(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CurveFromSurfaceCoS(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:CurveFromSurface(file, name, parent, "curveFromSurfaceCoS", shared, create){}
 	virtual ~CurveFromSurfaceCoS(){}
 
@@ -29,7 +29,7 @@ public:
 		fprintf(mFile,"\"%s.cos\"",mName.c_str());
 	}
 protected:
-	CurveFromSurfaceCoS(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CurveFromSurfaceCoS(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:CurveFromSurface(file, name, parent, nodeType, shared, create) {}
 
 };
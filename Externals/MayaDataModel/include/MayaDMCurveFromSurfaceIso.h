@@ -20,7 +20,7 @@ public:
 public:
 
 	CurveFromSurfaceIso():CurveFromSurface(){}
-	CurveFromSurfaceIso(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CurveFromSurfaceIso(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:CurveFromSurface(file, name, parent, "curveFromSurfaceIso", shared, create){}
 	virtual ~CurveFromSurfaceIso(){}
 
@@ -52,7 +52,7 @@ public:
 		fprintf(mFile,"\"%s.rv\"",mName.c_str());
 	}
 protected:
-	CurveFromSurfaceIso(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CurveFromSurfaceIso(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:CurveFromSurface(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	CurveInfo():AbstractBaseCreate(){}
-	CurveInfo(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CurveInfo(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "curveInfo", shared, create){}
 	virtual ~CurveInfo(){}
 
@@ -87,7 +87,7 @@ public:
 		fprintf(mFile,"\"%s.kn\"",mName.c_str());
 	}
 protected:
-	CurveInfo(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CurveInfo(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
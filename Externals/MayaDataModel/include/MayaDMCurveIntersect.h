@@ -20,7 +20,7 @@ public:
 public:
 
 	CurveIntersect():AbstractBaseCreate(){}
-	CurveIntersect(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CurveIntersect(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "curveIntersect", shared, create){}
 	virtual ~CurveIntersect(){}
 
@@ -106,7 +106,7 @@ public:
 		fprintf(mFile,"\"%s.p2\"",mName.c_str());
 	}
 protected:
-	CurveIntersect(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CurveIntersect(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	CurveNormalizer():DependNode(){}
-	CurveNormalizer(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CurveNormalizer(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "curveNormalizer", shared, create){}
 	virtual ~CurveNormalizer(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.sc\"",mName.c_str());
 	}
 protected:
-	CurveNormalizer(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CurveNormalizer(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
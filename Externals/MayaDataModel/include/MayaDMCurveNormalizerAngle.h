@@ -20,7 +20,7 @@ public:
 public:
 
 	CurveNormalizerAngle():CurveNormalizer(){}
-	CurveNormalizerAngle(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CurveNormalizerAngle(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:CurveNormalizer(file, name, parent, "curveNormalizerAngle", shared, create){}
 	virtual ~CurveNormalizerAngle(){}
 
@@ -38,7 +38,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	CurveNormalizerAngle(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CurveNormalizerAngle(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:CurveNormalizer(file, name, parent, nodeType, shared, create) {}
 
 };
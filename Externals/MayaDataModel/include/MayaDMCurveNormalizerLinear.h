@@ -20,7 +20,7 @@ public:
 public:
 
 	CurveNormalizerLinear():CurveNormalizer(){}
-	CurveNormalizerLinear(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CurveNormalizerLinear(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:CurveNormalizer(file, name, parent, "curveNormalizerLinear", shared, create){}
 	virtual ~CurveNormalizerLinear(){}
 
@@ -38,7 +38,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	CurveNormalizerLinear(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CurveNormalizerLinear(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:CurveNormalizer(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -19,12 +19,12 @@ class CurveShape : public ControlPoint
 public:
 
 	CurveShape():ControlPoint(){}
-	CurveShape(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CurveShape(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:ControlPoint(file, name, parent, "curveShape", shared, create){}
 	virtual ~CurveShape(){}
 
 protected:
-	CurveShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CurveShape(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:ControlPoint(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	CurveVarGroup():BaseGeometryVarGroup(){}
-	CurveVarGroup(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	CurveVarGroup(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:BaseGeometryVarGroup(file, name, parent, "curveVarGroup", shared, create){}
 	virtual ~CurveVarGroup(){}
 
@@ -52,7 +52,7 @@ public:
 		fprintf(mFile,"\"%s.ds\"",mName.c_str());
 	}
 protected:
-	CurveVarGroup(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	CurveVarGroup(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:BaseGeometryVarGroup(file, name, parent, nodeType, shared, create) {}
 
 };
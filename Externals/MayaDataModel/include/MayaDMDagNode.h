@@ -18,7 +18,7 @@ class DagNode : public Entity
 {
 public:
 	struct BoundingBox{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
@@ -27,7 +27,7 @@ public:
 			componentList objectGrpCompList;
 			int objectGroupId;
 			short objectGrpColor;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				objectGrpCompList.write(file);
 				fprintf(file, " ");
@@ -35,7 +35,7 @@ public:
 				fprintf(file,"%i", objectGrpColor);
 			}
 		}* objectGroups;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(objectGroups)/sizeof(ObjectGroups);
 			for(size_t i=0; i<size; ++i)
@@ -54,7 +54,7 @@ public:
 		bool overrideEnabled;
 		bool overrideVisibility;
 		unsigned char overrideColor;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", overrideDisplayType);
 			fprintf(file,"%i ", overrideLevelOfDetail);
@@ -70,7 +70,7 @@ public:
 		short identification;
 		bool layerRenderable;
 		unsigned char layerOverrideColor;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", identification);
 			fprintf(file,"%i ", layerRenderable);
@@ -81,7 +81,7 @@ public:
 		short renderLayerId;
 		bool renderLayerRenderable;
 		unsigned char renderLayerColor;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", renderLayerId);
 			fprintf(file,"%i ", renderLayerRenderable);
@@ -92,7 +92,7 @@ public:
 		int ghostPreSteps;
 		int ghostPostSteps;
 		int ghostStepSize;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", ghostPreSteps);
 			fprintf(file,"%i ", ghostPostSteps);
@@ -102,7 +102,7 @@ public:
 public:
 
 	DagNode():Entity(){}
-	DagNode(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DagNode(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Entity(file, name, parent, "dagNode", shared, create){}
 	virtual ~DagNode(){}
 
@@ -676,7 +676,7 @@ public:
 		fprintf(mFile,"\"%s.gdr\"",mName.c_str());
 	}
 protected:
-	DagNode(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DagNode(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Entity(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	DagPose():DependNode(){}
-	DagPose(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DagPose(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "dagPose", shared, create){}
 	virtual ~DagPose(){}
 
@@ -153,7 +153,7 @@ public:
 		fprintf(mFile,"\"%s.w\"",mName.c_str());
 	}
 protected:
-	DagPose(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DagPose(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
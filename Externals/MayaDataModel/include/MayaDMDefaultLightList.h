@@ -20,7 +20,7 @@ public:
 public:
 
 	DefaultLightList():DependNode(){}
-	DefaultLightList(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DefaultLightList(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "defaultLightList", shared, create){}
 	virtual ~DefaultLightList(){}
 
@@ -220,7 +220,7 @@ public:
 		fprintf(mFile,"\"%s.ltd.lbdo\"",mName.c_str());
 	}
 protected:
-	DefaultLightList(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DefaultLightList(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
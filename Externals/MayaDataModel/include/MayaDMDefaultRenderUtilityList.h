@@ -20,7 +20,7 @@ public:
 public:
 
 	DefaultRenderUtilityList():DependNode(){}
-	DefaultRenderUtilityList(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DefaultRenderUtilityList(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "defaultRenderUtilityList", shared, create){}
 	virtual ~DefaultRenderUtilityList(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.u\"",mName.c_str());
 	}
 protected:
-	DefaultRenderUtilityList(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DefaultRenderUtilityList(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
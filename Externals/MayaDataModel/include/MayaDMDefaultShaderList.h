@@ -20,7 +20,7 @@ public:
 public:
 
 	DefaultShaderList():DependNode(){}
-	DefaultShaderList(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DefaultShaderList(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "defaultShaderList", shared, create){}
 	virtual ~DefaultShaderList(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.s\"",mName.c_str());
 	}
 protected:
-	DefaultShaderList(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DefaultShaderList(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
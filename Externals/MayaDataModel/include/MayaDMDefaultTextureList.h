@@ -20,7 +20,7 @@ public:
 public:
 
 	DefaultTextureList():DependNode(){}
-	DefaultTextureList(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DefaultTextureList(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "defaultTextureList", shared, create){}
 	virtual ~DefaultTextureList(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.tx\"",mName.c_str());
 	}
 protected:
-	DefaultTextureList(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DefaultTextureList(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
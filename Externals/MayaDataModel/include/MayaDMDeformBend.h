@@ -20,7 +20,7 @@ public:
 public:
 
 	DeformBend():DeformFunc(){}
-	DeformBend(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DeformBend(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DeformFunc(file, name, parent, "deformBend", shared, create){}
 	virtual ~DeformBend(){}
 
@@ -52,7 +52,7 @@ public:
 		fprintf(mFile,"\"%s.cur\"",mName.c_str());
 	}
 protected:
-	DeformBend(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DeformBend(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DeformFunc(file, name, parent, nodeType, shared, create) {}
 
 };
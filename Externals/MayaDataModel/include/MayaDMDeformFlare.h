@@ -20,7 +20,7 @@ public:
 public:
 
 	DeformFlare():DeformFunc(){}
-	DeformFlare(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DeformFlare(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DeformFunc(file, name, parent, "deformFlare", shared, create){}
 	virtual ~DeformFlare(){}
 
@@ -88,7 +88,7 @@ public:
 		fprintf(mFile,"\"%s.crv\"",mName.c_str());
 	}
 protected:
-	DeformFlare(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DeformFlare(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DeformFunc(file, name, parent, nodeType, shared, create) {}
 
 };
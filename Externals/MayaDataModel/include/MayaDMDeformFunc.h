@@ -20,7 +20,7 @@ public:
 public:
 
 	DeformFunc():Shape(){}
-	DeformFunc(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DeformFunc(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Shape(file, name, parent, "deformFunc", shared, create){}
 	virtual ~DeformFunc(){}
 
@@ -45,7 +45,7 @@ public:
 		fprintf(mFile,"\"%s.hw\"",mName.c_str());
 	}
 protected:
-	DeformFunc(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DeformFunc(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Shape(file, name, parent, nodeType, shared, create) {}
 
 };
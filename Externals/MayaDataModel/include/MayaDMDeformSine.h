@@ -20,7 +20,7 @@ public:
 public:
 
 	DeformSine():DeformFunc(){}
-	DeformSine(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DeformSine(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DeformFunc(file, name, parent, "deformSine", shared, create){}
 	virtual ~DeformSine(){}
 
@@ -79,7 +79,7 @@ public:
 		fprintf(mFile,"\"%s.off\"",mName.c_str());
 	}
 protected:
-	DeformSine(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DeformSine(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DeformFunc(file, name, parent, nodeType, shared, create) {}
 
 };
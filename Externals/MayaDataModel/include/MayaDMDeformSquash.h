@@ -20,7 +20,7 @@ public:
 public:
 
 	DeformSquash():DeformFunc(){}
-	DeformSquash(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DeformSquash(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DeformFunc(file, name, parent, "deformSquash", shared, create){}
 	virtual ~DeformSquash(){}
 
@@ -88,7 +88,7 @@ public:
 		fprintf(mFile,"\"%s.fac\"",mName.c_str());
 	}
 protected:
-	DeformSquash(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DeformSquash(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DeformFunc(file, name, parent, nodeType, shared, create) {}
 
 };
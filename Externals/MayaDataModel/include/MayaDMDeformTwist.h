@@ -20,7 +20,7 @@ public:
 public:
 
 	DeformTwist():DeformFunc(){}
-	DeformTwist(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DeformTwist(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DeformFunc(file, name, parent, "deformTwist", shared, create){}
 	virtual ~DeformTwist(){}
 
@@ -61,7 +61,7 @@ public:
 		fprintf(mFile,"\"%s.ea\"",mName.c_str());
 	}
 protected:
-	DeformTwist(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DeformTwist(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DeformFunc(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	DeformWave():DeformFunc(){}
-	DeformWave(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DeformWave(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DeformFunc(file, name, parent, "deformWave", shared, create){}
 	virtual ~DeformWave(){}
 
@@ -88,7 +88,7 @@ public:
 		fprintf(mFile,"\"%s.off\"",mName.c_str());
 	}
 protected:
-	DeformWave(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DeformWave(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DeformFunc(file, name, parent, nodeType, shared, create) {}
 
 };
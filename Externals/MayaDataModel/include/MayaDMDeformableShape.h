@@ -19,12 +19,12 @@ class DeformableShape : public GeometryShape
 public:
 
 	DeformableShape():GeometryShape(){}
-	DeformableShape(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DeformableShape(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryShape(file, name, parent, "deformableShape", shared, create){}
 	virtual ~DeformableShape(){}
 
 protected:
-	DeformableShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DeformableShape(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryShape(file, name, parent, nodeType, shared, create) {}
 
 };
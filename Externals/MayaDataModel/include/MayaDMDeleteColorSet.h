@@ -20,7 +20,7 @@ public:
 public:
 
 	DeleteColorSet():DependNode(){}
-	DeleteColorSet(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DeleteColorSet(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "deleteColorSet", shared, create){}
 	virtual ~DeleteColorSet(){}
 
@@ -44,7 +44,7 @@ public:
 		fprintf(mFile,"\"%s.cols\"",mName.c_str());
 	}
 protected:
-	DeleteColorSet(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DeleteColorSet(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
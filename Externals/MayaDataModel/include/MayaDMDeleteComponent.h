@@ -20,7 +20,7 @@ public:
 public:
 
 	DeleteComponent():DependNode(){}
-	DeleteComponent(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DeleteComponent(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "deleteComponent", shared, create){}
 	virtual ~DeleteComponent(){}
 
@@ -48,7 +48,7 @@ public:
 		fprintf(mFile,"\"%s.og\"",mName.c_str());
 	}
 protected:
-	DeleteComponent(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DeleteComponent(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
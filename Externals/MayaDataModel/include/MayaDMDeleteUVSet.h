@@ -20,7 +20,7 @@ public:
 public:
 
 	DeleteUVSet():DependNode(){}
-	DeleteUVSet(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DeleteUVSet(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "deleteUVSet", shared, create){}
 	virtual ~DeleteUVSet(){}
 
@@ -44,7 +44,7 @@ public:
 		fprintf(mFile,"\"%s.uvs\"",mName.c_str());
 	}
 protected:
-	DeleteUVSet(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DeleteUVSet(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
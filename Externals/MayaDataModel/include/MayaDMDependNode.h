@@ -18,7 +18,7 @@ class DependNode
 public:
 public:
 protected:
-	FILE* mFile;
+	Writer* mFile;
 	std::string mName;
 	std::string mParent;
 	std::string mNodeType;
@@ -40,7 +40,7 @@ public:
 	{
 		return mNodeType;
 	}
-	void setFile(FILE* file)
+	void setFile(Writer* file)
 	{
 		mFile = file;
 	}
@@ -100,7 +100,7 @@ public:
 		fprintf(mFile,"\"%s.nds\"",mName.c_str());
 	}
 protected:
-	DependNode(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DependNode(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:mFile(file), mName(name), mParent(parent), mNodeType(nodeType), mShared(shared) 
 	{
 		if(create)
@@ -20,7 +20,7 @@ public:
 public:
 
 	DetachCurve():AbstractBaseCreate(){}
-	DetachCurve(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DetachCurve(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "detachCurve", shared, create){}
 	virtual ~DetachCurve(){}
 
@@ -33,11 +33,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".p[%i:%i]\" ", p_start,p_end);
 		size_t size = (p_end-p_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",p[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(p,size);
 		fprintf(mFile,";\n");
 	}
 	void startParameter(size_t p_start,size_t p_end)const
@@ -112,7 +108,7 @@ public:
 		fprintf(mFile,"\"%s.k\"",mName.c_str());
 	}
 protected:
-	DetachCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DetachCurve(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -19,12 +19,12 @@ class DimensionShape : public Shape
 public:
 
 	DimensionShape():Shape(){}
-	DimensionShape(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DimensionShape(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Shape(file, name, parent, "dimensionShape", shared, create){}
 	virtual ~DimensionShape(){}
 
 protected:
-	DimensionShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DimensionShape(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Shape(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -19,12 +19,12 @@ class DirectedDisc : public GeometryShape
 public:
 
 	DirectedDisc():GeometryShape(){}
-	DirectedDisc(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DirectedDisc(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryShape(file, name, parent, "directedDisc", shared, create){}
 	virtual ~DirectedDisc(){}
 
 protected:
-	DirectedDisc(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DirectedDisc(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryShape(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -38,7 +38,7 @@ public:
 		short smapDetailSamples;
 		float smapDetailAccuracy;
 		bool smapDetailAlpha;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", miExportMrLight);
 			fprintf(file,"%i ", emitPhotons);
@@ -67,7 +67,7 @@ public:
 public:
 
 	DirectionalLight():NonExtendedLightShapeNode(){}
-	DirectionalLight(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DirectionalLight(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:NonExtendedLightShapeNode(file, name, parent, "directionalLight", shared, create){}
 	virtual ~DirectionalLight(){}
 
@@ -369,7 +369,7 @@ public:
 		fprintf(mFile,"\"%s.mrc.sdal\"",mName.c_str());
 	}
 protected:
-	DirectionalLight(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DirectionalLight(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:NonExtendedLightShapeNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	DiskCache():DependNode(){}
-	DiskCache(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DiskCache(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "diskCache", shared, create){}
 	virtual ~DiskCache(){}
 
@@ -96,7 +96,7 @@ public:
 		fprintf(mFile,"\"%s.cpl\"",mName.c_str());
 	}
 protected:
-	DiskCache(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DiskCache(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
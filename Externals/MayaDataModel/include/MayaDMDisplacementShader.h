@@ -20,7 +20,7 @@ public:
 public:
 
 	DisplacementShader():DependNode(){}
-	DisplacementShader(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DisplacementShader(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "displacementShader", shared, create){}
 	virtual ~DisplacementShader(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.d\"",mName.c_str());
 	}
 protected:
-	DisplacementShader(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DisplacementShader(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -26,7 +26,7 @@ public:
 		bool enabled;
 		bool visibility;
 		unsigned char color;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", displayType);
 			fprintf(file,"%i ", levelOfDetail);
@@ -41,7 +41,7 @@ public:
 public:
 
 	DisplayLayer():DependNode(){}
-	DisplayLayer(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DisplayLayer(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "displayLayer", shared, create){}
 	virtual ~DisplayLayer(){}
 
@@ -146,7 +146,7 @@ public:
 		fprintf(mFile,"\"%s.do\"",mName.c_str());
 	}
 protected:
-	DisplayLayer(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DisplayLayer(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
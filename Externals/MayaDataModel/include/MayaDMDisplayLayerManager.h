@@ -20,7 +20,7 @@ public:
 public:
 
 	DisplayLayerManager():DependNode(){}
-	DisplayLayerManager(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DisplayLayerManager(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "displayLayerManager", shared, create){}
 	virtual ~DisplayLayerManager(){}
 
@@ -71,7 +71,7 @@ public:
 		fprintf(mFile,"\"%s.dli\"",mName.c_str());
 	}
 protected:
-	DisplayLayerManager(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DisplayLayerManager(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	DistanceBetween():DependNode(){}
-	DistanceBetween(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DistanceBetween(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "distanceBetween", shared, create){}
 	virtual ~DistanceBetween(){}
 
@@ -125,7 +125,7 @@ public:
 		fprintf(mFile,"\"%s.d\"",mName.c_str());
 	}
 protected:
-	DistanceBetween(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DistanceBetween(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
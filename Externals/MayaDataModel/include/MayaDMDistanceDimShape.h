@@ -20,7 +20,7 @@ public:
 public:
 
 	DistanceDimShape():DimensionShape(){}
-	DistanceDimShape(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DistanceDimShape(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DimensionShape(file, name, parent, "distanceDimShape", shared, create){}
 	virtual ~DistanceDimShape(){}
 
@@ -103,7 +103,7 @@ public:
 		fprintf(mFile,"\"%s.dist\"",mName.c_str());
 	}
 protected:
-	DistanceDimShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DistanceDimShape(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DimensionShape(file, name, parent, nodeType, shared, create) {}
 
 };
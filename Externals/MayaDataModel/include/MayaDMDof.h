@@ -19,12 +19,12 @@ class Dof : public DependNode
 public:
 
 	Dof():DependNode(){}
-	Dof(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Dof(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "dof", shared, create){}
 	virtual ~Dof(){}
 
 protected:
-	Dof(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Dof(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -19,7 +19,7 @@ class DoubleShadingSwitch : public BaseShadingSwitch
 public:
 	struct Input{
 		float2 inDouble;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			inDouble.write(file);
 			fprintf(file, " ");
@@ -28,7 +28,7 @@ public:
 public:
 
 	DoubleShadingSwitch():BaseShadingSwitch(){}
-	DoubleShadingSwitch(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DoubleShadingSwitch(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:BaseShadingSwitch(file, name, parent, "doubleShadingSwitch", shared, create){}
 	virtual ~DoubleShadingSwitch(){}
 
@@ -166,7 +166,7 @@ public:
 		fprintf(mFile,"\"%s.out.oc2\"",mName.c_str());
 	}
 protected:
-	DoubleShadingSwitch(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DoubleShadingSwitch(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:BaseShadingSwitch(file, name, parent, nodeType, shared, create) {}
 
 };
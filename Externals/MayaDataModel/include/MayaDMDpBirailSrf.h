@@ -20,7 +20,7 @@ public:
 public:
 
 	DpBirailSrf():BirailSrf(){}
-	DpBirailSrf(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DpBirailSrf(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:BirailSrf(file, name, parent, "dpBirailSrf", shared, create){}
 	virtual ~DpBirailSrf(){}
 
@@ -60,7 +60,7 @@ public:
 		fprintf(mFile,"\"%s.tp2\"",mName.c_str());
 	}
 protected:
-	DpBirailSrf(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DpBirailSrf(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:BirailSrf(file, name, parent, nodeType, shared, create) {}
 
 };
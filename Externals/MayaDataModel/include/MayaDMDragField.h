@@ -21,7 +21,7 @@ public:
 		double directionX;
 		double directionY;
 		double directionZ;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", directionX);
 			fprintf(file,"%f ", directionY);
@@ -31,7 +31,7 @@ public:
 public:
 
 	DragField():Field(){}
-	DragField(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DragField(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Field(file, name, parent, "dragField", shared, create){}
 	virtual ~DragField(){}
 
@@ -113,7 +113,7 @@ public:
 		fprintf(mFile,"\"%s.cti\"",mName.c_str());
 	}
 protected:
-	DragField(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DragField(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Field(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	DropoffLocator():Locator(){}
-	DropoffLocator(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DropoffLocator(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Locator(file, name, parent, "dropoffLocator", shared, create){}
 	virtual ~DropoffLocator(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.pr\"",mName.c_str());
 	}
 protected:
-	DropoffLocator(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DropoffLocator(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Locator(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	DynBase():Transform(){}
-	DynBase(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DynBase(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Transform(file, name, parent, "dynBase", shared, create){}
 	virtual ~DynBase(){}
 
@@ -75,7 +75,7 @@ public:
 		fprintf(mFile,"\"%s.ovd\"",mName.c_str());
 	}
 protected:
-	DynBase(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DynBase(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Transform(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	DynGlobals():DependNode(){}
-	DynGlobals(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DynGlobals(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "dynGlobals", shared, create){}
 	virtual ~DynGlobals(){}
 
@@ -90,7 +90,7 @@ public:
 		fprintf(mFile,"\"%s.mxf\"",mName.c_str());
 	}
 protected:
-	DynGlobals(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DynGlobals(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
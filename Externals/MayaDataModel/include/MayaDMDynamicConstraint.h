@@ -21,7 +21,7 @@ public:
 		float connectionDensityRange_Position;
 		float connectionDensityRange_FloatValue;
 		unsigned int connectionDensityRange_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", connectionDensityRange_Position);
 			fprintf(file,"%f ", connectionDensityRange_FloatValue);
@@ -32,7 +32,7 @@ public:
 		float strengthDropoff_Position;
 		float strengthDropoff_FloatValue;
 		unsigned int strengthDropoff_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", strengthDropoff_Position);
 			fprintf(file,"%f ", strengthDropoff_FloatValue);
@@ -42,7 +42,7 @@ public:
 public:
 
 	DynamicConstraint():Shape(){}
-	DynamicConstraint(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	DynamicConstraint(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Shape(file, name, parent, "dynamicConstraint", shared, create){}
 	virtual ~DynamicConstraint(){}
 
@@ -547,7 +547,7 @@ public:
 		fprintf(mFile,"\"%s.cld\"",mName.c_str());
 	}
 protected:
-	DynamicConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	DynamicConstraint(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Shape(file, name, parent, nodeType, shared, create) {}
 
 };
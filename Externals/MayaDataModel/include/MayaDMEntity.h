@@ -19,12 +19,12 @@ class Entity : public DependNode
 public:
 
 	Entity():DependNode(){}
-	Entity(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Entity(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "entity", shared, create){}
 	virtual ~Entity(){}
 
 protected:
-	Entity(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Entity(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	EnvBall():TextureEnv(){}
-	EnvBall(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	EnvBall(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:TextureEnv(file, name, parent, "envBall", shared, create){}
 	virtual ~EnvBall(){}
 
@@ -182,7 +182,7 @@ public:
 		fprintf(mFile,"\"%s.ib\"",mName.c_str());
 	}
 protected:
-	EnvBall(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	EnvBall(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:TextureEnv(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	EnvChrome():TextureEnv(){}
-	EnvChrome(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	EnvChrome(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:TextureEnv(file, name, parent, "envChrome", shared, create){}
 	virtual ~EnvChrome(){}
 
@@ -395,7 +395,7 @@ public:
 		fprintf(mFile,"\"%s.gdo\"",mName.c_str());
 	}
 protected:
-	EnvChrome(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	EnvChrome(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:TextureEnv(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	EnvCube():TextureEnv(){}
-	EnvCube(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	EnvCube(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:TextureEnv(file, name, parent, "envCube", shared, create){}
 	virtual ~EnvCube(){}
 
@@ -304,7 +304,7 @@ public:
 		fprintf(mFile,"\"%s.ib\"",mName.c_str());
 	}
 protected:
-	EnvCube(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	EnvCube(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:TextureEnv(file, name, parent, nodeType, shared, create) {}
 
 };
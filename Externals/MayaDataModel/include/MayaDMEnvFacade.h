@@ -19,12 +19,12 @@ class EnvFacade : public Facade
 public:
 
 	EnvFacade():Facade(){}
-	EnvFacade(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	EnvFacade(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Facade(file, name, parent, "envFacade", shared, create){}
 	virtual ~EnvFacade(){}
 
 protected:
-	EnvFacade(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	EnvFacade(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Facade(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	EnvFog():LightFog(){}
-	EnvFog(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	EnvFog(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:LightFog(file, name, parent, "envFog", shared, create){}
 	virtual ~EnvFog(){}
 
@@ -651,7 +651,7 @@ public:
 		fprintf(mFile,"\"%s.snc.snb\"",mName.c_str());
 	}
 protected:
-	EnvFog(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	EnvFog(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:LightFog(file, name, parent, nodeType, shared, create) {}
 
 };
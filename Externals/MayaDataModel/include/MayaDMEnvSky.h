@@ -20,7 +20,7 @@ public:
 public:
 
 	EnvSky():TextureEnv(){}
-	EnvSky(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	EnvSky(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:TextureEnv(file, name, parent, "envSky", shared, create){}
 	virtual ~EnvSky(){}
 
@@ -474,7 +474,7 @@ public:
 		fprintf(mFile,"\"%s.csa\"",mName.c_str());
 	}
 protected:
-	EnvSky(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	EnvSky(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:TextureEnv(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	EnvSphere():TextureEnv(){}
-	EnvSphere(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	EnvSphere(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:TextureEnv(file, name, parent, "envSphere", shared, create){}
 	virtual ~EnvSphere(){}
 
@@ -137,7 +137,7 @@ public:
 		fprintf(mFile,"\"%s.ib\"",mName.c_str());
 	}
 protected:
-	EnvSphere(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	EnvSphere(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:TextureEnv(file, name, parent, nodeType, shared, create) {}
 
 };
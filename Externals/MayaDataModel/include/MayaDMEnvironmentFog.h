@@ -19,12 +19,12 @@ class EnvironmentFog : public GeometryShape
 public:
 
 	EnvironmentFog():GeometryShape(){}
-	EnvironmentFog(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	EnvironmentFog(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryShape(file, name, parent, "environmentFog", shared, create){}
 	virtual ~EnvironmentFog(){}
 
 protected:
-	EnvironmentFog(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	EnvironmentFog(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryShape(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	ExplodeNurbsShell():AbstractBaseCreate(){}
-	ExplodeNurbsShell(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ExplodeNurbsShell(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "explodeNurbsShell", shared, create){}
 	virtual ~ExplodeNurbsShell(){}
 
@@ -38,7 +38,7 @@ public:
 		fprintf(mFile,"\"%s.os\"",mName.c_str());
 	}
 protected:
-	ExplodeNurbsShell(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ExplodeNurbsShell(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Expression():DependNode(){}
-	Expression(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Expression(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "expression", shared, create){}
 	virtual ~Expression(){}
 
@@ -33,11 +33,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".in[%i:%i]\" ", in_start,in_end);
 		size_t size = (in_end-in_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",in[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(in,size);
 		fprintf(mFile,";\n");
 	}
 	void startInput(size_t in_start,size_t in_end)const
@@ -140,7 +136,7 @@ public:
 		fprintf(mFile,"\"%s.uno\"",mName.c_str());
 	}
 protected:
-	Expression(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Expression(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
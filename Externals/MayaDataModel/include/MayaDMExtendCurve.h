@@ -20,7 +20,7 @@ public:
 public:
 
 	ExtendCurve():AbstractBaseCreate(){}
-	ExtendCurve(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ExtendCurve(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "extendCurve", shared, create){}
 	virtual ~ExtendCurve(){}
 
@@ -136,7 +136,7 @@ public:
 		fprintf(mFile,"\"%s.oc\"",mName.c_str());
 	}
 protected:
-	ExtendCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ExtendCurve(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
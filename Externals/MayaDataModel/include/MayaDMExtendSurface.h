@@ -20,7 +20,7 @@ public:
 public:
 
 	ExtendSurface():AbstractBaseCreate(){}
-	ExtendSurface(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ExtendSurface(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "extendSurface", shared, create){}
 	virtual ~ExtendSurface(){}
 
@@ -91,7 +91,7 @@ public:
 		fprintf(mFile,"\"%s.oc\"",mName.c_str());
 	}
 protected:
-	ExtendSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ExtendSurface(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
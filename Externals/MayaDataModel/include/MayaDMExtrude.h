@@ -20,7 +20,7 @@ public:
 public:
 
 	Extrude():AbstractBaseCreate(){}
-	Extrude(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Extrude(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "extrude", shared, create){}
 	virtual ~Extrude(){}
 
@@ -201,7 +201,7 @@ public:
 		fprintf(mFile,"\"%s.os\"",mName.c_str());
 	}
 protected:
-	Extrude(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Extrude(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
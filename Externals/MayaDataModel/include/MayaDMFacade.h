@@ -20,7 +20,7 @@ public:
 public:
 
 	Facade():DependNode(){}
-	Facade(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Facade(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "facade", shared, create){}
 	virtual ~Facade(){}
 
@@ -84,7 +84,7 @@ public:
 		fprintf(mFile,"\"%s.uid\"",mName.c_str());
 	}
 protected:
-	Facade(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Facade(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	FfBlendSrf():AbstractBaseCreate(){}
-	FfBlendSrf(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FfBlendSrf(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "ffBlendSrf", shared, create){}
 	virtual ~FfBlendSrf(){}
 
@@ -190,7 +190,7 @@ public:
 		fprintf(mFile,"\"%s.os\"",mName.c_str());
 	}
 protected:
-	FfBlendSrf(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FfBlendSrf(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	FfBlendSrfObsolete():AbstractBaseCreate(){}
-	FfBlendSrfObsolete(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FfBlendSrfObsolete(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "ffBlendSrfObsolete", shared, create){}
 	virtual ~FfBlendSrfObsolete(){}
 
@@ -127,7 +127,7 @@ public:
 		fprintf(mFile,"\"%s.mk\"",mName.c_str());
 	}
 protected:
-	FfBlendSrfObsolete(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FfBlendSrfObsolete(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	FfFilletSrf():AbstractBaseCreate(){}
-	FfFilletSrf(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FfFilletSrf(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "ffFilletSrf", shared, create){}
 	virtual ~FfFilletSrf(){}
 
@@ -73,7 +73,7 @@ public:
 		fprintf(mFile,"\"%s.os\"",mName.c_str());
 	}
 protected:
-	FfFilletSrf(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FfFilletSrf(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 	struct DeformedLattice{
 		lattice deformedLatticePoints;
 		matrix deformedLatticeMatrix;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			deformedLatticePoints.write(file);
 			fprintf(file, " ");
@@ -30,7 +30,7 @@ public:
 	struct BaseLattice{
 		lattice baseLatticePoints;
 		matrix baseLatticeMatrix;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			baseLatticePoints.write(file);
 			fprintf(file, " ");
@@ -39,7 +39,7 @@ public:
 	};
 	struct StuCacheList{
 		double* stuCache;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(stuCache)/sizeof(double);
 			for(size_t i=0; i<size; ++i)
@@ -52,7 +52,7 @@ public:
 public:
 
 	Ffd():GeometryFilter(){}
-	Ffd(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Ffd(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, "ffd", shared, create){}
 	virtual ~Ffd(){}
 
@@ -134,11 +134,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".scl[%i].stu[%i:%i]\" ", scl_i,stu_start,stu_end);
 		size_t size = (stu_end-stu_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",stu[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(stu,size);
 		fprintf(mFile,";\n");
 	}
 	void startStuCache(size_t scl_i,size_t stu_start,size_t stu_end)const
@@ -277,7 +273,7 @@ public:
 		fprintf(mFile,"\"%s.ofd\"",mName.c_str());
 	}
 protected:
-	Ffd(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Ffd(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -22,7 +22,7 @@ public:
 		vectorArray inputVelocities;
 		doubleArray inputMass;
 		double deltaTime;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			inputPositions.write(file);
 			fprintf(file, " ");
@@ -37,7 +37,7 @@ public:
 		float falloffCurve_Position;
 		float falloffCurve_FloatValue;
 		unsigned int falloffCurve_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", falloffCurve_Position);
 			fprintf(file,"%f ", falloffCurve_FloatValue);
@@ -47,7 +47,7 @@ public:
 public:
 
 	Field():DynBase(){}
-	Field(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Field(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DynBase(file, name, parent, "field", shared, create){}
 	virtual ~Field(){}
 
@@ -385,7 +385,7 @@ public:
 		fprintf(mFile,"\"%s.fc.fci\"",mName.c_str());
 	}
 protected:
-	Field(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Field(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DynBase(file, name, parent, nodeType, shared, create) {}
 
 };
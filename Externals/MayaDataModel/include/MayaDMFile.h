@@ -20,7 +20,7 @@ public:
 public:
 
 	File():Texture2d(){}
-	File(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	File(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, "file", shared, create){}
 	virtual ~File(){}
 
@@ -667,7 +667,7 @@ public:
 		fprintf(mFile,"\"%s.ib\"",mName.c_str());
 	}
 protected:
-	File(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	File(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	FilletCurve():AbstractBaseCreate(){}
-	FilletCurve(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FilletCurve(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "filletCurve", shared, create){}
 	virtual ~FilletCurve(){}
 
@@ -135,7 +135,7 @@ public:
 		fprintf(mFile,"\"%s.bc\"",mName.c_str());
 	}
 protected:
-	FilletCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FilletCurve(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
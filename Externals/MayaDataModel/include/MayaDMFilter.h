@@ -18,19 +18,19 @@ class Filter : public DependNode
 {
 public:
 	struct Input{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 	struct Output{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	Filter():DependNode(){}
-	Filter(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Filter(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "filter", shared, create){}
 	virtual ~Filter(){}
 
@@ -44,7 +44,7 @@ public:
 		fprintf(mFile,"\"%s.dea\"",mName.c_str());
 	}
 protected:
-	Filter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Filter(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	FilterClosestSample():Filter(){}
-	FilterClosestSample(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FilterClosestSample(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Filter(file, name, parent, "filterClosestSample", shared, create){}
 	virtual ~FilterClosestSample(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.f\"",mName.c_str());
 	}
 protected:
-	FilterClosestSample(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FilterClosestSample(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Filter(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	FilterEuler():Filter(){}
-	FilterEuler(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FilterEuler(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Filter(file, name, parent, "filterEuler", shared, create){}
 	virtual ~FilterEuler(){}
 
@@ -137,7 +137,7 @@ public:
 		fprintf(mFile,"\"%s.use\"",mName.c_str());
 	}
 protected:
-	FilterEuler(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FilterEuler(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Filter(file, name, parent, nodeType, shared, create) {}
 
 };
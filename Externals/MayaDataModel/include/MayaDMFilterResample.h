@@ -20,7 +20,7 @@ public:
 public:
 
 	FilterResample():Filter(){}
-	FilterResample(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FilterResample(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Filter(file, name, parent, "filterResample", shared, create){}
 	virtual ~FilterResample(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.kr\"",mName.c_str());
 	}
 protected:
-	FilterResample(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FilterResample(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Filter(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	FilterSimplify():Filter(){}
-	FilterSimplify(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FilterSimplify(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Filter(file, name, parent, "filterSimplify", shared, create){}
 	virtual ~FilterSimplify(){}
 
@@ -70,7 +70,7 @@ public:
 		fprintf(mFile,"\"%s.ad\"",mName.c_str());
 	}
 protected:
-	FilterSimplify(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FilterSimplify(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Filter(file, name, parent, nodeType, shared, create) {}
 
 };
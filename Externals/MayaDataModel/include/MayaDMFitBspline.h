@@ -20,7 +20,7 @@ public:
 public:
 
 	FitBspline():AbstractBaseCreate(){}
-	FitBspline(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FitBspline(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "fitBspline", shared, create){}
 	virtual ~FitBspline(){}
 
@@ -42,7 +42,7 @@ public:
 		fprintf(mFile,"\"%s.oc\"",mName.c_str());
 	}
 protected:
-	FitBspline(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FitBspline(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	FlexorShape():Shape(){}
-	FlexorShape(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FlexorShape(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Shape(file, name, parent, "flexorShape", shared, create){}
 	virtual ~FlexorShape(){}
 
@@ -52,7 +52,7 @@ public:
 		fprintf(mFile,"\"%s.fn\"",mName.c_str());
 	}
 protected:
-	FlexorShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FlexorShape(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Shape(file, name, parent, nodeType, shared, create) {}
 
 };
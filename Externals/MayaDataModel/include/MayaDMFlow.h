@@ -20,7 +20,7 @@ public:
 public:
 
 	Flow():DependNode(){}
-	Flow(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Flow(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "flow", shared, create){}
 	virtual ~Flow(){}
 
@@ -113,11 +113,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ctr[%i:%i]\" ", ctr_start,ctr_end);
 		size_t size = (ctr_end-ctr_start)*3+3;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",ctr[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(ctr,size);
 		fprintf(mFile,";\n");
 	}
 	void startCenter(size_t ctr_start,size_t ctr_end)const
@@ -293,7 +289,7 @@ public:
 		fprintf(mFile,"\"%s.dpt\"",mName.c_str());
 	}
 protected:
-	Flow(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Flow(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	FluidEmitter():PointEmitter(){}
-	FluidEmitter(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FluidEmitter(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PointEmitter(file, name, parent, "fluidEmitter", shared, create){}
 	virtual ~FluidEmitter(){}
 
@@ -193,7 +193,7 @@ public:
 		fprintf(mFile,"\"%s.ef\"",mName.c_str());
 	}
 protected:
-	FluidEmitter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FluidEmitter(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PointEmitter(file, name, parent, nodeType, shared, create) {}
 
 };
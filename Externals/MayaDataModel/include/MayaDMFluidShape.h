@@ -21,7 +21,7 @@ public:
 		int resolutionW;
 		int resolutionH;
 		int resolutionD;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", resolutionW);
 			fprintf(file,"%i ", resolutionH);
@@ -32,7 +32,7 @@ public:
 		double dimensionsW;
 		double dimensionsH;
 		double dimensionsD;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", dimensionsW);
 			fprintf(file,"%f ", dimensionsH);
@@ -40,7 +40,7 @@ public:
 		}
 	};
 	struct FieldData{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
@@ -49,7 +49,7 @@ public:
 			struct FieldFunction_Inmap{
 				short fieldFunction_InmapTo;
 				short fieldFunction_InmapFrom;
-				void write(FILE* file) const
+				void write(Writer* file) const
 				{
 					fprintf(file,"%i ", fieldFunction_InmapTo);
 					fprintf(file,"%i", fieldFunction_InmapFrom);
@@ -58,13 +58,13 @@ public:
 			struct FieldFunction_Outmap{
 				short fieldFunction_OutmapTo;
 				short fieldFunction_OutmapFrom;
-				void write(FILE* file) const
+				void write(Writer* file) const
 				{
 					fprintf(file,"%i ", fieldFunction_OutmapTo);
 					fprintf(file,"%i", fieldFunction_OutmapFrom);
 				}
 			}* fieldFunction_Outmap;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				size_t size = sizeof(fieldFunction_Inmap)/sizeof(FieldFunction_Inmap);
 				for(size_t i=0; i<size; ++i)
@@ -81,7 +81,7 @@ public:
 				}
 			}
 		} fieldFunction;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fieldFunction.write(file);
 		}
@@ -91,7 +91,7 @@ public:
 			struct EmissionFunction_Inmap{
 				short emissionFunction_InmapTo;
 				short emissionFunction_InmapFrom;
-				void write(FILE* file) const
+				void write(Writer* file) const
 				{
 					fprintf(file,"%i ", emissionFunction_InmapTo);
 					fprintf(file,"%i", emissionFunction_InmapFrom);
@@ -100,13 +100,13 @@ public:
 			struct EmissionFunction_Outmap{
 				short emissionFunction_OutmapTo;
 				short emissionFunction_OutmapFrom;
-				void write(FILE* file) const
+				void write(Writer* file) const
 				{
 					fprintf(file,"%i ", emissionFunction_OutmapTo);
 					fprintf(file,"%i", emissionFunction_OutmapFrom);
 				}
 			}* emissionFunction_Outmap;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				size_t size = sizeof(emissionFunction_Inmap)/sizeof(EmissionFunction_Inmap);
 				for(size_t i=0; i<size; ++i)
@@ -123,7 +123,7 @@ public:
 				}
 			}
 		} emissionFunction;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			emissionFunction.write(file);
 		}
@@ -132,7 +132,7 @@ public:
 		int subVolumeCenterW;
 		int subVolumeCenterH;
 		int subVolumeCenterD;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", subVolumeCenterW);
 			fprintf(file,"%i ", subVolumeCenterH);
@@ -143,7 +143,7 @@ public:
 		int subVolumeSizeW;
 		int subVolumeSizeH;
 		int subVolumeSizeD;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", subVolumeSizeW);
 			fprintf(file,"%i ", subVolumeSizeH);
@@ -155,7 +155,7 @@ public:
 		vectorArray inputVelocities;
 		doubleArray inputMass;
 		double deltaTime;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			inputPositions.write(file);
 			fprintf(file, " ");
@@ -170,7 +170,7 @@ public:
 		float color_Position;
 		float3 color_Color;
 		unsigned int color_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", color_Position);
 			color_Color.write(file);
@@ -182,7 +182,7 @@ public:
 		float opacity_Position;
 		float opacity_FloatValue;
 		unsigned int opacity_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", opacity_Position);
 			fprintf(file,"%f ", opacity_FloatValue);
@@ -193,7 +193,7 @@ public:
 		float incandescence_Position;
 		float3 incandescence_Color;
 		unsigned int incandescence_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", incandescence_Position);
 			incandescence_Color.write(file);
@@ -205,7 +205,7 @@ public:
 		float environment_Position;
 		float3 environment_Color;
 		unsigned int environment_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", environment_Position);
 			environment_Color.write(file);
@@ -214,7 +214,7 @@ public:
 		}
 	};
 	struct CollisionData{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
@@ -234,7 +234,7 @@ public:
 		bool miOverrideSamples;
 		short miMinSamples;
 		short miMaxSamples;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", miOverrideCaustics);
 			fprintf(file,"%i ", miCausticAccuracy);
@@ -256,7 +256,7 @@ public:
 public:
 
 	FluidShape():SurfaceShape(){}
-	FluidShape(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FluidShape(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:SurfaceShape(file, name, parent, "fluidShape", shared, create){}
 	virtual ~FluidShape(){}
 
@@ -460,11 +460,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".sd[%i:%i]\" ", sd_start,sd_end);
 		size_t size = (sd_end-sd_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",sd[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(sd,size);
 		fprintf(mFile,";\n");
 	}
 	void startSeed(size_t sd_start,size_t sd_end)const
@@ -3491,7 +3487,7 @@ public:
 		fprintf(mFile,"\"%s.mrc.maxs\"",mName.c_str());
 	}
 protected:
-	FluidShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FluidShape(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:SurfaceShape(file, name, parent, nodeType, shared, create) {}
 
 };
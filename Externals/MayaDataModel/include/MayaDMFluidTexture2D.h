@@ -20,7 +20,7 @@ public:
 public:
 
 	FluidTexture2D():FluidShape(){}
-	FluidTexture2D(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FluidTexture2D(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:FluidShape(file, name, parent, "fluidTexture2D", shared, create){}
 	virtual ~FluidTexture2D(){}
 
@@ -121,7 +121,7 @@ public:
 		fprintf(mFile,"\"%s.dcl.dcb\"",mName.c_str());
 	}
 protected:
-	FluidTexture2D(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FluidTexture2D(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:FluidShape(file, name, parent, nodeType, shared, create) {}
 
 };
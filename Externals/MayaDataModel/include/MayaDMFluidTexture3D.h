@@ -20,7 +20,7 @@ public:
 public:
 
 	FluidTexture3D():FluidShape(){}
-	FluidTexture3D(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FluidTexture3D(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:FluidShape(file, name, parent, "fluidTexture3D", shared, create){}
 	virtual ~FluidTexture3D(){}
 
@@ -117,7 +117,7 @@ public:
 		fprintf(mFile,"\"%s.dcl.dcb\"",mName.c_str());
 	}
 protected:
-	FluidTexture3D(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FluidTexture3D(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:FluidShape(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -21,7 +21,7 @@ public:
 		float stiffnessScale_Position;
 		float stiffnessScale_FloatValue;
 		unsigned int stiffnessScale_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", stiffnessScale_Position);
 			fprintf(file,"%f ", stiffnessScale_FloatValue);
@@ -32,7 +32,7 @@ public:
 		float clumpWidthScale_Position;
 		float clumpWidthScale_FloatValue;
 		unsigned int clumpWidthScale_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", clumpWidthScale_Position);
 			fprintf(file,"%f ", clumpWidthScale_FloatValue);
@@ -43,7 +43,7 @@ public:
 		float attractionScale_Position;
 		float attractionScale_FloatValue;
 		unsigned int attractionScale_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", attractionScale_Position);
 			fprintf(file,"%f ", attractionScale_FloatValue);
@@ -53,7 +53,7 @@ public:
 public:
 
 	Follicle():Shape(){}
-	Follicle(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Follicle(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Shape(file, name, parent, "follicle", shared, create){}
 	virtual ~Follicle(){}
 
@@ -695,7 +695,7 @@ public:
 		fprintf(mFile,"\"%s.msn\"",mName.c_str());
 	}
 protected:
-	Follicle(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Follicle(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Shape(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	FourByFourMatrix():DependNode(){}
-	FourByFourMatrix(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FourByFourMatrix(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "fourByFourMatrix", shared, create){}
 	virtual ~FourByFourMatrix(){}
 
@@ -173,7 +173,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	FourByFourMatrix(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FourByFourMatrix(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
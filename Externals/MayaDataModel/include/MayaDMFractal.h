@@ -20,7 +20,7 @@ public:
 public:
 
 	Fractal():Texture2d(){}
-	Fractal(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Fractal(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, "fractal", shared, create){}
 	virtual ~Fractal(){}
 
@@ -124,7 +124,7 @@ public:
 		fprintf(mFile,"\"%s.ti\"",mName.c_str());
 	}
 protected:
-	Fractal(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Fractal(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, nodeType, shared, create) {}
 
 };
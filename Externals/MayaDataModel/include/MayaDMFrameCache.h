@@ -20,7 +20,7 @@ public:
 public:
 
 	FrameCache():DependNode(){}
-	FrameCache(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FrameCache(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "frameCache", shared, create){}
 	virtual ~FrameCache(){}
 
@@ -65,7 +65,7 @@ public:
 		fprintf(mFile,"\"%s.s\"",mName.c_str());
 	}
 protected:
-	FrameCache(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FrameCache(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -56,7 +56,7 @@ public:
 public:
 
 	FurAttractors():DependNode(){}
-	FurAttractors(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FurAttractors(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "FurAttractors", shared, create){}
 	virtual ~FurAttractors(){}
 
@@ -410,7 +410,7 @@ public:
 		fprintf(mFile,"\"%s.tln\"",mName.c_str());
 	}
 protected:
-	FurAttractors(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FurAttractors(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
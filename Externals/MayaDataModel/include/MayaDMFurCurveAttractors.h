@@ -56,7 +56,7 @@ public:
 public:
 
 	FurCurveAttractors():DependNode(){}
-	FurCurveAttractors(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FurCurveAttractors(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "FurCurveAttractors", shared, create){}
 	virtual ~FurCurveAttractors(){}
 
@@ -410,7 +410,7 @@ public:
 		fprintf(mFile,"\"%s.ctln\"",mName.c_str());
 	}
 protected:
-	FurCurveAttractors(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FurCurveAttractors(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
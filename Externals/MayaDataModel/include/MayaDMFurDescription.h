@@ -176,7 +176,7 @@ public:
 public:
 
 	FurDescription():DependNode(){}
-	FurDescription(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FurDescription(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "FurDescription", shared, create){}
 	virtual ~FurDescription(){}
 
@@ -1645,7 +1645,7 @@ public:
 		fprintf(mFile,"\"%s.csn\"",mName.c_str());
 	}
 protected:
-	FurDescription(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FurDescription(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -39,7 +39,7 @@ public:
 		bool miFinalGatherReceive;
 		bool miTransparencyCast;
 		bool miTransparencyReceive;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", miOverrideCaustics);
 			fprintf(file,"%i ", miCausticAccuracy);
@@ -65,7 +65,7 @@ public:
 public:
 
 	FurFeedback():Locator(){}
-	FurFeedback(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FurFeedback(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Locator(file, name, parent, "FurFeedback", shared, create){}
 	virtual ~FurFeedback(){}
 
@@ -185,11 +185,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ls[%i:%i]\" ", ls_start,ls_end);
 		size_t size = (ls_end-ls_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",ls[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(ls,size);
 		fprintf(mFile,";\n");
 	}
 	void startLengthSamples(size_t ls_start,size_t ls_end)const
@@ -255,11 +251,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ins[%i:%i]\" ", ins_start,ins_end);
 		size_t size = (ins_end-ins_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",ins[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(ins,size);
 		fprintf(mFile,";\n");
 	}
 	void startInclinationSamples(size_t ins_start,size_t ins_end)const
@@ -325,11 +317,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".rls[%i:%i]\" ", rls_start,rls_end);
 		size_t size = (rls_end-rls_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",rls[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(rls,size);
 		fprintf(mFile,";\n");
 	}
 	void startRollSamples(size_t rls_start,size_t rls_end)const
@@ -395,11 +383,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".pos[%i:%i]\" ", pos_start,pos_end);
 		size_t size = (pos_end-pos_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",pos[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(pos,size);
 		fprintf(mFile,";\n");
 	}
 	void startPolarSamples(size_t pos_start,size_t pos_end)const
@@ -465,11 +449,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".bs[%i:%i]\" ", bs_start,bs_end);
 		size_t size = (bs_end-bs_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",bs[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(bs,size);
 		fprintf(mFile,";\n");
 	}
 	void startBaldnessSamples(size_t bs_start,size_t bs_end)const
@@ -535,11 +515,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".bos[%i:%i]\" ", bos_start,bos_end);
 		size_t size = (bos_end-bos_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",bos[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(bos,size);
 		fprintf(mFile,";\n");
 	}
 	void startBaseOpacitySamples(size_t bos_start,size_t bos_end)const
@@ -605,11 +581,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".tos[%i:%i]\" ", tos_start,tos_end);
 		size_t size = (tos_end-tos_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",tos[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(tos,size);
 		fprintf(mFile,";\n");
 	}
 	void startTipOpacitySamples(size_t tos_start,size_t tos_end)const
@@ -675,11 +647,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".bcls[%i:%i]\" ", bcls_start,bcls_end);
 		size_t size = (bcls_end-bcls_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",bcls[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(bcls,size);
 		fprintf(mFile,";\n");
 	}
 	void startBaseCurlSamples(size_t bcls_start,size_t bcls_end)const
@@ -745,11 +713,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".tcls[%i:%i]\" ", tcls_start,tcls_end);
 		size_t size = (tcls_end-tcls_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",tcls[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(tcls,size);
 		fprintf(mFile,";\n");
 	}
 	void startTipCurlSamples(size_t tcls_start,size_t tcls_end)const
@@ -815,11 +779,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".bws[%i:%i]\" ", bws_start,bws_end);
 		size_t size = (bws_end-bws_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",bws[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(bws,size);
 		fprintf(mFile,";\n");
 	}
 	void startBaseWidthSamples(size_t bws_start,size_t bws_end)const
@@ -885,11 +845,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".tws[%i:%i]\" ", tws_start,tws_end);
 		size_t size = (tws_end-tws_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",tws[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(tws,size);
 		fprintf(mFile,";\n");
 	}
 	void startTipWidthSamples(size_t tws_start,size_t tws_end)const
@@ -955,11 +911,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ss[%i:%i]\" ", ss_start,ss_end);
 		size_t size = (ss_end-ss_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",ss[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(ss,size);
 		fprintf(mFile,";\n");
 	}
 	void startScraggleSamples(size_t ss_start,size_t ss_end)const
@@ -1025,11 +977,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".scos[%i:%i]\" ", scos_start,scos_end);
 		size_t size = (scos_end-scos_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",scos[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(scos,size);
 		fprintf(mFile,";\n");
 	}
 	void startScraggleCorrelationSamples(size_t scos_start,size_t scos_end)const
@@ -1095,11 +1043,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".scfs[%i:%i]\" ", scfs_start,scfs_end);
 		size_t size = (scfs_end-scfs_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",scfs[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(scfs,size);
 		fprintf(mFile,";\n");
 	}
 	void startScraggleFrequencySamples(size_t scfs_start,size_t scfs_end)const
@@ -1165,11 +1109,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".segs[%i:%i]\" ", segs_start,segs_end);
 		size_t size = (segs_end-segs_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",segs[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(segs,size);
 		fprintf(mFile,";\n");
 	}
 	void startSegmentsSamples(size_t segs_start,size_t segs_end)const
@@ -1235,11 +1175,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ats[%i:%i]\" ", ats_start,ats_end);
 		size_t size = (ats_end-ats_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",ats[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(ats,size);
 		fprintf(mFile,";\n");
 	}
 	void startAttractionSamples(size_t ats_start,size_t ats_end)const
@@ -1305,11 +1241,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ofss[%i:%i]\" ", ofss_start,ofss_end);
 		size_t size = (ofss_end-ofss_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",ofss[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(ofss,size);
 		fprintf(mFile,";\n");
 	}
 	void startOffsetSamples(size_t ofss_start,size_t ofss_end)const
@@ -1375,11 +1307,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".cs[%i:%i]\" ", cs_start,cs_end);
 		size_t size = (cs_end-cs_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",cs[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(cs,size);
 		fprintf(mFile,";\n");
 	}
 	void startClumpingSamples(size_t cs_start,size_t cs_end)const
@@ -1445,11 +1373,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".cfs[%i:%i]\" ", cfs_start,cfs_end);
 		size_t size = (cfs_end-cfs_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",cfs[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(cfs,size);
 		fprintf(mFile,";\n");
 	}
 	void startClumpingFrequencySamples(size_t cfs_start,size_t cfs_end)const
@@ -1515,11 +1439,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".css[%i:%i]\" ", css_start,css_end);
 		size_t size = (css_end-css_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",css[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(css,size);
 		fprintf(mFile,";\n");
 	}
 	void startClumpingShapeSamples(size_t css_start,size_t css_end)const
@@ -1602,11 +1522,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".bcs[%i:%i]\" ", bcs_start,bcs_end);
 		size_t size = (bcs_end-bcs_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",bcs[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(bcs,size);
 		fprintf(mFile,";\n");
 	}
 	void startBaseColorSamples(size_t bcs_start,size_t bcs_end)const
@@ -1679,11 +1595,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".tcs[%i:%i]\" ", tcs_start,tcs_end);
 		size_t size = (tcs_end-tcs_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",tcs[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(tcs,size);
 		fprintf(mFile,";\n");
 	}
 	void startTipColorSamples(size_t tcs_start,size_t tcs_end)const
@@ -1739,11 +1651,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ars[%i:%i]\" ", ars_start,ars_end);
 		size_t size = (ars_end-ars_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",ars[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(ars,size);
 		fprintf(mFile,";\n");
 	}
 	void startRadiusSamples(size_t ars_start,size_t ars_end)const
@@ -1809,11 +1717,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".aps[%i:%i]\" ", aps_start,aps_end);
 		size_t size = (aps_end-aps_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",aps[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(aps,size);
 		fprintf(mFile,";\n");
 	}
 	void startPowerSamples(size_t aps_start,size_t aps_end)const
@@ -1879,11 +1783,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ais[%i:%i]\" ", ais_start,ais_end);
 		size_t size = (ais_end-ais_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",ais[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(ais,size);
 		fprintf(mFile,";\n");
 	}
 	void startInfluenceSamples(size_t ais_start,size_t ais_end)const
@@ -1949,11 +1849,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".asls[%i:%i]\" ", asls_start,asls_end);
 		size_t size = (asls_end-asls_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",asls[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(asls,size);
 		fprintf(mFile,";\n");
 	}
 	void startStartLengthSamples(size_t asls_start,size_t asls_end)const
@@ -2019,11 +1915,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".aels[%i:%i]\" ", aels_start,aels_end);
 		size_t size = (aels_end-aels_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",aels[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(aels,size);
 		fprintf(mFile,";\n");
 	}
 	void startEndLengthSamples(size_t aels_start,size_t aels_end)const
@@ -2089,11 +1981,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".atls[%i:%i]\" ", atls_start,atls_end);
 		size_t size = (atls_end-atls_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",atls[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(atls,size);
 		fprintf(mFile,";\n");
 	}
 	void startThresholdLengthSamples(size_t atls_start,size_t atls_end)const
@@ -2159,11 +2047,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".uns[%i:%i]\" ", uns_start,uns_end);
 		size_t size = (uns_end-uns_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",uns[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(uns,size);
 		fprintf(mFile,";\n");
 	}
 	void startUnusedSamples(size_t uns_start,size_t uns_end)const
@@ -2229,11 +2113,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ems[%i:%i]\" ", ems_start,ems_end);
 		size_t size = (ems_end-ems_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",ems[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(ems,size);
 		fprintf(mFile,";\n");
 	}
 	void startEqualizerSamples(size_t ems_start,size_t ems_end)const
@@ -3781,7 +3661,7 @@ public:
 		fprintf(mFile,"\"%s.mrc.tpr\"",mName.c_str());
 	}
 protected:
-	FurFeedback(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FurFeedback(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Locator(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	FurGlobals():DependNode(){}
-	FurGlobals(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FurGlobals(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "FurGlobals", shared, create){}
 	virtual ~FurGlobals(){}
 
@@ -254,7 +254,7 @@ public:
 		fprintf(mFile,"\"%s.dgr\"",mName.c_str());
 	}
 protected:
-	FurGlobals(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FurGlobals(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
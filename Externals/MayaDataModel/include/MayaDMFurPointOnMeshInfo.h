@@ -22,7 +22,7 @@ public:
 public:
 
 	FurPointOnMeshInfo():DependNode(){}
-	FurPointOnMeshInfo(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FurPointOnMeshInfo(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "furPointOnMeshInfo", shared, create){}
 	virtual ~FurPointOnMeshInfo(){}
 
@@ -144,7 +144,7 @@ public:
 		fprintf(mFile,"\"%s.nz\"",mName.c_str());
 	}
 protected:
-	FurPointOnMeshInfo(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FurPointOnMeshInfo(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
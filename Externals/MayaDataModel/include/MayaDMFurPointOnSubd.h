@@ -24,7 +24,7 @@ public:
 public:
 
 	FurPointOnSubd():DependNode(){}
-	FurPointOnSubd(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	FurPointOnSubd(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "furPointOnSubd", shared, create){}
 	virtual ~FurPointOnSubd(){}
 
@@ -144,7 +144,7 @@ public:
 		fprintf(mFile,"\"%s.nz\"",mName.c_str());
 	}
 protected:
-	FurPointOnSubd(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	FurPointOnSubd(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	GammaCorrect():DependNode(){}
-	GammaCorrect(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	GammaCorrect(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "gammaCorrect", shared, create){}
 	virtual ~GammaCorrect(){}
 
@@ -117,7 +117,7 @@ public:
 		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
 	}
 protected:
-	GammaCorrect(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	GammaCorrect(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
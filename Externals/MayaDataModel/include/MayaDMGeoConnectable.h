@@ -20,7 +20,7 @@ public:
 public:
 
 	GeoConnectable():Shape(){}
-	GeoConnectable(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	GeoConnectable(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Shape(file, name, parent, "geoConnectable", shared, create){}
 	virtual ~GeoConnectable(){}
 
@@ -88,7 +88,7 @@ public:
 		fprintf(mFile,"\"%s.lsg\"",mName.c_str());
 	}
 protected:
-	GeoConnectable(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	GeoConnectable(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Shape(file, name, parent, nodeType, shared, create) {}
 
 };
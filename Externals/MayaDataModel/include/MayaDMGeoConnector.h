@@ -18,14 +18,14 @@ class GeoConnector : public DependNode
 {
 public:
 	struct IdMapping{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	GeoConnector():DependNode(){}
-	GeoConnector(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	GeoConnector(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "geoConnector", shared, create){}
 	virtual ~GeoConnector(){}
 
@@ -45,11 +45,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".gri[%i:%i]\" ", gri_start,gri_end);
 		size_t size = (gri_end-gri_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",gri[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(gri,size);
 		fprintf(mFile,";\n");
 	}
 	void startGroupId(size_t gri_start,size_t gri_end)const
@@ -321,7 +317,7 @@ public:
 		fprintf(mFile,"\"%s.off\"",mName.c_str());
 	}
 protected:
-	GeoConnector(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	GeoConnector(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
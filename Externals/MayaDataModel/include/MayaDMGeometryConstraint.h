@@ -19,7 +19,7 @@ class GeometryConstraint : public Constraint
 public:
 	struct Target{
 		double targetWeight;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f", targetWeight);
 		}
@@ -27,7 +27,7 @@ public:
 public:
 
 	GeometryConstraint():Constraint(){}
-	GeometryConstraint(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	GeometryConstraint(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Constraint(file, name, parent, "geometryConstraint", shared, create){}
 	virtual ~GeometryConstraint(){}
 
@@ -110,7 +110,7 @@ public:
 		fprintf(mFile,"\"%s.cgm\"",mName.c_str());
 	}
 protected:
-	GeometryConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	GeometryConstraint(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Constraint(file, name, parent, nodeType, shared, create) {}
 
 };
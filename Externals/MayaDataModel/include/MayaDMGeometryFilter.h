@@ -19,7 +19,7 @@ class GeometryFilter : public DependNode
 public:
 	struct Input{
 		int groupId;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i", groupId);
 		}
@@ -27,7 +27,7 @@ public:
 public:
 
 	GeometryFilter():DependNode(){}
-	GeometryFilter(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	GeometryFilter(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "geometryFilter", shared, create){}
 	virtual ~GeometryFilter(){}
 
@@ -133,7 +133,7 @@ public:
 		fprintf(mFile,"\"%s.map\"",mName.c_str());
 	}
 protected:
-	GeometryFilter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	GeometryFilter(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -21,14 +21,14 @@ public:
 		struct CompObjectGroups{
 			componentList compObjectGrpCompList;
 			int compObjectGroupId;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				compObjectGrpCompList.write(file);
 				fprintf(file, " ");
 				fprintf(file,"%i", compObjectGroupId);
 			}
 		}* compObjectGroups;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(compObjectGroups)/sizeof(CompObjectGroups);
 			for(size_t i=0; i<size; ++i)
@@ -41,7 +41,7 @@ public:
 public:
 
 	GeometryShape():Shape(){}
-	GeometryShape(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	GeometryShape(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Shape(file, name, parent, "geometryShape", shared, create){}
 	virtual ~GeometryShape(){}
 
@@ -330,7 +330,7 @@ public:
 		fprintf(mFile,"\"%s.ciog.cog[%i].cgid\"",mName.c_str(),cog_i);
 	}
 protected:
-	GeometryShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	GeometryShape(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Shape(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	GeometryVarGroup():BaseGeometryVarGroup(){}
-	GeometryVarGroup(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	GeometryVarGroup(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:BaseGeometryVarGroup(file, name, parent, "geometryVarGroup", shared, create){}
 	virtual ~GeometryVarGroup(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.l\"",mName.c_str());
 	}
 protected:
-	GeometryVarGroup(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	GeometryVarGroup(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:BaseGeometryVarGroup(file, name, parent, nodeType, shared, create) {}
 
 };
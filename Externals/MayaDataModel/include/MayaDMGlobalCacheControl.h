@@ -20,7 +20,7 @@ public:
 public:
 
 	GlobalCacheControl():DependNode(){}
-	GlobalCacheControl(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	GlobalCacheControl(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "globalCacheControl", shared, create){}
 	virtual ~GlobalCacheControl(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.webl\"",mName.c_str());
 	}
 protected:
-	GlobalCacheControl(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	GlobalCacheControl(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
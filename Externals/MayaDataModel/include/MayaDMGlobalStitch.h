@@ -20,7 +20,7 @@ public:
 public:
 
 	GlobalStitch():AbstractBaseCreate(){}
-	GlobalStitch(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	GlobalStitch(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "globalStitch", shared, create){}
 	virtual ~GlobalStitch(){}
 
@@ -165,7 +165,7 @@ public:
 		fprintf(mFile,"\"%s.ue\"",mName.c_str());
 	}
 protected:
-	GlobalStitch(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	GlobalStitch(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Granite():Texture3d(){}
-	Granite(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Granite(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, "granite", shared, create){}
 	virtual ~Granite(){}
 
@@ -272,7 +272,7 @@ public:
 		fprintf(mFile,"\"%s.c\"",mName.c_str());
 	}
 protected:
-	Granite(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Granite(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -21,7 +21,7 @@ public:
 		double directionX;
 		double directionY;
 		double directionZ;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", directionX);
 			fprintf(file,"%f ", directionY);
@@ -31,7 +31,7 @@ public:
 public:
 
 	GravityField():Field(){}
-	GravityField(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	GravityField(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Field(file, name, parent, "gravityField", shared, create){}
 	virtual ~GravityField(){}
 
@@ -73,7 +73,7 @@ public:
 		fprintf(mFile,"\"%s.d.dz\"",mName.c_str());
 	}
 protected:
-	GravityField(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	GravityField(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Field(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Grid():Texture2d(){}
-	Grid(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Grid(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, "grid", shared, create){}
 	virtual ~Grid(){}
 
@@ -128,7 +128,7 @@ public:
 		fprintf(mFile,"\"%s.vw\"",mName.c_str());
 	}
 protected:
-	Grid(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Grid(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	GroupId():DependNode(){}
-	GroupId(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	GroupId(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "groupId", shared, create){}
 	virtual ~GroupId(){}
 
@@ -29,7 +29,7 @@ public:
 		fprintf(mFile,"\"%s.id\"",mName.c_str());
 	}
 protected:
-	GroupId(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	GroupId(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
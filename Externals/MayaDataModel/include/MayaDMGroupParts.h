@@ -20,7 +20,7 @@ public:
 public:
 
 	GroupParts():DependNode(){}
-	GroupParts(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	GroupParts(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "groupParts", shared, create){}
 	virtual ~GroupParts(){}
 
@@ -62,7 +62,7 @@ public:
 		fprintf(mFile,"\"%s.gi\"",mName.c_str());
 	}
 protected:
-	GroupParts(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	GroupParts(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Guide():DependNode(){}
-	Guide(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Guide(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "guide", shared, create){}
 	virtual ~Guide(){}
 
@@ -110,7 +110,7 @@ public:
 		fprintf(mFile,"\"%s.ag\"",mName.c_str());
 	}
 protected:
-	Guide(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Guide(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
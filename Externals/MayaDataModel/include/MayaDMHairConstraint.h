@@ -20,7 +20,7 @@ public:
 public:
 
 	HairConstraint():Shape(){}
-	HairConstraint(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	HairConstraint(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Shape(file, name, parent, "hairConstraint", shared, create){}
 	virtual ~HairConstraint(){}
 
@@ -33,11 +33,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".cin[%i:%i]\" ", cin_start,cin_end);
 		size_t size = (cin_end-cin_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",cin[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(cin,size);
 		fprintf(mFile,";\n");
 	}
 	void startCurveIndices(size_t cin_start,size_t cin_end)const
@@ -125,7 +121,7 @@ public:
 		fprintf(mFile,"\"%s.opn\"",mName.c_str());
 	}
 protected:
-	HairConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	HairConstraint(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Shape(file, name, parent, nodeType, shared, create) {}
 
 };
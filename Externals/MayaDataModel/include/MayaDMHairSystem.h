@@ -21,7 +21,7 @@ public:
 		float stiffnessScale_Position;
 		float stiffnessScale_FloatValue;
 		unsigned int stiffnessScale_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", stiffnessScale_Position);
 			fprintf(file,"%f ", stiffnessScale_FloatValue);
@@ -32,7 +32,7 @@ public:
 		float attractionScale_Position;
 		float attractionScale_FloatValue;
 		unsigned int attractionScale_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", attractionScale_Position);
 			fprintf(file,"%f ", attractionScale_FloatValue);
@@ -43,7 +43,7 @@ public:
 		float clumpWidthScale_Position;
 		float clumpWidthScale_FloatValue;
 		unsigned int clumpWidthScale_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", clumpWidthScale_Position);
 			fprintf(file,"%f ", clumpWidthScale_FloatValue);
@@ -54,7 +54,7 @@ public:
 		float clumpCurl_Position;
 		float clumpCurl_FloatValue;
 		unsigned int clumpCurl_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", clumpCurl_Position);
 			fprintf(file,"%f ", clumpCurl_FloatValue);
@@ -65,7 +65,7 @@ public:
 		float clumpFlatness_Position;
 		float clumpFlatness_FloatValue;
 		unsigned int clumpFlatness_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", clumpFlatness_Position);
 			fprintf(file,"%f ", clumpFlatness_FloatValue);
@@ -76,7 +76,7 @@ public:
 		float hairWidthScale_Position;
 		float hairWidthScale_FloatValue;
 		unsigned int hairWidthScale_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", hairWidthScale_Position);
 			fprintf(file,"%f ", hairWidthScale_FloatValue);
@@ -87,7 +87,7 @@ public:
 		float hairColorScale_Position;
 		float3 hairColorScale_Color;
 		unsigned int hairColorScale_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", hairColorScale_Position);
 			hairColorScale_Color.write(file);
@@ -99,7 +99,7 @@ public:
 		float displacementScale_Position;
 		float displacementScale_FloatValue;
 		unsigned int displacementScale_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", displacementScale_Position);
 			fprintf(file,"%f ", displacementScale_FloatValue);
@@ -107,12 +107,12 @@ public:
 		}
 	};
 	struct FieldData{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 	struct CollisionData{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
@@ -136,7 +136,7 @@ public:
 		bool miFinalGatherReceive;
 		bool miTransparencyCast;
 		bool miTransparencyReceive;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", miOverrideCaustics);
 			fprintf(file,"%i ", miCausticAccuracy);
@@ -162,7 +162,7 @@ public:
 public:
 
 	HairSystem():Shape(){}
-	HairSystem(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	HairSystem(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Shape(file, name, parent, "hairSystem", shared, create){}
 	virtual ~HairSystem(){}
 
@@ -1880,7 +1880,7 @@ public:
 		fprintf(mFile,"\"%s.orh\"",mName.c_str());
 	}
 protected:
-	HairSystem(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	HairSystem(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Shape(file, name, parent, nodeType, shared, create) {}
 
 };
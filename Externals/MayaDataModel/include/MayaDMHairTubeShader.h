@@ -21,7 +21,7 @@ public:
 		float colorScale_Position;
 		float3 colorScale_Color;
 		unsigned int colorScale_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", colorScale_Position);
 			colorScale_Color.write(file);
@@ -32,7 +32,7 @@ public:
 public:
 
 	HairTubeShader():Reflect(){}
-	HairTubeShader(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	HairTubeShader(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Reflect(file, name, parent, "hairTubeShader", shared, create){}
 	virtual ~HairTubeShader(){}
 
@@ -342,7 +342,7 @@ public:
 		fprintf(mFile,"\"%s.mirf\"",mName.c_str());
 	}
 protected:
-	HairTubeShader(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	HairTubeShader(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Reflect(file, name, parent, nodeType, shared, create) {}
 
 };
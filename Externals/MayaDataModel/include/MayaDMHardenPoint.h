@@ -20,7 +20,7 @@ public:
 public:
 
 	HardenPoint():AbstractBaseCreate(){}
-	HardenPoint(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	HardenPoint(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "hardenPoint", shared, create){}
 	virtual ~HardenPoint(){}
 
@@ -33,11 +33,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".i[%i:%i]\" ", i_start,i_end);
 		size_t size = (i_end-i_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",i_[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(i_,size);
 		fprintf(mFile,";\n");
 	}
 	void startIndex(size_t i_start,size_t i_end)const
@@ -79,7 +75,7 @@ public:
 		fprintf(mFile,"\"%s.oc\"",mName.c_str());
 	}
 protected:
-	HardenPoint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	HardenPoint(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
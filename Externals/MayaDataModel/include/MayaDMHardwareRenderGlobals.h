@@ -20,7 +20,7 @@ public:
 public:
 
 	HardwareRenderGlobals():DependNode(){}
-	HardwareRenderGlobals(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	HardwareRenderGlobals(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "hardwareRenderGlobals", shared, create){}
 	virtual ~HardwareRenderGlobals(){}
 
@@ -322,7 +322,7 @@ public:
 		fprintf(mFile,"\"%s.hwel\"",mName.c_str());
 	}
 protected:
-	HardwareRenderGlobals(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	HardwareRenderGlobals(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	HeightField():SurfaceShape(){}
-	HeightField(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	HeightField(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:SurfaceShape(file, name, parent, "heightField", shared, create){}
 	virtual ~HeightField(){}
 
@@ -93,7 +93,7 @@ public:
 		fprintf(mFile,"\"%s.cnr\"",mName.c_str());
 	}
 protected:
-	HeightField(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	HeightField(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:SurfaceShape(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	HikEffector():Transform(){}
-	HikEffector(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	HikEffector(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Transform(file, name, parent, "hikEffector", shared, create){}
 	virtual ~HikEffector(){}
 
@@ -234,7 +234,7 @@ public:
 		fprintf(mFile,"\"%s.mkl\"",mName.c_str());
 	}
 protected:
-	HikEffector(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	HikEffector(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Transform(file, name, parent, nodeType, shared, create) {}
 
 };
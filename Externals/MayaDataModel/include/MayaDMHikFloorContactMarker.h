@@ -24,7 +24,7 @@ public:
 		bool feetContact;
 		bool fingersContact;
 		bool toesContact;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", drawHandContact);
 			fprintf(file,"%i ", handsContact);
@@ -38,7 +38,7 @@ public:
 		unsigned int handsFloorPivot;
 		unsigned int handsContactType;
 		float handsContactStiffness;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", handsFloorPivot);
 			fprintf(file,"%i ", handsContactType);
@@ -52,7 +52,7 @@ public:
 		float handFront;
 		float handInSide;
 		float handOutSide;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", handHeight);
 			fprintf(file,"%f ", handBack);
@@ -66,7 +66,7 @@ public:
 		unsigned int feetFloorPivot;
 		unsigned int feetContactType;
 		float feetContactStiffness;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", feetFloorPivot);
 			fprintf(file,"%i ", feetContactType);
@@ -80,7 +80,7 @@ public:
 		float footFront;
 		float footInSide;
 		float footOutSide;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", footHeight);
 			fprintf(file,"%f ", footBack);
@@ -93,7 +93,7 @@ public:
 	struct FingersFloorContactSetup{
 		unsigned int fingersContactType;
 		float fingersContactRollStiffness;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", fingersContactType);
 			fprintf(file,"%f", fingersContactRollStiffness);
@@ -102,7 +102,7 @@ public:
 	struct ToesFloorContactSetup{
 		unsigned int toesContactType;
 		float toesContactRollStiffness;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", toesContactType);
 			fprintf(file,"%f", toesContactRollStiffness);
@@ -111,7 +111,7 @@ public:
 public:
 
 	HikFloorContactMarker():Locator(){}
-	HikFloorContactMarker(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	HikFloorContactMarker(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Locator(file, name, parent, "hikFloorContactMarker", shared, create){}
 	virtual ~HikFloorContactMarker(){}
 
@@ -447,7 +447,7 @@ public:
 		fprintf(mFile,"\"%s.fli.fcr\"",mName.c_str());
 	}
 protected:
-	HikFloorContactMarker(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	HikFloorContactMarker(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Locator(file, name, parent, nodeType, shared, create) {}
 
 };
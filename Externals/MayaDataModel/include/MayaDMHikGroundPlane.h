@@ -20,7 +20,7 @@ public:
 public:
 
 	HikGroundPlane():Transform(){}
-	HikGroundPlane(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	HikGroundPlane(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Transform(file, name, parent, "hikGroundPlane", shared, create){}
 	virtual ~HikGroundPlane(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.leng\"",mName.c_str());
 	}
 protected:
-	HikGroundPlane(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	HikGroundPlane(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Transform(file, name, parent, nodeType, shared, create) {}
 
 };
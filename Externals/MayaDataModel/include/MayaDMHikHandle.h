@@ -23,7 +23,7 @@ public:
 		float realisticShoulderSolving;
 		bool solveFingers;
 		unsigned int hipTranslationMode;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", postureType);
 			fprintf(file,"%i ", expertMode);
@@ -37,7 +37,7 @@ public:
 		bool feetFloorContact;
 		bool fingersFloorContact;
 		bool toesFloorContact;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", handsFloorContact);
 			fprintf(file,"%i ", feetFloorContact);
@@ -49,7 +49,7 @@ public:
 		unsigned int handsFloorPivot;
 		unsigned int handsContactType;
 		float handsContactStiffness;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", handsFloorPivot);
 			fprintf(file,"%i ", handsContactType);
@@ -63,7 +63,7 @@ public:
 		float handFront;
 		float handInSide;
 		float handOutSide;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", handHeight);
 			fprintf(file,"%f ", handBack);
@@ -77,7 +77,7 @@ public:
 		unsigned int feetFloorPivot;
 		unsigned int feetContactType;
 		float feetContactStiffness;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", feetFloorPivot);
 			fprintf(file,"%i ", feetContactType);
@@ -91,7 +91,7 @@ public:
 		float footFront;
 		float footInSide;
 		float footOutSide;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", footHeight);
 			fprintf(file,"%f ", footBack);
@@ -104,7 +104,7 @@ public:
 	struct FingersFloorContactSetup{
 		unsigned int fingersContactType;
 		float fingersContactRollStiffness;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", fingersContactType);
 			fprintf(file,"%f", fingersContactRollStiffness);
@@ -123,7 +123,7 @@ public:
 		float rightHandRingTip;
 		float rightHandPinkyTip;
 		float rightHandExtraFingerTip;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", leftHandThumbTip);
 			fprintf(file,"%f ", leftHandIndexTip);
@@ -142,7 +142,7 @@ public:
 	struct ToesFloorContactSetup{
 		unsigned int toesContactType;
 		float toesContactRollStiffness;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", toesContactType);
 			fprintf(file,"%f", toesContactRollStiffness);
@@ -161,7 +161,7 @@ public:
 		float rightFootRingTip;
 		float rightFootPinkyTip;
 		float rightFootExtraFingerTip;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", leftFootThumbTip);
 			fprintf(file,"%f ", leftFootIndexTip);
@@ -179,7 +179,7 @@ public:
 	};
 	struct Head{
 		float headPull;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f", headPull);
 		}
@@ -189,7 +189,7 @@ public:
 		float leftHandPullChest;
 		float leftHandPullHips;
 		float leftFingerBasePull;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", leftElbowPull);
 			fprintf(file,"%f ", leftHandPullChest);
@@ -202,7 +202,7 @@ public:
 		float rightHandPullChest;
 		float rightHandPullHips;
 		float rightFingerBasePull;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", rightElbowPull);
 			fprintf(file,"%f ", rightHandPullChest);
@@ -212,14 +212,14 @@ public:
 	};
 	struct Chest{
 		float chestPull;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f", chestPull);
 		}
 	};
 	struct Hips{
 		float hipsPull;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f", hipsPull);
 		}
@@ -228,7 +228,7 @@ public:
 		float leftKneePull;
 		float leftFootPull;
 		float leftToeBasePull;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", leftKneePull);
 			fprintf(file,"%f ", leftFootPull);
@@ -239,7 +239,7 @@ public:
 		float rightKneePull;
 		float rightFootPull;
 		float rightToeBasePull;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", rightKneePull);
 			fprintf(file,"%f ", rightFootPull);
@@ -248,7 +248,7 @@ public:
 	};
 	struct Extra{
 		float pullIterationCount;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f", pullIterationCount);
 		}
@@ -273,7 +273,7 @@ public:
 		float rightLegStiffness;
 		float rightKneeMaxExtension;
 		float rightKneeCompressionFactor;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", neckStiffness);
 			fprintf(file,"%f ", leftShoulderStiffness);
@@ -301,7 +301,7 @@ public:
 		bool rightElbowKillPitch;
 		bool leftKneeKillPitch;
 		bool rightKneeKillPitch;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", leftElbowKillPitch);
 			fprintf(file,"%i ", rightElbowKillPitch);
@@ -327,7 +327,7 @@ public:
 		float rightUpLegRoll;
 		bool rightLegRollMode;
 		float rightLegRoll;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", rollExtractionMode);
 			fprintf(file,"%i ", leftArmRollMode);
@@ -351,7 +351,7 @@ public:
 public:
 
 	HikHandle():IkHandle(){}
-	HikHandle(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	HikHandle(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:IkHandle(file, name, parent, "hikHandle", shared, create){}
 	virtual ~HikHandle(){}
 
@@ -1764,7 +1764,7 @@ public:
 		fprintf(mFile,"\"%s.re.rlro\"",mName.c_str());
 	}
 protected:
-	HikHandle(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	HikHandle(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:IkHandle(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -19,12 +19,12 @@ class HikSolver : public IkSolver
 public:
 
 	HikSolver():IkSolver(){}
-	HikSolver(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	HikSolver(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:IkSolver(file, name, parent, "hikSolver", shared, create){}
 	virtual ~HikSolver(){}
 
 protected:
-	HikSolver(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	HikSolver(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:IkSolver(file, name, parent, nodeType, shared, create) {}
 
 };
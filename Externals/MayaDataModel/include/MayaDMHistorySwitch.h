@@ -20,7 +20,7 @@ public:
 public:
 
 	HistorySwitch():GeometryFilter(){}
-	HistorySwitch(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	HistorySwitch(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, "historySwitch", shared, create){}
 	virtual ~HistorySwitch(){}
 
@@ -61,7 +61,7 @@ public:
 		fprintf(mFile,"\"%s.op\"",mName.c_str());
 	}
 protected:
-	HistorySwitch(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	HistorySwitch(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	HoldMatrix():DependNode(){}
-	HoldMatrix(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	HoldMatrix(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "holdMatrix", shared, create){}
 	virtual ~HoldMatrix(){}
 
@@ -47,7 +47,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	HoldMatrix(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	HoldMatrix(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	HsvToRgb():DependNode(){}
-	HsvToRgb(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	HsvToRgb(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "hsvToRgb", shared, create){}
 	virtual ~HsvToRgb(){}
 
@@ -79,7 +79,7 @@ public:
 		fprintf(mFile,"\"%s.o.ob\"",mName.c_str());
 	}
 protected:
-	HsvToRgb(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	HsvToRgb(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	HwReflectionMap():DependNode(){}
-	HwReflectionMap(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	HwReflectionMap(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "hwReflectionMap", shared, create){}
 	virtual ~HwReflectionMap(){}
 
@@ -129,7 +129,7 @@ public:
 		fprintf(mFile,"\"%s.crtn\"",mName.c_str());
 	}
 protected:
-	HwReflectionMap(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	HwReflectionMap(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	HwRenderGlobals():DependNode(){}
-	HwRenderGlobals(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	HwRenderGlobals(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "hwRenderGlobals", shared, create){}
 	virtual ~HwRenderGlobals(){}
 
@@ -319,7 +319,7 @@ public:
 		fprintf(mFile,"\"%s.sd\"",mName.c_str());
 	}
 protected:
-	HwRenderGlobals(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	HwRenderGlobals(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	HwShader():DependNode(){}
-	HwShader(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	HwShader(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "hwShader", shared, create){}
 	virtual ~HwShader(){}
 
@@ -120,7 +120,7 @@ public:
 		fprintf(mFile,"\"%s.upar\"",mName.c_str());
 	}
 protected:
-	HwShader(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	HwShader(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	HyperGraphInfo():DependNode(){}
-	HyperGraphInfo(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	HyperGraphInfo(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "hyperGraphInfo", shared, create){}
 	virtual ~HyperGraphInfo(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.b\"",mName.c_str());
 	}
 protected:
-	HyperGraphInfo(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	HyperGraphInfo(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -22,7 +22,7 @@ public:
 		float positionY;
 		bool isCollapsed;
 		bool isFreeform;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", positionX);
 			fprintf(file,"%f ", positionY);
@@ -33,7 +33,7 @@ public:
 public:
 
 	HyperLayout():DependNode(){}
-	HyperLayout(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	HyperLayout(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "hyperLayout", shared, create){}
 	virtual ~HyperLayout(){}
 
@@ -201,7 +201,7 @@ public:
 		fprintf(mFile,"\"%s.anf\"",mName.c_str());
 	}
 protected:
-	HyperLayout(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	HyperLayout(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
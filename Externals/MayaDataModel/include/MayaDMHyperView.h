@@ -20,7 +20,7 @@ public:
 public:
 
 	HyperView():DependNode(){}
-	HyperView(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	HyperView(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "hyperView", shared, create){}
 	virtual ~HyperView(){}
 
@@ -189,7 +189,7 @@ public:
 		fprintf(mFile,"\"%s.hl\"",mName.c_str());
 	}
 protected:
-	HyperView(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	HyperView(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
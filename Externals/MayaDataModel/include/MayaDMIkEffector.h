@@ -20,7 +20,7 @@ public:
 public:
 
 	IkEffector():Transform(){}
-	IkEffector(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	IkEffector(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Transform(file, name, parent, "ikEffector", shared, create){}
 	virtual ~IkEffector(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.hp\"",mName.c_str());
 	}
 protected:
-	IkEffector(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	IkEffector(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Transform(file, name, parent, nodeType, shared, create) {}
 
 };
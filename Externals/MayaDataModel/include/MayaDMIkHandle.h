@@ -20,7 +20,7 @@ public:
 public:
 
 	IkHandle():Transform(){}
-	IkHandle(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	IkHandle(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Transform(file, name, parent, "ikHandle", shared, create){}
 	virtual ~IkHandle(){}
 
@@ -410,7 +410,7 @@ public:
 		fprintf(mFile,"\"%s.sio\"",mName.c_str());
 	}
 protected:
-	IkHandle(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	IkHandle(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Transform(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -19,12 +19,12 @@ class IkSCsolver : public IkSolver
 public:
 
 	IkSCsolver():IkSolver(){}
-	IkSCsolver(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	IkSCsolver(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:IkSolver(file, name, parent, "ikSCsolver", shared, create){}
 	virtual ~IkSCsolver(){}
 
 protected:
-	IkSCsolver(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	IkSCsolver(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:IkSolver(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	IkSolver():DependNode(){}
-	IkSolver(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	IkSolver(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "ikSolver", shared, create){}
 	virtual ~IkSolver(){}
 
@@ -35,7 +35,7 @@ public:
 		fprintf(mFile,"\tsetAttr \".tol\" %f;\n", tol);
 	}
 protected:
-	IkSolver(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	IkSolver(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
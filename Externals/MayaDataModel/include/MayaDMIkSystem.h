@@ -20,7 +20,7 @@ public:
 public:
 
 	IkSystem():DependNode(){}
-	IkSystem(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	IkSystem(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "ikSystem", shared, create){}
 	virtual ~IkSystem(){}
 
@@ -52,7 +52,7 @@ public:
 		fprintf(mFile,"\"%s.sol\"",mName.c_str());
 	}
 protected:
-	IkSystem(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	IkSystem(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
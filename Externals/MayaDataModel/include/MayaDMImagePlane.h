@@ -20,7 +20,7 @@ public:
 public:
 
 	ImagePlane():DependNode(){}
-	ImagePlane(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ImagePlane(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "imagePlane", shared, create){}
 	virtual ~ImagePlane(){}
 
@@ -483,7 +483,7 @@ public:
 		fprintf(mFile,"\"%s.ds\"",mName.c_str());
 	}
 protected:
-	ImagePlane(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ImagePlane(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
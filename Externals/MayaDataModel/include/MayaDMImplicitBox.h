@@ -20,7 +20,7 @@ public:
 public:
 
 	ImplicitBox():GeometryShape(){}
-	ImplicitBox(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ImplicitBox(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryShape(file, name, parent, "implicitBox", shared, create){}
 	virtual ~ImplicitBox(){}
 
@@ -66,7 +66,7 @@ public:
 		fprintf(mFile,"\"%s.siz.szz\"",mName.c_str());
 	}
 protected:
-	ImplicitBox(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ImplicitBox(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryShape(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	ImplicitCone():GeometryShape(){}
-	ImplicitCone(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ImplicitCone(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryShape(file, name, parent, "implicitCone", shared, create){}
 	virtual ~ImplicitCone(){}
 
@@ -47,7 +47,7 @@ public:
 		fprintf(mFile,"\"%s.cap\"",mName.c_str());
 	}
 protected:
-	ImplicitCone(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ImplicitCone(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryShape(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	ImplicitSphere():GeometryShape(){}
-	ImplicitSphere(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ImplicitSphere(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryShape(file, name, parent, "implicitSphere", shared, create){}
 	virtual ~ImplicitSphere(){}
 
@@ -38,7 +38,7 @@ public:
 		fprintf(mFile,"\"%s.rd\"",mName.c_str());
 	}
 protected:
-	ImplicitSphere(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ImplicitSphere(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryShape(file, name, parent, nodeType, shared, create) {}
 
 };
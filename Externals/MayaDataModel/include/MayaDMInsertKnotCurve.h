@@ -20,7 +20,7 @@ public:
 public:
 
 	InsertKnotCurve():AbstractBaseCreate(){}
-	InsertKnotCurve(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	InsertKnotCurve(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "insertKnotCurve", shared, create){}
 	virtual ~InsertKnotCurve(){}
 
@@ -33,11 +33,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".p[%i:%i]\" ", p_start,p_end);
 		size_t size = (p_end-p_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",p[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(p,size);
 		fprintf(mFile,";\n");
 	}
 	void startParameter(size_t p_start,size_t p_end)const
@@ -61,11 +57,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".nk[%i:%i]\" ", nk_start,nk_end);
 		size_t size = (nk_end-nk_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",nk[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(nk,size);
 		fprintf(mFile,";\n");
 	}
 	void startNumberOfKnots(size_t nk_start,size_t nk_end)const
@@ -125,7 +117,7 @@ public:
 		fprintf(mFile,"\"%s.oc\"",mName.c_str());
 	}
 protected:
-	InsertKnotCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	InsertKnotCurve(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
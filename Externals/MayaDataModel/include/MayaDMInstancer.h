@@ -20,7 +20,7 @@ public:
 public:
 
 	Instancer():Transform(){}
-	Instancer(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Instancer(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Transform(file, name, parent, "instancer", shared, create){}
 	virtual ~Instancer(){}
 
@@ -100,7 +100,7 @@ public:
 		fprintf(mFile,"\"%s.hc\"",mName.c_str());
 	}
 protected:
-	Instancer(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Instancer(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Transform(file, name, parent, nodeType, shared, create) {}
 
 };
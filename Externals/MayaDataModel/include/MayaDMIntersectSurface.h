@@ -20,7 +20,7 @@ public:
 public:
 
 	IntersectSurface():AbstractBaseCreate(){}
-	IntersectSurface(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	IntersectSurface(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "intersectSurface", shared, create){}
 	virtual ~IntersectSurface(){}
 
@@ -69,7 +69,7 @@ public:
 		fprintf(mFile,"\"%s.tol\"",mName.c_str());
 	}
 protected:
-	IntersectSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	IntersectSurface(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
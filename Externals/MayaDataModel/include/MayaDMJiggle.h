@@ -19,18 +19,18 @@ class Jiggle : public WeightGeometryFilter
 public:
 	struct CachedDataList{
 		struct CachedData{
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 			}
 		} cachedData;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	Jiggle():WeightGeometryFilter(){}
-	Jiggle(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Jiggle(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:WeightGeometryFilter(file, name, parent, "jiggle", shared, create){}
 	virtual ~Jiggle(){}
 
@@ -124,7 +124,7 @@ public:
 		fprintf(mFile,"\"%s.bias\"",mName.c_str());
 	}
 protected:
-	Jiggle(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Jiggle(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:WeightGeometryFilter(file, name, parent, nodeType, shared, create) {}
 
 };
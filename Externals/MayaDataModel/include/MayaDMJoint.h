@@ -20,7 +20,7 @@ public:
 public:
 
 	Joint():Transform(){}
-	Joint(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Joint(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Transform(file, name, parent, "joint", shared, create){}
 	virtual ~Joint(){}
 
@@ -424,7 +424,7 @@ public:
 		fprintf(mFile,"\"%s.hni\"",mName.c_str());
 	}
 protected:
-	Joint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Joint(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Transform(file, name, parent, nodeType, shared, create) {}
 
 };
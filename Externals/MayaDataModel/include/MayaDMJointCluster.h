@@ -18,24 +18,24 @@ class JointCluster : public Cluster
 {
 public:
 	struct ChildJointClusterXforms{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 	struct NextJointClusterXforms{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 	struct DistanceList{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	JointCluster():Cluster(){}
-	JointCluster(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	JointCluster(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Cluster(file, name, parent, "jointCluster", shared, create){}
 	virtual ~JointCluster(){}
 
@@ -98,11 +98,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".cjm[%i:%i]\" ", cjm_start,cjm_end);
 		size_t size = (cjm_end-cjm_start)*3+3;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",cjm[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(cjm,size);
 		fprintf(mFile,";\n");
 	}
 	void startChildJointMidplaneAxis(size_t cjm_start,size_t cjm_end)const
@@ -404,7 +400,7 @@ public:
 		fprintf(mFile,"\"%s.cfs\"",mName.c_str());
 	}
 protected:
-	JointCluster(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	JointCluster(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Cluster(file, name, parent, nodeType, shared, create) {}
 
 };
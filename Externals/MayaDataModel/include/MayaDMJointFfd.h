@@ -20,7 +20,7 @@ public:
 public:
 
 	JointFfd():Ffd(){}
-	JointFfd(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	JointFfd(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Ffd(file, name, parent, "jointFfd", shared, create){}
 	virtual ~JointFfd(){}
 
@@ -71,7 +71,7 @@ public:
 		fprintf(mFile,"\"%s.uc\"",mName.c_str());
 	}
 protected:
-	JointFfd(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	JointFfd(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Ffd(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	JointLattice():GeometryFilter(){}
-	JointLattice(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	JointLattice(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, "jointLattice", shared, create){}
 	virtual ~JointLattice(){}
 
@@ -199,7 +199,7 @@ public:
 		fprintf(mFile,"\"%s.bm\"",mName.c_str());
 	}
 protected:
-	JointLattice(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	JointLattice(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Lambert():DependNode(){}
-	Lambert(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Lambert(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "lambert", shared, create){}
 	virtual ~Lambert(){}
 
@@ -997,7 +997,7 @@ public:
 		fprintf(mFile,"\"%s.minc.mincz\"",mName.c_str());
 	}
 protected:
-	Lambert(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Lambert(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Lattice():ControlPoint(){}
-	Lattice(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Lattice(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:ControlPoint(file, name, parent, "lattice", shared, create){}
 	virtual ~Lattice(){}
 
@@ -130,7 +130,7 @@ public:
 		fprintf(mFile,"\"%s.or.oz\"",mName.c_str());
 	}
 protected:
-	Lattice(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Lattice(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:ControlPoint(file, name, parent, nodeType, shared, create) {}
 
 };
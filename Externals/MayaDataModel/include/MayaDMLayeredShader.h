@@ -21,7 +21,7 @@ public:
 		float3 color;
 		float3 transparency;
 		float3 glowColor;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			color.write(file);
 			fprintf(file, " ");
@@ -33,7 +33,7 @@ public:
 public:
 
 	LayeredShader():DependNode(){}
-	LayeredShader(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	LayeredShader(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "layeredShader", shared, create){}
 	virtual ~LayeredShader(){}
 
@@ -670,7 +670,7 @@ public:
 		fprintf(mFile,"\"%s.minc.mincz\"",mName.c_str());
 	}
 protected:
-	LayeredShader(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	LayeredShader(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
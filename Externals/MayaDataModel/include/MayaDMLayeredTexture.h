@@ -22,7 +22,7 @@ public:
 		float alpha;
 		unsigned int blendMode;
 		bool isVisible;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			color.write(file);
 			fprintf(file, " ");
@@ -34,7 +34,7 @@ public:
 public:
 
 	LayeredTexture():DependNode(){}
-	LayeredTexture(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	LayeredTexture(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "layeredTexture", shared, create){}
 	virtual ~LayeredTexture(){}
 
@@ -244,7 +244,7 @@ public:
 		fprintf(mFile,"\"%s.ot.otb\"",mName.c_str());
 	}
 protected:
-	LayeredTexture(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	LayeredTexture(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -23,7 +23,7 @@ public:
 			double3 pointPositionXYZ;
 			double3 pointConstraintUVW;
 			double pointWeight;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				pointPositionXYZ.write(file);
 				fprintf(file, " ");
@@ -32,7 +32,7 @@ public:
 				fprintf(file,"%f", pointWeight);
 			}
 		}* pointConstraint;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			worldSpaceToObjectSpace.write(file);
 			fprintf(file, " ");
@@ -50,7 +50,7 @@ public:
 public:
 
 	LeastSquaresModifier():AbstractBaseCreate(){}
-	LeastSquaresModifier(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	LeastSquaresModifier(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "leastSquaresModifier", shared, create){}
 	virtual ~LeastSquaresModifier(){}
 
@@ -194,7 +194,7 @@ public:
 		fprintf(mFile,"\"%s.ac.ono\"",mName.c_str());
 	}
 protected:
-	LeastSquaresModifier(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	LeastSquaresModifier(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Leather():Texture3d(){}
-	Leather(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Leather(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, "leather", shared, create){}
 	virtual ~Leather(){}
 
@@ -187,7 +187,7 @@ public:
 		fprintf(mFile,"\"%s.c\"",mName.c_str());
 	}
 protected:
-	Leather(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Leather(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Light():Shape(){}
-	Light(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Light(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Shape(file, name, parent, "light", shared, create){}
 	virtual ~Light(){}
 
@@ -330,7 +330,7 @@ public:
 		fprintf(mFile,"\"%s.ov.ovb\"",mName.c_str());
 	}
 protected:
-	Light(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Light(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Shape(file, name, parent, nodeType, shared, create) {}
 
 };
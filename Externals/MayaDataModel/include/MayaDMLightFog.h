@@ -20,7 +20,7 @@ public:
 public:
 
 	LightFog():DependNode(){}
-	LightFog(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	LightFog(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "lightFog", shared, create){}
 	virtual ~LightFog(){}
 
@@ -307,7 +307,7 @@ public:
 		fprintf(mFile,"\"%s.ot.otb\"",mName.c_str());
 	}
 protected:
-	LightFog(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	LightFog(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	LightInfo():DependNode(){}
-	LightInfo(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	LightInfo(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "lightInfo", shared, create){}
 	virtual ~LightInfo(){}
 
@@ -94,7 +94,7 @@ public:
 		fprintf(mFile,"\"%s.sd\"",mName.c_str());
 	}
 protected:
-	LightInfo(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	LightInfo(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -18,29 +18,29 @@ class LightLinker : public DependNode
 {
 public:
 	struct Link{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 	struct Ignore{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 	struct ShadowLink{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 	struct ShadowIgnore{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	LightLinker():DependNode(){}
-	LightLinker(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	LightLinker(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "lightLinker", shared, create){}
 	virtual ~LightLinker(){}
 
@@ -277,7 +277,7 @@ public:
 		fprintf(mFile,"\"%s.sign.soig\"",mName.c_str());
 	}
 protected:
-	LightLinker(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	LightLinker(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
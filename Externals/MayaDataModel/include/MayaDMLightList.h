@@ -20,7 +20,7 @@ public:
 public:
 
 	LightList():DependNode(){}
-	LightList(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	LightList(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "lightList", shared, create){}
 	virtual ~LightList(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.ln\"",mName.c_str());
 	}
 protected:
-	LightList(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	LightList(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -21,7 +21,7 @@ public:
 		float dropoff_Position;
 		float dropoff_FloatValue;
 		unsigned int dropoff_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", dropoff_Position);
 			fprintf(file,"%f ", dropoff_FloatValue);
@@ -31,7 +31,7 @@ public:
 public:
 
 	LineModifier():Shape(){}
-	LineModifier(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	LineModifier(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Shape(file, name, parent, "lineModifier", shared, create){}
 	virtual ~LineModifier(){}
 
@@ -362,7 +362,7 @@ public:
 		fprintf(mFile,"\"%s.olm\"",mName.c_str());
 	}
 protected:
-	LineModifier(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	LineModifier(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Shape(file, name, parent, nodeType, shared, create) {}
 
 };
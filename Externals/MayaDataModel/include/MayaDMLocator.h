@@ -20,7 +20,7 @@ public:
 public:
 
 	Locator():GeometryShape(){}
-	Locator(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Locator(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryShape(file, name, parent, "locator", shared, create){}
 	virtual ~Locator(){}
 
@@ -142,7 +142,7 @@ public:
 		fprintf(mFile,"\"%s.los.lsz\"",mName.c_str());
 	}
 protected:
-	Locator(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Locator(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryShape(file, name, parent, nodeType, shared, create) {}
 
 };
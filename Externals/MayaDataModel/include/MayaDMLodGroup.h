@@ -20,7 +20,7 @@ public:
 public:
 
 	LodGroup():Transform(){}
-	LodGroup(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	LodGroup(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Transform(file, name, parent, "lodGroup", shared, create){}
 	virtual ~LodGroup(){}
 
@@ -40,11 +40,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".th[%i:%i]\" ", th_start,th_end);
 		size_t size = (th_end-th_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",th[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(th,size);
 		fprintf(mFile,";\n");
 	}
 	void startThreshold(size_t th_start,size_t th_end)const
@@ -154,7 +150,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	LodGroup(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	LodGroup(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Transform(file, name, parent, nodeType, shared, create) {}
 
 };
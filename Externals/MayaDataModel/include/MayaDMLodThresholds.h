@@ -20,7 +20,7 @@ public:
 public:
 
 	LodThresholds():DependNode(){}
-	LodThresholds(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	LodThresholds(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "lodThresholds", shared, create){}
 	virtual ~LodThresholds(){}
 
@@ -96,11 +96,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".th[%i:%i]\" ", th_start,th_end);
 		size_t size = (th_end-th_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",th[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(th,size);
 		fprintf(mFile,";\n");
 	}
 	void startThreshold(size_t th_start,size_t th_end)const
@@ -190,7 +186,7 @@ public:
 		fprintf(mFile,"\"%s.ol\"",mName.c_str());
 	}
 protected:
-	LodThresholds(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	LodThresholds(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Loft():AbstractBaseCreate(){}
-	Loft(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Loft(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "loft", shared, create){}
 	virtual ~Loft(){}
 
@@ -166,7 +166,7 @@ public:
 		fprintf(mFile,"\"%s.cc\"",mName.c_str());
 	}
 protected:
-	Loft(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Loft(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	LookAt():AimConstraint(){}
-	LookAt(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	LookAt(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AimConstraint(file, name, parent, "lookAt", shared, create){}
 	virtual ~LookAt(){}
 
@@ -52,7 +52,7 @@ public:
 		fprintf(mFile,"\"%s.dc\"",mName.c_str());
 	}
 protected:
-	LookAt(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	LookAt(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AimConstraint(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Luminance():DependNode(){}
-	Luminance(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Luminance(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "luminance", shared, create){}
 	virtual ~Luminance(){}
 
@@ -67,7 +67,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	Luminance(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Luminance(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
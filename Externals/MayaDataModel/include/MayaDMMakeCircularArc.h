@@ -20,7 +20,7 @@ public:
 public:
 
 	MakeCircularArc():AbstractBaseCreate(){}
-	MakeCircularArc(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MakeCircularArc(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "makeCircularArc", shared, create){}
 	virtual ~MakeCircularArc(){}
 
@@ -83,7 +83,7 @@ public:
 		fprintf(mFile,"\"%s.oc\"",mName.c_str());
 	}
 protected:
-	MakeCircularArc(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MakeCircularArc(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
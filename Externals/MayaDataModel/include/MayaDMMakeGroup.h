@@ -20,7 +20,7 @@ public:
 public:
 
 	MakeGroup():DependNode(){}
-	MakeGroup(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MakeGroup(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "makeGroup", shared, create){}
 	virtual ~MakeGroup(){}
 
@@ -72,7 +72,7 @@ public:
 		fprintf(mFile,"\"%s.ic\"",mName.c_str());
 	}
 protected:
-	MakeGroup(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MakeGroup(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
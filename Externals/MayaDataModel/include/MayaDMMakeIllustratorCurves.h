@@ -20,7 +20,7 @@ public:
 public:
 
 	MakeIllustratorCurves():AbstractBaseCreate(){}
-	MakeIllustratorCurves(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MakeIllustratorCurves(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "makeIllustratorCurves", shared, create){}
 	virtual ~MakeIllustratorCurves(){}
 
@@ -112,7 +112,7 @@ public:
 		fprintf(mFile,"\"%s.tl\"",mName.c_str());
 	}
 protected:
-	MakeIllustratorCurves(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MakeIllustratorCurves(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
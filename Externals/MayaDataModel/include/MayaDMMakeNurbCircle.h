@@ -20,7 +20,7 @@ public:
 public:
 
 	MakeNurbCircle():AbstractBaseCreate(){}
-	MakeNurbCircle(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MakeNurbCircle(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "makeNurbCircle", shared, create){}
 	virtual ~MakeNurbCircle(){}
 
@@ -203,7 +203,7 @@ public:
 		fprintf(mFile,"\"%s.oc\"",mName.c_str());
 	}
 protected:
-	MakeNurbCircle(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MakeNurbCircle(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	MakeNurbCone():RevolvedPrimitive(){}
-	MakeNurbCone(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MakeNurbCone(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:RevolvedPrimitive(file, name, parent, "makeNurbCone", shared, create){}
 	virtual ~MakeNurbCone(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.oib\"",mName.c_str());
 	}
 protected:
-	MakeNurbCone(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MakeNurbCone(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:RevolvedPrimitive(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	MakeNurbCube():Primitive(){}
-	MakeNurbCube(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MakeNurbCube(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Primitive(file, name, parent, "makeNurbCube", shared, create){}
 	virtual ~MakeNurbCube(){}
 
@@ -99,7 +99,7 @@ public:
 		fprintf(mFile,"\"%s.os5\"",mName.c_str());
 	}
 protected:
-	MakeNurbCube(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MakeNurbCube(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Primitive(file, name, parent, nodeType, shared, create) {}
 
 };
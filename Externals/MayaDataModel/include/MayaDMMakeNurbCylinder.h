@@ -19,12 +19,12 @@ class MakeNurbCylinder : public RevolvedPrimitive
 public:
 
 	MakeNurbCylinder():RevolvedPrimitive(){}
-	MakeNurbCylinder(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MakeNurbCylinder(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:RevolvedPrimitive(file, name, parent, "makeNurbCylinder", shared, create){}
 	virtual ~MakeNurbCylinder(){}
 
 protected:
-	MakeNurbCylinder(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MakeNurbCylinder(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:RevolvedPrimitive(file, name, parent, nodeType, shared, create) {}
 
 };
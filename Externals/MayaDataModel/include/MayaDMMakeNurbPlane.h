@@ -20,7 +20,7 @@ public:
 public:
 
 	MakeNurbPlane():Primitive(){}
-	MakeNurbPlane(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MakeNurbPlane(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Primitive(file, name, parent, "makeNurbPlane", shared, create){}
 	virtual ~MakeNurbPlane(){}
 
@@ -70,7 +70,7 @@ public:
 		fprintf(mFile,"\"%s.d\"",mName.c_str());
 	}
 protected:
-	MakeNurbPlane(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MakeNurbPlane(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Primitive(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	MakeNurbTorus():RevolvedPrimitive(){}
-	MakeNurbTorus(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MakeNurbTorus(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:RevolvedPrimitive(file, name, parent, "makeNurbTorus", shared, create){}
 	virtual ~MakeNurbTorus(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.msw\"",mName.c_str());
 	}
 protected:
-	MakeNurbTorus(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MakeNurbTorus(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:RevolvedPrimitive(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	MakeNurbsSquare():AbstractBaseCreate(){}
-	MakeNurbsSquare(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MakeNurbsSquare(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "makeNurbsSquare", shared, create){}
 	virtual ~MakeNurbsSquare(){}
 
@@ -151,7 +151,7 @@ public:
 		fprintf(mFile,"\"%s.oc4\"",mName.c_str());
 	}
 protected:
-	MakeNurbsSquare(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MakeNurbsSquare(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
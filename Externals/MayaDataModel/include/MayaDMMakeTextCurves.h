@@ -20,7 +20,7 @@ public:
 public:
 
 	MakeTextCurves():AbstractBaseCreate(){}
-	MakeTextCurves(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MakeTextCurves(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "makeTextCurves", shared, create){}
 	virtual ~MakeTextCurves(){}
 
@@ -101,7 +101,7 @@ public:
 		fprintf(mFile,"\"%s.c\"",mName.c_str());
 	}
 protected:
-	MakeTextCurves(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MakeTextCurves(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
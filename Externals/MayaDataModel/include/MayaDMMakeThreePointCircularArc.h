@@ -20,7 +20,7 @@ public:
 public:
 
 	MakeThreePointCircularArc():MakeCircularArc(){}
-	MakeThreePointCircularArc(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MakeThreePointCircularArc(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:MakeCircularArc(file, name, parent, "makeThreePointCircularArc", shared, create){}
 	virtual ~MakeThreePointCircularArc(){}
 
@@ -140,7 +140,7 @@ public:
 		fprintf(mFile,"\"%s.r\"",mName.c_str());
 	}
 protected:
-	MakeThreePointCircularArc(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MakeThreePointCircularArc(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:MakeCircularArc(file, name, parent, nodeType, shared, create) {}
 
 };
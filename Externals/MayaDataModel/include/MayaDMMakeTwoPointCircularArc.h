@@ -20,7 +20,7 @@ public:
 public:
 
 	MakeTwoPointCircularArc():MakeCircularArc(){}
-	MakeTwoPointCircularArc(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MakeTwoPointCircularArc(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:MakeCircularArc(file, name, parent, "makeTwoPointCircularArc", shared, create){}
 	virtual ~MakeTwoPointCircularArc(){}
 
@@ -154,7 +154,7 @@ public:
 		fprintf(mFile,"\"%s.tac\"",mName.c_str());
 	}
 protected:
-	MakeTwoPointCircularArc(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MakeTwoPointCircularArc(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:MakeCircularArc(file, name, parent, nodeType, shared, create) {}
 
 };
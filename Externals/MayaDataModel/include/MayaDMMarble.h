@@ -20,7 +20,7 @@ public:
 public:
 
 	Marble():Texture3d(){}
-	Marble(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Marble(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, "marble", shared, create){}
 	virtual ~Marble(){}
 
@@ -270,7 +270,7 @@ public:
 		fprintf(mFile,"\"%s.ra\"",mName.c_str());
 	}
 protected:
-	Marble(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Marble(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, nodeType, shared, create) {}
 
 };
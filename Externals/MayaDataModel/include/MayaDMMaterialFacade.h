@@ -20,7 +20,7 @@ public:
 public:
 
 	MaterialFacade():Facade(){}
-	MaterialFacade(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MaterialFacade(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Facade(file, name, parent, "materialFacade", shared, create){}
 	virtual ~MaterialFacade(){}
 
@@ -78,7 +78,7 @@ public:
 		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
 	}
 protected:
-	MaterialFacade(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MaterialFacade(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Facade(file, name, parent, nodeType, shared, create) {}
 
 };
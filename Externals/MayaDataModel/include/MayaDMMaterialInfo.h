@@ -20,7 +20,7 @@ public:
 public:
 
 	MaterialInfo():DependNode(){}
-	MaterialInfo(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MaterialInfo(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "materialInfo", shared, create){}
 	virtual ~MaterialInfo(){}
 
@@ -59,7 +59,7 @@ public:
 		fprintf(mFile,"\"%s.tmip\"",mName.c_str());
 	}
 protected:
-	MaterialInfo(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MaterialInfo(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -18,7 +18,7 @@ class MentalrayIblShape
 public:
 public:
 protected:
-	FILE* mFile;
+	Writer* mFile;
 	std::string mName;
 	std::string mParent;
 	std::string mNodeType;
@@ -40,7 +40,7 @@ public:
 	{
 		return mNodeType;
 	}
-	void setFile(FILE* file)
+	void setFile(Writer* file)
 	{
 		mFile = file;
 	}
@@ -769,7 +769,7 @@ public:
 		fprintf(mFile,"\"%s.pco.pcob\"",mName.c_str());
 	}
 protected:
-	MentalrayIblShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MentalrayIblShape(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:mFile(file), mName(name), mParent(parent), mNodeType(nodeType), mShared(shared) 
 	{
 		if(create)
@@ -21,7 +21,7 @@ public:
 		int miWidth;
 		int miHeight;
 		unsigned int miDepth;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", miWidth);
 			fprintf(file,"%i ", miHeight);
@@ -31,7 +31,7 @@ public:
 public:
 
 	MentalrayTexture():DependNode(){}
-	MentalrayTexture(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MentalrayTexture(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "mentalrayTexture", shared, create){}
 	virtual ~MentalrayTexture(){}
 
@@ -129,7 +129,7 @@ public:
 		fprintf(mFile,"\"%s.mifr.midp\"",mName.c_str());
 	}
 protected:
-	MentalrayTexture(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MentalrayTexture(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
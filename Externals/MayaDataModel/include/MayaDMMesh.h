@@ -22,7 +22,7 @@ public:
 		float colorG;
 		float colorB;
 		float colorA;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", colorR);
 			fprintf(file,"%f ", colorG);
@@ -37,14 +37,14 @@ public:
 			struct VertexFaceColor{
 				float3 vertexFaceColorRGB;
 				float vertexFaceAlpha;
-				void write(FILE* file) const
+				void write(Writer* file) const
 				{
 					vertexFaceColorRGB.write(file);
 					fprintf(file, " ");
 					fprintf(file,"%f", vertexFaceAlpha);
 				}
 			}* vertexFaceColor;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				vertexColorRGB.write(file);
 				fprintf(file, " ");
@@ -57,7 +57,7 @@ public:
 				}
 			}
 		}* vertexColor;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(vertexColor)/sizeof(VertexColor);
 			for(size_t i=0; i<size; ++i)
@@ -72,12 +72,12 @@ public:
 			float3 vertexNormalXYZ;
 			struct VertexFaceNormal{
 				float3 vertexFaceNormalXYZ;
-				void write(FILE* file) const
+				void write(Writer* file) const
 				{
 					vertexFaceNormalXYZ.write(file);
 				}
 			}* vertexFaceNormal;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				vertexNormalXYZ.write(file);
 				fprintf(file, " ");
@@ -89,7 +89,7 @@ public:
 				}
 			}
 		}* vertexNormal;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(vertexNormal)/sizeof(VertexNormal);
 			for(size_t i=0; i<size; ++i)
@@ -121,7 +121,7 @@ public:
 		bool miTransparencyReceive;
 		bool miReflectionReceive;
 		bool miRefractionReceive;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", miOverrideCaustics);
 			fprintf(file,"%i ", miCausticAccuracy);
@@ -149,7 +149,7 @@ public:
 public:
 
 	Mesh():SurfaceShape(){}
-	Mesh(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Mesh(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:SurfaceShape(file, name, parent, "mesh", shared, create){}
 	virtual ~Mesh(){}
 
@@ -306,11 +306,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".pt[%i:%i]\" ", pt_start,pt_end);
 		size_t size = (pt_end-pt_start)*3+3;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",pt[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(pt,size);
 		fprintf(mFile,";\n");
 	}
 	void startPnts(size_t pt_start,size_t pt_end)const
@@ -350,11 +346,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".vt[%i:%i]\" ", vt_start,vt_end);
 		size_t size = (vt_end-vt_start)*3+3;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",vt[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(vt,size);
 		fprintf(mFile,";\n");
 	}
 	void startVrts(size_t vt_start,size_t vt_end)const
@@ -365,6 +357,12 @@ public:
 	{
 		fprintf(mFile," %f",vt);
 	}
+	void appendVrts(const float* vt,size_t count)const
+	{
+		if(count == 0) return;
+		fprintf(mFile," ");
+		mFile->writeFloatArray(vt,count);
+	}
 	void endVrts()const
 	{
 		fprintf(mFile,";\n");
@@ -394,11 +392,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ed[%i:%i]\" ", ed_start,ed_end);
 		size_t size = (ed_end-ed_start)*3+3;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",ed[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(ed,size);
 		fprintf(mFile,";\n");
 	}
 	void startEdge(size_t ed_start,size_t ed_end)const
@@ -409,6 +403,12 @@ public:
 	{
 		fprintf(mFile," %i",ed);
 	}
+	void appendEdge(const int* ed,size_t count)const
+	{
+		if(count == 0) return;
+		fprintf(mFile," ");
+		mFile->writeIntArray(ed,count);
+	}
 	void endEdge()const
 	{
 		fprintf(mFile,";\n");
@@ -438,11 +438,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".uv[%i:%i]\" ", uv_start,uv_end);
 		size_t size = (uv_end-uv_start)*2+2;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",uv[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(uv,size);
 		fprintf(mFile,";\n");
 	}
 	void startUvpt(size_t uv_start,size_t uv_end)const
@@ -453,6 +449,12 @@ public:
 	{
 		fprintf(mFile," %f",uv);
 	}
+	void appendUvpt(const float* uv,size_t count)const
+	{
+		if(count == 0) return;
+		fprintf(mFile," ");
+		mFile->writeFloatArray(uv,count);
+	}
 	void endUvpt()const
 	{
 		fprintf(mFile,";\n");
@@ -528,11 +530,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".n[%i:%i]\" ", n_start,n_end);
 		size_t size = (n_end-n_start)*3+3;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",n[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(n,size);
 		fprintf(mFile,";\n");
 	}
 	void startNormals(size_t n_start,size_t n_end)const
@@ -543,6 +541,12 @@ public:
 	{
 		fprintf(mFile," %f",n);
 	}
+	void appendNormals(const float* n,size_t count)const
+	{
+		if(count == 0) return;
+		fprintf(mFile," ");
+		mFile->writeFloatArray(n,count);
+	}
 	void endNormals()const
 	{
 		fprintf(mFile,";\n");
@@ -974,11 +978,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".pii[%i:%i]\" ", pii_start,pii_end);
 		size_t size = (pii_end-pii_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",pii[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(pii,size);
 		fprintf(mFile,";\n");
 	}
 	void startPerInstanceIndex(size_t pii_start,size_t pii_end)const
@@ -1002,11 +1002,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".pit[%i:%i]\" ", pit_start,pit_end);
 		size_t size = (pit_end-pit_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",pit[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(pit,size);
 		fprintf(mFile,";\n");
 	}
 	void startPerInstanceTag(size_t pit_start,size_t pit_end)const
@@ -1653,7 +1649,7 @@ public:
 		fprintf(mFile,"\"%s.dags\"",mName.c_str());
 	}
 protected:
-	Mesh(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Mesh(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:SurfaceShape(file, name, parent, nodeType, shared, create) {}
 
 };
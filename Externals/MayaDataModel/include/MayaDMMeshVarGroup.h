@@ -20,7 +20,7 @@ public:
 public:
 
 	MeshVarGroup():BaseGeometryVarGroup(){}
-	MeshVarGroup(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MeshVarGroup(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:BaseGeometryVarGroup(file, name, parent, "meshVarGroup", shared, create){}
 	virtual ~MeshVarGroup(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.l\"",mName.c_str());
 	}
 protected:
-	MeshVarGroup(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MeshVarGroup(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:BaseGeometryVarGroup(file, name, parent, nodeType, shared, create) {}
 
 };
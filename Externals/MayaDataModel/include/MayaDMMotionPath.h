@@ -20,7 +20,7 @@ public:
 public:
 
 	MotionPath():DependNode(){}
-	MotionPath(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MotionPath(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "motionPath", shared, create){}
 	virtual ~MotionPath(){}
 
@@ -58,11 +58,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".pmt[%i:%i]\" ", pmt_start,pmt_end);
 		size_t size = (pmt_end-pmt_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",pmt[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(pmt,size);
 		fprintf(mFile,";\n");
 	}
 	void startPositionMarkerTime(size_t pmt_start,size_t pmt_end)const
@@ -86,11 +82,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".omt[%i:%i]\" ", omt_start,omt_end);
 		size_t size = (omt_end-omt_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",omt[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(omt,size);
 		fprintf(mFile,";\n");
 	}
 	void startOrientationMarkerTime(size_t omt_start,size_t omt_end)const
@@ -327,7 +319,7 @@ public:
 		fprintf(mFile,"\"%s.bl\"",mName.c_str());
 	}
 protected:
-	MotionPath(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MotionPath(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Mountain():Texture2d(){}
-	Mountain(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Mountain(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, "mountain", shared, create){}
 	virtual ~Mountain(){}
 
@@ -173,7 +173,7 @@ public:
 		fprintf(mFile,"\"%s.dmx\"",mName.c_str());
 	}
 protected:
-	Mountain(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Mountain(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, nodeType, shared, create) {}
 
 };
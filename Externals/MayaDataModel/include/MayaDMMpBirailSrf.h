@@ -20,7 +20,7 @@ public:
 public:
 
 	MpBirailSrf():BirailSrf(){}
-	MpBirailSrf(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MpBirailSrf(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:BirailSrf(file, name, parent, "mpBirailSrf", shared, create){}
 	virtual ~MpBirailSrf(){}
 
@@ -52,7 +52,7 @@ public:
 		fprintf(mFile,"\"%s.tp2\"",mName.c_str());
 	}
 protected:
-	MpBirailSrf(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MpBirailSrf(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:BirailSrf(file, name, parent, nodeType, shared, create) {}
 
 };
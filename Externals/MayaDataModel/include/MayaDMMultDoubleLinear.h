@@ -20,7 +20,7 @@ public:
 public:
 
 	MultDoubleLinear():DependNode(){}
-	MultDoubleLinear(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MultDoubleLinear(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "multDoubleLinear", shared, create){}
 	virtual ~MultDoubleLinear(){}
 
@@ -47,7 +47,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	MultDoubleLinear(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MultDoubleLinear(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
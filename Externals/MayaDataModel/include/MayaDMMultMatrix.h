@@ -20,7 +20,7 @@ public:
 public:
 
 	MultMatrix():DependNode(){}
-	MultMatrix(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MultMatrix(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "multMatrix", shared, create){}
 	virtual ~MultMatrix(){}
 
@@ -70,7 +70,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	MultMatrix(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MultMatrix(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
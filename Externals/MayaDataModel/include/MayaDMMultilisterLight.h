@@ -20,7 +20,7 @@ public:
 public:
 
 	MultilisterLight():DependNode(){}
-	MultilisterLight(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MultilisterLight(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "multilisterLight", shared, create){}
 	virtual ~MultilisterLight(){}
 
@@ -123,7 +123,7 @@ public:
 		fprintf(mFile,"\"%s.ltd.lbd\"",mName.c_str());
 	}
 protected:
-	MultilisterLight(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MultilisterLight(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
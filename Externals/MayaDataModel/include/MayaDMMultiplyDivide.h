@@ -20,7 +20,7 @@ public:
 public:
 
 	MultiplyDivide():DependNode(){}
-	MultiplyDivide(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	MultiplyDivide(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "multiplyDivide", shared, create){}
 	virtual ~MultiplyDivide(){}
 
@@ -126,7 +126,7 @@ public:
 		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
 	}
 protected:
-	MultiplyDivide(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	MultiplyDivide(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
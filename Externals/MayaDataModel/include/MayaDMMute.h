@@ -20,7 +20,7 @@ public:
 public:
 
 	Mute():DependNode(){}
-	Mute(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Mute(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "mute", shared, create){}
 	virtual ~Mute(){}
 
@@ -55,7 +55,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	Mute(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Mute(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	NCloth():NParticle(){}
-	NCloth(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	NCloth(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:NParticle(file, name, parent, "nCloth", shared, create){}
 	virtual ~NCloth(){}
 
@@ -569,7 +569,7 @@ public:
 		fprintf(mFile,"\"%s.wmt\"",mName.c_str());
 	}
 protected:
-	NCloth(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	NCloth(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:NParticle(file, name, parent, nodeType, shared, create) {}
 
 };
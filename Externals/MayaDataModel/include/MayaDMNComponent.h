@@ -20,7 +20,7 @@ public:
 public:
 
 	NComponent():DependNode(){}
-	NComponent(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	NComponent(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "nComponent", shared, create){}
 	virtual ~NComponent(){}
 
@@ -104,11 +104,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ci[%i:%i]\" ", ci_start,ci_end);
 		size_t size = (ci_end-ci_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",ci[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(ci,size);
 		fprintf(mFile,";\n");
 	}
 	void startComponentIndices(size_t ci_start,size_t ci_end)const
@@ -224,7 +220,7 @@ public:
 		fprintf(mFile,"\"%s.wmt\"",mName.c_str());
 	}
 protected:
-	NComponent(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	NComponent(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	NParticle():Particle(){}
-	NParticle(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	NParticle(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Particle(file, name, parent, "nParticle", shared, create){}
 	virtual ~NParticle(){}
 
@@ -469,7 +469,7 @@ public:
 		fprintf(mFile,"\"%s.dcl.dcb\"",mName.c_str());
 	}
 protected:
-	NParticle(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	NParticle(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Particle(file, name, parent, nodeType, shared, create) {}
 
 };
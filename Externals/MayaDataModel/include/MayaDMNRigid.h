@@ -20,7 +20,7 @@ public:
 public:
 
 	NRigid():NParticle(){}
-	NRigid(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	NRigid(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:NParticle(file, name, parent, "nRigid", shared, create){}
 	virtual ~NRigid(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.svds\"",mName.c_str());
 	}
 protected:
-	NRigid(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	NRigid(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:NParticle(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Network():DependNode(){}
-	Network(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Network(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "network", shared, create){}
 	virtual ~Network(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.ab\"",mName.c_str());
 	}
 protected:
-	Network(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Network(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	NewtonField():Field(){}
-	NewtonField(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	NewtonField(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Field(file, name, parent, "newtonField", shared, create){}
 	virtual ~NewtonField(){}
 
@@ -45,7 +45,7 @@ public:
 		fprintf(mFile,"\"%s.omd\"",mName.c_str());
 	}
 protected:
-	NewtonField(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	NewtonField(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Field(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Noise():Texture2d(){}
-	Noise(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Noise(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, "noise", shared, create){}
 	virtual ~Noise(){}
 
@@ -198,7 +198,7 @@ public:
 		fprintf(mFile,"\"%s.imc.imv\"",mName.c_str());
 	}
 protected:
-	Noise(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Noise(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	NonAmbientLightShapeNode():RenderLight(){}
-	NonAmbientLightShapeNode(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	NonAmbientLightShapeNode(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:RenderLight(file, name, parent, "nonAmbientLightShapeNode", shared, create){}
 	virtual ~NonAmbientLightShapeNode(){}
 
@@ -52,7 +52,7 @@ public:
 		fprintf(mFile,"\"%s.esp\"",mName.c_str());
 	}
 protected:
-	NonAmbientLightShapeNode(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	NonAmbientLightShapeNode(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:RenderLight(file, name, parent, nodeType, shared, create) {}
 
 };
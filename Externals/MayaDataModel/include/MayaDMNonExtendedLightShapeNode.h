@@ -20,7 +20,7 @@ public:
 public:
 
 	NonExtendedLightShapeNode():NonAmbientLightShapeNode(){}
-	NonExtendedLightShapeNode(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	NonExtendedLightShapeNode(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:NonAmbientLightShapeNode(file, name, parent, "nonExtendedLightShapeNode", shared, create){}
 	virtual ~NonExtendedLightShapeNode(){}
 
@@ -310,7 +310,7 @@ public:
 		fprintf(mFile,"\"%s.gs\"",mName.c_str());
 	}
 protected:
-	NonExtendedLightShapeNode(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	NonExtendedLightShapeNode(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:NonAmbientLightShapeNode(file, name, parent, nodeType, shared, create) {}
 
 };
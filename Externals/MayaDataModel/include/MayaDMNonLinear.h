@@ -20,7 +20,7 @@ public:
 public:
 
 	NonLinear():GeometryFilter(){}
-	NonLinear(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	NonLinear(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, "nonLinear", shared, create){}
 	virtual ~NonLinear(){}
 
@@ -40,7 +40,7 @@ public:
 		fprintf(mFile,"\"%s.ma\"",mName.c_str());
 	}
 protected:
-	NonLinear(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	NonLinear(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, nodeType, shared, create) {}
 
 };
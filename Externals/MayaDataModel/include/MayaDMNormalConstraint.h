@@ -19,7 +19,7 @@ class NormalConstraint : public Constraint
 public:
 	struct Target{
 		double targetWeight;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f", targetWeight);
 		}
@@ -27,7 +27,7 @@ public:
 public:
 
 	NormalConstraint():Constraint(){}
-	NormalConstraint(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	NormalConstraint(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Constraint(file, name, parent, "normalConstraint", shared, create){}
 	virtual ~NormalConstraint(){}
 
@@ -463,7 +463,7 @@ public:
 		fprintf(mFile,"\"%s.rsrr.rrz\"",mName.c_str());
 	}
 protected:
-	NormalConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	NormalConstraint(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Constraint(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Nucleus():DependNode(){}
-	Nucleus(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Nucleus(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "nucleus", shared, create){}
 	virtual ~Nucleus(){}
 
@@ -402,7 +402,7 @@ public:
 		fprintf(mFile,"\"%s.spsc\"",mName.c_str());
 	}
 protected:
-	Nucleus(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Nucleus(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
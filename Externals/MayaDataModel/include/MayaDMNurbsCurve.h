@@ -20,7 +20,7 @@ public:
 public:
 
 	NurbsCurve():CurveShape(){}
-	NurbsCurve(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	NurbsCurve(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:CurveShape(file, name, parent, "nurbsCurve", shared, create){}
 	virtual ~NurbsCurve(){}
 
@@ -201,7 +201,7 @@ public:
 		fprintf(mFile,"\"%s.mmv.max\"",mName.c_str());
 	}
 protected:
-	NurbsCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	NurbsCurve(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:CurveShape(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	NurbsDimShape():DimensionShape(){}
-	NurbsDimShape(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	NurbsDimShape(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DimensionShape(file, name, parent, "nurbsDimShape", shared, create){}
 	virtual ~NurbsDimShape(){}
 
@@ -47,7 +47,7 @@ public:
 		fprintf(mFile,"\"%s.ng\"",mName.c_str());
 	}
 protected:
-	NurbsDimShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	NurbsDimShape(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DimensionShape(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -39,7 +39,7 @@ public:
 		bool miTransparencyReceive;
 		bool miReflectionReceive;
 		bool miRefractionReceive;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", miOverrideCaustics);
 			fprintf(file,"%i ", miCausticAccuracy);
@@ -67,7 +67,7 @@ public:
 public:
 
 	NurbsSurface():SurfaceShape(){}
-	NurbsSurface(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	NurbsSurface(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:SurfaceShape(file, name, parent, "nurbsSurface", shared, create){}
 	virtual ~NurbsSurface(){}
 
@@ -726,7 +726,7 @@ public:
 		fprintf(mFile,"\"%s.mrc.rfrr\"",mName.c_str());
 	}
 protected:
-	NurbsSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	NurbsSurface(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:SurfaceShape(file, name, parent, nodeType, shared, create) {}
 
 };
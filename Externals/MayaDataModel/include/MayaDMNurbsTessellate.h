@@ -20,7 +20,7 @@ public:
 public:
 
 	NurbsTessellate():ParentTessellate(){}
-	NurbsTessellate(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	NurbsTessellate(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:ParentTessellate(file, name, parent, "nurbsTessellate", shared, create){}
 	virtual ~NurbsTessellate(){}
 
@@ -83,7 +83,7 @@ public:
 		fprintf(mFile,"\"%s.cvt\"",mName.c_str());
 	}
 protected:
-	NurbsTessellate(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	NurbsTessellate(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:ParentTessellate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	NurbsToSubdiv():AbstractBaseNurbsConversion(){}
-	NurbsToSubdiv(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	NurbsToSubdiv(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseNurbsConversion(file, name, parent, "nurbsToSubdiv", shared, create){}
 	virtual ~NurbsToSubdiv(){}
 
@@ -69,7 +69,7 @@ public:
 		fprintf(mFile,"\"%s.cp\"",mName.c_str());
 	}
 protected:
-	NurbsToSubdiv(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	NurbsToSubdiv(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseNurbsConversion(file, name, parent, nodeType, shared, create) {}
 
 };
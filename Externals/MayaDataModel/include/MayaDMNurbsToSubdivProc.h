@@ -20,7 +20,7 @@ public:
 public:
 
 	NurbsToSubdivProc():NurbsToSubdiv(){}
-	NurbsToSubdivProc(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	NurbsToSubdivProc(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:NurbsToSubdiv(file, name, parent, "nurbsToSubdivProc", shared, create){}
 	virtual ~NurbsToSubdivProc(){}
 
@@ -80,7 +80,7 @@ public:
 		fprintf(mFile,"\"%s.biv\"",mName.c_str());
 	}
 protected:
-	NurbsToSubdivProc(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	NurbsToSubdivProc(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:NurbsToSubdiv(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	ObjectAttrFilter():ObjectFilter(){}
-	ObjectAttrFilter(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ObjectAttrFilter(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:ObjectFilter(file, name, parent, "objectAttrFilter", shared, create){}
 	virtual ~ObjectAttrFilter(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.atyp\"",mName.c_str());
 	}
 protected:
-	ObjectAttrFilter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ObjectAttrFilter(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:ObjectFilter(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	ObjectBinFilter():ObjectFilter(){}
-	ObjectBinFilter(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ObjectBinFilter(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:ObjectFilter(file, name, parent, "objectBinFilter", shared, create){}
 	virtual ~ObjectBinFilter(){}
 
@@ -36,7 +36,7 @@ public:
 		fprintf(mFile,"\"%s.bnam\"",mName.c_str());
 	}
 protected:
-	ObjectBinFilter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ObjectBinFilter(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:ObjectFilter(file, name, parent, nodeType, shared, create) {}
 
 };
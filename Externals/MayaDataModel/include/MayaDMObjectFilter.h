@@ -20,7 +20,7 @@ public:
 public:
 
 	ObjectFilter():DependNode(){}
-	ObjectFilter(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ObjectFilter(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "objectFilter", shared, create){}
 	virtual ~ObjectFilter(){}
 
@@ -90,7 +90,7 @@ public:
 		fprintf(mFile,"\"%s.fcls\"",mName.c_str());
 	}
 protected:
-	ObjectFilter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ObjectFilter(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
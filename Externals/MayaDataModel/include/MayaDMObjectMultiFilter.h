@@ -20,7 +20,7 @@ public:
 public:
 
 	ObjectMultiFilter():ObjectFilter(){}
-	ObjectMultiFilter(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ObjectMultiFilter(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:ObjectFilter(file, name, parent, "objectMultiFilter", shared, create){}
 	virtual ~ObjectMultiFilter(){}
 
@@ -38,7 +38,7 @@ public:
 		fprintf(mFile,"\"%s.ftyp\"",mName.c_str());
 	}
 protected:
-	ObjectMultiFilter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ObjectMultiFilter(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:ObjectFilter(file, name, parent, nodeType, shared, create) {}
 
 };
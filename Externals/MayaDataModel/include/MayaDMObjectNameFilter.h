@@ -20,7 +20,7 @@ public:
 public:
 
 	ObjectNameFilter():ObjectFilter(){}
-	ObjectNameFilter(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ObjectNameFilter(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:ObjectFilter(file, name, parent, "objectNameFilter", shared, create){}
 	virtual ~ObjectNameFilter(){}
 
@@ -56,7 +56,7 @@ public:
 		fprintf(mFile,"\"%s.attr\"",mName.c_str());
 	}
 protected:
-	ObjectNameFilter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ObjectNameFilter(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:ObjectFilter(file, name, parent, nodeType, shared, create) {}
 
 };
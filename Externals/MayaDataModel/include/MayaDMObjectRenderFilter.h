@@ -20,7 +20,7 @@ public:
 public:
 
 	ObjectRenderFilter():ObjectFilter(){}
-	ObjectRenderFilter(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ObjectRenderFilter(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:ObjectFilter(file, name, parent, "objectRenderFilter", shared, create){}
 	virtual ~ObjectRenderFilter(){}
 
@@ -124,7 +124,7 @@ public:
 		fprintf(mFile,"\"%s.ls\"",mName.c_str());
 	}
 protected:
-	ObjectRenderFilter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ObjectRenderFilter(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:ObjectFilter(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	ObjectScriptFilter():ObjectFilter(){}
-	ObjectScriptFilter(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ObjectScriptFilter(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:ObjectFilter(file, name, parent, "objectScriptFilter", shared, create){}
 	virtual ~ObjectScriptFilter(){}
 
@@ -63,7 +63,7 @@ public:
 		fprintf(mFile,"\"%s.unn\"",mName.c_str());
 	}
 protected:
-	ObjectScriptFilter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ObjectScriptFilter(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:ObjectFilter(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	ObjectSet():Entity(){}
-	ObjectSet(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ObjectSet(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Entity(file, name, parent, "objectSet", shared, create){}
 	virtual ~ObjectSet(){}
 
@@ -111,7 +111,7 @@ public:
 		fprintf(mFile,"\"%s.ub\"",mName.c_str());
 	}
 protected:
-	ObjectSet(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ObjectSet(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Entity(file, name, parent, nodeType, shared, create) {}
 
 };
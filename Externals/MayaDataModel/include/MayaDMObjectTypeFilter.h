@@ -20,7 +20,7 @@ public:
 public:
 
 	ObjectTypeFilter():ObjectFilter(){}
-	ObjectTypeFilter(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ObjectTypeFilter(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:ObjectFilter(file, name, parent, "objectTypeFilter", shared, create){}
 	virtual ~ObjectTypeFilter(){}
 
@@ -40,7 +40,7 @@ public:
 		fprintf(mFile,"\"%s.typ\"",mName.c_str());
 	}
 protected:
-	ObjectTypeFilter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ObjectTypeFilter(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:ObjectFilter(file, name, parent, nodeType, shared, create) {}
 
 };
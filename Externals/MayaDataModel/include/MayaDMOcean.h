@@ -21,7 +21,7 @@ public:
 		float waveHeight_Position;
 		float waveHeight_FloatValue;
 		unsigned int waveHeight_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", waveHeight_Position);
 			fprintf(file,"%f ", waveHeight_FloatValue);
@@ -32,7 +32,7 @@ public:
 		float waveTurbulence_Position;
 		float waveTurbulence_FloatValue;
 		unsigned int waveTurbulence_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", waveTurbulence_Position);
 			fprintf(file,"%f ", waveTurbulence_FloatValue);
@@ -43,7 +43,7 @@ public:
 		float wavePeaking_Position;
 		float wavePeaking_FloatValue;
 		unsigned int wavePeaking_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", wavePeaking_Position);
 			fprintf(file,"%f ", wavePeaking_FloatValue);
@@ -53,7 +53,7 @@ public:
 public:
 
 	Ocean():Texture2d(){}
-	Ocean(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Ocean(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, "ocean", shared, create){}
 	virtual ~Ocean(){}
 
@@ -427,7 +427,7 @@ public:
 		fprintf(mFile,"\"%s.ofm\"",mName.c_str());
 	}
 protected:
-	Ocean(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Ocean(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -21,7 +21,7 @@ public:
 		float environment_Position;
 		float3 environment_Color;
 		unsigned int environment_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", environment_Position);
 			environment_Color.write(file);
@@ -33,7 +33,7 @@ public:
 		float waveHeight_Position;
 		float waveHeight_FloatValue;
 		unsigned int waveHeight_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", waveHeight_Position);
 			fprintf(file,"%f ", waveHeight_FloatValue);
@@ -44,7 +44,7 @@ public:
 		float waveTurbulence_Position;
 		float waveTurbulence_FloatValue;
 		unsigned int waveTurbulence_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", waveTurbulence_Position);
 			fprintf(file,"%f ", waveTurbulence_FloatValue);
@@ -55,7 +55,7 @@ public:
 		float wavePeaking_Position;
 		float wavePeaking_FloatValue;
 		unsigned int wavePeaking_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", wavePeaking_Position);
 			fprintf(file,"%f ", wavePeaking_FloatValue);
@@ -65,7 +65,7 @@ public:
 public:
 
 	OceanShader():DependNode(){}
-	OceanShader(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	OceanShader(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "oceanShader", shared, create){}
 	virtual ~OceanShader(){}
 
@@ -1705,7 +1705,7 @@ public:
 		fprintf(mFile,"\"%s.minc.mincz\"",mName.c_str());
 	}
 protected:
-	OceanShader(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	OceanShader(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	OffsetCos():AbstractBaseCreate(){}
-	OffsetCos(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	OffsetCos(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "offsetCos", shared, create){}
 	virtual ~OffsetCos(){}
 
@@ -101,7 +101,7 @@ public:
 		fprintf(mFile,"\"%s.oc\"",mName.c_str());
 	}
 protected:
-	OffsetCos(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	OffsetCos(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
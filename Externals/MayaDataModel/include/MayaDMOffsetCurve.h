@@ -20,7 +20,7 @@ public:
 public:
 
 	OffsetCurve():AbstractBaseCreate(){}
-	OffsetCurve(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	OffsetCurve(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "offsetCurve", shared, create){}
 	virtual ~OffsetCurve(){}
 
@@ -174,7 +174,7 @@ public:
 		fprintf(mFile,"\"%s.oc\"",mName.c_str());
 	}
 protected:
-	OffsetCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	OffsetCurve(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	OffsetSurface():AbstractBaseCreate(){}
-	OffsetSurface(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	OffsetSurface(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "offsetSurface", shared, create){}
 	virtual ~OffsetSurface(){}
 
@@ -51,7 +51,7 @@ public:
 		fprintf(mFile,"\"%s.os\"",mName.c_str());
 	}
 protected:
-	OffsetSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	OffsetSurface(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
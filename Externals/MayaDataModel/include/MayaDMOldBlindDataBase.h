@@ -20,7 +20,7 @@ public:
 public:
 
 	OldBlindDataBase():DependNode(){}
-	OldBlindDataBase(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	OldBlindDataBase(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "oldBlindDataBase", shared, create){}
 	virtual ~OldBlindDataBase(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.tid\"",mName.c_str());
 	}
 protected:
-	OldBlindDataBase(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	OldBlindDataBase(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
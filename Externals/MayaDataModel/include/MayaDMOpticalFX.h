@@ -20,7 +20,7 @@ public:
 public:
 
 	OpticalFX():DependNode(){}
-	OpticalFX(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	OpticalFX(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "opticalFX", shared, create){}
 	virtual ~OpticalFX(){}
 
@@ -619,7 +619,7 @@ public:
 		fprintf(mFile,"\"%s.vb.vbb\"",mName.c_str());
 	}
 protected:
-	OpticalFX(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	OpticalFX(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -24,7 +24,7 @@ public:
 		matrix targetParentMatrix;
 		double targetWeight;
 		double3 targetRotateCached;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			targetRotate.write(file);
 			fprintf(file, " ");
@@ -40,7 +40,7 @@ public:
 public:
 
 	OrientConstraint():Constraint(){}
-	OrientConstraint(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	OrientConstraint(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Constraint(file, name, parent, "orientConstraint", shared, create){}
 	virtual ~OrientConstraint(){}
 
@@ -511,7 +511,7 @@ public:
 		fprintf(mFile,"\"%s.uooc\"",mName.c_str());
 	}
 protected:
-	OrientConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	OrientConstraint(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Constraint(file, name, parent, nodeType, shared, create) {}
 
 };
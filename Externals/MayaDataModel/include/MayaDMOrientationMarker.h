@@ -20,7 +20,7 @@ public:
 public:
 
 	OrientationMarker():PositionMarker(){}
-	OrientationMarker(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	OrientationMarker(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PositionMarker(file, name, parent, "orientationMarker", shared, create){}
 	virtual ~OrientationMarker(){}
 
@@ -52,7 +52,7 @@ public:
 		fprintf(mFile,"\"%s.st\"",mName.c_str());
 	}
 protected:
-	OrientationMarker(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	OrientationMarker(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PositionMarker(file, name, parent, nodeType, shared, create) {}
 
 };
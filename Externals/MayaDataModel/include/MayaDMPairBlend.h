@@ -20,7 +20,7 @@ public:
 public:
 
 	PairBlend():DependNode(){}
-	PairBlend(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PairBlend(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "pairBlend", shared, create){}
 	virtual ~PairBlend(){}
 
@@ -253,7 +253,7 @@ public:
 		fprintf(mFile,"\"%s.or.orz\"",mName.c_str());
 	}
 protected:
-	PairBlend(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PairBlend(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -30,7 +30,7 @@ public:
 		double3 targetJointOrient;
 		double3 targetOffsetRotate;
 		double3 targetScale;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			targetParentMatrix.write(file);
 			fprintf(file, " ");
@@ -58,7 +58,7 @@ public:
 public:
 
 	ParentConstraint():Constraint(){}
-	ParentConstraint(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ParentConstraint(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Constraint(file, name, parent, "parentConstraint", shared, create){}
 	virtual ~ParentConstraint(){}
 
@@ -953,7 +953,7 @@ public:
 		fprintf(mFile,"\"%s.inc\"",mName.c_str());
 	}
 protected:
-	ParentConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ParentConstraint(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Constraint(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	ParentTessellate():AbstractBaseNurbsConversion(){}
-	ParentTessellate(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ParentTessellate(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseNurbsConversion(file, name, parent, "parentTessellate", shared, create){}
 	virtual ~ParentTessellate(){}
 
@@ -191,7 +191,7 @@ public:
 		fprintf(mFile,"\"%s.op\"",mName.c_str());
 	}
 protected:
-	ParentTessellate(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ParentTessellate(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseNurbsConversion(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -18,28 +18,28 @@ class Particle : public DeformableShape
 {
 public:
 	struct IdMapping{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 	struct FieldData{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 	struct EmitterData{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 	struct CollisionData{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 	struct InstanceData{
 		stringArray instanceAttributeMapping;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			instanceAttributeMapping.write(file);
 			fprintf(file, " ");
@@ -61,7 +61,7 @@ public:
 		bool miOverrideSamples;
 		short miMinSamples;
 		short miMaxSamples;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", miOverrideCaustics);
 			fprintf(file,"%i ", miCausticAccuracy);
@@ -83,7 +83,7 @@ public:
 public:
 
 	Particle():DeformableShape(){}
-	Particle(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Particle(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DeformableShape(file, name, parent, "particle", shared, create){}
 	virtual ~Particle(){}
 
@@ -253,11 +253,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".sd[%i:%i]\" ", sd_start,sd_end);
 		size_t size = (sd_end-sd_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",sd[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(sd,size);
 		fprintf(mFile,";\n");
 	}
 	void startSeed(size_t sd_start,size_t sd_end)const
@@ -311,11 +307,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".gw[%i:%i]\" ", gw_start,gw_end);
 		size_t size = (gw_end-gw_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",gw[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(gw,size);
 		fprintf(mFile,";\n");
 	}
 	void startGoalWeight(size_t gw_start,size_t gw_end)const
@@ -446,11 +438,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".evv[%i:%i]\" ", evv_start,evv_end);
 		size_t size = (evv_end-evv_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",evv[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(evv,size);
 		fprintf(mFile,";\n");
 	}
 	void startEventValid(size_t evv_start,size_t evv_end)const
@@ -614,11 +602,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".esp[%i:%i]\" ", esp_start,esp_end);
 		size_t size = (esp_end-esp_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",esp[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(esp,size);
 		fprintf(mFile,";\n");
 	}
 	void startEventSpread(size_t esp_start,size_t esp_end)const
@@ -1624,7 +1608,7 @@ public:
 		fprintf(mFile,"\"%s.dpos\"",mName.c_str());
 	}
 protected:
-	Particle(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Particle(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DeformableShape(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	ParticleAgeMapper():DependNode(){}
-	ParticleAgeMapper(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ParticleAgeMapper(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "particleAgeMapper", shared, create){}
 	virtual ~ParticleAgeMapper(){}
 
@@ -72,7 +72,7 @@ public:
 		fprintf(mFile,"\"%s.fae\"",mName.c_str());
 	}
 protected:
-	ParticleAgeMapper(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ParticleAgeMapper(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
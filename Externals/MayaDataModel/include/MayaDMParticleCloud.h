@@ -20,7 +20,7 @@ public:
 public:
 
 	ParticleCloud():DependNode(){}
-	ParticleCloud(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ParticleCloud(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "particleCloud", shared, create){}
 	virtual ~ParticleCloud(){}
 
@@ -595,7 +595,7 @@ public:
 		fprintf(mFile,"\"%s.rdst\"",mName.c_str());
 	}
 protected:
-	ParticleCloud(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ParticleCloud(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	ParticleColorMapper():DependNode(){}
-	ParticleColorMapper(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ParticleColorMapper(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "particleColorMapper", shared, create){}
 	virtual ~ParticleColorMapper(){}
 
@@ -62,7 +62,7 @@ public:
 		fprintf(mFile,"\"%s.pc.pcb\"",mName.c_str());
 	}
 protected:
-	ParticleColorMapper(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ParticleColorMapper(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
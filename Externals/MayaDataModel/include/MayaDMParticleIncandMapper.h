@@ -20,7 +20,7 @@ public:
 public:
 
 	ParticleIncandMapper():DependNode(){}
-	ParticleIncandMapper(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ParticleIncandMapper(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "particleIncandMapper", shared, create){}
 	virtual ~ParticleIncandMapper(){}
 
@@ -62,7 +62,7 @@ public:
 		fprintf(mFile,"\"%s.pi.pib\"",mName.c_str());
 	}
 protected:
-	ParticleIncandMapper(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ParticleIncandMapper(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
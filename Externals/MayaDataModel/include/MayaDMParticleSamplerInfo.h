@@ -20,7 +20,7 @@ public:
 public:
 
 	ParticleSamplerInfo():DependNode(){}
-	ParticleSamplerInfo(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ParticleSamplerInfo(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "particleSamplerInfo", shared, create){}
 	virtual ~ParticleSamplerInfo(){}
 
@@ -537,7 +537,7 @@ public:
 		fprintf(mFile,"\"%s.udv5.uv5z\"",mName.c_str());
 	}
 protected:
-	ParticleSamplerInfo(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ParticleSamplerInfo(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	ParticleTranspMapper():DependNode(){}
-	ParticleTranspMapper(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ParticleTranspMapper(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "particleTranspMapper", shared, create){}
 	virtual ~ParticleTranspMapper(){}
 
@@ -62,7 +62,7 @@ public:
 		fprintf(mFile,"\"%s.pt.ptb\"",mName.c_str());
 	}
 protected:
-	ParticleTranspMapper(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ParticleTranspMapper(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
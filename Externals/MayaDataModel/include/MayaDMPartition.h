@@ -20,7 +20,7 @@ public:
 public:
 
 	Partition():Entity(){}
-	Partition(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Partition(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Entity(file, name, parent, "partition", shared, create){}
 	virtual ~Partition(){}
 
@@ -50,7 +50,7 @@ public:
 		fprintf(mFile,"\"%s.envr\"",mName.c_str());
 	}
 protected:
-	Partition(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Partition(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Entity(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PassMatrix():DependNode(){}
-	PassMatrix(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PassMatrix(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "passMatrix", shared, create){}
 	virtual ~PassMatrix(){}
 
@@ -49,7 +49,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	PassMatrix(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PassMatrix(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PfxGeometry():Shape(){}
-	PfxGeometry(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PfxGeometry(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Shape(file, name, parent, "pfxGeometry", shared, create){}
 	virtual ~PfxGeometry(){}
 
@@ -342,7 +342,7 @@ public:
 		fprintf(mFile,"\"%s.ofc\"",mName.c_str());
 	}
 protected:
-	PfxGeometry(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PfxGeometry(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Shape(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PfxHair():PfxGeometry(){}
-	PfxHair(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PfxHair(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PfxGeometry(file, name, parent, "pfxHair", shared, create){}
 	virtual ~PfxHair(){}
 
@@ -29,7 +29,7 @@ public:
 		fprintf(mFile,"\"%s.rhs\"",mName.c_str());
 	}
 protected:
-	PfxHair(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PfxHair(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PfxGeometry(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -18,7 +18,7 @@ class PfxToon : public PfxGeometry
 {
 public:
 	struct InputSurface{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
@@ -26,7 +26,7 @@ public:
 		float curvatureWidth_Position;
 		float curvatureWidth_FloatValue;
 		unsigned int curvatureWidth_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", curvatureWidth_Position);
 			fprintf(file,"%f ", curvatureWidth_FloatValue);
@@ -36,7 +36,7 @@ public:
 public:
 
 	PfxToon():PfxGeometry(){}
-	PfxToon(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PfxToon(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PfxGeometry(file, name, parent, "pfxToon", shared, create){}
 	virtual ~PfxToon(){}
 
@@ -827,7 +827,7 @@ public:
 		fprintf(mFile,"\"%s.opm\"",mName.c_str());
 	}
 protected:
-	PfxToon(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PfxToon(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PfxGeometry(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Phong():Reflect(){}
-	Phong(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Phong(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Reflect(file, name, parent, "phong", shared, create){}
 	virtual ~Phong(){}
 
@@ -107,7 +107,7 @@ public:
 		fprintf(mFile,"\"%s.mirf\"",mName.c_str());
 	}
 protected:
-	Phong(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Phong(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Reflect(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PhongE():Reflect(){}
-	PhongE(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PhongE(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Reflect(file, name, parent, "phongE", shared, create){}
 	virtual ~PhongE(){}
 
@@ -191,7 +191,7 @@ public:
 		fprintf(mFile,"\"%s.mirf\"",mName.c_str());
 	}
 protected:
-	PhongE(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PhongE(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Reflect(file, name, parent, nodeType, shared, create) {}
 
 };
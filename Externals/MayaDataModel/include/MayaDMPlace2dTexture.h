@@ -20,7 +20,7 @@ public:
 public:
 
 	Place2dTexture():DependNode(){}
-	Place2dTexture(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Place2dTexture(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "place2dTexture", shared, create){}
 	virtual ~Place2dTexture(){}
 
@@ -415,7 +415,7 @@ public:
 		fprintf(mFile,"\"%s.do\"",mName.c_str());
 	}
 protected:
-	Place2dTexture(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Place2dTexture(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
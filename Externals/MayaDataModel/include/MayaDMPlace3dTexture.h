@@ -19,12 +19,12 @@ class Place3dTexture : public Transform
 public:
 
 	Place3dTexture():Transform(){}
-	Place3dTexture(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Place3dTexture(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Transform(file, name, parent, "place3dTexture", shared, create){}
 	virtual ~Place3dTexture(){}
 
 protected:
-	Place3dTexture(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Place3dTexture(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Transform(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PlanarTrimSurface():AbstractBaseCreate(){}
-	PlanarTrimSurface(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PlanarTrimSurface(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "planarTrimSurface", shared, create){}
 	virtual ~PlanarTrimSurface(){}
 
@@ -65,7 +65,7 @@ public:
 		fprintf(mFile,"\"%s.tol\"",mName.c_str());
 	}
 protected:
-	PlanarTrimSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PlanarTrimSurface(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -19,12 +19,12 @@ class Plane : public GeometryShape
 public:
 
 	Plane():GeometryShape(){}
-	Plane(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Plane(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryShape(file, name, parent, "plane", shared, create){}
 	virtual ~Plane(){}
 
 protected:
-	Plane(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Plane(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryShape(file, name, parent, nodeType, shared, create) {}
 
 };
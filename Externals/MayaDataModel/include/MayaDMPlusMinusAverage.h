@@ -20,7 +20,7 @@ public:
 public:
 
 	PlusMinusAverage():DependNode(){}
-	PlusMinusAverage(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PlusMinusAverage(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "plusMinusAverage", shared, create){}
 	virtual ~PlusMinusAverage(){}
 
@@ -38,11 +38,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".i1[%i:%i]\" ", i1_start,i1_end);
 		size_t size = (i1_end-i1_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",i1[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(i1,size);
 		fprintf(mFile,";\n");
 	}
 	void startInput1D(size_t i1_start,size_t i1_end)const
@@ -68,11 +64,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".i2[%i:%i]\" ", i2_start,i2_end);
 		size_t size = (i2_end-i2_start)*2+2;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",i2[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(i2,size);
 		fprintf(mFile,";\n");
 	}
 	void startInput2D(size_t i2_start,size_t i2_end)const
@@ -108,11 +100,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".i3[%i:%i]\" ", i3_start,i3_end);
 		size_t size = (i3_end-i3_start)*3+3;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",i3[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(i3,size);
 		fprintf(mFile,";\n");
 	}
 	void startInput3D(size_t i3_start,size_t i3_end)const
@@ -251,7 +239,7 @@ public:
 		fprintf(mFile,"\"%s.o3.o3z\"",mName.c_str());
 	}
 protected:
-	PlusMinusAverage(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PlusMinusAverage(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
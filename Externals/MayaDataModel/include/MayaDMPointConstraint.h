@@ -23,7 +23,7 @@ public:
 		double3 targetRotateTranslate;
 		matrix targetParentMatrix;
 		double targetWeight;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			targetTranslate.write(file);
 			fprintf(file, " ");
@@ -39,7 +39,7 @@ public:
 public:
 
 	PointConstraint():Constraint(){}
-	PointConstraint(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PointConstraint(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Constraint(file, name, parent, "pointConstraint", shared, create){}
 	virtual ~PointConstraint(){}
 
@@ -470,7 +470,7 @@ public:
 		fprintf(mFile,"\"%s.rst.rtz\"",mName.c_str());
 	}
 protected:
-	PointConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PointConstraint(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Constraint(file, name, parent, nodeType, shared, create) {}
 
 };
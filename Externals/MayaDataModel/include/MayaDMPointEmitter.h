@@ -20,7 +20,7 @@ public:
 public:
 
 	PointEmitter():DynBase(){}
-	PointEmitter(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PointEmitter(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DynBase(file, name, parent, "pointEmitter", shared, create){}
 	virtual ~PointEmitter(){}
 
@@ -68,11 +68,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".dtc[%i:%i]\" ", dtc_start,dtc_end);
 		size_t size = (dtc_end-dtc_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",dtc[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(dtc,size);
 		fprintf(mFile,";\n");
 	}
 	void startDeltaTimeCycle(size_t dtc_start,size_t dtc_end)const
@@ -152,11 +148,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".inh[%i:%i]\" ", inh_start,inh_end);
 		size_t size = (inh_end-inh_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",inh[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(inh,size);
 		fprintf(mFile,";\n");
 	}
 	void startInheritFactor(size_t inh_start,size_t inh_end)const
@@ -638,7 +630,7 @@ public:
 		fprintf(mFile,"\"%s.dss\"",mName.c_str());
 	}
 protected:
-	PointEmitter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PointEmitter(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DynBase(file, name, parent, nodeType, shared, create) {}
 
 };
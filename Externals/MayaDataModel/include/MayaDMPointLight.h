@@ -47,7 +47,7 @@ public:
 		short areaLowLevel;
 		short2 areaLowSampling;
 		bool areaVisible;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", miExportMrLight);
 			fprintf(file,"%i ", emitPhotons);
@@ -89,7 +89,7 @@ public:
 public:
 
 	PointLight():NonExtendedLightShapeNode(){}
-	PointLight(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PointLight(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:NonExtendedLightShapeNode(file, name, parent, "pointLight", shared, create){}
 	virtual ~PointLight(){}
 
@@ -625,7 +625,7 @@ public:
 		fprintf(mFile,"\"%s.mrc.mlp\"",mName.c_str());
 	}
 protected:
-	PointLight(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PointLight(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:NonExtendedLightShapeNode(file, name, parent, nodeType, shared, create) {}
 
 };
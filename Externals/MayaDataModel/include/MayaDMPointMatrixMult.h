@@ -20,7 +20,7 @@ public:
 public:
 
 	PointMatrixMult():DependNode(){}
-	PointMatrixMult(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PointMatrixMult(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "pointMatrixMult", shared, create){}
 	virtual ~PointMatrixMult(){}
 
@@ -98,7 +98,7 @@ public:
 		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
 	}
 protected:
-	PointMatrixMult(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PointMatrixMult(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
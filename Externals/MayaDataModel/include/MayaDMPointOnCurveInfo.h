@@ -18,14 +18,14 @@ class PointOnCurveInfo : public AbstractBaseCreate
 {
 public:
 	struct Result{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	PointOnCurveInfo():AbstractBaseCreate(){}
-	PointOnCurveInfo(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PointOnCurveInfo(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "pointOnCurveInfo", shared, create){}
 	virtual ~PointOnCurveInfo(){}
 
@@ -156,7 +156,7 @@ public:
 		fprintf(mFile,"\"%s.rs.cr\"",mName.c_str());
 	}
 protected:
-	PointOnCurveInfo(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PointOnCurveInfo(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
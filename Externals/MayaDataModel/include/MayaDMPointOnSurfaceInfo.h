@@ -18,14 +18,14 @@ class PointOnSurfaceInfo : public AbstractBaseCreate
 {
 public:
 	struct Result{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	PointOnSurfaceInfo():AbstractBaseCreate(){}
-	PointOnSurfaceInfo(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PointOnSurfaceInfo(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "pointOnSurfaceInfo", shared, create){}
 	virtual ~PointOnSurfaceInfo(){}
 
@@ -177,7 +177,7 @@ public:
 		fprintf(mFile,"\"%s.r.ntv.nvz\"",mName.c_str());
 	}
 protected:
-	PointOnSurfaceInfo(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PointOnSurfaceInfo(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PoleVectorConstraint():PointConstraint(){}
-	PoleVectorConstraint(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PoleVectorConstraint(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PointConstraint(file, name, parent, "poleVectorConstraint", shared, create){}
 	virtual ~PoleVectorConstraint(){}
 
@@ -36,7 +36,7 @@ public:
 		fprintf(mFile,"\"%s.ps\"",mName.c_str());
 	}
 protected:
-	PoleVectorConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PoleVectorConstraint(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PointConstraint(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyAppendVertex():PolyModifier(){}
-	PolyAppendVertex(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyAppendVertex(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyAppendVertex", shared, create){}
 	virtual ~PolyAppendVertex(){}
 
@@ -34,11 +34,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".v[%i:%i]\" ", v_start,v_end);
 		size_t size = (v_end-v_start)*3+3;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",v[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(v,size);
 		fprintf(mFile,";\n");
 	}
 	void startVertices(size_t v_start,size_t v_end)const
@@ -77,11 +73,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".d[%i:%i]\" ", d_start,d_end);
 		size_t size = (d_end-d_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",d[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(d,size);
 		fprintf(mFile,";\n");
 	}
 	void startDesc(size_t d_start,size_t d_end)const
@@ -151,7 +143,7 @@ public:
 		fprintf(mFile,"\"%s.tx\"",mName.c_str());
 	}
 protected:
-	PolyAppendVertex(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyAppendVertex(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
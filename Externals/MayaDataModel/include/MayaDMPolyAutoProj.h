@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyAutoProj():PolyModifierUV(){}
-	PolyAutoProj(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyAutoProj(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierUV(file, name, parent, "polyAutoProj", shared, create){}
 	virtual ~PolyAutoProj(){}
 
@@ -262,7 +262,7 @@ public:
 		fprintf(mFile,"\"%s.pg\"",mName.c_str());
 	}
 protected:
-	PolyAutoProj(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyAutoProj(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierUV(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyAverageVertex():PolyModifierWorld(){}
-	PolyAverageVertex(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyAverageVertex(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polyAverageVertex", shared, create){}
 	virtual ~PolyAverageVertex(){}
 
@@ -52,7 +52,7 @@ public:
 		fprintf(mFile,"\"%s.i\"",mName.c_str());
 	}
 protected:
-	PolyAverageVertex(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyAverageVertex(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyBase():DependNode(){}
-	PolyBase(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyBase(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "polyBase", shared, create){}
 	virtual ~PolyBase(){}
 
@@ -29,7 +29,7 @@ public:
 		fprintf(mFile,"\"%s.out\"",mName.c_str());
 	}
 protected:
-	PolyBase(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyBase(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
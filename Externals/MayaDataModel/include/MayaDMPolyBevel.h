@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyBevel():PolyModifierWorld(){}
-	PolyBevel(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyBevel(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polyBevel", shared, create){}
 	virtual ~PolyBevel(){}
 
@@ -133,7 +133,7 @@ public:
 		fprintf(mFile,"\"%s.ma\"",mName.c_str());
 	}
 protected:
-	PolyBevel(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyBevel(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
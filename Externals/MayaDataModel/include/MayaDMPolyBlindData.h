@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyBlindData():DependNode(){}
-	PolyBlindData(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyBlindData(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "polyBlindData", shared, create){}
 	virtual ~PolyBlindData(){}
 
@@ -47,7 +47,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	PolyBlindData(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyBlindData(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyBoolOp():PolyUnite(){}
-	PolyBoolOp(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyBoolOp(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyUnite(file, name, parent, "polyBoolOp", shared, create){}
 	virtual ~PolyBoolOp(){}
 
@@ -61,7 +61,7 @@ public:
 		fprintf(mFile,"\"%s.fat\"",mName.c_str());
 	}
 protected:
-	PolyBoolOp(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyBoolOp(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyUnite(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyChipOff():PolyMoveFace(){}
-	PolyChipOff(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyChipOff(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyMoveFace(file, name, parent, "polyChipOff", shared, create){}
 	virtual ~PolyChipOff(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.dup\"",mName.c_str());
 	}
 protected:
-	PolyChipOff(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyChipOff(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyMoveFace(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -19,12 +19,12 @@ class PolyCloseBorder : public PolyModifier
 public:
 
 	PolyCloseBorder():PolyModifier(){}
-	PolyCloseBorder(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyCloseBorder(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyCloseBorder", shared, create){}
 	virtual ~PolyCloseBorder(){}
 
 protected:
-	PolyCloseBorder(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyCloseBorder(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -19,12 +19,12 @@ class PolyCollapseEdge : public PolyModifier
 public:
 
 	PolyCollapseEdge():PolyModifier(){}
-	PolyCollapseEdge(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyCollapseEdge(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyCollapseEdge", shared, create){}
 	virtual ~PolyCollapseEdge(){}
 
 protected:
-	PolyCollapseEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyCollapseEdge(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
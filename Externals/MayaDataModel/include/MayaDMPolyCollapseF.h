@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyCollapseF():PolyModifier(){}
-	PolyCollapseF(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyCollapseF(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyCollapseF", shared, create){}
 	virtual ~PolyCollapseF(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.at\"",mName.c_str());
 	}
 protected:
-	PolyCollapseF(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyCollapseF(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
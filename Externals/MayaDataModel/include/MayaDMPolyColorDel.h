@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyColorDel():PolyModifier(){}
-	PolyColorDel(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyColorDel(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyColorDel", shared, create){}
 	virtual ~PolyColorDel(){}
 
@@ -36,7 +36,7 @@ public:
 		fprintf(mFile,"\"%s.cls\"",mName.c_str());
 	}
 protected:
-	PolyColorDel(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyColorDel(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -21,7 +21,7 @@ public:
 		float redScale_Position;
 		float redScale_FloatValue;
 		unsigned int redScale_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", redScale_Position);
 			fprintf(file,"%f ", redScale_FloatValue);
@@ -32,7 +32,7 @@ public:
 		float greenScale_Position;
 		float greenScale_FloatValue;
 		unsigned int greenScale_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", greenScale_Position);
 			fprintf(file,"%f ", greenScale_FloatValue);
@@ -43,7 +43,7 @@ public:
 		float blueScale_Position;
 		float blueScale_FloatValue;
 		unsigned int blueScale_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", blueScale_Position);
 			fprintf(file,"%f ", blueScale_FloatValue);
@@ -54,7 +54,7 @@ public:
 		float alphaScale_Position;
 		float alphaScale_FloatValue;
 		unsigned int alphaScale_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", alphaScale_Position);
 			fprintf(file,"%f ", alphaScale_FloatValue);
@@ -65,7 +65,7 @@ public:
 		float intensityScale_Position;
 		float intensityScale_FloatValue;
 		unsigned int intensityScale_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", intensityScale_Position);
 			fprintf(file,"%f ", intensityScale_FloatValue);
@@ -75,7 +75,7 @@ public:
 public:
 
 	PolyColorMod():PolyModifier(){}
-	PolyColorMod(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyColorMod(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyColorMod", shared, create){}
 	virtual ~PolyColorMod(){}
 
@@ -528,7 +528,7 @@ public:
 		fprintf(mFile,"\"%s.v\"",mName.c_str());
 	}
 protected:
-	PolyColorMod(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyColorMod(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -24,14 +24,14 @@ public:
 			struct VertexFaceColor{
 				float3 vertexFaceColorRGB;
 				float vertexFaceAlpha;
-				void write(FILE* file) const
+				void write(Writer* file) const
 				{
 					vertexFaceColorRGB.write(file);
 					fprintf(file, " ");
 					fprintf(file,"%f", vertexFaceAlpha);
 				}
 			}* vertexFaceColor;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				vertexColorRGB.write(file);
 				fprintf(file, " ");
@@ -44,7 +44,7 @@ public:
 				}
 			}
 		}* vertexColor;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(vertexColor)/sizeof(VertexColor);
 			for(size_t i=0; i<size; ++i)
@@ -57,7 +57,7 @@ public:
 public:
 
 	PolyColorPerVertex():PolyModifier(){}
-	PolyColorPerVertex(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyColorPerVertex(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyColorPerVertex", shared, create){}
 	virtual ~PolyColorPerVertex(){}
 
@@ -263,7 +263,7 @@ public:
 		fprintf(mFile,"\"%s.rprt\"",mName.c_str());
 	}
 protected:
-	PolyColorPerVertex(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyColorPerVertex(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
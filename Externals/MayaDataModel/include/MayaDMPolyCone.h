@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyCone():PolyPrimitive(){}
-	PolyCone(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyCone(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, "polyCone", shared, create){}
 	virtual ~PolyCone(){}
 
@@ -97,7 +97,7 @@ public:
 		fprintf(mFile,"\"%s.rcp\"",mName.c_str());
 	}
 protected:
-	PolyCone(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyCone(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, nodeType, shared, create) {}
 
 };
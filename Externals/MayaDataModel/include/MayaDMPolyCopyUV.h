@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyCopyUV():PolyModifierUV(){}
-	PolyCopyUV(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyCopyUV(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierUV(file, name, parent, "polyCopyUV", shared, create){}
 	virtual ~PolyCopyUV(){}
 
@@ -36,7 +36,7 @@ public:
 		fprintf(mFile,"\"%s.uvi\"",mName.c_str());
 	}
 protected:
-	PolyCopyUV(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyCopyUV(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierUV(file, name, parent, nodeType, shared, create) {}
 
 };
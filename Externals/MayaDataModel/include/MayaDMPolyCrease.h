@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyCrease():PolyModifierWorld(){}
-	PolyCrease(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyCrease(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polyCrease", shared, create){}
 	virtual ~PolyCrease(){}
 
@@ -33,11 +33,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".cr[%i:%i]\" ", cr_start,cr_end);
 		size_t size = (cr_end-cr_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",cr[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(cr,size);
 		fprintf(mFile,";\n");
 	}
 	void startCrease(size_t cr_start,size_t cr_end)const
@@ -67,11 +63,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".crv[%i:%i]\" ", crv_start,crv_end);
 		size_t size = (crv_end-crv_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",crv[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(crv,size);
 		fprintf(mFile,";\n");
 	}
 	void startCreaseVertex(size_t crv_start,size_t crv_end)const
@@ -109,7 +101,7 @@ public:
 		fprintf(mFile,"\"%s.crv\"",mName.c_str());
 	}
 protected:
-	PolyCrease(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyCrease(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
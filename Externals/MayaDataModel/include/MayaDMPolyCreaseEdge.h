@@ -19,12 +19,12 @@ class PolyCreaseEdge : public PolyCrease
 public:
 
 	PolyCreaseEdge():PolyCrease(){}
-	PolyCreaseEdge(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyCreaseEdge(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyCrease(file, name, parent, "polyCreaseEdge", shared, create){}
 	virtual ~PolyCreaseEdge(){}
 
 protected:
-	PolyCreaseEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyCreaseEdge(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyCrease(file, name, parent, nodeType, shared, create) {}
 
 };
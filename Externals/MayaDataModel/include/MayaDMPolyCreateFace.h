@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyCreateFace():PolyCreator(){}
-	PolyCreateFace(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyCreateFace(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyCreator(file, name, parent, "polyCreateFace", shared, create){}
 	virtual ~PolyCreateFace(){}
 
@@ -34,11 +34,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".v[%i:%i]\" ", v_start,v_end);
 		size_t size = (v_end-v_start)*3+3;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",v[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(v,size);
 		fprintf(mFile,";\n");
 	}
 	void startVertices(size_t v_start,size_t v_end)const
@@ -77,11 +73,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".l[%i:%i]\" ", l_start,l_end);
 		size_t size = (l_end-l_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",l[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(l,size);
 		fprintf(mFile,";\n");
 	}
 	void startLoop(size_t l_start,size_t l_end)const
@@ -171,7 +163,7 @@ public:
 		fprintf(mFile,"\"%s.uvs\"",mName.c_str());
 	}
 protected:
-	PolyCreateFace(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyCreateFace(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyCreator(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyCube():PolyPrimitive(){}
-	PolyCube(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyCube(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, "polyCube", shared, create){}
 	virtual ~PolyCube(){}
 
@@ -97,7 +97,7 @@ public:
 		fprintf(mFile,"\"%s.cuv\"",mName.c_str());
 	}
 protected:
-	PolyCube(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyCube(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyCut():PolyModifierWorld(){}
-	PolyCut(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyCut(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polyCut", shared, create){}
 	virtual ~PolyCut(){}
 
@@ -199,7 +199,7 @@ public:
 		fprintf(mFile,"\"%s.cid\"",mName.c_str());
 	}
 protected:
-	PolyCut(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyCut(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyCylProj():PolyModifierWorld(){}
-	PolyCylProj(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyCylProj(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polyCylProj", shared, create){}
 	virtual ~PolyCylProj(){}
 
@@ -235,7 +235,7 @@ public:
 		fprintf(mFile,"\"%s.cid\"",mName.c_str());
 	}
 protected:
-	PolyCylProj(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyCylProj(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyCylinder():PolyPrimitive(){}
-	PolyCylinder(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyCylinder(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, "polyCylinder", shared, create){}
 	virtual ~PolyCylinder(){}
 
@@ -106,7 +106,7 @@ public:
 		fprintf(mFile,"\"%s.rcp\"",mName.c_str());
 	}
 protected:
-	PolyCylinder(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyCylinder(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyDelEdge():PolyModifier(){}
-	PolyDelEdge(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyDelEdge(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyDelEdge", shared, create){}
 	virtual ~PolyDelEdge(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.cv\"",mName.c_str());
 	}
 protected:
-	PolyDelEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyDelEdge(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -19,12 +19,12 @@ class PolyDelVertex : public PolyModifier
 public:
 
 	PolyDelVertex():PolyModifier(){}
-	PolyDelVertex(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyDelVertex(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyDelVertex", shared, create){}
 	virtual ~PolyDelVertex(){}
 
 protected:
-	PolyDelVertex(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyDelVertex(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
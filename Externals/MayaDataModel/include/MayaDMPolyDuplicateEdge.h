@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyDuplicateEdge():PolyModifier(){}
-	PolyDuplicateEdge(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyDuplicateEdge(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyDuplicateEdge", shared, create){}
 	virtual ~PolyDuplicateEdge(){}
 
@@ -79,7 +79,7 @@ public:
 		fprintf(mFile,"\"%s.stp\"",mName.c_str());
 	}
 protected:
-	PolyDuplicateEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyDuplicateEdge(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -21,7 +21,7 @@ public:
 		float taperCurve_Position;
 		float taperCurve_FloatValue;
 		unsigned int taperCurve_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", taperCurve_Position);
 			fprintf(file,"%f ", taperCurve_FloatValue);
@@ -31,7 +31,7 @@ public:
 public:
 
 	PolyExtrudeEdge():PolyMoveEdge(){}
-	PolyExtrudeEdge(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyExtrudeEdge(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyMoveEdge(file, name, parent, "polyExtrudeEdge", shared, create){}
 	virtual ~PolyExtrudeEdge(){}
 
@@ -167,7 +167,7 @@ public:
 		fprintf(mFile,"\"%s.sma\"",mName.c_str());
 	}
 protected:
-	PolyExtrudeEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyExtrudeEdge(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyMoveEdge(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyExtrudeVertex():PolyModifierWorld(){}
-	PolyExtrudeVertex(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyExtrudeVertex(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polyExtrudeVertex", shared, create){}
 	virtual ~PolyExtrudeVertex(){}
 
@@ -52,7 +52,7 @@ public:
 		fprintf(mFile,"\"%s.d\"",mName.c_str());
 	}
 protected:
-	PolyExtrudeVertex(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyExtrudeVertex(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyFlipEdge():PolyModifier(){}
-	PolyFlipEdge(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyFlipEdge(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyFlipEdge", shared, create){}
 	virtual ~PolyFlipEdge(){}
 
@@ -35,7 +35,7 @@ public:
 		fprintf(mFile,"\"%s.e\"",mName.c_str());
 	}
 protected:
-	PolyFlipEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyFlipEdge(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyFlipUV():PolyModifierUV(){}
-	PolyFlipUV(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyFlipUV(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierUV(file, name, parent, "polyFlipUV", shared, create){}
 	virtual ~PolyFlipUV(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.l\"",mName.c_str());
 	}
 protected:
-	PolyFlipUV(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyFlipUV(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierUV(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyHelix():PolyPrimitive(){}
-	PolyHelix(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyHelix(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, "polyHelix", shared, create){}
 	virtual ~PolyHelix(){}
 
@@ -133,7 +133,7 @@ public:
 		fprintf(mFile,"\"%s.oib\"",mName.c_str());
 	}
 protected:
-	PolyHelix(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyHelix(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyLayoutUV():PolyModifierUV(){}
-	PolyLayoutUV(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyLayoutUV(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierUV(file, name, parent, "polyLayoutUV", shared, create){}
 	virtual ~PolyLayoutUV(){}
 
@@ -97,7 +97,7 @@ public:
 		fprintf(mFile,"\"%s.lm\"",mName.c_str());
 	}
 protected:
-	PolyLayoutUV(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyLayoutUV(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierUV(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyMapCut():PolyModifier(){}
-	PolyMapCut(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyMapCut(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyMapCut", shared, create){}
 	virtual ~PolyMapCut(){}
 
@@ -36,7 +36,7 @@ public:
 		fprintf(mFile,"\"%s.uvs\"",mName.c_str());
 	}
 protected:
-	PolyMapCut(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyMapCut(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
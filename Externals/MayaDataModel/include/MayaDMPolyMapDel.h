@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyMapDel():PolyModifier(){}
-	PolyMapDel(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyMapDel(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyMapDel", shared, create){}
 	virtual ~PolyMapDel(){}
 
@@ -36,7 +36,7 @@ public:
 		fprintf(mFile,"\"%s.uvs\"",mName.c_str());
 	}
 protected:
-	PolyMapDel(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyMapDel(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
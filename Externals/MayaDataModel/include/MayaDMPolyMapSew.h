@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyMapSew():PolyModifier(){}
-	PolyMapSew(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyMapSew(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyMapSew", shared, create){}
 	virtual ~PolyMapSew(){}
 
@@ -36,7 +36,7 @@ public:
 		fprintf(mFile,"\"%s.uvs\"",mName.c_str());
 	}
 protected:
-	PolyMapSew(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyMapSew(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
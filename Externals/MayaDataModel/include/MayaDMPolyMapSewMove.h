@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyMapSewMove():PolyModifierUV(){}
-	PolyMapSewMove(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyMapSewMove(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierUV(file, name, parent, "polyMapSewMove", shared, create){}
 	virtual ~PolyMapSewMove(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.nf\"",mName.c_str());
 	}
 protected:
-	PolyMapSewMove(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyMapSewMove(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierUV(file, name, parent, nodeType, shared, create) {}
 
 };
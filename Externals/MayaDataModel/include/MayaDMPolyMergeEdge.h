@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyMergeEdge():PolyModifier(){}
-	PolyMergeEdge(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyMergeEdge(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyMergeEdge", shared, create){}
 	virtual ~PolyMergeEdge(){}
 
@@ -61,7 +61,7 @@ public:
 		fprintf(mFile,"\"%s.mt\"",mName.c_str());
 	}
 protected:
-	PolyMergeEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyMergeEdge(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
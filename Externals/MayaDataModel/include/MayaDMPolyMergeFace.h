@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyMergeFace():PolyModifier(){}
-	PolyMergeFace(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyMergeFace(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyMergeFace", shared, create){}
 	virtual ~PolyMergeFace(){}
 
@@ -57,7 +57,7 @@ public:
 		fprintf(mFile,"\"%s.sf\"",mName.c_str());
 	}
 protected:
-	PolyMergeFace(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyMergeFace(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyMergeUV():PolyModifierUV(){}
-	PolyMergeUV(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyMergeUV(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierUV(file, name, parent, "polyMergeUV", shared, create){}
 	virtual ~PolyMergeUV(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.d\"",mName.c_str());
 	}
 protected:
-	PolyMergeUV(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyMergeUV(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierUV(file, name, parent, nodeType, shared, create) {}
 
 };
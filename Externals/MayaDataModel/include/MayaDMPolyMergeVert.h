@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyMergeVert():PolyModifierWorld(){}
-	PolyMergeVert(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyMergeVert(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polyMergeVert", shared, create){}
 	virtual ~PolyMergeVert(){}
 
@@ -52,7 +52,7 @@ public:
 		fprintf(mFile,"\"%s.tx\"",mName.c_str());
 	}
 protected:
-	PolyMergeVert(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyMergeVert(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
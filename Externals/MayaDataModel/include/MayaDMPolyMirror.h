@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyMirror():PolyModifierWorld(){}
-	PolyMirror(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyMirror(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polyMirror", shared, create){}
 	virtual ~PolyMirror(){}
 
@@ -90,7 +90,7 @@ public:
 		fprintf(mFile,"\"%s.mt\"",mName.c_str());
 	}
 protected:
-	PolyMirror(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyMirror(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyModifier():PolyBase(){}
-	PolyModifier(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyModifier(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyBase(file, name, parent, "polyModifier", shared, create){}
 	virtual ~PolyModifier(){}
 
@@ -44,7 +44,7 @@ public:
 		fprintf(mFile,"\"%s.ics\"",mName.c_str());
 	}
 protected:
-	PolyModifier(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyModifier(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyBase(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyModifierUV():PolyModifierWorld(){}
-	PolyModifierUV(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyModifierUV(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polyModifierUV", shared, create){}
 	virtual ~PolyModifierUV(){}
 
@@ -36,7 +36,7 @@ public:
 		fprintf(mFile,"\"%s.uvs\"",mName.c_str());
 	}
 protected:
-	PolyModifierUV(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyModifierUV(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
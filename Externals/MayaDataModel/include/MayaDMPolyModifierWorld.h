@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyModifierWorld():PolyModifier(){}
-	PolyModifierWorld(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyModifierWorld(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyModifierWorld", shared, create){}
 	virtual ~PolyModifierWorld(){}
 
@@ -54,7 +54,7 @@ public:
 		fprintf(mFile,"\"%s.mp\"",mName.c_str());
 	}
 protected:
-	PolyModifierWorld(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyModifierWorld(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
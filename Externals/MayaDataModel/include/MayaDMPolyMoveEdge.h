@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyMoveEdge():PolyMoveVertex(){}
-	PolyMoveEdge(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyMoveEdge(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyMoveVertex(file, name, parent, "polyMoveEdge", shared, create){}
 	virtual ~PolyMoveEdge(){}
 
@@ -110,7 +110,7 @@ public:
 		fprintf(mFile,"\"%s.lc\"",mName.c_str());
 	}
 protected:
-	PolyMoveEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyMoveEdge(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyMoveVertex(file, name, parent, nodeType, shared, create) {}
 
 };
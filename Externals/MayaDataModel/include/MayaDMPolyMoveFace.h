@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyMoveFace():PolyMoveEdge(){}
-	PolyMoveFace(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyMoveFace(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyMoveEdge(file, name, parent, "polyMoveFace", shared, create){}
 	virtual ~PolyMoveFace(){}
 
@@ -128,7 +128,7 @@ public:
 		fprintf(mFile,"\"%s.m.mz\"",mName.c_str());
 	}
 protected:
-	PolyMoveFace(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyMoveFace(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyMoveEdge(file, name, parent, nodeType, shared, create) {}
 
 };
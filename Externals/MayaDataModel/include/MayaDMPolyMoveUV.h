@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyMoveUV():PolyModifier(){}
-	PolyMoveUV(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyMoveUV(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyMoveUV", shared, create){}
 	virtual ~PolyMoveUV(){}
 
@@ -183,7 +183,7 @@ public:
 		fprintf(mFile,"\"%s.uvs\"",mName.c_str());
 	}
 protected:
-	PolyMoveUV(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyMoveUV(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyMoveVertex():PolyModifierWorld(){}
-	PolyMoveVertex(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyMoveVertex(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polyMoveVertex", shared, create){}
 	virtual ~PolyMoveVertex(){}
 
@@ -175,11 +175,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ga[%i:%i]\" ", ga_start,ga_end);
 		size_t size = (ga_end-ga_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",ga[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(ga,size);
 		fprintf(mFile,";\n");
 	}
 	void startGain(size_t ga_start,size_t ga_end)const
@@ -316,7 +312,7 @@ public:
 		fprintf(mFile,"\"%s.ga\"",mName.c_str());
 	}
 protected:
-	PolyMoveVertex(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyMoveVertex(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyNormal():PolyModifier(){}
-	PolyNormal(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyNormal(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyNormal", shared, create){}
 	virtual ~PolyNormal(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.unm\"",mName.c_str());
 	}
 protected:
-	PolyNormal(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyNormal(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -22,12 +22,12 @@ public:
 			float3 vertexNormalXYZ;
 			struct VertexFaceNormal{
 				float3 vertexFaceNormalXYZ;
-				void write(FILE* file) const
+				void write(Writer* file) const
 				{
 					vertexFaceNormalXYZ.write(file);
 				}
 			}* vertexFaceNormal;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				vertexNormalXYZ.write(file);
 				fprintf(file, " ");
@@ -39,7 +39,7 @@ public:
 				}
 			}
 		}* vertexNormal;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(vertexNormal)/sizeof(VertexNormal);
 			for(size_t i=0; i<size; ++i)
@@ -52,7 +52,7 @@ public:
 public:
 
 	PolyNormalPerVertex():PolyModifier(){}
-	PolyNormalPerVertex(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyNormalPerVertex(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyNormalPerVertex", shared, create){}
 	virtual ~PolyNormalPerVertex(){}
 
@@ -185,7 +185,7 @@ public:
 		fprintf(mFile,"\"%s.npva\"",mName.c_str());
 	}
 protected:
-	PolyNormalPerVertex(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyNormalPerVertex(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyNormalizeUV():PolyModifierUV(){}
-	PolyNormalizeUV(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyNormalizeUV(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierUV(file, name, parent, "polyNormalizeUV", shared, create){}
 	virtual ~PolyNormalizeUV(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.pa\"",mName.c_str());
 	}
 protected:
-	PolyNormalizeUV(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyNormalizeUV(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierUV(file, name, parent, nodeType, shared, create) {}
 
 };
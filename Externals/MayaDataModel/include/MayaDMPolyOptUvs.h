@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyOptUvs():PolyModifierUV(){}
-	PolyOptUvs(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyOptUvs(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierUV(file, name, parent, "polyOptUvs", shared, create){}
 	virtual ~PolyOptUvs(){}
 
@@ -124,7 +124,7 @@ public:
 		fprintf(mFile,"\"%s.gmb\"",mName.c_str());
 	}
 protected:
-	PolyOptUvs(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyOptUvs(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierUV(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyPipe():PolyPrimitive(){}
-	PolyPipe(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyPipe(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, "polyPipe", shared, create){}
 	virtual ~PolyPipe(){}
 
@@ -106,7 +106,7 @@ public:
 		fprintf(mFile,"\"%s.rcp\"",mName.c_str());
 	}
 protected:
-	PolyPipe(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyPipe(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, nodeType, shared, create) {}
 
 };
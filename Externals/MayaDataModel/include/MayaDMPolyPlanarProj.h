@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyPlanarProj():PolyModifierWorld(){}
-	PolyPlanarProj(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyPlanarProj(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polyPlanarProj", shared, create){}
 	virtual ~PolyPlanarProj(){}
 
@@ -276,7 +276,7 @@ public:
 		fprintf(mFile,"\"%s.ptop\"",mName.c_str());
 	}
 protected:
-	PolyPlanarProj(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyPlanarProj(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyPlane():PolyPrimitive(){}
-	PolyPlane(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyPlane(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, "polyPlane", shared, create){}
 	virtual ~PolyPlane(){}
 
@@ -79,7 +79,7 @@ public:
 		fprintf(mFile,"\"%s.cuv\"",mName.c_str());
 	}
 protected:
-	PolyPlane(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyPlane(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyPlatonicSolid():PolyPrimitive(){}
-	PolyPlatonicSolid(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyPlatonicSolid(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, "polyPlatonicSolid", shared, create){}
 	virtual ~PolyPlatonicSolid(){}
 
@@ -70,7 +70,7 @@ public:
 		fprintf(mFile,"\"%s.cuv\"",mName.c_str());
 	}
 protected:
-	PolyPlatonicSolid(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyPlatonicSolid(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, nodeType, shared, create) {}
 
 };
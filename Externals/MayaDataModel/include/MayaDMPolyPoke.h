@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyPoke():PolyModifierWorld(){}
-	PolyPoke(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyPoke(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polyPoke", shared, create){}
 	virtual ~PolyPoke(){}
 
@@ -110,7 +110,7 @@ public:
 		fprintf(mFile,"\"%s.cma\"",mName.c_str());
 	}
 protected:
-	PolyPoke(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyPoke(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
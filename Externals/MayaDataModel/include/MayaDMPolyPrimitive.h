@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyPrimitive():PolyCreator(){}
-	PolyPrimitive(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyPrimitive(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyCreator(file, name, parent, "polyPrimitive", shared, create){}
 	virtual ~PolyPrimitive(){}
 
@@ -82,7 +82,7 @@ public:
 		fprintf(mFile,"\"%s.uvs\"",mName.c_str());
 	}
 protected:
-	PolyPrimitive(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyPrimitive(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyCreator(file, name, parent, nodeType, shared, create) {}
 
 };
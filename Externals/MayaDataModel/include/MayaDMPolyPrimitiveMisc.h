@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyPrimitiveMisc():PolyPrimitive(){}
-	PolyPrimitiveMisc(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyPrimitiveMisc(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, "polyPrimitiveMisc", shared, create){}
 	virtual ~PolyPrimitiveMisc(){}
 
@@ -70,7 +70,7 @@ public:
 		fprintf(mFile,"\"%s.cuv\"",mName.c_str());
 	}
 protected:
-	PolyPrimitiveMisc(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyPrimitiveMisc(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyPrism():PolyPrimitive(){}
-	PolyPrism(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyPrism(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, "polyPrism", shared, create){}
 	virtual ~PolyPrism(){}
 
@@ -88,7 +88,7 @@ public:
 		fprintf(mFile,"\"%s.cuv\"",mName.c_str());
 	}
 protected:
-	PolyPrism(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyPrism(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, nodeType, shared, create) {}
 
 };
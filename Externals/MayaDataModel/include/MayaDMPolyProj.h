@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyProj():PolyModifierWorld(){}
-	PolyProj(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyProj(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polyProj", shared, create){}
 	virtual ~PolyProj(){}
 
@@ -226,7 +226,7 @@ public:
 		fprintf(mFile,"\"%s.ra\"",mName.c_str());
 	}
 protected:
-	PolyProj(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyProj(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyPyramid():PolyPrimitive(){}
-	PolyPyramid(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyPyramid(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, "polyPyramid", shared, create){}
 	virtual ~PolyPyramid(){}
 
@@ -79,7 +79,7 @@ public:
 		fprintf(mFile,"\"%s.cuv\"",mName.c_str());
 	}
 protected:
-	PolyPyramid(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyPyramid(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyQuad():PolyModifierWorld(){}
-	PolyQuad(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyQuad(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polyQuad", shared, create){}
 	virtual ~PolyQuad(){}
 
@@ -66,7 +66,7 @@ public:
 		fprintf(mFile,"\"%s.khe\"",mName.c_str());
 	}
 protected:
-	PolyQuad(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyQuad(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyReduce():PolyModifier(){}
-	PolyReduce(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyReduce(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyReduce", shared, create){}
 	virtual ~PolyReduce(){}
 
@@ -189,7 +189,7 @@ public:
 		fprintf(mFile,"\"%s.d\"",mName.c_str());
 	}
 protected:
-	PolyReduce(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyReduce(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolySeparate():DependNode(){}
-	PolySeparate(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolySeparate(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "polySeparate", shared, create){}
 	virtual ~PolySeparate(){}
 
@@ -63,7 +63,7 @@ public:
 		fprintf(mFile,"\"%s.out\"",mName.c_str());
 	}
 protected:
-	PolySeparate(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolySeparate(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
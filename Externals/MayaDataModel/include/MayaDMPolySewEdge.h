@@ -20,7 +20,7 @@ public:
 public:
 
 	PolySewEdge():PolyModifierWorld(){}
-	PolySewEdge(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolySewEdge(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polySewEdge", shared, create){}
 	virtual ~PolySewEdge(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.tx\"",mName.c_str());
 	}
 protected:
-	PolySewEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolySewEdge(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
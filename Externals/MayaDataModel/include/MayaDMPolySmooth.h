@@ -20,7 +20,7 @@ public:
 public:
 
 	PolySmooth():PolyModifier(){}
-	PolySmooth(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolySmooth(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polySmooth", shared, create){}
 	virtual ~PolySmooth(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.sm\"",mName.c_str());
 	}
 protected:
-	PolySmooth(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolySmooth(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
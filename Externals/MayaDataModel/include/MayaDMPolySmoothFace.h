@@ -20,7 +20,7 @@ public:
 public:
 
 	PolySmoothFace():PolyModifier(){}
-	PolySmoothFace(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolySmoothFace(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polySmoothFace", shared, create){}
 	virtual ~PolySmoothFace(){}
 
@@ -178,7 +178,7 @@ public:
 		fprintf(mFile,"\"%s.m08\"",mName.c_str());
 	}
 protected:
-	PolySmoothFace(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolySmoothFace(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolySmoothProxy():PolyModifier(){}
-	PolySmoothProxy(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolySmoothProxy(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polySmoothProxy", shared, create){}
 	virtual ~PolySmoothProxy(){}
 
@@ -173,7 +173,7 @@ public:
 		fprintf(mFile,"\"%s.mn\"",mName.c_str());
 	}
 protected:
-	PolySmoothProxy(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolySmoothProxy(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
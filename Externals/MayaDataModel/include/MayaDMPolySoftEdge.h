@@ -20,7 +20,7 @@ public:
 public:
 
 	PolySoftEdge():PolyModifierWorld(){}
-	PolySoftEdge(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolySoftEdge(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polySoftEdge", shared, create){}
 	virtual ~PolySoftEdge(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.a\"",mName.c_str());
 	}
 protected:
-	PolySoftEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolySoftEdge(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolySphProj():PolyModifierWorld(){}
-	PolySphProj(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolySphProj(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polySphProj", shared, create){}
 	virtual ~PolySphProj(){}
 
@@ -235,7 +235,7 @@ public:
 		fprintf(mFile,"\"%s.cid\"",mName.c_str());
 	}
 protected:
-	PolySphProj(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolySphProj(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolySphere():PolyPrimitive(){}
-	PolySphere(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolySphere(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, "polySphere", shared, create){}
 	virtual ~PolySphere(){}
 
@@ -70,7 +70,7 @@ public:
 		fprintf(mFile,"\"%s.cuv\"",mName.c_str());
 	}
 protected:
-	PolySphere(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolySphere(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, nodeType, shared, create) {}
 
 };
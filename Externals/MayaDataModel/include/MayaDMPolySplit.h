@@ -20,7 +20,7 @@ public:
 public:
 
 	PolySplit():PolyModifier(){}
-	PolySplit(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolySplit(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polySplit", shared, create){}
 	virtual ~PolySplit(){}
 
@@ -34,11 +34,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".v[%i:%i]\" ", v_start,v_end);
 		size_t size = (v_end-v_start)*3+3;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",v[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(v,size);
 		fprintf(mFile,";\n");
 	}
 	void startVertices(size_t v_start,size_t v_end)const
@@ -77,11 +73,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".e[%i:%i]\" ", e_start,e_end);
 		size_t size = (e_end-e_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",e[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(e,size);
 		fprintf(mFile,";\n");
 	}
 	void startEdge(size_t e_start,size_t e_end)const
@@ -105,11 +97,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".d[%i:%i]\" ", d_start,d_end);
 		size_t size = (d_end-d_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",d[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(d,size);
 		fprintf(mFile,";\n");
 	}
 	void startDesc(size_t d_start,size_t d_end)const
@@ -202,7 +190,7 @@ public:
 		fprintf(mFile,"\"%s.sma\"",mName.c_str());
 	}
 protected:
-	PolySplit(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolySplit(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -19,12 +19,12 @@ class PolySplitEdge : public PolyModifier
 public:
 
 	PolySplitEdge():PolyModifier(){}
-	PolySplitEdge(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolySplitEdge(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polySplitEdge", shared, create){}
 	virtual ~PolySplitEdge(){}
 
 protected:
-	PolySplitEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolySplitEdge(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -21,7 +21,7 @@ public:
 		float profileCurve_Position;
 		float profileCurve_FloatValue;
 		unsigned int profileCurve_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", profileCurve_Position);
 			fprintf(file,"%f ", profileCurve_FloatValue);
@@ -31,7 +31,7 @@ public:
 public:
 
 	PolySplitRing():PolyModifierWorld(){}
-	PolySplitRing(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolySplitRing(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polySplitRing", shared, create){}
 	virtual ~PolySplitRing(){}
 
@@ -230,7 +230,7 @@ public:
 		fprintf(mFile,"\"%s.fq\"",mName.c_str());
 	}
 protected:
-	PolySplitRing(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolySplitRing(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
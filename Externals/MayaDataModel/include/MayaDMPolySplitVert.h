@@ -19,12 +19,12 @@ class PolySplitVert : public PolyModifierWorld
 public:
 
 	PolySplitVert():PolyModifierWorld(){}
-	PolySplitVert(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolySplitVert(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polySplitVert", shared, create){}
 	virtual ~PolySplitVert(){}
 
 protected:
-	PolySplitVert(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolySplitVert(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
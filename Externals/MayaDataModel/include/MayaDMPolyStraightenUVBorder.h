@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyStraightenUVBorder():PolyModifierUV(){}
-	PolyStraightenUVBorder(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyStraightenUVBorder(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierUV(file, name, parent, "polyStraightenUVBorder", shared, create){}
 	virtual ~PolyStraightenUVBorder(){}
 
@@ -61,7 +61,7 @@ public:
 		fprintf(mFile,"\"%s.gt\"",mName.c_str());
 	}
 protected:
-	PolyStraightenUVBorder(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyStraightenUVBorder(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierUV(file, name, parent, nodeType, shared, create) {}
 
 };
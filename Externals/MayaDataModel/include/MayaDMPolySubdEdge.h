@@ -20,7 +20,7 @@ public:
 public:
 
 	PolySubdEdge():PolyModifierWorld(){}
-	PolySubdEdge(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolySubdEdge(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polySubdEdge", shared, create){}
 	virtual ~PolySubdEdge(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.s\"",mName.c_str());
 	}
 protected:
-	PolySubdEdge(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolySubdEdge(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolySubdFace():PolyModifier(){}
-	PolySubdFace(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolySubdFace(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polySubdFace", shared, create){}
 	virtual ~PolySubdFace(){}
 
@@ -70,7 +70,7 @@ public:
 		fprintf(mFile,"\"%s.sbm\"",mName.c_str());
 	}
 protected:
-	PolySubdFace(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolySubdFace(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
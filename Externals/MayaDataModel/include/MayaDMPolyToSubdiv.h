@@ -19,7 +19,7 @@ class PolyToSubdiv : public DependNode
 public:
 	struct CachedUVs{
 		float2* uvPoints;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(uvPoints)/sizeof(float2);
 			for(size_t i=0; i<size; ++i)
@@ -32,7 +32,7 @@ public:
 public:
 
 	PolyToSubdiv():DependNode(){}
-	PolyToSubdiv(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyToSubdiv(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "polyToSubdiv", shared, create){}
 	virtual ~PolyToSubdiv(){}
 
@@ -108,11 +108,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".cuv[%i].uvp[%i:%i]\" ", cuv_i,uvp_start,uvp_end);
 		size_t size = (uvp_end-uvp_start)*2+2;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",uvp[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(uvp,size);
 		fprintf(mFile,";\n");
 	}
 	void startUvPoints(size_t cuv_i,size_t uvp_start,size_t uvp_end)const
@@ -220,7 +216,7 @@ public:
 		fprintf(mFile,"\"%s.qc\"",mName.c_str());
 	}
 protected:
-	PolyToSubdiv(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyToSubdiv(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
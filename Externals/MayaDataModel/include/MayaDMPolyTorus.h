@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyTorus():PolyPrimitive(){}
-	PolyTorus(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyTorus(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, "polyTorus", shared, create){}
 	virtual ~PolyTorus(){}
 
@@ -93,7 +93,7 @@ public:
 		fprintf(mFile,"\"%s.cuv\"",mName.c_str());
 	}
 protected:
-	PolyTorus(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyTorus(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyPrimitive(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyTransfer():PolyModifier(){}
-	PolyTransfer(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyTransfer(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyTransfer", shared, create){}
 	virtual ~PolyTransfer(){}
 
@@ -62,7 +62,7 @@ public:
 		fprintf(mFile,"\"%s.vc\"",mName.c_str());
 	}
 protected:
-	PolyTransfer(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyTransfer(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyTriangulate():PolyModifier(){}
-	PolyTriangulate(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyTriangulate(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyTriangulate", shared, create){}
 	virtual ~PolyTriangulate(){}
 
@@ -30,7 +30,7 @@ public:
 		fprintf(mFile,"\tsetAttr \".m80\" %i;\n", m80);
 	}
 protected:
-	PolyTriangulate(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyTriangulate(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
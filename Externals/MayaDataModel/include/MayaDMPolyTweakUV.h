@@ -22,7 +22,7 @@ public:
 		int vertexId;
 		float newUValue;
 		float newVValue;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", faceId);
 			fprintf(file,"%i ", vertexId);
@@ -33,7 +33,7 @@ public:
 public:
 
 	PolyTweakUV():PolyModifier(){}
-	PolyTweakUV(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyTweakUV(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, "polyTweakUV", shared, create){}
 	virtual ~PolyTweakUV(){}
 
@@ -48,11 +48,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".uvtk[%i:%i]\" ", uvtk_start,uvtk_end);
 		size_t size = (uvtk_end-uvtk_start)*2+2;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",uvtk[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(uvtk,size);
 		fprintf(mFile,";\n");
 	}
 	void startUvTweak(size_t uvtk_start,size_t uvtk_end)const
@@ -212,7 +208,7 @@ public:
 		fprintf(mFile,"\"%s.uvs\"",mName.c_str());
 	}
 protected:
-	PolyTweakUV(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyTweakUV(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifier(file, name, parent, nodeType, shared, create) {}
 
 };
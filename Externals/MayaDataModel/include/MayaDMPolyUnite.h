@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyUnite():PolyCreator(){}
-	PolyUnite(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyUnite(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyCreator(file, name, parent, "polyUnite", shared, create){}
 	virtual ~PolyUnite(){}
 
@@ -48,7 +48,7 @@ public:
 		fprintf(mFile,"\"%s.im\"",mName.c_str());
 	}
 protected:
-	PolyUnite(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyUnite(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyCreator(file, name, parent, nodeType, shared, create) {}
 
 };
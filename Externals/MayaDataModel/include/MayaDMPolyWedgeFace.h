@@ -20,7 +20,7 @@ public:
 public:
 
 	PolyWedgeFace():PolyModifierWorld(){}
-	PolyWedgeFace(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PolyWedgeFace(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, "polyWedgeFace", shared, create){}
 	virtual ~PolyWedgeFace(){}
 
@@ -43,11 +43,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ed[%i:%i]\" ", ed_start,ed_end);
 		size_t size = (ed_end-ed_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",ed[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(ed,size);
 		fprintf(mFile,";\n");
 	}
 	void startEdge(size_t ed_start,size_t ed_end)const
@@ -80,7 +76,7 @@ public:
 		fprintf(mFile,"\"%s.ed\"",mName.c_str());
 	}
 protected:
-	PolyWedgeFace(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PolyWedgeFace(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	PositionMarker():Locator(){}
-	PositionMarker(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PositionMarker(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Locator(file, name, parent, "positionMarker", shared, create){}
 	virtual ~PositionMarker(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.t\"",mName.c_str());
 	}
 protected:
-	PositionMarker(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PositionMarker(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Locator(file, name, parent, nodeType, shared, create) {}
 
 };
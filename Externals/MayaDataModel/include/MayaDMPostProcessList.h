@@ -20,7 +20,7 @@ public:
 public:
 
 	PostProcessList():DependNode(){}
-	PostProcessList(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PostProcessList(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "postProcessList", shared, create){}
 	virtual ~PostProcessList(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.p\"",mName.c_str());
 	}
 protected:
-	PostProcessList(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PostProcessList(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
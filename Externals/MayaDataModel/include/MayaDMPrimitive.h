@@ -20,7 +20,7 @@ public:
 public:
 
 	Primitive():AbstractBaseCreate(){}
-	Primitive(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Primitive(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "primitive", shared, create){}
 	virtual ~Primitive(){}
 
@@ -103,7 +103,7 @@ public:
 		fprintf(mFile,"\"%s.os\"",mName.c_str());
 	}
 protected:
-	Primitive(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Primitive(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	ProjectCurve():AbstractBaseCreate(){}
-	ProjectCurve(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ProjectCurve(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "projectCurve", shared, create){}
 	virtual ~ProjectCurve(){}
 
@@ -97,7 +97,7 @@ public:
 		fprintf(mFile,"\"%s.un\"",mName.c_str());
 	}
 protected:
-	ProjectCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ProjectCurve(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
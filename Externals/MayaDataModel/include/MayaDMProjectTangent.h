@@ -20,7 +20,7 @@ public:
 public:
 
 	ProjectTangent():AbstractBaseCreate(){}
-	ProjectTangent(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ProjectTangent(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "projectTangent", shared, create){}
 	virtual ~ProjectTangent(){}
 
@@ -108,7 +108,7 @@ public:
 		fprintf(mFile,"\"%s.ie\"",mName.c_str());
 	}
 protected:
-	ProjectTangent(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ProjectTangent(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
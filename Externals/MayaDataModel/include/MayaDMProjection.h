@@ -20,7 +20,7 @@ public:
 public:
 
 	Projection():Texture3d(){}
-	Projection(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Projection(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, "projection", shared, create){}
 	virtual ~Projection(){}
 
@@ -578,7 +578,7 @@ public:
 		fprintf(mFile,"\"%s.tv.tvz\"",mName.c_str());
 	}
 protected:
-	Projection(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Projection(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, nodeType, shared, create) {}
 
 };
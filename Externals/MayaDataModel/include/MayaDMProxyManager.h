@@ -20,7 +20,7 @@ public:
 public:
 
 	ProxyManager():DependNode(){}
-	ProxyManager(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ProxyManager(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "proxyManager", shared, create){}
 	virtual ~ProxyManager(){}
 
@@ -42,7 +42,7 @@ public:
 		fprintf(mFile,"\"%s.psed\"",mName.c_str());
 	}
 protected:
-	ProxyManager(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ProxyManager(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
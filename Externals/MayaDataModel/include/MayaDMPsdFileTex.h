@@ -20,7 +20,7 @@ public:
 public:
 
 	PsdFileTex():File(){}
-	PsdFileTex(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	PsdFileTex(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:File(file, name, parent, "psdFileTex", shared, create){}
 	virtual ~PsdFileTex(){}
 
@@ -55,7 +55,7 @@ public:
 		fprintf(mFile,"\"%s.als\"",mName.c_str());
 	}
 protected:
-	PsdFileTex(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	PsdFileTex(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:File(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -21,14 +21,14 @@ public:
 		struct InQuad{
 			float3 inTriple;
 			float inSingle;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				inTriple.write(file);
 				fprintf(file, " ");
 				fprintf(file,"%f", inSingle);
 			}
 		} inQuad;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			inQuad.write(file);
 			fprintf(file, " ");
@@ -37,7 +37,7 @@ public:
 	struct Default{
 		float3 defTriple;
 		float defSingle;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			defTriple.write(file);
 			fprintf(file, " ");
@@ -45,14 +45,14 @@ public:
 		}
 	};
 	struct Output{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	QuadShadingSwitch():BaseShadingSwitch(){}
-	QuadShadingSwitch(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	QuadShadingSwitch(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:BaseShadingSwitch(file, name, parent, "quadShadingSwitch", shared, create){}
 	virtual ~QuadShadingSwitch(){}
 
@@ -273,7 +273,7 @@ public:
 		fprintf(mFile,"\"%s.out.osi\"",mName.c_str());
 	}
 protected:
-	QuadShadingSwitch(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	QuadShadingSwitch(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:BaseShadingSwitch(file, name, parent, nodeType, shared, create) {}
 
 };
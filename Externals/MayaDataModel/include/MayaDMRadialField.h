@@ -20,7 +20,7 @@ public:
 public:
 
 	RadialField():Field(){}
-	RadialField(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RadialField(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Field(file, name, parent, "radialField", shared, create){}
 	virtual ~RadialField(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.typ\"",mName.c_str());
 	}
 protected:
-	RadialField(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RadialField(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Field(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 	struct ColorEntryList{
 		float position;
 		float3 color;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", position);
 			color.write(file);
@@ -29,7 +29,7 @@ public:
 public:
 
 	Ramp():Texture2d(){}
-	Ramp(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Ramp(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, "ramp", shared, create){}
 	virtual ~Ramp(){}
 
@@ -254,7 +254,7 @@ public:
 		fprintf(mFile,"\"%s.vnf\"",mName.c_str());
 	}
 protected:
-	Ramp(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Ramp(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, nodeType, shared, create) {}
 
 };
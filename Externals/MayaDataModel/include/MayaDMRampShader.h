@@ -21,7 +21,7 @@ public:
 		float color_Position;
 		float3 color_Color;
 		unsigned int color_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", color_Position);
 			color_Color.write(file);
@@ -33,7 +33,7 @@ public:
 		float transparency_Position;
 		float3 transparency_Color;
 		unsigned int transparency_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", transparency_Position);
 			transparency_Color.write(file);
@@ -45,7 +45,7 @@ public:
 		float incandescence_Position;
 		float3 incandescence_Color;
 		unsigned int incandescence_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", incandescence_Position);
 			incandescence_Color.write(file);
@@ -57,7 +57,7 @@ public:
 		float specularRollOff_Position;
 		float specularRollOff_FloatValue;
 		unsigned int specularRollOff_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", specularRollOff_Position);
 			fprintf(file,"%f ", specularRollOff_FloatValue);
@@ -68,7 +68,7 @@ public:
 		float specularColor_Position;
 		float3 specularColor_Color;
 		unsigned int specularColor_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", specularColor_Position);
 			specularColor_Color.write(file);
@@ -80,7 +80,7 @@ public:
 		float reflectivity_Position;
 		float reflectivity_FloatValue;
 		unsigned int reflectivity_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", reflectivity_Position);
 			fprintf(file,"%f ", reflectivity_FloatValue);
@@ -91,7 +91,7 @@ public:
 		float environment_Position;
 		float3 environment_Color;
 		unsigned int environment_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", environment_Position);
 			environment_Color.write(file);
@@ -102,7 +102,7 @@ public:
 public:
 
 	RampShader():DependNode(){}
-	RampShader(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RampShader(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "rampShader", shared, create){}
 	virtual ~RampShader(){}
 
@@ -1871,7 +1871,7 @@ public:
 		fprintf(mFile,"\"%s.minc.mincz\"",mName.c_str());
 	}
 protected:
-	RampShader(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RampShader(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
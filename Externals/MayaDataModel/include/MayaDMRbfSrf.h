@@ -20,7 +20,7 @@ public:
 public:
 
 	RbfSrf():AbstractBaseCreate(){}
-	RbfSrf(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RbfSrf(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "rbfSrf", shared, create){}
 	virtual ~RbfSrf(){}
 
@@ -96,7 +96,7 @@ public:
 		fprintf(mFile,"\"%s.tcs\"",mName.c_str());
 	}
 protected:
-	RbfSrf(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RbfSrf(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
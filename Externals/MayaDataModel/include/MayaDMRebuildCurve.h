@@ -20,7 +20,7 @@ public:
 public:
 
 	RebuildCurve():AbstractBaseCreate(){}
-	RebuildCurve(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RebuildCurve(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "rebuildCurve", shared, create){}
 	virtual ~RebuildCurve(){}
 
@@ -136,7 +136,7 @@ public:
 		fprintf(mFile,"\"%s.scr\"",mName.c_str());
 	}
 protected:
-	RebuildCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RebuildCurve(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	RebuildSurface():AbstractBaseNurbsConversion(){}
-	RebuildSurface(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RebuildSurface(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseNurbsConversion(file, name, parent, "rebuildSurface", shared, create){}
 	virtual ~RebuildSurface(){}
 
@@ -154,7 +154,7 @@ public:
 		fprintf(mFile,"\"%s.os\"",mName.c_str());
 	}
 protected:
-	RebuildSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RebuildSurface(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseNurbsConversion(file, name, parent, nodeType, shared, create) {}
 
 };
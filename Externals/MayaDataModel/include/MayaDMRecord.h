@@ -20,7 +20,7 @@ public:
 public:
 
 	Record():DependNode(){}
-	Record(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Record(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "record", shared, create){}
 	virtual ~Record(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.i\"",mName.c_str());
 	}
 protected:
-	Record(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Record(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
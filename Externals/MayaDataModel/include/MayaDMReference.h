@@ -18,19 +18,19 @@ class Reference : public DependNode
 {
 public:
 	struct ConnectionList{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 	struct MultiParentList{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	Reference():DependNode(){}
-	Reference(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Reference(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "reference", shared, create){}
 	virtual ~Reference(){}
 
@@ -255,7 +255,7 @@ public:
 		fprintf(mFile,"\"%s.lk\"",mName.c_str());
 	}
 protected:
-	Reference(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Reference(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Reflect():Lambert(){}
-	Reflect(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Reflect(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Lambert(file, name, parent, "reflect", shared, create){}
 	virtual ~Reflect(){}
 
@@ -142,7 +142,7 @@ public:
 		fprintf(mFile,"\"%s.rsp\"",mName.c_str());
 	}
 protected:
-	Reflect(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Reflect(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Lambert(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -21,7 +21,7 @@ public:
 		float red_Position;
 		float red_FloatValue;
 		unsigned int red_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", red_Position);
 			fprintf(file,"%f ", red_FloatValue);
@@ -32,7 +32,7 @@ public:
 		float green_Position;
 		float green_FloatValue;
 		unsigned int green_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", green_Position);
 			fprintf(file,"%f ", green_FloatValue);
@@ -43,7 +43,7 @@ public:
 		float blue_Position;
 		float blue_FloatValue;
 		unsigned int blue_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", blue_Position);
 			fprintf(file,"%f ", blue_FloatValue);
@@ -53,7 +53,7 @@ public:
 public:
 
 	RemapColor():DependNode(){}
-	RemapColor(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RemapColor(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "remapColor", shared, create){}
 	virtual ~RemapColor(){}
 
@@ -393,7 +393,7 @@ public:
 		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
 	}
 protected:
-	RemapColor(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RemapColor(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -21,7 +21,7 @@ public:
 		float hue_Position;
 		float hue_FloatValue;
 		unsigned int hue_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", hue_Position);
 			fprintf(file,"%f ", hue_FloatValue);
@@ -32,7 +32,7 @@ public:
 		float saturation_Position;
 		float saturation_FloatValue;
 		unsigned int saturation_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", saturation_Position);
 			fprintf(file,"%f ", saturation_FloatValue);
@@ -43,7 +43,7 @@ public:
 		float value_Position;
 		float value_FloatValue;
 		unsigned int value_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", value_Position);
 			fprintf(file,"%f ", value_FloatValue);
@@ -53,7 +53,7 @@ public:
 public:
 
 	RemapHsv():DependNode(){}
-	RemapHsv(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RemapHsv(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "remapHsv", shared, create){}
 	virtual ~RemapHsv(){}
 
@@ -393,7 +393,7 @@ public:
 		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
 	}
 protected:
-	RemapHsv(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RemapHsv(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
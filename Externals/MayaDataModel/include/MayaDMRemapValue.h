@@ -21,7 +21,7 @@ public:
 		float value_Position;
 		float value_FloatValue;
 		unsigned int value_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", value_Position);
 			fprintf(file,"%f ", value_FloatValue);
@@ -32,7 +32,7 @@ public:
 		float color_Position;
 		float3 color_Color;
 		unsigned int color_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", color_Position);
 			color_Color.write(file);
@@ -43,7 +43,7 @@ public:
 public:
 
 	RemapValue():DependNode(){}
-	RemapValue(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RemapValue(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "remapValue", shared, create){}
 	virtual ~RemapValue(){}
 
@@ -320,7 +320,7 @@ public:
 		fprintf(mFile,"\"%s.oc.ocb\"",mName.c_str());
 	}
 protected:
-	RemapValue(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RemapValue(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
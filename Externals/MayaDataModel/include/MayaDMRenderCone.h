@@ -19,12 +19,12 @@ class RenderCone : public ImplicitCone
 public:
 
 	RenderCone():ImplicitCone(){}
-	RenderCone(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RenderCone(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:ImplicitCone(file, name, parent, "renderCone", shared, create){}
 	virtual ~RenderCone(){}
 
 protected:
-	RenderCone(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RenderCone(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:ImplicitCone(file, name, parent, nodeType, shared, create) {}
 
 };
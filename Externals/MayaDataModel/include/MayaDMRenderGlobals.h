@@ -20,7 +20,7 @@ public:
 public:
 
 	RenderGlobals():DependNode(){}
-	RenderGlobals(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RenderGlobals(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "renderGlobals", shared, create){}
 	virtual ~RenderGlobals(){}
 
@@ -827,7 +827,7 @@ public:
 		fprintf(mFile,"\"%s.oppf\"",mName.c_str());
 	}
 protected:
-	RenderGlobals(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RenderGlobals(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
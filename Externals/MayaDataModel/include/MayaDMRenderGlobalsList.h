@@ -20,7 +20,7 @@ public:
 public:
 
 	RenderGlobalsList():DependNode(){}
-	RenderGlobalsList(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RenderGlobalsList(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "renderGlobalsList", shared, create){}
 	virtual ~RenderGlobalsList(){}
 
@@ -52,7 +52,7 @@ public:
 		fprintf(mFile,"\"%s.rr\"",mName.c_str());
 	}
 protected:
-	RenderGlobalsList(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RenderGlobalsList(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -21,7 +21,7 @@ public:
 		short identification;
 		bool renderable;
 		unsigned char drawColor;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", identification);
 			fprintf(file,"%i ", renderable);
@@ -35,7 +35,7 @@ public:
 		bool diffuse;
 		bool specular;
 		bool shadow;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", beauty);
 			fprintf(file,"%i ", color);
@@ -47,25 +47,25 @@ public:
 	};
 	struct MentalRayControls{
 		bool globalIllum;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i", globalIllum);
 		}
 	};
 	struct Adjustments{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 	struct OutAdjustments{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	RenderLayer():DependNode(){}
-	RenderLayer(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RenderLayer(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "renderLayer", shared, create){}
 	virtual ~RenderLayer(){}
 
@@ -415,7 +415,7 @@ public:
 		fprintf(mFile,"\"%s.ac\"",mName.c_str());
 	}
 protected:
-	RenderLayer(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RenderLayer(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	RenderLayerManager():DependNode(){}
-	RenderLayerManager(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RenderLayerManager(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "renderLayerManager", shared, create){}
 	virtual ~RenderLayerManager(){}
 
@@ -71,7 +71,7 @@ public:
 		fprintf(mFile,"\"%s.rlmi\"",mName.c_str());
 	}
 protected:
-	RenderLayerManager(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RenderLayerManager(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
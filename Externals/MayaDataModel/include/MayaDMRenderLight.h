@@ -20,7 +20,7 @@ public:
 public:
 
 	RenderLight():Light(){}
-	RenderLight(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RenderLight(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Light(file, name, parent, "renderLight", shared, create){}
 	virtual ~RenderLight(){}
 
@@ -29,7 +29,7 @@ public:
 		fprintf(mFile,"\"%s.ryi\"",mName.c_str());
 	}
 protected:
-	RenderLight(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RenderLight(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Light(file, name, parent, nodeType, shared, create) {}
 
 };
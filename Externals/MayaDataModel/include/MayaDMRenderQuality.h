@@ -20,7 +20,7 @@ public:
 public:
 
 	RenderQuality():DependNode(){}
-	RenderQuality(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RenderQuality(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "renderQuality", shared, create){}
 	virtual ~RenderQuality(){}
 
@@ -223,7 +223,7 @@ public:
 		fprintf(mFile,"\"%s.cct\"",mName.c_str());
 	}
 protected:
-	RenderQuality(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RenderQuality(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -19,12 +19,12 @@ class RenderRect : public GeometryShape
 public:
 
 	RenderRect():GeometryShape(){}
-	RenderRect(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RenderRect(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryShape(file, name, parent, "renderRect", shared, create){}
 	virtual ~RenderRect(){}
 
 protected:
-	RenderRect(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RenderRect(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryShape(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Resolution():DependNode(){}
-	Resolution(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Resolution(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "resolution", shared, create){}
 	virtual ~Resolution(){}
 
@@ -133,7 +133,7 @@ public:
 		fprintf(mFile,"\"%s.pdu\"",mName.c_str());
 	}
 protected:
-	Resolution(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Resolution(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
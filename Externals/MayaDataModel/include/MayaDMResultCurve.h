@@ -20,7 +20,7 @@ public:
 public:
 
 	ResultCurve():AnimCurve(){}
-	ResultCurve(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ResultCurve(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AnimCurve(file, name, parent, "resultCurve", shared, create){}
 	virtual ~ResultCurve(){}
 
@@ -52,7 +52,7 @@ public:
 		fprintf(mFile,"\"%s.sby\"",mName.c_str());
 	}
 protected:
-	ResultCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ResultCurve(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AnimCurve(file, name, parent, nodeType, shared, create) {}
 
 };
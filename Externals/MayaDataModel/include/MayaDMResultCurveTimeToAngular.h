@@ -20,7 +20,7 @@ public:
 	struct KeyTimeValue{
 		double keyTime;
 		double keyValue;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", keyTime);
 			fprintf(file,"%f", keyValue);
@@ -29,7 +29,7 @@ public:
 public:
 
 	ResultCurveTimeToAngular():ResultCurve(){}
-	ResultCurveTimeToAngular(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ResultCurveTimeToAngular(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:ResultCurve(file, name, parent, "resultCurveTimeToAngular", shared, create){}
 	virtual ~ResultCurveTimeToAngular(){}
 
@@ -87,7 +87,7 @@ public:
 		fprintf(mFile,"\"%s.ir\"",mName.c_str());
 	}
 protected:
-	ResultCurveTimeToAngular(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ResultCurveTimeToAngular(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:ResultCurve(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Reverse():DependNode(){}
-	Reverse(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Reverse(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "reverse", shared, create){}
 	virtual ~Reverse(){}
 
@@ -79,7 +79,7 @@ public:
 		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
 	}
 protected:
-	Reverse(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Reverse(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
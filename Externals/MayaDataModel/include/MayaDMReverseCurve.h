@@ -20,7 +20,7 @@ public:
 public:
 
 	ReverseCurve():AbstractBaseCreate(){}
-	ReverseCurve(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ReverseCurve(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "reverseCurve", shared, create){}
 	virtual ~ReverseCurve(){}
 
@@ -33,7 +33,7 @@ public:
 		fprintf(mFile,"\"%s.oc\"",mName.c_str());
 	}
 protected:
-	ReverseCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ReverseCurve(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
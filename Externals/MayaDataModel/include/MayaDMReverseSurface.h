@@ -20,7 +20,7 @@ public:
 public:
 
 	ReverseSurface():AbstractBaseCreate(){}
-	ReverseSurface(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ReverseSurface(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "reverseSurface", shared, create){}
 	virtual ~ReverseSurface(){}
 
@@ -42,7 +42,7 @@ public:
 		fprintf(mFile,"\"%s.os\"",mName.c_str());
 	}
 protected:
-	ReverseSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ReverseSurface(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
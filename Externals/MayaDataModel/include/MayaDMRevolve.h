@@ -20,7 +20,7 @@ public:
 public:
 
 	Revolve():AbstractBaseCreate(){}
-	Revolve(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Revolve(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "revolve", shared, create){}
 	virtual ~Revolve(){}
 
@@ -271,7 +271,7 @@ public:
 		fprintf(mFile,"\"%s.cn.cnz\"",mName.c_str());
 	}
 protected:
-	Revolve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Revolve(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	RevolvedPrimitive():Primitive(){}
-	RevolvedPrimitive(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RevolvedPrimitive(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Primitive(file, name, parent, "revolvedPrimitive", shared, create){}
 	virtual ~RevolvedPrimitive(){}
 
@@ -118,7 +118,7 @@ public:
 		fprintf(mFile,"\"%s.asd\"",mName.c_str());
 	}
 protected:
-	RevolvedPrimitive(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RevolvedPrimitive(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Primitive(file, name, parent, nodeType, shared, create) {}
 
 };
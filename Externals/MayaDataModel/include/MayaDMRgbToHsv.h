@@ -20,7 +20,7 @@ public:
 public:
 
 	RgbToHsv():DependNode(){}
-	RgbToHsv(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RgbToHsv(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "rgbToHsv", shared, create){}
 	virtual ~RgbToHsv(){}
 
@@ -79,7 +79,7 @@ public:
 		fprintf(mFile,"\"%s.o.ov\"",mName.c_str());
 	}
 protected:
-	RgbToHsv(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RgbToHsv(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
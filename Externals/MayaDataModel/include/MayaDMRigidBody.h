@@ -18,19 +18,19 @@ class RigidBody : public Shape
 {
 public:
 	struct FieldData{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 	struct GeneralForce{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	RigidBody():Shape(){}
-	RigidBody(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RigidBody(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Shape(file, name, parent, "rigidBody", shared, create){}
 	virtual ~RigidBody(){}
 
@@ -872,7 +872,7 @@ public:
 		fprintf(mFile,"\"%s.dd\"",mName.c_str());
 	}
 protected:
-	RigidBody(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RigidBody(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Shape(file, name, parent, nodeType, shared, create) {}
 
 };
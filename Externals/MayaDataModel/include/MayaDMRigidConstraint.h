@@ -20,7 +20,7 @@ public:
 public:
 
 	RigidConstraint():Transform(){}
-	RigidConstraint(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RigidConstraint(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Transform(file, name, parent, "rigidConstraint", shared, create){}
 	virtual ~RigidConstraint(){}
 
@@ -252,7 +252,7 @@ public:
 		fprintf(mFile,"\"%s.udp.upz\"",mName.c_str());
 	}
 protected:
-	RigidConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RigidConstraint(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Transform(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 	struct GeneralForce{
 		vectorArray inputForce;
 		vectorArray inputTorque;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			inputForce.write(file);
 			fprintf(file, " ");
@@ -30,7 +30,7 @@ public:
 public:
 
 	RigidSolver():DependNode(){}
-	RigidSolver(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RigidSolver(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "rigidSolver", shared, create){}
 	virtual ~RigidSolver(){}
 
@@ -94,11 +94,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".t[%i:%i]\" ", t_start,t_end);
 		size_t size = (t_end-t_start)*3+3;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",t[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(t,size);
 		fprintf(mFile,";\n");
 	}
 	void startTranslate(size_t t_start,size_t t_end)const
@@ -138,11 +134,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".r[%i:%i]\" ", r_start,r_end);
 		size_t size = (r_end-r_start)*3+3;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",r[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(r,size);
 		fprintf(mFile,";\n");
 	}
 	void startRotate(size_t r_start,size_t r_end)const
@@ -182,11 +174,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ctr[%i:%i]\" ", ctr_start,ctr_end);
 		size_t size = (ctr_end-ctr_start)*3+3;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",ctr[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(ctr,size);
 		fprintf(mFile,";\n");
 	}
 	void startConstraintTranslate(size_t ctr_start,size_t ctr_end)const
@@ -226,11 +214,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".cr[%i:%i]\" ", cr_start,cr_end);
 		size_t size = (cr_end-cr_start)*3+3;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",cr[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(cr,size);
 		fprintf(mFile,";\n");
 	}
 	void startConstraintRotate(size_t cr_start,size_t cr_end)const
@@ -587,7 +571,7 @@ public:
 		fprintf(mFile,"\"%s.stt\"",mName.c_str());
 	}
 protected:
-	RigidSolver(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RigidSolver(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Rock():Texture3d(){}
-	Rock(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Rock(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, "rock", shared, create){}
 	virtual ~Rock(){}
 
@@ -160,7 +160,7 @@ public:
 		fprintf(mFile,"\"%s.mr\"",mName.c_str());
 	}
 protected:
-	Rock(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Rock(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -23,7 +23,7 @@ public:
 		int* inSurfIdxA;
 		int* inSurfIdxB;
 		bool edgeValid;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(inputCurveA)/sizeof(nurbsCurve);
 			for(size_t i=0; i<size; ++i)
@@ -57,7 +57,7 @@ public:
 public:
 
 	RoundConstantRadius():AbstractBaseCreate(){}
-	RoundConstantRadius(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	RoundConstantRadius(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "roundConstantRadius", shared, create){}
 	virtual ~RoundConstantRadius(){}
 
@@ -101,11 +101,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".r[%i:%i]\" ", r_start,r_end);
 		size_t size = (r_end-r_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",r[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(r,size);
 		fprintf(mFile,";\n");
 	}
 	void startRadius(size_t r_start,size_t r_end)const
@@ -222,11 +218,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".e[%i].isa[%i:%i]\" ", e_i,isa_start,isa_end);
 		size_t size = (isa_end-isa_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",isa[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(isa,size);
 		fprintf(mFile,";\n");
 	}
 	void startInSurfIdxA(size_t e_i,size_t isa_start,size_t isa_end)const
@@ -250,11 +242,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".e[%i].isb[%i:%i]\" ", e_i,isb_start,isb_end);
 		size_t size = (isb_end-isb_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",isb[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(isb,size);
 		fprintf(mFile,";\n");
 	}
 	void startInSurfIdxB(size_t e_i,size_t isb_start,size_t isb_end)const
@@ -356,7 +344,7 @@ public:
 		fprintf(mFile,"\"%s.cs\"",mName.c_str());
 	}
 protected:
-	RoundConstantRadius(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	RoundConstantRadius(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
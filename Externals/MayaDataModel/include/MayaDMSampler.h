@@ -21,7 +21,7 @@ public:
 		struct Function_Inmap{
 			short function_InmapTo;
 			short function_InmapFrom;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				fprintf(file,"%i ", function_InmapTo);
 				fprintf(file,"%i", function_InmapFrom);
@@ -30,14 +30,14 @@ public:
 		struct Function_Outmap{
 			short function_OutmapTo;
 			short function_OutmapFrom;
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				fprintf(file,"%i ", function_OutmapTo);
 				fprintf(file,"%i", function_OutmapFrom);
 			}
 		}* function_Outmap;
 		double function_Default;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(function_Inmap)/sizeof(Function_Inmap);
 			for(size_t i=0; i<size; ++i)
@@ -59,7 +59,7 @@ public:
 public:
 
 	Sampler():DependNode(){}
-	Sampler(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Sampler(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "sampler", shared, create){}
 	virtual ~Sampler(){}
 
@@ -238,7 +238,7 @@ public:
 		fprintf(mFile,"\"%s.f.fd\"",mName.c_str());
 	}
 protected:
-	Sampler(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Sampler(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	SamplerInfo():DependNode(){}
-	SamplerInfo(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SamplerInfo(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "samplerInfo", shared, create){}
 	virtual ~SamplerInfo(){}
 
@@ -371,7 +371,7 @@ public:
 		fprintf(mFile,"\"%s.fr\"",mName.c_str());
 	}
 protected:
-	SamplerInfo(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SamplerInfo(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -21,7 +21,7 @@ public:
 		double3 targetScale;
 		matrix targetParentMatrix;
 		double targetWeight;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			targetScale.write(file);
 			fprintf(file, " ");
@@ -33,7 +33,7 @@ public:
 public:
 
 	ScaleConstraint():Constraint(){}
-	ScaleConstraint(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ScaleConstraint(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Constraint(file, name, parent, "scaleConstraint", shared, create){}
 	virtual ~ScaleConstraint(){}
 
@@ -245,7 +245,7 @@ public:
 		fprintf(mFile,"\"%s.rs.rsz\"",mName.c_str());
 	}
 protected:
-	ScaleConstraint(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ScaleConstraint(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Constraint(file, name, parent, nodeType, shared, create) {}
 
 };
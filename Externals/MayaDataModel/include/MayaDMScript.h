@@ -20,7 +20,7 @@ public:
 public:
 
 	Script():DependNode(){}
-	Script(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Script(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "script", shared, create){}
 	virtual ~Script(){}
 
@@ -56,7 +56,7 @@ public:
 		fprintf(mFile,"\"%s.st\"",mName.c_str());
 	}
 protected:
-	Script(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Script(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Sculpt():GeometryFilter(){}
-	Sculpt(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Sculpt(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, "sculpt", shared, create){}
 	virtual ~Sculpt(){}
 
@@ -131,7 +131,7 @@ public:
 		fprintf(mFile,"\"%s.exd\"",mName.c_str());
 	}
 protected:
-	Sculpt(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Sculpt(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, nodeType, shared, create) {}
 
 };
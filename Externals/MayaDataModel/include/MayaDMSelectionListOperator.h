@@ -20,7 +20,7 @@ public:
 public:
 
 	SelectionListOperator():DependNode(){}
-	SelectionListOperator(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SelectionListOperator(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "selectionListOperator", shared, create){}
 	virtual ~SelectionListOperator(){}
 
@@ -55,7 +55,7 @@ public:
 		fprintf(mFile,"\"%s.ocls\"",mName.c_str());
 	}
 protected:
-	SelectionListOperator(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SelectionListOperator(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
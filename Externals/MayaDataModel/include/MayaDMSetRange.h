@@ -20,7 +20,7 @@ public:
 public:
 
 	SetRange():DependNode(){}
-	SetRange(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SetRange(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "setRange", shared, create){}
 	virtual ~SetRange(){}
 
@@ -231,7 +231,7 @@ public:
 		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
 	}
 protected:
-	SetRange(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SetRange(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	ShaderGlow():DependNode(){}
-	ShaderGlow(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ShaderGlow(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "shaderGlow", shared, create){}
 	virtual ~ShaderGlow(){}
 
@@ -335,7 +335,7 @@ public:
 		fprintf(mFile,"\"%s.ae\"",mName.c_str());
 	}
 protected:
-	ShaderGlow(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ShaderGlow(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	ShadingEngine():ObjectSet(){}
-	ShadingEngine(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ShadingEngine(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:ObjectSet(file, name, parent, "shadingEngine", shared, create){}
 	virtual ~ShadingEngine(){}
 
@@ -195,7 +195,7 @@ public:
 		fprintf(mFile,"\"%s.mirw\"",mName.c_str());
 	}
 protected:
-	ShadingEngine(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ShadingEngine(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:ObjectSet(file, name, parent, nodeType, shared, create) {}
 
 };
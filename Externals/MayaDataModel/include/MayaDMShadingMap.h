@@ -20,7 +20,7 @@ public:
 public:
 
 	ShadingMap():DependNode(){}
-	ShadingMap(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ShadingMap(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "shadingMap", shared, create){}
 	virtual ~ShadingMap(){}
 
@@ -578,7 +578,7 @@ public:
 		fprintf(mFile,"\"%s.minc.mincz\"",mName.c_str());
 	}
 protected:
-	ShadingMap(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ShadingMap(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
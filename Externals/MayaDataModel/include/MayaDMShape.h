@@ -19,12 +19,12 @@ class Shape : public DagNode
 public:
 
 	Shape():DagNode(){}
-	Shape(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Shape(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DagNode(file, name, parent, "shape", shared, create){}
 	virtual ~Shape(){}
 
 protected:
-	Shape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Shape(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DagNode(file, name, parent, nodeType, shared, create) {}
 
 };
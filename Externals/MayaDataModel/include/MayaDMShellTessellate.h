@@ -20,7 +20,7 @@ public:
 public:
 
 	ShellTessellate():ParentTessellate(){}
-	ShellTessellate(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ShellTessellate(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:ParentTessellate(file, name, parent, "shellTessellate", shared, create){}
 	virtual ~ShellTessellate(){}
 
@@ -29,7 +29,7 @@ public:
 		fprintf(mFile,"\"%s.is\"",mName.c_str());
 	}
 protected:
-	ShellTessellate(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ShellTessellate(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:ParentTessellate(file, name, parent, nodeType, shared, create) {}
 
 };
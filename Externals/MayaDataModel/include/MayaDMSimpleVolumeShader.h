@@ -20,7 +20,7 @@ public:
 public:
 
 	SimpleVolumeShader():DependNode(){}
-	SimpleVolumeShader(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SimpleVolumeShader(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "simpleVolumeShader", shared, create){}
 	virtual ~SimpleVolumeShader(){}
 
@@ -179,7 +179,7 @@ public:
 		fprintf(mFile,"\"%s.ot.otb\"",mName.c_str());
 	}
 protected:
-	SimpleVolumeShader(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SimpleVolumeShader(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
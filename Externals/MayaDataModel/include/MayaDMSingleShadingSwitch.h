@@ -19,7 +19,7 @@ class SingleShadingSwitch : public BaseShadingSwitch
 public:
 	struct Input{
 		float inSingle;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", inSingle);
 		}
@@ -27,7 +27,7 @@ public:
 public:
 
 	SingleShadingSwitch():BaseShadingSwitch(){}
-	SingleShadingSwitch(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SingleShadingSwitch(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:BaseShadingSwitch(file, name, parent, "singleShadingSwitch", shared, create){}
 	virtual ~SingleShadingSwitch(){}
 
@@ -108,7 +108,7 @@ public:
 		fprintf(mFile,"\"%s.out\"",mName.c_str());
 	}
 protected:
-	SingleShadingSwitch(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SingleShadingSwitch(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:BaseShadingSwitch(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -19,12 +19,12 @@ class SketchPlane : public Plane
 public:
 
 	SketchPlane():Plane(){}
-	SketchPlane(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SketchPlane(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Plane(file, name, parent, "sketchPlane", shared, create){}
 	virtual ~SketchPlane(){}
 
 protected:
-	SketchPlane(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SketchPlane(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Plane(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -19,7 +19,7 @@ class SkinCluster : public GeometryFilter
 public:
 	struct WeightList{
 		double* weights;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(weights)/sizeof(double);
 			for(size_t i=0; i<size; ++i)
@@ -32,7 +32,7 @@ public:
 public:
 
 	SkinCluster():GeometryFilter(){}
-	SkinCluster(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SkinCluster(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, "skinCluster", shared, create){}
 	virtual ~SkinCluster(){}
 
@@ -76,11 +76,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".wl[%i].w[%i:%i]\" ", wl_i,w_start,w_end);
 		size_t size = (w_end-w_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",w[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(w,size);
 		fprintf(mFile,";\n");
 	}
 	void startWeights(size_t wl_i,size_t w_start,size_t w_end)const
@@ -175,11 +171,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".dpf[%i:%i]\" ", dpf_start,dpf_end);
 		size_t size = (dpf_end-dpf_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",dpf[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(dpf,size);
 		fprintf(mFile,";\n");
 	}
 	void startDropoff(size_t dpf_start,size_t dpf_end)const
@@ -203,11 +195,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".smt[%i:%i]\" ", smt_start,smt_end);
 		size_t size = (smt_end-smt_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",smt[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(smt,size);
 		fprintf(mFile,";\n");
 	}
 	void startSmoothness(size_t smt_start,size_t smt_end)const
@@ -286,11 +274,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ns[%i:%i]\" ", ns_start,ns_end);
 		size_t size = (ns_end-ns_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",ns[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(ns,size);
 		fprintf(mFile,";\n");
 	}
 	void startNurbsSamples(size_t ns_start,size_t ns_end)const
@@ -471,7 +455,7 @@ public:
 		fprintf(mFile,"\"%s.bp\"",mName.c_str());
 	}
 protected:
-	SkinCluster(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SkinCluster(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Smear():DependNode(){}
-	Smear(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Smear(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "smear", shared, create){}
 	virtual ~Smear(){}
 
@@ -75,7 +75,7 @@ public:
 		fprintf(mFile,"\"%s.o.ov\"",mName.c_str());
 	}
 protected:
-	Smear(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Smear(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
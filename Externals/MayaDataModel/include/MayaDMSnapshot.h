@@ -20,7 +20,7 @@ public:
 public:
 
 	Snapshot():DependNode(){}
-	Snapshot(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Snapshot(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "snapshot", shared, create){}
 	virtual ~Snapshot(){}
 
@@ -135,7 +135,7 @@ public:
 		fprintf(mFile,"\"%s.up\"",mName.c_str());
 	}
 protected:
-	Snapshot(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Snapshot(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
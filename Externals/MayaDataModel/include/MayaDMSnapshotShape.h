@@ -20,7 +20,7 @@ public:
 public:
 
 	SnapshotShape():GeometryShape(){}
-	SnapshotShape(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SnapshotShape(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryShape(file, name, parent, "snapshotShape", shared, create){}
 	virtual ~SnapshotShape(){}
 
@@ -65,7 +65,7 @@ public:
 		fprintf(mFile,"\"%s.sf\"",mName.c_str());
 	}
 protected:
-	SnapshotShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SnapshotShape(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryShape(file, name, parent, nodeType, shared, create) {}
 
 };
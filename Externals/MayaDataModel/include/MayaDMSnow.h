@@ -20,7 +20,7 @@ public:
 public:
 
 	Snow():Texture3d(){}
-	Snow(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Snow(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, "snow", shared, create){}
 	virtual ~Snow(){}
 
@@ -180,7 +180,7 @@ public:
 		fprintf(mFile,"\"%s.tn\"",mName.c_str());
 	}
 protected:
-	Snow(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Snow(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -18,7 +18,7 @@ class SoftMod : public WeightGeometryFilter
 {
 public:
 	struct SoftModXforms{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
@@ -26,7 +26,7 @@ public:
 		float falloffCurve_Position;
 		float falloffCurve_FloatValue;
 		unsigned int falloffCurve_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", falloffCurve_Position);
 			fprintf(file,"%f ", falloffCurve_FloatValue);
@@ -36,7 +36,7 @@ public:
 public:
 
 	SoftMod():WeightGeometryFilter(){}
-	SoftMod(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SoftMod(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:WeightGeometryFilter(file, name, parent, "softMod", shared, create){}
 	virtual ~SoftMod(){}
 
@@ -369,7 +369,7 @@ public:
 		fprintf(mFile,"\"%s.fom\"",mName.c_str());
 	}
 protected:
-	SoftMod(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SoftMod(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:WeightGeometryFilter(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -18,14 +18,14 @@ class SoftModHandle : public Shape
 {
 public:
 	struct SoftModTransforms{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	SoftModHandle():Shape(){}
-	SoftModHandle(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SoftModHandle(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Shape(file, name, parent, "softModHandle", shared, create){}
 	virtual ~SoftModHandle(){}
 
@@ -107,7 +107,7 @@ public:
 		fprintf(mFile,"\"%s.wn\"",mName.c_str());
 	}
 protected:
-	SoftModHandle(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SoftModHandle(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Shape(file, name, parent, nodeType, shared, create) {}
 
 };
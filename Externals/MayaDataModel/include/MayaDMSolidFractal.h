@@ -20,7 +20,7 @@ public:
 public:
 
 	SolidFractal():Texture3d(){}
-	SolidFractal(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SolidFractal(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, "solidFractal", shared, create){}
 	virtual ~SolidFractal(){}
 
@@ -214,7 +214,7 @@ public:
 		fprintf(mFile,"\"%s.ti\"",mName.c_str());
 	}
 protected:
-	SolidFractal(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SolidFractal(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	SpBirailSrf():BirailSrf(){}
-	SpBirailSrf(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SpBirailSrf(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:BirailSrf(file, name, parent, "spBirailSrf", shared, create){}
 	virtual ~SpBirailSrf(){}
 
@@ -38,7 +38,7 @@ public:
 		fprintf(mFile,"\"%s.tp1\"",mName.c_str());
 	}
 protected:
-	SpBirailSrf(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SpBirailSrf(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:BirailSrf(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -47,7 +47,7 @@ public:
 		short areaLowLevel;
 		short2 areaLowSampling;
 		bool areaVisible;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", miExportMrLight);
 			fprintf(file,"%i ", emitPhotons);
@@ -89,7 +89,7 @@ public:
 public:
 
 	SpotLight():NonExtendedLightShapeNode(){}
-	SpotLight(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SpotLight(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:NonExtendedLightShapeNode(file, name, parent, "spotLight", shared, create){}
 	virtual ~SpotLight(){}
 
@@ -772,7 +772,7 @@ public:
 		fprintf(mFile,"\"%s.mrc.avis\"",mName.c_str());
 	}
 protected:
-	SpotLight(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SpotLight(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:NonExtendedLightShapeNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -18,14 +18,14 @@ class Spring : public Shape
 {
 public:
 	struct IdMapping{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	Spring():Shape(){}
-	Spring(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Spring(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Shape(file, name, parent, "spring", shared, create){}
 	virtual ~Spring(){}
 
@@ -195,11 +195,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".dt[%i:%i]\" ", dt_start,dt_end);
 		size_t size = (dt_end-dt_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",dt[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(dt,size);
 		fprintf(mFile,";\n");
 	}
 	void startDeltaTime(size_t dt_start,size_t dt_end)const
@@ -416,7 +412,7 @@ public:
 		fprintf(mFile,"\"%s.ooi\"",mName.c_str());
 	}
 protected:
-	Spring(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Spring(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Shape(file, name, parent, nodeType, shared, create) {}
 
 };
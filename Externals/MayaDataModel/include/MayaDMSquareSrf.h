@@ -20,7 +20,7 @@ public:
 public:
 
 	SquareSrf():BoundaryBase(){}
-	SquareSrf(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SquareSrf(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:BoundaryBase(file, name, parent, "squareSrf", shared, create){}
 	virtual ~SquareSrf(){}
 
@@ -122,7 +122,7 @@ public:
 		fprintf(mFile,"\"%s.cp4\"",mName.c_str());
 	}
 protected:
-	SquareSrf(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SquareSrf(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:BoundaryBase(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Stencil():Texture2d(){}
-	Stencil(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Stencil(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, "stencil", shared, create){}
 	virtual ~Stencil(){}
 
@@ -173,7 +173,7 @@ public:
 		fprintf(mFile,"\"%s.th\"",mName.c_str());
 	}
 protected:
-	Stencil(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Stencil(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	StitchAsNurbsShell():AbstractBaseCreate(){}
-	StitchAsNurbsShell(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	StitchAsNurbsShell(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "stitchAsNurbsShell", shared, create){}
 	virtual ~StitchAsNurbsShell(){}
 
@@ -47,7 +47,7 @@ public:
 		fprintf(mFile,"\"%s.osh\"",mName.c_str());
 	}
 protected:
-	StitchAsNurbsShell(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	StitchAsNurbsShell(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	StitchSrf():AbstractBaseCreate(){}
-	StitchSrf(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	StitchSrf(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "stitchSrf", shared, create){}
 	virtual ~StitchSrf(){}
 
@@ -117,11 +117,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".tol[%i:%i]\" ", tol_start,tol_end);
 		size_t size = (tol_end-tol_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",tol[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(tol,size);
 		fprintf(mFile,";\n");
 	}
 	void startTolerance(size_t tol_start,size_t tol_end)const
@@ -145,11 +141,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".sc[%i:%i]\" ", sc_start,sc_end);
 		size_t size = (sc_end-sc_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",sc[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(sc,size);
 		fprintf(mFile,";\n");
 	}
 	void startStepCount(size_t sc_start,size_t sc_end)const
@@ -173,11 +165,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".u[%i:%i]\" ", u_start,u_end);
 		size_t size = (u_end-u_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",u[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(u,size);
 		fprintf(mFile,";\n");
 	}
 	void startParameterU(size_t u_start,size_t u_end)const
@@ -201,11 +189,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".v[%i:%i]\" ", v_start,v_end);
 		size_t size = (v_end-v_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",v[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(v,size);
 		fprintf(mFile,";\n");
 	}
 	void startParameterV(size_t v_start,size_t v_end)const
@@ -239,11 +223,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ci[%i:%i]\" ", ci_start,ci_end);
 		size_t size = (ci_end-ci_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",ci[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(ci,size);
 		fprintf(mFile,";\n");
 	}
 	void startCvIthIndex(size_t ci_start,size_t ci_end)const
@@ -267,11 +247,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".cj[%i:%i]\" ", cj_start,cj_end);
 		size_t size = (cj_end-cj_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",cj[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(cj,size);
 		fprintf(mFile,";\n");
 	}
 	void startCvJthIndex(size_t cj_start,size_t cj_end)const
@@ -541,7 +517,7 @@ public:
 		fprintf(mFile,"\"%s.os\"",mName.c_str());
 	}
 protected:
-	StitchSrf(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	StitchSrf(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
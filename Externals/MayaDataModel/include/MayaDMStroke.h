@@ -20,7 +20,7 @@ public:
 	struct PathCurve{
 		int samples;
 		bool opposite;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", samples);
 			fprintf(file,"%i", opposite);
@@ -30,7 +30,7 @@ public:
 		float pressureScale_Position;
 		float pressureScale_FloatValue;
 		unsigned int pressureScale_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", pressureScale_Position);
 			fprintf(file,"%f ", pressureScale_FloatValue);
@@ -40,7 +40,7 @@ public:
 public:
 
 	Stroke():PfxGeometry(){}
-	Stroke(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Stroke(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PfxGeometry(file, name, parent, "stroke", shared, create){}
 	virtual ~Stroke(){}
 
@@ -146,11 +146,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".opt[%i:%i]\" ", opt_start,opt_end);
 		size_t size = (opt_end-opt_start)*3+3;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",opt[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(opt,size);
 		fprintf(mFile,";\n");
 	}
 	void startOutPoint(size_t opt_start,size_t opt_end)const
@@ -280,11 +276,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".psr[%i:%i]\" ", psr_start,psr_end);
 		size_t size = (psr_end-psr_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",psr[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(psr,size);
 		fprintf(mFile,";\n");
 	}
 	void startPressure(size_t psr_start,size_t psr_end)const
@@ -538,7 +530,7 @@ public:
 		fprintf(mFile,"\"%s.uvsetn\"",mName.c_str());
 	}
 protected:
-	Stroke(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Stroke(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PfxGeometry(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	StrokeGlobals():DependNode(){}
-	StrokeGlobals(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	StrokeGlobals(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "strokeGlobals", shared, create){}
 	virtual ~StrokeGlobals(){}
 
@@ -152,7 +152,7 @@ public:
 		fprintf(mFile,"\"%s.ldr.ldz\"",mName.c_str());
 	}
 protected:
-	StrokeGlobals(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	StrokeGlobals(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
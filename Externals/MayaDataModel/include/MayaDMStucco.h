@@ -20,7 +20,7 @@ public:
 public:
 
 	Stucco():Texture3d(){}
-	Stucco(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Stucco(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, "stucco", shared, create){}
 	virtual ~Stucco(){}
 
@@ -192,7 +192,7 @@ public:
 		fprintf(mFile,"\"%s.on.onz\"",mName.c_str());
 	}
 protected:
-	Stucco(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Stucco(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	StudioClearCoat():DependNode(){}
-	StudioClearCoat(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	StudioClearCoat(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "studioClearCoat", shared, create){}
 	virtual ~StudioClearCoat(){}
 
@@ -88,7 +88,7 @@ public:
 		fprintf(mFile,"\"%s.outp\"",mName.c_str());
 	}
 protected:
-	StudioClearCoat(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	StudioClearCoat(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
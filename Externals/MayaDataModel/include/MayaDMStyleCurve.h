@@ -20,7 +20,7 @@ public:
 public:
 
 	StyleCurve():AbstractBaseCreate(){}
-	StyleCurve(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	StyleCurve(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "styleCurve", shared, create){}
 	virtual ~StyleCurve(){}
 
@@ -38,7 +38,7 @@ public:
 		fprintf(mFile,"\"%s.oc\"",mName.c_str());
 	}
 protected:
-	StyleCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	StyleCurve(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
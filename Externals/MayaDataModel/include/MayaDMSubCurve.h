@@ -20,7 +20,7 @@ public:
 public:
 
 	SubCurve():CurveRange(){}
-	SubCurve(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubCurve(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:CurveRange(file, name, parent, "subCurve", shared, create){}
 	virtual ~SubCurve(){}
 
@@ -60,7 +60,7 @@ public:
 		fprintf(mFile,"\"%s.oc\"",mName.c_str());
 	}
 protected:
-	SubCurve(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubCurve(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:CurveRange(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	SubSurface():AbstractBaseCreate(){}
-	SubSurface(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubSurface(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "subSurface", shared, create){}
 	virtual ~SubSurface(){}
 
@@ -69,7 +69,7 @@ public:
 		fprintf(mFile,"\"%s.os\"",mName.c_str());
 	}
 protected:
-	SubSurface(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubSurface(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
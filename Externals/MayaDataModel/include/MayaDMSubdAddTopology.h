@@ -19,12 +19,12 @@ class SubdAddTopology : public SubdModifier
 public:
 
 	SubdAddTopology():SubdModifier(){}
-	SubdAddTopology(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdAddTopology(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:SubdModifier(file, name, parent, "subdAddTopology", shared, create){}
 	virtual ~SubdAddTopology(){}
 
 protected:
-	SubdAddTopology(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdAddTopology(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:SubdModifier(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	SubdAutoProj():SubdModifierUV(){}
-	SubdAutoProj(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdAutoProj(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:SubdModifierUV(file, name, parent, "subdAutoProj", shared, create){}
 	virtual ~SubdAutoProj(){}
 
@@ -97,7 +97,7 @@ public:
 		fprintf(mFile,"\"%s.dl\"",mName.c_str());
 	}
 protected:
-	SubdAutoProj(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdAutoProj(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:SubdModifierUV(file, name, parent, nodeType, shared, create) {}
 
 };
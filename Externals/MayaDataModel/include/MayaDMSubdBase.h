@@ -20,7 +20,7 @@ public:
 public:
 
 	SubdBase():DependNode(){}
-	SubdBase(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdBase(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "subdBase", shared, create){}
 	virtual ~SubdBase(){}
 
@@ -29,7 +29,7 @@ public:
 		fprintf(mFile,"\"%s.os\"",mName.c_str());
 	}
 protected:
-	SubdBase(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdBase(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -19,12 +19,12 @@ class SubdBlindData : public PolyBlindData
 public:
 
 	SubdBlindData():PolyBlindData(){}
-	SubdBlindData(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdBlindData(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PolyBlindData(file, name, parent, "subdBlindData", shared, create){}
 	virtual ~SubdBlindData(){}
 
 protected:
-	SubdBlindData(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdBlindData(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PolyBlindData(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -19,12 +19,12 @@ class SubdCleanTopology : public SubdModifier
 public:
 
 	SubdCleanTopology():SubdModifier(){}
-	SubdCleanTopology(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdCleanTopology(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:SubdModifier(file, name, parent, "subdCleanTopology", shared, create){}
 	virtual ~SubdCleanTopology(){}
 
 protected:
-	SubdCleanTopology(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdCleanTopology(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:SubdModifier(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	SubdHierBlind():BlindDataTemplate(){}
-	SubdHierBlind(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdHierBlind(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:BlindDataTemplate(file, name, parent, "subdHierBlind", shared, create){}
 	virtual ~SubdHierBlind(){}
 
@@ -30,7 +30,7 @@ public:
 		fprintf(mFile,"\tsetAttr \".woi\" %i;\n", woi);
 	}
 protected:
-	SubdHierBlind(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdHierBlind(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:BlindDataTemplate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	SubdLayoutUV():SubdModifierUV(){}
-	SubdLayoutUV(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdLayoutUV(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:SubdModifierUV(file, name, parent, "subdLayoutUV", shared, create){}
 	virtual ~SubdLayoutUV(){}
 
@@ -97,7 +97,7 @@ public:
 		fprintf(mFile,"\"%s.lm\"",mName.c_str());
 	}
 protected:
-	SubdLayoutUV(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdLayoutUV(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:SubdModifierUV(file, name, parent, nodeType, shared, create) {}
 
 };
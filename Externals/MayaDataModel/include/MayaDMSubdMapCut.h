@@ -19,12 +19,12 @@ class SubdMapCut : public SubdModifier
 public:
 
 	SubdMapCut():SubdModifier(){}
-	SubdMapCut(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdMapCut(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:SubdModifier(file, name, parent, "subdMapCut", shared, create){}
 	virtual ~SubdMapCut(){}
 
 protected:
-	SubdMapCut(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdMapCut(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:SubdModifier(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	SubdMapSewMove():SubdModifierUV(){}
-	SubdMapSewMove(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdMapSewMove(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:SubdModifierUV(file, name, parent, "subdMapSewMove", shared, create){}
 	virtual ~SubdMapSewMove(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.nf\"",mName.c_str());
 	}
 protected:
-	SubdMapSewMove(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdMapSewMove(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:SubdModifierUV(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	SubdModifier():SubdBase(){}
-	SubdModifier(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdModifier(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:SubdBase(file, name, parent, "subdModifier", shared, create){}
 	virtual ~SubdModifier(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.ics\"",mName.c_str());
 	}
 protected:
-	SubdModifier(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdModifier(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:SubdBase(file, name, parent, nodeType, shared, create) {}
 
 };
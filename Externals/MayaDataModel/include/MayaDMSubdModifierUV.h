@@ -19,12 +19,12 @@ class SubdModifierUV : public SubdModifierWorld
 public:
 
 	SubdModifierUV():SubdModifierWorld(){}
-	SubdModifierUV(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdModifierUV(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:SubdModifierWorld(file, name, parent, "subdModifierUV", shared, create){}
 	virtual ~SubdModifierUV(){}
 
 protected:
-	SubdModifierUV(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdModifierUV(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:SubdModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	SubdModifierWorld():SubdModifier(){}
-	SubdModifierWorld(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdModifierWorld(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:SubdModifier(file, name, parent, "subdModifierWorld", shared, create){}
 	virtual ~SubdModifierWorld(){}
 
@@ -54,7 +54,7 @@ public:
 		fprintf(mFile,"\"%s.mp\"",mName.c_str());
 	}
 protected:
-	SubdModifierWorld(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdModifierWorld(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:SubdModifier(file, name, parent, nodeType, shared, create) {}
 
 };
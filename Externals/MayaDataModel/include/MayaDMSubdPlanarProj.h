@@ -20,7 +20,7 @@ public:
 public:
 
 	SubdPlanarProj():SubdModifierWorld(){}
-	SubdPlanarProj(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdPlanarProj(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:SubdModifierWorld(file, name, parent, "subdPlanarProj", shared, create){}
 	virtual ~SubdPlanarProj(){}
 
@@ -210,7 +210,7 @@ public:
 		fprintf(mFile,"\"%s.cid\"",mName.c_str());
 	}
 protected:
-	SubdPlanarProj(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdPlanarProj(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:SubdModifierWorld(file, name, parent, nodeType, shared, create) {}
 
 };
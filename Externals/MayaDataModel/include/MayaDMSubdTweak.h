@@ -20,7 +20,7 @@ public:
 public:
 
 	SubdTweak():SubdModifier(){}
-	SubdTweak(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdTweak(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:SubdModifier(file, name, parent, "subdTweak", shared, create){}
 	virtual ~SubdTweak(){}
 
@@ -35,11 +35,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".tk[%i:%i]\" ", tk_start,tk_end);
 		size_t size = (tk_end-tk_start)*3+3;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",tk[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(tk,size);
 		fprintf(mFile,";\n");
 	}
 	void startTweak(size_t tk_start,size_t tk_end)const
@@ -110,7 +106,7 @@ public:
 		fprintf(mFile,"\"%s.map\"",mName.c_str());
 	}
 protected:
-	SubdTweak(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdTweak(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:SubdModifier(file, name, parent, nodeType, shared, create) {}
 
 };
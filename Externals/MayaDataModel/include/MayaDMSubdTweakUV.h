@@ -20,7 +20,7 @@ public:
 public:
 
 	SubdTweakUV():SubdModifier(){}
-	SubdTweakUV(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdTweakUV(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:SubdModifier(file, name, parent, "subdTweakUV", shared, create){}
 	virtual ~SubdTweakUV(){}
 
@@ -35,11 +35,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".uvtk[%i:%i]\" ", uvtk_start,uvtk_end);
 		size_t size = (uvtk_end-uvtk_start)*2+2;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",uvtk[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(uvtk,size);
 		fprintf(mFile,";\n");
 	}
 	void startUvTweak(size_t uvtk_start,size_t uvtk_end)const
@@ -92,7 +88,7 @@ public:
 		fprintf(mFile,"\"%s.uvtk.tv\"",mName.c_str());
 	}
 protected:
-	SubdTweakUV(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdTweakUV(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:SubdModifier(file, name, parent, nodeType, shared, create) {}
 
 };
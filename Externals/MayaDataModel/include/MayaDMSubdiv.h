@@ -18,13 +18,13 @@ class Subdiv : public SurfaceShape
 {
 public:
 	struct Vertex{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 	struct VertexTweak{
 		double3* singleVertexTweak;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(singleVertexTweak)/sizeof(double3);
 			for(size_t i=0; i<size; ++i)
@@ -56,7 +56,7 @@ public:
 		bool miTransparencyReceive;
 		bool miReflectionReceive;
 		bool miRefractionReceive;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", miOverrideCaustics);
 			fprintf(file,"%i ", miCausticAccuracy);
@@ -84,7 +84,7 @@ public:
 public:
 
 	Subdiv():SurfaceShape(){}
-	Subdiv(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Subdiv(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:SurfaceShape(file, name, parent, "subdiv", shared, create){}
 	virtual ~Subdiv(){}
 
@@ -169,11 +169,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".vtw[%i].stw[%i:%i]\" ", vtw_i,stw_start,stw_end);
 		size_t size = (stw_end-stw_start)*3+3;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",stw[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(stw,size);
 		fprintf(mFile,";\n");
 	}
 	void startSingleVertexTweak(size_t vtw_i,size_t stw_start,size_t stw_end)const
@@ -642,7 +638,7 @@ public:
 		fprintf(mFile,"\"%s.mrc.rfrr\"",mName.c_str());
 	}
 protected:
-	Subdiv(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Subdiv(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:SurfaceShape(file, name, parent, nodeType, shared, create) {}
 
 };
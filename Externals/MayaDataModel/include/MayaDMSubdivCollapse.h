@@ -20,7 +20,7 @@ public:
 public:
 
 	SubdivCollapse():DependNode(){}
-	SubdivCollapse(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdivCollapse(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "subdivCollapse", shared, create){}
 	virtual ~SubdivCollapse(){}
 
@@ -42,7 +42,7 @@ public:
 		fprintf(mFile,"\"%s.l\"",mName.c_str());
 	}
 protected:
-	SubdivCollapse(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdivCollapse(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	SubdivComponentId():DependNode(){}
-	SubdivComponentId(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdivComponentId(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "subdivComponentId", shared, create){}
 	virtual ~SubdivComponentId(){}
 
@@ -116,7 +116,7 @@ public:
 		fprintf(mFile,"\"%s.of\"",mName.c_str());
 	}
 protected:
-	SubdivComponentId(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdivComponentId(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
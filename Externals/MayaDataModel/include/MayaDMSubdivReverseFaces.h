@@ -20,7 +20,7 @@ public:
 public:
 
 	SubdivReverseFaces():DependNode(){}
-	SubdivReverseFaces(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdivReverseFaces(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "subdivReverseFaces", shared, create){}
 	virtual ~SubdivReverseFaces(){}
 
@@ -60,7 +60,7 @@ public:
 		fprintf(mFile,"\"%s.os\"",mName.c_str());
 	}
 protected:
-	SubdivReverseFaces(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdivReverseFaces(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
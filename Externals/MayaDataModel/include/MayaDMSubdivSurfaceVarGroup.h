@@ -20,7 +20,7 @@ public:
 public:
 
 	SubdivSurfaceVarGroup():BaseGeometryVarGroup(){}
-	SubdivSurfaceVarGroup(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdivSurfaceVarGroup(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:BaseGeometryVarGroup(file, name, parent, "subdivSurfaceVarGroup", shared, create){}
 	virtual ~SubdivSurfaceVarGroup(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.l\"",mName.c_str());
 	}
 protected:
-	SubdivSurfaceVarGroup(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdivSurfaceVarGroup(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:BaseGeometryVarGroup(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	SubdivToNurbs():AbstractBaseCreate(){}
-	SubdivToNurbs(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdivToNurbs(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "subdivToNurbs", shared, create){}
 	virtual ~SubdivToNurbs(){}
 
@@ -56,7 +56,7 @@ public:
 		fprintf(mFile,"\"%s.amr\"",mName.c_str());
 	}
 protected:
-	SubdivToNurbs(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdivToNurbs(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	SubdivToPoly():DependNode(){}
-	SubdivToPoly(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SubdivToPoly(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "subdivToPoly", shared, create){}
 	virtual ~SubdivToPoly(){}
 
@@ -89,11 +89,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".os[%i:%i]\" ", os_start,os_end);
 		size_t size = (os_end-os_start)*2+2;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",os[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(os,size);
 		fprintf(mFile,";\n");
 	}
 	void startOutSubdCVId(size_t os_start,size_t os_end)const
@@ -128,11 +124,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".is[%i:%i]\" ", is_start,is_end);
 		size_t size = (is_end-is_start)*2+2;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",is[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(is,size);
 		fprintf(mFile,";\n");
 	}
 	void startInSubdCVId(size_t is_start,size_t is_end)const
@@ -171,11 +163,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".ov[%i:%i]\" ", ov_start,ov_end);
 		size_t size = (ov_end-ov_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",ov[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(ov,size);
 		fprintf(mFile,";\n");
 	}
 	void startOutv(size_t ov_start,size_t ov_end)const
@@ -319,7 +307,7 @@ public:
 		fprintf(mFile,"\"%s.amr\"",mName.c_str());
 	}
 protected:
-	SubdivToPoly(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SubdivToPoly(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	SurfaceInfo():AbstractBaseCreate(){}
-	SurfaceInfo(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SurfaceInfo(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "surfaceInfo", shared, create){}
 	virtual ~SurfaceInfo(){}
 
@@ -92,7 +92,7 @@ public:
 		fprintf(mFile,"\"%s.kv\"",mName.c_str());
 	}
 protected:
-	SurfaceInfo(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SurfaceInfo(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
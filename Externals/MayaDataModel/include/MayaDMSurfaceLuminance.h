@@ -20,7 +20,7 @@ public:
 public:
 
 	SurfaceLuminance():DependNode(){}
-	SurfaceLuminance(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SurfaceLuminance(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "surfaceLuminance", shared, create){}
 	virtual ~SurfaceLuminance(){}
 
@@ -180,7 +180,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	SurfaceLuminance(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SurfaceLuminance(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	SurfaceSampler():DependNode(){}
-	SurfaceSampler(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SurfaceSampler(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "surfaceSampler", shared, create){}
 	virtual ~SurfaceSampler(){}
 
@@ -127,7 +127,7 @@ public:
 		fprintf(mFile,"\"%s.S10\"",mName.c_str());
 	}
 protected:
-	SurfaceSampler(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SurfaceSampler(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	SurfaceShader():DependNode(){}
-	SurfaceShader(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SurfaceShader(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "surfaceShader", shared, create){}
 	virtual ~SurfaceShader(){}
 
@@ -479,7 +479,7 @@ public:
 		fprintf(mFile,"\"%s.maga\"",mName.c_str());
 	}
 protected:
-	SurfaceShader(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SurfaceShader(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -21,7 +21,7 @@ public:
 		float collisionOffsetVelocityIncrement_Position;
 		float collisionOffsetVelocityIncrement_FloatValue;
 		unsigned int collisionOffsetVelocityIncrement_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", collisionOffsetVelocityIncrement_Position);
 			fprintf(file,"%f ", collisionOffsetVelocityIncrement_FloatValue);
@@ -32,7 +32,7 @@ public:
 		float collisionDepthVelocityIncrement_Position;
 		float collisionDepthVelocityIncrement_FloatValue;
 		unsigned int collisionDepthVelocityIncrement_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", collisionDepthVelocityIncrement_Position);
 			fprintf(file,"%f ", collisionDepthVelocityIncrement_FloatValue);
@@ -43,7 +43,7 @@ public:
 		float collisionOffsetVelocityMultiplier_Position;
 		float collisionOffsetVelocityMultiplier_FloatValue;
 		unsigned int collisionOffsetVelocityMultiplier_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", collisionOffsetVelocityMultiplier_Position);
 			fprintf(file,"%f ", collisionOffsetVelocityMultiplier_FloatValue);
@@ -54,7 +54,7 @@ public:
 		float collisionDepthVelocityMultiplier_Position;
 		float collisionDepthVelocityMultiplier_FloatValue;
 		unsigned int collisionDepthVelocityMultiplier_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", collisionDepthVelocityMultiplier_Position);
 			fprintf(file,"%f ", collisionDepthVelocityMultiplier_FloatValue);
@@ -64,7 +64,7 @@ public:
 public:
 
 	SurfaceShape():ControlPoint(){}
-	SurfaceShape(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SurfaceShape(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:ControlPoint(file, name, parent, "surfaceShape", shared, create){}
 	virtual ~SurfaceShape(){}
 
@@ -524,7 +524,7 @@ public:
 		fprintf(mFile,"\"%s.cdvm.cdvmi\"",mName.c_str());
 	}
 protected:
-	SurfaceShape(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SurfaceShape(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:ControlPoint(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	SurfaceVarGroup():BaseGeometryVarGroup(){}
-	SurfaceVarGroup(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	SurfaceVarGroup(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:BaseGeometryVarGroup(file, name, parent, "surfaceVarGroup", shared, create){}
 	virtual ~SurfaceVarGroup(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.l\"",mName.c_str());
 	}
 protected:
-	SurfaceVarGroup(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	SurfaceVarGroup(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:BaseGeometryVarGroup(file, name, parent, nodeType, shared, create) {}
 
 };
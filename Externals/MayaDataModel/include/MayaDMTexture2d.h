@@ -20,7 +20,7 @@ public:
 public:
 
 	Texture2d():DependNode(){}
-	Texture2d(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Texture2d(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "texture2d", shared, create){}
 	virtual ~Texture2d(){}
 
@@ -237,7 +237,7 @@ public:
 		fprintf(mFile,"\"%s.oa\"",mName.c_str());
 	}
 protected:
-	Texture2d(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Texture2d(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Texture3d():DependNode(){}
-	Texture3d(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Texture3d(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "texture3d", shared, create){}
 	virtual ~Texture3d(){}
 
@@ -292,7 +292,7 @@ public:
 		fprintf(mFile,"\"%s.oa\"",mName.c_str());
 	}
 protected:
-	Texture3d(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Texture3d(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	TextureBakeSet():BakeSet(){}
-	TextureBakeSet(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	TextureBakeSet(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:BakeSet(file, name, parent, "textureBakeSet", shared, create){}
 	virtual ~TextureBakeSet(){}
 
@@ -235,7 +235,7 @@ public:
 		fprintf(mFile,"\"%s.nsp\"",mName.c_str());
 	}
 protected:
-	TextureBakeSet(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	TextureBakeSet(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:BakeSet(file, name, parent, nodeType, shared, create) {}
 
 };
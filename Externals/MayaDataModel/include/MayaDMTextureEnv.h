@@ -20,7 +20,7 @@ public:
 public:
 
 	TextureEnv():DependNode(){}
-	TextureEnv(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	TextureEnv(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "textureEnv", shared, create){}
 	virtual ~TextureEnv(){}
 
@@ -143,7 +143,7 @@ public:
 		fprintf(mFile,"\"%s.oa\"",mName.c_str());
 	}
 protected:
-	TextureEnv(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	TextureEnv(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -18,14 +18,14 @@ class TextureToGeom : public DependNode
 {
 public:
 	struct OutColorData{
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 		}
 	};
 public:
 
 	TextureToGeom():DependNode(){}
-	TextureToGeom(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	TextureToGeom(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "textureToGeom", shared, create){}
 	virtual ~TextureToGeom(){}
 
@@ -38,11 +38,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".sgi[%i:%i]\" ", sgi_start,sgi_end);
 		size_t size = (sgi_end-sgi_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%i",sgi[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeIntArray(sgi,size);
 		fprintf(mFile,";\n");
 	}
 	void startSegGroupIds(size_t sgi_start,size_t sgi_end)const
@@ -334,7 +330,7 @@ public:
 		fprintf(mFile,"\"%s.shs\"",mName.c_str());
 	}
 protected:
-	TextureToGeom(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	TextureToGeom(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
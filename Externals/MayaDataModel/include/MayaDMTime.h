@@ -20,7 +20,7 @@ public:
 public:
 
 	Time():DependNode(){}
-	Time(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Time(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "time", shared, create){}
 	virtual ~Time(){}
 
@@ -34,7 +34,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	Time(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Time(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	TimeFunction():DependNode(){}
-	TimeFunction(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	TimeFunction(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "timeFunction", shared, create){}
 	virtual ~TimeFunction(){}
 
@@ -38,7 +38,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	TimeFunction(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	TimeFunction(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
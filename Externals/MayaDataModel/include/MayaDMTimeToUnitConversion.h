@@ -20,7 +20,7 @@ public:
 public:
 
 	TimeToUnitConversion():DependNode(){}
-	TimeToUnitConversion(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	TimeToUnitConversion(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "timeToUnitConversion", shared, create){}
 	virtual ~TimeToUnitConversion(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	TimeToUnitConversion(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	TimeToUnitConversion(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
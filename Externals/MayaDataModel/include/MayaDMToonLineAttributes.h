@@ -20,7 +20,7 @@ public:
 public:
 
 	ToonLineAttributes():DependNode(){}
-	ToonLineAttributes(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	ToonLineAttributes(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "toonLineAttributes", shared, create){}
 	virtual ~ToonLineAttributes(){}
 
@@ -52,7 +52,7 @@ public:
 		fprintf(mFile,"\"%s.vu\"",mName.c_str());
 	}
 protected:
-	ToonLineAttributes(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	ToonLineAttributes(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	TransferAttributes():WeightGeometryFilter(){}
-	TransferAttributes(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	TransferAttributes(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:WeightGeometryFilter(file, name, parent, "transferAttributes", shared, create){}
 	virtual ~TransferAttributes(){}
 
@@ -228,7 +228,7 @@ public:
 		fprintf(mFile,"\"%s.clb\"",mName.c_str());
 	}
 protected:
-	TransferAttributes(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	TransferAttributes(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:WeightGeometryFilter(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -21,7 +21,7 @@ public:
 		bool minTransXLimitEnable;
 		bool minTransYLimitEnable;
 		bool minTransZLimitEnable;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", minTransXLimitEnable);
 			fprintf(file,"%i ", minTransYLimitEnable);
@@ -32,7 +32,7 @@ public:
 		bool maxTransXLimitEnable;
 		bool maxTransYLimitEnable;
 		bool maxTransZLimitEnable;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", maxTransXLimitEnable);
 			fprintf(file,"%i ", maxTransYLimitEnable);
@@ -43,7 +43,7 @@ public:
 		bool minRotXLimitEnable;
 		bool minRotYLimitEnable;
 		bool minRotZLimitEnable;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", minRotXLimitEnable);
 			fprintf(file,"%i ", minRotYLimitEnable);
@@ -54,7 +54,7 @@ public:
 		bool maxRotXLimitEnable;
 		bool maxRotYLimitEnable;
 		bool maxRotZLimitEnable;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", maxRotXLimitEnable);
 			fprintf(file,"%i ", maxRotYLimitEnable);
@@ -65,7 +65,7 @@ public:
 		bool minScaleXLimitEnable;
 		bool minScaleYLimitEnable;
 		bool minScaleZLimitEnable;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", minScaleXLimitEnable);
 			fprintf(file,"%i ", minScaleYLimitEnable);
@@ -76,7 +76,7 @@ public:
 		bool maxScaleXLimitEnable;
 		bool maxScaleYLimitEnable;
 		bool maxScaleZLimitEnable;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", maxScaleXLimitEnable);
 			fprintf(file,"%i ", maxScaleYLimitEnable);
@@ -92,7 +92,7 @@ public:
 		unsigned int miCaustic;
 		unsigned int miGlobillum;
 		bool miExportGeoShader;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i ", miDeriveFromMaya);
 			fprintf(file,"%i ", miHide);
@@ -107,7 +107,7 @@ public:
 public:
 
 	Transform():DagNode(){}
-	Transform(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Transform(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DagNode(file, name, parent, "transform", shared, create){}
 	virtual ~Transform(){}
 
@@ -965,7 +965,7 @@ public:
 		fprintf(mFile,"\"%s.mrc.migs\"",mName.c_str());
 	}
 protected:
-	Transform(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Transform(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DagNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	TransformGeometry():AbstractBaseCreate(){}
-	TransformGeometry(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	TransformGeometry(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "transformGeometry", shared, create){}
 	virtual ~TransformGeometry(){}
 
@@ -62,7 +62,7 @@ public:
 		fprintf(mFile,"\"%s.og\"",mName.c_str());
 	}
 protected:
-	TransformGeometry(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	TransformGeometry(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Trim():AbstractBaseCreate(){}
-	Trim(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Trim(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "trim", shared, create){}
 	virtual ~Trim(){}
 
@@ -33,11 +33,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".lu[%i:%i]\" ", lu_start,lu_end);
 		size_t size = (lu_end-lu_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",lu[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(lu,size);
 		fprintf(mFile,";\n");
 	}
 	void startLocatorU(size_t lu_start,size_t lu_end)const
@@ -61,11 +57,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".lv[%i:%i]\" ", lv_start,lv_end);
 		size_t size = (lv_end-lv_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",lv[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(lv,size);
 		fprintf(mFile,";\n");
 	}
 	void startLocatorV(size_t lv_start,size_t lv_end)const
@@ -160,7 +152,7 @@ public:
 		fprintf(mFile,"\"%s.sbl\"",mName.c_str());
 	}
 protected:
-	Trim(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Trim(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	TrimWithBoundaries():AbstractBaseCreate(){}
-	TrimWithBoundaries(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	TrimWithBoundaries(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "trimWithBoundaries", shared, create){}
 	virtual ~TrimWithBoundaries(){}
 
@@ -69,7 +69,7 @@ public:
 		fprintf(mFile,"\"%s.os\"",mName.c_str());
 	}
 protected:
-	TrimWithBoundaries(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	TrimWithBoundaries(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -19,7 +19,7 @@ class TripleShadingSwitch : public BaseShadingSwitch
 public:
 	struct Input{
 		float3 inTriple;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			inTriple.write(file);
 			fprintf(file, " ");
@@ -28,7 +28,7 @@ public:
 public:
 
 	TripleShadingSwitch():BaseShadingSwitch(){}
-	TripleShadingSwitch(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	TripleShadingSwitch(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:BaseShadingSwitch(file, name, parent, "tripleShadingSwitch", shared, create){}
 	virtual ~TripleShadingSwitch(){}
 
@@ -193,7 +193,7 @@ public:
 		fprintf(mFile,"\"%s.out.oc3\"",mName.c_str());
 	}
 protected:
-	TripleShadingSwitch(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	TripleShadingSwitch(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:BaseShadingSwitch(file, name, parent, nodeType, shared, create) {}
 
 };
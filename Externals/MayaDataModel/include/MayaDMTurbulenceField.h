@@ -20,7 +20,7 @@ public:
 public:
 
 	TurbulenceField():Field(){}
-	TurbulenceField(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	TurbulenceField(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Field(file, name, parent, "turbulenceField", shared, create){}
 	virtual ~TurbulenceField(){}
 
@@ -88,7 +88,7 @@ public:
 		fprintf(mFile,"\"%s.intr\"",mName.c_str());
 	}
 protected:
-	TurbulenceField(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	TurbulenceField(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Field(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -19,7 +19,7 @@ class Tweak : public GeometryFilter
 public:
 	struct Plist{
 		double3* controlPoints;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(controlPoints)/sizeof(double3);
 			for(size_t i=0; i<size; ++i)
@@ -31,7 +31,7 @@ public:
 	};
 	struct Vlist{
 		float3* vertex;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(vertex)/sizeof(float3);
 			for(size_t i=0; i<size; ++i)
@@ -44,7 +44,7 @@ public:
 public:
 
 	Tweak():GeometryFilter(){}
-	Tweak(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Tweak(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, "tweak", shared, create){}
 	virtual ~Tweak(){}
 
@@ -94,11 +94,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".pl[%i].cp[%i:%i]\" ", pl_i,cp_start,cp_end);
 		size_t size = (cp_end-cp_start)*3+3;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",cp[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(cp,size);
 		fprintf(mFile,";\n");
 	}
 	void startControlPoints(size_t pl_i,size_t cp_start,size_t cp_end)const
@@ -169,11 +165,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".vl[%i].vt[%i:%i]\" ", vl_i,vt_start,vt_end);
 		size_t size = (vt_end-vt_start)*3+3;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",vt[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(vt,size);
 		fprintf(mFile,";\n");
 	}
 	void startVertex(size_t vl_i,size_t vt_start,size_t vt_end)const
@@ -298,7 +290,7 @@ public:
 		fprintf(mFile,"\"%s.vl.vt[%i].vz\"",mName.c_str(),vt_i);
 	}
 protected:
-	Tweak(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Tweak(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -14,6 +14,8 @@
 #include <string>
 #include <vector>
 
+#include "MayaDMWriter.h"
+
 // from ogre OgrePlatform.h
 // Win32 compilers use _DEBUG for specifying debug builds.
 // Unlike the Win32 compilers, Linux compilers seem to use DEBUG for when
@@ -57,7 +59,7 @@ struct short2
 		MAYADM_ASSERT( i < 2 );
 		return values[i];
 	}
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file, "%i %i", values[0], values[1]);
 	}
@@ -91,7 +93,7 @@ struct short3
 		MAYADM_ASSERT( i < 3 );
 		return values[i];
 	}
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file, "%i %i %i", values[0], values[1], values[2]);
 	}
@@ -132,7 +134,7 @@ struct long2
 		MAYADM_ASSERT( i < 2 );
 		return values[i];
 	}
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file, "%i %i", values[0], values[1]);
 	}
@@ -172,7 +174,7 @@ struct long3
 		MAYADM_ASSERT( i < 3 );
 		return values[i];
 	}
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file, "%i %i %i", values[0], values[1], values[2]);
 	}
@@ -210,13 +212,9 @@ struct int32Array
 		MAYADM_ASSERT( i < size );
 		return values[i];
 	}
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
-		for(size_t i=0; i<size; ++i)
-		{
-			fprintf(file, "%i", values[i]);
-			if(i+1<size) fprintf(file, " ");
-		}		
+		file->writeIntArray(values, size);
 	}
 };
 
@@ -246,7 +244,7 @@ struct float2
 		MAYADM_ASSERT( i < 2 );
 		return values[i];
 	}
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file, "%f %f", values[0], values[1]);
 	}
@@ -286,7 +284,7 @@ struct float3
 		MAYADM_ASSERT( i < 3 );
 		return values[i];
 	}
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file, "%f %f %f", values[0], values[1], values[2]);
 	}
@@ -327,7 +325,7 @@ struct double2
 		MAYADM_ASSERT( i < 2 );
 		return values[i];
 	}
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file, "%f %f", values[0], values[1]);
 	}
@@ -367,7 +365,7 @@ struct double3
 		MAYADM_ASSERT( i < 3 );
 		return values[i];
 	}
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file,"%f %f %f", values[0], values[1], values[2]);
 	}
@@ -413,7 +411,7 @@ struct double4
 		MAYADM_ASSERT( i < 4 );
 		return values[i];
 	}
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file,"%f %f %f %f", values[0], values[1], values[2], values[3]);
 	}
@@ -456,13 +454,9 @@ struct doubleArray
 		MAYADM_ASSERT( i < size );
 		return values[i];
 	}
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
-		for(size_t i=0; i<size; ++i)
-		{
-			fprintf(file,"%f", values[i]);
-			if(i+1<size) fprintf(file," ");
-		}		
+		file->writeFloatArray(values, size);
 	}
 };
 
@@ -571,7 +565,7 @@ struct matrix
 		return ( double* ) m[ iRow ];
 	}
 
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file,"%f %f %f %f ", m[0][0], m[0][1], m[0][2], m[0][3]);
 		fprintf(file,"%f %f %f %f ", m[1][0], m[1][1], m[1][2], m[1][3]);
@@ -610,7 +604,7 @@ struct point
 	double y;
 	double z;
 	double w;
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file,"%f %f %f %f", x, y, z, w);
 	}
@@ -631,7 +625,7 @@ struct pointArray
 		MAYADM_ASSERT( i < size );
 		return values[i];
 	}
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		for(size_t i=0; i<size; ++i)
 		{
@@ -652,7 +646,7 @@ struct vector
 	double x;
 	double y;
 	double z;
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file,"%f %f %f %f", x, y, z);
 	}
@@ -673,7 +667,7 @@ struct vectorArray
 		MAYADM_ASSERT( i < size );
 		return values[i];
 	}
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		for(size_t i=0; i<size; ++i)
 		{
@@ -710,7 +704,7 @@ struct string
 	{
 		return str.c_str();
 	}
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file, "\"%s\"", str.c_str());
 	}
@@ -743,7 +737,7 @@ struct stringArray
 		MAYADM_ASSERT( i < size );
 		return values[i];
 	}
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		for(size_t i=0; i<size; ++i)
 		{
@@ -762,7 +756,7 @@ Example 		setAttr node.sphereAttr -type sphere 5.0;
 struct sphere
 {
 	double radius;
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file,"%f", radius);
 	}
@@ -778,7 +772,7 @@ struct cone
 {
 	double coneAngle;
 	double coneCap;
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file, "%f %f", coneAngle, coneCap);
 	}
@@ -795,7 +789,7 @@ struct reflectanceRGB
 	double redReflect;
 	double greenReflect;
 	double blueReflect;
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file, "%f %f %f", redReflect, greenReflect, blueReflect);
 	}
@@ -812,7 +806,7 @@ struct spectrumRGB
 	double redSpectrum;
 	double greenSpectrum;
 	double blueSpectrum;
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file, "%f %f %f", redSpectrum, greenSpectrum, blueSpectrum);
 	}
@@ -830,7 +824,7 @@ public:
 	componentList(){}
 	componentList(size_t s):std::vector<string>(s){}
 	~componentList(){}
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file,"%i ", size());
 		for(size_t i=0; i<size(); ++i)
@@ -898,7 +892,7 @@ struct nurbsCurve
 		delete [] cvValues;
 	}
 
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file,"%i %i %i %i %i %i ", degree, spans, form, isRational, dimension, knotCount);
 		for(int i=0; i<knotCount; ++i)
@@ -910,11 +904,7 @@ struct nurbsCurve
 		if(dimension == 3) numElements++;
 		if(isRational) 	numElements++;
 		size_t size = cvCount * numElements;
-		for(size_t i=0; i<size; ++i)
-		{
-			fprintf(file, "%f", cvValues[i]);
-			if(i+1<size) fprintf(file," ");
-		}
+		file->writeFloatArray(cvValues, size);
 	}
 };
 
@@ -985,7 +975,7 @@ struct nurbsSurface
 		delete [] cvValues;
 	}
 
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file,"%i %i %i %i %i %i ", uDegree, vDegree, uForm, vForm, isRational, uKnotCount);
 		for(int i=0; i<uKnotCount; ++i)
@@ -1007,11 +997,7 @@ struct nurbsSurface
 		size_t numElements = 3;		
 		if(isRational) 	numElements++;
 		size_t size = cvCount * numElements;
-		for(size_t i=0; i<size; ++i)
-		{
-			fprintf(file, "%f", cvValues[i]);
-			if(i+1<size) fprintf(file," ");
-		}
+		file->writeFloatArray(cvValues, size);
 	}
 };
 /**
@@ -1046,7 +1032,7 @@ struct nurbsTrimface
 				/** geometricContinuity : if true, the edge is tangent continuous*/
 				int geometricContinuity;
 				
-				void write(FILE* file) const
+				void write(Writer* file) const
 				{
 					fprintf(file, "%i %i %i", edgeTolerance, isEdgeReversed, geometricContinuity);
 				}
@@ -1060,7 +1046,7 @@ struct nurbsTrimface
 				/** pedgeTolerance : tolerance for the 2d edge*/
 				int	pedgeTolerance;
 			
-				void write(FILE* file) const
+				void write(Writer* file) const
 				{
 					fprintf(file, "%i %i", isMonotone, pedgeTolerance);
 				}
@@ -1077,7 +1063,7 @@ struct nurbsTrimface
 				delete [] splinesOnPedge;
 			}
 
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				fprintf(file,"%i ", splineCountOnEdge);
 				for(int i=0; i<splineCountOnEdge; ++i)
@@ -1103,7 +1089,7 @@ struct nurbsTrimface
 			delete [] edges;
 		}
 
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%i %i ", boundaryType, tedgeCountOnBoundary);
 			for(int i=0; i<tedgeCountOnBoundary; ++i)
@@ -1123,7 +1109,7 @@ struct nurbsTrimface
 		delete [] boundaries;
 	}
 
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file,"%i %i ", flipNormal, boundaryCount);
 		for(int i=0; i<boundaryCount; ++i)
@@ -1188,14 +1174,10 @@ struct polyFaces
 			delete [] edgeIdValue;
 		}
 
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"\t\tf %i ", faceEdgeCount);
-			for(int i=0; i<faceEdgeCount; ++i)
-			{
-				fprintf(file,"%i", edgeIdValue[i]);
-				if(i+1<faceEdgeCount) fprintf(file, " ");
-			}
+			file->writeIntArray(edgeIdValue, faceEdgeCount);
 		}
 	}f;
 
@@ -1220,14 +1202,10 @@ struct polyFaces
 			delete [] edgeIdValue;
 		}
 
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"\t\th %i ", holeEdgeCount);
-			for(int i=0; i<holeEdgeCount; ++i)
-			{
-				fprintf(file,"%i", edgeIdValue[i]);
-				if(i+1<holeEdgeCount) fprintf(file, " ");
-			}
+			file->writeIntArray(edgeIdValue, holeEdgeCount);
 		}
 	}h;
 
@@ -1252,14 +1230,10 @@ struct polyFaces
 			delete [] uvIdValue;
 		}
 
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"\t\tmf %i ", faceUVCount);
-			for(int i=0; i<faceUVCount; ++i)
-			{
-				fprintf(file,"%i", uvIdValue[i]);
-				if(i+1<faceUVCount) fprintf(file, " ");
-			}
+			file->writeIntArray(uvIdValue, faceUVCount);
 		}
 	}mf;
 
@@ -1284,14 +1258,10 @@ struct polyFaces
 			holeUVCount=0;
 			delete [] uvIdValue;
 		}
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"\t\tmh %i ", holeUVCount);
-			for(int i=0; i<holeUVCount; ++i)
-			{
-				fprintf(file,"%i", uvIdValue[i]);
-				if(i+1<holeUVCount) fprintf(file, " ");
-			}
+			file->writeIntArray(uvIdValue, holeUVCount);
 		}
 	}mh;
 
@@ -1324,15 +1294,11 @@ struct polyFaces
 			delete [] uvIdValue;
 		}
 
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"\t\tmu %i ", uvSet);
 			fprintf(file,"%i ", faceUVCount);
-			for(int i=0; i<faceUVCount; ++i)
-			{
-				fprintf(file,"%i", uvIdValue[i]);
-				if(i+1<faceUVCount) fprintf(file, " ");
-			}
+			file->writeIntArray(uvIdValue, faceUVCount);
 		}
 	};
 
@@ -1367,15 +1333,11 @@ struct polyFaces
             delete [] colorIdValue;
         }
 
-        void write(FILE* file) const
+        void write(Writer* file) const
         {
             fprintf(file,"\t\tmc %i ", colorSet);
             fprintf(file,"%i ", faceColorCount);
-            for(int i=0; i<faceColorCount; ++i)
-            {
-                fprintf(file,"%i", colorIdValue[i]);
-                if(i+1<faceColorCount) fprintf(file, " ");
-            }
+            file->writeIntArray(colorIdValue, faceColorCount);
         }
     };
 
@@ -1402,14 +1364,10 @@ struct polyFaces
 			delete [] colorIndexValue;
 		}
 		
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"\t\tfc %i ", faceColorCount);
-			for(int i=0; i<faceColorCount; ++i)
-			{
-				fprintf(file,"%i", colorIndexValue[i]);
-				if(i+1<faceColorCount) fprintf(file, " ");
-			}
+			file->writeIntArray(colorIndexValue, faceColorCount);
 		}
 	}fc;
 
@@ -1429,7 +1387,7 @@ struct polyFaces
         delete[] mc;
     }
 
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		if(f.faceEdgeCount)
 		{
@@ -1523,15 +1481,11 @@ struct mesh
 			delete [] vertices;
 		}
 
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"\"v\" %i ", vertexCount);
 			size_t size = vertexCount * 3;
-			for(size_t i=0; i<size; ++i)
-			{
-				fprintf(file,"%f", vertices[i]);
-				if(i+1<size) fprintf(file," ");
-			}
+			file->writeFloatArray(vertices, size);
 		}
 	}v;
 
@@ -1553,15 +1507,11 @@ struct mesh
 			delete [] normals;
 		}
 
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"\"vn\" %i ", normalCount);
 			size_t size = normalCount * 3;
-			for(size_t i=0; i<size; ++i)
-			{
-				fprintf(file,"%f", normals[i]);
-				if(i+1<size) fprintf(file," ");
-			}
+			file->writeFloatArray(normals, size);
 		}
 	}vn;
 
@@ -1583,15 +1533,11 @@ struct mesh
 			delete [] uvValues;
 		}
 
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"\"vt\" %i ", uvCount);
 			size_t size = uvCount * 2;
-			for(size_t i=0; i<size; ++i)
-			{
-				fprintf(file,"%f", uvValues[i]);
-				if(i+1<size) fprintf(file," ");
-			}
+			file->writeFloatArray(uvValues, size);
 		}
 	}vt;
 
@@ -1609,7 +1555,7 @@ struct mesh
 			double endVertex;
 			edgeType type; 
 
-			void write(FILE* file) const
+			void write(Writer* file) const
 			{
 				fprintf(file, "%f %f ", startVertex, endVertex);
 				if(type == HARD)
@@ -1634,7 +1580,7 @@ struct mesh
 			delete [] edges;
 		}
 
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"\"e\" %i ", edgeCount);
 			for(int i=0; i<edgeCount; ++i)
@@ -1645,7 +1591,7 @@ struct mesh
 		}
 	}e;
 
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		if(v.vertexCount)
 		{
@@ -1721,15 +1667,11 @@ struct lattice
 		delete [] points;
 	}
 	
-	void write(FILE* file) const
+	void write(Writer* file) const
 	{
 		fprintf(file,"%i %i %i %i ", sDivisionCount, tDivisionCount, uDivisionCount, pointCount);
 		size_t size = pointCount*3;
-		for(size_t i; i<size; ++i)
-		{
-			fprintf(file, "%f", points[i]);
-			if(i+1<size) fprintf(file, " ");
-		}
+		file->writeFloatArray(points, size);
 	}
 };
 
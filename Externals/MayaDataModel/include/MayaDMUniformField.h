@@ -21,7 +21,7 @@ public:
 		double directionX;
 		double directionY;
 		double directionZ;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", directionX);
 			fprintf(file,"%f ", directionY);
@@ -31,7 +31,7 @@ public:
 public:
 
 	UniformField():Field(){}
-	UniformField(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	UniformField(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Field(file, name, parent, "uniformField", shared, create){}
 	virtual ~UniformField(){}
 
@@ -77,7 +77,7 @@ public:
 		fprintf(mFile,"\"%s.inh\"",mName.c_str());
 	}
 protected:
-	UniformField(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	UniformField(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Field(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	UnitConversion():DependNode(){}
-	UnitConversion(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	UnitConversion(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "unitConversion", shared, create){}
 	virtual ~UnitConversion(){}
 
@@ -38,7 +38,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	UnitConversion(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	UnitConversion(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	UnitToTimeConversion():DependNode(){}
-	UnitToTimeConversion(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	UnitToTimeConversion(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "unitToTimeConversion", shared, create){}
 	virtual ~UnitToTimeConversion(){}
 
@@ -43,7 +43,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	UnitToTimeConversion(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	UnitToTimeConversion(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
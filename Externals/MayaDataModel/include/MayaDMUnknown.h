@@ -19,12 +19,12 @@ class Unknown : public DependNode
 public:
 
 	Unknown():DependNode(){}
-	Unknown(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Unknown(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "unknown", shared, create){}
 	virtual ~Unknown(){}
 
 protected:
-	Unknown(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Unknown(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
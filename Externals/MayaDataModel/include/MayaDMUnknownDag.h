@@ -19,12 +19,12 @@ class UnknownDag : public DagNode
 public:
 
 	UnknownDag():DagNode(){}
-	UnknownDag(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	UnknownDag(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DagNode(file, name, parent, "unknownDag", shared, create){}
 	virtual ~UnknownDag(){}
 
 protected:
-	UnknownDag(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	UnknownDag(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DagNode(file, name, parent, nodeType, shared, create) {}
 
 };
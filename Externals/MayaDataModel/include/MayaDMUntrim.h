@@ -20,7 +20,7 @@ public:
 public:
 
 	Untrim():AbstractBaseCreate(){}
-	Untrim(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Untrim(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, "untrim", shared, create){}
 	virtual ~Untrim(){}
 
@@ -42,7 +42,7 @@ public:
 		fprintf(mFile,"\"%s.oc\"",mName.c_str());
 	}
 protected:
-	Untrim(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Untrim(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:AbstractBaseCreate(file, name, parent, nodeType, shared, create) {}
 
 };
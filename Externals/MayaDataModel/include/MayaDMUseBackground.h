@@ -20,7 +20,7 @@ public:
 public:
 
 	UseBackground():DependNode(){}
-	UseBackground(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	UseBackground(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "useBackground", shared, create){}
 	virtual ~UseBackground(){}
 
@@ -682,7 +682,7 @@ public:
 		fprintf(mFile,"\"%s.mio\"",mName.c_str());
 	}
 protected:
-	UseBackground(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	UseBackground(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
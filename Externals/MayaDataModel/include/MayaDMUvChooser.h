@@ -20,7 +20,7 @@ public:
 public:
 
 	UvChooser():DependNode(){}
-	UvChooser(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	UvChooser(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "uvChooser", shared, create){}
 	virtual ~UvChooser(){}
 
@@ -336,7 +336,7 @@ public:
 		fprintf(mFile,"\"%s.oc1.o1z\"",mName.c_str());
 	}
 protected:
-	UvChooser(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	UvChooser(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
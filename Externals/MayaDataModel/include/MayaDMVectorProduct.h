@@ -20,7 +20,7 @@ public:
 public:
 
 	VectorProduct():DependNode(){}
-	VectorProduct(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	VectorProduct(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "vectorProduct", shared, create){}
 	virtual ~VectorProduct(){}
 
@@ -139,7 +139,7 @@ public:
 		fprintf(mFile,"\"%s.o.oz\"",mName.c_str());
 	}
 protected:
-	VectorProduct(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	VectorProduct(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	VectorRenderGlobals():DependNode(){}
-	VectorRenderGlobals(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	VectorRenderGlobals(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "vectorRenderGlobals", shared, create){}
 	virtual ~VectorRenderGlobals(){}
 
@@ -194,7 +194,7 @@ public:
 		fprintf(mFile,"\"%s.ff\"",mName.c_str());
 	}
 protected:
-	VectorRenderGlobals(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	VectorRenderGlobals(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	VertexBakeSet():BakeSet(){}
-	VertexBakeSet(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	VertexBakeSet(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:BakeSet(file, name, parent, "vertexBakeSet", shared, create){}
 	virtual ~VertexBakeSet(){}
 
@@ -187,7 +187,7 @@ public:
 		fprintf(mFile,"\"%s.csn\"",mName.c_str());
 	}
 protected:
-	VertexBakeSet(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	VertexBakeSet(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:BakeSet(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	VolumeAxisField():Field(){}
-	VolumeAxisField(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	VolumeAxisField(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Field(file, name, parent, "volumeAxisField", shared, create){}
 	virtual ~VolumeAxisField(){}
 
@@ -235,7 +235,7 @@ public:
 		fprintf(mFile,"\"%s.tim\"",mName.c_str());
 	}
 protected:
-	VolumeAxisField(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	VolumeAxisField(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Field(file, name, parent, nodeType, shared, create) {}
 
 };
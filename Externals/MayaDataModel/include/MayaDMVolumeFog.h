@@ -21,7 +21,7 @@ public:
 		float colorRamp_Position;
 		float3 colorRamp_Color;
 		unsigned int colorRamp_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", colorRamp_Position);
 			colorRamp_Color.write(file);
@@ -32,7 +32,7 @@ public:
 public:
 
 	VolumeFog():DependNode(){}
-	VolumeFog(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	VolumeFog(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "volumeFog", shared, create){}
 	virtual ~VolumeFog(){}
 
@@ -673,7 +673,7 @@ public:
 		fprintf(mFile,"\"%s.omo.omob\"",mName.c_str());
 	}
 protected:
-	VolumeFog(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	VolumeFog(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -21,7 +21,7 @@ public:
 		float colorRange_Position;
 		float3 colorRange_Color;
 		unsigned int colorRange_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", colorRange_Position);
 			colorRange_Color.write(file);
@@ -33,7 +33,7 @@ public:
 		float penumbra_Position;
 		float penumbra_FloatValue;
 		unsigned int penumbra_Interp;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", penumbra_Position);
 			fprintf(file,"%f ", penumbra_FloatValue);
@@ -43,7 +43,7 @@ public:
 public:
 
 	VolumeLight():PointLight(){}
-	VolumeLight(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	VolumeLight(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:PointLight(file, name, parent, "volumeLight", shared, create){}
 	virtual ~VolumeLight(){}
 
@@ -300,7 +300,7 @@ public:
 		fprintf(mFile,"\"%s.ema\"",mName.c_str());
 	}
 protected:
-	VolumeLight(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	VolumeLight(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:PointLight(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	VolumeNoise():Texture3d(){}
-	VolumeNoise(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	VolumeNoise(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, "volumeNoise", shared, create){}
 	virtual ~VolumeNoise(){}
 
@@ -324,7 +324,7 @@ public:
 		fprintf(mFile,"\"%s.imc.imz\"",mName.c_str());
 	}
 protected:
-	VolumeNoise(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	VolumeNoise(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	VolumeShader():DependNode(){}
-	VolumeShader(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	VolumeShader(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "volumeShader", shared, create){}
 	virtual ~VolumeShader(){}
 
@@ -139,7 +139,7 @@ public:
 		fprintf(mFile,"\"%s.omo.omob\"",mName.c_str());
 	}
 protected:
-	VolumeShader(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	VolumeShader(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
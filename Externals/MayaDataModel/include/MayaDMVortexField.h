@@ -21,7 +21,7 @@ public:
 		double axisX;
 		double axisY;
 		double axisZ;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			fprintf(file,"%f ", axisX);
 			fprintf(file,"%f ", axisY);
@@ -31,7 +31,7 @@ public:
 public:
 
 	VortexField():Field(){}
-	VortexField(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	VortexField(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Field(file, name, parent, "vortexField", shared, create){}
 	virtual ~VortexField(){}
 
@@ -73,7 +73,7 @@ public:
 		fprintf(mFile,"\"%s.ax.axz\"",mName.c_str());
 	}
 protected:
-	VortexField(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	VortexField(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Field(file, name, parent, nodeType, shared, create) {}
 
 };
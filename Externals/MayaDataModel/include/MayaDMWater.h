@@ -20,7 +20,7 @@ public:
 public:
 
 	Water():Texture2d(){}
-	Water(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Water(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, "water", shared, create){}
 	virtual ~Water(){}
 
@@ -294,7 +294,7 @@ public:
 		fprintf(mFile,"\"%s.fa\"",mName.c_str());
 	}
 protected:
-	Water(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Water(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture2d(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -19,7 +19,7 @@ class WeightGeometryFilter : public GeometryFilter
 public:
 	struct WeightList{
 		float* weights;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			size_t size = sizeof(weights)/sizeof(float);
 			for(size_t i=0; i<size; ++i)
@@ -32,7 +32,7 @@ public:
 public:
 
 	WeightGeometryFilter():GeometryFilter(){}
-	WeightGeometryFilter(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	WeightGeometryFilter(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, "weightGeometryFilter", shared, create){}
 	virtual ~WeightGeometryFilter(){}
 
@@ -76,11 +76,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".wl[%i].w[%i:%i]\" ", wl_i,w_start,w_end);
 		size_t size = (w_end-w_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",w[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(w,size);
 		fprintf(mFile,";\n");
 	}
 	void startWeights(size_t wl_i,size_t w_start,size_t w_end)const
@@ -114,7 +110,7 @@ public:
 		fprintf(mFile,"\"%s.wl.w[%i]\"",mName.c_str(),w_i);
 	}
 protected:
-	WeightGeometryFilter(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	WeightGeometryFilter(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, nodeType, shared, create) {}
 
 };
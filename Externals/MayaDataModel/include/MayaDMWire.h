@@ -20,7 +20,7 @@ public:
 public:
 
 	Wire():WeightGeometryFilter(){}
-	Wire(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Wire(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:WeightGeometryFilter(file, name, parent, "wire", shared, create){}
 	virtual ~Wire(){}
 
@@ -58,11 +58,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".dds[%i:%i]\" ", dds_start,dds_end);
 		size_t size = (dds_end-dds_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",dds[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(dds,size);
 		fprintf(mFile,";\n");
 	}
 	void startDropoffDistance(size_t dds_start,size_t dds_end)const
@@ -86,11 +82,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".sc[%i:%i]\" ", sc_start,sc_end);
 		size_t size = (sc_end-sc_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",sc[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(sc,size);
 		fprintf(mFile,";\n");
 	}
 	void startScale(size_t sc_start,size_t sc_end)const
@@ -114,11 +106,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".wlpc[%i:%i]\" ", wlpc_start,wlpc_end);
 		size_t size = (wlpc_end-wlpc_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",wlpc[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(wlpc,size);
 		fprintf(mFile,";\n");
 	}
 	void startWireLocatorPercentage(size_t wlpc_start,size_t wlpc_end)const
@@ -142,11 +130,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".wlp[%i:%i]\" ", wlp_start,wlp_end);
 		size_t size = (wlp_end-wlp_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",wlp[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(wlp,size);
 		fprintf(mFile,";\n");
 	}
 	void startWireLocatorParameter(size_t wlp_start,size_t wlp_end)const
@@ -170,11 +154,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".wle[%i:%i]\" ", wle_start,wle_end);
 		size_t size = (wle_end-wle_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",wle[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(wle,size);
 		fprintf(mFile,";\n");
 	}
 	void startWireLocatorEnvelope(size_t wle_start,size_t wle_end)const
@@ -198,11 +178,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".wlt[%i:%i]\" ", wlt_start,wlt_end);
 		size_t size = (wlt_end-wlt_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",wlt[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(wlt,size);
 		fprintf(mFile,";\n");
 	}
 	void startWireLocatorTwist(size_t wlt_start,size_t wlt_end)const
@@ -381,7 +357,7 @@ public:
 		fprintf(mFile,"\"%s.ho\"",mName.c_str());
 	}
 protected:
-	Wire(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Wire(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:WeightGeometryFilter(file, name, parent, nodeType, shared, create) {}
 
 };
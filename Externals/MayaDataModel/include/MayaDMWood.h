@@ -20,7 +20,7 @@ public:
 public:
 
 	Wood():Texture3d(){}
-	Wood(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Wood(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, "wood", shared, create){}
 	virtual ~Wood(){}
 
@@ -373,7 +373,7 @@ public:
 		fprintf(mFile,"\"%s.d.dmx\"",mName.c_str());
 	}
 protected:
-	Wood(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Wood(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:Texture3d(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -20,7 +20,7 @@ public:
 public:
 
 	Wrap():GeometryFilter(){}
-	Wrap(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	Wrap(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, "wrap", shared, create){}
 	virtual ~Wrap(){}
 
@@ -40,11 +40,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".dr[%i:%i]\" ", dr_start,dr_end);
 		size_t size = (dr_end-dr_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",dr[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(dr,size);
 		fprintf(mFile,";\n");
 	}
 	void startDropoff(size_t dr_start,size_t dr_end)const
@@ -68,11 +64,7 @@ public:
 	{
 		fprintf(mFile,"\tsetAttr \".smt[%i:%i]\" ", smt_start,smt_end);
 		size_t size = (smt_end-smt_start)*1+1;
-		for(size_t i=0;i<size;++i)
-		{
-			fprintf(mFile,"%f",smt[i]);
-			if(i+1<size) fprintf(mFile," ");
-		}
+		mFile->writeFloatArray(smt,size);
 		fprintf(mFile,";\n");
 	}
 	void startSmoothness(size_t smt_start,size_t smt_end)const
@@ -237,7 +229,7 @@ public:
 		fprintf(mFile,"\"%s.bsd\"",mName.c_str());
 	}
 protected:
-	Wrap(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	Wrap(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:GeometryFilter(file, name, parent, nodeType, shared, create) {}
 
 };
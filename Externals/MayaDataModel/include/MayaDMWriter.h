@@ -0,0 +1,228 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of MayaDataModel.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+#ifndef __MayaDM_WRITER_H__
+#define __MayaDM_WRITER_H__
+
+#include "CommonCharacterBuffer.h"
+#include "Commonitoa.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string>
+
+namespace MayaDM
+{
+
+/**
+Buffered writer, the nodes write the maya ascii file with. The data is passed to the flusher, e.g. a
+Common::FWriteBufferFlusher to write a file or a Common::MemoryBufferFlusher to keep it in memory.
+The numbers are formatted without the C library, but exactly as fprintf would format them with
+"%i" and "%f" and the "C" locale.
+*/
+class Writer : public Common::CharacterBuffer
+{
+public:
+	static const size_t DEFAULT_BUFFER_SIZE = 2*1024*1024;
+
+private:
+	/** Maximum number of characters of a float formatted by writeFloat without the C library.*/
+	static const size_t MAX_FAST_FLOAT_LENGTH = 32;
+
+public:
+	Writer(Common::IBufferFlusher* flusher, size_t bufferSize = DEFAULT_BUFFER_SIZE)
+		: Common::CharacterBuffer(bufferSize, flusher)
+	{
+	}
+	virtual ~Writer(){}
+
+	/** Writes the null terminated @a text.*/
+	void writeString(const char* text)
+	{
+		copyToBuffer(text);
+	}
+	/** Writes @a text.*/
+	void writeString(const std::string& text)
+	{
+		copyToBuffer(text.c_str(), text.length());
+	}
+	/** Writes the character @a c.*/
+	void writeChar(char c)
+	{
+		copyToBuffer(c);
+	}
+	/** Writes @a i as fprintf with "%i" would.*/
+	void writeInt(int i)
+	{
+		// converted to long long, because itoa can not negate the smallest int.
+		copyToBufferAsChar((long long)i);
+	}
+	/** Writes @a value as fprintf with "%f" would, i.e. with six decimal places.*/
+	void writeFloat(double value)
+	{
+		// 1/-0.0 is -inf, which gives -0.0 its sign, as printf does.
+		bool negative = value < 0 || (value == 0 && 1/value < 0);
+		double absValue = negative ? -value : value;
+
+		// nan, inf and values, whose integer part might not fit into 64 bits, are formatted by the C library.
+		if(!(absValue < 1e15))
+		{
+			writeFloatFormatted(value);
+			return;
+		}
+
+		// absValue-integerPart is exact. The error of the multiplication is less than 1e-9, which is only
+		// relevant if the remainder is close to 0.5. In that case the C library decides how to round.
+		double integerPart = floor(absValue);
+		double fraction = (absValue - integerPart) * 1000000.0;
+		double fractionPart = floor(fraction);
+		double remainder = fraction - fractionPart;
+		if(remainder > 0.5 - 1e-9 && remainder < 0.5 + 1e-9)
+		{
+			writeFloatFormatted(value);
+			return;
+		}
+
+		unsigned long long integerValue = (unsigned long long)integerPart;
+		unsigned int fractionValue = (unsigned int)fractionPart + (remainder > 0.5 ? 1 : 0);
+		if(fractionValue == 1000000)
+		{
+			fractionValue = 0;
+			++integerValue;
+		}
+
+		if(getBytesAvailable() < MAX_FAST_FLOAT_LENGTH)
+			flushBuffer();
+		char* start = getCurrentPosition();
+		char* pos = start;
+		if(negative)
+			*pos++ = '-';
+		pos += Common::itoa(integerValue, pos, 10);
+		*pos++ = '.';
+		for(int i=5; i>=0; --i)
+		{
+			pos[i] = (char)('0' + fractionValue % 10);
+			fractionValue /= 10;
+		}
+		pos += 6;
+		increaseCurrentPosition(pos - start);
+	}
+	/** Writes the @a count integers in @a values, separated by a space.*/
+	void writeIntArray(const int* values, size_t count)
+	{
+		for(size_t i=0; i<count; ++i)
+		{
+			if(i > 0) writeChar(' ');
+			writeInt(values[i]);
+		}
+	}
+	/** Writes the @a count floats in @a values, separated by a space.*/
+	void writeFloatArray(const float* values, size_t count)
+	{
+		for(size_t i=0; i<count; ++i)
+		{
+			if(i > 0) writeChar(' ');
+			writeFloat(values[i]);
+		}
+	}
+	/** Writes the @a count doubles in @a values, separated by a space.*/
+	void writeFloatArray(const double* values, size_t count)
+	{
+		for(size_t i=0; i<count; ++i)
+		{
+			if(i > 0) writeChar(' ');
+			writeFloat(values[i]);
+		}
+	}
+	/**
+	Writes @a format as fprintf would. Only the conversions used by the nodes are supported: "%i", "%d",
+	"%f", "%s" and "%%". Any other conversion is written unchanged and does not consume an argument, as
+	the C library does.
+	*/
+	void writeFormatted(const char* format, va_list args)
+	{
+		const char* literal = format;
+		const char* pos = format;
+		while(*pos)
+		{
+			if(*pos != '%')
+			{
+				++pos;
+				continue;
+			}
+			if(pos != literal)
+				copyToBuffer(literal, pos - literal);
+			switch(pos[1])
+			{
+			case 'i':
+			case 'd':
+				writeInt(va_arg(args, int));
+				pos += 2;
+				break;
+			case 'f':
+				writeFloat(va_arg(args, double));
+				pos += 2;
+				break;
+			case 's':
+				{
+					const char* text = va_arg(args, const char*);
+					writeString(text ? text : "(null)");
+					pos += 2;
+				}
+				break;
+			case '%':
+				writeChar('%');
+				pos += 2;
+				break;
+			case 0:
+				writeChar('%');
+				pos += 1;
+				break;
+			default:
+				copyToBuffer(pos, 2);
+				pos += 2;
+				break;
+			}
+			literal = pos;
+		}
+		if(pos != literal)
+			copyToBuffer(literal, pos - literal);
+	}
+
+private:
+	/** Disable default copy ctor. */
+	Writer( const Writer& pre );
+	/** Disable default assignment operator. */
+	const Writer& operator= ( const Writer& pre );
+
+	/** Writes @a value using the C library.*/
+	void writeFloatFormatted(double value)
+	{
+		// the longest double formatted with "%f" has 317 characters
+		char text[400];
+		sprintf(text, "%f", value);
+		writeString(text);
+	}
+};
+
+/**
+Writes @a format to @a writer, as fprintf would write it to a file. See Writer::writeFormatted for the
+supported conversions.
+*/
+inline void fprintf(Writer* writer, const char* format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	writer->writeFormatted(format, args);
+	va_end(args);
+}
+
+}//namespace MayaDM
+#endif//__MayaDM_WRITER_H__
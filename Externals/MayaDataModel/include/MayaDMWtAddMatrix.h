@@ -20,7 +20,7 @@ public:
 	struct WtMatrix{
 		matrix matrixIn;
 		double weightIn;
-		void write(FILE* file) const
+		void write(Writer* file) const
 		{
 			matrixIn.write(file);
 			fprintf(file, " ");
@@ -30,7 +30,7 @@ public:
 public:
 
 	WtAddMatrix():DependNode(){}
-	WtAddMatrix(FILE* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
+	WtAddMatrix(Writer* file,const std::string& name,const std::string& parent="",bool shared=false,bool create=true)
 		:DependNode(file, name, parent, "wtAddMatrix", shared, create){}
 	virtual ~WtAddMatrix(){}
 
@@ -109,7 +109,7 @@ public:
 		fprintf(mFile,"\"%s.o\"",mName.c_str());
 	}
 protected:
-	WtAddMatrix(FILE* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
+	WtAddMatrix(Writer* file,const std::string& name,const std::string& parent,const std::string& nodeType,bool shared=false,bool create=true)
 		:DependNode(file, name, parent, nodeType, shared, create) {}
 
 };
@@ -27,6 +27,9 @@ namespace GeneratedSaxParser
 	private:
 		static xmlSAXHandler SAXHANDLER;
 
+		/** If true, the destructor calls xmlCleanupParser().*/
+		static bool CLEANUP_PARSER_ON_DESTRUCTION;
+
 		xmlParserCtxtPtr mParserContext;
 
 	public:
@@ -39,6 +42,11 @@ namespace GeneratedSaxParser
 		size_t getLineNumer()const;
 		size_t getColumnNumer()const;
 
+		/** Sets if the destructor calls xmlCleanupParser(), which is the default. xmlCleanupParser() releases
+		the global state of libxml, that is still used by parsers running in other threads. Applications that 
+		parse in several threads disable it and call xmlCleanupParser() once, after all parsers are destroyed.*/
+		static void setCleanupParserOnDestruction( bool cleanupParser ) { CLEANUP_PARSER_ON_DESTRUCTION = cleanupParser; }
+
 	private:
         /** Disable default copy ctor. */
 		LibxmlSaxParser( const LibxmlSaxParser& pre );
@@ -37,6 +37,9 @@ namespace GeneratedSaxParser
 
 		IErrorHandler* getErrorHandler() { return mErrorHandler; }
 
+		/** Sets the error handler all errors are passed to from now on.*/
+		void setErrorHandler(IErrorHandler* errorHandler) { mErrorHandler = errorHandler; }
+
 	protected:
 		size_t getLineNumber()const;
 		size_t getColumnNumber()const;
@@ -134,6 +134,9 @@ namespace GeneratedSaxParser
         size_t mUnknownElements;
         /** Number of elements that have been opened and are in a different namespace. */
         size_t mNamespaceElements;
+        /** Number of opened elements, whose content is skipped, including the element skipElementContent()
+        has been called for. */
+        size_t mSkipElements;
 
 
 	public:
@@ -147,7 +150,8 @@ namespace GeneratedSaxParser
               mLaxNamespaceHandling(false),
 			  mIgnoreElements(0),
               mUnknownElements(0),
-              mNamespaceElements(0)
+              mNamespaceElements(0),
+              mSkipElements(0)
 		  {};
 		virtual ~ParserTemplate(){};
 
@@ -157,6 +161,15 @@ namespace GeneratedSaxParser
         /** Registers a handler for unknown elements. Only the last registered will be used. */
         void registerUnknownElementHandler(IUnknownElementHandler* handler) {mUnknownHandler = handler;}
 
+        /** Skips the content of the element, whose begin function is currently called. Its child elements
+        are only counted. They are not hashed, validated or passed to any handler, and character data is
+        dropped. The end function of the element itself is called as usual. */
+        void skipElementContent() { mSkipElements = 1; }
+
+        /** Prepares the parser for the next document. The function maps and the registered handlers are 
+        kept. See ParserTemplateBase::reset().*/
+        virtual void reset();
+
         /** Registers a handler for given namespace. */
         void registerNamespaceHandler( const StringHash& namespaceHash, INamespaceHandler* handler );
 
@@ -791,6 +804,8 @@ namespace GeneratedSaxParser
                             }
                         }
 #endif
+                        if ( mCollectStatistics )
+                            mConvertedValueCounts[getValueType(typedBuffer)] += dataBufferIndex;
                         (mImpl->*dataFunction)(typedBuffer, dataBufferIndex);
 					    dataBufferIndex = 0;
                         callsToDataFunc++;
@@ -833,6 +848,8 @@ namespace GeneratedSaxParser
                         }
                     }
 #endif
+                    if ( mCollectStatistics )
+                        mConvertedValueCounts[getValueType(typedBuffer)] += dataBufferIndex;
                     (mImpl->*dataFunction)(typedBuffer, dataBufferIndex);
                     callsToDataFunc++;
                 }
@@ -990,6 +1007,8 @@ namespace GeneratedSaxParser
                 ++dataBufferIndex;
                 if ( dataBufferIndex == TYPED_VALUES_BUFFER_SIZE )
                 {
+                    if ( mCollectStatistics )
+                        mConvertedValueCounts[VALUE_TYPE_ENUM] += dataBufferIndex;
                     (mImpl->*dataFunction)(typedBuffer, dataBufferIndex);
                     dataBufferIndex = 0;
                     callsToDataFunc++;
@@ -1004,6 +1023,8 @@ namespace GeneratedSaxParser
             // we need to store the not parsed fraction
             if ( dataBufferIndex > 0)
             {
+                if ( mCollectStatistics )
+                    mConvertedValueCounts[VALUE_TYPE_ENUM] += dataBufferIndex;
                 (mImpl->*dataFunction)(typedBuffer, dataBufferIndex);
                 callsToDataFunc++;
             }
@@ -1137,6 +1158,8 @@ namespace GeneratedSaxParser
         {
             list.data = typedBuffer;
             list.size = dataBufferIndex;
+            if ( mCollectStatistics )
+                mConvertedValueCounts[getValueType(typedBuffer)] += dataBufferIndex;
             // note: buffer on stack could be shrinked here.
             return true;
         }
@@ -1511,7 +1534,11 @@ namespace GeneratedSaxParser
             }
 #endif
             if ( !failed )
+            {
+                if ( mCollectStatistics )
+                    ++mConvertedValueCounts[getValueType(&typedValue)];
                 (mImpl->*dataFunction)(&typedValue, 1);
+            }
 
 		}
 		return true;
@@ -1561,6 +1588,8 @@ namespace GeneratedSaxParser
             }
             else
             {
+                if ( mCollectStatistics )
+                    ++mConvertedValueCounts[VALUE_TYPE_ENUM];
                 (mImpl->*dataFunction)(&typedValue, 1);
             }
 
@@ -1802,7 +1831,7 @@ namespace GeneratedSaxParser
 	bool ParserTemplate<DerivedClass, ImplClass>::textData(const ParserChar* text,
 															  size_t textLength)
 	{
-        if ( mIgnoreElements > 0 )
+        if ( mSkipElements > 0 || mIgnoreElements > 0 )
         {
             return true;
         }
@@ -1856,6 +1885,15 @@ namespace GeneratedSaxParser
                 mNamespacesStack.pop();
             }
         }
+        if ( mSkipElements > 0 )
+        {
+            // the element, whose content has been skipped, is ended as usual
+            mSkipElements--;
+            if ( mSkipElements > 0 )
+            {
+                return true;
+            }
+        }
         if ( mIgnoreElements > 0 )
         {
             mIgnoreElements--;
@@ -1920,11 +1958,16 @@ namespace GeneratedSaxParser
 	bool ParserTemplate<DerivedClass, ImplClass>::elementBegin( const ParserChar* elementName,
 																   const ParserAttributes& attributes)
 	{
-        if ( (mIgnoreElements > 0 || mUnknownElements > 0 || mNamespaceElements > 0) 
+        if ( (mSkipElements > 0 || mIgnoreElements > 0 || mUnknownElements > 0 || mNamespaceElements > 0) 
             && !mNamespacesStack.empty() )
         {
             mNamespacesStack.top().counter++;
         }
+        if ( mSkipElements > 0 )
+        {
+            mSkipElements++;
+            return true;
+        }
         if ( mIgnoreElements > 0 )
         {
             mIgnoreElements++;
@@ -2072,6 +2115,10 @@ namespace GeneratedSaxParser
             mElementDataStack.push_back(newElementData);
 			newElementData.validationData = validationData;
 		}
+        else
+        {
+            mSkipElements = 0;
+        }
 		return success;
 	}
 
@@ -2306,6 +2353,22 @@ namespace GeneratedSaxParser
     }
 
 
+    //--------------------------------------------------------------------
+    template<class DerivedClass, class ImplClass>
+    void ParserTemplate<DerivedClass, ImplClass>::reset()
+    {
+        ParserTemplateBase::reset();
+        while ( !mNamespacesStack.empty() )
+        {
+            mNamespacesStack.pop();
+        }
+        mActiveNamespaceHandler = 0;
+        mIgnoreElements = 0;
+        mUnknownElements = 0;
+        mNamespaceElements = 0;
+        mSkipElements = 0;
+    }
+
     //--------------------------------------------------------------------
     template<class DerivedClass, class ImplClass>
     void ParserTemplate<DerivedClass, ImplClass>::registerNamespaceHandler( const StringHash& namespaceHash, INamespaceHandler* handler )
@@ -52,6 +52,26 @@ namespace GeneratedSaxParser
 		typedef std::deque<ElementData> ElementDataStack;
 		typedef std::map<StringHash, const char*> ElementNameMap;
 
+		/** The types of the values converted from character data and attributes, as counted by 
+		getConvertedValueCount().*/
+		enum ValueType
+		{
+			VALUE_TYPE_BOOL,
+			VALUE_TYPE_FLOAT,
+			VALUE_TYPE_DOUBLE,
+			VALUE_TYPE_SINT8,
+			VALUE_TYPE_UINT8,
+			VALUE_TYPE_SINT16,
+			VALUE_TYPE_UINT16,
+			VALUE_TYPE_SINT32,
+			VALUE_TYPE_UINT32,
+			VALUE_TYPE_SINT64,
+			VALUE_TYPE_UINT64,
+			VALUE_TYPE_STRING,
+			VALUE_TYPE_ENUM,
+			VALUE_TYPE_COUNT
+		};
+
 	protected:
 		ElementDataStack mElementDataStack;
 
@@ -78,15 +98,40 @@ namespace GeneratedSaxParser
 
         ElementNameMap mHashNameMap;
 
+		/** The number of values converted so far, for each ValueType.*/
+		size_t mConvertedValueCounts[VALUE_TYPE_COUNT];
+
+		/** If true, the converted values are counted.*/
+		bool mCollectStatistics;
+
 	public:
 		ParserTemplateBase(IErrorHandler* errorHandler)
 			: Parser(errorHandler),
 			mStackMemoryManager(STACK_SIZE),
             mValidationDataStack(STACK_SIZE),
             mValidate(true),
-			mLastIncompleteFragmentInCharacterData(0){}
+			mLastIncompleteFragmentInCharacterData(0),
+			mCollectStatistics(false)
+		{
+			memset(mConvertedValueCounts, 0, sizeof(mConvertedValueCounts));
+		}
 		virtual ~ParserTemplateBase(){};
 
+		/** Sets if the converted values are counted. Disabled by default.*/
+		void setCollectStatistics( bool collectStatistics ) { mCollectStatistics = collectStatistics; }
+
+		/** Prepares the parser for the next document. Removes all data of the current document, that might
+		be left after parsing has been aborted, and resets the counters of converted values. The allocated
+		memory, the maps and the settings of the parser are kept.*/
+		virtual void reset();
+
+		/** Returns the number of values of type @a valueType converted from character data and attributes 
+		since this parser has been created or reset, while statistics have been collected.*/
+		size_t getConvertedValueCount( ValueType valueType )const { return mConvertedValueCounts[valueType]; }
+
+		/** Returns the name of @a valueType, e.g. "float".*/
+		static const char* getValueTypeName( ValueType valueType );
+
 		/** Returns the element or attribute name that corresponds to @a hash. Null is returned,
 		if no corresponding name could be found.*/
 		const char* getNameByStringHash(const StringHash& hash)const;
@@ -97,6 +142,20 @@ namespace GeneratedSaxParser
 
 
 	protected:
+		/** Returns the ValueType of the values pointed to by the argument. Used to count converted values.*/
+		static ValueType getValueType( const bool* ) { return VALUE_TYPE_BOOL; }
+		static ValueType getValueType( const float* ) { return VALUE_TYPE_FLOAT; }
+		static ValueType getValueType( const double* ) { return VALUE_TYPE_DOUBLE; }
+		static ValueType getValueType( const sint8* ) { return VALUE_TYPE_SINT8; }
+		static ValueType getValueType( const uint8* ) { return VALUE_TYPE_UINT8; }
+		static ValueType getValueType( const sint16* ) { return VALUE_TYPE_SINT16; }
+		static ValueType getValueType( const uint16* ) { return VALUE_TYPE_UINT16; }
+		static ValueType getValueType( const sint32* ) { return VALUE_TYPE_SINT32; }
+		static ValueType getValueType( const uint32* ) { return VALUE_TYPE_UINT32; }
+		static ValueType getValueType( const sint64* ) { return VALUE_TYPE_SINT64; }
+		static ValueType getValueType( const uint64* ) { return VALUE_TYPE_UINT64; }
+		static ValueType getValueType( const ParserString* ) { return VALUE_TYPE_STRING; }
+
 		/** Converts the first string representing a float within a ParserChar buffer with prefixedBuffer
 		prefixed to a float and advances the character pointer to the first position after the last
 		interpreted character in buffer. If buffer is set to bufferEnd, the end of the buffer was reached
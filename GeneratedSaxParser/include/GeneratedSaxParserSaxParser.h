@@ -23,6 +23,17 @@ namespace GeneratedSaxParser
 
 	private:
 		Parser* mParser;
+
+	protected:
+		/** The number of bytes of the document passed to the xml parser by the last parse call.*/
+		size_t mBytesRead;
+
+		/** The number of elements found by the last parse call.*/
+		size_t mElementCount;
+
+		/** If true, the elements are counted.*/
+		bool mCollectStatistics;
+
 	public:
 		SaxParser(Parser* parser);
 		virtual ~SaxParser();
@@ -33,6 +44,17 @@ namespace GeneratedSaxParser
 		virtual size_t getLineNumer()const=0;
 		virtual size_t getColumnNumer()const=0;
 
+		/** The number of bytes of the document passed to the xml parser by the last call of parseFile() 
+		or parseBuffer().*/
+		size_t getBytesRead()const { return mBytesRead; }
+
+		/** The number of elements found by the last call of parseFile() or parseBuffer(), if statistics
+		have been collected.*/
+		size_t getElementCount()const { return mElementCount; }
+
+		/** Sets if the elements are counted. Disabled by default.*/
+		void setCollectStatistics( bool collectStatistics ) { mCollectStatistics = collectStatistics; }
+
 		Parser* getParser(){return mParser;}
         void setParser( Parser* parser );
 
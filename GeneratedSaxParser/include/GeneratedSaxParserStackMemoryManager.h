@@ -66,6 +66,9 @@ namespace GeneratedSaxParser
         /** Returns ptr to top object on stack or 0 when stack is empty. Object will not be removed. */
         void* top();
 
+        /** Removes all objects. The first frame is kept, all others are released. */
+        void clear();
+
     protected:
         inline size_t getTopObjectSize();
 
@@ -178,6 +178,17 @@ namespace GeneratedSaxParser
         template<class IntegerType, bool signedInteger>
         static IntegerType toInteger(const ParserChar** buffer, bool& failed);
 
+        /** Appends the decimal @a digit to @a value, used by toInteger(). Values of signed types are 
+        accumulated as negative numbers.
+        @return False, if the result does not fit into IntegerType.*/
+        template<class IntegerType, bool signedInteger>
+        static bool appendDigit(IntegerType& value, int digit);
+
+        /** Returns @a value accumulated by appendDigit() with its sign. Sets @a failed to true and returns 0, 
+        if the positive value does not fit into IntegerType.*/
+        template<class IntegerType, bool signedInteger>
+        static IntegerType applySign(IntegerType value, bool negative, bool& failed);
+
 		/** Converts the first string representing an integer within a ParserChar buffer to an char and 
 		advances the character pointer to the first position after the last interpreted character. If 
 		buffer is set to bufferEnd, the end of the buffer was reached during conversion, i.e. all characters 
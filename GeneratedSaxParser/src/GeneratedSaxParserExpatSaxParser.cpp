@@ -41,7 +41,9 @@ namespace GeneratedSaxParser
 	//--------------------------------------------------------------------
 	bool ExpatSaxParser::parseBuffer(const char* uri, const char* buffer, int length)
 	{
-		
+		mBytesRead = 0;
+		mElementCount = 0;
+
 		mParser = XML_ParserCreate(0);
 
 		XML_SetUserData(mParser, this);
@@ -52,6 +54,7 @@ namespace GeneratedSaxParser
 		XML_Status status = XML_STATUS_OK;
 		bool isFinal = true;
 		XML_Parse(mParser, buffer, (int)length, isFinal);
+		mBytesRead = (size_t)length;
 
 		XML_ParserFree(mParser);
 
@@ -64,6 +67,9 @@ namespace GeneratedSaxParser
 		if (!fd)
 			return false;
 
+		mBytesRead = 0;
+		mElementCount = 0;
+
 		//XML_ParserCreate(const XML_Char *encoding);
 		mParser = XML_ParserCreate(0);
 
@@ -81,6 +87,7 @@ namespace GeneratedSaxParser
 		{
 			size_t length = fread(buffer, 1,  mBufferSize, fd);
 			status = XML_Parse(mParser, buffer, (int)length, feof(fd));
+			mBytesRead += length;
 		}
 
 		fclose (fd);
@@ -94,6 +101,8 @@ namespace GeneratedSaxParser
 	void ExpatSaxParser::startElement( void* user_data, const XML_Char* name, const XML_Char** attrs )
 	{
 		ExpatSaxParser* thisObject = (ExpatSaxParser*)user_data;
+		if ( thisObject->mCollectStatistics )
+			++thisObject->mElementCount;
 		Parser* parser = thisObject->getParser();
 		if ( !parser->elementBegin((const ParserChar*)name, (const ParserChar**)attrs) )
 			thisObject->abortParsing();
@@ -50,6 +50,8 @@ namespace GeneratedSaxParser
 
 	};
 
+	bool LibxmlSaxParser::CLEANUP_PARSER_ON_DESTRUCTION = true;
+
 
 	//--------------------------------------------------------------------
 	LibxmlSaxParser::LibxmlSaxParser(Parser* parser)
@@ -61,11 +63,15 @@ namespace GeneratedSaxParser
 	//--------------------------------------------------------------------
 	LibxmlSaxParser::~LibxmlSaxParser()
 	{
-		xmlCleanupParser();
+		if ( CLEANUP_PARSER_ON_DESTRUCTION )
+			xmlCleanupParser();
 	}
 
 	bool LibxmlSaxParser::parseFile( const char* fileName )
 	{
+			mBytesRead = 0;
+			mElementCount = 0;
+
 			mParserContext = xmlCreateFileParserCtxt(fileName);
 			
 			if ( !mParserContext )
@@ -98,6 +104,8 @@ namespace GeneratedSaxParser
 
 			initializeParserContext();
 			xmlParseDocument(mParserContext);
+			long bytesConsumed = xmlByteConsumed(mParserContext);
+			mBytesRead = bytesConsumed > 0 ? (size_t)bytesConsumed : 0;
 
 			mParserContext->sax = 0;
 
@@ -115,6 +123,9 @@ namespace GeneratedSaxParser
 
 	bool LibxmlSaxParser::parseBuffer( const char* uri, const char* buffer, int length )
 	{
+        mBytesRead = 0;
+        mElementCount = 0;
+
         mParserContext = xmlCreateMemoryParserCtxt( buffer, length );
         
         if ( !mParserContext )
@@ -147,6 +158,8 @@ namespace GeneratedSaxParser
         
         initializeParserContext();
         xmlParseDocument(mParserContext);
+        long bytesConsumed = xmlByteConsumed(mParserContext);
+        mBytesRead = bytesConsumed > 0 ? (size_t)bytesConsumed : 0;
         
         mParserContext->sax = 0;
         
@@ -172,6 +185,8 @@ namespace GeneratedSaxParser
 	void LibxmlSaxParser::startElement( void* user_data, const ::xmlChar* name, const ::xmlChar** attrs )
 	{
 		LibxmlSaxParser* thisObject = (LibxmlSaxParser*)user_data;
+		if ( thisObject->mCollectStatistics )
+			++thisObject->mElementCount;
 		Parser* parser = thisObject->getParser();
 		if ( !parser->elementBegin((const ParserChar*)name, (const ParserChar**)attrs) )
 			thisObject->abortParsing();
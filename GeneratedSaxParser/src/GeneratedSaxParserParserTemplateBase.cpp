@@ -154,6 +154,17 @@ namespace GeneratedSaxParser
 			return it->second;
 	}
 
+	//--------------------------------------------------------------------
+	void ParserTemplateBase::reset()
+	{
+		mElementDataStack.clear();
+		mStackMemoryManager.clear();
+		mValidationDataStack.clear();
+		mLastIncompleteFragmentInCharacterData = 0;
+		mEndOfDataInCurrentObjectOnStack = 0;
+		memset(mConvertedValueCounts, 0, sizeof(mConvertedValueCounts));
+	}
+
 	//--------------------------------------------------------------------
 	StringHash ParserTemplateBase::getElementHash( size_t level /*= 0 */ )const
 	{
@@ -167,4 +178,40 @@ namespace GeneratedSaxParser
 			return 0;
 		}
 	}
+
+	//--------------------------------------------------------------------
+	const char* ParserTemplateBase::getValueTypeName( ValueType valueType )
+	{
+		switch ( valueType )
+		{
+		case VALUE_TYPE_BOOL:
+			return "bool";
+		case VALUE_TYPE_FLOAT:
+			return "float";
+		case VALUE_TYPE_DOUBLE:
+			return "double";
+		case VALUE_TYPE_SINT8:
+			return "sint8";
+		case VALUE_TYPE_UINT8:
+			return "uint8";
+		case VALUE_TYPE_SINT16:
+			return "sint16";
+		case VALUE_TYPE_UINT16:
+			return "uint16";
+		case VALUE_TYPE_SINT32:
+			return "sint32";
+		case VALUE_TYPE_UINT32:
+			return "uint32";
+		case VALUE_TYPE_SINT64:
+			return "sint64";
+		case VALUE_TYPE_UINT64:
+			return "uint64";
+		case VALUE_TYPE_STRING:
+			return "string";
+		case VALUE_TYPE_ENUM:
+			return "enum";
+		default:
+			return "";
+		}
+	}
 } // namespace GeneratedSaxParser
@@ -16,6 +16,9 @@ namespace GeneratedSaxParser
 
 	SaxParser::SaxParser( Parser* parser )
 		: mParser(parser)
+		, mBytesRead(0)
+		, mElementCount(0)
+		, mCollectStatistics(false)
 	{
 		if ( parser )
 			mParser->setSaxParser(this);
@@ -107,6 +107,17 @@ namespace GeneratedSaxParser
         return top();
     }
 
+    //-----------------------------------------------------------------
+    void StackMemoryManager::clear()
+    {
+        while ( mActiveFrame != 0 )
+        {
+            delete[] mFrames[ mActiveFrame ].mMemoryBlob;
+            mFrames[ mActiveFrame-- ].mMemoryBlob = 0;
+        }
+        mFrames[ 0 ].mCurrentPosition = 0;
+    }
+
     //-----------------------------------------------------------------
     void* StackMemoryManager::top()
     {
@@ -885,6 +885,45 @@ namespace GeneratedSaxParser
 
 
     //--------------------------------------------------------------------
+	template<class IntegerType, bool signedInteger>
+	bool Utils::appendDigit( IntegerType& value, int digit )
+	{
+		if ( signedInteger )
+		{
+			// Signed values are accumulated negative, since the smallest value has no positive counterpart.
+			const IntegerType limit = std::numeric_limits<IntegerType>::min() / 10;
+			const int lastDigit = -(int)(std::numeric_limits<IntegerType>::min() % 10);
+			if ( value <= limit && ( value < limit || digit > lastDigit ) )
+				return false;
+			value = (IntegerType)(value * 10 - digit);
+		}
+		else
+		{
+			const IntegerType limit = std::numeric_limits<IntegerType>::max() / 10;
+			const int lastDigit = (int)(std::numeric_limits<IntegerType>::max() % 10);
+			if ( value >= limit && ( value > limit || digit > lastDigit ) )
+				return false;
+			value = (IntegerType)(value * 10 + digit);
+		}
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	template<class IntegerType, bool signedInteger>
+	IntegerType Utils::applySign( IntegerType value, bool negative, bool& failed )
+	{
+		if ( !signedInteger || negative )
+			return value;
+		if ( value == std::numeric_limits<IntegerType>::min() )
+		{
+			// the value does not fit into IntegerType
+			failed = true;
+			return 0;
+		}
+		return (IntegerType)(0 - value);
+	}
+
+	//--------------------------------------------------------------------
 	template<class IntegerType, bool signedInteger>
 	IntegerType Utils::toInteger(const ParserChar** buffer, const ParserChar* bufferEnd, bool& failed)
 	{
@@ -915,13 +954,13 @@ namespace GeneratedSaxParser
 		}
 
 		IntegerType value = 0;
-		IntegerType sign = 1;
+		bool negative = false;
 		if ( signedInteger )
 		{
 			if (*s == '-')
 			{
 				++s;
-				sign = -1;
+				negative = true;
 			}
 			else if (*s == '+')
 			{
@@ -938,10 +977,7 @@ namespace GeneratedSaxParser
 				{
 					failed = false;
 					*buffer = s;
-					if ( signedInteger )
-						return value * sign;
-					else
-						return value;
+					return applySign<IntegerType, signedInteger>(value, negative, failed);
 				}
 				else
 				{
@@ -953,7 +989,12 @@ namespace GeneratedSaxParser
 
 			if ( isdigit(*s) )
 			{
-				value = value * 10 + (*s - '0');
+				if ( !appendDigit<IntegerType, signedInteger>(value, *s - '0') )
+				{
+					// the value does not fit into IntegerType
+					failed = true;
+					return 0;
+				}
 				digitFound = true;
 			}
 			else
@@ -964,10 +1005,7 @@ namespace GeneratedSaxParser
 		{
 			*buffer = s;
 			failed = false;
-			if ( signedInteger )
-				return value * sign;
-			else
-				return value;
+			return applySign<IntegerType, signedInteger>(value, negative, failed);
 		}
 		else
 		{
@@ -1007,13 +1045,13 @@ namespace GeneratedSaxParser
 		}
 
 		IntegerType value = 0;
-		IntegerType sign = 1;
+		bool negative = false;
 		if ( signedInteger )
 		{
 			if (*s == '-')
 			{
 				++s;
-				sign = -1;
+				negative = true;
 			}
 			else if (*s == '+')
 			{
@@ -1027,12 +1065,17 @@ namespace GeneratedSaxParser
 			if ( *s == '\0' )
 			{
 				failed = false;
-				return value * sign;
+				return applySign<IntegerType, signedInteger>(value, negative, failed);
 			}
 
 			if ( isdigit(*s) )
 			{
-				value = value * 10 + (*s - '0');
+				if ( !appendDigit<IntegerType, signedInteger>(value, *s - '0') )
+				{
+					// the value does not fit into IntegerType
+					failed = true;
+					return 0;
+				}
 				digitFound = true;
 			}
 			else
@@ -1044,10 +1087,7 @@ namespace GeneratedSaxParser
 		if ( digitFound )
 		{
 			failed = false;
-			if ( signedInteger )
-				return value * sign;
-			else
-				return value;
+			return applySign<IntegerType, signedInteger>(value, negative, failed);
 		}
 		else
 		{
@@ -1087,13 +1127,13 @@ namespace GeneratedSaxParser
         }
 
         IntegerType value = 0;
-        IntegerType sign = 1;
+        bool negative = false;
         if ( signedInteger )
         {
             if (*s == '-')
             {
                 ++s;
-                sign = -1;
+                negative = true;
             }
             else if (*s == '+')
             {
@@ -1110,10 +1150,7 @@ namespace GeneratedSaxParser
                 {
                     failed = false;
                     *buffer = s;
-                    if ( signedInteger )
-                        return value * sign;
-                    else
-                        return value;
+                    return applySign<IntegerType, signedInteger>(value, negative, failed);
                 }
                 else
                 {
@@ -1125,7 +1162,12 @@ namespace GeneratedSaxParser
 
             if ( isdigit(*s) )
             {
-                value = value * 10 + (*s - '0');
+                if ( !appendDigit<IntegerType, signedInteger>(value, *s - '0') )
+				{
+					// the value does not fit into IntegerType
+					failed = true;
+					return 0;
+				}
                 digitFound = true;
             }
             else
@@ -1136,10 +1178,7 @@ namespace GeneratedSaxParser
         {
             *buffer = s;
             failed = false;
-            if ( signedInteger )
-                return value * sign;
-            else
-                return value;
+            return applySign<IntegerType, signedInteger>(value, negative, failed);
         }
         else
         {
@@ -0,0 +1,118 @@
+#include "GeneratedSaxParserUtils.h"
+
+#include <iostream>
+#include <cstring>
+
+
+// Converts the largest and smallest values of the 32 bit integer types and the values just outside of them.
+// The values inside are converted exactly, the ones outside make the conversion fail instead of wrapping around.
+
+namespace
+{
+    int failures = 0;
+
+    void check( bool condition, const char* description )
+    {
+        if ( !condition )
+        {
+            std::cerr << "FAILED: " << description << std::endl;
+            ++failures;
+        }
+    }
+
+    /** Converts @a text with the buffer end variant used for character data, which stops at the end of
+    @a text, and with the null terminated variant used for attributes.
+    @return True, if both conversions succeeded with @a expected.*/
+    bool convertsToUint32( const char* text, GeneratedSaxParser::uint32 expected )
+    {
+        bool failed = true;
+        const GeneratedSaxParser::ParserChar* buffer = text;
+        GeneratedSaxParser::uint32 value = GeneratedSaxParser::Utils::toUint32( &buffer, text + strlen( text ), failed );
+        bool converted = !failed && value == expected;
+        failed = true;
+        value = GeneratedSaxParser::Utils::toUint32( text, failed );
+        return converted && !failed && value == expected;
+    }
+
+    /** @return True, if both variants fail to convert @a text.*/
+    bool failsUint32( const char* text )
+    {
+        bool failed = false;
+        const GeneratedSaxParser::ParserChar* buffer = text;
+        GeneratedSaxParser::Utils::toUint32( &buffer, text + strlen( text ), failed );
+        bool bufferFailed = failed;
+        failed = false;
+        GeneratedSaxParser::Utils::toUint32( text, failed );
+        return bufferFailed && failed;
+    }
+
+    bool convertsToSint32( const char* text, GeneratedSaxParser::sint32 expected )
+    {
+        bool failed = true;
+        const GeneratedSaxParser::ParserChar* buffer = text;
+        GeneratedSaxParser::sint32 value = GeneratedSaxParser::Utils::toSint32( &buffer, text + strlen( text ), failed );
+        bool converted = !failed && value == expected;
+        failed = true;
+        value = GeneratedSaxParser::Utils::toSint32( text, failed );
+        return converted && !failed && value == expected;
+    }
+
+    bool failsSint32( const char* text )
+    {
+        bool failed = false;
+        const GeneratedSaxParser::ParserChar* buffer = text;
+        GeneratedSaxParser::Utils::toSint32( &buffer, text + strlen( text ), failed );
+        bool bufferFailed = failed;
+        failed = false;
+        GeneratedSaxParser::Utils::toSint32( text, failed );
+        return bufferFailed && failed;
+    }
+
+    void testUint32()
+    {
+        check( convertsToUint32( "0", 0 ), "unsigned 0" );
+        check( convertsToUint32( "4294967295", 4294967295u ), "the largest unsigned 32 bit value" );
+        check( convertsToUint32( "  4294967295 ", 4294967295u ), "the largest unsigned 32 bit value between whitespace" );
+        check( failsUint32( "4294967296" ), "the largest unsigned 32 bit value plus one fails" );
+        check( failsUint32( "4294967300" ), "a value with a larger last digit fails" );
+        check( failsUint32( "42949672950" ), "a value with one digit more fails" );
+    }
+
+    void testSint32()
+    {
+        check( convertsToSint32( "2147483647", 2147483647 ), "the largest signed 32 bit value" );
+        check( convertsToSint32( "-2147483648", -2147483647 - 1 ), "the smallest signed 32 bit value" );
+        check( convertsToSint32( "-0", 0 ), "negative 0" );
+        check( failsSint32( "2147483648" ), "the largest signed 32 bit value plus one fails" );
+        check( failsSint32( "-2147483649" ), "the smallest signed 32 bit value minus one fails" );
+    }
+
+    void testSequence()
+    {
+        // the values of a list are converted one after the other, an overflow stops the conversion
+        const char* text = "4294967295 7 4294967296 8";
+        const GeneratedSaxParser::ParserChar* buffer = text;
+        const GeneratedSaxParser::ParserChar* bufferEnd = text + strlen( text );
+        bool failed = true;
+        GeneratedSaxParser::uint32 first = GeneratedSaxParser::Utils::toUint32( &buffer, bufferEnd, failed );
+        check( !failed && first == 4294967295u, "the first value of a list" );
+        GeneratedSaxParser::uint32 second = GeneratedSaxParser::Utils::toUint32( &buffer, bufferEnd, failed );
+        check( !failed && second == 7, "the value after the largest one" );
+        GeneratedSaxParser::Utils::toUint32( &buffer, bufferEnd, failed );
+        check( failed, "a value too large in a list fails" );
+    }
+}
+
+
+int main()
+{
+    testUint32();
+    testSint32();
+    testSequence();
+
+    if ( failures > 0 )
+        return -1;
+
+    std::cout << "All Utils integer tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,78 @@
+/*
+    Copyright (c) 2009 NetAllied Systems GmbH
+
+    This file is part of Common libBuffer.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COMMON_MEMORYBUFFERFLUSHER_H__
+#define __COMMON_MEMORYBUFFERFLUSHER_H__
+
+#include "CommonIBufferFlusher.h"
+
+#include <vector>
+#include <map>
+
+
+namespace Common
+{
+	/** Flusher that keeps all received data in memory. The data can be accessed after the buffer using the flusher
+	has been flushed. Marks are supported, i.e. data can be overwritten at a previously marked position.*/
+	class MemoryBufferFlusher : public IBufferFlusher
+	{
+	private:
+		typedef std::map<MarkId, size_t> MarkIdToPosition;
+
+	private:
+		/** The received data.*/
+		std::vector<char> mData;
+
+		/** The position the next received data is written to.*/
+		size_t mPosition;
+
+		MarkId mLastMarkId;
+
+		MarkIdToPosition mMarkIds;
+
+	public:
+		MemoryBufferFlusher( size_t initialCapacity = 0 );
+		virtual ~MemoryBufferFlusher();
+
+		/** Receives and handles @a length bytes starting at @a buffer.
+		@return True on success, false otherwise.*/
+		virtual bool receiveData( const char* buffer, size_t length);
+
+		/** Flushes all the data previously received by receiveData. Nothing to do for this flusher.*/
+		virtual bool flush();
+
+		void startMark();
+
+		IBufferFlusher::MarkId endMark();
+
+		bool jumpToMark(IBufferFlusher::MarkId markId, bool keepMarkId = false);
+
+		/** Always 0.*/
+		int getError() const { return 0; }
+
+		/** Pointer to the received data. Only valid until new data is received.*/
+		const char* getData() const { return mData.empty() ? 0 : &mData.front(); }
+
+		/** The number of bytes received.*/
+		size_t getDataSize() const { return mData.size(); }
+
+		/** Discards all received data and marks. The allocated memory is kept.*/
+		void clear();
+
+	private:
+        /** Disable default copy ctor. */
+		MemoryBufferFlusher( const MemoryBufferFlusher& pre );
+        /** Disable default assignment operator. */
+		const MemoryBufferFlusher& operator= ( const MemoryBufferFlusher& pre );
+
+	};
+} // namespace COMMON
+
+#endif // __COMMON_MEMORYBUFFERFLUSHER_H__
@@ -0,0 +1,100 @@
+/*
+    Copyright (c) 2009 NetAllied Systems GmbH
+
+    This file is part of Common libBuffer.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "CommonMemoryBufferFlusher.h"
+
+#include <string.h>
+
+namespace Common
+{
+	//--------------------------------------------------------------------
+	MemoryBufferFlusher::MemoryBufferFlusher( size_t initialCapacity )
+		: mData()
+		, mPosition(0)
+		, mLastMarkId(END_OF_STREAM)
+		, mMarkIds()
+	{
+		mData.reserve( initialCapacity );
+	}
+
+	//--------------------------------------------------------------------
+	MemoryBufferFlusher::~MemoryBufferFlusher()
+	{
+	}
+
+	//--------------------------------------------------------------------
+	bool MemoryBufferFlusher::receiveData( const char* buffer, size_t length )
+	{
+		if ( length == 0 )
+		{
+			return true;
+		}
+
+		size_t endPosition = mPosition + length;
+		if ( endPosition > mData.size() )
+		{
+			mData.resize( endPosition );
+		}
+		memcpy( &mData[mPosition], buffer, length );
+		mPosition = endPosition;
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	bool MemoryBufferFlusher::flush()
+	{
+		return true;
+	}
+
+	//------------------------------
+	void MemoryBufferFlusher::startMark()
+	{
+		mLastMarkId++;
+		mMarkIds.insert(std::make_pair(mLastMarkId, mPosition));
+	}
+
+	//------------------------------
+	IBufferFlusher::MarkId MemoryBufferFlusher::endMark()
+	{
+		return mLastMarkId;
+	}
+
+	//------------------------------
+	bool MemoryBufferFlusher::jumpToMark( IBufferFlusher::MarkId markId, bool keepMarkId /*= false*/ )
+	{
+		if ( markId == END_OF_STREAM )
+		{
+			mPosition = mData.size();
+			return true;
+		}
+
+		MarkIdToPosition::iterator markIdIt = mMarkIds.find(markId);
+		if ( markIdIt == mMarkIds.end() )
+		{
+			return false;
+		}
+
+		mPosition = markIdIt->second;
+		if ( !keepMarkId )
+		{
+			mMarkIds.erase(markIdIt);
+		}
+		return true;
+	}
+
+	//------------------------------
+	void MemoryBufferFlusher::clear()
+	{
+		mData.clear();
+		mPosition = 0;
+		mMarkIds.clear();
+	}
+
+} // namespace Common
@@ -68,14 +68,6 @@ namespace DAE23ds
 
 		Common::Buffer& getBuffer() { return mWriter->getBuffer(); }
 
-		/** The chunk length of all object block and material blocks.*/
-		ChunkLength getObjectAndMaterialBlockLength() const { return mWriter->getObjectAndMaterialBlockLength(); }
-
-		/** The chunk length of all object block and material blocks.*/
-		void setObjectAndMaterialBlockLength(ChunkLength val) { mWriter->setObjectAndMaterialBlockLength(val); }
-
-		void addToObjectAndMaterialBlockLength(ChunkLength val);
-
 		void addMeshData( const Writer::MeshData& meshData );
 
 		const Writer::MeshData& getMeshData( const COLLADAFW::UniqueId& meshUniqueId ) const;
@@ -97,6 +89,13 @@ namespace DAE23ds
 		/** If true, all the transformations will be applied to meshes and the scene graph will not contain any meshes.*/
 		bool getApplyTransformationsToMeshes() const { return mWriter->getApplyTransformationsToMeshes(); }
 
+		/** If true, the triangles and vertices of the meshes are reordered for the vertex cache.*/
+		bool getOptimizeMeshes() const { return mWriter->getOptimizeMeshes(); }
+
+	protected:
+		/** The writer this writer is a helper of.*/
+		Writer* getWriter() { return mWriter; }
+
 
 
 	private:
@@ -37,9 +37,6 @@ namespace DAE23ds
 		/** Returns the first common effect of the effect referenced by material.*/
 		const COLLADAFW::EffectCommon* getEffectCommon( const COLLADAFW::Material* material);
 
-		/** Calculates the length of the material block that will be created for @a material.*/
-		ChunkLength calculateMaterialBlockLength( const COLLADAFW::Material* material);
-
 		/** Calculates the length of the color blocks that will be created for @a material.*/
 		ChunkLength MaterialsBase::calculateMaterialColorLength( const COLLADAFW::Material* material);
 
@@ -57,9 +57,6 @@ namespace DAE23ds
 
 	public:
 
-		/** Constructor. */
-		MeshBase(Writer* writer3ds, const Writer::MeshData& meshData);
-
 		/** Constructor. */
 		MeshBase(Writer* writer3ds);
 
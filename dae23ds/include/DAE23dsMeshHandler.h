@@ -35,6 +35,9 @@ namespace DAE23ds
 
 	private:
 
+		/** The number of triangles of mMesh, after all its surface primitives have been triangulated.*/
+		size_t calculateTriangulatedTrianglesCount() const;
+
         /** Disable default copy ctor. */
 		MeshHandler( const MeshHandler& pre );
 
@@ -16,17 +16,51 @@
 
 #include "DAE23dsChunkIDs.h"
 
+#include <vector>
+
 namespace Common
 {
 	class Buffer;
+	class MemoryBufferFlusher;
 }
 
 namespace DAE23ds
 {
 	class Writer;
 
+	/** Writes the objects of a mesh, one or more for each instance of the mesh. The object ids are assigned in 
+	the order the objects are found. The objects are then encoded in parallel into memory, if compiled with
+	OpenMP, and appended to the file in the order of their object ids.*/
 	class MeshWriter : public MeshBase
 	{
+	private:
+		/** An object the mesh is written into, i.e. the whole mesh or one block of a mesh that needs to be split.*/
+		struct MeshObject
+		{
+			/** The instance the object is created for.*/
+			const Writer::InstanceGeometryInfo* instanceGeometryInfo;
+
+			/** True, if the object contains the whole mesh, false if it contains the triangles in blockData.*/
+			bool wholeMesh;
+
+			/** The chunk lengths, if the object contains the whole mesh.*/
+			WriteMeshIntoOneObject oneObjectData;
+
+			/** The triangles of the block, if the object contains a block of the mesh.*/
+			ObjectBlockData blockData;
+
+			/** The name of the object, calculated from its object id.*/
+			char name[OBJECT_NAME_LENGTH];
+		};
+
+		typedef std::vector<MeshObject> MeshObjectList;
+
+		/** Number of objects that are encoded in memory at the same time.*/
+		static const size_t PARALLEL_OBJECTS_COUNT = 64;
+
+		/** Initial buffer size used to encode one object.*/
+		static const size_t OBJECT_BUFFER_SIZE = 64*1024;
+
 	private:
 
 		const COLLADAFW::Mesh* mMesh;
@@ -43,26 +77,36 @@ namespace DAE23ds
 		const COLLADAFW::MeshVertexData& mMeshUVCoordinates;
 		const COLLADAFW::MeshVertexData& mMeshColors;
 
+		/** The objects found by handle(), that still need to be written.*/
+		MeshObjectList mMeshObjects;
+
 
 	public:
 
         /** Constructor. */
 		MeshWriter(Writer* writer3ds, const COLLADAFW::Mesh* mesh );
 
+        /** Constructor. Writes into @a buffer instead of the buffer of @a writer3ds.*/
+		MeshWriter(Writer* writer3ds, const COLLADAFW::Mesh* mesh, Common::Buffer& buffer );
+
         /** Destructor. */
 		virtual ~MeshWriter();
 
+		/** Writes all objects of the mesh.*/
+		bool write();
+
 		/** Writes the mesh using @a materialBindings to assign materials.*/
 		bool writeMeshIntoOneObject( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const WriteMeshIntoOneObject& data, const COLLADAFW::InstanceGeometry* alreadyUsingInstance);
 
 		/** Writes the mesh using @a materialBindings to assign materials.*/
 		bool writeMeshIntoMultipleObjects( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const WriteMeshIntoMultipleObjectsData& data, const COLLADAFW::InstanceGeometry* alreadyUsingInstance);
 
-		/** Writes the mesh using @a materialBindings to assign materials.*/
-		bool writeMeshIntoObject( const Writer::InstanceGeometryInfo& instanceGeometryInfo);
+		/** Writes the whole mesh into the object @a objectName, using @a materialBindings to assign materials.*/
+		bool writeMeshIntoObject( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const WriteMeshIntoOneObject& data, const char* objectName);
 
-		/** Writes the mesh using @a materialBindings to assign materials and data provided in @a blockData.*/
-		bool writeMeshIntoObject( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const ObjectBlockData& blockData);
+		/** Writes the mesh using @a materialBindings to assign materials and data provided in @a blockData into
+		the object @a objectName.*/
+		bool writeMeshIntoObject( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const ObjectBlockData& blockData, const char* objectName);
 
 		/** Writes the vertices/position as floats into @a buffer.*/
 		bool writeVertices(const COLLADABU::Math::Matrix4& worldMatrix);
@@ -98,6 +142,18 @@ namespace DAE23ds
 		const MeshWriter& operator= ( const MeshWriter& pre );
 
 		bool splitMeshInChunks();
+
+		/** Sets the mesh data of the base class from mMesh.*/
+		void initializeMeshData();
+
+		/** Assigns the next object id to @a meshObject and adds it to the objects that need to be written.*/
+		void addMeshObject( MeshObject& meshObject );
+
+		/** Writes @a meshObject.*/
+		bool writeMeshObject( const MeshObject& meshObject );
+
+		/** Writes all objects in mMeshObjects in the order of their object ids.*/
+		bool writeMeshObjects();
 		
 		template<class T> 
 		void transformAndWriteVertex( const T& vertex, float wm[3][4], size_t index);
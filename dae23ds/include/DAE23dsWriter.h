@@ -25,6 +25,8 @@
 #include "COLLADABUURI.h"
 #include "Math/COLLADABUMathMatrix4.h"
 
+#include "CommonIBufferFlusher.h"
+
 #include <stack>
 #include <list>
 #include <map>
@@ -210,6 +212,16 @@ namespace DAE23ds
 
 		typedef std::map< COLLADAFW::UniqueId, MaterialNumber> UniqueMaterialNumberMap;
 
+		/** A chunk, whose length is written after its content, i.e. when the chunk is ended.*/
+		struct OpenChunk
+		{
+			/** The mark of the length field of the chunk in the buffer.*/
+			Common::IBufferFlusher::MarkId lengthMark;
+
+			/** The number of bytes written before the chunk id.*/
+			size_t startPosition;
+		};
+
 	private:
 		COLLADABU::URI mInputFile;
 		COLLADABU::URI mOutputFile;
@@ -243,9 +255,6 @@ namespace DAE23ds
 		UniqueIdFWImageMap mUniqueIdFWImageMap;
 		UniqueIdFWEffectMap mUniqueIdFWEffectMap;
 
-		/** The chunk length of all object block and material blocks.*/
-		ChunkLength mObjectAndMaterialBlockLength;
-
 		/** The mesh data of all the meshes parsed at the first run.*/
 		MeshDataMap mMeshDataMap;
 
@@ -258,10 +267,19 @@ namespace DAE23ds
 		/** The Material number of the next material that will be exported.*/
 		MaterialNumber mNextMaterialNumber;
 
+		/** If true, the triangles and vertices of the meshes are reordered for the vertex cache.*/
+		bool mOptimizeMeshes;
+
 	public:
 		Writer( const COLLADABU::URI& inputFile, const COLLADABU::URI& outputFile, bool applyTransformationsToMeshes );
 		virtual ~Writer();
 
+		/** If true, the triangles and vertices of the meshes are reordered for the vertex cache.*/
+		void setOptimizeMeshes( bool optimizeMeshes ) { mOptimizeMeshes = optimizeMeshes; }
+
+		/** If true, the triangles and vertices of the meshes are reordered for the vertex cache.*/
+		bool getOptimizeMeshes() const { return mOptimizeMeshes; }
+
 	public:
 		static void reportError(const String& method, const String& message, Severity severity);
 
@@ -359,6 +377,14 @@ namespace DAE23ds
 		*/
 		static const char* calculateMaterialNameFromMaterialNumer( const MaterialNumber& materialNumber);
 
+		/** Writes the string representation of ObjectId @a objectId into @a objectName, which must be able to
+		hold getObjectNameLength() characters. Can be used in threads.*/
+		static void calculateObjectNameFromObjectId( const ObjectId& objectId, char* objectName);
+
+		/** Writes the string representation of MaterialNumber @a materialNumber into @a materialName, which must be
+		able to hold getMaterialNameLength() characters. Can be used in threads.*/
+		static void calculateMaterialNameFromMaterialNumer( const MaterialNumber& materialNumber, char* materialName);
+
 		/** Returns the length of an object name including null termination. This length is equal for all objects.*/
 		static ChunkLength getObjectNameLength();
 
@@ -395,21 +421,9 @@ namespace DAE23ds
 
 		Common::Buffer& getBuffer() { return *mBuffer; }
 
-		/** The chunk length of all object block and material blocks.*/
-		ChunkLength getObjectAndMaterialBlockLength() const { return mObjectAndMaterialBlockLength; }
-
-		/** The chunk length of all object block and material blocks.*/
-		void setObjectAndMaterialBlockLength(ChunkLength val) { mObjectAndMaterialBlockLength = val; }
-
 		/** The mesh data of all the meshes parsed at the first run.*/
 		MeshDataMap& getMeshDataMap() { return mMeshDataMap; }
 
-		/** Calculates the length of all meshes.*/
-		void calculateMeshesLength();
-
-		/** Calculates the length of all material blocks.*/
-		void calculateMaterialsBlockLength();
-
 		/** Writes all material blocks.*/
 		void writeMaterialsBlocks();
 
@@ -448,10 +462,22 @@ namespace DAE23ds
 		/** Fills the bindingMap of @a materialBinding.*/
 		static void fillMaterialBindingMap(const GeometryMaterialBinding& materialBinding);
 
-		bool writeHeader( ChunkLength sceneGraphLength );
+		/** Writes the id of the chunk @a chunkId followed by a placeholder for its length. The length is
+		written by endChunk, once the content of the chunk has been written.*/
+		OpenChunk startChunk( ChunkID chunkId );
+
+		/** Writes the length of @a chunk, i.e. the number of bytes written since @a chunk has been started,
+		into its length field.*/
+		bool endChunk( const OpenChunk& chunk );
+
+		/** Writes the M3D version chunk, the first chunk of the main chunk.*/
+		bool writeM3DVersion();
+
+		/** Writes the mesh version and the master scale chunks, the first chunks of the 3d editor chunk.*/
+		bool writeEditorHeader();
 
 		template<class NumberType, char prefix>
-		static const char* calculateNameFromNumber( const NumberType& number);
+		static void calculateNameFromNumber( const NumberType& number, char* buffer);
 	};
 
 } // namespace DAE23ds
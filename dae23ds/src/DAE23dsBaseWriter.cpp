@@ -156,12 +156,6 @@ namespace DAE23ds
 
 	}
 
-	//------------------------------
-	void BaseWriter::addToObjectAndMaterialBlockLength( ChunkLength val )
-	{
-		mWriter->setObjectAndMaterialBlockLength( mWriter->getObjectAndMaterialBlockLength() + val );
-	}
-
 	//------------------------------
 	void BaseWriter::addMeshData( const Writer::MeshData& meshData )
 	{
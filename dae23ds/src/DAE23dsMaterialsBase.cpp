@@ -73,22 +73,5 @@ namespace DAE23ds
 		return length; 
 	}
 
-	//------------------------------
-	ChunkLength MaterialsBase::calculateMaterialBlockLength( const COLLADAFW::Material* material)
-	{
-		ChunkLength length = 0;
-
-		// empty chunk length of the material block
-		// plus empty chunk length of the name
-		length += 2 * EMPTY_CHUNK_LENGTH;
-
-		// add length required for the color chunks
-
-		length += calculateMaterialColorLength( material );
-
-		length += Writer::getMaterialNameLength();
-		return length;
-	}
-
 
 } // namespace DAE23ds
@@ -18,13 +18,6 @@ namespace DAE23ds
 {
 
 	//------------------------------
-	MeshBase::MeshBase( Writer* writer3ds, const Writer::MeshData& meshData )
-		: BaseWriter(writer3ds)
-		, mMeshData(meshData)
-		, mGeometryMaterialBindingSet( Writer::compare )
-	{
-	}
-
 	MeshBase::MeshBase( Writer* writer3ds )
 		: BaseWriter(writer3ds)
 		, mGeometryMaterialBindingSet( Writer::compare )
@@ -12,6 +12,8 @@
 #include "DAE23dsMeshHandler.h"
 #include "DAE23dsMeshAccessor.h"
 
+#include "COLLADAFWMeshTriangulator.h"
+
 namespace DAE23ds
 {
 
@@ -33,12 +35,28 @@ namespace DAE23ds
 		MeshAccessor meshAccessor( mMesh );
 		Writer::MeshData meshData;
 		meshData.meshUniqueId = mMesh->getUniqueId();
-		meshData.trianglesCount = meshAccessor.getTrianglesCount();
+		// optimized meshes are written with all their surface primitives triangulated
+		meshData.trianglesCount = getOptimizeMeshes() ? calculateTriangulatedTrianglesCount() : meshAccessor.getTrianglesCount();
 		meshData.positionsCount = mMesh->getPositions().getValuesCount();
 		meshData.name = mMesh->getName();
 		addMeshData( meshData );
 		return true;
 	}
 
+	//------------------------------
+	size_t MeshHandler::calculateTriangulatedTrianglesCount() const
+	{
+		COLLADAFW::MeshTriangulator triangulator;
+		const COLLADAFW::MeshPrimitiveArray& meshPrimitives = mMesh->getMeshPrimitives();
+		std::vector<unsigned int> corners;
+		size_t trianglesCount = 0;
+		for ( size_t i = 0, count = meshPrimitives.getCount(); i < count; ++i )
+		{
+			corners.clear();
+			trianglesCount += triangulator.triangulate( *mMesh, *meshPrimitives[i], corners ) / 3;
+		}
+		return trianglesCount;
+	}
+
 
 } // namespace DAE23ds
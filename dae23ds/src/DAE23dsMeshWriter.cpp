@@ -12,6 +12,7 @@
 #include "DAE23dsMeshWriter.h"
 #include "CommonBuffer.h"
 #include "CommonFWriteBufferFlusher.h"
+#include "CommonMemoryBufferFlusher.h"
 
 #include "DAE23dsChunkIDs.h"
 #include "DAE23dsMeshSpliter.h"
@@ -34,18 +35,125 @@ namespace DAE23ds
 		, mMeshNormals( mesh->getNormals() )
 		, mMeshUVCoordinates( mesh->getUVCoords() )
 		, mMeshColors( mesh->getColors() )
+	{
+		initializeMeshData();
+	}
+
+	//------------------------------
+	MeshWriter::MeshWriter( Writer* writer3ds, const COLLADAFW::Mesh* mesh, Common::Buffer& buffer )
+		: MeshBase(writer3ds)
+		, mMesh(mesh)
+		, mBuffer(buffer)
+		, mMeshAccessor(mesh)
+		, mMeshPositions( mesh->getPositions() )
+		, mMeshNormals( mesh->getNormals() )
+		, mMeshUVCoordinates( mesh->getUVCoords() )
+		, mMeshColors( mesh->getColors() )
+	{
+		initializeMeshData();
+	}
+
+	//------------------------------
+	MeshWriter::~MeshWriter()
+	{
+	}
+
+	//------------------------------
+	void MeshWriter::initializeMeshData()
 	{
 		Writer::MeshData meshData;
-		meshData.meshUniqueId = mesh->getUniqueId();
+		meshData.meshUniqueId = mMesh->getUniqueId();
 		meshData.trianglesCount = mMeshAccessor.getTrianglesCount();
 		meshData.positionsCount = mMeshPositions.getValuesCount();
-		meshData.name = mesh->getName();
+		meshData.name = mMesh->getName();
 		setMeshData(meshData);
 	}
 
 	//------------------------------
-	MeshWriter::~MeshWriter()
+	bool MeshWriter::write()
+	{
+		// find all objects and assign their object ids
+		handle();
+		return writeMeshObjects();
+	}
+
+	//------------------------------
+	void MeshWriter::addMeshObject( MeshObject& meshObject )
 	{
+		Writer::ObjectId objectId = getAndIncreaseNextObjectId();
+		Writer::calculateObjectNameFromObjectId( objectId, meshObject.name );
+		const Writer::InstanceGeometryInfo& instanceGeometryInfo = *meshObject.instanceGeometryInfo;
+		addInstanceGeometryObjectId(Writer::InstanceGeometryIdentifier(instanceGeometryInfo.fwInstanceGeometry, instanceGeometryInfo.instanceNumber), objectId);
+		mMeshObjects.push_back( meshObject );
+	}
+
+	//------------------------------
+	bool MeshWriter::writeMeshObject( const MeshObject& meshObject )
+	{
+		if ( meshObject.wholeMesh )
+		{
+			return writeMeshIntoObject( *meshObject.instanceGeometryInfo, meshObject.oneObjectData, meshObject.name );
+		}
+		else
+		{
+			return writeMeshIntoObject( *meshObject.instanceGeometryInfo, meshObject.blockData, meshObject.name );
+		}
+	}
+
+	//------------------------------
+	bool MeshWriter::writeMeshObjects()
+	{
+		size_t meshObjectsCount = mMeshObjects.size();
+		if ( meshObjectsCount <= 1 )
+		{
+			// nothing to do in parallel
+			bool success = (meshObjectsCount == 0) || writeMeshObject( mMeshObjects[0] );
+			mMeshObjects.clear();
+			return success;
+		}
+
+		size_t flushersCount = min( meshObjectsCount, PARALLEL_OBJECTS_COUNT );
+		std::vector<Common::MemoryBufferFlusher*> flushers( flushersCount );
+		for ( size_t i = 0; i < flushersCount; ++i )
+		{
+			flushers[i] = new Common::MemoryBufferFlusher( OBJECT_BUFFER_SIZE );
+		}
+
+		// bool is not used, since the elements of std::vector<bool> can not be written in parallel
+		std::vector<char> objectsSucceeded( flushersCount );
+		bool success = true;
+		for ( size_t first = 0; first < meshObjectsCount; first += flushersCount )
+		{
+			int objectsCount = (int)min( flushersCount, meshObjectsCount - first );
+
+			// each object is encoded by its own writer with its own mesh accessor into its own buffer
+#pragma omp parallel for schedule(dynamic)
+			for ( int i = 0; i < objectsCount; ++i )
+			{
+				Common::Buffer buffer( OBJECT_BUFFER_SIZE, flushers[i] );
+				MeshWriter objectWriter( getWriter(), mMesh, buffer );
+				objectsSucceeded[i] = objectWriter.writeMeshObject( mMeshObjects[first + i] );
+			}
+
+			// append the objects in the order of their object ids
+			for ( int i = 0; i < objectsCount; ++i )
+			{
+				success &= (objectsSucceeded[i] != 0);
+				Common::MemoryBufferFlusher* flusher = flushers[i];
+				if ( flusher->getDataSize() > 0 )
+				{
+					success &= mBuffer.copyToBuffer( flusher->getData(), flusher->getDataSize() );
+				}
+				flusher->clear();
+			}
+		}
+
+		for ( size_t i = 0; i < flushersCount; ++i )
+		{
+			delete flushers[i];
+		}
+		mMeshObjects.clear();
+		return success;
 	}
 
 	//------------------------------
@@ -70,7 +178,11 @@ namespace DAE23ds
 
 //			writeMaterialBlocks(materialBindings);
 
-			ObjectBlockData blockData;
+			MeshObject meshObject;
+			meshObject.instanceGeometryInfo = &instanceGeometryInfo;
+			meshObject.wholeMesh = false;
+
+			ObjectBlockData& blockData = meshObject.blockData;
 			blockData.trianglesCount = MAX_TRIANGLES_PER_BLOCK;
 			blockData.firstTriangleIndex = 0;
 			//		blockData.verticesCount = MAX_INDEX_COUNT;
@@ -78,7 +190,7 @@ namespace DAE23ds
 			// loop here over all blocks
 			for ( ChunkLength i = 0; i  < data.fullBlocksCount; ++i )
 			{
-				writeMeshIntoObject( instanceGeometryInfo, blockData);
+				addMeshObject( meshObject );
 				blockData.firstTriangleIndex += blockData.trianglesCount;
 			}
 
@@ -86,14 +198,14 @@ namespace DAE23ds
 			if ( data.remainingTriangles > 0)
 			{
 				blockData.trianglesCount = data.remainingTriangles;
-				writeMeshIntoObject( instanceGeometryInfo, blockData);
+				addMeshObject( meshObject );
 			}
 		}
 		return true;
 	}
 
 	//------------------------------
-	bool MeshWriter::writeMeshIntoObject( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const ObjectBlockData& blockData)
+	bool MeshWriter::writeMeshIntoObject( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const ObjectBlockData& blockData, const char* objectName)
 	{
 		const COLLADAFW::InstanceGeometry* instanceGeometry = instanceGeometryInfo.fwInstanceGeometry;
 		const COLLADAFW::MaterialBindingArray& materialBindings = instanceGeometry->getMaterialBindings();
@@ -111,11 +223,7 @@ namespace DAE23ds
 		// object chunk
 		mBuffer.copyToBuffer(EDIT_OBJECT);
 		mBuffer.copyToBuffer(editObjectLength);
-
-		Writer::ObjectId objectId = getAndIncreaseNextObjectId();
-		const char* meshName3ds = Writer::calculateObjectNameFromObjectId( objectId );
-		mBuffer.copyToBuffer(meshName3ds, Writer::getObjectNameLength());
-		addInstanceGeometryObjectId(Writer::InstanceGeometryIdentifier(instanceGeometryInfo.fwInstanceGeometry, instanceGeometryInfo.instanceNumber), objectId);
+		mBuffer.copyToBuffer(objectName, Writer::getObjectNameLength());
 
 		// triangular mesh
 		mBuffer.copyToBuffer(OBJ_TRIMESH);
@@ -157,38 +265,45 @@ namespace DAE23ds
 		}
 		else
 		{
-			const COLLADAFW::MaterialBindingArray& materialBindings = instanceGeometry->getMaterialBindings();
+			MeshObject meshObject;
+			meshObject.instanceGeometryInfo = &instanceGeometryInfo;
+			meshObject.wholeMesh = true;
+			meshObject.oneObjectData = data;
+			addMeshObject( meshObject );
+		}
 
-//			writeMaterialBlocks(materialBindings);
+		return true;
+	}
 
-			// object chunk
-			mBuffer.copyToBuffer(EDIT_OBJECT);
-			mBuffer.copyToBuffer(data.editObjectLength);
-
-			Writer::ObjectId objectId = getAndIncreaseNextObjectId();
-			const char* meshName3ds = Writer::calculateObjectNameFromObjectId( objectId );
-			mBuffer.copyToBuffer(meshName3ds, Writer::getObjectNameLength());
-			addInstanceGeometryObjectId(Writer::InstanceGeometryIdentifier(instanceGeometryInfo.fwInstanceGeometry, instanceGeometryInfo.instanceNumber), objectId);
-
-			// triangular mesh
-			mBuffer.copyToBuffer(OBJ_TRIMESH);
-			mBuffer.copyToBuffer(data.triangularMeshLength);
-
-			// vertices list mesh
-			mBuffer.copyToBuffer(TRI_VERTEXL);
-			mBuffer.copyToBuffer(data.verticesLength);
-			mBuffer.copyToBuffer((CountType)(mMeshPositions.getValuesCount()/3));
-			writeVertices(instanceGeometryInfo.worldMatrix);
-
-			// faces description
-			mBuffer.copyToBuffer(TRI_FACEL1);
-			mBuffer.copyToBuffer(data.facesDescriptionLength);
-			mBuffer.copyToBuffer(data.trianglesCount);
-			writeTriangles();
-
-			writeFaceMaterials(materialBindings);
-			writeMeshMatrix(instanceGeometryInfo.worldMatrix);
-		}
+	//------------------------------
+	bool MeshWriter::writeMeshIntoObject( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const WriteMeshIntoOneObject& data, const char* objectName)
+	{
+		const COLLADAFW::InstanceGeometry* instanceGeometry = instanceGeometryInfo.fwInstanceGeometry;
+		const COLLADAFW::MaterialBindingArray& materialBindings = instanceGeometry->getMaterialBindings();
+
+		// object chunk
+		mBuffer.copyToBuffer(EDIT_OBJECT);
+		mBuffer.copyToBuffer(data.editObjectLength);
+		mBuffer.copyToBuffer(objectName, Writer::getObjectNameLength());
+
+		// triangular mesh
+		mBuffer.copyToBuffer(OBJ_TRIMESH);
+		mBuffer.copyToBuffer(data.triangularMeshLength);
+
+		// vertices list mesh
+		mBuffer.copyToBuffer(TRI_VERTEXL);
+		mBuffer.copyToBuffer(data.verticesLength);
+		mBuffer.copyToBuffer((CountType)(mMeshPositions.getValuesCount()/3));
+		writeVertices(instanceGeometryInfo.worldMatrix);
+
+		// faces description
+		mBuffer.copyToBuffer(TRI_FACEL1);
+		mBuffer.copyToBuffer(data.facesDescriptionLength);
+		mBuffer.copyToBuffer(data.trianglesCount);
+		writeTriangles();
+
+		writeFaceMaterials(materialBindings);
+		writeMeshMatrix(instanceGeometryInfo.worldMatrix);
 
 		return true;
 	}
@@ -439,7 +554,8 @@ namespace DAE23ds
 			}
 
 			MaterialNumber materialNumber = getMaterialNumberByUniqueId(materialUniqueId );
-			const char* materialName = Writer::calculateMaterialNameFromMaterialNumer(materialNumber);
+			char materialName[OBJECT_NAME_LENGTH];
+			Writer::calculateMaterialNameFromMaterialNumer(materialNumber, materialName);
 
 
 			// calculate size of the chunk
@@ -512,7 +628,8 @@ namespace DAE23ds
 			}
 
 			MaterialNumber materialNumber = getMaterialNumberByUniqueId(materialUniqueId );
-			const char* materialName = Writer::calculateMaterialNameFromMaterialNumer(materialNumber);
+			char materialName[OBJECT_NAME_LENGTH];
+			Writer::calculateMaterialNameFromMaterialNumer(materialNumber, materialName);
 
 			// calculate size of the chunk
 			// empty chunk 
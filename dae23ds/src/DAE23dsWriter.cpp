@@ -12,10 +12,8 @@
 #include "DAE23dsWriter.h"
 #include "DAE23dsMeshWriter.h"
 #include "DAE23dsMeshHandler.h"
-#include "DAE23dsMeshLengthCalculator.h"
 #include "DAE23dsSceneGraphWriter.h"
 #include "DAE23dsSceneGraphHandler.h"
-#include "DAE23dsMaterialsLengthCalculator.h"
 #include "DAE23dsMaterialsWriter.h"
 
 #include "COLLADASaxFWLLoader.h"
@@ -25,6 +23,7 @@
 #include "COLLADAFWNode.h"
 #include "COLLADAFWVisualScene.h"
 #include "COLLADAFWInstanceGeometry.h"
+#include "COLLADAFWMeshOptimizer.h"
 
 
 #include "CommonFWriteBufferFlusher.h"
@@ -76,9 +75,9 @@ namespace DAE23ds
 		, mCurrentRun(SCENEGRAPH_RUN)
 		, mVisualScene(0)
 		, mGeometryMaterialBindingFileNameMap(compare)
-		, mObjectAndMaterialBlockLength(0)
 		, mNextObjectId( RESERVED_OBJECTIDS_COUNT )
 		, mNextMaterialNumber( RESERVED_MATERIALNUMBERS_COUNT )
+		, mOptimizeMeshes(false)
 	{
 	}
 
@@ -136,10 +135,12 @@ namespace DAE23ds
 		SceneGraphHandler sceneGraphHandler(this, mVisualScene, mLibraryNodesList);
 		sceneGraphHandler.handle();
 
-		calculateMaterialsBlockLength();
-		calculateMeshesLength();
+		// the lengths of the main chunk and the 3d editor chunk are written, once their content is complete
+		OpenChunk mainChunk = startChunk( MAIN3DS );
+		writeM3DVersion();
 
-		writeHeader( sceneGraphHandler.getScenegraphLength() );
+		OpenChunk edit3DSChunk = startChunk( EDIT3DS );
+		writeEditorHeader();
 		writeMaterialsBlocks();
 
 		// load and write geometries
@@ -147,29 +148,38 @@ namespace DAE23ds
 		if ( !root.loadDocument(mInputFile.toNativePath()) )
 			return false;
 
+		if ( !endChunk( edit3DSChunk ) )
+			return false;
+
 		SceneGraphWriter sceneGraphWriter(this, mVisualScene, mLibraryNodesList);
 		sceneGraphWriter.write( sceneGraphHandler.getScenegraphLength() );
 
-		return true;
+		return endChunk( mainChunk );
 	}
 
 	//--------------------------------------------------------------------
-	void Writer::calculateMeshesLength()
+	Writer::OpenChunk Writer::startChunk( ChunkID chunkId )
 	{
-		MeshDataMap::const_iterator it = mMeshDataMap.begin();
-		for ( ; it != mMeshDataMap.end(); ++it)
-		{
-			const MeshData& meshData = it->second;
-			MeshLengthCalculator meshLengthCalculator( this, meshData );
-			meshLengthCalculator.handle();
-		}
+		OpenChunk chunk;
+		chunk.startPosition = mBuffer->getBytesCopiedToBuffer();
+		mBuffer->copyToBuffer(chunkId);
+
+		mBuffer->startMark();
+		chunk.lengthMark = mBuffer->endMark();
+		// placeholder, overwritten by endChunk
+		mBuffer->copyToBuffer((ChunkLength)0);
+		return chunk;
 	}
 
 	//--------------------------------------------------------------------
-	void Writer::calculateMaterialsBlockLength()
+	bool Writer::endChunk( const OpenChunk& chunk )
 	{
-		MaterialsLengthCalculator materialsLengthCalculator(this);
-		materialsLengthCalculator.calculate();
+		ChunkLength chunkLength = (ChunkLength)(mBuffer->getBytesCopiedToBuffer() - chunk.startPosition);
+
+		if ( !mBuffer->jumpToMark(chunk.lengthMark) )
+			return false;
+		mBuffer->copyToBuffer(chunkLength);
+		return mBuffer->jumpToMark(Common::IBufferFlusher::END_OF_STREAM);
 	}
 
 	//--------------------------------------------------------------------
@@ -266,8 +276,18 @@ namespace DAE23ds
 			}
 		case GEOMETRY_RUN:
 			{
+				// the mesh is owned by the loader, the optimizer works on a copy
+				if ( mOptimizeMeshes )
+				{
+					COLLADAFW::MeshOptimizer meshOptimizer;
+					COLLADAFW::Mesh* optimizedMesh = meshOptimizer.createOptimizedMesh( *(const COLLADAFW::Mesh*)geometry );
+					MeshWriter meshWriter( this, optimizedMesh );
+					bool success = meshWriter.write();
+					FW_DELETE optimizedMesh;
+					return success;
+				}
 				MeshWriter meshWriter( this, (COLLADAFW::Mesh*)geometry );
-				return meshWriter.handle();
+				return meshWriter.write();
 				break;
 			}
 		default:
@@ -400,47 +420,21 @@ namespace DAE23ds
 	}
 
 	//--------------------------------------------------------------------
-	bool Writer::writeHeader( ChunkLength sceneGraphLength )
+	bool Writer::writeM3DVersion()
 	{
-		// triangle mesh 
-		//plus material blocks
-		//plus plus empty chunk
-		ChunkLength edit3DSLength = mObjectAndMaterialBlockLength + EMPTY_CHUNK_LENGTH ;
-
-		// add mesh version size
-		edit3DSLength += MESH_VERSION_CHUNK_LENGTH;
-
-		// add EDIT_MASTERSCALE version length
-		edit3DSLength += EDIT_MASTERSCALE_CHUNK_LENGTH;
-
-
-		// edit 3ds plus empty chunk
-		ChunkLength mainLength = edit3DSLength + EMPTY_CHUNK_LENGTH;
-
-		// add M3D3DS_VERSION version length and scene graph length
-		mainLength += M3D_VERSION_CHUNK_LENGTH+ sceneGraphLength;
-
-
-		//  write header
- 
-		//Main chunk
- 		mBuffer->copyToBuffer(MAIN3DS);
- 		mBuffer->copyToBuffer(mainLength);
- 
- 
-		// M3D_VERSION version
 		mBuffer->copyToBuffer(M3D3DS_VERSION);
 		mBuffer->copyToBuffer(M3D_VERSION_CHUNK_LENGTH);
 		mBuffer->copyToBuffer(M3D_VERSION);
+		return true;
+	}
 
-		//3d editor chunk
- 		mBuffer->copyToBuffer(EDIT3DS);
- 		mBuffer->copyToBuffer(edit3DSLength);
- 
+	//--------------------------------------------------------------------
+	bool Writer::writeEditorHeader()
+	{
 		// mesh version
- 		mBuffer->copyToBuffer(MESH3DS_VERSION);
- 		mBuffer->copyToBuffer(MESH_VERSION_CHUNK_LENGTH);
- 		mBuffer->copyToBuffer(MESH_VERSION);
+		mBuffer->copyToBuffer(MESH3DS_VERSION);
+		mBuffer->copyToBuffer(MESH_VERSION_CHUNK_LENGTH);
+		mBuffer->copyToBuffer(MESH_VERSION);
 
 		// master scale
 		mBuffer->copyToBuffer(EDIT_MASTERSCALE);
@@ -464,11 +458,10 @@ namespace DAE23ds
 
 	//--------------------------------------------------------------------
 	template<class NumberType, char prefix>
-	const char* Writer::calculateNameFromNumber( const NumberType& number)
+	void Writer::calculateNameFromNumber( const NumberType& number, char* buffer)
 	{
 		// we do not support to big meshes here
 		assert(number < 100000);
-		static char buffer[OBJECT_NAME_LENGTH];
 		char* p = buffer;
 		*(p++) = prefix;
 		if ( number < 1000000) *(p++) = '0';
@@ -477,21 +470,35 @@ namespace DAE23ds
 		if ( number < 100) *(p++) = '0';
 		if ( number < 10) *(p++) = '0';
 		p += Common::itoa( number, p, 10);
-		return buffer;
-
 	}
 
 
 	//--------------------------------------------------------------------
 	const char* Writer::calculateMaterialNameFromMaterialNumer( const MaterialNumber& materialNumber)
 	{
-		return calculateNameFromNumber<MaterialNumber, 'M'>(materialNumber);
+		static char buffer[OBJECT_NAME_LENGTH];
+		calculateNameFromNumber<MaterialNumber, 'M'>(materialNumber, buffer);
+		return buffer;
 	}
 
 	//--------------------------------------------------------------------
 	const char* Writer::calculateObjectNameFromObjectId( const ObjectId& objectId)
 	{
-		return calculateNameFromNumber<ObjectId, 'G'>(objectId);
+		static char buffer[OBJECT_NAME_LENGTH];
+		calculateNameFromNumber<ObjectId, 'G'>(objectId, buffer);
+		return buffer;
+	}
+
+	//--------------------------------------------------------------------
+	void Writer::calculateMaterialNameFromMaterialNumer( const MaterialNumber& materialNumber, char* materialName)
+	{
+		calculateNameFromNumber<MaterialNumber, 'M'>(materialNumber, materialName);
+	}
+
+	//--------------------------------------------------------------------
+	void Writer::calculateObjectNameFromObjectId( const ObjectId& objectId, char* objectName)
+	{
+		calculateNameFromNumber<ObjectId, 'G'>(objectId, objectName);
 	}
 		
 } // namespace DAE23ds
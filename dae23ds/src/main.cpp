@@ -23,11 +23,19 @@
 
 int main(int argc, char* argv[]) 
 {
-	if ( argc > 2 ) 
+	bool optimizeMeshes = false;
+	int firstFileArgument = 1;
+	if ( argc > 1 && DAE23ds::String(argv[1]) == "-optimizeMeshes" )
+	{
+		optimizeMeshes = true;
+		firstFileArgument++;
+	}
+
+	if ( argc > firstFileArgument + 1 ) 
 	{
 
- 		DAE23ds::String inputFile = argv[1];
- 		DAE23ds::String outputFile = argv[2];
+ 		DAE23ds::String inputFile = argv[firstFileArgument];
+ 		DAE23ds::String outputFile = argv[firstFileArgument + 1];
 
 #pragma warning(disable: 4996)
 		_timeb startTimeBuffer;
@@ -37,6 +45,7 @@ int main(int argc, char* argv[])
 
 //		DAE23ds::Writer writer( COLLADABU::URI::nativePathToUri(inputFile), COLLADABU::URI::nativePathToUri(outputFile), false);
 		DAE23ds::Writer writer( COLLADABU::URI::nativePathToUri(inputFile), COLLADABU::URI::nativePathToUri(outputFile), true);
+		writer.setOptimizeMeshes( optimizeMeshes );
 		writer.write();
 
 
@@ -53,6 +62,7 @@ int main(int argc, char* argv[])
 	{
 		std::cout << "You must specify an input and output file name" << std::endl;
 
-		std::cout << "Usage: dae23ds <inputfilename> <outputfilename>" << std::endl;
+		std::cout << "Usage: dae23ds [-optimizeMeshes] <inputfilename> <outputfilename>" << std::endl;
+		std::cout << "  -optimizeMeshes  Triangulate the meshes and reorder their triangles for the vertex cache" << std::endl;
 	}
 }
\ No newline at end of file
@@ -36,6 +36,11 @@
 
 #include <set>
 
+namespace Common
+{
+    class FWriteBufferFlusher;
+}
+
 
 namespace DAE2MA
 {
@@ -157,8 +162,8 @@ namespace DAE2MA
         /** A copy of the framework's animation list elements. */
         std::vector<COLLADAFW::AnimationList*> mAnimationListsList;
 
-        /** The buffer for fprintf. */
-        char *mBuffer; // 2MB Puffer!!
+        /** Writes the data of the buffered maya ascii file into the file. */
+        Common::FWriteBufferFlusher* mFileFlusher;
 
         /** The name of the collada file. */
         String mColladaFileName;
@@ -167,7 +172,7 @@ namespace DAE2MA
         COLLADABU::URI mMayaAsciiFileURI;
 
         /** The current maya ascii file to import the data. */
-        FILE* mFile;
+        MayaDM::Writer* mFile;
 
         /** The LC_NUMERIC locale that was set before the Streamwriter was instantiated. */
         String mLocale;			
@@ -268,7 +273,7 @@ namespace DAE2MA
         const ExtraDataCallbackHandler& getMayaIdCallbackHandler () const { return mMayaIdCallbackHandler; }
 
         /** The current maya ascii file to import the data. */
-        FILE* getFile () const { return mFile; }
+        MayaDM::Writer* getFile () const { return mFile; }
 
         /** Returns the tolerance value for double value comparison. */
         const double getTolerance () const { return mDigitTolerance; }
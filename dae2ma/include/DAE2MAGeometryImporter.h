@@ -20,9 +20,11 @@
 #include "DAE2MABaseImporter.h"
 #include "DAE2MANode.h"
 #include "DAE2MAShadingBinding.h"
+#include "DAE2MAOrderedWriters.h"
 
 #include "COLLADAFWMesh.h"
 #include "COLLADAFWController.h"
+#include "COLLADAFWEdgeIndexTable.h"
 
 #include "Math/COLLADABUMathVector3.h"
 
@@ -32,12 +34,6 @@
 
 #include <vector>
 
-#ifdef __GNUC__
-#include <ext/hash_map>
-#else
-#include <hash_map>
-#endif
-
 
 namespace DAE2MA
 {
@@ -51,15 +47,20 @@ namespace DAE2MA
         /** The standard name for geometry without name. */
         static const String GEOMETRY_NAME;
 
-        /** The list for the edge indices. */
-        typedef std::vector<COLLADAFW::Edge> EdgeList;
-
-        /** The map for searching edge indices. */
-#ifndef __GNUC__
-        typedef stdext::hash_map<COLLADAFW::Edge,size_t> EdgeMap;
-#else        
-        typedef __gnu_cxx::hash_map<COLLADAFW::Edge,size_t> EdgeMap;
-#endif
+        /** 
+        * The data sections of a mesh, which are written in parallel. 
+        * The sections are written into the maya file in this order.
+        */
+        enum MeshSection
+        {
+            MESH_SECTION_VERTEX_POSITIONS = 0,
+            MESH_SECTION_NORMALS,
+            MESH_SECTION_UV_SETS,
+            MESH_SECTION_COLOR_SETS,
+            MESH_SECTION_EDGES,
+            MESH_SECTION_FACES,
+            MESH_SECTION_COUNT
+        };
         
     public:
 
@@ -271,6 +272,12 @@ namespace DAE2MA
          */
         std::map<COLLADAFW::UniqueId, std::vector<GeometryShadingEngine> > mGeometryShadingEnginesMap;
 
+        /**
+         * One writer for every mesh section. The sections of the current mesh are written 
+         * into these writers and then appended to the maya file in the section order.
+         */
+        OrderedWriters mMeshSectionWriters;
+
     public:
 
         /** Constructor. */
@@ -492,19 +499,28 @@ namespace DAE2MA
             const COLLADAFW::UniqueId& transformNodeId );
 
         /**
-         * Iterates over the mesh primitives and reads the edge indices.
+         * Writes the data sections of the mesh in parallel, each section into its own writer, 
+         * and appends them to the maya file in the order of the sections.
+         */
+        void writeMeshSections ( 
+            const COLLADAFW::Mesh* mesh, 
+            const MayaDM::Mesh &meshNode );
+
+        /**
+         * Writes the given data section of the mesh with the given mesh node.
          */
-        void getEdgeIndices ( 
+        void writeMeshSection ( 
+            const MeshSection section, 
             const COLLADAFW::Mesh* mesh, 
-            EdgeList& edgeIndices, 
-            EdgeMap& edgeIndicesMap );
+            MayaDM::Mesh &meshNode, 
+            const COLLADAFW::EdgeIndexTable& edgeIndices );
 
         /*
          *	Write the face informations into the maya file.
          */
         void writeFaces ( 
             const COLLADAFW::Mesh* mesh, 
-            EdgeMap& edgeIndicesMap, 
+            const COLLADAFW::EdgeIndexTable& edgeIndices, 
             MayaDM::Mesh &meshNode );
 
         /*
@@ -513,7 +529,7 @@ namespace DAE2MA
         void appendPolygonPolyFaces ( 
             const COLLADAFW::Mesh* mesh, 
             const COLLADAFW::MeshPrimitive* primitiveElement, 
-            EdgeMap& edgeIndicesMap, 
+            const COLLADAFW::EdgeIndexTable& edgeIndices, 
             MayaDM::Mesh &meshNode,
             const size_t blockSize, 
             const size_t numGlobalFaces, 
@@ -526,7 +542,7 @@ namespace DAE2MA
         void appendTrifansPolyFaces (
             const COLLADAFW::Mesh* mesh, 
             const COLLADAFW::MeshPrimitive* primitiveElement, 
-            const EdgeMap& edgeIndicesMap, 
+            const COLLADAFW::EdgeIndexTable& edgeIndices, 
             MayaDM::Mesh &meshNode,
             const size_t blockSize, 
             const size_t numGlobalFaces, 
@@ -539,7 +555,7 @@ namespace DAE2MA
         void appendTristripsPolyFaces (
             const COLLADAFW::Mesh* mesh, 
             const COLLADAFW::MeshPrimitive* primitiveElement, 
-            const EdgeMap& edgeIndicesMap, 
+            const COLLADAFW::EdgeIndexTable& edgeIndices, 
             MayaDM::Mesh &meshNode,
             const size_t blockSize, 
             const size_t numGlobalFaces, 
@@ -552,7 +568,7 @@ namespace DAE2MA
         void setPolygonFaceInfos ( 
             const COLLADAFW::Mesh* mesh, 
             const COLLADAFW::MeshPrimitive* primitiveElement, 
-            const EdgeMap& edgeIndicesMap, 
+            const COLLADAFW::EdgeIndexTable& edgeIndices, 
             MayaDM::polyFaces &polyFace, 
             int &numEdges, 
             size_t &positionIndex, 
@@ -561,7 +577,7 @@ namespace DAE2MA
         void setPolygonHoleInfos ( 
             const COLLADAFW::Mesh* mesh, 
             const COLLADAFW::MeshPrimitive* primitiveElement, 
-            const EdgeMap& edgeIndicesMap, 
+            const COLLADAFW::EdgeIndexTable& edgeIndices, 
             MayaDM::polyFaces &polyFace, 
             int &numEdges, 
             size_t &positionIndex, 
@@ -652,89 +668,12 @@ namespace DAE2MA
         COLLADABU::Math::Vector3* getVertexPosition ( 
             const COLLADAFW::Mesh* mesh, const size_t vertexIndex );
 
-        /*
-        * Determine the edge indices (unique edges, also for multiple primitive elements)
-        * and write it into the lists (the indices referes on the position indices).
-        * Does it for triangle elements, polygons or polylist. Trifans and tristrips are a little 
-        * bit special.
-        * @param edgeIndices 
-        *           A vector of edge indices. We use it to write the list of edges into the maya 
-        *           file. The vector is already sorted.
-        * @param edgeIndicesMap 
-        *           We store the edge indices also in a sorted map. The dublicate data holding 
-        *           is reasonable, because we need the index of a given edge. The search of  
-        *           values in a map is much faster than in a vector!
-        */
-        void appendEdgeIndices ( 
-            const COLLADAFW::MeshPrimitive* primitiveElement,
-            EdgeList& edgeIndices,
-            EdgeMap& edgeIndicesMap );
-
-        /*
-        * Determine the edge indices (unique edges, also for multiple primitive elements)
-        * and write it into the lists (the indices referes on the position indices).
-        * Does it for triangle elements, polygons or polylist. 
-        * @param edgeIndices 
-        *           A vector of edge indices. We use it to write the list of edges into the maya 
-        *           file. The vector is already sorted.
-        * @param edgeIndicesMap 
-        *           We store the edge indices also in a sorted map. The dublicate data holding 
-        *           is reasonable, because we need the index of a given edge. The search of  
-        *           values in a map is much faster than in a vector!
-        */
-        void appendPolygonEdgeIndices ( 
-            const COLLADAFW::MeshPrimitive* primitiveElement,
-            EdgeList& edgeIndices,
-            EdgeMap& edgeIndicesMap );
-
-        /*
-        * Determine the edge indices (unique edges, also for multiple primitive elements)
-        * and write it into the lists (the indices referes on the position indices).
-        * Does it for trifans.
-        * @param edgeIndices 
-        *           A vector of edge indices. We use it to write the list of edges into the maya 
-        *           file. The vector is already sorted.
-        * @param edgeIndicesMap 
-        *           We store the edge indices also in a sorted map. The dublicate data holding 
-        *           is reasonable, because we need the index of a given edge. The search of  
-        *           values in a map is much faster than in a vector!
-        */
-        void appendTrifansEdgeIndices (
-            const COLLADAFW::MeshPrimitive* primitiveElement,
-            EdgeList& edgeIndices,
-            EdgeMap& edgeIndicesMap );
-
-        /*
-        * Determine the edge indices (unique edges, also for multiple primitive elements)
-        * and write it into the lists (the indices referes on the position indices).
-        * Does it for tristrips.
-        * @param edgeIndices 
-        *           A vector of edge indices. We use it to write the list of edges into the maya 
-        *           file. The vector is already sorted.
-        * @param edgeIndicesMap 
-        *           We store the edge indices also in a sorted map. The dublicate data holding 
-        *           is reasonable, because we need the index of a given edge. The search of  
-        *           values in a map is much faster than in a vector!
-        */
-        void appendTristripsEdgeIndices (
-            const COLLADAFW::MeshPrimitive* primitiveElement,
-            EdgeList& edgeIndices,
-            EdgeMap& edgeIndicesMap );
-
-        /*
-        * Appends the data of an edge, if it is not already in the list.
-        */
-        void appendEdge( 
-            const COLLADAFW::Edge& edge, 
-            EdgeList& edgeIndices,
-            EdgeMap& edgeIndicesMap );
-
         /*
          *	Write the edges into the maya file.
          */
         void writeEdges ( 
             const COLLADAFW::Mesh* mesh, 
-            const EdgeList& edgeIndices, 
+            const COLLADAFW::EdgeIndexTable& edgeIndices, 
             MayaDM::Mesh &meshNode );
 
         /*
@@ -780,7 +719,7 @@ namespace DAE2MA
          */
         bool getEdgeIndex ( 
             const COLLADAFW::Edge& edge, 
-            const EdgeMap& edgeIndicesMap, 
+            const COLLADAFW::EdgeIndexTable& edgeIndices, 
             int& edgeIndex );
 
         /**
@@ -34,6 +34,7 @@ namespace DAE2MA
         static bool mImportUpAxis;
         static bool mImportUnits;
         static bool mImportNormals;
+        static bool mSimplifyAnimations;
 
     public:
 
@@ -53,6 +54,9 @@ namespace DAE2MA
 
         static bool importSoftEdges();
 
+        /** If true, redundant keys are removed from the animation curves before they are written. */
+        static bool simplifyAnimations();
+
         static void setErrorFlag();
 
     };
@@ -243,7 +243,7 @@ namespace DAE2MA
             if ( COLLADABU::Utils::equalsIgnoreCase ( shadingEngineName, INITIAL_SHADING_ENGINE_NAME ) )
             {
                 // Get the initial shading engine.
-                FILE* file = getDocumentImporter ()->getFile ();
+                MayaDM::Writer* file = getDocumentImporter ()->getFile ();
                 MayaDM::ShadingEngine shadingEngine ( file, INITIAL_SHADING_ENGINE_NAME.c_str (), EMPTY_STRING, false, false );
 
                 // Get the initial material info.
@@ -262,7 +262,7 @@ namespace DAE2MA
                 shadingEngineName = generateUniqueDependNodeName ( shadingEngineName );
 
                 // Create a shading engine, if we not already have one.
-                FILE* file = getDocumentImporter ()->getFile ();
+                MayaDM::Writer* file = getDocumentImporter ()->getFile ();
                 MayaDM::ShadingEngine shadingEngine ( file, shadingEngineName.c_str () );
 
                 // Create the material info node for the shading engine.
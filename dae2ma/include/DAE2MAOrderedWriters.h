@@ -0,0 +1,76 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of DAE2MA.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __DAE2MA_ORDEREDWRITERS_H__
+#define __DAE2MA_ORDEREDWRITERS_H__
+
+#include "DAE2MAPrerequisites.h"
+
+#include "MayaDMWriter.h"
+
+#include <vector>
+
+namespace Common
+{
+    class MemoryBufferFlusher;
+}
+
+
+namespace DAE2MA
+{
+
+    /**
+    * A fixed number of writers, which write into memory. Each writer touches only its own
+    * buffer, so they can be filled by different threads. The output is appended to the maya
+    * file in the order of the writer indices, independent of the order they have been filled.
+    */
+    class OrderedWriters
+    {
+    private:
+
+        /** Initial buffer size of each writer. The memory is kept, if the writers are reused. */
+        static const size_t BUFFER_SIZE = 64*1024;
+
+        /** The flushers, which receive the data of the writers. */
+        std::vector<Common::MemoryBufferFlusher*> mFlushers;
+
+        /** The writers, one per flusher. */
+        std::vector<MayaDM::Writer*> mWriters;
+
+    public:
+
+        /** Creates @a count writers. */
+        OrderedWriters ( size_t count );
+        virtual ~OrderedWriters ();
+
+        /** The number of writers. */
+        size_t getCount () const { return mWriters.size (); }
+
+        /** The writer with the given index. */
+        MayaDM::Writer* getWriter ( size_t index ) { return mWriters [index]; }
+
+        /**
+        * Appends the output of all writers to @a file in the order of their indices and
+        * clears the writers, so that they can be reused.
+        */
+        void appendTo ( MayaDM::Writer* file );
+
+    private:
+
+        /** Disable default copy ctor. */
+        OrderedWriters ( const OrderedWriters& pre );
+        /** Disable default assignment operator. */
+        const OrderedWriters& operator= ( const OrderedWriters& pre );
+
+    };
+
+} // namespace DAE2MA
+
+#endif // __DAE2MA_ORDEREDWRITERS_H__
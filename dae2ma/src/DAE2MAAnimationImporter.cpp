@@ -16,8 +16,10 @@
 #include "DAE2MAEffectImporter.h"
 #include "DAE2MAMorphAnimation.h"
 #include "DAE2MAControllerImporter.h"
+#include "DAE2MAImportOptions.h"
 
 #include "COLLADAFWFloatOrDoubleArray.h"
+#include "COLLADAFWAnimationCurveSimplifier.h"
 #include "COLLADAFWScale.h"
 #include "COLLADAFWTranslate.h"
 
@@ -99,6 +101,13 @@ namespace DAE2MA
             return;
         }
 
+        // Remove the keys, which can be interpolated from the other keys, e.g. of baked animations.
+        if ( ImportOptions::simplifyAnimations () )
+        {
+            COLLADAFW::AnimationCurveSimplifier animationCurveSimplifier;
+            animationCurveSimplifier.simplify ( *animationCurve );
+        }
+
         // Write the key time values
         const COLLADAFW::AnimationCurve::InterpolationType& interpolationType = animationCurve->getInterpolationType ();
         switch ( interpolationType )
@@ -192,7 +201,7 @@ namespace DAE2MA
             animationName = generateUniqueDependNodeName ( animationName, true, true );
 
             // Get the maya file
-            FILE* file = getDocumentImporter ()->getFile ();
+            MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
             // Create the animation curve.
             MayaDM::AnimCurve* animCurve = 0;
@@ -314,7 +323,7 @@ namespace DAE2MA
             animationName = generateUniqueDependNodeName ( animationName );
 
             // Create the animation curve.
-            FILE* file = getDocumentImporter ()->getFile ();
+            MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
             // Flag, if the values of the tangents should be normalized.
             bool normalizeTangents = true;
@@ -1127,7 +1136,7 @@ namespace DAE2MA
         // "playbackOptions" in the "sceneConfigurationScriptNode".
 
         // Get the maya file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // createNode script -n "sceneConfigurationScriptNode";
         // setAttr ".b" -type "string" "playbackOptions -min 1 -max 50 -ast 1 -aet 50 ";
@@ -1252,7 +1261,7 @@ namespace DAE2MA
         const COLLADAFW::AnimationList::AnimationBindings& animationBindings )
     {
         // Get the maya file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Get the node, which use this animation list.
         EffectImporter* effectImporter = getDocumentImporter ()->getEffectImporter ();
@@ -1441,7 +1450,7 @@ namespace DAE2MA
         const COLLADAFW::AnimationList::AnimationBindings& animationBindings )
     {
         // Get the maya file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Get the node, which use this animation list.
         ControllerImporter* controllerImporter = getDocumentImporter ()->getControllerImporter ();
@@ -1546,7 +1555,7 @@ namespace DAE2MA
         const MayaDM::Transform* transform )
     {
         // Get the maya file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Write the current rotation in a quaternion and 
         // multiplicate with the existing rotation.
@@ -1697,7 +1706,7 @@ namespace DAE2MA
         COLLADAFW::Scale* scale = ( COLLADAFW::Scale* )transformation;
 
         // Get the maya file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Get the animation curves of the current animated element.
         size_t numAnimationBindings = animationBindings.getCount ();
@@ -1784,7 +1793,7 @@ namespace DAE2MA
 //         tm.getShear ( shear, MSpace::kTransform );
 
         // Get the maya file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Get the animation curves of the current animated element.
         size_t numAnimationBindings = animationBindings.getCount ();
@@ -1839,7 +1848,7 @@ namespace DAE2MA
         COLLADABU::Math::Vector3 translation = translate->getTranslation ();
 
         // Get the maya file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Get the animation curves of the current animation list.
         size_t numAnimationBindings = animationBindings.getCount ();
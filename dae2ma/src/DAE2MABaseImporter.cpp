@@ -434,7 +434,7 @@ namespace DAE2MA
     // -----------------------------------
     void BaseImporter::addExtraDataAttribute ( const ExtraTreeElement* extraTreeElement )
     {
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Get the child attributes.
         const std::map<String, ExtraTreeElement*>& children = extraTreeElement->getChildren ();
@@ -493,7 +493,7 @@ namespace DAE2MA
     // -----------------------------------
     void BaseImporter::setExtraDataAttribute ( const ExtraTreeElement* extraTreeElement )
     {
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         if ( !extraTreeElement->getValue().empty () )
         {
@@ -89,7 +89,7 @@ namespace DAE2MA
                 String cameraNodePath = mayaCameraNode->getNodePath ();
 
                 // parent -shape -noConnections -relative -addObject "|pCube1|pCubeShape1" "pCube2";
-                FILE* file = getDocumentImporter ()->getFile ();
+                MayaDM::Writer* file = getDocumentImporter ()->getFile ();
                 MayaDM::parentShape ( file, cameraNodePath, transformNodePath, false, true, true, true );
             }
 
@@ -129,7 +129,7 @@ namespace DAE2MA
         }
 
         // Create the maya camera object and write it into the maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
         MayaDM::Camera mayaCamera ( file, cameraName, mayaTransformNode->getNodePath (), isSharedCamera );
 
         // Add the original id attribute.
@@ -184,7 +184,7 @@ namespace DAE2MA
         farClipPlane = toLinearUnit ( farClipPlane );
         mayaCamera.setFarClipPlane ( farClipPlane );
 
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         const COLLADAFW::Camera::DescriptionType& description = camera->getDescriptionType ();
         switch ( description )
@@ -260,7 +260,7 @@ namespace DAE2MA
         farClipPlane = toLinearUnit ( farClipPlane );
         mayaCamera.setFarClipPlane ( farClipPlane );
         
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         COLLADAFW::Camera::DescriptionType description = camera->getDescriptionType ();
         switch ( description )
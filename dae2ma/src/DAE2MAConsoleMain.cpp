@@ -73,7 +73,8 @@ bool checkFileName ( std::string &mayaAsciiFileName )
 
 /**
  * Usage on import:
- * COLLADAMaya -i [infile.dae] [outfile.ma] -v [Maya version (default is 2009)]
+ * COLLADAMaya -i [infile.dae] [outfile.ma] -v [Maya version (default is 2009)] [-s]
+ * -s removes redundant keys from the animation curves.
  */
 #ifdef COLLADABU_OS_WIN
 int main(int argc,char** argv)
@@ -136,6 +137,18 @@ int main(int argc,char** argv)
         }
     }
 
+    // The flags follow the file names and the maya version.
+    bool simplifyAnimations = false;
+    for ( int i = 2; i < argc; ++i )
+    {
+        if ( COLLADABU::Utils::equals ( std::string ( argv[i] ), "-s" ) ) 
+        {
+            simplifyAnimations = true;
+            if ( outFileArgPos == i ) outFileArgPos = 0;
+            if ( mayaVersionArgPos == i ) mayaVersionArgPos = 0;
+        }
+    }
+
     // If no output filename is set, the input filename will be used.
     bool hasOutFileName = false;
 
@@ -160,7 +173,7 @@ int main(int argc,char** argv)
     }
     else 
     {
-        std::cerr << "[ERROR] Usage on import:\n\tCOLLADAMaya -i [infile.dae] [outfile.dae] -v [Maya version (default is 2009)]\n";
+        std::cerr << "[ERROR] Usage on import:\n\tCOLLADAMaya -i [infile.dae] [outfile.dae] -v [Maya version (default is 2009)] [-s]\n";
 #ifdef _DEBUG
         getchar();
 #endif
@@ -187,6 +200,11 @@ int main(int argc,char** argv)
     // TODO Set the import options
 //  MString importOptions = EMPTY_STRING.c_str ();
 //  ImportOptions::set ( importOptions, MPxFileTranslator::kImportAccessMode );
+    if ( simplifyAnimations )
+    {
+        std::string importOptions ( "simplifyAnimations" );
+        DAE2MA::ImportOptions::set ( importOptions );
+    }
 
     // Get the start time 
     clock_t startClock, endClock;
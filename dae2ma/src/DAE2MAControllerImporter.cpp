@@ -214,7 +214,7 @@ namespace DAE2MA
         mMorphControllerIds.push_back ( morphControllerId );
 
         // Get the current maya file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
         
         // Just import the morph controller, if it is either directly referenced as an 
         // instance_controller element from a transform node or as a skin source element from 
@@ -269,7 +269,7 @@ namespace DAE2MA
         blendShapeName = generateUniqueDependNodeName ( blendShapeName, true, true );
 
         // Create the skin cluster
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
         MayaDM::BlendShape* blendShape = new MayaDM::BlendShape ( file, blendShapeName );
         blendShapeData.setBlendShape ( blendShape );
 
@@ -401,7 +401,7 @@ namespace DAE2MA
         mSkinControllerDataIds.push_back ( skinControllerDataId );
 
         // Get the current maya file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Get all controller objects, which use the current skinControllerData.
         // We have to create the skinController data for every skinController object.
@@ -590,7 +590,7 @@ namespace DAE2MA
         skinClusterName = generateUniqueDependNodeName ( skinClusterName, true, true );
 
         // Create the skin cluster
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
         MayaDM::SkinCluster* skinCluster = new MayaDM::SkinCluster ( file, skinClusterName );
         skinClusterData.setSkinCluster ( skinCluster );
 
@@ -794,7 +794,7 @@ namespace DAE2MA
         const String& geometryFilterName )
     {
         // Get a pointer to the maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Create the groupId and the groupParts for the skinCluster.
         String geometryFilterGroupIdName = geometryFilterName + GROUP_ID_NAME_APPEND;
@@ -1188,7 +1188,7 @@ namespace DAE2MA
     void ControllerImporter::connectSkinControllerJoints ()
     {
         // Get a pointer to the maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
         VisualSceneImporter* visualSceneImporter = getDocumentImporter ()->getVisualSceneImporter ();
 
         // Connect the skin cluster's joints world matrix with the skin cluster matrix.
@@ -1281,7 +1281,7 @@ namespace DAE2MA
     void ControllerImporter::connectGeometries ()
     {
         // Get a pointer to the maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         VisualSceneImporter* visualSceneImporter = getDocumentImporter ()->getVisualSceneImporter ();
         GeometryImporter* geometryImporter = getDocumentImporter ()->getGeometryImporter ();
@@ -1402,7 +1402,7 @@ namespace DAE2MA
     void ControllerImporter::connectMorphControllerTargets ()
     {
         // Get a pointer to the maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         VisualSceneImporter* visualSceneImporter = getDocumentImporter ()->getVisualSceneImporter ();
         GeometryImporter* geometryImporter = getDocumentImporter ()->getGeometryImporter ();
@@ -1473,7 +1473,7 @@ namespace DAE2MA
     void ControllerImporter::connectControllers ()
     {
         // Get a pointer to the maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         std::map<COLLADAFW::UniqueId, GeometryFilterData*>::const_iterator it = mGeometryFilterDataMap.begin ();
         while ( it != mGeometryFilterDataMap.end () )
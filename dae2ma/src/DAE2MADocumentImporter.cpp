@@ -36,6 +36,8 @@
 
 #include "MayaDMScript.h"
 
+#include "CommonFWriteBufferFlusher.h"
+
 #include "COLLADASaxFWLLoader.h"
 
 
@@ -126,7 +128,7 @@ namespace DAE2MA
         , mLinearUnitConvertFactor ( 1.0 )
         , mLinearUnitMayaBindShapeBugConvertFactor ( 1.0 )
         , mDigitTolerance (FLOAT_TOLERANCE)
-        , mBuffer (0)
+        , mFileFlusher (0)
         , mInstanceVisualScene (0)
     {
         // Maya already use some names for the default maya objects.
@@ -188,10 +190,6 @@ namespace DAE2MA
         
         // Delete the library elements.
         releaseLibraries(); 
-
-        // Release the buffer memory
-        delete[] mBuffer;
-        mBuffer = 0;
     }
 
     //---------------------------------
@@ -274,23 +272,17 @@ namespace DAE2MA
         mLocale = setlocale ( LC_NUMERIC, 0 );
         setlocale ( LC_NUMERIC, "C" );
 
-        mFile = fopen ( mayaAsciiFileName.c_str (), "w" );
-        if ( mFile == 0 ) 
+        // The data is buffered and formatted by the writer, the flusher writes the full buffers.
+        mFileFlusher = new Common::FWriteBufferFlusher ( mayaAsciiFileName.c_str (), 
+            Common::FWriteBufferFlusher::DEFAUL_BUFFER_SIZE, "w" );
+        if ( mFileFlusher->getError () != 0 ) 
         {
+            delete mFileFlusher;
+            mFileFlusher = 0;
             std::cerr << "Can't open output file!\n" << std::endl;
             return false;
         }
-
-        // Set the buffer
-        mBuffer = new char[BUFFERSIZE];
-        bool failed = ( setvbuf ( mFile , mBuffer, _IOFBF, BUFFERSIZE ) != 0 );
-        if ( failed )
-        {
-            delete[] mBuffer;
-            mBuffer = 0;
-            std::cerr << "Could not set buffer for writing." << std::endl;
-            return false;
-        }
+        mFile = new MayaDM::Writer ( mFileFlusher, BUFFERSIZE );
 
         return true;
     }
@@ -300,8 +292,11 @@ namespace DAE2MA
     {
         if ( mFile ) 
         {
-            fclose ( mFile );
+            // Flushes the buffer, before the flusher closes the file.
+            delete mFile;
             mFile = 0;
+            delete mFileFlusher;
+            mFileFlusher = 0;
 
             setlocale ( LC_NUMERIC, mLocale.c_str() );
         }
@@ -179,7 +179,7 @@ namespace DAE2MA
 //         }
 
         // Create the effect and write it into the maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
         MayaDM::Blinn* blinn = new MayaDM::Blinn ( file, effectName );
 
         // Import the shader attributes.
@@ -217,7 +217,7 @@ namespace DAE2MA
 //         }
 
         // Write the effect into the maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
         MayaDM::Phong* phong = new MayaDM::Phong ( file, effectName );
 
         // Import the shader attributes.
@@ -251,7 +251,7 @@ namespace DAE2MA
 //         if ( COLLADABU::Utils::equals ( effectName, MaterialImporter::INITIAL_MATERIAL_NAME ) ) shared = true;
 
         // Write the effect into the maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
         MayaDM::Lambert* lambert = new MayaDM::Lambert ( file, effectName, EMPTY_STRING, shared );
 
         // Import the shader attributes.
@@ -661,7 +661,7 @@ namespace DAE2MA
         const COLLADAFW::UniqueId& materialId, 
         const COLLADAFW::EffectCommon* commonEffect )
     {
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Add the original effect id attribute.
         String colladaEffectId = effect->getOriginalId ();
@@ -766,7 +766,7 @@ namespace DAE2MA
         const COLLADAFW::EffectCommon* commonEffect )
     {
         // Get the maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // The effect id
         const COLLADAFW::UniqueId& effectId = effect->getUniqueId ();
@@ -925,7 +925,7 @@ namespace DAE2MA
     void EffectImporter::connectTexturePlacements ()
     {
         // Get the maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Writes the connections of the effect texture placements to the image files.  
         UniqueIdTextureInfosMap::const_iterator it = mEffectTextureInfosMap.begin ();
@@ -990,7 +990,7 @@ namespace DAE2MA
     void EffectImporter::connectTextures ()
     {
         // Get the maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Get the current image importer.
         ImageImporter* imageImporter = getDocumentImporter ()->getImageImporter ();
@@ -1080,7 +1080,7 @@ namespace DAE2MA
         const MayaDM::File* imageFile )
     {
         // Get the maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         const MayaDM::Lambert& shaderNode = textureInfo.getShaderNode ();
         const EffectImporter::ShaderAttribute& shaderAttribute = textureInfo.getShaderAttribute ();
@@ -21,6 +21,7 @@ namespace DAE2MA
     ExtraDataCallbackHandler::ExtraDataCallbackHandler() 
         : mIsOriginalIdField (false)
 	{
+        addProfile ( PROFILE_MAYA );
 	}
 	
     //------------------------------
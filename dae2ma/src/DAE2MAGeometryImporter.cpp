@@ -41,6 +41,7 @@ namespace DAE2MA
     // --------------------------------------------
     GeometryImporter::GeometryImporter( DocumentImporter* documentImporter ) 
     : BaseImporter ( documentImporter )
+    , mMeshSectionWriters ( MESH_SECTION_COUNT )
     {}
 
     // --------------------------------------------
@@ -401,7 +402,7 @@ namespace DAE2MA
                     String meshNodePath = mayaMeshNode->getNodePath ();
 
                     // parent -shape -noConnections -relative -addObject "|pCube1|pCubeShape1" "pCube2";
-                    FILE* file = getDocumentImporter ()->getFile ();
+                    MayaDM::Writer* file = getDocumentImporter ()->getFile ();
                     MayaDM::parentShape ( file, meshNodePath, transformNodePath, false, true, true, true );
                 }
                 else
@@ -416,7 +417,7 @@ namespace DAE2MA
                     size_t pos = meshName.find_last_of ( "|" );
                     String name = meshName.substr ( pos+1 );
                     String meshNodePath = instanceTransformNodePath + "|" + name;
-                    FILE* file = getDocumentImporter ()->getFile ();
+                    MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
                     MayaDM::parentShape ( file, meshNodePath, transformNodePath, false, true, true, true );
                 }
@@ -468,7 +469,7 @@ namespace DAE2MA
         meshName = generateUniqueDagNodeName ( meshName, mayaTransformNode );
 
         // Get the maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Get the parent transform node name.
         const COLLADAFW::UniqueId& transformNodeId = mayaTransformNode->getUniqueId ();
@@ -573,43 +574,10 @@ namespace DAE2MA
         // gets all shader engines, which are used by the primitive elements of the mesh.
         writeObjectGroups ( mesh, meshNode, transformNodeId );
 
-        // Write the vertex positions. 
-        writeVertexPositions ( mesh, meshNode );
+        // Write the vertex positions, normals, uv sets, color sets, edges and faces.
+        writeMeshSections ( mesh, meshNode );
 
-        // Write the normals. 
-        if ( ImportOptions::importNormals () )
-            writeNormals ( mesh, meshNode );
-
-        // Write the uv corrdinates.
-        writeUVSets ( mesh, meshNode );
-
-        // Write the uv corrdinates.
-        writeColorSets ( mesh, meshNode );
-
-        // The vector of edge indices. We use it to write the list of edges into 
-        // the maya file. The vector is already sorted.
-        EdgeList edgeIndices;
-
-        // We store the edge indices also in a sorted map. The dublicate data holding 
-        // is reasonable, because we need the index of a given edge. The search of  
-        // values in a map is much faster than in a vector!
-        EdgeMap edgeIndicesMap;
-
-        // We need also a list where we store the information about the vertices of an edge 
-        // and the index position of the vertex in the mesh's primitive lists. Because the indices
-        // in the primitive's vertex indices list are always the same like the indices in the 
-        // primitive's uv or color indices lists. 
-
-        // Iterates over the mesh primitives and reads the edge indices.
-        getEdgeIndices ( mesh, edgeIndices, edgeIndicesMap );
-
-        // Write the edge indices of all primitive elements into the maya file.
-        writeEdges ( mesh, edgeIndices, meshNode );
-
-        // Write the face informations of all primitive elements into the maya file.
-        writeFaces ( mesh, edgeIndicesMap, meshNode );
-
-        // Write the face vertex normals. 
+//         // Write the face vertex normals. 
 //         if ( ImportOptions::importNormals () )
 //             writeFaceVertexNormals ( mesh, meshNode );
             
@@ -621,6 +589,74 @@ namespace DAE2MA
         return true;
     }
 
+    // --------------------------------------------
+    void GeometryImporter::writeMeshSections ( 
+        const COLLADAFW::Mesh* mesh, 
+        const MayaDM::Mesh &meshNode )
+    {
+        // The unique edges of the mesh primitives with their indices. We use it to write 
+        // the list of edges into the maya file and to get the edge indices of the faces.
+        COLLADAFW::EdgeIndexTable edgeIndices;
+        edgeIndices.setParallel ( true );
+        edgeIndices.build ( *mesh );
+
+        // The sections don't depend on each other. Every section is written with its own copy 
+        // of the mesh node into its own writer. The sections touch different members only: the 
+        // uv sets store the uv set names, the faces store the texture coordinate and color input sets.
+        // There are only six sections of very different sizes, so the speedup is bounded by the 
+        // largest one (normals or faces) and doesn't grow beyond two or three threads.
+        int sectionCount = (int) MESH_SECTION_COUNT;
+#pragma omp parallel for schedule(dynamic)
+        for ( int section=0; section<sectionCount; ++section )
+        {
+            MayaDM::Mesh sectionMeshNode = meshNode;
+            sectionMeshNode.setFile ( mMeshSectionWriters.getWriter ( section ) );
+            writeMeshSection ( (MeshSection) section, mesh, sectionMeshNode, edgeIndices );
+        }
+
+        // Append the sections in a deterministic order to the maya file.
+        mMeshSectionWriters.appendTo ( getDocumentImporter ()->getFile () );
+    }
+
+    // --------------------------------------------
+    void GeometryImporter::writeMeshSection ( 
+        const MeshSection section, 
+        const COLLADAFW::Mesh* mesh, 
+        MayaDM::Mesh &meshNode, 
+        const COLLADAFW::EdgeIndexTable& edgeIndices )
+    {
+        switch ( section )
+        {
+        case MESH_SECTION_VERTEX_POSITIONS:
+            // Write the vertex positions. 
+            writeVertexPositions ( mesh, meshNode );
+            break;
+        case MESH_SECTION_NORMALS:
+            // Write the normals. 
+            if ( ImportOptions::importNormals () )
+                writeNormals ( mesh, meshNode );
+            break;
+        case MESH_SECTION_UV_SETS:
+            // Write the uv corrdinates.
+            writeUVSets ( mesh, meshNode );
+            break;
+        case MESH_SECTION_COLOR_SETS:
+            // Write the color sets.
+            writeColorSets ( mesh, meshNode );
+            break;
+        case MESH_SECTION_EDGES:
+            // Write the edge indices of all primitive elements into the maya file.
+            writeEdges ( mesh, edgeIndices, meshNode );
+            break;
+        case MESH_SECTION_FACES:
+            // Write the face informations of all primitive elements into the maya file.
+            writeFaces ( mesh, edgeIndices, meshNode );
+            break;
+        default:
+            break;
+        }
+    }
+
 //     // --------------------------------------------
 //     COLLADAFW::ExtraDataArray& GeometryImporter::getAllExtraData ( COLLADAFW::Mesh* mesh )
 //     {
@@ -719,9 +755,7 @@ namespace DAE2MA
                                 case COLLADAFW::MeshVertexData::DATA_TYPE_FLOAT:
                                     {
                                         const COLLADAFW::ArrayPrimitiveType<float>* values = normals.getFloatValues ();
-                                        meshNode.appendNormals ( (*values)[pos] );
-                                        meshNode.appendNormals ( (*values)[pos+1] );
-                                        meshNode.appendNormals ( (*values)[pos+2] );
+                                        meshNode.appendNormals ( &(*values)[pos], 3 );
                                     }
                                     break;
                                 case COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE:
@@ -804,9 +838,7 @@ namespace DAE2MA
                                 case COLLADAFW::MeshVertexData::DATA_TYPE_FLOAT:
                                     {
                                         const COLLADAFW::ArrayPrimitiveType<float>* values = normals.getFloatValues ();
-                                        meshNode.appendNormals ( (*values)[pos] );
-                                        meshNode.appendNormals ( (*values)[pos+1] );
-                                        meshNode.appendNormals ( (*values)[pos+2] );
+                                        meshNode.appendNormals ( &(*values)[pos], 3 );
                                     }
                                     break;
                                 case COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE:
@@ -861,9 +893,7 @@ namespace DAE2MA
                         case COLLADAFW::MeshVertexData::DATA_TYPE_FLOAT:
                             {
                                 const COLLADAFW::ArrayPrimitiveType<float>* values = normals.getFloatValues ();
-                                meshNode.appendNormals ( (*values)[pos] );
-                                meshNode.appendNormals ( (*values)[pos+1] );
-                                meshNode.appendNormals ( (*values)[pos+2] );
+                                meshNode.appendNormals ( &(*values)[pos], 3 );
                             }
                             break;
                         case COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE:
@@ -1073,7 +1103,7 @@ namespace DAE2MA
         // This method is called for every geometry instance.
 
         // The maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Get the unique id of the current geometry.
         const COLLADAFW::UniqueId& geometryId = mesh->getUniqueId ();
@@ -1313,9 +1343,8 @@ namespace DAE2MA
                 continue;
             }
 
-            meshNode.appendVrts ( (float)converted[0] );
-            meshNode.appendVrts ( (float)converted[1] );
-            meshNode.appendVrts ( (float)converted[2] );
+            float vertex[3] = { (float)converted[0], (float)converted[1], (float)converted[2] };
+            meshNode.appendVrts ( vertex, 3 );
 
             // End the block if necessary.
             if ( index == endPosition ) 
@@ -1499,10 +1528,10 @@ namespace DAE2MA
     // --------------------------------------------
     void GeometryImporter::writeEdges (  
         const COLLADAFW::Mesh* mesh, 
-        const EdgeList &edgeIndices, 
+        const COLLADAFW::EdgeIndexTable& edgeIndices, 
         MayaDM::Mesh &meshNode )
     {
-        size_t numEdges = edgeIndices.size ();
+        size_t numEdges = edgeIndices.getEdgeCount ();
         if ( numEdges > 0 )
         {
             // Without normals, we need to use soft edges (1).
@@ -1528,7 +1557,7 @@ namespace DAE2MA
                     meshNode.startEdge ( index, endPosition ); 
                 }
                 
-                const COLLADAFW::Edge& edge = edgeIndices [index];
+                const COLLADAFW::Edge& edge = edgeIndices.getEdge ( index );
                 meshNode.appendEdge ( edge[0] );
                 meshNode.appendEdge ( edge[1] );
                 meshNode.appendEdge ( edgh );
@@ -1543,7 +1572,7 @@ namespace DAE2MA
     // --------------------------------------------
     void GeometryImporter::writeFaces ( 
         const COLLADAFW::Mesh* mesh, 
-        EdgeMap& edgeIndicesMap, 
+        const COLLADAFW::EdgeIndexTable& edgeIndices, 
         MayaDM::Mesh &meshNode )
     {
         // Get the number of faces in the current mesh.
@@ -1570,15 +1599,15 @@ namespace DAE2MA
             switch ( primitiveType )
             {
             case COLLADAFW::MeshPrimitive::TRIANGLE_FANS:
-                appendTrifansPolyFaces ( mesh, primitiveElement, edgeIndicesMap, meshNode, blockSize, numGlobalFaces, globalFaceIndex, endPosition );
+                appendTrifansPolyFaces ( mesh, primitiveElement, edgeIndices, meshNode, blockSize, numGlobalFaces, globalFaceIndex, endPosition );
                 break;
             case COLLADAFW::MeshPrimitive::TRIANGLE_STRIPS:
-                appendTristripsPolyFaces ( mesh, primitiveElement, edgeIndicesMap, meshNode, blockSize, numGlobalFaces, globalFaceIndex, endPosition );
+                appendTristripsPolyFaces ( mesh, primitiveElement, edgeIndices, meshNode, blockSize, numGlobalFaces, globalFaceIndex, endPosition );
                 break;
             case COLLADAFW::MeshPrimitive::POLYGONS:
             case COLLADAFW::MeshPrimitive::POLYLIST:
             case COLLADAFW::MeshPrimitive::TRIANGLES:
-                appendPolygonPolyFaces ( mesh, primitiveElement, edgeIndicesMap, meshNode, blockSize, numGlobalFaces, globalFaceIndex, endPosition );
+                appendPolygonPolyFaces ( mesh, primitiveElement, edgeIndices, meshNode, blockSize, numGlobalFaces, globalFaceIndex, endPosition );
                 break;
             default:
                 std::cerr << "Primitive type not implemented!" << std::endl;
@@ -1591,7 +1620,7 @@ namespace DAE2MA
     void GeometryImporter::appendPolygonPolyFaces ( 
         const COLLADAFW::Mesh* mesh, 
         const COLLADAFW::MeshPrimitive* primitiveElement, 
-        EdgeMap& edgeIndicesMap, 
+        const COLLADAFW::EdgeIndexTable& edgeIndices, 
         MayaDM::Mesh &meshNode,
         const size_t blockSize, 
         const size_t numGlobalFaces, 
@@ -1628,9 +1657,9 @@ namespace DAE2MA
             // Handle the face infos.
             bool isHole = (numEdges<0);
             if ( !isHole )
-                setPolygonFaceInfos ( mesh, primitiveElement, edgeIndicesMap, polyFace, numEdges, positionIndex, polygonPoints );
+                setPolygonFaceInfos ( mesh, primitiveElement, edgeIndices, polyFace, numEdges, positionIndex, polygonPoints );
             else
-                setPolygonHoleInfos ( mesh, primitiveElement, edgeIndicesMap, polyFace, numEdges, positionIndex, polygonPoints );
+                setPolygonHoleInfos ( mesh, primitiveElement, edgeIndices, polyFace, numEdges, positionIndex, polygonPoints );
 
             // Handle the uv set infos.
             setPolygonUVSetInfos ( mesh, primitiveElement, polyFace, uvSetIndicesIndex, numEdges );
@@ -1682,7 +1711,7 @@ namespace DAE2MA
     void GeometryImporter::appendTrifansPolyFaces ( 
         const COLLADAFW::Mesh* mesh, 
         const COLLADAFW::MeshPrimitive* primitiveElement, 
-        const EdgeMap& edgeIndicesMap, 
+        const COLLADAFW::EdgeIndexTable& edgeIndices, 
         MayaDM::Mesh &meshNode,
         const size_t blockSize, 
         const size_t numGlobalFaces, 
@@ -1756,7 +1785,7 @@ namespace DAE2MA
                 int edgeIndexValue = 0;
 
                 // Get the edge index value from the edge list.
-                getEdgeIndex ( edge, edgeIndicesMap, edgeIndexValue );
+                getEdgeIndex ( edge, edgeIndices, edgeIndexValue );
 
                 // Set the edge list index into the poly face
                 polyFace->f.edgeIdValue [triangleEdgeCounter-1] = edgeIndexValue;
@@ -1813,7 +1842,7 @@ namespace DAE2MA
     void GeometryImporter::appendTristripsPolyFaces ( 
         const COLLADAFW::Mesh* mesh, 
         const COLLADAFW::MeshPrimitive* primitiveElement, 
-        const EdgeMap& edgeIndicesMap, 
+        const COLLADAFW::EdgeIndexTable& edgeIndices, 
         MayaDM::Mesh &meshNode,
         const size_t blockSize, 
         const size_t numGlobalFaces, 
@@ -1888,7 +1917,7 @@ namespace DAE2MA
                 int edgeIndexValue;
 
                 // Get the edge index value from the edge list.
-                getEdgeIndex ( edge, edgeIndicesMap, edgeIndexValue );
+                getEdgeIndex ( edge, edgeIndices, edgeIndexValue );
 
                 // Set the edge list index into the poly face
                 if ( changeDirection )
@@ -1960,7 +1989,7 @@ namespace DAE2MA
     void GeometryImporter::setPolygonFaceInfos ( 
         const COLLADAFW::Mesh* mesh, 
         const COLLADAFW::MeshPrimitive* primitiveElement, 
-        const EdgeMap& edgeIndicesMap, 
+        const COLLADAFW::EdgeIndexTable& edgeIndices, 
         MayaDM::polyFaces &polyFace, 
         int& numEdges, 
         size_t& positionIndex, 
@@ -2013,7 +2042,7 @@ namespace DAE2MA
             int edgeIndexValue;
 
             // Get the edge index value from the edge list.
-            getEdgeIndex ( edge, edgeIndicesMap, edgeIndexValue );
+            getEdgeIndex ( edge, edgeIndices, edgeIndexValue );
 
             // Set the edge list index into the poly face
             polyFace.f.edgeIdValue[edgeIndex] = edgeIndexValue;
@@ -2027,7 +2056,7 @@ namespace DAE2MA
     void GeometryImporter::setPolygonHoleInfos ( 
         const COLLADAFW::Mesh* mesh, 
         const COLLADAFW::MeshPrimitive* primitiveElement, 
-        const EdgeMap& edgeIndicesMap, 
+        const COLLADAFW::EdgeIndexTable& edgeIndices, 
         MayaDM::polyFaces &polyFace, 
         int &numEdges, 
         size_t &positionIndex, 
@@ -2075,7 +2104,7 @@ namespace DAE2MA
             int edgeIndexValue;
 
             // Get the edge index value from the edge list.
-            getEdgeIndex ( edge, edgeIndicesMap, edgeIndexValue );
+            getEdgeIndex ( edge, edgeIndices, edgeIndexValue );
 
             // Set the edge list index into the poly face
             polyFace.h.edgeIdValue[edgeIndex] = edgeIndexValue;
@@ -2535,18 +2564,18 @@ namespace DAE2MA
     // --------------------------------------------
     bool GeometryImporter::getEdgeIndex ( 
         const COLLADAFW::Edge& edge, 
-        const EdgeMap& edgeIndicesMap, 
+        const COLLADAFW::EdgeIndexTable& edgeIndices, 
         int& edgeIndex )
     {
-        // Find the index of the edge in the map of edges to get the index in the list.
-        EdgeMap::const_iterator it = edgeIndicesMap.find ( edge );
-        if ( it == edgeIndicesMap.end() ) 
+        // Find the index of the edge in the table of edges.
+        size_t index = 0;
+        if ( !edgeIndices.findEdgeIndex ( edge, index ) ) 
         {
-            // The edge has to be in the map!
+            // The edge has to be in the table!
             std::cerr << "Edge not found: " << edge[0] << ", " << edge[1] << std::endl;
             return false;
         }
-        edgeIndex = (int)it->second; 
+        edgeIndex = (int)index; 
 
         // Revert it, if the order is different.
         if ( edge.isReverse () ) 
@@ -2555,275 +2584,6 @@ namespace DAE2MA
         return true;
     }
 
-    // --------------------------------------------
-    void GeometryImporter::getEdgeIndices ( 
-        const COLLADAFW::Mesh* mesh, 
-        EdgeList& edgeIndices, 
-        EdgeMap& edgeIndicesMap )
-    {
-        // Implementation for multiple primitive elements.
-        const COLLADAFW::MeshPrimitiveArray& primitiveElementsArray = mesh->getMeshPrimitives ();
-        size_t count = primitiveElementsArray.getCount ();
-        for ( size_t i=0; i<count; ++i )
-        {
-            const COLLADAFW::MeshPrimitive* primitiveElement = primitiveElementsArray [ i ];
-
-            // Determine the edge indices (unique edges, also for multiple primitive elements).
-            appendEdgeIndices ( primitiveElement, edgeIndices, edgeIndicesMap );
-        }
-    }
-
-    //-----------------------------
-    void GeometryImporter::appendEdgeIndices (
-        const COLLADAFW::MeshPrimitive* primitiveElement,
-        EdgeList& edgeIndices,
-        EdgeMap& edgeIndicesMap )
-    {
-        COLLADAFW::MeshPrimitive::PrimitiveType primitiveType = primitiveElement->getPrimitiveType ();
-        switch ( primitiveType )
-        {
-        case COLLADAFW::MeshPrimitive::TRIANGLE_FANS:
-            appendTrifansEdgeIndices ( primitiveElement, edgeIndices, edgeIndicesMap );
-            break;
-        case COLLADAFW::MeshPrimitive::TRIANGLE_STRIPS:
-            appendTristripsEdgeIndices ( primitiveElement, edgeIndices, edgeIndicesMap );
-            break;
-        case COLLADAFW::MeshPrimitive::POLYGONS:
-        case COLLADAFW::MeshPrimitive::POLYLIST:
-        case COLLADAFW::MeshPrimitive::TRIANGLES:
-            appendPolygonEdgeIndices ( primitiveElement, edgeIndices, edgeIndicesMap );
-            break;
-        default:
-            std::cerr << "Primitive type not implemented!" << std::endl;
-            COLLADABU_ASSERT ( "Primitive type not implemented!");
-        }
-    }
-
-    //-----------------------------
-    void GeometryImporter::appendPolygonEdgeIndices (
-        const COLLADAFW::MeshPrimitive* primitiveElement,
-        EdgeList& edgeIndices,
-        EdgeMap& edgeIndicesMap )
-    {
-        // Get the number of grouped vertex elements (faces, holes, tristrips or trifans).
-        const size_t groupedVertexElementsCount = primitiveElement->getGroupedVertexElementsCount ();
-
-        // Get the position indices.
-        const COLLADAFW::UIntValuesArray& positionIndices = primitiveElement->getPositionIndices ();
-
-        // The points of an edge
-        int edgeStartVertexIdx=0, edgeEndVertexIdx=0;
-
-        // The current index in the positions list.
-        size_t positionIndex=0;
-
-        // TODO Possibility to be faster, if we preallocate the memory of the vector...
-//         // Iterate over the faces and count the edges of the current primitive element.
-//         int numPrimitiveEdges = 0;
-//         for ( size_t i=0; i<groupedVertexElementsCount; ++i )
-//         {
-//             // The number of edges is always the same
-//             // than the number of vertices in the current face.
-//             numPrimitiveEdges += primitiveElement->getGroupedVerticesVertexCount ( i );
-//         }
-// 
-//         // Get the current number of already written edges.
-//         size_t edgeIndicesIndex = 0;
-//         if ( edgeIndices.size () > 0 ) 
-//             edgeIndicesIndex = edgeIndices.size () - 1;
-// 
-//         // Preallocate the memory in the vector
-//         edgeIndices.reserve ( edgeIndices.size () + numPrimitiveEdges );
-
-        // The new generated edge.
-        COLLADAFW::Edge edge;
-
-        // Iterate over the faces and get the edges.
-        for ( size_t faceIndex=0; faceIndex<groupedVertexElementsCount; ++faceIndex )
-        {
-            // The number of edges is always the same
-            // than the number of vertices in the current face.
-            int numEdges = primitiveElement->getGroupedVerticesVertexCount ( faceIndex );
-
-            // Reverse for holes.
-            if ( numEdges < 0 ) numEdges *= -1;
-
-            // Go through the edges of the current face and determine the edge values.
-            for ( int edgeIndex=0; edgeIndex<numEdges; ++edgeIndex )
-            {
-                // Set the edge vertex index values into an edge object.
-                edgeStartVertexIdx = positionIndices[positionIndex];
-
-                if ( edgeIndex<(numEdges-1) )
-                    edgeEndVertexIdx = positionIndices[++positionIndex];
-                else edgeEndVertexIdx = positionIndices[positionIndex-numEdges+1];
-
-                // The order in an edge will be changed, if the endIndex is greater then the start index.
-                edge.setVertexIndices ( edgeStartVertexIdx, edgeEndVertexIdx );
-
-                // Appends the data of an edge to the edgeIndices list,
-                // if it is not already in the list.
-                appendEdge ( edge, edgeIndices, edgeIndicesMap );
-            }
-
-            // Increment the positions index for the next face, if it is a triangle or polygon.
-            // A trifan has the first edge of the next face always at the position of the last edge.
-            ++positionIndex;
-        }
-
-//         // Just reserve the really used memory.
-//         edgeIndices.reserve ( edgeIndices.size () );
-    }
-
-    //-----------------------------
-    void GeometryImporter::appendEdge (
-        const COLLADAFW::Edge& edge,
-        EdgeList& edgeIndices,
-        EdgeMap& edgeIndicesMap )
-    {
-        // Check if the current edge already exists in the map of edges.
-        EdgeMap::iterator it = edgeIndicesMap.find ( edge );
-        if ( it != edgeIndicesMap.end () ) return;
-
-        // Push the new edge into the map with it's index value.
-        edgeIndicesMap[edge] = edgeIndices.size ();
-
-        // Push the new edge into the vector of edge indices.
-        // We use it to write the list of edges into
-        // the maya file. The vector is already sorted.
-        edgeIndices.push_back ( edge );
-    }
-
-    //-----------------------------
-    void GeometryImporter::appendTrifansEdgeIndices (
-        const COLLADAFW::MeshPrimitive* primitiveElement,
-        EdgeList& edgeIndices,
-        EdgeMap& edgeIndicesMap )
-    {
-        // Get the position indices.
-        const COLLADAFW::UIntValuesArray& positionIndices = primitiveElement->getPositionIndices ();
-
-        // The points of an edge
-        int edgeStartVertexIdx=0, edgeEndVertexIdx=0;
-
-        // The current index in the positions list.
-        size_t initialPositionIndex=0;
-        size_t positionIndex=0;
-
-        // Iterate over the grouped vertices and get the edges for every group.
-        COLLADAFW::Trifans* trifans = (COLLADAFW::Trifans*) primitiveElement;
-        COLLADAFW::Trifans::VertexCountArray& vertexCountArray = trifans->getGroupedVerticesVertexCountArray ();
-        size_t groupedVertexElementsCount = vertexCountArray.getCount ();
-        for ( size_t groupedVerticesIndex=0; groupedVerticesIndex<groupedVertexElementsCount; ++groupedVerticesIndex )
-        {
-            // A trifan has always triangles, which have 3 edges
-            size_t triangleEdgeCounter = 0;
-
-            // The number of vertices in the current vertex group.
-            unsigned int vertexCount = vertexCountArray [groupedVerticesIndex];
-
-            // Determine the number of edges and iterate over it.
-            unsigned int numEdges = ( vertexCount - 3 ) * 3 + 3;
-            for ( unsigned int edgeIndex=0; edgeIndex<numEdges; ++edgeIndex )
-            {
-                // Increment the current triangle edge counter, so we know if we have the full triangle.
-                ++triangleEdgeCounter;
-
-                // Get the start edge index
-                if ( triangleEdgeCounter > 1 )
-                    edgeStartVertexIdx = positionIndices[positionIndex];
-                else edgeStartVertexIdx = positionIndices[initialPositionIndex];
-
-                // With the third edge of a triangle, we have to go back to the trifans root.
-                if ( triangleEdgeCounter < 3 )
-                    edgeEndVertexIdx = positionIndices[++positionIndex];
-                else edgeEndVertexIdx = positionIndices[initialPositionIndex];
-
-                COLLADAFW::Edge edge ( edgeStartVertexIdx, edgeEndVertexIdx );
-
-                // Appends the data of an edge to the edgeIndices list,
-                // if it is not already in the list.
-                appendEdge ( edge, edgeIndices, edgeIndicesMap );
-
-                // Reset the edge counter, if we have all three edges of a triangle.
-                if ( triangleEdgeCounter == 3 )
-                {
-                    triangleEdgeCounter = 0;
-                    --positionIndex;
-                }
-            }
-
-            // Increment the initial trifan position index for the next trifan object.
-            initialPositionIndex += vertexCount;
-            positionIndex += 2;
-        }
-    }
-
-    //-----------------------------
-    void GeometryImporter::appendTristripsEdgeIndices (
-        const COLLADAFW::MeshPrimitive* primitiveElement,
-        EdgeList& edgeIndices,
-        EdgeMap& edgeIndicesMap )
-    {
-        // Get the position indices.
-        const COLLADAFW::UIntValuesArray& positionIndices = primitiveElement->getPositionIndices ();
-
-        // The points of an edge
-        int edgeStartVertexIdx=0, edgeEndVertexIdx=0;
-
-        // The current index in the positions list.
-        size_t initialPositionIndex=0;
-        size_t positionIndex=0;
-
-        // Iterate over the grouped vertices and get the edges for every group.
-        COLLADAFW::Tristrips* trifans = (COLLADAFW::Tristrips*) primitiveElement;
-        COLLADAFW::Tristrips::VertexCountArray& vertexCountArray =
-            trifans->getGroupedVerticesVertexCountArray ();
-        size_t groupedVertexElementsCount = vertexCountArray.getCount ();
-        for ( size_t groupedVerticesIndex=0; groupedVerticesIndex<groupedVertexElementsCount; ++groupedVerticesIndex )
-        {
-            // A trifan has always triangles, which have 3 edges
-            size_t triangleEdgeCounter = 0;
-
-            // The number of vertices in the current vertex group.
-            unsigned int vertexCount = vertexCountArray [groupedVerticesIndex];
-
-            // Determine the number of edges and iterate over it.
-            unsigned int numEdges = ( vertexCount - 3 ) * 3 + 3;
-            for ( unsigned int edgeIndex=0; edgeIndex<numEdges; ++edgeIndex )
-            {
-                // Increment the current triangle edge counter, so we know if we have the full triangle.
-                ++triangleEdgeCounter;
-
-                // Get the start edge index
-                edgeStartVertexIdx = positionIndices[positionIndex];
-
-                // With the third edge of a triangle, we have to go back to the trifans root.
-                if ( triangleEdgeCounter < 3 )
-                    edgeEndVertexIdx = positionIndices[++positionIndex];
-                else edgeEndVertexIdx = positionIndices[initialPositionIndex];
-
-                COLLADAFW::Edge edge ( edgeStartVertexIdx, edgeEndVertexIdx );
-
-                // Appends the data of an edge to the edgeIndices list,
-                // if it is not already in the list.
-                appendEdge ( edge, edgeIndices, edgeIndicesMap );
-
-                // Reset the edge counter, if we have all three edges of a triangle.
-                if ( triangleEdgeCounter == 3 )
-                {
-                    triangleEdgeCounter = 0;
-                    --positionIndex;
-                    initialPositionIndex = positionIndex;
-                }
-            }
-
-            // Increment the initial tristrip position index for the next tristrip object.
-            positionIndex += 2;
-            initialPositionIndex = positionIndex;
-        }
-    }
-
     // --------------------------------------------
     const std::vector<GeometryImporter::GeometryShadingEngine>* GeometryImporter::findGeomtryShadingEngines ( 
         const COLLADAFW::UniqueId& geometryId )
@@ -3059,7 +2819,7 @@ namespace DAE2MA
         // connected to the inMesh attribute of  the current mesh object.
 
         // Get a pointer to the maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Store the previous groupId and groupParts objects.
         const MayaDM::GroupParts* previousGroupParts = 0;
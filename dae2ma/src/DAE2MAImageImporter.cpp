@@ -106,7 +106,7 @@ namespace DAE2MA
         imageName = generateUniqueDependNodeName ( imageName );
 
         // Get the maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Get the image uri
         const COLLADABU::URI& imageURI = image->getImageURI ();
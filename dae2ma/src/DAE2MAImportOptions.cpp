@@ -24,6 +24,7 @@ namespace DAE2MA
     bool ImportOptions::mImportUpAxis = true;
     bool ImportOptions::mImportUnits = true;
     bool ImportOptions::mImportNormals = true;
+    bool ImportOptions::mSimplifyAnimations = false;
     
     
     /** Parse the options String */
@@ -33,6 +34,7 @@ namespace DAE2MA
         mImportUpAxis = true;
         mImportUnits = true;
         mImportNormals = true;
+        mSimplifyAnimations = false;
 
         mHasError = false;
 
@@ -64,6 +66,7 @@ namespace DAE2MA
                 if ( optionName == "importUpAxis" ) mImportUpAxis = value;
                 else if ( optionName == "importUnits" ) mImportUnits = value;
                 else if ( optionName == "importNormals" ) mImportNormals = value;
+                else if ( optionName == "simplifyAnimations" ) mSimplifyAnimations = value;
             }
         }
     }
@@ -89,6 +92,11 @@ namespace DAE2MA
         return mImportNormals;
     }
 
+    bool ImportOptions::simplifyAnimations()
+    {
+        return mSimplifyAnimations;
+    }
+
     void ImportOptions::setErrorFlag()
     {
         mHasError = true;
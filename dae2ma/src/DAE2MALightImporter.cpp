@@ -67,7 +67,7 @@ namespace DAE2MA
     void LightImporter::initialiseDefaultLightObjects ()
     {
         // Get a reference to the current maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Create the default light linker
         mDefaultLightLinker.setFile ( file );
@@ -129,7 +129,7 @@ namespace DAE2MA
                 String lightNodePath = mayaLightNode->getNodePath ();
 
                 // parent -shape -noConnections -relative -addObject "|pCube1|pCubeShape1" "pCube2";
-                FILE* file = getDocumentImporter ()->getFile ();
+                MayaDM::Writer* file = getDocumentImporter ()->getFile ();
                 MayaDM::parentShape ( file, lightNodePath, transformNodePath, false, true, true, true );
             }
 
@@ -158,7 +158,7 @@ namespace DAE2MA
         MayaNode* mayaLightNode = new MayaNode ( lightId, lightName, mayaTransformNode );
         mMayaLightNodesMap [ lightId ] = mayaLightNode;
 
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         MayaDM::Light* mayaLight = 0;
         COLLADAFW::Light::LightType lightType = light->getLightType ();
@@ -301,7 +301,7 @@ namespace DAE2MA
     void LightImporter::connectLightLinkers ()
     {
         // The maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         size_t lightLinkerLinkIndex = 0;
 
@@ -366,7 +366,7 @@ namespace DAE2MA
     void LightImporter::connectLightObjects ()
     {
         // The maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         size_t lightIndex = 0;
         size_t lightSetIndex = 0;
@@ -200,7 +200,7 @@ namespace DAE2MA
                         if ( uvChooser == 0 ) 
                         {
                             // Get the maya ascii file.
-                            FILE* file = getDocumentImporter ()->getFile ();
+                            MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
                             // Generate a valid unique name
                             String uvChooserName = UV_CHOOSER_NAME;
@@ -348,7 +348,7 @@ namespace DAE2MA
     void MaterialImporter::connectShadingEngines ()
     {
         // Get the current maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         ShadingDataMap::iterator shaderDataIter = mShaderDataMap.begin();
         while ( shaderDataIter != mShaderDataMap.end () )
@@ -403,7 +403,7 @@ namespace DAE2MA
         // ".instObjGroups[x].objectGroups"; // for every mesh primitive
 
         // Get the current maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Get a pointer to the geometry importer.
         GeometryImporter* geometryImporter = getDocumentImporter ()->getGeometryImporter ();
@@ -494,7 +494,7 @@ namespace DAE2MA
         //          connectAttr (...)
 
         // Get the current maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Get a pointer to the geometry importer.
         GeometryImporter* geometryImporter = getDocumentImporter ()->getGeometryImporter ();
@@ -693,7 +693,7 @@ namespace DAE2MA
     void MaterialImporter::connectDefaultShaderList ()
     {
         // Get the current maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         EffectImporter* effectImporter = getDocumentImporter ()->getEffectImporter ();
         const EffectImporter::UniqueIdMayaEffectsMap& effectMap = effectImporter->getMaterialIdMayaEffectMap ();
@@ -725,7 +725,7 @@ namespace DAE2MA
     void MaterialImporter::connectUVChooser ()
     {
         // Get the current maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Get a pointer to the geometry importer.
         GeometryImporter* geometryImporter = getDocumentImporter ()->getGeometryImporter ();
@@ -0,0 +1,57 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of DAE2MA.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "DAE2MAStableHeaders.h"
+#include "DAE2MAOrderedWriters.h"
+
+#include "CommonMemoryBufferFlusher.h"
+
+
+namespace DAE2MA
+{
+
+    //------------------------------
+    OrderedWriters::OrderedWriters ( size_t count )
+    {
+        mFlushers.reserve ( count );
+        mWriters.reserve ( count );
+        for ( size_t i=0; i<count; ++i )
+        {
+            Common::MemoryBufferFlusher* flusher = new Common::MemoryBufferFlusher ( BUFFER_SIZE );
+            mFlushers.push_back ( flusher );
+            mWriters.push_back ( new MayaDM::Writer ( flusher, BUFFER_SIZE ) );
+        }
+    }
+
+    //------------------------------
+    OrderedWriters::~OrderedWriters ()
+    {
+        for ( size_t i=0; i<mWriters.size (); ++i )
+        {
+            delete mWriters [i];
+            delete mFlushers [i];
+        }
+    }
+
+    //------------------------------
+    void OrderedWriters::appendTo ( MayaDM::Writer* file )
+    {
+        for ( size_t i=0; i<mWriters.size (); ++i )
+        {
+            mWriters [i]->flushBuffer ();
+
+            Common::MemoryBufferFlusher* flusher = mFlushers [i];
+            if ( flusher->getDataSize () > 0 )
+                file->copyToBuffer ( flusher->getData (), flusher->getDataSize () );
+            flusher->clear ();
+        }
+    }
+
+} // namespace DAE2MA
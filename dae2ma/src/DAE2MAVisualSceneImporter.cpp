@@ -133,7 +133,7 @@ namespace DAE2MA
         MayaDM::Transform* transformNode = createMayaDMNode ( node, nodeName, parentNodePath );
 
         // Get the current maya ascii file to write the data.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Add the original id attribute.
         String colladaId = node->getOriginalId ();
@@ -342,7 +342,7 @@ namespace DAE2MA
         const String& parentNodeName )
     {
         // Get the current maya ascii file to write the data.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Create a transform node of the specific type.
         MayaDM::Transform* transformNode;
@@ -1515,7 +1515,7 @@ namespace DAE2MA
     void VisualSceneImporter::writeNodeInstances ()
     {
         // A pointer to the current maya ascii file.
-        FILE* file = getDocumentImporter ()->getFile ();
+        MayaDM::Writer* file = getDocumentImporter ()->getFile ();
 
         // Go through the transform instances and copy / move the instantiated nodes.
         UniqueIdUniqueIdsMap::iterator it = mTransformInstancesMap.begin ();
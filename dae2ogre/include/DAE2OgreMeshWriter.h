@@ -22,6 +22,7 @@ http://www.opensource.org/licenses/mit-license.php
 #include "COLLADAFWMeshVertexData.h"
 
 #include <map>
+#include <vector>
 
 namespace COLLADAFW
 {
@@ -45,17 +46,49 @@ namespace DAE2Ogre
 			bool operator<(const Tuple& rhs) const;
 		};
 
-		typedef COLLADAFW::ArrayPrimitiveType<float> FloatList;
-		typedef COLLADAFW::ArrayPrimitiveType<double> DoubleList;
-		typedef COLLADAFW::ArrayPrimitiveType<int> IntList;
-		typedef COLLADAFW::ArrayPrimitiveType<unsigned int> UIntList;
-		typedef std::map<Tuple, int> TupleIndexMap;
+		typedef std::map<Tuple, uint32> TupleIndexMap;
 		typedef std::vector<String> StringList;
+		typedef std::vector<Ogre::VertexElement> VertexElementList;
+
+		/** The vertex and index buffers of one submesh, i.e. of one mesh primitive of one instance of the mesh.*/
+		struct SubMesh
+		{
+			/** The mesh primitive the submesh is built from.*/
+			const COLLADAFW::MeshPrimitive* meshPrimitive;
+
+			/** The world matrix of the instance the submesh is built for.*/
+			const COLLADABU::Math::Matrix4* worldMatrix;
+
+			/** The elements of one vertex, in the order they are interleaved in vertices.*/
+			VertexElementList vertexElements;
+
+			/** The size of one vertex in bytes.*/
+			size_t vertexSize;
+
+			/** The number of vertices.*/
+			size_t vertexCount;
+
+			/** The interleaved vertices, as described by vertexElements.*/
+			std::vector<float> vertices;
+
+			/** The vertex indices.*/
+			std::vector<uint32> indices;
+
+			/** The bounding box of the vertex positions. Only valid if vertexCount is not zero.*/
+			float boundsMin[ 3 ];
+			float boundsMax[ 3 ];
+		};
+
+		typedef std::vector<SubMesh> SubMeshList;
+
+		/** The maximum number of submeshes, that are built in parallel before they are written.*/
+		static const size_t PARALLEL_SUBMESHES_COUNT = 64;
+
+		/** The size of the buffer, the mesh file is written through.*/
+		static const size_t BUFFER_SIZE = 64*1024;
 
 	private:
 		const COLLADAFW::Mesh* mMesh;
-		TupleIndexMap mTupleMap;
-		int mNextTupleIndex;
 		size_t mMeshSize;
 		size_t mSubmeshCount;
 		size_t mSubmeshNameTableSize;
@@ -72,18 +105,6 @@ namespace DAE2Ogre
 		const COLLADAFW::MeshVertexData& mMeshUVCoordinates;
 		const COLLADAFW::MeshVertexData& mMeshColors;
 
-		DoubleList mOgrPositions;
-		DoubleList mOgreNormals;
-		DoubleList mOgreUVCoordinates;
-		DoubleList mOgreColors;
-		UIntList mOgreIndices;
-
-		bool mHasNormals;
-		bool mHasUVCoords;
-
-		COLLADABU::Math::Matrix3 mCurrentRotationMatrix;
-		COLLADABU::Math::Vector3 mCurrentTranslationVector;
-	
 		StringList mSubMeshNames;
 
 	public:
@@ -104,18 +125,29 @@ namespace DAE2Ogre
         /** Disable default assignment operator. */
 		const MeshWriter& operator= ( const MeshWriter& pre );
 	
-		void writeSubMesh(COLLADAFW::MeshPrimitive* meshPrimitive, const COLLADABU::Math::Matrix4& matrix);
-
-		void addTupleIndex( const Tuple& tuple);
-
-		void writeGeometry( );
-		size_t getVertexSizeInByte() const;
-		void writeVertexElement( unsigned short source, size_t offset, Ogre::VertexElementType type, Ogre::VertexElementSemantic semantic, unsigned short index );
-		void writeVertexBuffer( );
-		size_t calcSubMeshSize( int numIndices, const String& submeshName );
+		/** Builds the vertex and index buffers and the bounds of @a subMesh from its mesh primitive and world
+		matrix. Does not modify the writer, i.e. several submeshes can be built at the same time.*/
+		void buildSubMesh( SubMesh& subMesh ) const;
+
+		/** Appends the vertex @a tuple refers to, transformed by @a rotation and @a translation, to the vertices
+		of @a subMesh.*/
+		void appendVertex( const Tuple& tuple,
+			               const COLLADABU::Math::Matrix3& rotation,
+			               const COLLADABU::Math::Vector3& translation,
+			               SubMesh& subMesh ) const;
+
+		/** Calculates the bounding box of the vertex positions of @a subMesh.*/
+		static void calculateSubMeshBounds( SubMesh& subMesh );
+
+		void writeSubMesh( const SubMesh& subMesh );
+
+		void writeGeometry( const SubMesh& subMesh );
+		void writeVertexElement( const Ogre::VertexElement& vertexElement );
+		void writeVertexBuffer( const SubMesh& subMesh );
+		size_t calcSubMeshSize( const SubMesh& subMesh, const String& submeshName );
 		void calcMeshSize( );
 		void writeSubMeshOperation( COLLADAFW::MeshPrimitive::PrimitiveType primitiveType );
-		void calculateMeshBounds();
+		void addToMeshBounds( const SubMesh& subMesh );
 		void writeSubMeshNameTableEntry( const String& name, uint16 index );
 		void writeBoundsInfo( );
 		void writeSubMeshNameTable( );
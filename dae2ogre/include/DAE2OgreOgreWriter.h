@@ -84,11 +84,17 @@ namespace DAE2Ogre
 		UniqueIdFWMaterialMap mUniqueIdFWMaterialMap;
 		UniqueIdFWImageMap mUniqueIdFWImageMap;
 		UniqueIdFWEffectMap mUniqueIdFWEffectMap;
+
+		/** If true, the triangles and vertices of the meshes are reordered for the vertex cache.*/
+		bool mOptimizeMeshes;
 	
 	public:
 		OgreWriter( const COLLADABU::URI& inputFile, const COLLADABU::URI& outputFile );
 		virtual ~OgreWriter();
 
+		/** If true, the triangles and vertices of the meshes are reordered for the vertex cache.*/
+		void setOptimizeMeshes( bool optimizeMeshes ) { mOptimizeMeshes = optimizeMeshes; }
+
 	public:
 		static void reportError(const String& method, const String& message, Severity severity);
 
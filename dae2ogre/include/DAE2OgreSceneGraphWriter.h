@@ -16,6 +16,8 @@ http://www.opensource.org/licenses/mit-license.php
 
 #include "DAE2OgreOgreWriter.h"
 
+#include "COLLADAFWTransformationCache.h"
+
 #include "Math/COLLADABUMathMatrix4.h"
 
 
@@ -29,23 +31,10 @@ namespace DAE2Ogre
 
 	class SceneGraphWriter : public BaseWriter 
 	{
-	private:
-		struct NodeInfo
-		{
-			NodeInfo( COLLADABU::Math::Matrix4 _worldTransformation)
-				: worldTransformation(_worldTransformation){}
-			COLLADABU::Math::Matrix4 worldTransformation;
-		};
-
-		typedef std::stack<NodeInfo> NodeInfoStack;
-
-		typedef std::map<COLLADAFW::UniqueId, COLLADAFW::Node*> UniqueIdNodeMap;
-
 	private:
 		const COLLADAFW::VisualScene& mVisualScene;
 		const OgreWriter::LibraryNodesList& mLibraryNodesList;
-		NodeInfoStack mNodeInfoStack;
-		UniqueIdNodeMap mUniqueIdNodeMap;
+		COLLADAFW::TransformationCache mTransformationCache;
 	
 	public:
 
@@ -64,20 +53,13 @@ namespace DAE2Ogre
         /** Disable default assignment operator. */
 		const SceneGraphWriter& operator= ( const SceneGraphWriter& pre );
 
-		void createUniqueIdNodeMap( COLLADAFW::Node* node );
-
-		void createUniqueIdNodeMap( const COLLADAFW::NodePointerArray& nodes );
-
-		void createUniqueIdNodeMap();
-
-		bool writeNodes(  const COLLADAFW::NodePointerArray& nodesToWriter);
-
-		bool writeNode(  const COLLADAFW::Node* nodeToWriter);
+		/** Stores the instance geometries of @a entry and its descendants in the order the nodes have always
+		been written: the child nodes, the node itself and then the instantiated nodes. @a subtreeEnds contains
+		the index after the last descendant of each entry.*/
+		void writeEntry( size_t entry, const std::vector<size_t>& subtreeEnds );
 
 		void storeInstanceGeometries( const COLLADAFW::InstanceGeometryPointerArray& instanceGeometries, 
 			const COLLADABU::Math::Matrix4& worldMatrix );
-	
-		void writeInstanceNodes( const COLLADAFW::InstanceNodePointerArray& instanceNodes);
 
 
 	};
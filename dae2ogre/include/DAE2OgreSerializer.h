@@ -31,7 +31,8 @@ Torus Knot Software Ltd.
 #define __DAE2OGRE_OGRESERIALIZER_H__
 
 #include "DAE2OgrePrerequisites.h"
-#include <cstdio>
+
+#include "CommonBuffer.h"
 
 namespace DAE2Ogre
 {
@@ -40,7 +41,8 @@ namespace DAE2Ogre
     @remarks
         This class provides a number of useful methods for exporting / importing data
         from stream-oriented binary files (e.g. .mesh and .skeleton).
-    @todo replace fputs, fopen etc with std::ifstream functions.
+        The data is written through a Common::Buffer, which has to be set by derived classes
+        before anything is written.
     */
 
     class OgreSerializer
@@ -70,7 +72,7 @@ namespace DAE2Ogre
     protected:
 
         uint32 mCurrentstreamLen;
-        FILE* mpfFile;
+        Common::Buffer* mBuffer;
         std::string mVersion;
         bool mFlipEndian; // default to native endian, derive from header
 
@@ -87,9 +89,13 @@ namespace DAE2Ogre
         void writeString( const std::string& string );
         void writeData( const void* const buf, size_t size, size_t count );
 
-		fpos_t getPos();
+        /** Remembers the current position, so that data written from here on can be overwritten
+        later using jumpToPosition().*/
+        Common::IBufferFlusher::MarkId markPosition();
 
-		bool setPos(fpos_t pos);
+        /** Continues writing at the position returned by markPosition(), overwriting the data
+        written there before. Pass Common::IBufferFlusher::END_OF_STREAM to continue at the end.*/
+        bool jumpToPosition( Common::IBufferFlusher::MarkId position );
 
         virtual void flipToLittleEndian( void* pData, size_t size, size_t count = 1 );
         virtual void flipFromLittleEndian( void* pData, size_t size, size_t count = 1 );
@@ -23,6 +23,10 @@ http://www.opensource.org/licenses/mit-license.php
 
 #include "COLLADABUPlatform.h"
 
+#include "CommonFWriteBufferFlusher.h"
+
+#include <algorithm>
+
 #ifdef COLLADABU_OS_WIN
 #	include <windows.h>
 #endif
@@ -31,26 +35,36 @@ namespace DAE2Ogre
 {
 	String material("BaseWhite");
 
+	namespace
+	{
+		/** Returns the three values starting at @a index * 3 of @a vertexData.*/
+		COLLADABU::Math::Vector3 getVector3( const COLLADAFW::MeshVertexData& vertexData, unsigned int index )
+		{
+			if ( vertexData.getType() == COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE )
+			{
+				const double* values = vertexData.getDoubleValues()->getData() + 3*index;
+				return COLLADABU::Math::Vector3(values[0], values[1], values[2]);
+			}
+			else
+			{
+				const float* values = vertexData.getFloatValues()->getData() + 3*index;
+				return COLLADABU::Math::Vector3(values[0], values[1], values[2]);
+			}
+		}
+	}
+
     //------------------------------
 	MeshWriter::MeshWriter( OgreWriter* ogreWriter, const COLLADAFW::Mesh* mesh )
 		: BaseWriter(ogreWriter)
 		, mMesh(mesh)
-		, mNextTupleIndex(0)
 		, mMeshSize(0)
 		, mSubmeshCount(0)
 		, mSubmeshNameTableSize(STREAM_OVERHEAD_SIZE)
 		, mMeshBoundsSet(false)
-		, mHasNormals( false )
-		, mHasUVCoords( false )
 		, mMeshPositions( mesh->getPositions() )
 		, mMeshNormals( mesh->getNormals() )
 		, mMeshUVCoordinates( mesh->getUVCoords() )
 		, mMeshColors( mesh->getColors() )
-		, mOgrPositions(FloatList::RELEASE_MEMORY)
-	    , mOgreNormals(FloatList::RELEASE_MEMORY)
-	    , mOgreUVCoordinates(FloatList::RELEASE_MEMORY)
-	    , mOgreColors(FloatList::RELEASE_MEMORY)
-	    , mOgreIndices(IntList::RELEASE_MEMORY)
 	{
 		 mVersion = "[MeshSerializer_v1.30]";
 		 calcMeshSize();
@@ -103,21 +117,21 @@ namespace DAE2Ogre
 	{
 		determineEndianness( ENDIAN_NATIVE );
 
-		const String path = getOutputFile().toNativePath();
-		mpfFile = fopen( path.c_str(), "wb" );
-
-		if ( !mpfFile )
+		Common::FWriteBufferFlusher bufferFlusher( getOutputFile().toNativePath().c_str() );
+		if ( bufferFlusher.getError() != 0 )
 		{
 			return false;
 		}
 
+		Common::Buffer buffer( BUFFER_SIZE, &bufferFlusher );
+		mBuffer = &buffer;
 
 		// Header
 		writeFileHeader();
 
 		// Since we do not know the mesh size at this point, we write 0 and overwirte the size in the file 
 		// later
-		fpos_t filePos = getPos();
+		Common::IBufferFlusher::MarkId meshHeaderPosition = markPosition();
 		writeChunkHeader( Ogre::M_MESH, 0 );
 
 		// bool skeletallyAnimated
@@ -126,7 +140,10 @@ namespace DAE2Ogre
 		writeBools( &skelAnim, 1 );
 		// Decide on endian mode
 
+		// one submesh per mesh primitive and instance
+		SubMeshList subMeshes;
 		const COLLADAFW::UniqueId& meshUniqueId = mMesh->getUniqueId();
+		const COLLADAFW::MeshPrimitiveArray& meshPrimitives = mMesh->getMeshPrimitives();
 		const OgreWriter::GeometryUniqueIdInstanceGeometryInfoMap& instanceGeometryMap = getGeometryUniqueIdInstanceGeometryInfoMap();
 		OgreWriter::GeometryUniqueIdInstanceGeometryInfoMap::const_iterator lowerBound = instanceGeometryMap.lower_bound(meshUniqueId);
 		OgreWriter::GeometryUniqueIdInstanceGeometryInfoMap::const_iterator upperBound = instanceGeometryMap.upper_bound(meshUniqueId);
@@ -134,17 +151,36 @@ namespace DAE2Ogre
 		for ( OgreWriter::GeometryUniqueIdInstanceGeometryInfoMap::const_iterator it = lowerBound; it != upperBound; ++it)
 		{
 			const OgreWriter::InstanceGeometryInfo& instanceGeometryInfo = it->second;
-			const COLLADABU::Math::Matrix4& worldMatrix = instanceGeometryInfo.worldMatrix;
-			const COLLADAFW::MeshPrimitiveArray& meshPrimitives = mMesh->getMeshPrimitives();
-			const COLLADAFW::InstanceGeometry* instanceGeometry = instanceGeometryInfo.fwInstanceGeometry;
-
-			worldMatrix.extract3x3Matrix(mCurrentRotationMatrix );
-			mCurrentTranslationVector.set(worldMatrix[0][3], worldMatrix[1][3], worldMatrix[2][3]);
-			
 			for ( size_t i = 0, count = meshPrimitives.getCount(); i < count; ++i )
 			{
-				COLLADAFW::MeshPrimitive* meshPrimitive = meshPrimitives[i];
-				writeSubMesh(meshPrimitive, worldMatrix);
+				SubMesh subMesh;
+				subMesh.meshPrimitive = meshPrimitives[i];
+				subMesh.worldMatrix = &instanceGeometryInfo.worldMatrix;
+				subMeshes.push_back( subMesh );
+			}
+		}
+
+		// the submeshes are independent of each other and built in parallel, a batch at a time, to limit the 
+		// memory needed for the vertex buffers. They are written in their original order.
+		for ( size_t batchStart = 0; batchStart < subMeshes.size(); batchStart += PARALLEL_SUBMESHES_COUNT )
+		{
+			int batchEnd = (int)std::min( batchStart + PARALLEL_SUBMESHES_COUNT, subMeshes.size() );
+
+#pragma omp parallel for schedule(dynamic)
+			for ( int i = (int)batchStart; i < batchEnd; ++i )
+			{
+				buildSubMesh( subMeshes[i] );
+			}
+
+			for ( int i = (int)batchStart; i < batchEnd; ++i )
+			{
+				SubMesh& subMesh = subMeshes[i];
+				writeSubMesh( subMesh );
+				addToMeshBounds( subMesh );
+
+				// release the buffers of the written submesh
+				std::vector<float>().swap( subMesh.vertices );
+				std::vector<uint32>().swap( subMesh.indices );
 			}
 		}
 
@@ -156,12 +192,12 @@ namespace DAE2Ogre
 
 		mMeshSize += mSubmeshNameTableSize;
 
-
-		setPos( filePos );
+		bool success = jumpToPosition( meshHeaderPosition );
 		writeChunkHeader( Ogre::M_MESH, mMeshSize );
-		
-		fclose( mpfFile );
-		return true;
+		success = jumpToPosition( Common::IBufferFlusher::END_OF_STREAM ) && success;
+
+		mBuffer = 0;
+		return success;
 	}
 
 	//-----------------------------------------------------------------------
@@ -225,150 +261,160 @@ namespace DAE2Ogre
 	}
 
 	//------------------------------
-	void MeshWriter::addTupleIndex( const Tuple& tuple )
+	void MeshWriter::buildSubMesh( SubMesh& subMesh ) const
 	{
-		TupleIndexMap::const_iterator it = mTupleMap.find(tuple);
-		if ( it == mTupleMap.end() )
-		{
-			mOgreIndices.append( mTupleMap[tuple] = mNextTupleIndex++ );
-
-			if ( mMeshPositions.getType() == COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE )
-			{
-				const double* positionsArray = mMeshPositions.getDoubleValues()->getData();
-				positionsArray += 3*tuple.positionIndex;
-				COLLADABU::Math::Vector3 position(positionsArray[0], positionsArray[1], positionsArray[2]);
-				position = mCurrentRotationMatrix * position + mCurrentTranslationVector;
-				mOgrPositions.append((float)position.x);
-				mOgrPositions.append((float)position.y);
-				mOgrPositions.append((float)position.z);
-			}
-			else
-			{
-				const float* positionsArray = mMeshPositions.getFloatValues()->getData();
-				positionsArray += 3*tuple.positionIndex;
-				COLLADABU::Math::Vector3 position(positionsArray[0], positionsArray[1], positionsArray[2]);
-				position = mCurrentRotationMatrix * position + mCurrentTranslationVector;
-				mOgrPositions.append((float)position.x);
-				mOgrPositions.append((float)position.y);
-				mOgrPositions.append((float)position.z);
-			}
-
-			if ( mHasNormals )
-			{
-				if ( mMeshNormals.getType() == COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE )
-				{
-					const double* normalsArray = mMeshNormals.getDoubleValues()->getData();
-					normalsArray += 3*tuple.normalIndex;
-					COLLADABU::Math::Vector3 normal(normalsArray[0], normalsArray[1], normalsArray[2]);
-					normal = mCurrentRotationMatrix * normal;
-					normal.normalise();
-					mOgreNormals.append((float)normal.x);
-					mOgreNormals.append((float)normal.y);
-					mOgreNormals.append((float)normal.z);
-				}
-				else
-				{
-					const float* normalsArray = mMeshNormals.getFloatValues()->getData();
-					normalsArray += 3*tuple.normalIndex;
-					COLLADABU::Math::Vector3 normal(normalsArray[0], normalsArray[1], normalsArray[2]);
-					normal = mCurrentRotationMatrix * normal;
-					normal.normalise();
-					mOgreNormals.append((float)normal.x);
-					mOgreNormals.append((float)normal.y);
-					mOgreNormals.append((float)normal.z);
-				}
-			}
-
-			if ( mHasUVCoords )
-			{
-				if ( mMeshUVCoordinates.getType() == COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE )
-				{
-					const double* uVCoordinateArray = mMeshUVCoordinates.getDoubleValues()->getData();
-					uVCoordinateArray += mMeshUVCoordinates.getStride(0)*tuple.textureIndex;
-					mOgreUVCoordinates.append((float)uVCoordinateArray[0]);
-					mOgreUVCoordinates.append((float)uVCoordinateArray[1]);
-				}
-				else
-				{
-					const float* uVCoordinateArray = mMeshUVCoordinates.getFloatValues()->getData();
-					uVCoordinateArray += mMeshUVCoordinates.getStride(0)*tuple.textureIndex;
-					mOgreUVCoordinates.append((float)uVCoordinateArray[0]);
-					mOgreUVCoordinates.append((float)uVCoordinateArray[1]);
-				}
-			}
-
-		}
-		else
-		{
-			mOgreIndices.append(it->second);
-		}
-	}
-
-	//------------------------------
-	void MeshWriter::writeSubMesh( COLLADAFW::MeshPrimitive* meshPrimitive, const COLLADABU::Math::Matrix4& matrix )
-	{
-		mSubmeshCount++;
-		String subMeshName = "subMesh" + COLLADABU::Utils::toString(mSubmeshCount);
-		mSubMeshNames.push_back( subMeshName );		
-
-		int numIndices = 0;
+		const COLLADAFW::MeshPrimitive* meshPrimitive = subMesh.meshPrimitive;
 
 		const COLLADAFW::UIntValuesArray& positionIndices =  meshPrimitive->getPositionIndices();
 		size_t positionIndicesCount  = positionIndices.getCount();
 
 		const COLLADAFW::UIntValuesArray& normalIndices =  meshPrimitive->getNormalIndices();
 		size_t normalIndicesCount = normalIndices.getCount();
-		mHasNormals = (normalIndicesCount != 0);
+		bool hasNormals = (normalIndicesCount != 0);
 
-
-		const COLLADAFW::UIntValuesArray* uvIndices;
+		const COLLADAFW::UIntValuesArray* uvIndices = 0;
 		size_t uvIndicesCount = 0;
 		const COLLADAFW::IndexListArray& uVIndicesList = meshPrimitive->getUVCoordIndicesArray();
 		if ( !uVIndicesList.empty() )
 		{
 			uvIndices = &uVIndicesList[0]->getIndices();
 			uvIndicesCount = uvIndices->getCount();
-			mHasUVCoords = (uvIndicesCount != 0);
 		}
-		else
+		bool hasUVCoords = (uvIndicesCount != 0);
+
+		assert( !hasNormals || (positionIndicesCount == normalIndicesCount));
+		assert( !hasUVCoords || (positionIndicesCount == uvIndicesCount));
+
+		// vertex layout: position and normal interleaved in one buffer
+		size_t offset = 0;
+		subMesh.vertexElements.clear();
+		subMesh.vertexElements.push_back( Ogre::VertexElement( 0, offset, Ogre::VET_FLOAT3, Ogre::VES_POSITION, 0 ) );
+		offset += Ogre::VertexElement::getTypeSize( Ogre::VET_FLOAT3 );
+
+		if ( hasNormals )
 		{
-			mHasUVCoords = false;
+			subMesh.vertexElements.push_back( Ogre::VertexElement( 0, offset, Ogre::VET_FLOAT3, Ogre::VES_NORMAL, 0 ) );
+			offset += Ogre::VertexElement::getTypeSize( Ogre::VET_FLOAT3 );
 		}
 
+		// todo we don not support uvs yet
 
-		assert( !mHasNormals || (positionIndicesCount == normalIndicesCount));
-		assert( !mHasUVCoords || (positionIndicesCount == uvIndicesCount));
+		subMesh.vertexSize = offset;
+		subMesh.vertexCount = 0;
 
-		switch (meshPrimitive->getPrimitiveType())
+		if ( meshPrimitive->getPrimitiveType() != COLLADAFW::MeshPrimitive::TRIANGLES )
 		{
-		case COLLADAFW::MeshPrimitive::TRIANGLES:
+			return;
+		}
+
+		COLLADABU::Math::Matrix3 rotation;
+		subMesh.worldMatrix->extract3x3Matrix( rotation );
+		const COLLADABU::Math::Matrix4& worldMatrix = *subMesh.worldMatrix;
+		COLLADABU::Math::Vector3 translation( worldMatrix[0][3], worldMatrix[1][3], worldMatrix[2][3] );
+
+		TupleIndexMap tupleMap;
+		subMesh.indices.reserve( positionIndicesCount );
+		for ( size_t j = 0; j < positionIndicesCount; ++j )
+		{
+			unsigned int normalIndex = hasNormals ? normalIndices[j] : 0;
+			unsigned int uvIndex = hasUVCoords ? (*uvIndices)[j] : 0;
+			Tuple tuple( positionIndices[j], normalIndex, uvIndex, 0);
+
+			std::pair<TupleIndexMap::iterator, bool> inserted = tupleMap.insert( std::make_pair( tuple, (uint32)subMesh.vertexCount ) );
+			if ( inserted.second )
 			{
-				const COLLADAFW::Triangles* triangles = (const COLLADAFW::Triangles*) meshPrimitive;
-				numIndices = (int)positionIndicesCount;
+				appendVertex( tuple, rotation, translation, subMesh );
+			}
+			subMesh.indices.push_back( inserted.first->second );
+		}
 
-				for ( int j = 0; j < numIndices; ++j )
-				{
-					unsigned int positionIndex = positionIndices[j];
+		calculateSubMeshBounds( subMesh );
+	}
 
-					unsigned int normalIndex = 0;
-					if ( mHasNormals )
-						normalIndex = normalIndices[j];
+	//------------------------------
+	void MeshWriter::appendVertex( const Tuple& tuple,
+		                           const COLLADABU::Math::Matrix3& rotation,
+		                           const COLLADABU::Math::Vector3& translation,
+		                           SubMesh& subMesh ) const
+	{
+		size_t vertexStart = subMesh.vertices.size();
+		subMesh.vertices.resize( vertexStart + subMesh.vertexSize / sizeof( float ) );
+		subMesh.vertexCount++;
 
-					unsigned int uvIndex = 0;
-					if ( mHasUVCoords )
-						uvIndex = (*uvIndices)[j];
+		for ( size_t i = 0, count = subMesh.vertexElements.size(); i < count; ++i )
+		{
+			const Ogre::VertexElement& vertexElement = subMesh.vertexElements[i];
+			float* element = &subMesh.vertices[ vertexStart + vertexElement.mOffset / sizeof( float ) ];
 
-					Tuple tuple( positionIndex, normalIndex, uvIndex, 0);
-					addTupleIndex(tuple);
+			switch ( vertexElement.mSemantic )
+			{
+			case Ogre::VES_POSITION:
+				{
+					COLLADABU::Math::Vector3 position = rotation * getVector3( mMeshPositions, tuple.positionIndex ) + translation;
+					element[0] = (float)position.x;
+					element[1] = (float)position.y;
+					element[2] = (float)position.z;
+				}
+				break;
+			case Ogre::VES_NORMAL:
+				{
+					COLLADABU::Math::Vector3 normal = rotation * getVector3( mMeshNormals, tuple.normalIndex );
+					normal.normalise();
+					element[0] = (float)normal.x;
+					element[1] = (float)normal.y;
+					element[2] = (float)normal.z;
 				}
+				break;
+			default:
+				break;
 			}
-			break;
-		default:
-			break;
 		}
+	}
+
+	//------------------------------
+	void MeshWriter::calculateSubMeshBounds( SubMesh& subMesh )
+	{
+		if ( subMesh.vertexCount == 0 )
+		{
+			return;
+		}
+
+		// the position is the first element of each vertex
+		size_t stride = subMesh.vertexSize / sizeof( float );
+		const float* position = &subMesh.vertices[0];
+		const float* verticesEnd = position + subMesh.vertexCount * stride;
+
+		float boundsMin[ 3 ] = { position[0], position[1], position[2] };
+		float boundsMax[ 3 ] = { position[0], position[1], position[2] };
+
+		// branch free, so that the compiler can use SIMD min and max instructions
+		for ( ; position != verticesEnd; position += stride )
+		{
+			for ( int i = 0; i < 3; ++i )
+			{
+				boundsMin[i] = std::min( boundsMin[i], position[i] );
+				boundsMax[i] = std::max( boundsMax[i], position[i] );
+			}
+		}
+
+		for ( int i = 0; i < 3; ++i )
+		{
+			subMesh.boundsMin[i] = boundsMin[i];
+			subMesh.boundsMax[i] = boundsMax[i];
+		}
+	}
+
+	//------------------------------
+	void MeshWriter::writeSubMesh( const SubMesh& subMesh )
+	{
+		mSubmeshCount++;
+		String subMeshName = "subMesh" + COLLADABU::Utils::toString(mSubmeshCount);
+		mSubMeshNames.push_back( subMeshName );		
+
+		uint32 numIndices = (uint32)subMesh.indices.size();
 
 		// Header
-		size_t subMeshSize = calcSubMeshSize( numIndices, subMeshName );
+		size_t subMeshSize = calcSubMeshSize( subMesh, subMeshName );
 		writeChunkHeader( Ogre::M_SUBMESH, subMeshSize );
 
 		mMeshSize += subMeshSize;
@@ -382,33 +428,22 @@ namespace DAE2Ogre
 		writeBools( &useSharedVertices, 1 );
 
 		// index count (number of triangles * 3)
-		uint32 tmp = (uint32)numIndices;
-		writeInts( &tmp, 1 );
+		writeInts( &numIndices, 1 );
 
 		// bool indexes32Bit
 		bool indexes32Bit = true;
 		writeBools( &indexes32Bit, 1 );
 
 		// unsigned short* faceVertexIndices ((indexCount)
-		const uint32* pIdx32 = mOgreIndices.getData();
-		writeInts( pIdx32, numIndices );
-
-		int& vertexCount = mNextTupleIndex;
+		if ( numIndices > 0 )
+		{
+			writeInts( &subMesh.indices[0], numIndices );
+		}
 
 		// M_GEOMETRY stream (Optional: present only if useSharedVertices = false)
-		writeGeometry( );
-
-		writeSubMeshOperation( meshPrimitive->getPrimitiveType() );
+		writeGeometry( subMesh );
 
-		calculateMeshBounds();
-
-		mNextTupleIndex = 0;
-		mOgrPositions.clear();
-		mOgreNormals.clear();
-		mOgreUVCoordinates.clear();
-		mOgreColors.clear();
-		mOgreIndices.clear();
-		mTupleMap.clear();
+		writeSubMeshOperation( subMesh.meshPrimitive->getPrimitiveType() );
 	}
 
 	//-----------------------------------------------------------------------
@@ -425,29 +460,19 @@ namespace DAE2Ogre
 	}
 
 	//-----------------------------------------------------------------------
-	void MeshWriter::writeGeometry( )
+	void MeshWriter::writeGeometry( const SubMesh& subMesh )
 	{
-		int vertexCount = mNextTupleIndex;
 		// calc size
 
 		// base
 		size_t size = STREAM_OVERHEAD_SIZE + sizeof( unsigned int );
 
 		// vertex elements
-		size_t vertexElements = 1;
-		if ( mHasNormals )
-		{
-			vertexElements++;
-		}
-
-		if ( mHasUVCoords )
-		{
-			vertexElements++;
-		}
+		size_t vertexElements = subMesh.vertexElements.size();
 
 		size += ( STREAM_OVERHEAD_SIZE + vertexElements * ( STREAM_OVERHEAD_SIZE + sizeof( unsigned short ) * 5 ) );
 
-		int vertexBuferSizeInBytes = (int)getVertexSizeInByte() * vertexCount;
+		size_t vertexBuferSizeInBytes = subMesh.vertexSize * subMesh.vertexCount;
 
 		// 1 buffer
 		size += ( STREAM_OVERHEAD_SIZE * 2 ) + ( sizeof( unsigned short ) * 2 ) + vertexBuferSizeInBytes;
@@ -455,34 +480,19 @@ namespace DAE2Ogre
 		// Header
 		writeChunkHeader( Ogre::M_GEOMETRY, size );
 
-		uint32 vertexCountTmp = static_cast<uint32>( vertexCount );
+		uint32 vertexCountTmp = static_cast<uint32>( subMesh.vertexCount );
 		writeInts( &vertexCountTmp, 1 );
 
 		// Vertex declaration
 		size = STREAM_OVERHEAD_SIZE + vertexElements * ( STREAM_OVERHEAD_SIZE + sizeof( unsigned short ) * 5 );
 		writeChunkHeader( Ogre::M_GEOMETRY_VERTEX_DECLARATION, size );
 
-//		SimpleIndexedGeometry::VertexElementList::const_iterator vei, veiend;
-//		veiend = geo->getVertexElementList().end();
-		unsigned short tmp;
-		size = STREAM_OVERHEAD_SIZE + sizeof( unsigned short ) * 5;
-
-		short offset = 0;
-		writeVertexElement( 0, offset, Ogre::VET_FLOAT3, Ogre::VES_POSITION, 0 );
-		offset += (short)Ogre::VertexElement::getTypeSize( Ogre::VET_FLOAT3 );
-
-		if ( mHasNormals )
+		for ( size_t i = 0; i < vertexElements; ++i )
 		{
-			writeVertexElement( 0, offset, Ogre::VET_FLOAT3, Ogre::VES_NORMAL, 0 );
-			offset += (short)Ogre::VertexElement::getTypeSize( Ogre::VET_FLOAT3 );
+			writeVertexElement( subMesh.vertexElements[i] );
 		}
 
-		// todo we don not support uvs yet
-		if ( mHasUVCoords && false )
-		{
-			writeVertexElement( 0, offset, Ogre::VET_FLOAT2, Ogre::VES_TEXTURE_COORDINATES, 0 );
-			offset += (short)Ogre::VertexElement::getTypeSize( Ogre::VET_FLOAT2 );
-		}
+		unsigned short tmp;
 
 		// Buffers and bindings
 		size = ( STREAM_OVERHEAD_SIZE * 2 ) + ( sizeof( unsigned short ) * 2 ) + vertexBuferSizeInBytes;
@@ -495,7 +505,7 @@ namespace DAE2Ogre
 		writeShorts( &tmp, 1 );
 
 		// unsigned short vertexSize; // Per-vertex size, must agree with declaration at this index
-		tmp = static_cast<unsigned short>( getVertexSizeInByte() );
+		tmp = static_cast<unsigned short>( subMesh.vertexSize );
 
 		writeShorts( &tmp, 1 );
 
@@ -512,104 +522,48 @@ namespace DAE2Ogre
 
 		else
 		{
-			writeVertexBuffer( );
+			writeVertexBuffer( subMesh );
 		}
 	}
 
 	//-----------------------------------------------------------------------
-	void MeshWriter::writeVertexElement( unsigned short source, size_t offset, Ogre::VertexElementType type, Ogre::VertexElementSemantic semantic, unsigned short index )
+	void MeshWriter::writeVertexElement( const Ogre::VertexElement& vertexElement )
 	{
 		size_t size = STREAM_OVERHEAD_SIZE + sizeof( unsigned short ) * 5;
 		unsigned short tmp;
 		writeChunkHeader( Ogre::M_GEOMETRY_VERTEX_ELEMENT, size );
 		// unsigned short source;   // buffer bind source
-		tmp = source;
+		tmp = vertexElement.mSource;
 		writeShorts( &tmp, 1 );
 		// unsigned short type;     // VertexElementType
-		tmp = static_cast<unsigned short>( type );
+		tmp = static_cast<unsigned short>( vertexElement.mType );
 		writeShorts( &tmp, 1 );
 		// unsigned short semantic; // VertexElementSemantic
-		tmp = static_cast<unsigned short>( semantic );
+		tmp = static_cast<unsigned short>( vertexElement.mSemantic );
 		writeShorts( &tmp, 1 );
 		// unsigned short offset; // start offset in buffer in bytes
-		tmp = static_cast<unsigned short>( offset );
+		tmp = static_cast<unsigned short>( vertexElement.mOffset );
 		writeShorts( &tmp, 1 );
 		// unsigned short index; // index of the semantic (for colours and texture coords)
-		tmp = index;
+		tmp = vertexElement.mIndex;
 		writeShorts( &tmp, 1 );
 	}
 
 
 	//-----------------------------------------------------------------------
-	size_t MeshWriter::getVertexSizeInByte() const
+	void MeshWriter::writeVertexBuffer( const SubMesh& subMesh )
 	{
-		size_t vertexSize = Ogre::VertexElement::getTypeSize( Ogre::VET_FLOAT3 );
-
-		if ( mHasNormals )
-		{
-			vertexSize += Ogre::VertexElement::getTypeSize( Ogre::VET_FLOAT3 );
-		}
-
-		//if (  )
-		//	vertexSize += Ogre::VertexElement::getTypeSize( Ogre::VET_COLOUR_ARGB );
-
-		// todo support uv coordinates
-		if ( mHasUVCoords && false)
+		// the vertices are already interleaved
+		if ( !subMesh.vertices.empty() )
 		{
-			vertexSize += Ogre::VertexElement::getTypeSize( Ogre::VET_FLOAT2 );
+			writeFloats( &subMesh.vertices[0], subMesh.vertices.size() );
 		}
-
-		return vertexSize;
 	}
 
 
 	//-----------------------------------------------------------------------
-	void MeshWriter::writeVertexBuffer( )
+	size_t MeshWriter::calcSubMeshSize( const SubMesh& subMesh, const String& submeshName )
 	{
-		const double * positions = mOgrPositions.getData();
-		const double * normals = mOgreNormals.getData();
-		// no support for color yet
-		const double * colors = 0;
-		const double * uvcoordinates = mOgreUVCoordinates.getData();
-		size_t vertexCount = (size_t)mNextTupleIndex;
-
-		for ( size_t v = 0; v < vertexCount; ++v )
-		{
-			size_t count = 3;
-			size_t offset = v * count;
-			writeFloats( positions + offset, count );
-
-			if ( mHasNormals )
-			{
-				count = 3;
-				offset = v * count;
-				writeFloats( normals + offset, count );
-			}
-
-/*			if ( colors != 0 )
-			{
-				count = 4;
-				offset = v * count;
-				writeFloats( colors + offset, count );
-			}
-			*/
-
-			// todo we don not support uvs yet
-			if ( mHasUVCoords && false )
-			{
-				count = 2;
-				offset = v * count;
-				writeFloats( uvcoordinates + offset, count );
-			}
-		}
-	}
-
-
-	//-----------------------------------------------------------------------
-	size_t MeshWriter::calcSubMeshSize( int numIndices, const String& submeshName )
-	{
-		int vertexCount = mNextTupleIndex;
-
 		size_t size = STREAM_OVERHEAD_SIZE;
 
 		// Material name
@@ -633,7 +587,7 @@ namespace DAE2Ogre
 		size += sizeof( bool );
 
 		// unsigned int* faceVertexIndices
-		size += sizeof( unsigned int ) * numIndices;
+		size += sizeof( unsigned int ) * subMesh.indices.size();
 
 		// Geometry
 		{
@@ -643,7 +597,7 @@ namespace DAE2Ogre
 			size += sizeof( unsigned int );
 
 			//vertexbuffer size
-			size += getVertexSizeInByte() * vertexCount;
+			size += subMesh.vertexSize * subMesh.vertexCount;
 		}
 
 		size += 0; //calcSubMeshTextureAliasesSize(pSub);
@@ -693,42 +647,29 @@ namespace DAE2Ogre
 	}
 
 	//-----------------------------------------------------------------------
-	void MeshWriter::calculateMeshBounds()
+	void MeshWriter::addToMeshBounds( const SubMesh& subMesh )
 	{
-		size_t count = mOgrPositions.getCount();
-		for ( size_t i = 0; i < count; i += 3)
+		if ( subMesh.vertexCount == 0 )
 		{
-			double* position = &mOgrPositions[i];
-			if ( mMeshBoundsSet )
-			{
-				if ( position[0] < mMeshBoundsMin[ 0 ] )
-					mMeshBoundsMin[ 0 ] = ( float ) position[0];
-
-				if ( position[1] < mMeshBoundsMin[ 1 ] )
-					mMeshBoundsMin[ 1 ] = ( float ) position[1];
-
-				if ( position[2] < mMeshBoundsMin[ 2 ] )
-					mMeshBoundsMin[ 2 ] = ( float ) position[2];
-
-				if ( position[0] > mMeshBoundsMax[ 0 ] )
-					mMeshBoundsMax[ 0 ] = ( float ) position[0];
-
-				if ( position[1] > mMeshBoundsMax[ 1 ] )
-					mMeshBoundsMax[ 1 ] = ( float ) position[1];
+			return;
+		}
 
-				if ( position[2] > mMeshBoundsMax[ 2 ] )
-					mMeshBoundsMax[ 2 ] = ( float ) position[2];
+		if ( mMeshBoundsSet )
+		{
+			for ( int i = 0; i < 3; ++i )
+			{
+				mMeshBoundsMin[ i ] = std::min( mMeshBoundsMin[ i ], subMesh.boundsMin[ i ] );
+				mMeshBoundsMax[ i ] = std::max( mMeshBoundsMax[ i ], subMesh.boundsMax[ i ] );
 			}
-			else
+		}
+		else
+		{
+			for ( int i = 0; i < 3; ++i )
 			{
-				mMeshBoundsMin[ 0 ] = ( float ) position[0];
-				mMeshBoundsMin[ 1 ] = ( float ) position[1];
-				mMeshBoundsMin[ 2 ] = ( float ) position[2];
-				mMeshBoundsMax[ 0 ] = ( float ) position[0];
-				mMeshBoundsMax[ 1 ] = ( float ) position[1];
-				mMeshBoundsMax[ 2 ] = ( float ) position[2];
-				mMeshBoundsSet = true;
+				mMeshBoundsMin[ i ] = subMesh.boundsMin[ i ];
+				mMeshBoundsMax[ i ] = subMesh.boundsMax[ i ];
 			}
+			mMeshBoundsSet = true;
 		}
 	}
 
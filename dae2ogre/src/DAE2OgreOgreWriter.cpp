@@ -20,6 +20,7 @@ http://www.opensource.org/licenses/mit-license.php
 #include "COLLADAFWNode.h"
 #include "COLLADAFWVisualScene.h"
 #include "COLLADAFWInstanceGeometry.h"
+#include "COLLADAFWMeshOptimizer.h"
 
 
 #include <iostream>
@@ -35,6 +36,7 @@ namespace DAE2Ogre
 		, mOutputFile(outputFile)
 		, mCurrentRun(SCENEGRAPH_RUN)
 	, mVisualScene(0)
+		, mOptimizeMeshes(false)
 	{
 	}
 
@@ -149,6 +151,17 @@ namespace DAE2Ogre
 			return true;
 		if ( geometry->getType() != COLLADAFW::Geometry::GEO_TYPE_MESH )
 			return true;
+
+		// the mesh is owned by the loader, the optimizer works on a copy
+		if ( mOptimizeMeshes )
+		{
+			COLLADAFW::MeshOptimizer meshOptimizer;
+			COLLADAFW::Mesh* optimizedMesh = meshOptimizer.createOptimizedMesh( *(const COLLADAFW::Mesh*)geometry );
+			MeshWriter meshWriter( this, optimizedMesh );
+			bool success = meshWriter.write();
+			FW_DELETE optimizedMesh;
+			return success;
+		}
 	
 		MeshWriter meshWriter( this, (COLLADAFW::Mesh*)geometry );
 		return meshWriter.write();
@@ -31,47 +31,55 @@ namespace DAE2Ogre
 	//------------------------------
 	bool SceneGraphWriter::write(  )
 	{
-		createUniqueIdNodeMap();
-
-		NodeInfo nodeInfo( COLLADABU::Math::Matrix4::IDENTITY );
-		mNodeInfoStack.push( nodeInfo );
+		OgreWriter::LibraryNodesList::const_iterator it = mLibraryNodesList.begin();
+		for ( ; it != mLibraryNodesList.end(); ++it )
+		{
+			mTransformationCache.addLibraryNodes( *it );
+		}
+		mTransformationCache.build( mVisualScene );
 
-		writeNodes( mVisualScene.getRootNodes());
-		return true;
-	}
+		// the entries are in depth first order, i.e. the entries of the descendants of an entry follow it
+		size_t entryCount = mTransformationCache.getEntryCount();
+		std::vector<size_t> subtreeEnds( entryCount );
+		for ( size_t i = entryCount; i > 0; --i )
+		{
+			size_t entry = i - 1;
+			if ( subtreeEnds[entry] < i )
+				subtreeEnds[entry] = i;
+			size_t parent = mTransformationCache.getParent( entry );
+			if ( parent != COLLADAFW::TransformationCache::INVALID_ENTRY && subtreeEnds[parent] < subtreeEnds[entry] )
+				subtreeEnds[parent] = subtreeEnds[entry];
+		}
 
-	//------------------------------
-	bool SceneGraphWriter::writeNodes( const COLLADAFW::NodePointerArray& nodesToWriter )
-	{
-		for ( size_t i = 0, count = nodesToWriter.getCount(); i < count; ++i)
+		for ( size_t entry = 0; entry < entryCount; entry = subtreeEnds[entry] )
 		{
-			writeNode(nodesToWriter[i]);
+			writeEntry( entry, subtreeEnds );
 		}
 		return true;
 	}
 
 	//------------------------------
-	bool SceneGraphWriter::writeNode(const COLLADAFW::Node* nodeToWriter )
+	void SceneGraphWriter::writeEntry( size_t entry, const std::vector<size_t>& subtreeEnds )
 	{
-		
-		const NodeInfo& parentNodeInfo = mNodeInfoStack.top();
-		const COLLADABU::Math::Matrix4& parentWorldMatrix = parentNodeInfo.worldTransformation;
-		COLLADABU::Math::Matrix4 worldMatrix = parentWorldMatrix * nodeToWriter->getTransformationMatrix();
-		NodeInfo nodeInfo( worldMatrix );
-		mNodeInfoStack.push(nodeInfo);
-
-		writeNodes(nodeToWriter->getChildNodes());
-
-		storeInstanceGeometries( nodeToWriter->getInstanceGeometries(), worldMatrix);
-
-		writeInstanceNodes( nodeToWriter->getInstanceNodes() );
+		// the child nodes come first, followed by the instantiated nodes
+		size_t child = entry + 1;
+		size_t childNodeCount = mTransformationCache.getNode( entry )->getChildNodes().getCount();
+		for ( size_t i = 0; i < childNodeCount; ++i )
+		{
+			writeEntry( child, subtreeEnds );
+			child = subtreeEnds[child];
+		}
 
-		mNodeInfoStack.pop();
+		COLLADABU::Math::Matrix4 worldMatrix;
+		mTransformationCache.getWorldMatrix( entry, worldMatrix );
+		storeInstanceGeometries( mTransformationCache.getNode( entry )->getInstanceGeometries(), worldMatrix );
 
-		return true;
+		for ( ; child < subtreeEnds[entry]; child = subtreeEnds[child] )
+		{
+			writeEntry( child, subtreeEnds );
+		}
 	}
 
-
 	//------------------------------
 	void SceneGraphWriter::storeInstanceGeometries( const COLLADAFW::InstanceGeometryPointerArray& instanceGeometries, 
 													const COLLADABU::Math::Matrix4& worldMatrix  )
@@ -84,49 +92,4 @@ namespace DAE2Ogre
 		}
 	}
 
-	//------------------------------
-	void SceneGraphWriter::writeInstanceNodes( const COLLADAFW::InstanceNodePointerArray& instanceNodes)
-	{
-		for ( size_t i = 0, count = instanceNodes.getCount(); i < count; ++i)
-		{
-			const COLLADAFW::InstanceNode* instanceNode = instanceNodes[i];
-			const COLLADAFW::UniqueId& referencedNodeUniqueId = instanceNode->getInstanciatedObjectId();
-			UniqueIdNodeMap::const_iterator it = mUniqueIdNodeMap.find( referencedNodeUniqueId );
-			if ( it != mUniqueIdNodeMap.end() )
-			{
-				const COLLADAFW::Node* referencedNode = it->second;
-				writeNode( referencedNode );
-			}
-		}
-	}
-
-	//------------------------------
-	void SceneGraphWriter::createUniqueIdNodeMap( COLLADAFW::Node* node )
-	{
-		mUniqueIdNodeMap[node->getUniqueId()] = node;
-		createUniqueIdNodeMap( node->getChildNodes() );
-	}
-
-	//------------------------------
-	void SceneGraphWriter::createUniqueIdNodeMap( const COLLADAFW::NodePointerArray& nodes )
-	{
-		for ( size_t i = 0, cout = nodes.getCount(); i < cout; ++i)
-		{
-			COLLADAFW::Node* node = nodes[i];
-			createUniqueIdNodeMap( node );
-		}
-	}
-
-	//------------------------------
-	void SceneGraphWriter::createUniqueIdNodeMap()
-	{
-		createUniqueIdNodeMap( mVisualScene.getRootNodes() );
-		OgreWriter::LibraryNodesList::const_iterator it = mLibraryNodesList.begin();
-		for ( ; it != mLibraryNodesList.end(); ++it )
-		{
-			const COLLADAFW::LibraryNodes& libraryNodes = *it;
-			createUniqueIdNodeMap( libraryNodes.getNodes() );
-		}
-	}
-
 } // namespace DAE2Ogre
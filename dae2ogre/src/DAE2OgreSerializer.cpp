@@ -42,6 +42,7 @@ namespace DAE2Ogre
     const uint16 OgreSerializer::OTHER_ENDIAN_HEADER_STREAM_ID = 0x0010;
     //---------------------------------------------------------------------
     OgreSerializer::OgreSerializer()
+        : mBuffer( 0 )
     {
         // Version number
         mVersion = "[Serializer_v1.00]";
@@ -217,15 +218,15 @@ namespace DAE2Ogre
     //---------------------------------------------------------------------
     void OgreSerializer::writeData( const void* const buf, size_t size, size_t count )
     {
-        fwrite( ( void * const ) buf, size, count, mpfFile );
+        mBuffer->copyToBuffer( ( const char* ) buf, size * count );
     }
 
     //---------------------------------------------------------------------
     void OgreSerializer::writeString( const std::string& string )
     {
-        fputs( string.c_str(), mpfFile );
+        mBuffer->copyToBuffer( string.c_str(), string.length() );
         // Write terminating newline char
-        fputc( '\n', mpfFile );
+        mBuffer->copyToBuffer( '\n' );
     }
 
     //---------------------------------------------------------------------
@@ -267,16 +268,15 @@ namespace DAE2Ogre
         }
     }
 
-	fpos_t OgreSerializer::getPos()
+	Common::IBufferFlusher::MarkId OgreSerializer::markPosition()
 	{
-		fpos_t pos; 
-		fgetpos(mpfFile, &pos);
-		return pos;
+		mBuffer->startMark();
+		return mBuffer->endMark();
 	}
 
-	bool OgreSerializer::setPos( fpos_t pos )
+	bool OgreSerializer::jumpToPosition( Common::IBufferFlusher::MarkId position )
 	{
-		return (fsetpos( mpfFile, &pos) == 0);
+		return mBuffer->jumpToMark( position );
 	}
 }
 
@@ -25,13 +25,22 @@ int main(int argc, char* argv[])
 	_CrtSetDbgFlag ( _CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF ); 
 #endif
 
-	if ( argc > 2 ) 
+	bool optimizeMeshes = false;
+	int firstFileArgument = 1;
+	if ( argc > 1 && DAE2Ogre::String(argv[1]) == "-optimizeMeshes" )
+	{
+		optimizeMeshes = true;
+		firstFileArgument++;
+	}
+
+	if ( argc > firstFileArgument + 1 ) 
 	{
 
-		DAE2Ogre::String inputFile = argv[1];
-		DAE2Ogre::String outputFile = argv[2];
+		DAE2Ogre::String inputFile = argv[firstFileArgument];
+		DAE2Ogre::String outputFile = argv[firstFileArgument + 1];
 
 		DAE2Ogre::OgreWriter writer( COLLADABU::URI::nativePathToUri(inputFile), COLLADABU::URI::nativePathToUri(outputFile));
+		writer.setOptimizeMeshes( optimizeMeshes );
 		writer.write();
 
 	
@@ -40,6 +49,7 @@ int main(int argc, char* argv[])
 	{
 		std::cout << "You must specify an input and output file name" << std::endl;
 
-		std::cout << "Usage: dae2ogre <inputfilename> <outputfilename>" << std::endl;
+		std::cout << "Usage: dae2ogre [-optimizeMeshes] <inputfilename> <outputfilename>" << std::endl;
+		std::cout << "  -optimizeMeshes  Triangulate the meshes and reorder their triangles for the vertex cache" << std::endl;
 	}
 }
\ No newline at end of file
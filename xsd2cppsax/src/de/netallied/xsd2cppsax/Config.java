@@ -47,6 +47,12 @@ public class Config {
 
     private Map<String, String> cppStructMemberNameMapping;
 
+    /**
+     * Maps element names to the XSD built-in type used to convert their
+     * character data. For list types, the type replaces the item type.
+     */
+    private Map<String, String> elementDataTypeMapping;
+
     private Map<String, String> elementNameMapping;
 
     private boolean generateCoherencyTestParser;
@@ -101,6 +107,7 @@ public class Config {
         builtInTypeMaxValues = parseMapOption(props.getProperty("builtInTypeMaxValues"));
         builtInTypeMinValues = parseMapOption(props.getProperty("builtInTypeMinValues"));
         elementNameMapping = parseMapOption(props.getProperty("elementNameMapping"));
+        elementDataTypeMapping = parseMapOption(props.getProperty("elementDataTypeMapping"));
         cppStructMemberNameMapping = parseMapOption(props.getProperty("cppStructMemberNameMapping"));
         userTypeNameMapping = parseMapOption(props.getProperty("userTypeNameMapping"));
         xsNamespaceMapping = parseMapOption(props.getProperty("xsNamespaceMapping"));
@@ -319,6 +326,10 @@ public class Config {
         return checkOption(props.getProperty("elementNameDelimiter"));
     }
 
+    public Map<String, String> getElementDataTypeMapping() {
+        return elementDataTypeMapping;
+    }
+
     public Map<String, String> getElementNameMapping() {
         return elementNameMapping;
     }
@@ -231,13 +231,13 @@ public class Generator extends AbstractStackBasedTraverser implements DOMErrorHa
     /**
      * Creates parameter list of data convenience method.
      */
-    protected String createDataConvenienceParameterList(XSTypeDefinition type) {
+    protected String createDataConvenienceParameterList(XSTypeDefinition type, XSElementDeclaration element) {
         XSSimpleTypeDefinition simpleType = Util.findSimpleTypeDefinition(type);
         Variety variety = Util.findVariety(simpleType);
         if (variety == Variety.LIST) {
             simpleType = Util.findListItemType(simpleType);
         }
-        String xsdType = Util.findXSDSimpleTypeString(simpleType, config);
+        String xsdType = Util.findXSDSimpleTypeString(simpleType, element, config);
 
         String cppType = null;
         switch (variety) {
@@ -1925,7 +1925,7 @@ public class Generator extends AbstractStackBasedTraverser implements DOMErrorHa
      */
     protected void printDataConvenienceMethod(String cppName, XSElementDeclaration element) {
         String methodName = createDataConvenienceMethodName(cppName);
-        String paraList = createDataConvenienceParameterList(element.getTypeDefinition());
+        String paraList = createDataConvenienceParameterList(element.getTypeDefinition(), element);
         printDataConvenienceMethodToHeader(methodName, paraList);
         for (ICodePrinter printer : printers) {
             printer.printDataMethodToHeader(methodName, paraList, cppName, element);
@@ -3040,7 +3040,7 @@ public class Generator extends AbstractStackBasedTraverser implements DOMErrorHa
                 listType = simpleType;
                 simpleType = Util.findListItemType(simpleType);
             }
-            String xsdType = Util.findXSDSimpleTypeString(simpleType, config);
+            String xsdType = Util.findXSDSimpleTypeString(simpleType, element, config);
             String cppValidateEnd = null;
             String simpleTypeValiTmpl = null;
             switch (variety) {
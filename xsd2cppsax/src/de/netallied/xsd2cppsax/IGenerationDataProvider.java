@@ -19,7 +19,7 @@ public interface IGenerationDataProvider {
      * 
      * @note {@link Generator#fillInTemplate(String, String, String, String, XSTypeDefinition)}
      *       has a copy of this code, as it requires temporary variables.
-     * @note {@link Generator#createDataConvenienceParameterList(XSTypeDefinition)}
+     * @note {@link Generator#createDataConvenienceParameterList(XSTypeDefinition, XSElementDeclaration)}
      *       does something similar, too.
      * @param type
      *            XSD type to find C++ type for.
@@ -931,7 +931,8 @@ public class TemplateEngine {
             listType = simpleType;
             simpleType = Util.findListItemType(simpleType);
         }
-        String xsdType = Util.findXSDSimpleTypeString(simpleType, dataProvider.getConfig());
+        String xsdType = Util.findXSDSimpleTypeString(simpleType, attrUse == null ? element : null, dataProvider
+                .getConfig());
 
         if (tmpl.contains(Constants.TMPL_ATTRIBUTE_PARSING_SWITCH_DEFAULT)) {
             String code = null;
@@ -535,7 +535,7 @@ public class Util {
      * 
      * @note {@link TemplateEngine#fillInTemplate(String, String, String, String, XSTypeDefinition)}
      *       has a copy of this code, as it requires temporary variables.
-     * @note {@link Generator#createDataConvenienceParameterList(XSTypeDefinition)}
+     * @note {@link Generator#createDataConvenienceParameterList(XSTypeDefinition, XSElementDeclaration)}
      *       does something similar, too.
      * @param type
      *            XSD type to find C++ type for.
@@ -648,6 +648,28 @@ public class Util {
         }
     }
 
+    /**
+     * Finds XSD built-in type of the character data of an element. Takes care
+     * of the elementDataTypeMapping config option, which overrides the type
+     * found by {@link #findXSDSimpleTypeString(XSSimpleTypeDefinition, Config)}.
+     * 
+     * @param simpleType
+     *            Simple type of the character data. For lists the item type.
+     * @param element
+     *            Element the character data belongs to. May be null.
+     * @return XSD built-in type.
+     */
+    static public String findXSDSimpleTypeString(XSSimpleTypeDefinition simpleType, XSElementDeclaration element,
+            Config config) {
+        if (simpleType != null && element != null) {
+            String mappedType = config.getElementDataTypeMapping().get(element.getName());
+            if (mappedType != null) {
+                return mappedType;
+            }
+        }
+        return findXSDSimpleTypeString(simpleType, config);
+    }
+
     /**
      * Finds attribute name of a attribute use. Takes care of C++ keywords.
      */